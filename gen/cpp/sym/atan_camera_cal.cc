@@ -55,9 +55,9 @@ Eigen::Matrix<Scalar, 2, 1> ATANCameraCal<Scalar>::PixelFromCameraPoint(
 
   // Intermediate terms (4)
   const Scalar _tmp0 = std::max<Scalar>(epsilon, point(2, 0));
-  const Scalar _tmp1 = std::pow(_tmp0, Scalar(-2));
-  const Scalar _tmp2 = std::sqrt(Scalar(_tmp1 * std::pow(point(0, 0), Scalar(2)) +
-                                        _tmp1 * std::pow(point(1, 0), Scalar(2)) + epsilon));
+  const Scalar _tmp1 = Scalar(1.0) / (_tmp0 * _tmp0);
+  const Scalar _tmp2 = std::sqrt(
+      Scalar(_tmp1 * (point(0, 0) * point(0, 0)) + _tmp1 * (point(1, 0) * point(1, 0)) + epsilon));
   const Scalar _tmp3 =
       std::atan(2 * _tmp2 * std::tan(Scalar(0.5) * _self[4])) / (_self[4] * _tmp0 * _tmp2);
 
@@ -89,10 +89,10 @@ Eigen::Matrix<Scalar, 2, 1> ATANCameraCal<Scalar>::PixelFromCameraPointWithJacob
   // Intermediate terms (46)
   const Scalar _tmp0 = Scalar(0.5) * _self[4];
   const Scalar _tmp1 = std::tan(_tmp0);
-  const Scalar _tmp2 = std::pow(point(1, 0), Scalar(2));
+  const Scalar _tmp2 = (point(1, 0) * point(1, 0));
   const Scalar _tmp3 = std::max<Scalar>(epsilon, point(2, 0));
-  const Scalar _tmp4 = std::pow(_tmp3, Scalar(-2));
-  const Scalar _tmp5 = std::pow(point(0, 0), Scalar(2));
+  const Scalar _tmp4 = Scalar(1.0) / (_tmp3 * _tmp3);
+  const Scalar _tmp5 = (point(0, 0) * point(0, 0));
   const Scalar _tmp6 = _tmp2 * _tmp4 + _tmp4 * _tmp5 + epsilon;
   const Scalar _tmp7 = std::sqrt(_tmp6);
   const Scalar _tmp8 = 2 * _tmp7;
@@ -110,8 +110,8 @@ Eigen::Matrix<Scalar, 2, 1> ATANCameraCal<Scalar>::PixelFromCameraPointWithJacob
   const Scalar _tmp20 = _tmp14 * _tmp19;
   const Scalar _tmp21 = _self[0] * point(0, 0);
   const Scalar _tmp22 = _tmp10 * _tmp21;
-  const Scalar _tmp23 = _tmp12 * _tmp19 / std::pow(_self[4], Scalar(2));
-  const Scalar _tmp24 = std::pow(_tmp18, Scalar(2));
+  const Scalar _tmp23 = _tmp12 * _tmp19 / (_self[4] * _self[4]);
+  const Scalar _tmp24 = (_tmp18 * _tmp18);
   const Scalar _tmp25 = 4 * _tmp6;
   const Scalar _tmp26 = Scalar(1.0) * (_tmp24 + 1) / (_tmp24 * _tmp25 + 1);
   const Scalar _tmp27 = _tmp13 * _tmp21;
@@ -119,9 +119,9 @@ Eigen::Matrix<Scalar, 2, 1> ATANCameraCal<Scalar>::PixelFromCameraPointWithJacob
   const Scalar _tmp29 = _tmp10 * _tmp28;
   const Scalar _tmp30 = _tmp13 * _tmp28;
   const Scalar _tmp31 = _self[0] * _tmp5;
-  const Scalar _tmp32 = std::pow(_tmp3, Scalar(-3));
+  const Scalar _tmp32 = Scalar(1.0) / (_tmp3 * _tmp3 * _tmp3);
   const Scalar _tmp33 = _tmp11 * _tmp32;
-  const Scalar _tmp34 = _tmp1 / (_tmp6 * (std::pow(_tmp1, Scalar(2)) * _tmp25 + 1));
+  const Scalar _tmp34 = _tmp1 / (_tmp6 * ((_tmp1 * _tmp1) * _tmp25 + 1));
   const Scalar _tmp35 = 2 * _tmp33 * _tmp34;
   const Scalar _tmp36 = _tmp9 / (_tmp6 * std::sqrt(_tmp6));
   const Scalar _tmp37 = _tmp33 * _tmp36;
@@ -186,9 +186,8 @@ Eigen::Matrix<Scalar, 3, 1> ATANCameraCal<Scalar>::CameraRayFromPixel(
   // Intermediate terms (5)
   const Scalar _tmp0 = -_self[2] + pixel(0, 0);
   const Scalar _tmp1 = -_self[3] + pixel(1, 0);
-  const Scalar _tmp2 =
-      std::sqrt(Scalar(epsilon + std::pow(_tmp1, Scalar(2)) / std::pow(_self[1], Scalar(2)) +
-                       std::pow(_tmp0, Scalar(2)) / std::pow(_self[0], Scalar(2))));
+  const Scalar _tmp2 = std::sqrt(Scalar(epsilon + (_tmp1 * _tmp1) / (_self[1] * _self[1]) +
+                                        (_tmp0 * _tmp0) / (_self[0] * _self[0])));
   const Scalar _tmp3 = _self[4] * _tmp2;
   const Scalar _tmp4 =
       (Scalar(1) / Scalar(2)) * std::tan(_tmp3) / (_tmp2 * std::tan(Scalar(0.5) * _self[4]));
@@ -223,10 +222,10 @@ Eigen::Matrix<Scalar, 3, 1> ATANCameraCal<Scalar>::CameraRayFromPixelWithJacobia
   // Intermediate terms (54)
   const Scalar _tmp0 = -_self[2] + pixel(0, 0);
   const Scalar _tmp1 = -_self[3] + pixel(1, 0);
-  const Scalar _tmp2 = std::pow(_tmp1, Scalar(2));
-  const Scalar _tmp3 = std::pow(_self[1], Scalar(-2));
-  const Scalar _tmp4 = std::pow(_tmp0, Scalar(2));
-  const Scalar _tmp5 = std::pow(_self[0], Scalar(-2));
+  const Scalar _tmp2 = (_tmp1 * _tmp1);
+  const Scalar _tmp3 = Scalar(1.0) / (_self[1] * _self[1]);
+  const Scalar _tmp4 = (_tmp0 * _tmp0);
+  const Scalar _tmp5 = Scalar(1.0) / (_self[0] * _self[0]);
   const Scalar _tmp6 = _tmp2 * _tmp3 + _tmp4 * _tmp5 + epsilon;
   const Scalar _tmp7 = std::sqrt(_tmp6);
   const Scalar _tmp8 = _self[4] * _tmp7;
@@ -242,13 +241,10 @@ Eigen::Matrix<Scalar, 3, 1> ATANCameraCal<Scalar>::CameraRayFromPixelWithJacobia
   const Scalar _tmp18 = (Scalar(1) / Scalar(2)) * _tmp17;
   const Scalar _tmp19 = _tmp1 * _tmp18;
   const Scalar _tmp20 = _tmp10 * _tmp12;
-  const Scalar _tmp21 = [&]() {
-    const Scalar base = _tmp0;
-    return base * base * base;
-  }() / std::pow(_self[0], Scalar(4));
+  const Scalar _tmp21 = (_tmp0 * _tmp0 * _tmp0) / (_self[0] * _self[0] * _self[0] * _self[0]);
   const Scalar _tmp22 = std::tan(_tmp11);
   const Scalar _tmp23 = Scalar(1.0) / (_tmp22);
-  const Scalar _tmp24 = std::pow(_tmp9, Scalar(2)) + 1;
+  const Scalar _tmp24 = (_tmp9 * _tmp9) + 1;
   const Scalar _tmp25 = _tmp23 * _tmp24;
   const Scalar _tmp26 = _self[4] / _tmp6;
   const Scalar _tmp27 = (Scalar(1) / Scalar(2)) * _tmp26;
@@ -259,28 +255,19 @@ Eigen::Matrix<Scalar, 3, 1> ATANCameraCal<Scalar>::CameraRayFromPixelWithJacobia
   const Scalar _tmp32 = _tmp10 * _tmp23;
   const Scalar _tmp33 = (Scalar(1) / Scalar(2)) * _tmp32;
   const Scalar _tmp34 = _tmp0 * _tmp5;
-  const Scalar _tmp35 = _tmp4 / [&]() {
-    const Scalar base = _self[0];
-    return base * base * base;
-  }();
+  const Scalar _tmp35 = _tmp4 / (_self[0] * _self[0] * _self[0]);
   const Scalar _tmp36 = _tmp19 * _tmp25;
   const Scalar _tmp37 = _tmp26 * _tmp36;
   const Scalar _tmp38 = _tmp23 * _tmp29;
   const Scalar _tmp39 = _tmp19 * _tmp38;
-  const Scalar _tmp40 = _tmp2 / [&]() {
-    const Scalar base = _self[1];
-    return base * base * base;
-  }();
+  const Scalar _tmp40 = _tmp2 / (_self[1] * _self[1] * _self[1]);
   const Scalar _tmp41 = _tmp0 * _tmp14;
   const Scalar _tmp42 = _tmp25 * _tmp41;
   const Scalar _tmp43 = _tmp26 * _tmp42;
   const Scalar _tmp44 = _tmp38 * _tmp41;
-  const Scalar _tmp45 = [&]() {
-    const Scalar base = _tmp1;
-    return base * base * base;
-  }() / std::pow(_self[1], Scalar(4));
+  const Scalar _tmp45 = (_tmp1 * _tmp1 * _tmp1) / (_self[1] * _self[1] * _self[1] * _self[1]);
   const Scalar _tmp46 = _tmp1 * _tmp3;
-  const Scalar _tmp47 = std::pow(_tmp22, Scalar(2));
+  const Scalar _tmp47 = (_tmp22 * _tmp22);
   const Scalar _tmp48 = Scalar(0.25) * _tmp10 * (_tmp47 + 1) / _tmp47;
   const Scalar _tmp49 = _tmp12 * _tmp30;
   const Scalar _tmp50 = _tmp12 * _tmp24;
@@ -6,8 +6,12 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <Eigen/Dense>
 
+#include "./ops/batch_ops.h"
+
 namespace sym {
 
 /**
@@ -76,6 +80,34 @@ class Camera {
     return camera_ray;
   }
 
+  /**
+   * PixelFromCameraPoint for count points at once.  Every array is in structure-of-arrays layout,
+   * where coordinate i of point k is at points[i * stride + k], and likewise for pixels.
+   * is_valid[k] is 1 if pixel k is valid, including the image_size bounds, else 0.
+   *
+   * Requires sym/ops/<calibration>/batch_ops.h to be included.  To split the work across threads,
+   * call this on contiguous ranges of points (e.g. with sym::ParallelForBlocks), offsetting every
+   * array by the start of the range.
+   */
+  void PixelsFromCameraPoints(const size_t count, const size_t stride, const Scalar* const points,
+                              const Scalar epsilon, Scalar* const pixels,
+                              Scalar* const is_valid) const {
+    BatchOps<CameraCalType>::PixelFromCameraPoint(count, stride, calibration_.Data().data(), points,
+                                                  &epsilon, pixels, is_valid);
+    MaybeCheckInView(count, stride, pixels, is_valid);
+  }
+
+  /**
+   * CameraRayFromPixel for count pixels at once, see PixelsFromCameraPoints.
+   */
+  void CameraRaysFromPixels(const size_t count, const size_t stride, const Scalar* const pixels,
+                            const Scalar epsilon, Scalar* const camera_rays,
+                            Scalar* const is_valid) const {
+    BatchOps<CameraCalType>::CameraRayFromPixel(count, stride, calibration_.Data().data(), pixels,
+                                                &epsilon, camera_rays, is_valid);
+    MaybeCheckInView(count, stride, pixels, is_valid);
+  }
+
   Scalar MaybeCheckInView(const Eigen::Matrix<Scalar, 2, 1>& pixel) const {
     if (image_size_[0] <= 0 || image_size_[1] <= 0) {
       // image size is not defined, don't check if the pixel is in view
@@ -104,6 +136,22 @@ class Camera {
   }
 
  private:
+  // Multiplies is_valid[k] by MaybeCheckInView of pixel k, for pixels in structure-of-arrays layout
+  void MaybeCheckInView(const size_t count, const size_t stride, const Scalar* const pixels,
+                        Scalar* const is_valid) const {
+    if (image_size_[0] <= 0 || image_size_[1] <= 0) {
+      return;
+    }
+    const Scalar max_x = image_size_[0] - 1;
+    const Scalar max_y = image_size_[1] - 1;
+    for (size_t k = 0; k < count; k++) {
+      const Scalar x = pixels[k];
+      const Scalar y = pixels[stride + k];
+      const bool in_view = (x >= 0) && (x <= max_x) && (y >= 0) && (y <= max_y);
+      is_valid[k] *= in_view ? 1 : 0;
+    }
+  }
+
   CameraCalType calibration_;
   Eigen::Matrix<int, 2, 1> image_size_;
 };
@@ -0,0 +1,256 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     cam_package/camera_ray_lut.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <sym/camera.h>
+#include <sym/util/epsilon.h>
+
+namespace sym {
+
+namespace internal {
+
+// Whether CameraCalType implements CameraRayFromPixel
+template <typename CameraCalType, typename = void>
+struct HasCameraRayFromPixel : std::false_type {};
+
+template <typename CameraCalType>
+struct HasCameraRayFromPixel<
+    CameraCalType, decltype(std::declval<const CameraCalType&>().CameraRayFromPixel(
+                                std::declval<Eigen::Matrix<typename CameraCalType::Scalar, 2, 1>>(),
+                                typename CameraCalType::Scalar(), nullptr),
+                            void())> : std::true_type {};
+
+}  // namespace internal
+
+/**
+ * Table of the camera rays of a grid of pixels covering the image of a camera, for dense
+ * backprojection (e.g. rectification or unprojecting depth images).  The rays of other pixels are
+ * interpolated bilinearly between the four surrounding grid nodes.
+ *
+ * The table is computed in double precision.  Calibrations which implement CameraRayFromPixel use
+ * it directly.  For the others (e.g. PolynomialCameraCal and SphericalCameraCal), the ray of each
+ * node is found by Gauss-Newton on the reprojection error, starting from the ray of a neighboring
+ * node, so the table is only valid where the projection is invertible.
+ *
+ * Construction computes the whole table, split by rows across threads, so should be done once per
+ * calibration; Update rebuilds it only if the calibration has changed.
+ */
+template <typename CameraCalType>
+class CameraRayLut {
+ public:
+  using Scalar = typename CameraCalType::Scalar;
+
+  /**
+   * Builds the table for the given camera, which must have an image size, with grid nodes every
+   * step pixels.  Uses num_threads threads, or std::thread::hardware_concurrency() if 0.
+   */
+  explicit CameraRayLut(const Camera<CameraCalType>& camera, const int step = 1,
+                        const int num_threads = 0)
+      : camera_(camera), step_(step), num_threads_(num_threads) {
+    if (step_ <= 0) {
+      throw std::invalid_argument("CameraRayLut step must be positive");
+    }
+    if (num_threads_ < 0) {
+      throw std::invalid_argument("CameraRayLut num_threads must not be negative");
+    }
+    Build();
+  }
+
+  /**
+   * Rebuilds the table if the calibration or image size of camera differs from those the table
+   * was built for.  Returns true if the table was rebuilt.
+   */
+  bool Update(const Camera<CameraCalType>& camera) {
+    if (camera.Calibration().Data() == camera_.Calibration().Data() &&
+        camera.ImageSize() == camera_.ImageSize()) {
+      return false;
+    }
+    camera_ = camera;
+    Build();
+    return true;
+  }
+
+  /**
+   * The unit ray in the camera frame for the given pixel, interpolated from the table.
+   *
+   * Return:
+   *     camera_ray: The ray in the camera frame (normalized, unlike Camera::CameraRayFromPixel)
+   *     is_valid: 1 if the pixel is in the image and the four surrounding grid nodes are valid
+   *         else 0
+   */
+  Eigen::Matrix<Scalar, 3, 1> CameraRayFromPixel(const Eigen::Matrix<Scalar, 2, 1>& pixel,
+                                                 Scalar* const is_valid = nullptr) const {
+    // Pixels outside the image use the nearest cell, and are invalid
+    const Scalar x = pixel[0] / step_;
+    const Scalar y = pixel[1] / step_;
+    const int col = std::min(std::max(static_cast<int>(std::floor(x)), 0), num_cols_ - 2);
+    const int row = std::min(std::max(static_cast<int>(std::floor(y)), 0), num_rows_ - 2);
+    const Scalar a = x - col;
+    const Scalar b = y - row;
+
+    const size_t i00 = static_cast<size_t>(row) * num_cols_ + col;
+    const size_t i10 = i00 + num_cols_;
+    const Eigen::Matrix<Scalar, 3, 1> camera_ray =
+        (1 - b) * ((1 - a) * rays_[i00] + a * rays_[i00 + 1]) +
+        b * ((1 - a) * rays_[i10] + a * rays_[i10 + 1]);
+
+    if (is_valid != nullptr) {
+      *is_valid = camera_.MaybeCheckInView(pixel) * valid_[i00] * valid_[i00 + 1] * valid_[i10] *
+                  valid_[i10 + 1];
+    }
+    return camera_ray.normalized();
+  }
+
+  /**
+   * CameraRayFromPixel for count pixels at once, in the structure-of-arrays layout of
+   * Camera::CameraRaysFromPixels.
+   */
+  void CameraRaysFromPixels(const size_t count, const size_t stride, const Scalar* const pixels,
+                            Scalar* const camera_rays, Scalar* const is_valid) const {
+    for (size_t k = 0; k < count; k++) {
+      const Eigen::Matrix<Scalar, 3, 1> camera_ray = CameraRayFromPixel(
+          Eigen::Matrix<Scalar, 2, 1>(pixels[k], pixels[stride + k]), is_valid + k);
+      camera_rays[k] = camera_ray[0];
+      camera_rays[stride + k] = camera_ray[1];
+      camera_rays[2 * stride + k] = camera_ray[2];
+    }
+  }
+
+  CameraCalType Calibration() const {
+    return camera_.Calibration();
+  }
+
+  Eigen::Matrix<int, 2, 1> ImageSize() const {
+    return camera_.ImageSize();
+  }
+
+  int Step() const {
+    return step_;
+  }
+
+ private:
+  using CalibrationD = decltype(std::declval<CameraCalType>().template Cast<double>());
+
+  // Gauss-Newton iterations and pixel error for the iterative backprojection
+  static constexpr int kMaxIterations = 50;
+  static constexpr double kPixelTolerance = 1e-9;
+
+  void Build() {
+    const Eigen::Matrix<int, 2, 1> image_size = camera_.ImageSize();
+    if (image_size[0] <= 0 || image_size[1] <= 0) {
+      throw std::invalid_argument("CameraRayLut requires a camera with an image size");
+    }
+
+    // Enough nodes to cover [0, image_size - 1], and at least one cell
+    num_cols_ = std::max((image_size[0] - 1 + step_ - 1) / step_ + 1, 2);
+    num_rows_ = std::max((image_size[1] - 1 + step_ - 1) / step_ + 1, 2);
+    rays_.assign(static_cast<size_t>(num_cols_) * num_rows_, Eigen::Matrix<Scalar, 3, 1>::Zero());
+    valid_.assign(rays_.size(), 0);
+
+    const int requested_threads =
+        num_threads_ > 0 ? num_threads_
+                         : static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    const int num_workers = std::min(requested_threads, num_rows_);
+    const CalibrationD calibration = camera_.Calibration().template Cast<double>();
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers - 1);
+    for (int i = 1; i < num_workers; i++) {
+      threads.emplace_back([&, i]() {
+        BuildRows(calibration, i * num_rows_ / num_workers, (i + 1) * num_rows_ / num_workers);
+      });
+    }
+    BuildRows(calibration, 0, num_rows_ / num_workers);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void BuildRows(const CalibrationD& calibration, const int begin, const int end) {
+    const Eigen::Vector2d focal_length = calibration.FocalLength();
+    const Eigen::Vector2d principal_point = calibration.PrincipalPoint();
+
+    for (int row = begin; row < end; row++) {
+      for (int col = 0; col < num_cols_; col++) {
+        const size_t index = static_cast<size_t>(row) * num_cols_ + col;
+        const Eigen::Vector2d pixel(col * step_, row * step_);
+
+        // Start from the left or upper node, or else from the ray of a linear camera
+        Eigen::Vector3d guess;
+        if (col > 0 && valid_[index - 1] != 0) {
+          guess = rays_[index - 1].template cast<double>();
+        } else if (row > begin && valid_[index - num_cols_] != 0) {
+          guess = rays_[index - num_cols_].template cast<double>();
+        } else {
+          guess = Eigen::Vector3d((pixel[0] - principal_point[0]) / focal_length[0],
+                                  (pixel[1] - principal_point[1]) / focal_length[1], 1);
+        }
+
+        double is_valid = 0;
+        const Eigen::Vector3d camera_ray = Backproject(
+            calibration, pixel, guess, &is_valid, internal::HasCameraRayFromPixel<CalibrationD>());
+        if (is_valid != 0) {
+          rays_[index] = camera_ray.template cast<Scalar>();
+          valid_[index] = 1;
+        }
+      }
+    }
+  }
+
+  static Eigen::Vector3d Backproject(const CalibrationD& calibration, const Eigen::Vector2d& pixel,
+                                     const Eigen::Vector3d& /* guess */, double* const is_valid,
+                                     std::true_type /* has_camera_ray_from_pixel */) {
+    return calibration.CameraRayFromPixel(pixel, kDefaultEpsilon<double>, is_valid).normalized();
+  }
+
+  static Eigen::Vector3d Backproject(const CalibrationD& calibration, const Eigen::Vector2d& pixel,
+                                     const Eigen::Vector3d& guess, double* const is_valid,
+                                     std::false_type /* has_camera_ray_from_pixel */) {
+    Eigen::Vector3d camera_ray = guess.normalized();
+    for (int i = 0; i < kMaxIterations; i++) {
+      Eigen::Matrix<double, 2, 3> pixel_D_point;
+      const Eigen::Vector2d error =
+          calibration.PixelFromCameraPointWithJacobians(camera_ray, kDefaultEpsilon<double>,
+                                                        is_valid, nullptr, &pixel_D_point) -
+          pixel;
+      if (error.norm() < kPixelTolerance) {
+        return camera_ray;
+      }
+
+      // The projection doesn't depend on the length of the ray, so take the minimum norm step
+      const Eigen::Matrix2d hessian = pixel_D_point * pixel_D_point.transpose();
+      camera_ray -= pixel_D_point.transpose() * hessian.ldlt().solve(error);
+      camera_ray.normalize();
+    }
+
+    *is_valid = 0;
+    return Eigen::Vector3d::Zero();
+  }
+
+  Camera<CameraCalType> camera_;
+  int step_;
+  int num_threads_;
+
+  // Grid nodes in row-major order, where node (row, col) is at pixel (col * step, row * step)
+  int num_cols_;
+  int num_rows_;
+  std::vector<Eigen::Matrix<Scalar, 3, 1>> rays_;
+  std::vector<Scalar> valid_;
+};
+
+}  // namespace sym
@@ -54,9 +54,9 @@ Eigen::Matrix<Scalar, 2, 1> DoubleSphereCameraCal<Scalar>::PixelFromCameraPoint(
   const Eigen::Matrix<Scalar, 6, 1>& _self = Data();
 
   // Intermediate terms (13)
-  const Scalar _tmp0 = std::pow(epsilon, Scalar(2)) + std::pow(point(0, 0), Scalar(2)) +
-                       std::pow(point(1, 0), Scalar(2));
-  const Scalar _tmp1 = std::sqrt(Scalar(_tmp0 + std::pow(point(2, 0), Scalar(2))));
+  const Scalar _tmp0 =
+      (epsilon * epsilon) + (point(0, 0) * point(0, 0)) + (point(1, 0) * point(1, 0));
+  const Scalar _tmp1 = std::sqrt(Scalar(_tmp0 + (point(2, 0) * point(2, 0))));
   const Scalar _tmp2 = _self[4] * _tmp1 + point(2, 0);
   const Scalar _tmp3 =
       std::min<Scalar>(0, (((_self[5] + Scalar(-0.5)) > 0) - ((_self[5] + Scalar(-0.5)) < 0)));
@@ -65,13 +65,12 @@ Eigen::Matrix<Scalar, 2, 1> DoubleSphereCameraCal<Scalar>::PixelFromCameraPoint(
   const Scalar _tmp6 = -_tmp5;
   const Scalar _tmp7 =
       Scalar(1.0) /
-      (std::max<Scalar>(
-          epsilon,
-          _tmp2 * (_tmp6 + 1) + _tmp5 * std::sqrt(Scalar(_tmp0 + std::pow(_tmp2, Scalar(2))))));
+      (std::max<Scalar>(epsilon,
+                        _tmp2 * (_tmp6 + 1) + _tmp5 * std::sqrt(Scalar(_tmp0 + (_tmp2 * _tmp2)))));
   const Scalar _tmp8 = _tmp3 + _tmp5;
   const Scalar _tmp9 = (Scalar(1) / Scalar(2)) * _tmp4 + _tmp6 + 1;
-  const Scalar _tmp10 = std::pow(_self[4], Scalar(2));
-  const Scalar _tmp11 = std::pow(_tmp9, Scalar(2)) / std::pow(_tmp8, Scalar(2));
+  const Scalar _tmp10 = (_self[4] * _self[4]);
+  const Scalar _tmp11 = (_tmp9 * _tmp9) / (_tmp8 * _tmp8);
   const Scalar _tmp12 = _tmp10 * _tmp11 - _tmp10 + 1;
 
   // Output terms (2)
@@ -118,11 +117,11 @@ Eigen::Matrix<Scalar, 2, 1> DoubleSphereCameraCal<Scalar>::PixelFromCameraPointW
   const Eigen::Matrix<Scalar, 6, 1>& _self = Data();
 
   // Intermediate terms (40)
-  const Scalar _tmp0 = std::pow(epsilon, Scalar(2)) + std::pow(point(0, 0), Scalar(2)) +
-                       std::pow(point(1, 0), Scalar(2));
-  const Scalar _tmp1 = std::sqrt(Scalar(_tmp0 + std::pow(point(2, 0), Scalar(2))));
+  const Scalar _tmp0 =
+      (epsilon * epsilon) + (point(0, 0) * point(0, 0)) + (point(1, 0) * point(1, 0));
+  const Scalar _tmp1 = std::sqrt(Scalar(_tmp0 + (point(2, 0) * point(2, 0))));
   const Scalar _tmp2 = _self[4] * _tmp1 + point(2, 0);
-  const Scalar _tmp3 = std::sqrt(Scalar(_tmp0 + std::pow(_tmp2, Scalar(2))));
+  const Scalar _tmp3 = std::sqrt(Scalar(_tmp0 + (_tmp2 * _tmp2)));
   const Scalar _tmp4 =
       std::min<Scalar>(0, (((_self[5] + Scalar(-0.5)) > 0) - ((_self[5] + Scalar(-0.5)) < 0)));
   const Scalar _tmp5 = 2 * _tmp4;
@@ -137,15 +136,15 @@ Eigen::Matrix<Scalar, 2, 1> DoubleSphereCameraCal<Scalar>::PixelFromCameraPointW
   const Scalar _tmp14 = _self[4] * point(2, 0);
   const Scalar _tmp15 = _tmp4 + _tmp6;
   const Scalar _tmp16 = (Scalar(1) / Scalar(2)) * _tmp5 + _tmp7 + 1;
-  const Scalar _tmp17 = std::pow(_self[4], Scalar(2));
-  const Scalar _tmp18 = std::pow(_tmp16, Scalar(2)) / std::pow(_tmp15, Scalar(2));
+  const Scalar _tmp17 = (_self[4] * _self[4]);
+  const Scalar _tmp18 = (_tmp16 * _tmp16) / (_tmp15 * _tmp15);
   const Scalar _tmp19 = _tmp17 * _tmp18 - _tmp17 + 1;
   const Scalar _tmp20 = _self[0] * point(0, 0);
   const Scalar _tmp21 = _tmp6 / _tmp3;
   const Scalar _tmp22 = _tmp2 * _tmp21;
   const Scalar _tmp23 = (Scalar(1) / Scalar(2)) *
                         ((((_tmp9 - epsilon) > 0) - ((_tmp9 - epsilon) < 0)) + 1) /
-                        std::pow(_tmp10, Scalar(2));
+                        (_tmp10 * _tmp10);
   const Scalar _tmp24 = _tmp23 * (_tmp1 * _tmp22 + _tmp1 * _tmp8);
   const Scalar _tmp25 = _self[1] * point(1, 0);
   const Scalar _tmp26 = -_tmp2 + _tmp3;
@@ -238,18 +237,18 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixel(
   // Intermediate terms (12)
   const Scalar _tmp0 = -_self[2] + pixel(0, 0);
   const Scalar _tmp1 = -_self[3] + pixel(1, 0);
-  const Scalar _tmp2 = std::pow(_tmp1, Scalar(2)) / std::pow(_self[1], Scalar(2)) +
-                       std::pow(_tmp0, Scalar(2)) / std::pow(_self[0], Scalar(2));
-  const Scalar _tmp3 = -std::pow(_self[5], Scalar(2)) * _tmp2 + 1;
+  const Scalar _tmp2 =
+      (_tmp1 * _tmp1) / (_self[1] * _self[1]) + (_tmp0 * _tmp0) / (_self[0] * _self[0]);
+  const Scalar _tmp3 = -(_self[5] * _self[5]) * _tmp2 + 1;
   const Scalar _tmp4 = -_tmp2 * (2 * _self[5] - 1) + 1;
   const Scalar _tmp5 =
       _self[5] * std::sqrt(Scalar(std::max<Scalar>(_tmp4, epsilon))) - _self[5] + 1;
   const Scalar _tmp6 =
       _tmp5 + epsilon * (2 * std::min<Scalar>(0, (((_tmp5) > 0) - ((_tmp5) < 0))) + 1);
-  const Scalar _tmp7 = std::pow(_tmp3, Scalar(2)) / std::pow(_tmp6, Scalar(2));
+  const Scalar _tmp7 = (_tmp3 * _tmp3) / (_tmp6 * _tmp6);
   const Scalar _tmp8 = _tmp2 + _tmp7;
   const Scalar _tmp9 = _tmp3 / _tmp6;
-  const Scalar _tmp10 = _tmp2 * (1 - std::pow(_self[4], Scalar(2))) + _tmp7;
+  const Scalar _tmp10 = _tmp2 * (1 - (_self[4] * _self[4])) + _tmp7;
   const Scalar _tmp11 =
       (_self[4] * _tmp9 + std::sqrt(Scalar(std::max<Scalar>(_tmp10, epsilon)))) /
       (_tmp8 + epsilon * (2 * std::min<Scalar>(0, (((_tmp8) > 0) - ((_tmp8) < 0))) + 1));
@@ -285,14 +284,14 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixelWit
   const Scalar _tmp0 = -_self[2] + pixel(0, 0);
   const Scalar _tmp1 = Scalar(1.0) / (_self[0]);
   const Scalar _tmp2 = -_self[3] + pixel(1, 0);
-  const Scalar _tmp3 = std::pow(_tmp2, Scalar(2));
-  const Scalar _tmp4 = std::pow(_self[1], Scalar(-2));
-  const Scalar _tmp5 = std::pow(_tmp0, Scalar(2));
-  const Scalar _tmp6 = std::pow(_self[0], Scalar(-2));
+  const Scalar _tmp3 = (_tmp2 * _tmp2);
+  const Scalar _tmp4 = Scalar(1.0) / (_self[1] * _self[1]);
+  const Scalar _tmp5 = (_tmp0 * _tmp0);
+  const Scalar _tmp6 = Scalar(1.0) / (_self[0] * _self[0]);
   const Scalar _tmp7 = _tmp3 * _tmp4 + _tmp5 * _tmp6;
-  const Scalar _tmp8 = std::pow(_self[5], Scalar(2));
+  const Scalar _tmp8 = (_self[5] * _self[5]);
   const Scalar _tmp9 = -_tmp7 * _tmp8 + 1;
-  const Scalar _tmp10 = std::pow(_tmp9, Scalar(2));
+  const Scalar _tmp10 = (_tmp9 * _tmp9);
   const Scalar _tmp11 = 2 * _self[5];
   const Scalar _tmp12 = _tmp11 - 1;
   const Scalar _tmp13 = -_tmp12 * _tmp7 + 1;
@@ -300,7 +299,7 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixelWit
   const Scalar _tmp15 = _self[5] * _tmp14 - _self[5] + 1;
   const Scalar _tmp16 =
       _tmp15 + epsilon * (2 * std::min<Scalar>(0, (((_tmp15) > 0) - ((_tmp15) < 0))) + 1);
-  const Scalar _tmp17 = std::pow(_tmp16, Scalar(-2));
+  const Scalar _tmp17 = Scalar(1.0) / (_tmp16 * _tmp16);
   const Scalar _tmp18 = _tmp10 * _tmp17;
   const Scalar _tmp19 = _tmp18 + _tmp7;
   const Scalar _tmp20 =
@@ -308,7 +307,7 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixelWit
   const Scalar _tmp21 = Scalar(1.0) / (_tmp20);
   const Scalar _tmp22 = Scalar(1.0) / (_tmp16);
   const Scalar _tmp23 = _tmp22 * _tmp9;
-  const Scalar _tmp24 = 1 - std::pow(_self[4], Scalar(2));
+  const Scalar _tmp24 = 1 - (_self[4] * _self[4]);
   const Scalar _tmp25 = _tmp18 + _tmp24 * _tmp7;
   const Scalar _tmp26 = std::sqrt(Scalar(std::max<Scalar>(_tmp25, epsilon)));
   const Scalar _tmp27 = _self[4] * _tmp23 + _tmp26;
@@ -319,25 +318,19 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixelWit
   const Scalar _tmp32 = _tmp0 * _tmp6;
   const Scalar _tmp33 = _tmp28 * _tmp32;
   const Scalar _tmp34 = _tmp0 * _tmp1;
-  const Scalar _tmp35 = _tmp5 / [&]() {
-    const Scalar base = _self[0];
-    return base * base * base;
-  }();
+  const Scalar _tmp35 = _tmp5 / (_self[0] * _self[0] * _self[0]);
   const Scalar _tmp36 = 2 * _tmp35;
   const Scalar _tmp37 = _tmp17 * _tmp9;
   const Scalar _tmp38 = 4 * _tmp37;
   const Scalar _tmp39 = _tmp38 * _tmp8;
-  const Scalar _tmp40 = _tmp10 / [&]() {
-    const Scalar base = _tmp16;
-    return base * base * base;
-  }();
+  const Scalar _tmp40 = _tmp10 / (_tmp16 * _tmp16 * _tmp16);
   const Scalar _tmp41 = -epsilon;
   const Scalar _tmp42 =
       _self[5] * ((((_tmp13 + _tmp41) > 0) - ((_tmp13 + _tmp41) < 0)) + 1) / _tmp14;
   const Scalar _tmp43 = _tmp12 * _tmp42;
   const Scalar _tmp44 = _tmp40 * _tmp43;
   const Scalar _tmp45 = _tmp35 * _tmp39 - _tmp35 * _tmp44;
-  const Scalar _tmp46 = _tmp27 / std::pow(_tmp20, Scalar(2));
+  const Scalar _tmp46 = _tmp27 / (_tmp20 * _tmp20);
   const Scalar _tmp47 = _tmp46 * (-_tmp36 + _tmp45);
   const Scalar _tmp48 = (Scalar(1) / Scalar(2)) * _tmp37 * _tmp43;
   const Scalar _tmp49 = _self[4] * _tmp48;
@@ -352,10 +345,7 @@ Eigen::Matrix<Scalar, 3, 1> DoubleSphereCameraCal<Scalar>::CameraRayFromPixelWit
   const Scalar _tmp58 = _tmp57 * _tmp8;
   const Scalar _tmp59 = _tmp28 * _tmp48;
   const Scalar _tmp60 = _tmp21 * _tmp23;
-  const Scalar _tmp61 = _tmp3 / [&]() {
-    const Scalar base = _self[1];
-    return base * base * base;
-  }();
+  const Scalar _tmp61 = _tmp3 / (_self[1] * _self[1] * _self[1]);
   const Scalar _tmp62 = 2 * _tmp61;
   const Scalar _tmp63 = _tmp39 * _tmp61 - _tmp44 * _tmp61;
   const Scalar _tmp64 = _tmp46 * (-_tmp62 + _tmp63);
@@ -54,7 +54,7 @@ Eigen::Matrix<Scalar, 2, 1> EquirectangularCameraCal<Scalar>::PixelFromCameraPoi
   const Eigen::Matrix<Scalar, 4, 1>& _self = Data();
 
   // Intermediate terms (1)
-  const Scalar _tmp0 = std::pow(point(0, 0), Scalar(2)) + std::pow(point(2, 0), Scalar(2));
+  const Scalar _tmp0 = (point(0, 0) * point(0, 0)) + (point(2, 0) * point(2, 0));
 
   // Output terms (2)
   Eigen::Matrix<Scalar, 2, 1> _pixel;
@@ -69,8 +69,8 @@ Eigen::Matrix<Scalar, 2, 1> EquirectangularCameraCal<Scalar>::PixelFromCameraPoi
   if (is_valid != nullptr) {
     Scalar& _is_valid = (*is_valid);
 
-    _is_valid = std::max<Scalar>(0, (((_tmp0 + std::pow(point(1, 0), Scalar(2))) > 0) -
-                                     ((_tmp0 + std::pow(point(1, 0), Scalar(2))) < 0)));
+    _is_valid = std::max<Scalar>(0, (((_tmp0 + (point(1, 0) * point(1, 0))) > 0) -
+                                     ((_tmp0 + (point(1, 0) * point(1, 0))) < 0)));
   }
 
   return _pixel;
@@ -90,12 +90,12 @@ Eigen::Matrix<Scalar, 2, 1> EquirectangularCameraCal<Scalar>::PixelFromCameraPoi
   const Scalar _tmp0 =
       epsilon * ((((point(2, 0)) > 0) - ((point(2, 0)) < 0)) + Scalar(0.5)) + point(2, 0);
   const Scalar _tmp1 = std::atan2(point(0, 0), _tmp0);
-  const Scalar _tmp2 = std::pow(point(0, 0), Scalar(2));
-  const Scalar _tmp3 = _tmp2 + std::pow(point(2, 0), Scalar(2));
+  const Scalar _tmp2 = (point(0, 0) * point(0, 0));
+  const Scalar _tmp3 = _tmp2 + (point(2, 0) * point(2, 0));
   const Scalar _tmp4 = std::sqrt(Scalar(_tmp3 + epsilon));
   const Scalar _tmp5 = std::atan2(point(1, 0), _tmp4);
-  const Scalar _tmp6 = _tmp3 + std::pow(point(1, 0), Scalar(2));
-  const Scalar _tmp7 = _self[0] / (std::pow(_tmp0, Scalar(2)) + _tmp2);
+  const Scalar _tmp6 = _tmp3 + (point(1, 0) * point(1, 0));
+  const Scalar _tmp7 = _self[0] / ((_tmp0 * _tmp0) + _tmp2);
   const Scalar _tmp8 = _self[1] / (_tmp6 + epsilon);
   const Scalar _tmp9 = _tmp8 * point(1, 0) / _tmp4;
 
@@ -199,8 +199,8 @@ Eigen::Matrix<Scalar, 3, 1> EquirectangularCameraCal<Scalar>::CameraRayFromPixel
   const Scalar _tmp9 = std::sin(_tmp2);
   const Scalar _tmp10 = std::cos(_tmp6);
   const Scalar _tmp11 = _tmp10 * _tmp3;
-  const Scalar _tmp12 = _tmp4 / std::pow(_self[0], Scalar(2));
-  const Scalar _tmp13 = _tmp0 / std::pow(_self[1], Scalar(2));
+  const Scalar _tmp12 = _tmp4 / (_self[0] * _self[0]);
+  const Scalar _tmp13 = _tmp0 / (_self[1] * _self[1]);
   const Scalar _tmp14 = _tmp13 * _tmp9;
   const Scalar _tmp15 = _tmp11 * _tmp5;
   const Scalar _tmp16 = _tmp5 * _tmp8;
@@ -25,7 +25,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x6) jacobian of res wrt args a (3), b (3)
- *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3)
+ *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for args a (3), b (3)
  */
 template <typename Scalar>
@@ -51,9 +53,9 @@ void BetweenFactorMatrix31(const Eigen::Matrix<Scalar, 3, 1>& a,
   const Scalar _tmp3 = _tmp0 * sqrt_info(0, 1) + _tmp1 * sqrt_info(0, 2) + _tmp2 * sqrt_info(0, 0);
   const Scalar _tmp4 = _tmp0 * sqrt_info(1, 1) + _tmp1 * sqrt_info(1, 2) + _tmp2 * sqrt_info(1, 0);
   const Scalar _tmp5 = _tmp0 * sqrt_info(2, 1) + _tmp1 * sqrt_info(2, 2) + _tmp2 * sqrt_info(2, 0);
-  const Scalar _tmp6 = std::pow(sqrt_info(0, 0), Scalar(2));
-  const Scalar _tmp7 = std::pow(sqrt_info(2, 0), Scalar(2));
-  const Scalar _tmp8 = std::pow(sqrt_info(1, 0), Scalar(2));
+  const Scalar _tmp6 = (sqrt_info(0, 0) * sqrt_info(0, 0));
+  const Scalar _tmp7 = (sqrt_info(2, 0) * sqrt_info(2, 0));
+  const Scalar _tmp8 = (sqrt_info(1, 0) * sqrt_info(1, 0));
   const Scalar _tmp9 = _tmp6 + _tmp7 + _tmp8;
   const Scalar _tmp10 = sqrt_info(0, 0) * sqrt_info(0, 1);
   const Scalar _tmp11 = sqrt_info(2, 0) * sqrt_info(2, 1);
@@ -65,18 +67,18 @@ void BetweenFactorMatrix31(const Eigen::Matrix<Scalar, 3, 1>& a,
   const Scalar _tmp17 = _tmp14 + _tmp15 + _tmp16;
   const Scalar _tmp18 = -_tmp10 - _tmp11 - _tmp12;
   const Scalar _tmp19 = -_tmp14 - _tmp15 - _tmp16;
-  const Scalar _tmp20 = std::pow(sqrt_info(0, 1), Scalar(2));
-  const Scalar _tmp21 = std::pow(sqrt_info(2, 1), Scalar(2));
-  const Scalar _tmp22 = std::pow(sqrt_info(1, 1), Scalar(2));
+  const Scalar _tmp20 = (sqrt_info(0, 1) * sqrt_info(0, 1));
+  const Scalar _tmp21 = (sqrt_info(2, 1) * sqrt_info(2, 1));
+  const Scalar _tmp22 = (sqrt_info(1, 1) * sqrt_info(1, 1));
   const Scalar _tmp23 = _tmp20 + _tmp21 + _tmp22;
   const Scalar _tmp24 = sqrt_info(0, 1) * sqrt_info(0, 2);
   const Scalar _tmp25 = sqrt_info(2, 1) * sqrt_info(2, 2);
   const Scalar _tmp26 = sqrt_info(1, 1) * sqrt_info(1, 2);
   const Scalar _tmp27 = _tmp24 + _tmp25 + _tmp26;
   const Scalar _tmp28 = -_tmp24 - _tmp25 - _tmp26;
-  const Scalar _tmp29 = std::pow(sqrt_info(0, 2), Scalar(2));
-  const Scalar _tmp30 = std::pow(sqrt_info(2, 2), Scalar(2));
-  const Scalar _tmp31 = std::pow(sqrt_info(1, 2), Scalar(2));
+  const Scalar _tmp29 = (sqrt_info(0, 2) * sqrt_info(0, 2));
+  const Scalar _tmp30 = (sqrt_info(2, 2) * sqrt_info(2, 2));
+  const Scalar _tmp31 = (sqrt_info(1, 2) * sqrt_info(1, 2));
   const Scalar _tmp32 = _tmp29 + _tmp30 + _tmp31;
   const Scalar _tmp33 = _tmp5 * sqrt_info(2, 0);
   const Scalar _tmp34 = _tmp3 * sqrt_info(0, 0);
@@ -129,35 +131,20 @@ void BetweenFactorMatrix31(const Eigen::Matrix<Scalar, 3, 1>& a,
     _hessian(3, 0) = -_tmp6 - _tmp7 - _tmp8;
     _hessian(4, 0) = _tmp18;
     _hessian(5, 0) = _tmp19;
-    _hessian(0, 1) = 0;
     _hessian(1, 1) = _tmp23;
     _hessian(2, 1) = _tmp27;
     _hessian(3, 1) = _tmp18;
     _hessian(4, 1) = -_tmp20 - _tmp21 - _tmp22;
     _hessian(5, 1) = _tmp28;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
     _hessian(2, 2) = _tmp32;
     _hessian(3, 2) = _tmp19;
     _hessian(4, 2) = _tmp28;
     _hessian(5, 2) = -_tmp29 - _tmp30 - _tmp31;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
     _hessian(3, 3) = _tmp9;
     _hessian(4, 3) = _tmp13;
     _hessian(5, 3) = _tmp17;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
     _hessian(4, 4) = _tmp23;
     _hessian(5, 4) = _tmp27;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
     _hessian(5, 5) = _tmp32;
   }
 
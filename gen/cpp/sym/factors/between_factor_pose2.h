@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x6) jacobian of res wrt args a (3), b (3)
- *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3)
+ *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for args a (3), b (3)
  */
 template <typename Scalar>
@@ -76,9 +78,9 @@ void BetweenFactorPose2(const sym::Pose2<Scalar>& a, const sym::Pose2<Scalar>& b
       _tmp21 * sqrt_info(2, 0) + _tmp3 * sqrt_info(2, 2) + _tmp7 * sqrt_info(2, 1);
   const Scalar _tmp25 = -_tmp8 - _tmp9;
   const Scalar _tmp26 = Scalar(1.0) / (_tmp20);
-  const Scalar _tmp27 = std::pow(_tmp20, Scalar(2));
+  const Scalar _tmp27 = (_tmp20 * _tmp20);
   const Scalar _tmp28 = _tmp16 / _tmp27;
-  const Scalar _tmp29 = std::pow(_tmp16, Scalar(2)) + _tmp27;
+  const Scalar _tmp29 = (_tmp16 * _tmp16) + _tmp27;
   const Scalar _tmp30 = _tmp27 / _tmp29;
   const Scalar _tmp31 =
       _tmp30 * (_tmp26 * (_a_T_b[0] * _tmp25 - _tmp18) - _tmp28 * (_a_T_b[1] * _tmp25 + _tmp15));
@@ -121,8 +123,7 @@ void BetweenFactorPose2(const sym::Pose2<Scalar>& a, const sym::Pose2<Scalar>& b
   const Scalar _tmp64 = _tmp46 + _tmp47;
   const Scalar _tmp65 = _tmp49 + _tmp50;
   const Scalar _tmp66 = _tmp52 + _tmp53;
-  const Scalar _tmp67 =
-      std::pow(_tmp20, Scalar(4)) * std::pow(_tmp56, Scalar(2)) / std::pow(_tmp29, Scalar(2));
+  const Scalar _tmp67 = (_tmp20 * _tmp20 * _tmp20 * _tmp20) * (_tmp56 * _tmp56) / (_tmp29 * _tmp29);
 
   // Output terms (4)
   if (res != nullptr) {
@@ -159,49 +160,29 @@ void BetweenFactorPose2(const sym::Pose2<Scalar>& a, const sym::Pose2<Scalar>& b
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian(0, 0) =
-        std::pow(_tmp34, Scalar(2)) + std::pow(_tmp35, Scalar(2)) + std::pow(_tmp36, Scalar(2));
+    _hessian(0, 0) = (_tmp34 * _tmp34) + (_tmp35 * _tmp35) + (_tmp36 * _tmp36);
     _hessian(1, 0) = _tmp34 * _tmp39 + _tmp35 * _tmp42 + _tmp36 * _tmp45;
     _hessian(2, 0) = _tmp34 * _tmp48 + _tmp35 * _tmp51 + _tmp36 * _tmp54;
     _hessian(3, 0) = _tmp34 * _tmp58 + _tmp35 * _tmp59 + _tmp36 * _tmp60;
     _hessian(4, 0) = _tmp34 * _tmp61 + _tmp35 * _tmp62 + _tmp36 * _tmp63;
     _hessian(5, 0) = _tmp34 * _tmp64 + _tmp35 * _tmp65 + _tmp36 * _tmp66;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) =
-        std::pow(_tmp39, Scalar(2)) + std::pow(_tmp42, Scalar(2)) + std::pow(_tmp45, Scalar(2));
+    _hessian(1, 1) = (_tmp39 * _tmp39) + (_tmp42 * _tmp42) + (_tmp45 * _tmp45);
     _hessian(2, 1) = _tmp39 * _tmp48 + _tmp42 * _tmp51 + _tmp45 * _tmp54;
     _hessian(3, 1) = _tmp39 * _tmp58 + _tmp42 * _tmp59 + _tmp45 * _tmp60;
     _hessian(4, 1) = _tmp39 * _tmp61 + _tmp42 * _tmp62 + _tmp45 * _tmp63;
     _hessian(5, 1) = _tmp39 * _tmp64 + _tmp42 * _tmp65 + _tmp45 * _tmp66;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) =
-        std::pow(_tmp48, Scalar(2)) + std::pow(_tmp51, Scalar(2)) + std::pow(_tmp54, Scalar(2));
+    _hessian(2, 2) = (_tmp48 * _tmp48) + (_tmp51 * _tmp51) + (_tmp54 * _tmp54);
     _hessian(3, 2) = _tmp48 * _tmp58 + _tmp51 * _tmp59 + _tmp54 * _tmp60;
     _hessian(4, 2) = _tmp48 * _tmp61 + _tmp51 * _tmp62 + _tmp54 * _tmp63;
     _hessian(5, 2) = _tmp48 * _tmp64 + _tmp51 * _tmp65 + _tmp54 * _tmp66;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = _tmp67 * std::pow(sqrt_info(0, 0), Scalar(2)) +
-                     _tmp67 * std::pow(sqrt_info(1, 0), Scalar(2)) +
-                     _tmp67 * std::pow(sqrt_info(2, 0), Scalar(2));
+    _hessian(3, 3) = _tmp67 * (sqrt_info(0, 0) * sqrt_info(0, 0)) +
+                     _tmp67 * (sqrt_info(1, 0) * sqrt_info(1, 0)) +
+                     _tmp67 * (sqrt_info(2, 0) * sqrt_info(2, 0));
     _hessian(4, 3) = _tmp58 * _tmp61 + _tmp59 * _tmp62 + _tmp60 * _tmp63;
     _hessian(5, 3) = _tmp58 * _tmp64 + _tmp59 * _tmp65 + _tmp60 * _tmp66;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) =
-        std::pow(_tmp61, Scalar(2)) + std::pow(_tmp62, Scalar(2)) + std::pow(_tmp63, Scalar(2));
+    _hessian(4, 4) = (_tmp61 * _tmp61) + (_tmp62 * _tmp62) + (_tmp63 * _tmp63);
     _hessian(5, 4) = _tmp61 * _tmp64 + _tmp62 * _tmp65 + _tmp63 * _tmp66;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) =
-        std::pow(_tmp64, Scalar(2)) + std::pow(_tmp65, Scalar(2)) + std::pow(_tmp66, Scalar(2));
+    _hessian(5, 5) = (_tmp64 * _tmp64) + (_tmp65 * _tmp65) + (_tmp66 * _tmp66);
   }
 
   if (rhs != nullptr) {
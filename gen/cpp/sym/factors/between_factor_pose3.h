@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (6x12) jacobian of res wrt args a (6), b (6)
- *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6)
+ *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (12x1) Gauss-Newton rhs for args a (6), b (6)
  */
 template <typename Scalar>
@@ -46,10 +48,10 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   const Eigen::Matrix<Scalar, 7, 1>& _a_T_b = a_T_b.Data();
 
   // Intermediate terms (369)
-  const Scalar _tmp0 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp0 = (_a[0] * _a[0]);
   const Scalar _tmp1 = 2 * _tmp0;
   const Scalar _tmp2 = -_tmp1;
-  const Scalar _tmp3 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp3 = (_a[2] * _a[2]);
   const Scalar _tmp4 = 2 * _tmp3;
   const Scalar _tmp5 = 1 - _tmp4;
   const Scalar _tmp6 = _tmp2 + _tmp5;
@@ -66,7 +68,7 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   const Scalar _tmp17 = _a[4] * _tmp16;
   const Scalar _tmp18 = _b[4] * _tmp16 + _b[6] * _tmp11;
   const Scalar _tmp19 = -_a[5] * _tmp6 - _a_T_b[5] + _b[5] * _tmp6 - _tmp12 - _tmp17 + _tmp18;
-  const Scalar _tmp20 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp20 = (_a[1] * _a[1]);
   const Scalar _tmp21 = 2 * _tmp20;
   const Scalar _tmp22 = -_tmp21;
   const Scalar _tmp23 = _tmp22 + _tmp5;
@@ -111,7 +113,7 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   const Scalar _tmp60 = 2 * _tmp59;
   const Scalar _tmp61 = 1 - epsilon;
   const Scalar _tmp62 = std::min<Scalar>(_tmp61, std::fabs(_tmp57 - _tmp58));
-  const Scalar _tmp63 = std::acos(_tmp62) / std::sqrt(Scalar(1 - std::pow(_tmp62, Scalar(2))));
+  const Scalar _tmp63 = std::acos(_tmp62) / std::sqrt(Scalar(1 - (_tmp62 * _tmp62)));
   const Scalar _tmp64 = _tmp60 * _tmp63;
   const Scalar _tmp65 = _tmp53 * _tmp64;
   const Scalar _tmp66 =
@@ -179,7 +181,7 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   const Scalar _tmp114 = _tmp54 + _tmp55 + _tmp56 + _tmp58;
   const Scalar _tmp115 = std::fabs(_tmp114);
   const Scalar _tmp116 = std::min<Scalar>(_tmp115, _tmp61);
-  const Scalar _tmp117 = 1 - std::pow(_tmp116, Scalar(2));
+  const Scalar _tmp117 = 1 - (_tmp116 * _tmp116);
   const Scalar _tmp118 = _tmp59 * ((((-_tmp115 + _tmp61) > 0) - ((-_tmp115 + _tmp61) < 0)) + 1) *
                          (((_tmp114) > 0) - ((_tmp114) < 0));
   const Scalar _tmp119 = _tmp118 / _tmp117;
@@ -214,7 +216,7 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   const Scalar _tmp148 = _tmp128 * (_tmp143 - _tmp144 + _tmp147);
   const Scalar _tmp149 = _tmp148 * _tmp60;
   const Scalar _tmp150 = -_tmp20;
-  const Scalar _tmp151 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp151 = (_a[3] * _a[3]);
   const Scalar _tmp152 = _tmp150 + _tmp151;
   const Scalar _tmp153 = -_tmp0;
   const Scalar _tmp154 = _tmp153 + _tmp3;
@@ -687,9 +689,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp166, Scalar(2)) + std::pow(_tmp174, Scalar(2)) +
-                     std::pow(_tmp176, Scalar(2)) + std::pow(_tmp178, Scalar(2)) +
-                     std::pow(_tmp180, Scalar(2)) + std::pow(_tmp182, Scalar(2));
+    _hessian(0, 0) = (_tmp166 * _tmp166) + (_tmp174 * _tmp174) + (_tmp176 * _tmp176) +
+                     (_tmp178 * _tmp178) + (_tmp180 * _tmp180) + (_tmp182 * _tmp182);
     _hessian(1, 0) = _tmp166 * _tmp216 + _tmp174 * _tmp222 + _tmp176 * _tmp224 + _tmp178 * _tmp226 +
                      _tmp180 * _tmp227 + _tmp182 * _tmp229;
     _hessian(2, 0) = _tmp166 * _tmp251 + _tmp174 * _tmp256 + _tmp176 * _tmp257 + _tmp178 * _tmp258 +
@@ -712,10 +713,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp178 * _tmp360 + _tmp180 * _tmp361 + _tmp182 * _tmp362;
     _hessian(11, 0) = _tmp166 * _tmp363 + _tmp174 * _tmp364 + _tmp176 * _tmp365 +
                       _tmp178 * _tmp366 + _tmp180 * _tmp367 + _tmp182 * _tmp368;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp216, Scalar(2)) + std::pow(_tmp222, Scalar(2)) +
-                     std::pow(_tmp224, Scalar(2)) + std::pow(_tmp226, Scalar(2)) +
-                     std::pow(_tmp227, Scalar(2)) + std::pow(_tmp229, Scalar(2));
+    _hessian(1, 1) = (_tmp216 * _tmp216) + (_tmp222 * _tmp222) + (_tmp224 * _tmp224) +
+                     (_tmp226 * _tmp226) + (_tmp227 * _tmp227) + (_tmp229 * _tmp229);
     _hessian(2, 1) = _tmp216 * _tmp251 + _tmp222 * _tmp256 + _tmp224 * _tmp257 + _tmp226 * _tmp258 +
                      _tmp227 * _tmp259 + _tmp229 * _tmp260;
     _hessian(3, 1) = _tmp216 * _tmp263 + _tmp222 * _tmp264 + _tmp224 * _tmp265 + _tmp226 * _tmp266 +
@@ -736,11 +735,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp226 * _tmp360 + _tmp227 * _tmp361 + _tmp229 * _tmp362;
     _hessian(11, 1) = _tmp216 * _tmp363 + _tmp222 * _tmp364 + _tmp224 * _tmp365 +
                       _tmp226 * _tmp366 + _tmp227 * _tmp367 + _tmp229 * _tmp368;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp251, Scalar(2)) + std::pow(_tmp256, Scalar(2)) +
-                     std::pow(_tmp257, Scalar(2)) + std::pow(_tmp258, Scalar(2)) +
-                     std::pow(_tmp259, Scalar(2)) + std::pow(_tmp260, Scalar(2));
+    _hessian(2, 2) = (_tmp251 * _tmp251) + (_tmp256 * _tmp256) + (_tmp257 * _tmp257) +
+                     (_tmp258 * _tmp258) + (_tmp259 * _tmp259) + (_tmp260 * _tmp260);
     _hessian(3, 2) = _tmp251 * _tmp263 + _tmp256 * _tmp264 + _tmp257 * _tmp265 + _tmp258 * _tmp266 +
                      _tmp259 * _tmp267 + _tmp260 * _tmp268;
     _hessian(4, 2) = _tmp251 * _tmp270 + _tmp256 * _tmp271 + _tmp257 * _tmp272 + _tmp258 * _tmp273 +
@@ -759,12 +755,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp258 * _tmp360 + _tmp259 * _tmp361 + _tmp260 * _tmp362;
     _hessian(11, 2) = _tmp251 * _tmp363 + _tmp256 * _tmp364 + _tmp257 * _tmp365 +
                       _tmp258 * _tmp366 + _tmp259 * _tmp367 + _tmp260 * _tmp368;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp263, Scalar(2)) + std::pow(_tmp264, Scalar(2)) +
-                     std::pow(_tmp265, Scalar(2)) + std::pow(_tmp266, Scalar(2)) +
-                     std::pow(_tmp267, Scalar(2)) + std::pow(_tmp268, Scalar(2));
+    _hessian(3, 3) = (_tmp263 * _tmp263) + (_tmp264 * _tmp264) + (_tmp265 * _tmp265) +
+                     (_tmp266 * _tmp266) + (_tmp267 * _tmp267) + (_tmp268 * _tmp268);
     _hessian(4, 3) = _tmp263 * _tmp270 + _tmp264 * _tmp271 + _tmp265 * _tmp272 + _tmp266 * _tmp273 +
                      _tmp267 * _tmp274 + _tmp268 * _tmp275;
     _hessian(5, 3) = _tmp263 * _tmp277 + _tmp264 * _tmp278 + _tmp265 * _tmp279 + _tmp266 * _tmp280 +
@@ -781,13 +773,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp266 * _tmp360 + _tmp267 * _tmp361 + _tmp268 * _tmp362;
     _hessian(11, 3) = _tmp263 * _tmp363 + _tmp264 * _tmp364 + _tmp265 * _tmp365 +
                       _tmp266 * _tmp366 + _tmp267 * _tmp367 + _tmp268 * _tmp368;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp270, Scalar(2)) + std::pow(_tmp271, Scalar(2)) +
-                     std::pow(_tmp272, Scalar(2)) + std::pow(_tmp273, Scalar(2)) +
-                     std::pow(_tmp274, Scalar(2)) + std::pow(_tmp275, Scalar(2));
+    _hessian(4, 4) = (_tmp270 * _tmp270) + (_tmp271 * _tmp271) + (_tmp272 * _tmp272) +
+                     (_tmp273 * _tmp273) + (_tmp274 * _tmp274) + (_tmp275 * _tmp275);
     _hessian(5, 4) = _tmp270 * _tmp277 + _tmp271 * _tmp278 + _tmp272 * _tmp279 + _tmp273 * _tmp280 +
                      _tmp274 * _tmp281 + _tmp275 * _tmp282;
     _hessian(6, 4) = _tmp270 * _tmp299 + _tmp271 * _tmp305 + _tmp272 * _tmp306 + _tmp273 * _tmp307 +
@@ -802,14 +789,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp273 * _tmp360 + _tmp274 * _tmp361 + _tmp275 * _tmp362;
     _hessian(11, 4) = _tmp270 * _tmp363 + _tmp271 * _tmp364 + _tmp272 * _tmp365 +
                       _tmp273 * _tmp366 + _tmp274 * _tmp367 + _tmp275 * _tmp368;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp277, Scalar(2)) + std::pow(_tmp278, Scalar(2)) +
-                     std::pow(_tmp279, Scalar(2)) + std::pow(_tmp280, Scalar(2)) +
-                     std::pow(_tmp281, Scalar(2)) + std::pow(_tmp282, Scalar(2));
+    _hessian(5, 5) = (_tmp277 * _tmp277) + (_tmp278 * _tmp278) + (_tmp279 * _tmp279) +
+                     (_tmp280 * _tmp280) + (_tmp281 * _tmp281) + (_tmp282 * _tmp282);
     _hessian(6, 5) = _tmp277 * _tmp299 + _tmp278 * _tmp305 + _tmp279 * _tmp306 + _tmp280 * _tmp307 +
                      _tmp281 * _tmp308 + _tmp282 * _tmp309;
     _hessian(7, 5) = _tmp277 * _tmp319 + _tmp278 * _tmp325 + _tmp279 * _tmp327 + _tmp280 * _tmp328 +
@@ -822,15 +803,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp280 * _tmp360 + _tmp281 * _tmp361 + _tmp282 * _tmp362;
     _hessian(11, 5) = _tmp277 * _tmp363 + _tmp278 * _tmp364 + _tmp279 * _tmp365 +
                       _tmp280 * _tmp366 + _tmp281 * _tmp367 + _tmp282 * _tmp368;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp299, Scalar(2)) + std::pow(_tmp305, Scalar(2)) +
-                     std::pow(_tmp306, Scalar(2)) + std::pow(_tmp307, Scalar(2)) +
-                     std::pow(_tmp308, Scalar(2)) + std::pow(_tmp309, Scalar(2));
+    _hessian(6, 6) = (_tmp299 * _tmp299) + (_tmp305 * _tmp305) + (_tmp306 * _tmp306) +
+                     (_tmp307 * _tmp307) + (_tmp308 * _tmp308) + (_tmp309 * _tmp309);
     _hessian(7, 6) = _tmp299 * _tmp319 + _tmp305 * _tmp325 + _tmp306 * _tmp327 + _tmp307 * _tmp328 +
                      _tmp308 * _tmp329 + _tmp309 * _tmp330;
     _hessian(8, 6) = _tmp299 * _tmp340 + _tmp305 * _tmp346 + _tmp306 * _tmp347 + _tmp307 * _tmp348 +
@@ -841,16 +815,8 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp307 * _tmp360 + _tmp308 * _tmp361 + _tmp309 * _tmp362;
     _hessian(11, 6) = _tmp299 * _tmp363 + _tmp305 * _tmp364 + _tmp306 * _tmp365 +
                       _tmp307 * _tmp366 + _tmp308 * _tmp367 + _tmp309 * _tmp368;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp319, Scalar(2)) + std::pow(_tmp325, Scalar(2)) +
-                     std::pow(_tmp327, Scalar(2)) + std::pow(_tmp328, Scalar(2)) +
-                     std::pow(_tmp329, Scalar(2)) + std::pow(_tmp330, Scalar(2));
+    _hessian(7, 7) = (_tmp319 * _tmp319) + (_tmp325 * _tmp325) + (_tmp327 * _tmp327) +
+                     (_tmp328 * _tmp328) + (_tmp329 * _tmp329) + (_tmp330 * _tmp330);
     _hessian(8, 7) = _tmp319 * _tmp340 + _tmp325 * _tmp346 + _tmp327 * _tmp347 + _tmp328 * _tmp348 +
                      _tmp329 * _tmp349 + _tmp330 * _tmp350;
     _hessian(9, 7) = _tmp319 * _tmp351 + _tmp325 * _tmp352 + _tmp327 * _tmp353 + _tmp328 * _tmp354 +
@@ -859,68 +825,26 @@ void BetweenFactorPose3(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b
                       _tmp328 * _tmp360 + _tmp329 * _tmp361 + _tmp330 * _tmp362;
     _hessian(11, 7) = _tmp319 * _tmp363 + _tmp325 * _tmp364 + _tmp327 * _tmp365 +
                       _tmp328 * _tmp366 + _tmp329 * _tmp367 + _tmp330 * _tmp368;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp340, Scalar(2)) + std::pow(_tmp346, Scalar(2)) +
-                     std::pow(_tmp347, Scalar(2)) + std::pow(_tmp348, Scalar(2)) +
-                     std::pow(_tmp349, Scalar(2)) + std::pow(_tmp350, Scalar(2));
+    _hessian(8, 8) = (_tmp340 * _tmp340) + (_tmp346 * _tmp346) + (_tmp347 * _tmp347) +
+                     (_tmp348 * _tmp348) + (_tmp349 * _tmp349) + (_tmp350 * _tmp350);
     _hessian(9, 8) = _tmp340 * _tmp351 + _tmp346 * _tmp352 + _tmp347 * _tmp353 + _tmp348 * _tmp354 +
                      _tmp349 * _tmp355 + _tmp350 * _tmp356;
     _hessian(10, 8) = _tmp340 * _tmp357 + _tmp346 * _tmp358 + _tmp347 * _tmp359 +
                       _tmp348 * _tmp360 + _tmp349 * _tmp361 + _tmp350 * _tmp362;
     _hessian(11, 8) = _tmp340 * _tmp363 + _tmp346 * _tmp364 + _tmp347 * _tmp365 +
                       _tmp348 * _tmp366 + _tmp349 * _tmp367 + _tmp350 * _tmp368;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp351, Scalar(2)) + std::pow(_tmp352, Scalar(2)) +
-                     std::pow(_tmp353, Scalar(2)) + std::pow(_tmp354, Scalar(2)) +
-                     std::pow(_tmp355, Scalar(2)) + std::pow(_tmp356, Scalar(2));
+    _hessian(9, 9) = (_tmp351 * _tmp351) + (_tmp352 * _tmp352) + (_tmp353 * _tmp353) +
+                     (_tmp354 * _tmp354) + (_tmp355 * _tmp355) + (_tmp356 * _tmp356);
     _hessian(10, 9) = _tmp351 * _tmp357 + _tmp352 * _tmp358 + _tmp353 * _tmp359 +
                       _tmp354 * _tmp360 + _tmp355 * _tmp361 + _tmp356 * _tmp362;
     _hessian(11, 9) = _tmp351 * _tmp363 + _tmp352 * _tmp364 + _tmp353 * _tmp365 +
                       _tmp354 * _tmp366 + _tmp355 * _tmp367 + _tmp356 * _tmp368;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp357, Scalar(2)) + std::pow(_tmp358, Scalar(2)) +
-                       std::pow(_tmp359, Scalar(2)) + std::pow(_tmp360, Scalar(2)) +
-                       std::pow(_tmp361, Scalar(2)) + std::pow(_tmp362, Scalar(2));
+    _hessian(10, 10) = (_tmp357 * _tmp357) + (_tmp358 * _tmp358) + (_tmp359 * _tmp359) +
+                       (_tmp360 * _tmp360) + (_tmp361 * _tmp361) + (_tmp362 * _tmp362);
     _hessian(11, 10) = _tmp357 * _tmp363 + _tmp358 * _tmp364 + _tmp359 * _tmp365 +
                        _tmp360 * _tmp366 + _tmp361 * _tmp367 + _tmp362 * _tmp368;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp363, Scalar(2)) + std::pow(_tmp364, Scalar(2)) +
-                       std::pow(_tmp365, Scalar(2)) + std::pow(_tmp366, Scalar(2)) +
-                       std::pow(_tmp367, Scalar(2)) + std::pow(_tmp368, Scalar(2));
+    _hessian(11, 11) = (_tmp363 * _tmp363) + (_tmp364 * _tmp364) + (_tmp365 * _tmp365) +
+                       (_tmp366 * _tmp366) + (_tmp367 * _tmp367) + (_tmp368 * _tmp368);
   }
 
   if (rhs != nullptr) {
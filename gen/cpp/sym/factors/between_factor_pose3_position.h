@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x12) jacobian of res wrt args a (6), b (6)
- *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6)
+ *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (12x1) Gauss-Newton rhs for args a (6), b (6)
  */
 template <typename Scalar>
@@ -48,10 +50,10 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   const Eigen::Matrix<Scalar, 7, 1>& _b = b.Data();
 
   // Intermediate terms (105)
-  const Scalar _tmp0 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp0 = (_a[2] * _a[2]);
   const Scalar _tmp1 = 2 * _tmp0;
   const Scalar _tmp2 = -_tmp1;
-  const Scalar _tmp3 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp3 = (_a[1] * _a[1]);
   const Scalar _tmp4 = 2 * _tmp3;
   const Scalar _tmp5 = -_tmp4;
   const Scalar _tmp6 = _tmp2 + _tmp5 + 1;
@@ -68,7 +70,7 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   const Scalar _tmp17 = _a[5] * _tmp16;
   const Scalar _tmp18 = _b[5] * _tmp16 + _b[6] * _tmp12;
   const Scalar _tmp19 = -_a[4] * _tmp6 + _b[4] * _tmp6 - _tmp13 - _tmp17 + _tmp18 - a_t_b(0, 0);
-  const Scalar _tmp20 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp20 = (_a[0] * _a[0]);
   const Scalar _tmp21 = 2 * _tmp20;
   const Scalar _tmp22 = 1 - _tmp21;
   const Scalar _tmp23 = _tmp2 + _tmp22;
@@ -96,7 +98,7 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   const Scalar _tmp43 =
       _tmp19 * sqrt_info(2, 0) + _tmp32 * sqrt_info(2, 1) + _tmp40 * sqrt_info(2, 2);
   const Scalar _tmp44 = -_tmp20;
-  const Scalar _tmp45 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp45 = (_a[3] * _a[3]);
   const Scalar _tmp46 = _tmp44 + _tmp45;
   const Scalar _tmp47 = -_tmp3;
   const Scalar _tmp48 = _tmp0 + _tmp47;
@@ -231,10 +233,9 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
 
-    _hessian.setZero();
+    _hessian.template triangularView<Eigen::Lower>().setZero();
 
-    _hessian(0, 0) =
-        std::pow(_tmp59, Scalar(2)) + std::pow(_tmp60, Scalar(2)) + std::pow(_tmp61, Scalar(2));
+    _hessian(0, 0) = (_tmp59 * _tmp59) + (_tmp60 * _tmp60) + (_tmp61 * _tmp61);
     _hessian(1, 0) = _tmp59 * _tmp71 + _tmp60 * _tmp72 + _tmp61 * _tmp73;
     _hessian(2, 0) = _tmp59 * _tmp80 + _tmp60 * _tmp81 + _tmp61 * _tmp82;
     _hessian(3, 0) = _tmp59 * _tmp84 + _tmp60 * _tmp85 + _tmp61 * _tmp86;
@@ -243,8 +244,7 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
     _hessian(9, 0) = _tmp59 * _tmp96 + _tmp60 * _tmp97 + _tmp61 * _tmp98;
     _hessian(10, 0) = _tmp100 * _tmp60 + _tmp101 * _tmp61 + _tmp59 * _tmp99;
     _hessian(11, 0) = _tmp102 * _tmp59 + _tmp103 * _tmp60 + _tmp104 * _tmp61;
-    _hessian(1, 1) =
-        std::pow(_tmp71, Scalar(2)) + std::pow(_tmp72, Scalar(2)) + std::pow(_tmp73, Scalar(2));
+    _hessian(1, 1) = (_tmp71 * _tmp71) + (_tmp72 * _tmp72) + (_tmp73 * _tmp73);
     _hessian(2, 1) = _tmp71 * _tmp80 + _tmp72 * _tmp81 + _tmp73 * _tmp82;
     _hessian(3, 1) = _tmp71 * _tmp84 + _tmp72 * _tmp85 + _tmp73 * _tmp86;
     _hessian(4, 1) = _tmp71 * _tmp89 + _tmp72 * _tmp90 + _tmp73 * _tmp91;
@@ -252,41 +252,34 @@ void BetweenFactorPose3Position(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
     _hessian(9, 1) = _tmp71 * _tmp96 + _tmp72 * _tmp97 + _tmp73 * _tmp98;
     _hessian(10, 1) = _tmp100 * _tmp72 + _tmp101 * _tmp73 + _tmp71 * _tmp99;
     _hessian(11, 1) = _tmp102 * _tmp71 + _tmp103 * _tmp72 + _tmp104 * _tmp73;
-    _hessian(2, 2) =
-        std::pow(_tmp80, Scalar(2)) + std::pow(_tmp81, Scalar(2)) + std::pow(_tmp82, Scalar(2));
+    _hessian(2, 2) = (_tmp80 * _tmp80) + (_tmp81 * _tmp81) + (_tmp82 * _tmp82);
     _hessian(3, 2) = _tmp80 * _tmp84 + _tmp81 * _tmp85 + _tmp82 * _tmp86;
     _hessian(4, 2) = _tmp80 * _tmp89 + _tmp81 * _tmp90 + _tmp82 * _tmp91;
     _hessian(5, 2) = _tmp80 * _tmp93 + _tmp81 * _tmp94 + _tmp82 * _tmp95;
     _hessian(9, 2) = _tmp80 * _tmp96 + _tmp81 * _tmp97 + _tmp82 * _tmp98;
     _hessian(10, 2) = _tmp100 * _tmp81 + _tmp101 * _tmp82 + _tmp80 * _tmp99;
     _hessian(11, 2) = _tmp102 * _tmp80 + _tmp103 * _tmp81 + _tmp104 * _tmp82;
-    _hessian(3, 3) =
-        std::pow(_tmp84, Scalar(2)) + std::pow(_tmp85, Scalar(2)) + std::pow(_tmp86, Scalar(2));
+    _hessian(3, 3) = (_tmp84 * _tmp84) + (_tmp85 * _tmp85) + (_tmp86 * _tmp86);
     _hessian(4, 3) = _tmp84 * _tmp89 + _tmp85 * _tmp90 + _tmp86 * _tmp91;
     _hessian(5, 3) = _tmp84 * _tmp93 + _tmp85 * _tmp94 + _tmp86 * _tmp95;
     _hessian(9, 3) = _tmp84 * _tmp96 + _tmp85 * _tmp97 + _tmp86 * _tmp98;
     _hessian(10, 3) = _tmp100 * _tmp85 + _tmp101 * _tmp86 + _tmp84 * _tmp99;
     _hessian(11, 3) = _tmp102 * _tmp84 + _tmp103 * _tmp85 + _tmp104 * _tmp86;
-    _hessian(4, 4) =
-        std::pow(_tmp89, Scalar(2)) + std::pow(_tmp90, Scalar(2)) + std::pow(_tmp91, Scalar(2));
+    _hessian(4, 4) = (_tmp89 * _tmp89) + (_tmp90 * _tmp90) + (_tmp91 * _tmp91);
     _hessian(5, 4) = _tmp89 * _tmp93 + _tmp90 * _tmp94 + _tmp91 * _tmp95;
     _hessian(9, 4) = _tmp89 * _tmp96 + _tmp90 * _tmp97 + _tmp91 * _tmp98;
     _hessian(10, 4) = _tmp100 * _tmp90 + _tmp101 * _tmp91 + _tmp89 * _tmp99;
     _hessian(11, 4) = _tmp102 * _tmp89 + _tmp103 * _tmp90 + _tmp104 * _tmp91;
-    _hessian(5, 5) =
-        std::pow(_tmp93, Scalar(2)) + std::pow(_tmp94, Scalar(2)) + std::pow(_tmp95, Scalar(2));
+    _hessian(5, 5) = (_tmp93 * _tmp93) + (_tmp94 * _tmp94) + (_tmp95 * _tmp95);
     _hessian(9, 5) = _tmp93 * _tmp96 + _tmp94 * _tmp97 + _tmp95 * _tmp98;
     _hessian(10, 5) = _tmp100 * _tmp94 + _tmp101 * _tmp95 + _tmp93 * _tmp99;
     _hessian(11, 5) = _tmp102 * _tmp93 + _tmp103 * _tmp94 + _tmp104 * _tmp95;
-    _hessian(9, 9) =
-        std::pow(_tmp96, Scalar(2)) + std::pow(_tmp97, Scalar(2)) + std::pow(_tmp98, Scalar(2));
+    _hessian(9, 9) = (_tmp96 * _tmp96) + (_tmp97 * _tmp97) + (_tmp98 * _tmp98);
     _hessian(10, 9) = _tmp100 * _tmp97 + _tmp101 * _tmp98 + _tmp96 * _tmp99;
     _hessian(11, 9) = _tmp102 * _tmp96 + _tmp103 * _tmp97 + _tmp104 * _tmp98;
-    _hessian(10, 10) =
-        std::pow(_tmp100, Scalar(2)) + std::pow(_tmp101, Scalar(2)) + std::pow(_tmp99, Scalar(2));
+    _hessian(10, 10) = (_tmp100 * _tmp100) + (_tmp101 * _tmp101) + (_tmp99 * _tmp99);
     _hessian(11, 10) = _tmp100 * _tmp103 + _tmp101 * _tmp104 + _tmp102 * _tmp99;
-    _hessian(11, 11) =
-        std::pow(_tmp102, Scalar(2)) + std::pow(_tmp103, Scalar(2)) + std::pow(_tmp104, Scalar(2));
+    _hessian(11, 11) = (_tmp102 * _tmp102) + (_tmp103 * _tmp103) + (_tmp104 * _tmp104);
   }
 
   if (rhs != nullptr) {
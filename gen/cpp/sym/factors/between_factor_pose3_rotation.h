@@ -28,7 +28,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x12) jacobian of res wrt args a (6), b (6)
- *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6)
+ *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (12x1) Gauss-Newton rhs for args a (6), b (6)
  */
 template <typename Scalar>
@@ -76,8 +78,7 @@ void BetweenFactorPose3Rotation(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   const Scalar _tmp25 = -_tmp22 - _tmp23 - _tmp24;
   const Scalar _tmp26 = _a_R_b[3] * _tmp4;
   const Scalar _tmp27 = std::min<Scalar>(_tmp21, std::fabs(_tmp25 - _tmp26));
-  const Scalar _tmp28 =
-      std::pow(Scalar(1 - std::pow(_tmp27, Scalar(2))), Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp28 = Scalar(1.0) / std::sqrt(Scalar(1 - (_tmp27 * _tmp27)));
   const Scalar _tmp29 = std::acos(_tmp27);
   const Scalar _tmp30 =
       2 * std::min<Scalar>(0, (((-_tmp25 + _tmp26) > 0) - ((-_tmp25 + _tmp26) < 0))) + 1;
@@ -124,7 +125,7 @@ void BetweenFactorPose3Rotation(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   const Scalar _tmp68 = _tmp22 + _tmp23 + _tmp24 + _tmp26;
   const Scalar _tmp69 = std::fabs(_tmp68);
   const Scalar _tmp70 = std::min<Scalar>(_tmp21, _tmp69);
-  const Scalar _tmp71 = 1 - std::pow(_tmp70, Scalar(2));
+  const Scalar _tmp71 = 1 - (_tmp70 * _tmp70);
   const Scalar _tmp72 = std::acos(_tmp70);
   const Scalar _tmp73 = _tmp72 / std::sqrt(_tmp71);
   const Scalar _tmp74 = _tmp31 * _tmp73;
@@ -355,35 +356,29 @@ void BetweenFactorPose3Rotation(const sym::Pose3<Scalar>& a, const sym::Pose3<Sc
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
 
-    _hessian.setZero();
+    _hessian.template triangularView<Eigen::Lower>().setZero();
 
-    _hessian(0, 0) =
-        std::pow(_tmp107, Scalar(2)) + std::pow(_tmp114, Scalar(2)) + std::pow(_tmp120, Scalar(2));
+    _hessian(0, 0) = (_tmp107 * _tmp107) + (_tmp114 * _tmp114) + (_tmp120 * _tmp120);
     _hessian(1, 0) = _tmp107 * _tmp146 + _tmp114 * _tmp149 + _tmp120 * _tmp151;
     _hessian(2, 0) = _tmp107 * _tmp167 + _tmp114 * _tmp168 + _tmp120 * _tmp169;
     _hessian(6, 0) = _tmp107 * _tmp186 + _tmp114 * _tmp187 + _tmp120 * _tmp188;
     _hessian(7, 0) = _tmp107 * _tmp196 + _tmp114 * _tmp197 + _tmp120 * _tmp198;
     _hessian(8, 0) = _tmp107 * _tmp206 + _tmp114 * _tmp207 + _tmp120 * _tmp208;
-    _hessian(1, 1) =
-        std::pow(_tmp146, Scalar(2)) + std::pow(_tmp149, Scalar(2)) + std::pow(_tmp151, Scalar(2));
+    _hessian(1, 1) = (_tmp146 * _tmp146) + (_tmp149 * _tmp149) + (_tmp151 * _tmp151);
     _hessian(2, 1) = _tmp146 * _tmp167 + _tmp149 * _tmp168 + _tmp151 * _tmp169;
     _hessian(6, 1) = _tmp146 * _tmp186 + _tmp149 * _tmp187 + _tmp151 * _tmp188;
     _hessian(7, 1) = _tmp146 * _tmp196 + _tmp149 * _tmp197 + _tmp151 * _tmp198;
     _hessian(8, 1) = _tmp146 * _tmp206 + _tmp149 * _tmp207 + _tmp151 * _tmp208;
-    _hessian(2, 2) =
-        std::pow(_tmp167, Scalar(2)) + std::pow(_tmp168, Scalar(2)) + std::pow(_tmp169, Scalar(2));
+    _hessian(2, 2) = (_tmp167 * _tmp167) + (_tmp168 * _tmp168) + (_tmp169 * _tmp169);
     _hessian(6, 2) = _tmp167 * _tmp186 + _tmp168 * _tmp187 + _tmp169 * _tmp188;
     _hessian(7, 2) = _tmp167 * _tmp196 + _tmp168 * _tmp197 + _tmp169 * _tmp198;
     _hessian(8, 2) = _tmp167 * _tmp206 + _tmp168 * _tmp207 + _tmp169 * _tmp208;
-    _hessian(6, 6) =
-        std::pow(_tmp186, Scalar(2)) + std::pow(_tmp187, Scalar(2)) + std::pow(_tmp188, Scalar(2));
+    _hessian(6, 6) = (_tmp186 * _tmp186) + (_tmp187 * _tmp187) + (_tmp188 * _tmp188);
     _hessian(7, 6) = _tmp186 * _tmp196 + _tmp187 * _tmp197 + _tmp188 * _tmp198;
     _hessian(8, 6) = _tmp186 * _tmp206 + _tmp187 * _tmp207 + _tmp188 * _tmp208;
-    _hessian(7, 7) =
-        std::pow(_tmp196, Scalar(2)) + std::pow(_tmp197, Scalar(2)) + std::pow(_tmp198, Scalar(2));
+    _hessian(7, 7) = (_tmp196 * _tmp196) + (_tmp197 * _tmp197) + (_tmp198 * _tmp198);
     _hessian(8, 7) = _tmp196 * _tmp206 + _tmp197 * _tmp207 + _tmp198 * _tmp208;
-    _hessian(8, 8) =
-        std::pow(_tmp206, Scalar(2)) + std::pow(_tmp207, Scalar(2)) + std::pow(_tmp208, Scalar(2));
+    _hessian(8, 8) = (_tmp206 * _tmp206) + (_tmp207 * _tmp207) + (_tmp208 * _tmp208);
   }
 
   if (rhs != nullptr) {
@@ -19,7 +19,9 @@ namespace sym {
  *     sqrt_info: Square root information matrix to whiten residual. In this one dimensional case
  *             this is just 1/sigma.
  *     jacobian: (1x12) jacobian of res wrt args a (6), b (6)
- *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6)
+ *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (12x1) Gauss-Newton rhs for args a (6), b (6)
  */
 template <typename Scalar>
@@ -39,11 +41,11 @@ void BetweenFactorPose3TranslationNorm(const sym::Pose3<Scalar>& a, const sym::P
 
   // Intermediate terms (30)
   const Scalar _tmp0 = _a[4] - _b[4];
-  const Scalar _tmp1 = std::pow(_tmp0, Scalar(2));
+  const Scalar _tmp1 = (_tmp0 * _tmp0);
   const Scalar _tmp2 = _a[5] - _b[5];
-  const Scalar _tmp3 = std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = (_tmp2 * _tmp2);
   const Scalar _tmp4 = _a[6] - _b[6];
-  const Scalar _tmp5 = std::pow(_tmp4, Scalar(2));
+  const Scalar _tmp5 = (_tmp4 * _tmp4);
   const Scalar _tmp6 = _tmp1 + _tmp3 + _tmp5 + epsilon;
   const Scalar _tmp7 = std::sqrt(_tmp6);
   const Scalar _tmp8 = -_tmp7 + translation_norm;
@@ -52,7 +54,7 @@ void BetweenFactorPose3TranslationNorm(const sym::Pose3<Scalar>& a, const sym::P
   const Scalar _tmp11 = _tmp0 * _tmp10;
   const Scalar _tmp12 = _tmp10 * _tmp2;
   const Scalar _tmp13 = _tmp10 * _tmp4;
-  const Scalar _tmp14 = std::pow(sqrt_info(0, 0), Scalar(2));
+  const Scalar _tmp14 = (sqrt_info(0, 0) * sqrt_info(0, 0));
   const Scalar _tmp15 = _tmp14 / _tmp6;
   const Scalar _tmp16 = _tmp1 * _tmp15;
   const Scalar _tmp17 = _tmp0 * _tmp15;
@@ -96,7 +98,7 @@ void BetweenFactorPose3TranslationNorm(const sym::Pose3<Scalar>& a, const sym::P
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
 
-    _hessian.setZero();
+    _hessian.template triangularView<Eigen::Lower>().setZero();
 
     _hessian(3, 3) = _tmp16;
     _hessian(4, 3) = _tmp18;
@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (1x2) jacobian of res wrt args a (1), b (1)
- *     hessian: (2x2) Gauss-Newton hessian for args a (1), b (1)
+ *     hessian: (2x2) Gauss-Newton hessian for args a (1), b (1). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (2x1) Gauss-Newton rhs for args a (1), b (1)
  */
 template <typename Scalar>
@@ -61,18 +63,18 @@ void BetweenFactorRot2(const sym::Rot2<Scalar>& a, const sym::Rot2<Scalar>& b,
   const Scalar _tmp13 = std::atan2(_tmp8, _tmp12);
   const Scalar _tmp14 = -_tmp0 - _tmp1;
   const Scalar _tmp15 = Scalar(1.0) / (_tmp12);
-  const Scalar _tmp16 = std::pow(_tmp12, Scalar(2));
+  const Scalar _tmp16 = (_tmp12 * _tmp12);
   const Scalar _tmp17 = _tmp8 / _tmp16;
   const Scalar _tmp18 =
       _tmp15 * (_a_T_b[0] * _tmp14 - _tmp10) - _tmp17 * (_a_T_b[1] * _tmp14 + _tmp7);
-  const Scalar _tmp19 = _tmp16 + std::pow(_tmp8, Scalar(2));
+  const Scalar _tmp19 = _tmp16 + (_tmp8 * _tmp8);
   const Scalar _tmp20 = _tmp16 / _tmp19;
   const Scalar _tmp21 = _tmp20 * sqrt_info(0, 0);
   const Scalar _tmp22 = -_tmp4 + _tmp5;
   const Scalar _tmp23 =
       _tmp15 * (-_a_T_b[1] * _tmp22 + _tmp9) - _tmp17 * (_a_T_b[0] * _tmp22 + _tmp3);
-  const Scalar _tmp24 = std::pow(sqrt_info(0, 0), Scalar(2));
-  const Scalar _tmp25 = std::pow(_tmp12, Scalar(4)) * _tmp24 / std::pow(_tmp19, Scalar(2));
+  const Scalar _tmp24 = (sqrt_info(0, 0) * sqrt_info(0, 0));
+  const Scalar _tmp25 = (_tmp12 * _tmp12 * _tmp12 * _tmp12) * _tmp24 / (_tmp19 * _tmp19);
   const Scalar _tmp26 = _tmp13 * _tmp20 * _tmp24;
 
   // Output terms (4)
@@ -92,10 +94,9 @@ void BetweenFactorRot2(const sym::Rot2<Scalar>& a, const sym::Rot2<Scalar>& b,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 2, 2>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp18, Scalar(2)) * _tmp25;
+    _hessian(0, 0) = (_tmp18 * _tmp18) * _tmp25;
     _hessian(1, 0) = _tmp18 * _tmp23 * _tmp25;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp23, Scalar(2)) * _tmp25;
+    _hessian(1, 1) = (_tmp23 * _tmp23) * _tmp25;
   }
 
   if (rhs != nullptr) {
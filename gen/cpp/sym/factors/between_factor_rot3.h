@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x6) jacobian of res wrt args a (3), b (3)
- *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3)
+ *     hessian: (6x6) Gauss-Newton hessian for args a (3), b (3). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for args a (3), b (3)
  */
 template <typename Scalar>
@@ -77,7 +79,7 @@ void BetweenFactorRot3(const sym::Rot3<Scalar>& a, const sym::Rot3<Scalar>& b,
       -_a_T_b[0] * _tmp10 + _a_T_b[1] * _tmp16 - _a_T_b[2] * _tmp4 + _a_T_b[3] * _tmp22;
   const Scalar _tmp29 = 1 - epsilon;
   const Scalar _tmp30 = std::min<Scalar>(_tmp29, std::fabs(_tmp24));
-  const Scalar _tmp31 = std::acos(_tmp30) / std::sqrt(Scalar(1 - std::pow(_tmp30, Scalar(2))));
+  const Scalar _tmp31 = std::acos(_tmp30) / std::sqrt(Scalar(1 - (_tmp30 * _tmp30)));
   const Scalar _tmp32 = _tmp28 * _tmp31;
   const Scalar _tmp33 =
       _a_T_b[0] * _tmp22 - _a_T_b[1] * _tmp4 - _a_T_b[2] * _tmp16 + _a_T_b[3] * _tmp10;
@@ -119,7 +121,7 @@ void BetweenFactorRot3(const sym::Rot3<Scalar>& a, const sym::Rot3<Scalar>& b,
   const Scalar _tmp68 = _tmp11 + _tmp17 + _tmp23 + _tmp5;
   const Scalar _tmp69 = std::fabs(_tmp68);
   const Scalar _tmp70 = std::min<Scalar>(_tmp29, _tmp69);
-  const Scalar _tmp71 = 1 - std::pow(_tmp70, Scalar(2));
+  const Scalar _tmp71 = 1 - (_tmp70 * _tmp70);
   const Scalar _tmp72 = std::acos(_tmp70);
   const Scalar _tmp73 = _tmp72 / std::sqrt(_tmp71);
   const Scalar _tmp74 = _tmp26 * _tmp73;
@@ -344,48 +346,27 @@ void BetweenFactorRot3(const sym::Rot3<Scalar>& a, const sym::Rot3<Scalar>& b,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian(0, 0) =
-        std::pow(_tmp108, Scalar(2)) + std::pow(_tmp114, Scalar(2)) + std::pow(_tmp118, Scalar(2));
+    _hessian(0, 0) = (_tmp108 * _tmp108) + (_tmp114 * _tmp114) + (_tmp118 * _tmp118);
     _hessian(1, 0) = _tmp108 * _tmp143 + _tmp114 * _tmp144 + _tmp118 * _tmp145;
     _hessian(2, 0) = _tmp108 * _tmp164 + _tmp114 * _tmp165 + _tmp118 * _tmp166;
     _hessian(3, 0) = _tmp108 * _tmp185 + _tmp114 * _tmp186 + _tmp118 * _tmp187;
     _hessian(4, 0) = _tmp108 * _tmp201 + _tmp114 * _tmp202 + _tmp118 * _tmp203;
     _hessian(5, 0) = _tmp108 * _tmp213 + _tmp114 * _tmp214 + _tmp118 * _tmp215;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) =
-        std::pow(_tmp143, Scalar(2)) + std::pow(_tmp144, Scalar(2)) + std::pow(_tmp145, Scalar(2));
+    _hessian(1, 1) = (_tmp143 * _tmp143) + (_tmp144 * _tmp144) + (_tmp145 * _tmp145);
     _hessian(2, 1) = _tmp143 * _tmp164 + _tmp144 * _tmp165 + _tmp145 * _tmp166;
     _hessian(3, 1) = _tmp143 * _tmp185 + _tmp144 * _tmp186 + _tmp145 * _tmp187;
     _hessian(4, 1) = _tmp143 * _tmp201 + _tmp144 * _tmp202 + _tmp145 * _tmp203;
     _hessian(5, 1) = _tmp143 * _tmp213 + _tmp144 * _tmp214 + _tmp145 * _tmp215;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) =
-        std::pow(_tmp164, Scalar(2)) + std::pow(_tmp165, Scalar(2)) + std::pow(_tmp166, Scalar(2));
+    _hessian(2, 2) = (_tmp164 * _tmp164) + (_tmp165 * _tmp165) + (_tmp166 * _tmp166);
     _hessian(3, 2) = _tmp164 * _tmp185 + _tmp165 * _tmp186 + _tmp166 * _tmp187;
     _hessian(4, 2) = _tmp164 * _tmp201 + _tmp165 * _tmp202 + _tmp166 * _tmp203;
     _hessian(5, 2) = _tmp164 * _tmp213 + _tmp165 * _tmp214 + _tmp166 * _tmp215;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) =
-        std::pow(_tmp185, Scalar(2)) + std::pow(_tmp186, Scalar(2)) + std::pow(_tmp187, Scalar(2));
+    _hessian(3, 3) = (_tmp185 * _tmp185) + (_tmp186 * _tmp186) + (_tmp187 * _tmp187);
     _hessian(4, 3) = _tmp185 * _tmp201 + _tmp186 * _tmp202 + _tmp187 * _tmp203;
     _hessian(5, 3) = _tmp185 * _tmp213 + _tmp186 * _tmp214 + _tmp187 * _tmp215;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) =
-        std::pow(_tmp201, Scalar(2)) + std::pow(_tmp202, Scalar(2)) + std::pow(_tmp203, Scalar(2));
+    _hessian(4, 4) = (_tmp201 * _tmp201) + (_tmp202 * _tmp202) + (_tmp203 * _tmp203);
     _hessian(5, 4) = _tmp201 * _tmp213 + _tmp202 * _tmp214 + _tmp203 * _tmp215;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) =
-        std::pow(_tmp213, Scalar(2)) + std::pow(_tmp214, Scalar(2)) + std::pow(_tmp215, Scalar(2));
+    _hessian(5, 5) = (_tmp213 * _tmp213) + (_tmp214 * _tmp214) + (_tmp215 * _tmp215);
   }
 
   if (rhs != nullptr) {
@@ -62,12 +62,13 @@ void DoubleSphereReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp6 = _source_pose[2] * _tmp5;
   const Scalar _tmp7 = -source_calibration_storage(3, 0) + source_pixel(1, 0);
   const Scalar _tmp8 =
-      std::pow(_tmp7, Scalar(2)) / std::pow(source_calibration_storage(1, 0), Scalar(2));
+      (_tmp7 * _tmp7) / (source_calibration_storage(1, 0) * source_calibration_storage(1, 0));
   const Scalar _tmp9 = -source_calibration_storage(2, 0) + source_pixel(0, 0);
   const Scalar _tmp10 =
-      std::pow(_tmp9, Scalar(2)) / std::pow(source_calibration_storage(0, 0), Scalar(2));
+      (_tmp9 * _tmp9) / (source_calibration_storage(0, 0) * source_calibration_storage(0, 0));
   const Scalar _tmp11 = _tmp10 + _tmp8;
-  const Scalar _tmp12 = -_tmp11 * std::pow(source_calibration_storage(5, 0), Scalar(2)) + 1;
+  const Scalar _tmp12 =
+      -_tmp11 * (source_calibration_storage(5, 0) * source_calibration_storage(5, 0)) + 1;
   const Scalar _tmp13 = -_tmp11 * (2 * source_calibration_storage(5, 0) - 1) + 1;
   const Scalar _tmp14 =
       source_calibration_storage(5, 0) * std::sqrt(Scalar(std::max<Scalar>(_tmp13, epsilon))) -
@@ -75,37 +76,37 @@ void DoubleSphereReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp15 =
       _tmp14 + epsilon * (2 * std::min<Scalar>(0, (((_tmp14) > 0) - ((_tmp14) < 0))) + 1);
   const Scalar _tmp16 = _tmp12 / _tmp15;
-  const Scalar _tmp17 = std::pow(_tmp12, Scalar(2)) / std::pow(_tmp15, Scalar(2));
+  const Scalar _tmp17 = (_tmp12 * _tmp12) / (_tmp15 * _tmp15);
   const Scalar _tmp18 = _tmp11 + _tmp17;
   const Scalar _tmp19 =
       _tmp18 + epsilon * (2 * std::min<Scalar>(0, (((_tmp18) > 0) - ((_tmp18) < 0))) + 1);
   const Scalar _tmp20 =
-      _tmp11 * (1 - std::pow(source_calibration_storage(4, 0), Scalar(2))) + _tmp17;
+      _tmp11 * (1 - (source_calibration_storage(4, 0) * source_calibration_storage(4, 0))) + _tmp17;
   const Scalar _tmp21 = _tmp16 * source_calibration_storage(4, 0) +
                         std::sqrt(Scalar(std::max<Scalar>(_tmp20, epsilon)));
   const Scalar _tmp22 = _tmp21 / _tmp19;
   const Scalar _tmp23 = _tmp16 * _tmp22 - source_calibration_storage(4, 0);
-  const Scalar _tmp24 = std::pow(_tmp21, Scalar(2)) / std::pow(_tmp19, Scalar(2));
+  const Scalar _tmp24 = (_tmp21 * _tmp21) / (_tmp19 * _tmp19);
   const Scalar _tmp25 =
-      std::pow(Scalar(_tmp10 * _tmp24 + std::pow(_tmp23, Scalar(2)) + _tmp24 * _tmp8 + epsilon),
-               Scalar(Scalar(-1) / Scalar(2)));
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp10 * _tmp24 + (_tmp23 * _tmp23) + _tmp24 * _tmp8 + epsilon));
   const Scalar _tmp26 = _tmp23 * _tmp25;
   const Scalar _tmp27 = _source_pose[0] * _tmp5;
   const Scalar _tmp28 = 2 * _source_pose[2];
   const Scalar _tmp29 = _source_pose[3] * _tmp28;
   const Scalar _tmp30 = _tmp22 * _tmp25;
   const Scalar _tmp31 = _tmp30 * _tmp9 / source_calibration_storage(0, 0);
-  const Scalar _tmp32 = -2 * std::pow(_source_pose[2], Scalar(2));
-  const Scalar _tmp33 = -2 * std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp32 = -2 * (_source_pose[2] * _source_pose[2]);
+  const Scalar _tmp33 = -2 * (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp34 = _tmp30 * _tmp7 / source_calibration_storage(1, 0);
   const Scalar _tmp35 = _tmp26 * (-_tmp4 + _tmp6) + _tmp31 * (_tmp27 + _tmp29) +
                         _tmp34 * (_tmp32 + _tmp33 + 1) +
                         source_inverse_range * (_source_pose[5] - _target_pose[5]);
-  const Scalar _tmp36 = -2 * std::pow(_target_pose[1], Scalar(2));
-  const Scalar _tmp37 = 1 - 2 * std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp36 = -2 * (_target_pose[1] * _target_pose[1]);
+  const Scalar _tmp37 = 1 - 2 * (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp38 = _source_pose[0] * _tmp28;
   const Scalar _tmp39 = _source_pose[3] * _tmp5;
-  const Scalar _tmp40 = 1 - 2 * std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp40 = 1 - 2 * (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp41 = _tmp26 * (_tmp38 + _tmp39) + _tmp31 * (_tmp32 + _tmp40) +
                         _tmp34 * (_tmp27 - _tmp29) +
                         source_inverse_range * (_source_pose[4] - _target_pose[4]);
@@ -123,24 +124,23 @@ void DoubleSphereReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp48 = -epsilon * (_tmp47 + 1) + target_calibration_storage(5, 0);
   const Scalar _tmp49 = _target_pose[2] * _tmp2;
   const Scalar _tmp50 = 2 * _target_pose[0] * _target_pose[3];
-  const Scalar _tmp51 = -2 * std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp51 = -2 * (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp52 =
       _tmp35 * (_tmp49 - _tmp50) + _tmp41 * (_tmp42 + _tmp43) + _tmp44 * (_tmp36 + _tmp51 + 1);
   const Scalar _tmp53 =
       _tmp35 * (_tmp37 + _tmp51) + _tmp41 * (-_tmp1 + _tmp3) + _tmp44 * (_tmp49 + _tmp50);
-  const Scalar _tmp54 =
-      std::pow(_tmp45, Scalar(2)) + std::pow(_tmp53, Scalar(2)) + std::pow(epsilon, Scalar(2));
-  const Scalar _tmp55 = std::sqrt(Scalar(std::pow(_tmp52, Scalar(2)) + _tmp54));
+  const Scalar _tmp54 = (_tmp45 * _tmp45) + (_tmp53 * _tmp53) + (epsilon * epsilon);
+  const Scalar _tmp55 = std::sqrt(Scalar((_tmp52 * _tmp52) + _tmp54));
   const Scalar _tmp56 = _tmp52 + _tmp55 * target_calibration_storage(4, 0);
   const Scalar _tmp57 = -_tmp48;
   const Scalar _tmp58 =
       Scalar(1.0) /
-      (std::max<Scalar>(epsilon, _tmp48 * std::sqrt(Scalar(_tmp54 + std::pow(_tmp56, Scalar(2)))) +
-                                     _tmp56 * (_tmp57 + 1)));
+      (std::max<Scalar>(
+          epsilon, _tmp48 * std::sqrt(Scalar(_tmp54 + (_tmp56 * _tmp56))) + _tmp56 * (_tmp57 + 1)));
   const Scalar _tmp59 = (Scalar(1) / Scalar(2)) * _tmp47 + _tmp57 + 1;
-  const Scalar _tmp60 = std::pow(target_calibration_storage(4, 0), Scalar(2));
+  const Scalar _tmp60 = (target_calibration_storage(4, 0) * target_calibration_storage(4, 0));
   const Scalar _tmp61 = _tmp46 + _tmp48;
-  const Scalar _tmp62 = std::pow(_tmp59, Scalar(2)) / std::pow(_tmp61, Scalar(2));
+  const Scalar _tmp62 = (_tmp59 * _tmp59) / (_tmp61 * _tmp61);
   const Scalar _tmp63 = _tmp60 * _tmp62 - _tmp60 + 1;
 
   // Output terms (2)
@@ -63,30 +63,29 @@ void EquirectangularReprojectionDelta(
       (-source_calibration_storage(3, 0) + source_pixel(1, 0)) / source_calibration_storage(1, 0);
   const Scalar _tmp8 = std::sin(_tmp7);
   const Scalar _tmp9 = std::cos(_tmp7);
-  const Scalar _tmp10 = std::pow(_tmp9, Scalar(2));
+  const Scalar _tmp10 = (_tmp9 * _tmp9);
   const Scalar _tmp11 =
       (-source_calibration_storage(2, 0) + source_pixel(0, 0)) / source_calibration_storage(0, 0);
   const Scalar _tmp12 = std::cos(_tmp11);
   const Scalar _tmp13 = std::sin(_tmp11);
   const Scalar _tmp14 =
-      std::pow(Scalar(_tmp10 * std::pow(_tmp12, Scalar(2)) + _tmp10 * std::pow(_tmp13, Scalar(2)) +
-                      std::pow(_tmp8, Scalar(2)) + epsilon),
-               Scalar(Scalar(-1) / Scalar(2)));
+      Scalar(1.0) / std::sqrt(Scalar(_tmp10 * (_tmp12 * _tmp12) + _tmp10 * (_tmp13 * _tmp13) +
+                                     (_tmp8 * _tmp8) + epsilon));
   const Scalar _tmp15 = _tmp14 * _tmp8;
   const Scalar _tmp16 = _source_pose[0] * _tmp5;
   const Scalar _tmp17 = 2 * _source_pose[1];
   const Scalar _tmp18 = _source_pose[3] * _tmp17;
   const Scalar _tmp19 = _tmp14 * _tmp9;
   const Scalar _tmp20 = _tmp13 * _tmp19;
-  const Scalar _tmp21 = -2 * std::pow(_source_pose[1], Scalar(2));
-  const Scalar _tmp22 = -2 * std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp21 = -2 * (_source_pose[1] * _source_pose[1]);
+  const Scalar _tmp22 = -2 * (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp23 = _tmp12 * _tmp19;
   const Scalar _tmp24 = _tmp15 * (_tmp4 + _tmp6) + _tmp20 * (_tmp16 - _tmp18) +
                         _tmp23 * (_tmp21 + _tmp22 + 1) +
                         source_inverse_range * (_source_pose[6] - _target_pose[6]);
-  const Scalar _tmp25 = -2 * std::pow(_target_pose[1], Scalar(2));
-  const Scalar _tmp26 = 1 - 2 * std::pow(_target_pose[2], Scalar(2));
-  const Scalar _tmp27 = 1 - 2 * std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp25 = -2 * (_target_pose[1] * _target_pose[1]);
+  const Scalar _tmp26 = 1 - 2 * (_target_pose[2] * _target_pose[2]);
+  const Scalar _tmp27 = 1 - 2 * (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp28 = _source_pose[0] * _tmp17;
   const Scalar _tmp29 = _source_pose[3] * _tmp5;
   const Scalar _tmp30 = _tmp15 * (_tmp28 - _tmp29) + _tmp20 * (_tmp21 + _tmp27) +
@@ -99,14 +98,14 @@ void EquirectangularReprojectionDelta(
                         source_inverse_range * (_source_pose[5] - _target_pose[5]);
   const Scalar _tmp34 =
       _tmp24 * (_tmp1 - _tmp3) + _tmp30 * (_tmp25 + _tmp26) + _tmp33 * (_tmp31 + _tmp32);
-  const Scalar _tmp35 = -2 * std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp35 = -2 * (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp36 = _target_pose[1] * _tmp0;
   const Scalar _tmp37 = _target_pose[0] * _tmp2;
   const Scalar _tmp38 =
       _tmp24 * (_tmp25 + _tmp35 + 1) + _tmp30 * (_tmp1 + _tmp3) + _tmp33 * (_tmp36 - _tmp37);
   const Scalar _tmp39 =
       _tmp24 * (_tmp36 + _tmp37) + _tmp30 * (-_tmp31 + _tmp32) + _tmp33 * (_tmp26 + _tmp35);
-  const Scalar _tmp40 = std::pow(_tmp34, Scalar(2)) + std::pow(_tmp38, Scalar(2));
+  const Scalar _tmp40 = (_tmp34 * _tmp34) + (_tmp38 * _tmp38);
 
   // Output terms (2)
   if (reprojection_delta != nullptr) {
@@ -125,8 +124,8 @@ void EquirectangularReprojectionDelta(
   if (is_valid != nullptr) {
     Scalar& _is_valid = (*is_valid);
 
-    _is_valid = std::max<Scalar>(0, (((std::pow(_tmp39, Scalar(2)) + _tmp40) > 0) -
-                                     ((std::pow(_tmp39, Scalar(2)) + _tmp40) < 0))) *
+    _is_valid = std::max<Scalar>(
+                    0, ((((_tmp39 * _tmp39) + _tmp40) > 0) - (((_tmp39 * _tmp39) + _tmp40) < 0))) *
                 std::max<Scalar>(0, std::min<Scalar>((((Scalar(M_PI) - std::fabs(_tmp11)) > 0) -
                                                       ((Scalar(M_PI) - std::fabs(_tmp11)) < 0)),
                                                      (((-std::fabs(_tmp7) + Scalar(M_PI_2)) > 0) -
@@ -83,14 +83,14 @@ void ImuManifoldPreintegrationUpdate(
 
   // Intermediate terms (421)
   const Scalar _tmp0 = -gyro_bias(0, 0) + gyro_measurement(0, 0);
-  const Scalar _tmp1 = std::pow(dt, Scalar(2));
+  const Scalar _tmp1 = (dt * dt);
   const Scalar _tmp2 = -gyro_bias(2, 0) + gyro_measurement(2, 0);
-  const Scalar _tmp3 = _tmp1 * std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = _tmp1 * (_tmp2 * _tmp2);
   const Scalar _tmp4 = -gyro_bias(1, 0) + gyro_measurement(1, 0);
-  const Scalar _tmp5 = _tmp1 * std::pow(_tmp4, Scalar(2));
-  const Scalar _tmp6 = std::pow(_tmp0, Scalar(2)) * _tmp1;
+  const Scalar _tmp5 = _tmp1 * (_tmp4 * _tmp4);
+  const Scalar _tmp6 = (_tmp0 * _tmp0) * _tmp1;
   const Scalar _tmp7 = _tmp3 + _tmp5 + _tmp6;
-  const Scalar _tmp8 = _tmp7 + std::pow(epsilon, Scalar(2));
+  const Scalar _tmp8 = _tmp7 + (epsilon * epsilon);
   const Scalar _tmp9 = std::sqrt(_tmp8);
   const Scalar _tmp10 = (Scalar(1) / Scalar(2)) * _tmp9;
   const Scalar _tmp11 = std::sin(_tmp10);
@@ -101,8 +101,8 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp16 = _tmp12 * _tmp15;
   const Scalar _tmp17 = _tmp13 * _tmp4;
   const Scalar _tmp18 = std::cos(_tmp10);
-  const Scalar _tmp19 = -2 * std::pow(_DR[2], Scalar(2));
-  const Scalar _tmp20 = 1 - 2 * std::pow(_DR[1], Scalar(2));
+  const Scalar _tmp19 = -2 * (_DR[2] * _DR[2]);
+  const Scalar _tmp20 = 1 - 2 * (_DR[1] * _DR[1]);
   const Scalar _tmp21 = _tmp19 + _tmp20;
   const Scalar _tmp22 = -accel_bias(0, 0) + accel_measurement(0, 0);
   const Scalar _tmp23 = 2 * _DR[0] * _DR[1];
@@ -116,7 +116,7 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp31 = _tmp29 + _tmp30;
   const Scalar _tmp32 = -accel_bias(2, 0) + accel_measurement(2, 0);
   const Scalar _tmp33 = _tmp21 * _tmp22 + _tmp26 * _tmp27 + _tmp31 * _tmp32;
-  const Scalar _tmp34 = -2 * std::pow(_DR[0], Scalar(2));
+  const Scalar _tmp34 = -2 * (_DR[0] * _DR[0]);
   const Scalar _tmp35 = _tmp19 + _tmp34 + 1;
   const Scalar _tmp36 = _tmp23 + _tmp25;
   const Scalar _tmp37 = _DR[0] * _tmp28;
@@ -135,7 +135,7 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp50 = (_tmp49 - std::sin(_tmp49)) / (_tmp48 * std::sqrt(_tmp48));
   const Scalar _tmp51 = _tmp50 * (_tmp46 + _tmp47) + 1;
   const Scalar _tmp52 = dt * gyro_cov_diagonal(0, 0);
-  const Scalar _tmp53 = 2 * std::pow(_tmp11, Scalar(2)) / _tmp8;
+  const Scalar _tmp53 = 2 * (_tmp11 * _tmp11) / _tmp8;
   const Scalar _tmp54 = -_tmp5 * _tmp53;
   const Scalar _tmp55 = -_tmp3 * _tmp53;
   const Scalar _tmp56 = _tmp54 + _tmp55 + 1;
@@ -301,11 +301,11 @@ void ImuManifoldPreintegrationUpdate(
       _tmp103 * covariance(2, 3) + _tmp104 * covariance(1, 3) + _tmp105 * covariance(0, 3);
   const Scalar _tmp194 = _tmp123 * _tmp129;
   const Scalar _tmp195 = _tmp121 * _tmp133;
-  const Scalar _tmp196 = std::pow(_tmp31, Scalar(2));
+  const Scalar _tmp196 = (_tmp31 * _tmp31);
   const Scalar _tmp197 = accel_cov_diagonal(2, 0) * dt;
-  const Scalar _tmp198 = std::pow(_tmp26, Scalar(2));
+  const Scalar _tmp198 = (_tmp26 * _tmp26);
   const Scalar _tmp199 = accel_cov_diagonal(1, 0) * dt;
-  const Scalar _tmp200 = std::pow(_tmp21, Scalar(2));
+  const Scalar _tmp200 = (_tmp21 * _tmp21);
   const Scalar _tmp201 = accel_cov_diagonal(0, 0) * dt;
   const Scalar _tmp202 = _tmp118 * _tmp125;
   const Scalar _tmp203 = _tmp118 * covariance(0, 3);
@@ -389,10 +389,10 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp273 = _tmp270 + _tmp271 + _tmp272 + covariance(3, 4);
   const Scalar _tmp274 = _tmp136 * _tmp147;
   const Scalar _tmp275 = _tmp139 * _tmp143;
-  const Scalar _tmp276 = std::pow(_tmp36, Scalar(2));
+  const Scalar _tmp276 = (_tmp36 * _tmp36);
   const Scalar _tmp277 = _tmp141 * _tmp151;
-  const Scalar _tmp278 = std::pow(_tmp35, Scalar(2));
-  const Scalar _tmp279 = std::pow(_tmp39, Scalar(2));
+  const Scalar _tmp278 = (_tmp35 * _tmp35);
+  const Scalar _tmp279 = (_tmp39 * _tmp39);
   const Scalar _tmp280 = _tmp136 * covariance(1, 4);
   const Scalar _tmp281 = _tmp139 * covariance(0, 4);
   const Scalar _tmp282 = _tmp141 * covariance(2, 4);
@@ -455,10 +455,10 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp333 = _tmp330 + _tmp331 + _tmp332 + covariance(4, 5);
   const Scalar _tmp334 = _tmp157 * _tmp161;
   const Scalar _tmp335 = _tmp159 * _tmp165;
-  const Scalar _tmp336 = std::pow(_tmp42, Scalar(2));
-  const Scalar _tmp337 = std::pow(_tmp41, Scalar(2));
+  const Scalar _tmp336 = (_tmp42 * _tmp42);
+  const Scalar _tmp337 = (_tmp41 * _tmp41);
   const Scalar _tmp338 = _tmp154 * _tmp169;
-  const Scalar _tmp339 = std::pow(_tmp43, Scalar(2));
+  const Scalar _tmp339 = (_tmp43 * _tmp43);
   const Scalar _tmp340 = _tmp154 * covariance(0, 5);
   const Scalar _tmp341 = _tmp157 * covariance(1, 5);
   const Scalar _tmp342 = _tmp159 * covariance(2, 5);
@@ -490,10 +490,7 @@ void ImuManifoldPreintegrationUpdate(
   const Scalar _tmp365 = _tmp154 * covariance(0, 6);
   const Scalar _tmp366 = _tmp157 * covariance(1, 6);
   const Scalar _tmp367 = _tmp159 * covariance(2, 6);
-  const Scalar _tmp368 = (Scalar(1) / Scalar(4)) * [&]() {
-    const Scalar base = dt;
-    return base * base * base;
-  }();
+  const Scalar _tmp368 = (Scalar(1) / Scalar(4)) * (dt * dt * dt);
   const Scalar _tmp369 = _tmp368 * accel_cov_diagonal(1, 0);
   const Scalar _tmp370 = _tmp31 * _tmp368;
   const Scalar _tmp371 = _tmp26 * _tmp369;
@@ -578,9 +575,9 @@ void ImuManifoldPreintegrationUpdate(
   if (new_covariance != nullptr) {
     Eigen::Matrix<Scalar, 9, 9>& _new_covariance = (*new_covariance);
 
-    _new_covariance(0, 0) =
-        std::pow(_tmp51, Scalar(2)) * _tmp52 + _tmp56 * _tmp67 + _tmp62 * _tmp69 + _tmp66 * _tmp68 +
-        std::pow(_tmp75, Scalar(2)) * _tmp76 + std::pow(_tmp79, Scalar(2)) * _tmp80;
+    _new_covariance(0, 0) = (_tmp51 * _tmp51) * _tmp52 + _tmp56 * _tmp67 + _tmp62 * _tmp69 +
+                            _tmp66 * _tmp68 + (_tmp75 * _tmp75) * _tmp76 +
+                            (_tmp79 * _tmp79) * _tmp80;
     _new_covariance(1, 0) = _tmp102 + _tmp56 * _tmp88 + _tmp62 * _tmp90 + _tmp66 * _tmp89;
     _new_covariance(2, 0) = _tmp106 * _tmp56 + _tmp107 * _tmp66 + _tmp108 * _tmp62 + _tmp115;
     _new_covariance(3, 0) = _tmp125 * _tmp56 + _tmp129 * _tmp62 + _tmp133 * _tmp66;
@@ -590,9 +587,9 @@ void ImuManifoldPreintegrationUpdate(
     _new_covariance(7, 0) = _tmp174 * _tmp66 + _tmp175 * _tmp62 + _tmp176 * _tmp56;
     _new_covariance(8, 0) = _tmp177 * _tmp66 + _tmp178 * _tmp62 + _tmp179 * _tmp56;
     _new_covariance(0, 1) = _tmp102 + _tmp67 * _tmp87 + _tmp68 * _tmp82 + _tmp69 * _tmp86;
-    _new_covariance(1, 1) =
-        std::pow(_tmp100, Scalar(2)) * _tmp52 + _tmp76 * std::pow(_tmp93, Scalar(2)) +
-        _tmp80 * std::pow(_tmp96, Scalar(2)) + _tmp82 * _tmp89 + _tmp86 * _tmp90 + _tmp87 * _tmp88;
+    _new_covariance(1, 1) = (_tmp100 * _tmp100) * _tmp52 + _tmp76 * (_tmp93 * _tmp93) +
+                            _tmp80 * (_tmp96 * _tmp96) + _tmp82 * _tmp89 + _tmp86 * _tmp90 +
+                            _tmp87 * _tmp88;
     _new_covariance(2, 1) = _tmp106 * _tmp87 + _tmp107 * _tmp82 + _tmp108 * _tmp86 + _tmp181;
     _new_covariance(3, 1) = _tmp125 * _tmp87 + _tmp129 * _tmp86 + _tmp133 * _tmp82;
     _new_covariance(4, 1) = _tmp143 * _tmp87 + _tmp147 * _tmp82 + _tmp151 * _tmp86;
@@ -603,9 +600,8 @@ void ImuManifoldPreintegrationUpdate(
     _new_covariance(0, 2) = _tmp103 * _tmp69 + _tmp104 * _tmp68 + _tmp105 * _tmp67 + _tmp115;
     _new_covariance(1, 2) = _tmp103 * _tmp90 + _tmp104 * _tmp89 + _tmp105 * _tmp88 + _tmp181;
     _new_covariance(2, 2) = _tmp103 * _tmp108 + _tmp104 * _tmp107 + _tmp105 * _tmp106 +
-                            std::pow(_tmp109, Scalar(2)) * _tmp76 +
-                            std::pow(_tmp112, Scalar(2)) * _tmp52 +
-                            std::pow(_tmp113, Scalar(2)) * _tmp80;
+                            (_tmp109 * _tmp109) * _tmp76 + (_tmp112 * _tmp112) * _tmp52 +
+                            (_tmp113 * _tmp113) * _tmp80;
     _new_covariance(3, 2) = _tmp103 * _tmp129 + _tmp104 * _tmp133 + _tmp105 * _tmp125;
     _new_covariance(4, 2) = _tmp103 * _tmp151 + _tmp104 * _tmp147 + _tmp105 * _tmp143;
     _new_covariance(5, 2) = _tmp103 * _tmp165 + _tmp104 * _tmp161 + _tmp105 * _tmp169;
@@ -87,13 +87,13 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
 
   // Intermediate terms (439)
   const Scalar _tmp0 = -gyro_bias(0, 0) + gyro_measurement(0, 0);
-  const Scalar _tmp1 = std::pow(dt, Scalar(2));
+  const Scalar _tmp1 = (dt * dt);
   const Scalar _tmp2 = -gyro_bias(2, 0) + gyro_measurement(2, 0);
-  const Scalar _tmp3 = std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = (_tmp2 * _tmp2);
   const Scalar _tmp4 = -gyro_bias(1, 0) + gyro_measurement(1, 0);
-  const Scalar _tmp5 = std::pow(_tmp4, Scalar(2));
-  const Scalar _tmp6 = std::pow(_tmp0, Scalar(2));
-  const Scalar _tmp7 = _tmp1 * _tmp3 + _tmp1 * _tmp5 + _tmp1 * _tmp6 + std::pow(epsilon, Scalar(2));
+  const Scalar _tmp5 = (_tmp4 * _tmp4);
+  const Scalar _tmp6 = (_tmp0 * _tmp0);
+  const Scalar _tmp7 = _tmp1 * _tmp3 + _tmp1 * _tmp5 + _tmp1 * _tmp6 + (epsilon * epsilon);
   const Scalar _tmp8 = std::sqrt(_tmp7);
   const Scalar _tmp9 = (Scalar(1) / Scalar(2)) * _tmp8;
   const Scalar _tmp10 = std::sin(_tmp9);
@@ -126,9 +126,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   const Scalar _tmp37 = _tmp17 * _tmp4;
   const Scalar _tmp38 = _tmp19 * _tmp2;
   const Scalar _tmp39 = _tmp35 - _tmp36 - _tmp37 - _tmp38;
-  const Scalar _tmp40 = std::pow(_DR[1], Scalar(2));
+  const Scalar _tmp40 = (_DR[1] * _DR[1]);
   const Scalar _tmp41 = -2 * _tmp40;
-  const Scalar _tmp42 = std::pow(_DR[2], Scalar(2));
+  const Scalar _tmp42 = (_DR[2] * _DR[2]);
   const Scalar _tmp43 = -2 * _tmp42;
   const Scalar _tmp44 = _tmp41 + _tmp43 + 1;
   const Scalar _tmp45 = -accel_bias(0, 0) + accel_measurement(0, 0);
@@ -144,7 +144,7 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   const Scalar _tmp55 = _tmp52 + _tmp54;
   const Scalar _tmp56 = -accel_bias(2, 0) + accel_measurement(2, 0);
   const Scalar _tmp57 = _tmp44 * _tmp45 + _tmp50 * _tmp51 + _tmp55 * _tmp56;
-  const Scalar _tmp58 = std::pow(_DR[0], Scalar(2));
+  const Scalar _tmp58 = (_DR[0] * _DR[0]);
   const Scalar _tmp59 = 1 - 2 * _tmp58;
   const Scalar _tmp60 = _tmp43 + _tmp59;
   const Scalar _tmp61 = _tmp47 + _tmp48;
@@ -164,10 +164,7 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   const Scalar _tmp75 = _tmp73 * _tmp74;
   const Scalar _tmp76 = _tmp2 * _tmp75;
   const Scalar _tmp77 = (Scalar(1) / Scalar(2)) * _tmp28;
-  const Scalar _tmp78 = [&]() {
-    const Scalar base = dt;
-    return base * base * base;
-  }();
+  const Scalar _tmp78 = (dt * dt * dt);
   const Scalar _tmp79 = _tmp78 / _tmp7;
   const Scalar _tmp80 = _tmp3 * _tmp79;
   const Scalar _tmp81 = _tmp77 * _tmp80;
@@ -392,7 +389,7 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   const Scalar _tmp273 = _tmp248 * _tmp272 + _tmp258 * _tmp270 + _tmp261 * _tmp269;
   const Scalar _tmp274 = -_tmp58;
   const Scalar _tmp275 = _tmp274 + _tmp40;
-  const Scalar _tmp276 = std::pow(_DR[3], Scalar(2));
+  const Scalar _tmp276 = (_DR[3] * _DR[3]);
   const Scalar _tmp277 = -_tmp276;
   const Scalar _tmp278 = _tmp277 + _tmp42;
   const Scalar _tmp279 = _tmp45 * _tmp50 + _tmp51 * (_tmp275 + _tmp278);
@@ -474,11 +471,11 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
       _tmp251 * covariance(0, 3) + _tmp252 * covariance(2, 3) + _tmp253 * covariance(1, 3);
   const Scalar _tmp334 =
       _tmp263 * covariance(1, 3) + _tmp264 * covariance(2, 3) + _tmp265 * covariance(0, 3);
-  const Scalar _tmp335 = std::pow(_tmp55, Scalar(2));
+  const Scalar _tmp335 = (_tmp55 * _tmp55);
   const Scalar _tmp336 = accel_cov_diagonal(2, 0) * dt;
-  const Scalar _tmp337 = std::pow(_tmp50, Scalar(2));
+  const Scalar _tmp337 = (_tmp50 * _tmp50);
   const Scalar _tmp338 = accel_cov_diagonal(1, 0) * dt;
-  const Scalar _tmp339 = std::pow(_tmp44, Scalar(2));
+  const Scalar _tmp339 = (_tmp44 * _tmp44);
   const Scalar _tmp340 = accel_cov_diagonal(0, 0) * dt;
   const Scalar _tmp341 = _tmp280 * covariance(2, 3) + _tmp287 * covariance(1, 3) +
                          _tmp290 * covariance(0, 3) + covariance(3, 3);
@@ -528,9 +525,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   const Scalar _tmp377 = _tmp293 * dt;
   const Scalar _tmp378 = _tmp280 * covariance(2, 4) + _tmp287 * covariance(1, 4) +
                          _tmp290 * covariance(0, 4) + covariance(3, 4);
-  const Scalar _tmp379 = std::pow(_tmp61, Scalar(2));
-  const Scalar _tmp380 = std::pow(_tmp60, Scalar(2));
-  const Scalar _tmp381 = std::pow(_tmp65, Scalar(2));
+  const Scalar _tmp379 = (_tmp61 * _tmp61);
+  const Scalar _tmp380 = (_tmp60 * _tmp60);
+  const Scalar _tmp381 = (_tmp65 * _tmp65);
   const Scalar _tmp382 = _tmp296 * covariance(1, 4) + _tmp298 * covariance(0, 4) +
                          _tmp300 * covariance(2, 4) + covariance(4, 4);
   const Scalar _tmp383 = _tmp312 * dt;
@@ -561,9 +558,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
                          _tmp290 * covariance(0, 5) + covariance(3, 5);
   const Scalar _tmp400 = _tmp296 * covariance(1, 5) + _tmp298 * covariance(0, 5) +
                          _tmp300 * covariance(2, 5) + covariance(4, 5);
-  const Scalar _tmp401 = std::pow(_tmp69, Scalar(2));
-  const Scalar _tmp402 = std::pow(_tmp67, Scalar(2));
-  const Scalar _tmp403 = std::pow(_tmp70, Scalar(2));
+  const Scalar _tmp401 = (_tmp69 * _tmp69);
+  const Scalar _tmp402 = (_tmp67 * _tmp67);
+  const Scalar _tmp403 = (_tmp70 * _tmp70);
   const Scalar _tmp404 = _tmp305 * covariance(2, 5) + _tmp307 * covariance(0, 5) +
                          _tmp309 * covariance(1, 5) + covariance(5, 5);
   const Scalar _tmp405 = _tmp313 * covariance(2, 5) + _tmp314 * covariance(1, 5) +
@@ -635,10 +632,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
   if (new_covariance != nullptr) {
     Eigen::Matrix<Scalar, 9, 9>& _new_covariance = (*new_covariance);
 
-    _new_covariance(0, 0) = std::pow(_tmp150, Scalar(2)) * _tmp152 + _tmp176 * _tmp190 +
-                            _tmp184 * _tmp226 + _tmp189 * _tmp250 +
-                            std::pow(_tmp224, Scalar(2)) * _tmp225 +
-                            std::pow(_tmp248, Scalar(2)) * _tmp249;
+    _new_covariance(0, 0) = (_tmp150 * _tmp150) * _tmp152 + _tmp176 * _tmp190 + _tmp184 * _tmp226 +
+                            _tmp189 * _tmp250 + (_tmp224 * _tmp224) * _tmp225 +
+                            (_tmp248 * _tmp248) * _tmp249;
     _new_covariance(1, 0) = _tmp176 * _tmp256 + _tmp184 * _tmp254 + _tmp189 * _tmp255 + _tmp262;
     _new_covariance(2, 0) = _tmp176 * _tmp266 + _tmp184 * _tmp268 + _tmp189 * _tmp267 + _tmp273;
     _new_covariance(3, 0) = _tmp176 * _tmp293 + _tmp184 * _tmp292 + _tmp189 * _tmp291;
@@ -648,10 +644,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
     _new_covariance(7, 0) = _tmp176 * _tmp322 + _tmp184 * _tmp324 + _tmp189 * _tmp323;
     _new_covariance(8, 0) = _tmp176 * _tmp329 + _tmp184 * _tmp330 + _tmp189 * _tmp328;
     _new_covariance(0, 1) = _tmp190 * _tmp251 + _tmp226 * _tmp253 + _tmp250 * _tmp252 + _tmp262;
-    _new_covariance(1, 1) = _tmp152 * std::pow(_tmp260, Scalar(2)) +
-                            _tmp225 * std::pow(_tmp257, Scalar(2)) +
-                            _tmp249 * std::pow(_tmp259, Scalar(2)) + _tmp251 * _tmp256 +
-                            _tmp252 * _tmp255 + _tmp253 * _tmp254;
+    _new_covariance(1, 1) = _tmp152 * (_tmp260 * _tmp260) + _tmp225 * (_tmp257 * _tmp257) +
+                            _tmp249 * (_tmp259 * _tmp259) + _tmp251 * _tmp256 + _tmp252 * _tmp255 +
+                            _tmp253 * _tmp254;
     _new_covariance(2, 1) = _tmp251 * _tmp266 + _tmp252 * _tmp267 + _tmp253 * _tmp268 + _tmp331;
     _new_covariance(3, 1) = _tmp251 * _tmp293 + _tmp252 * _tmp291 + _tmp253 * _tmp292;
     _new_covariance(4, 1) = _tmp251 * _tmp302 + _tmp252 * _tmp301 + _tmp253 * _tmp303;
@@ -661,10 +656,9 @@ void ImuManifoldPreintegrationUpdateAutoDerivative(
     _new_covariance(8, 1) = _tmp251 * _tmp329 + _tmp252 * _tmp328 + _tmp253 * _tmp330;
     _new_covariance(0, 2) = _tmp190 * _tmp265 + _tmp226 * _tmp263 + _tmp250 * _tmp264 + _tmp273;
     _new_covariance(1, 2) = _tmp254 * _tmp263 + _tmp255 * _tmp264 + _tmp256 * _tmp265 + _tmp331;
-    _new_covariance(2, 2) = _tmp152 * std::pow(_tmp269, Scalar(2)) +
-                            _tmp225 * std::pow(_tmp270, Scalar(2)) +
-                            _tmp249 * std::pow(_tmp271, Scalar(2)) + _tmp263 * _tmp268 +
-                            _tmp264 * _tmp267 + _tmp265 * _tmp266;
+    _new_covariance(2, 2) = _tmp152 * (_tmp269 * _tmp269) + _tmp225 * (_tmp270 * _tmp270) +
+                            _tmp249 * (_tmp271 * _tmp271) + _tmp263 * _tmp268 + _tmp264 * _tmp267 +
+                            _tmp265 * _tmp266;
     _new_covariance(3, 2) = _tmp263 * _tmp292 + _tmp264 * _tmp291 + _tmp265 * _tmp293;
     _new_covariance(4, 2) = _tmp263 * _tmp303 + _tmp264 * _tmp301 + _tmp265 * _tmp302;
     _new_covariance(5, 2) = _tmp263 * _tmp310 + _tmp264 * _tmp311 + _tmp265 * _tmp312;
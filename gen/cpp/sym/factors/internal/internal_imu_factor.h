@@ -98,8 +98,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
       DR_D_gyro_bias(0, 0) * _tmp0 + DR_D_gyro_bias(0, 1) * _tmp2 + DR_D_gyro_bias(0, 2) * _tmp1;
   const Scalar _tmp5 =
       DR_D_gyro_bias(1, 0) * _tmp0 + DR_D_gyro_bias(1, 1) * _tmp2 + DR_D_gyro_bias(1, 2) * _tmp1;
-  const Scalar _tmp6 = std::pow(_tmp3, Scalar(2)) + std::pow(_tmp4, Scalar(2)) +
-                       std::pow(_tmp5, Scalar(2)) + std::pow(epsilon, Scalar(2));
+  const Scalar _tmp6 = (_tmp3 * _tmp3) + (_tmp4 * _tmp4) + (_tmp5 * _tmp5) + (epsilon * epsilon);
   const Scalar _tmp7 = std::sqrt(_tmp6);
   const Scalar _tmp8 = (Scalar(1) / Scalar(2)) * _tmp7;
   const Scalar _tmp9 = std::cos(_tmp8);
@@ -155,7 +154,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp58 = -_tmp55;
   const Scalar _tmp59 = 1 - epsilon;
   const Scalar _tmp60 = std::min<Scalar>(_tmp59, std::fabs(_tmp54 + _tmp58));
-  const Scalar _tmp61 = std::acos(_tmp60) / std::sqrt(Scalar(1 - std::pow(_tmp60, Scalar(2))));
+  const Scalar _tmp61 = std::acos(_tmp60) / std::sqrt(Scalar(1 - (_tmp60 * _tmp60)));
   const Scalar _tmp62 = _tmp57 * _tmp61;
   const Scalar _tmp63 = _tmp50 * _tmp62;
   const Scalar _tmp64 = _pose_j[1] * _tmp29;
@@ -174,9 +173,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp77 = _tmp62 * _tmp76;
   const Scalar _tmp78 =
       _tmp69 * sqrt_info(2, 1) + _tmp70 * sqrt_info(2, 0) + _tmp77 * sqrt_info(2, 2);
-  const Scalar _tmp79 = std::pow(_pose_i[1], Scalar(2));
+  const Scalar _tmp79 = (_pose_i[1] * _pose_i[1]);
   const Scalar _tmp80 = -2 * _tmp79;
-  const Scalar _tmp81 = std::pow(_pose_i[2], Scalar(2));
+  const Scalar _tmp81 = (_pose_i[2] * _pose_i[2]);
   const Scalar _tmp82 = 1 - 2 * _tmp81;
   const Scalar _tmp83 = _tmp80 + _tmp82;
   const Scalar _tmp84 = -dt * gravity(0, 0) - vel_i(0, 0) + vel_j(0, 0);
@@ -201,7 +200,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
                          Dv_D_gyro_bias(0, 2) * _tmp1 + _tmp83 * _tmp84 + _tmp99;
   const Scalar _tmp101 = _tmp100 * sqrt_info(3, 3) + _tmp69 * sqrt_info(3, 1) +
                          _tmp70 * sqrt_info(3, 0) + _tmp77 * sqrt_info(3, 2);
-  const Scalar _tmp102 = std::pow(_pose_i[0], Scalar(2));
+  const Scalar _tmp102 = (_pose_i[0] * _pose_i[0]);
   const Scalar _tmp103 = -2 * _tmp102;
   const Scalar _tmp104 = _tmp103 + _tmp82;
   const Scalar _tmp105 = -_tmp89;
@@ -229,7 +228,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp119 = _tmp100 * sqrt_info(5, 3) + _tmp111 * sqrt_info(5, 4) +
                          _tmp118 * sqrt_info(5, 5) + _tmp69 * sqrt_info(5, 1) +
                          _tmp70 * sqrt_info(5, 0) + _tmp77 * sqrt_info(5, 2);
-  const Scalar _tmp120 = (Scalar(1) / Scalar(2)) * std::pow(dt, Scalar(2));
+  const Scalar _tmp120 = (Scalar(1) / Scalar(2)) * (dt * dt);
   const Scalar _tmp121 = -_pose_i[4] + _pose_j[4] - _tmp120 * gravity(0, 0) - dt * vel_i(0, 0);
   const Scalar _tmp122 = -_pose_i[6] + _pose_j[6] - _tmp120 * gravity(2, 0) - dt * vel_i(2, 0);
   const Scalar _tmp123 = -_pose_i[5] + _pose_j[5] - _tmp120 * gravity(1, 0) - dt * vel_i(1, 0);
@@ -291,8 +290,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp160 = std::fabs(_tmp159);
   const Scalar _tmp161 = std::min<Scalar>(_tmp160, _tmp59);
   const Scalar _tmp162 = std::acos(_tmp161);
-  const Scalar _tmp163 = 1 - std::pow(_tmp161, Scalar(2));
-  const Scalar _tmp164 = std::pow(_tmp163, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp163 = 1 - (_tmp161 * _tmp161);
+  const Scalar _tmp164 = Scalar(1.0) / std::sqrt(_tmp163);
   const Scalar _tmp165 = _tmp164 * _tmp57;
   const Scalar _tmp166 = _tmp162 * _tmp165;
   const Scalar _tmp167 = _tmp166 * (_pose_j[0] * _tmp151 - _pose_j[1] * _tmp138 +
@@ -304,7 +303,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp171 = _tmp170 / _tmp163;
   const Scalar _tmp172 = _tmp169 * _tmp171;
   const Scalar _tmp173 = _tmp168 * _tmp172;
-  const Scalar _tmp174 = std::pow(_tmp163, Scalar(Scalar(-3) / Scalar(2)));
+  const Scalar _tmp174 = Scalar(1.0) / (_tmp163 * std::sqrt(_tmp163));
   const Scalar _tmp175 = _tmp161 * _tmp162 * _tmp170 * _tmp174;
   const Scalar _tmp176 = _tmp169 * _tmp175;
   const Scalar _tmp177 = _tmp168 * _tmp176;
@@ -337,7 +336,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
                          _tmp189 * sqrt_info(3, 2);
   const Scalar _tmp196 = _tmp68 * sqrt_info(4, 1);
   const Scalar _tmp197 = -_tmp79;
-  const Scalar _tmp198 = std::pow(_pose_i[3], Scalar(2));
+  const Scalar _tmp198 = (_pose_i[3] * _pose_i[3]);
   const Scalar _tmp199 = _tmp197 + _tmp198;
   const Scalar _tmp200 = -_tmp102;
   const Scalar _tmp201 = _tmp200 + _tmp81;
@@ -1155,8 +1154,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp661 = _tmp295 * _tmp332;
   const Scalar _tmp662 = _tmp295 * _tmp352;
   const Scalar _tmp663 = _tmp295 * _tmp372;
-  const Scalar _tmp664 = std::pow(_tmp83, Scalar(2));
-  const Scalar _tmp665 = std::pow(sqrt_info(6, 6), Scalar(2));
+  const Scalar _tmp664 = (_tmp83 * _tmp83);
+  const Scalar _tmp665 = (sqrt_info(6, 6) * sqrt_info(6, 6));
   const Scalar _tmp666 = _tmp664 * _tmp665;
   const Scalar _tmp667 = _tmp665 * _tmp92;
   const Scalar _tmp668 = _tmp667 * _tmp83;
@@ -1178,7 +1177,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp684 = _tmp308 * _tmp563;
   const Scalar _tmp685 = _tmp308 * _tmp604;
   const Scalar _tmp686 = _tmp308 * _tmp643;
-  const Scalar _tmp687 = std::pow(_tmp92, Scalar(2));
+  const Scalar _tmp687 = (_tmp92 * _tmp92);
   const Scalar _tmp688 = _tmp665 * _tmp687;
   const Scalar _tmp689 = _tmp667 * _tmp97;
   const Scalar _tmp690 = _tmp316 * _tmp343;
@@ -1197,7 +1196,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp703 = _tmp316 * _tmp563;
   const Scalar _tmp704 = _tmp316 * _tmp604;
   const Scalar _tmp705 = _tmp316 * _tmp643;
-  const Scalar _tmp706 = std::pow(_tmp97, Scalar(2));
+  const Scalar _tmp706 = (_tmp97 * _tmp97);
   const Scalar _tmp707 = _tmp665 * _tmp706;
   const Scalar _tmp708 = _tmp324 * _tmp343;
   const Scalar _tmp709 = _tmp324 * _tmp363;
@@ -1214,7 +1213,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   const Scalar _tmp720 = _tmp324 * _tmp563;
   const Scalar _tmp721 = _tmp324 * _tmp604;
   const Scalar _tmp722 = _tmp324 * _tmp643;
-  const Scalar _tmp723 = std::pow(sqrt_info(3, 3), Scalar(2));
+  const Scalar _tmp723 = (sqrt_info(3, 3) * sqrt_info(3, 3));
   const Scalar _tmp724 = _tmp664 * _tmp723;
   const Scalar _tmp725 = _tmp723 * _tmp92;
   const Scalar _tmp726 = _tmp725 * _tmp83;
@@ -1501,10 +1500,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 24, 24>& _hessian = (*hessian);
 
-    _hessian(0, 0) =
-        std::pow(_tmp178, Scalar(2)) + std::pow(_tmp183, Scalar(2)) + std::pow(_tmp191, Scalar(2)) +
-        std::pow(_tmp195, Scalar(2)) + std::pow(_tmp206, Scalar(2)) + std::pow(_tmp215, Scalar(2)) +
-        std::pow(_tmp220, Scalar(2)) + std::pow(_tmp225, Scalar(2)) + std::pow(_tmp230, Scalar(2));
+    _hessian(0, 0) = (_tmp178 * _tmp178) + (_tmp183 * _tmp183) + (_tmp191 * _tmp191) +
+                     (_tmp195 * _tmp195) + (_tmp206 * _tmp206) + (_tmp215 * _tmp215) +
+                     (_tmp220 * _tmp220) + (_tmp225 * _tmp225) + (_tmp230 * _tmp230);
     _hessian(1, 0) = _tmp178 * _tmp244 + _tmp183 * _tmp248 + _tmp191 * _tmp254 + _tmp195 * _tmp263 +
                      _tmp206 * _tmp265 + _tmp215 * _tmp269 + _tmp220 * _tmp272 + _tmp225 * _tmp273 +
                      _tmp230 * _tmp274;
@@ -1554,10 +1552,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
                       _tmp195 * _tmp638 + _tmp206 * _tmp640 + _tmp215 * _tmp641 +
                       _tmp220 * _tmp643 + _tmp225 * _tmp644 + _tmp230 * _tmp645;
     _hessian(0, 1) = 0;
-    _hessian(1, 1) =
-        std::pow(_tmp244, Scalar(2)) + std::pow(_tmp248, Scalar(2)) + std::pow(_tmp254, Scalar(2)) +
-        std::pow(_tmp263, Scalar(2)) + std::pow(_tmp265, Scalar(2)) + std::pow(_tmp269, Scalar(2)) +
-        std::pow(_tmp272, Scalar(2)) + std::pow(_tmp273, Scalar(2)) + std::pow(_tmp274, Scalar(2));
+    _hessian(1, 1) = (_tmp244 * _tmp244) + (_tmp248 * _tmp248) + (_tmp254 * _tmp254) +
+                     (_tmp263 * _tmp263) + (_tmp265 * _tmp265) + (_tmp269 * _tmp269) +
+                     (_tmp272 * _tmp272) + (_tmp273 * _tmp273) + (_tmp274 * _tmp274);
     _hessian(2, 1) = _tmp244 * _tmp283 + _tmp248 * _tmp286 + _tmp254 * _tmp292 + _tmp263 * _tmp295 +
                      _tmp265 * _tmp301 + _tmp269 * _tmp302 + _tmp272 * _tmp304 + _tmp273 * _tmp306 +
                      _tmp274 * _tmp307;
@@ -1605,10 +1602,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
                       _tmp272 * _tmp643 + _tmp273 * _tmp644 + _tmp274 * _tmp645;
     _hessian(0, 2) = 0;
     _hessian(1, 2) = 0;
-    _hessian(2, 2) =
-        std::pow(_tmp283, Scalar(2)) + std::pow(_tmp286, Scalar(2)) + std::pow(_tmp292, Scalar(2)) +
-        std::pow(_tmp295, Scalar(2)) + std::pow(_tmp301, Scalar(2)) + std::pow(_tmp302, Scalar(2)) +
-        std::pow(_tmp304, Scalar(2)) + std::pow(_tmp306, Scalar(2)) + std::pow(_tmp307, Scalar(2));
+    _hessian(2, 2) = (_tmp283 * _tmp283) + (_tmp286 * _tmp286) + (_tmp292 * _tmp292) +
+                     (_tmp295 * _tmp295) + (_tmp301 * _tmp301) + (_tmp302 * _tmp302) +
+                     (_tmp304 * _tmp304) + (_tmp306 * _tmp306) + (_tmp307 * _tmp307);
     _hessian(3, 2) = _tmp306 * _tmp311 + _tmp307 * _tmp315 - _tmp658;
     _hessian(4, 2) = _tmp306 * _tmp319 + _tmp307 * _tmp323 - _tmp659;
     _hessian(5, 2) = _tmp306 * _tmp327 + _tmp307 * _tmp331 - _tmp660;
@@ -1654,7 +1650,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(0, 3) = 0;
     _hessian(1, 3) = 0;
     _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp311, Scalar(2)) + std::pow(_tmp315, Scalar(2)) + _tmp666;
+    _hessian(3, 3) = (_tmp311 * _tmp311) + (_tmp315 * _tmp315) + _tmp666;
     _hessian(4, 3) = _tmp311 * _tmp319 + _tmp315 * _tmp323 + _tmp668;
     _hessian(5, 3) = _tmp311 * _tmp327 + _tmp315 * _tmp331 + _tmp669;
     _hessian(6, 3) = _tmp311 * _tmp347 + _tmp315 * _tmp351 - _tmp670;
@@ -1679,7 +1675,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(1, 4) = 0;
     _hessian(2, 4) = 0;
     _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp319, Scalar(2)) + std::pow(_tmp323, Scalar(2)) + _tmp688;
+    _hessian(4, 4) = (_tmp319 * _tmp319) + (_tmp323 * _tmp323) + _tmp688;
     _hessian(5, 4) = _tmp319 * _tmp327 + _tmp323 * _tmp331 + _tmp689;
     _hessian(6, 4) = _tmp319 * _tmp347 + _tmp323 * _tmp351 - _tmp690;
     _hessian(7, 4) = _tmp319 * _tmp367 + _tmp323 * _tmp371 - _tmp691;
@@ -1704,7 +1700,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(2, 5) = 0;
     _hessian(3, 5) = 0;
     _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp327, Scalar(2)) + std::pow(_tmp331, Scalar(2)) + _tmp707;
+    _hessian(5, 5) = (_tmp327 * _tmp327) + (_tmp331 * _tmp331) + _tmp707;
     _hessian(6, 5) = _tmp327 * _tmp347 + _tmp331 * _tmp351 - _tmp708;
     _hessian(7, 5) = _tmp327 * _tmp367 + _tmp331 * _tmp371 - _tmp709;
     _hessian(8, 5) = _tmp327 * _tmp387 + _tmp331 * _tmp391 - _tmp710;
@@ -1729,9 +1725,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(3, 6) = 0;
     _hessian(4, 6) = 0;
     _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp335, Scalar(2)) + std::pow(_tmp339, Scalar(2)) +
-                     std::pow(_tmp343, Scalar(2)) + std::pow(_tmp347, Scalar(2)) +
-                     std::pow(_tmp351, Scalar(2)) + _tmp724;
+    _hessian(6, 6) = (_tmp335 * _tmp335) + (_tmp339 * _tmp339) + (_tmp343 * _tmp343) +
+                     (_tmp347 * _tmp347) + (_tmp351 * _tmp351) + _tmp724;
     _hessian(7, 6) = _tmp335 * _tmp355 + _tmp339 * _tmp359 + _tmp343 * _tmp363 + _tmp347 * _tmp367 +
                      _tmp351 * _tmp371 + _tmp726;
     _hessian(8, 6) = _tmp335 * _tmp375 + _tmp339 * _tmp379 + _tmp343 * _tmp383 + _tmp347 * _tmp387 +
@@ -1770,9 +1765,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(4, 7) = 0;
     _hessian(5, 7) = 0;
     _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp355, Scalar(2)) + std::pow(_tmp359, Scalar(2)) +
-                     std::pow(_tmp363, Scalar(2)) + std::pow(_tmp367, Scalar(2)) +
-                     std::pow(_tmp371, Scalar(2)) + _tmp741;
+    _hessian(7, 7) = (_tmp355 * _tmp355) + (_tmp359 * _tmp359) + (_tmp363 * _tmp363) +
+                     (_tmp367 * _tmp367) + (_tmp371 * _tmp371) + _tmp741;
     _hessian(8, 7) = _tmp355 * _tmp375 + _tmp359 * _tmp379 + _tmp363 * _tmp383 + _tmp367 * _tmp387 +
                      _tmp371 * _tmp391 + _tmp742;
     _hessian(9, 7) = _tmp355 * _tmp423 + _tmp359 * _tmp425 + _tmp363 * _tmp426 + _tmp367 * _tmp427 +
@@ -1810,9 +1804,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(5, 8) = 0;
     _hessian(6, 8) = 0;
     _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp375, Scalar(2)) + std::pow(_tmp379, Scalar(2)) +
-                     std::pow(_tmp383, Scalar(2)) + std::pow(_tmp387, Scalar(2)) +
-                     std::pow(_tmp391, Scalar(2)) + _tmp753;
+    _hessian(8, 8) = (_tmp375 * _tmp375) + (_tmp379 * _tmp379) + (_tmp383 * _tmp383) +
+                     (_tmp387 * _tmp387) + (_tmp391 * _tmp391) + _tmp753;
     _hessian(9, 8) = _tmp375 * _tmp423 + _tmp379 * _tmp425 + _tmp383 * _tmp426 + _tmp387 * _tmp427 +
                      _tmp391 * _tmp429 - _tmp754;
     _hessian(10, 8) = _tmp375 * _tmp446 + _tmp379 * _tmp447 + _tmp383 * _tmp449 +
@@ -1849,10 +1842,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(6, 9) = 0;
     _hessian(7, 9) = 0;
     _hessian(8, 9) = 0;
-    _hessian(9, 9) =
-        std::pow(_tmp401, Scalar(2)) + std::pow(_tmp409, Scalar(2)) + std::pow(_tmp420, Scalar(2)) +
-        std::pow(_tmp422, Scalar(2)) + std::pow(_tmp423, Scalar(2)) + std::pow(_tmp425, Scalar(2)) +
-        std::pow(_tmp426, Scalar(2)) + std::pow(_tmp427, Scalar(2)) + std::pow(_tmp429, Scalar(2));
+    _hessian(9, 9) = (_tmp401 * _tmp401) + (_tmp409 * _tmp409) + (_tmp420 * _tmp420) +
+                     (_tmp422 * _tmp422) + (_tmp423 * _tmp423) + (_tmp425 * _tmp425) +
+                     (_tmp426 * _tmp426) + (_tmp427 * _tmp427) + (_tmp429 * _tmp429);
     _hessian(10, 9) = _tmp401 * _tmp434 + _tmp409 * _tmp437 + _tmp420 * _tmp443 +
                       _tmp422 * _tmp444 + _tmp423 * _tmp446 + _tmp425 * _tmp447 +
                       _tmp426 * _tmp449 + _tmp427 * _tmp450 + _tmp429 * _tmp451;
@@ -1893,10 +1885,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(7, 10) = 0;
     _hessian(8, 10) = 0;
     _hessian(9, 10) = 0;
-    _hessian(10, 10) =
-        std::pow(_tmp434, Scalar(2)) + std::pow(_tmp437, Scalar(2)) + std::pow(_tmp443, Scalar(2)) +
-        std::pow(_tmp444, Scalar(2)) + std::pow(_tmp446, Scalar(2)) + std::pow(_tmp447, Scalar(2)) +
-        std::pow(_tmp449, Scalar(2)) + std::pow(_tmp450, Scalar(2)) + std::pow(_tmp451, Scalar(2));
+    _hessian(10, 10) = (_tmp434 * _tmp434) + (_tmp437 * _tmp437) + (_tmp443 * _tmp443) +
+                       (_tmp444 * _tmp444) + (_tmp446 * _tmp446) + (_tmp447 * _tmp447) +
+                       (_tmp449 * _tmp449) + (_tmp450 * _tmp450) + (_tmp451 * _tmp451);
     _hessian(11, 10) = _tmp434 * _tmp455 + _tmp437 * _tmp459 + _tmp443 * _tmp462 +
                        _tmp444 * _tmp463 + _tmp446 * _tmp465 + _tmp447 * _tmp466 +
                        _tmp449 * _tmp468 + _tmp450 * _tmp469 + _tmp451 * _tmp470;
@@ -1935,10 +1926,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(8, 11) = 0;
     _hessian(9, 11) = 0;
     _hessian(10, 11) = 0;
-    _hessian(11, 11) =
-        std::pow(_tmp455, Scalar(2)) + std::pow(_tmp459, Scalar(2)) + std::pow(_tmp462, Scalar(2)) +
-        std::pow(_tmp463, Scalar(2)) + std::pow(_tmp465, Scalar(2)) + std::pow(_tmp466, Scalar(2)) +
-        std::pow(_tmp468, Scalar(2)) + std::pow(_tmp469, Scalar(2)) + std::pow(_tmp470, Scalar(2));
+    _hessian(11, 11) = (_tmp455 * _tmp455) + (_tmp459 * _tmp459) + (_tmp462 * _tmp462) +
+                       (_tmp463 * _tmp463) + (_tmp465 * _tmp465) + (_tmp466 * _tmp466) +
+                       (_tmp468 * _tmp468) + (_tmp469 * _tmp469) + (_tmp470 * _tmp470);
     _hessian(12, 11) = _tmp469 * _tmp471 + _tmp470 * _tmp472 + _tmp675;
     _hessian(13, 11) = _tmp469 * _tmp473 + _tmp470 * _tmp474 + _tmp695;
     _hessian(14, 11) = _tmp469 * _tmp475 + _tmp470 * _tmp476 + _tmp713;
@@ -1975,7 +1965,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(9, 12) = 0;
     _hessian(10, 12) = 0;
     _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp471, Scalar(2)) + std::pow(_tmp472, Scalar(2)) + _tmp666;
+    _hessian(12, 12) = (_tmp471 * _tmp471) + (_tmp472 * _tmp472) + _tmp666;
     _hessian(13, 12) = _tmp471 * _tmp473 + _tmp472 * _tmp474 + _tmp668;
     _hessian(14, 12) = _tmp471 * _tmp475 + _tmp472 * _tmp476 + _tmp669;
     _hessian(15, 12) = _tmp471 * _tmp480 + _tmp472 * _tmp481 + _tmp678;
@@ -2000,7 +1990,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(10, 13) = 0;
     _hessian(11, 13) = 0;
     _hessian(12, 13) = 0;
-    _hessian(13, 13) = std::pow(_tmp473, Scalar(2)) + std::pow(_tmp474, Scalar(2)) + _tmp688;
+    _hessian(13, 13) = (_tmp473 * _tmp473) + (_tmp474 * _tmp474) + _tmp688;
     _hessian(14, 13) = _tmp473 * _tmp475 + _tmp474 * _tmp476 + _tmp689;
     _hessian(15, 13) = _tmp473 * _tmp480 + _tmp474 * _tmp481 + _tmp697;
     _hessian(16, 13) = _tmp473 * _tmp485 + _tmp474 * _tmp486 + _tmp698;
@@ -2025,7 +2015,7 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(11, 14) = 0;
     _hessian(12, 14) = 0;
     _hessian(13, 14) = 0;
-    _hessian(14, 14) = std::pow(_tmp475, Scalar(2)) + std::pow(_tmp476, Scalar(2)) + _tmp707;
+    _hessian(14, 14) = (_tmp475 * _tmp475) + (_tmp476 * _tmp476) + _tmp707;
     _hessian(15, 14) = _tmp475 * _tmp480 + _tmp476 * _tmp481 + _tmp714;
     _hessian(16, 14) = _tmp475 * _tmp485 + _tmp476 * _tmp486 + _tmp715;
     _hessian(17, 14) = _tmp475 * _tmp490 + _tmp476 * _tmp491 + _tmp716;
@@ -2050,9 +2040,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(12, 15) = 0;
     _hessian(13, 15) = 0;
     _hessian(14, 15) = 0;
-    _hessian(15, 15) = std::pow(_tmp477, Scalar(2)) + std::pow(_tmp478, Scalar(2)) +
-                       std::pow(_tmp479, Scalar(2)) + std::pow(_tmp480, Scalar(2)) +
-                       std::pow(_tmp481, Scalar(2)) + _tmp724;
+    _hessian(15, 15) = (_tmp477 * _tmp477) + (_tmp478 * _tmp478) + (_tmp479 * _tmp479) +
+                       (_tmp480 * _tmp480) + (_tmp481 * _tmp481) + _tmp724;
     _hessian(16, 15) = _tmp477 * _tmp482 + _tmp478 * _tmp483 + _tmp479 * _tmp484 +
                        _tmp480 * _tmp485 + _tmp481 * _tmp486 + _tmp726;
     _hessian(17, 15) = _tmp477 * _tmp487 + _tmp478 * _tmp488 + _tmp479 * _tmp489 +
@@ -2085,9 +2074,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(13, 16) = 0;
     _hessian(14, 16) = 0;
     _hessian(15, 16) = 0;
-    _hessian(16, 16) = std::pow(_tmp482, Scalar(2)) + std::pow(_tmp483, Scalar(2)) +
-                       std::pow(_tmp484, Scalar(2)) + std::pow(_tmp485, Scalar(2)) +
-                       std::pow(_tmp486, Scalar(2)) + _tmp741;
+    _hessian(16, 16) = (_tmp482 * _tmp482) + (_tmp483 * _tmp483) + (_tmp484 * _tmp484) +
+                       (_tmp485 * _tmp485) + (_tmp486 * _tmp486) + _tmp741;
     _hessian(17, 16) = _tmp482 * _tmp487 + _tmp483 * _tmp488 + _tmp484 * _tmp489 +
                        _tmp485 * _tmp490 + _tmp486 * _tmp491 + _tmp742;
     _hessian(18, 16) = _tmp482 * _tmp493 + _tmp483 * _tmp494 + _tmp484 * _tmp495 +
@@ -2119,9 +2107,8 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(14, 17) = 0;
     _hessian(15, 17) = 0;
     _hessian(16, 17) = 0;
-    _hessian(17, 17) = std::pow(_tmp487, Scalar(2)) + std::pow(_tmp488, Scalar(2)) +
-                       std::pow(_tmp489, Scalar(2)) + std::pow(_tmp490, Scalar(2)) +
-                       std::pow(_tmp491, Scalar(2)) + _tmp753;
+    _hessian(17, 17) = (_tmp487 * _tmp487) + (_tmp488 * _tmp488) + (_tmp489 * _tmp489) +
+                       (_tmp490 * _tmp490) + (_tmp491 * _tmp491) + _tmp753;
     _hessian(18, 17) = _tmp487 * _tmp493 + _tmp488 * _tmp494 + _tmp489 * _tmp495 +
                        _tmp490 * _tmp496 + _tmp491 * _tmp497 - _tmp757;
     _hessian(19, 17) = _tmp487 * _tmp499 + _tmp488 * _tmp500 + _tmp489 * _tmp501 +
@@ -2152,10 +2139,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(15, 18) = 0;
     _hessian(16, 18) = 0;
     _hessian(17, 18) = 0;
-    _hessian(18, 18) = std::pow(Dv_D_accel_bias(0, 0), Scalar(2)) * _tmp723 +
-                       std::pow(_tmp493, Scalar(2)) + std::pow(_tmp494, Scalar(2)) +
-                       std::pow(_tmp495, Scalar(2)) + std::pow(_tmp496, Scalar(2)) +
-                       std::pow(_tmp497, Scalar(2));
+    _hessian(18, 18) = (Dv_D_accel_bias(0, 0) * Dv_D_accel_bias(0, 0)) * _tmp723 +
+                       (_tmp493 * _tmp493) + (_tmp494 * _tmp494) + (_tmp495 * _tmp495) +
+                       (_tmp496 * _tmp496) + (_tmp497 * _tmp497);
     _hessian(19, 18) = Dv_D_accel_bias(0, 0) * _tmp735 + _tmp493 * _tmp499 + _tmp494 * _tmp500 +
                        _tmp495 * _tmp501 + _tmp496 * _tmp502 + _tmp497 * _tmp503;
     _hessian(20, 18) = Dv_D_accel_bias(0, 0) * _tmp759 + _tmp493 * _tmp505 + _tmp494 * _tmp506 +
@@ -2185,10 +2171,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(16, 19) = 0;
     _hessian(17, 19) = 0;
     _hessian(18, 19) = 0;
-    _hessian(19, 19) = std::pow(Dv_D_accel_bias(0, 1), Scalar(2)) * _tmp723 +
-                       std::pow(_tmp499, Scalar(2)) + std::pow(_tmp500, Scalar(2)) +
-                       std::pow(_tmp501, Scalar(2)) + std::pow(_tmp502, Scalar(2)) +
-                       std::pow(_tmp503, Scalar(2));
+    _hessian(19, 19) = (Dv_D_accel_bias(0, 1) * Dv_D_accel_bias(0, 1)) * _tmp723 +
+                       (_tmp499 * _tmp499) + (_tmp500 * _tmp500) + (_tmp501 * _tmp501) +
+                       (_tmp502 * _tmp502) + (_tmp503 * _tmp503);
     _hessian(20, 19) = Dv_D_accel_bias(0, 2) * _tmp735 + _tmp499 * _tmp505 + _tmp500 * _tmp506 +
                        _tmp501 * _tmp507 + _tmp502 * _tmp508 + _tmp503 * _tmp509;
     _hessian(21, 19) = -_tmp498 * _tmp558 + _tmp499 * _tmp560 + _tmp500 * _tmp561 +
@@ -2217,10 +2202,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(17, 20) = 0;
     _hessian(18, 20) = 0;
     _hessian(19, 20) = 0;
-    _hessian(20, 20) = std::pow(Dv_D_accel_bias(0, 2), Scalar(2)) * _tmp723 +
-                       std::pow(_tmp505, Scalar(2)) + std::pow(_tmp506, Scalar(2)) +
-                       std::pow(_tmp507, Scalar(2)) + std::pow(_tmp508, Scalar(2)) +
-                       std::pow(_tmp509, Scalar(2));
+    _hessian(20, 20) = (Dv_D_accel_bias(0, 2) * Dv_D_accel_bias(0, 2)) * _tmp723 +
+                       (_tmp505 * _tmp505) + (_tmp506 * _tmp506) + (_tmp507 * _tmp507) +
+                       (_tmp508 * _tmp508) + (_tmp509 * _tmp509);
     _hessian(21, 20) = -_tmp504 * _tmp558 + _tmp505 * _tmp560 + _tmp506 * _tmp561 +
                        _tmp507 * _tmp563 + _tmp508 * _tmp564 + _tmp509 * _tmp565;
     _hessian(22, 20) = -_tmp504 * _tmp599 + _tmp505 * _tmp601 + _tmp506 * _tmp602 +
@@ -2248,10 +2232,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(18, 21) = 0;
     _hessian(19, 21) = 0;
     _hessian(20, 21) = 0;
-    _hessian(21, 21) =
-        std::pow(_tmp549, Scalar(2)) + std::pow(_tmp552, Scalar(2)) + std::pow(_tmp557, Scalar(2)) +
-        std::pow(_tmp558, Scalar(2)) + std::pow(_tmp560, Scalar(2)) + std::pow(_tmp561, Scalar(2)) +
-        std::pow(_tmp563, Scalar(2)) + std::pow(_tmp564, Scalar(2)) + std::pow(_tmp565, Scalar(2));
+    _hessian(21, 21) = (_tmp549 * _tmp549) + (_tmp552 * _tmp552) + (_tmp557 * _tmp557) +
+                       (_tmp558 * _tmp558) + (_tmp560 * _tmp560) + (_tmp561 * _tmp561) +
+                       (_tmp563 * _tmp563) + (_tmp564 * _tmp564) + (_tmp565 * _tmp565);
     _hessian(22, 21) = _tmp549 * _tmp589 + _tmp552 * _tmp592 + _tmp557 * _tmp598 +
                        _tmp558 * _tmp599 + _tmp560 * _tmp601 + _tmp561 * _tmp602 +
                        _tmp563 * _tmp604 + _tmp564 * _tmp605 + _tmp565 * _tmp606;
@@ -2280,10 +2263,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(19, 22) = 0;
     _hessian(20, 22) = 0;
     _hessian(21, 22) = 0;
-    _hessian(22, 22) =
-        std::pow(_tmp589, Scalar(2)) + std::pow(_tmp592, Scalar(2)) + std::pow(_tmp598, Scalar(2)) +
-        std::pow(_tmp599, Scalar(2)) + std::pow(_tmp601, Scalar(2)) + std::pow(_tmp602, Scalar(2)) +
-        std::pow(_tmp604, Scalar(2)) + std::pow(_tmp605, Scalar(2)) + std::pow(_tmp606, Scalar(2));
+    _hessian(22, 22) = (_tmp589 * _tmp589) + (_tmp592 * _tmp592) + (_tmp598 * _tmp598) +
+                       (_tmp599 * _tmp599) + (_tmp601 * _tmp601) + (_tmp602 * _tmp602) +
+                       (_tmp604 * _tmp604) + (_tmp605 * _tmp605) + (_tmp606 * _tmp606);
     _hessian(23, 22) = _tmp589 * _tmp628 + _tmp592 * _tmp631 + _tmp598 * _tmp637 +
                        _tmp599 * _tmp638 + _tmp601 * _tmp640 + _tmp602 * _tmp641 +
                        _tmp604 * _tmp643 + _tmp605 * _tmp644 + _tmp606 * _tmp645;
@@ -2310,10 +2292,9 @@ void InternalImuFactor(const sym::Pose3<Scalar>& pose_i, const Eigen::Matrix<Sca
     _hessian(20, 23) = 0;
     _hessian(21, 23) = 0;
     _hessian(22, 23) = 0;
-    _hessian(23, 23) =
-        std::pow(_tmp628, Scalar(2)) + std::pow(_tmp631, Scalar(2)) + std::pow(_tmp637, Scalar(2)) +
-        std::pow(_tmp638, Scalar(2)) + std::pow(_tmp640, Scalar(2)) + std::pow(_tmp641, Scalar(2)) +
-        std::pow(_tmp643, Scalar(2)) + std::pow(_tmp644, Scalar(2)) + std::pow(_tmp645, Scalar(2));
+    _hessian(23, 23) = (_tmp628 * _tmp628) + (_tmp631 * _tmp631) + (_tmp637 * _tmp637) +
+                       (_tmp638 * _tmp638) + (_tmp640 * _tmp640) + (_tmp641 * _tmp641) +
+                       (_tmp643 * _tmp643) + (_tmp644 * _tmp644) + (_tmp645 * _tmp645);
   }
 
   if (rhs != nullptr) {
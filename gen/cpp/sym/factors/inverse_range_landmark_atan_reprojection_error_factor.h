@@ -45,7 +45,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -82,21 +83,20 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp11 = -source_calibration_storage(3, 0) + source_pixel(1, 0);
   const Scalar _tmp12 = _tmp11 / source_calibration_storage(1, 0);
   const Scalar _tmp13 =
-      std::pow(_tmp11, Scalar(2)) / std::pow(source_calibration_storage(1, 0), Scalar(2));
+      (_tmp11 * _tmp11) / (source_calibration_storage(1, 0) * source_calibration_storage(1, 0));
   const Scalar _tmp14 = Scalar(0.5) * source_calibration_storage(4, 0);
   const Scalar _tmp15 = std::tan(_tmp14);
   const Scalar _tmp16 = -source_calibration_storage(2, 0) + source_pixel(0, 0);
   const Scalar _tmp17 =
-      std::pow(_tmp16, Scalar(2)) / std::pow(source_calibration_storage(0, 0), Scalar(2));
+      (_tmp16 * _tmp16) / (source_calibration_storage(0, 0) * source_calibration_storage(0, 0));
   const Scalar _tmp18 = _tmp13 + _tmp17 + epsilon;
   const Scalar _tmp19 = std::sqrt(_tmp18);
   const Scalar _tmp20 = _tmp19 * source_calibration_storage(4, 0);
   const Scalar _tmp21 = std::tan(_tmp20);
-  const Scalar _tmp22 = (Scalar(1) / Scalar(4)) * std::pow(_tmp21, Scalar(2)) / _tmp18;
-  const Scalar _tmp23 = _tmp22 / std::pow(_tmp15, Scalar(2));
+  const Scalar _tmp22 = (Scalar(1) / Scalar(4)) * (_tmp21 * _tmp21) / _tmp18;
+  const Scalar _tmp23 = _tmp22 / (_tmp15 * _tmp15);
   const Scalar _tmp24 = epsilon + 1;
-  const Scalar _tmp25 =
-      std::pow(Scalar(_tmp13 * _tmp23 + _tmp17 * _tmp23 + _tmp24), Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp25 = Scalar(1.0) / std::sqrt(Scalar(_tmp13 * _tmp23 + _tmp17 * _tmp23 + _tmp24));
   const Scalar _tmp26 = (Scalar(1) / Scalar(2)) * _tmp21 / _tmp19;
   const Scalar _tmp27 = _tmp25 * _tmp26 / _tmp15;
   const Scalar _tmp28 = _tmp12 * _tmp27;
@@ -108,16 +108,16 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp34 = _tmp31 + _tmp33;
   const Scalar _tmp35 = _tmp16 / source_calibration_storage(0, 0);
   const Scalar _tmp36 = _tmp27 * _tmp35;
-  const Scalar _tmp37 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp37 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp38 = -2 * _tmp37;
-  const Scalar _tmp39 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp39 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp40 = 1 - 2 * _tmp39;
   const Scalar _tmp41 = _tmp38 + _tmp40;
   const Scalar _tmp42 = _tmp10 * _tmp28 + _tmp25 * _tmp41 + _tmp30 + _tmp34 * _tmp36;
   const Scalar _tmp43 = _target_pose[2] * _tmp2;
   const Scalar _tmp44 = 2 * _target_pose[0] * _target_pose[1];
   const Scalar _tmp45 = _tmp43 + _tmp44;
-  const Scalar _tmp46 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp46 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp47 = -2 * _tmp46;
   const Scalar _tmp48 = _tmp38 + _tmp47 + 1;
   const Scalar _tmp49 = _source_pose[1] * _tmp6;
@@ -128,9 +128,9 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp54 = -_tmp7;
   const Scalar _tmp55 = _tmp54 + _tmp9;
   const Scalar _tmp56 = _tmp25 * _tmp55 + _tmp28 * _tmp48 + _tmp36 * _tmp51 + _tmp53;
-  const Scalar _tmp57 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp57 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp58 = -2 * _tmp57;
-  const Scalar _tmp59 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp59 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp60 = 1 - 2 * _tmp59;
   const Scalar _tmp61 = _tmp58 + _tmp60;
   const Scalar _tmp62 = _tmp40 + _tmp47;
@@ -143,7 +143,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp69 = _tmp42 * _tmp5 + _tmp45 * _tmp56 + _tmp61 * _tmp68;
   const Scalar _tmp70 = Scalar(1.0) / (target_calibration_storage(4, 0));
   const Scalar _tmp71 = _tmp70 * target_calibration_storage(0, 0);
-  const Scalar _tmp72 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp72 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp73 = -2 * _tmp72;
   const Scalar _tmp74 = _tmp60 + _tmp73;
   const Scalar _tmp75 = _target_pose[1] * _tmp0;
@@ -153,14 +153,14 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp79 = _tmp1 + _tmp3;
   const Scalar _tmp80 = _tmp42 * _tmp74 + _tmp56 * _tmp78 + _tmp68 * _tmp79;
   const Scalar _tmp81 = std::max<Scalar>(_tmp80, epsilon);
-  const Scalar _tmp82 = std::pow(_tmp81, Scalar(-2));
+  const Scalar _tmp82 = Scalar(1.0) / (_tmp81 * _tmp81);
   const Scalar _tmp83 = _tmp75 + _tmp76;
   const Scalar _tmp84 = _tmp58 + _tmp73 + 1;
   const Scalar _tmp85 = -_tmp43;
   const Scalar _tmp86 = _tmp44 + _tmp85;
   const Scalar _tmp87 = _tmp42 * _tmp83 + _tmp56 * _tmp84 + _tmp68 * _tmp86;
-  const Scalar _tmp88 = std::sqrt(Scalar(std::pow(_tmp69, Scalar(2)) * _tmp82 +
-                                         _tmp82 * std::pow(_tmp87, Scalar(2)) + epsilon));
+  const Scalar _tmp88 =
+      std::sqrt(Scalar((_tmp69 * _tmp69) * _tmp82 + _tmp82 * (_tmp87 * _tmp87) + epsilon));
   const Scalar _tmp89 = Scalar(0.5) * target_calibration_storage(4, 0);
   const Scalar _tmp90 = std::atan(2 * _tmp88 * std::tan(_tmp89)) / (_tmp81 * _tmp88);
   const Scalar _tmp91 = target_calibration_storage(2, 0) - target_pixel(0, 0);
@@ -168,10 +168,10 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp93 = _tmp70 * target_calibration_storage(1, 0);
   const Scalar _tmp94 = target_calibration_storage(3, 0) - target_pixel(1, 0);
   const Scalar _tmp95 = _tmp87 * _tmp90 * _tmp93 + _tmp94;
-  const Scalar _tmp96 = std::pow(_tmp92, Scalar(2)) + std::pow(_tmp95, Scalar(2)) + epsilon;
+  const Scalar _tmp96 = (_tmp92 * _tmp92) + (_tmp95 * _tmp95) + epsilon;
   const Scalar _tmp97 = Scalar(1.0) / (_tmp24 - gnc_mu);
   const Scalar _tmp98 = epsilon + std::fabs(_tmp97);
-  const Scalar _tmp99 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp99 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp100 = _tmp99 / _tmp98;
   const Scalar _tmp101 = 2 - _tmp97;
   const Scalar _tmp102 =
@@ -187,9 +187,9 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp107 = _tmp106 * _tmp92;
   const Scalar _tmp108 = _tmp106 * _tmp95;
   const Scalar _tmp109 = std::tan(_tmp14);
-  const Scalar _tmp110 = _tmp22 / std::pow(_tmp109, Scalar(2));
-  const Scalar _tmp111 = std::pow(Scalar(_tmp110 * _tmp13 + _tmp110 * _tmp17 + _tmp24),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp110 = _tmp22 / (_tmp109 * _tmp109);
+  const Scalar _tmp111 =
+      Scalar(1.0) / std::sqrt(Scalar(_tmp110 * _tmp13 + _tmp110 * _tmp17 + _tmp24));
   const Scalar _tmp112 = _tmp26 / _tmp109;
   const Scalar _tmp113 = _tmp111 * _tmp112;
   const Scalar _tmp114 = _tmp113 * _tmp12;
@@ -204,11 +204,11 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp123 = _tmp114 * _tmp48 + _tmp119 * _tmp121 + _tmp122 + _tmp53;
   const Scalar _tmp124 = _tmp120 * _tmp5 + _tmp123 * _tmp45;
   const Scalar _tmp125 = _tmp117 * _tmp61 + _tmp124;
-  const Scalar _tmp126 = std::pow(_tmp125, Scalar(2));
+  const Scalar _tmp126 = (_tmp125 * _tmp125);
   const Scalar _tmp127 = -_tmp9;
   const Scalar _tmp128 = -_tmp39;
   const Scalar _tmp129 = _tmp128 + _tmp46;
-  const Scalar _tmp130 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp130 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp131 = -_tmp37;
   const Scalar _tmp132 = _tmp130 + _tmp131;
   const Scalar _tmp133 = _tmp111 * (_tmp127 + _tmp54) + _tmp114 * (_tmp129 + _tmp132);
@@ -223,16 +223,13 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp142 = _tmp120 * _tmp74 + _tmp141;
   const Scalar _tmp143 = (((_tmp142 - epsilon) > 0) - ((_tmp142 - epsilon) < 0)) + 1;
   const Scalar _tmp144 = std::max<Scalar>(_tmp142, epsilon);
-  const Scalar _tmp145 = _tmp143 / [&]() {
-    const Scalar base = _tmp144;
-    return base * base * base;
-  }();
+  const Scalar _tmp145 = _tmp143 / (_tmp144 * _tmp144 * _tmp144);
   const Scalar _tmp146 = _tmp140 * _tmp145;
   const Scalar _tmp147 = _tmp117 * _tmp86 + _tmp120 * _tmp83;
   const Scalar _tmp148 = _tmp123 * _tmp84 + _tmp147;
-  const Scalar _tmp149 = std::pow(_tmp148, Scalar(2));
+  const Scalar _tmp149 = (_tmp148 * _tmp148);
   const Scalar _tmp150 = _tmp133 * _tmp5 + _tmp137 * _tmp45 + _tmp139 * _tmp61;
-  const Scalar _tmp151 = std::pow(_tmp144, Scalar(-2));
+  const Scalar _tmp151 = Scalar(1.0) / (_tmp144 * _tmp144);
   const Scalar _tmp152 = 2 * _tmp151;
   const Scalar _tmp153 = _tmp125 * _tmp152;
   const Scalar _tmp154 = _tmp133 * _tmp83 + _tmp137 * _tmp84 + _tmp139 * _tmp86;
@@ -253,16 +250,15 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp168 = _tmp167 * _tmp71;
   const Scalar _tmp169 = (Scalar(1) / Scalar(2)) * _tmp143 * _tmp151 * _tmp162 * _tmp166;
   const Scalar _tmp170 = _tmp157 * _tmp169;
-  const Scalar _tmp171 =
-      _tmp159 * _tmp160 / (_tmp158 * (4 * _tmp158 * std::pow(_tmp160, Scalar(2)) + 1));
+  const Scalar _tmp171 = _tmp159 * _tmp160 / (_tmp158 * (4 * _tmp158 * (_tmp160 * _tmp160) + 1));
   const Scalar _tmp172 = _tmp157 * _tmp171;
   const Scalar _tmp173 =
       -_tmp140 * _tmp170 + _tmp150 * _tmp168 - _tmp156 * _tmp165 + _tmp156 * _tmp172;
   const Scalar _tmp174 = _tmp148 * _tmp93;
   const Scalar _tmp175 = _tmp167 * _tmp174 + _tmp94;
   const Scalar _tmp176 = _tmp125 * _tmp168 + _tmp91;
-  const Scalar _tmp177 = std::pow(_tmp175, Scalar(2)) + std::pow(_tmp176, Scalar(2)) + epsilon;
-  const Scalar _tmp178 = std::pow(_tmp177, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp177 = (_tmp175 * _tmp175) + (_tmp176 * _tmp176) + epsilon;
+  const Scalar _tmp178 = Scalar(1.0) / std::sqrt(_tmp177);
   const Scalar _tmp179 = _tmp100 * _tmp177 + 1;
   const Scalar _tmp180 = std::sqrt(Scalar(_tmp104 * (std::pow(_tmp179, _tmp103) - 1)));
   const Scalar _tmp181 = std::max<Scalar>(0, (((_tmp142) > 0) - ((_tmp142) < 0)));
@@ -378,7 +374,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   const Scalar _tmp282 = _tmp183 * _tmp276 + _tmp199 * _tmp280 - _tmp200 * _tmp280;
   const Scalar _tmp283 = -_tmp44;
   const Scalar _tmp284 = -_tmp75;
-  const Scalar _tmp285 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp285 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp286 = -_tmp285;
   const Scalar _tmp287 = _tmp286 + _tmp72;
   const Scalar _tmp288 = -_tmp59;
@@ -495,7 +491,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp197, Scalar(2)) + std::pow(_tmp201, Scalar(2));
+    _hessian(0, 0) = (_tmp197 * _tmp197) + (_tmp201 * _tmp201);
     _hessian(1, 0) = _tmp197 * _tmp217 + _tmp201 * _tmp218;
     _hessian(2, 0) = _tmp197 * _tmp229 + _tmp201 * _tmp230;
     _hessian(3, 0) = _tmp197 * _tmp250 + _tmp201 * _tmp251;
@@ -508,8 +504,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 0) = _tmp197 * _tmp334 + _tmp201 * _tmp335;
     _hessian(11, 0) = _tmp197 * _tmp340 + _tmp201 * _tmp341;
     _hessian(12, 0) = _tmp197 * _tmp349 + _tmp201 * _tmp350;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp217, Scalar(2)) + std::pow(_tmp218, Scalar(2));
+    _hessian(1, 1) = (_tmp217 * _tmp217) + (_tmp218 * _tmp218);
     _hessian(2, 1) = _tmp217 * _tmp229 + _tmp218 * _tmp230;
     _hessian(3, 1) = _tmp217 * _tmp250 + _tmp218 * _tmp251;
     _hessian(4, 1) = _tmp217 * _tmp266 + _tmp218 * _tmp267;
@@ -521,9 +516,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 1) = _tmp217 * _tmp334 + _tmp218 * _tmp335;
     _hessian(11, 1) = _tmp217 * _tmp340 + _tmp218 * _tmp341;
     _hessian(12, 1) = _tmp217 * _tmp349 + _tmp218 * _tmp350;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp229, Scalar(2)) + std::pow(_tmp230, Scalar(2));
+    _hessian(2, 2) = (_tmp229 * _tmp229) + (_tmp230 * _tmp230);
     _hessian(3, 2) = _tmp229 * _tmp250 + _tmp230 * _tmp251;
     _hessian(4, 2) = _tmp229 * _tmp266 + _tmp230 * _tmp267;
     _hessian(5, 2) = _tmp229 * _tmp281 + _tmp230 * _tmp282;
@@ -534,10 +527,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 2) = _tmp229 * _tmp334 + _tmp230 * _tmp335;
     _hessian(11, 2) = _tmp229 * _tmp340 + _tmp230 * _tmp341;
     _hessian(12, 2) = _tmp229 * _tmp349 + _tmp230 * _tmp350;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp250, Scalar(2)) + std::pow(_tmp251, Scalar(2));
+    _hessian(3, 3) = (_tmp250 * _tmp250) + (_tmp251 * _tmp251);
     _hessian(4, 3) = _tmp250 * _tmp266 + _tmp251 * _tmp267;
     _hessian(5, 3) = _tmp250 * _tmp281 + _tmp251 * _tmp282;
     _hessian(6, 3) = _tmp250 * _tmp299 + _tmp251 * _tmp300;
@@ -547,11 +537,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 3) = _tmp250 * _tmp334 + _tmp251 * _tmp335;
     _hessian(11, 3) = _tmp250 * _tmp340 + _tmp251 * _tmp341;
     _hessian(12, 3) = _tmp250 * _tmp349 + _tmp251 * _tmp350;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp266, Scalar(2)) + std::pow(_tmp267, Scalar(2));
+    _hessian(4, 4) = (_tmp266 * _tmp266) + (_tmp267 * _tmp267);
     _hessian(5, 4) = _tmp266 * _tmp281 + _tmp267 * _tmp282;
     _hessian(6, 4) = _tmp266 * _tmp299 + _tmp267 * _tmp300;
     _hessian(7, 4) = _tmp266 * _tmp311 + _tmp267 * _tmp312;
@@ -560,12 +546,7 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 4) = _tmp266 * _tmp334 + _tmp267 * _tmp335;
     _hessian(11, 4) = _tmp266 * _tmp340 + _tmp267 * _tmp341;
     _hessian(12, 4) = _tmp266 * _tmp349 + _tmp267 * _tmp350;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp281, Scalar(2)) + std::pow(_tmp282, Scalar(2));
+    _hessian(5, 5) = (_tmp281 * _tmp281) + (_tmp282 * _tmp282);
     _hessian(6, 5) = _tmp281 * _tmp299 + _tmp282 * _tmp300;
     _hessian(7, 5) = _tmp281 * _tmp311 + _tmp282 * _tmp312;
     _hessian(8, 5) = _tmp281 * _tmp320 + _tmp282 * _tmp321;
@@ -573,97 +554,34 @@ void InverseRangeLandmarkAtanReprojectionErrorFactor(
     _hessian(10, 5) = _tmp281 * _tmp334 + _tmp282 * _tmp335;
     _hessian(11, 5) = _tmp281 * _tmp340 + _tmp282 * _tmp341;
     _hessian(12, 5) = _tmp281 * _tmp349 + _tmp282 * _tmp350;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp299, Scalar(2)) + std::pow(_tmp300, Scalar(2));
+    _hessian(6, 6) = (_tmp299 * _tmp299) + (_tmp300 * _tmp300);
     _hessian(7, 6) = _tmp299 * _tmp311 + _tmp300 * _tmp312;
     _hessian(8, 6) = _tmp299 * _tmp320 + _tmp300 * _tmp321;
     _hessian(9, 6) = _tmp299 * _tmp326 + _tmp300 * _tmp327;
     _hessian(10, 6) = _tmp299 * _tmp334 + _tmp300 * _tmp335;
     _hessian(11, 6) = _tmp299 * _tmp340 + _tmp300 * _tmp341;
     _hessian(12, 6) = _tmp299 * _tmp349 + _tmp300 * _tmp350;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp311, Scalar(2)) + std::pow(_tmp312, Scalar(2));
+    _hessian(7, 7) = (_tmp311 * _tmp311) + (_tmp312 * _tmp312);
     _hessian(8, 7) = _tmp311 * _tmp320 + _tmp312 * _tmp321;
     _hessian(9, 7) = _tmp311 * _tmp326 + _tmp312 * _tmp327;
     _hessian(10, 7) = _tmp311 * _tmp334 + _tmp312 * _tmp335;
     _hessian(11, 7) = _tmp311 * _tmp340 + _tmp312 * _tmp341;
     _hessian(12, 7) = _tmp311 * _tmp349 + _tmp312 * _tmp350;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp320, Scalar(2)) + std::pow(_tmp321, Scalar(2));
+    _hessian(8, 8) = (_tmp320 * _tmp320) + (_tmp321 * _tmp321);
     _hessian(9, 8) = _tmp320 * _tmp326 + _tmp321 * _tmp327;
     _hessian(10, 8) = _tmp320 * _tmp334 + _tmp321 * _tmp335;
     _hessian(11, 8) = _tmp320 * _tmp340 + _tmp321 * _tmp341;
     _hessian(12, 8) = _tmp320 * _tmp349 + _tmp321 * _tmp350;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp326, Scalar(2)) + std::pow(_tmp327, Scalar(2));
+    _hessian(9, 9) = (_tmp326 * _tmp326) + (_tmp327 * _tmp327);
     _hessian(10, 9) = _tmp326 * _tmp334 + _tmp327 * _tmp335;
     _hessian(11, 9) = _tmp326 * _tmp340 + _tmp327 * _tmp341;
     _hessian(12, 9) = _tmp326 * _tmp349 + _tmp327 * _tmp350;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp334, Scalar(2)) + std::pow(_tmp335, Scalar(2));
+    _hessian(10, 10) = (_tmp334 * _tmp334) + (_tmp335 * _tmp335);
     _hessian(11, 10) = _tmp334 * _tmp340 + _tmp335 * _tmp341;
     _hessian(12, 10) = _tmp334 * _tmp349 + _tmp335 * _tmp350;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp340, Scalar(2)) + std::pow(_tmp341, Scalar(2));
+    _hessian(11, 11) = (_tmp340 * _tmp340) + (_tmp341 * _tmp341);
     _hessian(12, 11) = _tmp340 * _tmp349 + _tmp341 * _tmp350;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp349, Scalar(2)) + std::pow(_tmp350, Scalar(2));
+    _hessian(12, 12) = (_tmp349 * _tmp349) + (_tmp350 * _tmp350);
   }
 
   if (rhs != nullptr) {
@@ -45,7 +45,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -68,9 +69,9 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Eigen::Matrix<Scalar, 7, 1>& _target_pose = target_pose.Data();
 
   // Intermediate terms (320)
-  const Scalar _tmp0 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp0 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp1 = -2 * _tmp0;
-  const Scalar _tmp2 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp2 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp3 = -2 * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3 + 1;
   const Scalar _tmp5 = 2 * _source_pose[1];
@@ -81,12 +82,13 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp10 = _tmp6 + _tmp9;
   const Scalar _tmp11 = -source_calibration_storage(3, 0) + source_pixel(1, 0);
   const Scalar _tmp12 =
-      std::pow(_tmp11, Scalar(2)) / std::pow(source_calibration_storage(1, 0), Scalar(2));
+      (_tmp11 * _tmp11) / (source_calibration_storage(1, 0) * source_calibration_storage(1, 0));
   const Scalar _tmp13 = -source_calibration_storage(2, 0) + source_pixel(0, 0);
   const Scalar _tmp14 =
-      std::pow(_tmp13, Scalar(2)) / std::pow(source_calibration_storage(0, 0), Scalar(2));
+      (_tmp13 * _tmp13) / (source_calibration_storage(0, 0) * source_calibration_storage(0, 0));
   const Scalar _tmp15 = _tmp12 + _tmp14;
-  const Scalar _tmp16 = -_tmp15 * std::pow(source_calibration_storage(5, 0), Scalar(2)) + 1;
+  const Scalar _tmp16 =
+      -_tmp15 * (source_calibration_storage(5, 0) * source_calibration_storage(5, 0)) + 1;
   const Scalar _tmp17 = -_tmp15 * (2 * source_calibration_storage(5, 0) - 1) + 1;
   const Scalar _tmp18 =
       source_calibration_storage(5, 0) * std::sqrt(Scalar(std::max<Scalar>(_tmp17, epsilon))) -
@@ -94,29 +96,29 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp19 =
       _tmp18 + epsilon * (2 * std::min<Scalar>(0, (((_tmp18) > 0) - ((_tmp18) < 0))) + 1);
   const Scalar _tmp20 = _tmp16 / _tmp19;
-  const Scalar _tmp21 = std::pow(_tmp16, Scalar(2)) / std::pow(_tmp19, Scalar(2));
+  const Scalar _tmp21 = (_tmp16 * _tmp16) / (_tmp19 * _tmp19);
   const Scalar _tmp22 = _tmp15 + _tmp21;
   const Scalar _tmp23 =
       _tmp22 + epsilon * (2 * std::min<Scalar>(0, (((_tmp22) > 0) - ((_tmp22) < 0))) + 1);
   const Scalar _tmp24 =
-      _tmp15 * (1 - std::pow(source_calibration_storage(4, 0), Scalar(2))) + _tmp21;
+      _tmp15 * (1 - (source_calibration_storage(4, 0) * source_calibration_storage(4, 0))) + _tmp21;
   const Scalar _tmp25 = _tmp20 * source_calibration_storage(4, 0) +
                         std::sqrt(Scalar(std::max<Scalar>(_tmp24, epsilon)));
   const Scalar _tmp26 = _tmp25 / _tmp23;
   const Scalar _tmp27 = _tmp20 * _tmp26 - source_calibration_storage(4, 0);
-  const Scalar _tmp28 = std::pow(_tmp25, Scalar(2)) / std::pow(_tmp23, Scalar(2));
+  const Scalar _tmp28 = (_tmp25 * _tmp25) / (_tmp23 * _tmp23);
   const Scalar _tmp29 =
-      std::pow(Scalar(_tmp12 * _tmp28 + _tmp14 * _tmp28 + std::pow(_tmp27, Scalar(2)) + epsilon),
-               Scalar(Scalar(-1) / Scalar(2)));
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp12 * _tmp28 + _tmp14 * _tmp28 + (_tmp27 * _tmp27) + epsilon));
   const Scalar _tmp30 = _tmp26 * _tmp29;
   const Scalar _tmp31 = _tmp11 * _tmp30 / source_calibration_storage(1, 0);
   const Scalar _tmp32 = 2 * _source_pose[0] * _source_pose[2];
   const Scalar _tmp33 = _source_pose[1] * _tmp7;
   const Scalar _tmp34 = _tmp32 + _tmp33;
   const Scalar _tmp35 = _tmp27 * _tmp29;
-  const Scalar _tmp36 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp36 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp37 = -2 * _tmp36;
-  const Scalar _tmp38 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp38 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp39 = 1 - 2 * _tmp38;
   const Scalar _tmp40 = _tmp13 * _tmp30 / source_calibration_storage(0, 0);
   const Scalar _tmp41 = _source_pose[4] - _target_pose[4];
@@ -131,7 +133,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp49 = _source_pose[2] * _tmp5;
   const Scalar _tmp50 = _tmp48 + _tmp49;
   const Scalar _tmp51 = _tmp6 + _tmp8;
-  const Scalar _tmp52 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp52 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp53 = -2 * _tmp52;
   const Scalar _tmp54 = _source_pose[5] - _target_pose[5];
   const Scalar _tmp55 = _tmp31 * (_tmp39 + _tmp53) + _tmp35 * _tmp50 + _tmp40 * _tmp51 +
@@ -154,7 +156,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
                            ((target_calibration_storage(5, 0) + Scalar(-0.5)) < 0)));
   const Scalar _tmp69 = 2 * _tmp68;
   const Scalar _tmp70 = -epsilon * (_tmp69 + 1) + target_calibration_storage(5, 0);
-  const Scalar _tmp71 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp71 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp72 = 1 - 2 * _tmp71;
   const Scalar _tmp73 = _tmp1 + _tmp72;
   const Scalar _tmp74 = _target_pose[2] * _tmp44;
@@ -170,11 +172,10 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp84 = _tmp74 + _tmp75;
   const Scalar _tmp85 = _tmp42 * _tmp83 + _tmp65 * _tmp84;
   const Scalar _tmp86 = _tmp55 * _tmp81 + _tmp85;
-  const Scalar _tmp87 =
-      std::pow(_tmp67, Scalar(2)) + std::pow(_tmp86, Scalar(2)) + std::pow(epsilon, Scalar(2));
-  const Scalar _tmp88 = std::sqrt(Scalar(std::pow(_tmp80, Scalar(2)) + _tmp87));
+  const Scalar _tmp87 = (_tmp67 * _tmp67) + (_tmp86 * _tmp86) + (epsilon * epsilon);
+  const Scalar _tmp88 = std::sqrt(Scalar((_tmp80 * _tmp80) + _tmp87));
   const Scalar _tmp89 = _tmp80 + _tmp88 * target_calibration_storage(4, 0);
-  const Scalar _tmp90 = std::sqrt(Scalar(_tmp87 + std::pow(_tmp89, Scalar(2))));
+  const Scalar _tmp90 = std::sqrt(Scalar(_tmp87 + (_tmp89 * _tmp89)));
   const Scalar _tmp91 = -_tmp70;
   const Scalar _tmp92 = _tmp91 + 1;
   const Scalar _tmp93 = _tmp70 * _tmp90 + _tmp89 * _tmp92;
@@ -184,15 +185,15 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp97 = _tmp67 * _tmp96 + target_calibration_storage(2, 0) - target_pixel(0, 0);
   const Scalar _tmp98 = _tmp95 * target_calibration_storage(1, 0);
   const Scalar _tmp99 = _tmp86 * _tmp98 + target_calibration_storage(3, 0) - target_pixel(1, 0);
-  const Scalar _tmp100 = std::pow(_tmp97, Scalar(2)) + std::pow(_tmp99, Scalar(2)) + epsilon;
-  const Scalar _tmp101 = std::pow(_tmp100, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp100 = (_tmp97 * _tmp97) + (_tmp99 * _tmp99) + epsilon;
+  const Scalar _tmp101 = Scalar(1.0) / std::sqrt(_tmp100);
   const Scalar _tmp102 = std::sqrt(weight);
   const Scalar _tmp103 = Scalar(1.0) / (epsilon - gnc_mu + 1);
   const Scalar _tmp104 = epsilon + std::fabs(_tmp103);
   const Scalar _tmp105 = 2 - _tmp103;
   const Scalar _tmp106 =
       _tmp105 + epsilon * (2 * std::min<Scalar>(0, (((_tmp105) > 0) - ((_tmp105) < 0))) + 1);
-  const Scalar _tmp107 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp107 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp108 = _tmp100 * _tmp107 / _tmp104 + 1;
   const Scalar _tmp109 = (Scalar(1) / Scalar(2)) * _tmp106;
   const Scalar _tmp110 = std::sqrt(Scalar(2)) *
@@ -201,9 +202,9 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
       std::min<Scalar>(1 - std::max<Scalar>(0, -(((_tmp17) > 0) - ((_tmp17) < 0))),
                        1 - std::max<Scalar>(0, -(((_tmp24) > 0) - ((_tmp24) < 0))));
   const Scalar _tmp112 = (Scalar(1) / Scalar(2)) * _tmp69 + _tmp91 + 1;
-  const Scalar _tmp113 = std::pow(target_calibration_storage(4, 0), Scalar(2));
+  const Scalar _tmp113 = (target_calibration_storage(4, 0) * target_calibration_storage(4, 0));
   const Scalar _tmp114 = _tmp68 + _tmp70;
-  const Scalar _tmp115 = std::pow(_tmp112, Scalar(2)) / std::pow(_tmp114, Scalar(2));
+  const Scalar _tmp115 = (_tmp112 * _tmp112) / (_tmp114 * _tmp114);
   const Scalar _tmp116 = _tmp113 * _tmp115 - _tmp113 + 1;
   const Scalar _tmp117 = std::max<Scalar>(
       0, std::min<Scalar>(
@@ -234,7 +235,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp121 = _tmp119 * _tmp99;
   const Scalar _tmp122 = -_tmp6;
   const Scalar _tmp123 = _tmp31 * _tmp34 + _tmp35 * (_tmp122 + _tmp8);
-  const Scalar _tmp124 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp124 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp125 = -_tmp36;
   const Scalar _tmp126 = _tmp124 + _tmp125;
   const Scalar _tmp127 = -_tmp52;
@@ -257,7 +258,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp144 = 2 * _tmp89;
   const Scalar _tmp145 = (Scalar(1) / Scalar(2)) * _tmp70 / _tmp90;
   const Scalar _tmp146 =
-      ((((_tmp93 - epsilon) > 0) - ((_tmp93 - epsilon) < 0)) + 1) / std::pow(_tmp94, Scalar(2));
+      ((((_tmp93 - epsilon) > 0) - ((_tmp93 - epsilon) < 0)) + 1) / (_tmp94 * _tmp94);
   const Scalar _tmp147 = (Scalar(1) / Scalar(2)) * _tmp146;
   const Scalar _tmp148 = _tmp147 * (_tmp143 * _tmp92 + _tmp145 * (_tmp140 + _tmp143 * _tmp144));
   const Scalar _tmp149 = _tmp133 * _tmp98 - _tmp134 * _tmp148;
@@ -359,7 +360,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   const Scalar _tmp243 = _tmp150 * _tmp240 + _tmp153 * _tmp242;
   const Scalar _tmp244 = _tmp119 * _tmp242 + _tmp182 * _tmp243 - _tmp183 * _tmp243;
   const Scalar _tmp245 = _tmp119 * _tmp240 - _tmp161 * _tmp243 + _tmp162 * _tmp243;
-  const Scalar _tmp246 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp246 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp247 = -_tmp246;
   const Scalar _tmp248 = _tmp247 + _tmp71;
   const Scalar _tmp249 = -_tmp0;
@@ -480,7 +481,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp159, Scalar(2)) + std::pow(_tmp163, Scalar(2));
+    _hessian(0, 0) = (_tmp159 * _tmp159) + (_tmp163 * _tmp163);
     _hessian(1, 0) = _tmp159 * _tmp184 + _tmp163 * _tmp185;
     _hessian(2, 0) = _tmp159 * _tmp198 + _tmp163 * _tmp199;
     _hessian(3, 0) = _tmp159 * _tmp216 + _tmp163 * _tmp217;
@@ -493,8 +494,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 0) = _tmp159 * _tmp299 + _tmp163 * _tmp300;
     _hessian(11, 0) = _tmp159 * _tmp307 + _tmp163 * _tmp308;
     _hessian(12, 0) = _tmp159 * _tmp318 + _tmp163 * _tmp319;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp184, Scalar(2)) + std::pow(_tmp185, Scalar(2));
+    _hessian(1, 1) = (_tmp184 * _tmp184) + (_tmp185 * _tmp185);
     _hessian(2, 1) = _tmp184 * _tmp198 + _tmp185 * _tmp199;
     _hessian(3, 1) = _tmp184 * _tmp216 + _tmp185 * _tmp217;
     _hessian(4, 1) = _tmp184 * _tmp230 + _tmp185 * _tmp231;
@@ -506,9 +506,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 1) = _tmp184 * _tmp299 + _tmp185 * _tmp300;
     _hessian(11, 1) = _tmp184 * _tmp307 + _tmp185 * _tmp308;
     _hessian(12, 1) = _tmp184 * _tmp318 + _tmp185 * _tmp319;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp198, Scalar(2)) + std::pow(_tmp199, Scalar(2));
+    _hessian(2, 2) = (_tmp198 * _tmp198) + (_tmp199 * _tmp199);
     _hessian(3, 2) = _tmp198 * _tmp216 + _tmp199 * _tmp217;
     _hessian(4, 2) = _tmp198 * _tmp230 + _tmp199 * _tmp231;
     _hessian(5, 2) = _tmp198 * _tmp244 + _tmp199 * _tmp245;
@@ -519,10 +517,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 2) = _tmp198 * _tmp299 + _tmp199 * _tmp300;
     _hessian(11, 2) = _tmp198 * _tmp307 + _tmp199 * _tmp308;
     _hessian(12, 2) = _tmp198 * _tmp318 + _tmp199 * _tmp319;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp216, Scalar(2)) + std::pow(_tmp217, Scalar(2));
+    _hessian(3, 3) = (_tmp216 * _tmp216) + (_tmp217 * _tmp217);
     _hessian(4, 3) = _tmp216 * _tmp230 + _tmp217 * _tmp231;
     _hessian(5, 3) = _tmp216 * _tmp244 + _tmp217 * _tmp245;
     _hessian(6, 3) = _tmp216 * _tmp262 + _tmp217 * _tmp263;
@@ -532,11 +527,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 3) = _tmp216 * _tmp299 + _tmp217 * _tmp300;
     _hessian(11, 3) = _tmp216 * _tmp307 + _tmp217 * _tmp308;
     _hessian(12, 3) = _tmp216 * _tmp318 + _tmp217 * _tmp319;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp230, Scalar(2)) + std::pow(_tmp231, Scalar(2));
+    _hessian(4, 4) = (_tmp230 * _tmp230) + (_tmp231 * _tmp231);
     _hessian(5, 4) = _tmp230 * _tmp244 + _tmp231 * _tmp245;
     _hessian(6, 4) = _tmp230 * _tmp262 + _tmp231 * _tmp263;
     _hessian(7, 4) = _tmp230 * _tmp274 + _tmp231 * _tmp275;
@@ -545,12 +536,7 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 4) = _tmp230 * _tmp299 + _tmp231 * _tmp300;
     _hessian(11, 4) = _tmp230 * _tmp307 + _tmp231 * _tmp308;
     _hessian(12, 4) = _tmp230 * _tmp318 + _tmp231 * _tmp319;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp244, Scalar(2)) + std::pow(_tmp245, Scalar(2));
+    _hessian(5, 5) = (_tmp244 * _tmp244) + (_tmp245 * _tmp245);
     _hessian(6, 5) = _tmp244 * _tmp262 + _tmp245 * _tmp263;
     _hessian(7, 5) = _tmp244 * _tmp274 + _tmp245 * _tmp275;
     _hessian(8, 5) = _tmp244 * _tmp283 + _tmp245 * _tmp284;
@@ -558,97 +544,34 @@ void InverseRangeLandmarkDoubleSphereReprojectionErrorFactor(
     _hessian(10, 5) = _tmp244 * _tmp299 + _tmp245 * _tmp300;
     _hessian(11, 5) = _tmp244 * _tmp307 + _tmp245 * _tmp308;
     _hessian(12, 5) = _tmp244 * _tmp318 + _tmp245 * _tmp319;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp262, Scalar(2)) + std::pow(_tmp263, Scalar(2));
+    _hessian(6, 6) = (_tmp262 * _tmp262) + (_tmp263 * _tmp263);
     _hessian(7, 6) = _tmp262 * _tmp274 + _tmp263 * _tmp275;
     _hessian(8, 6) = _tmp262 * _tmp283 + _tmp263 * _tmp284;
     _hessian(9, 6) = _tmp262 * _tmp291 + _tmp263 * _tmp292;
     _hessian(10, 6) = _tmp262 * _tmp299 + _tmp263 * _tmp300;
     _hessian(11, 6) = _tmp262 * _tmp307 + _tmp263 * _tmp308;
     _hessian(12, 6) = _tmp262 * _tmp318 + _tmp263 * _tmp319;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp274, Scalar(2)) + std::pow(_tmp275, Scalar(2));
+    _hessian(7, 7) = (_tmp274 * _tmp274) + (_tmp275 * _tmp275);
     _hessian(8, 7) = _tmp274 * _tmp283 + _tmp275 * _tmp284;
     _hessian(9, 7) = _tmp274 * _tmp291 + _tmp275 * _tmp292;
     _hessian(10, 7) = _tmp274 * _tmp299 + _tmp275 * _tmp300;
     _hessian(11, 7) = _tmp274 * _tmp307 + _tmp275 * _tmp308;
     _hessian(12, 7) = _tmp274 * _tmp318 + _tmp275 * _tmp319;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp283, Scalar(2)) + std::pow(_tmp284, Scalar(2));
+    _hessian(8, 8) = (_tmp283 * _tmp283) + (_tmp284 * _tmp284);
     _hessian(9, 8) = _tmp283 * _tmp291 + _tmp284 * _tmp292;
     _hessian(10, 8) = _tmp283 * _tmp299 + _tmp284 * _tmp300;
     _hessian(11, 8) = _tmp283 * _tmp307 + _tmp284 * _tmp308;
     _hessian(12, 8) = _tmp283 * _tmp318 + _tmp284 * _tmp319;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp291, Scalar(2)) + std::pow(_tmp292, Scalar(2));
+    _hessian(9, 9) = (_tmp291 * _tmp291) + (_tmp292 * _tmp292);
     _hessian(10, 9) = _tmp291 * _tmp299 + _tmp292 * _tmp300;
     _hessian(11, 9) = _tmp291 * _tmp307 + _tmp292 * _tmp308;
     _hessian(12, 9) = _tmp291 * _tmp318 + _tmp292 * _tmp319;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp299, Scalar(2)) + std::pow(_tmp300, Scalar(2));
+    _hessian(10, 10) = (_tmp299 * _tmp299) + (_tmp300 * _tmp300);
     _hessian(11, 10) = _tmp299 * _tmp307 + _tmp300 * _tmp308;
     _hessian(12, 10) = _tmp299 * _tmp318 + _tmp300 * _tmp319;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp307, Scalar(2)) + std::pow(_tmp308, Scalar(2));
+    _hessian(11, 11) = (_tmp307 * _tmp307) + (_tmp308 * _tmp308);
     _hessian(12, 11) = _tmp307 * _tmp318 + _tmp308 * _tmp319;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp318, Scalar(2)) + std::pow(_tmp319, Scalar(2));
+    _hessian(12, 12) = (_tmp318 * _tmp318) + (_tmp319 * _tmp319);
   }
 
   if (rhs != nullptr) {
@@ -45,7 +45,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -68,9 +69,9 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Eigen::Matrix<Scalar, 7, 1>& _target_pose = target_pose.Data();
 
   // Intermediate terms (256)
-  const Scalar _tmp0 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp0 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp1 = -2 * _tmp0;
-  const Scalar _tmp2 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp2 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp3 = -2 * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3 + 1;
   const Scalar _tmp5 = 2 * _source_pose[0] * _source_pose[2];
@@ -84,17 +85,16 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
       (-source_calibration_storage(3, 0) + source_pixel(1, 0)) / source_calibration_storage(1, 0);
   const Scalar _tmp12 = std::sin(_tmp11);
   const Scalar _tmp13 = std::cos(_tmp11);
-  const Scalar _tmp14 = std::pow(_tmp13, Scalar(2));
+  const Scalar _tmp14 = (_tmp13 * _tmp13);
   const Scalar _tmp15 = std::sin(_tmp9);
   const Scalar _tmp16 =
-      std::pow(Scalar(std::pow(_tmp10, Scalar(2)) * _tmp14 + std::pow(_tmp12, Scalar(2)) +
-                      _tmp14 * std::pow(_tmp15, Scalar(2)) + epsilon),
-               Scalar(Scalar(-1) / Scalar(2)));
+      Scalar(1.0) / std::sqrt(Scalar((_tmp10 * _tmp10) * _tmp14 + (_tmp12 * _tmp12) +
+                                     _tmp14 * (_tmp15 * _tmp15) + epsilon));
   const Scalar _tmp17 = _tmp13 * _tmp16;
   const Scalar _tmp18 = _tmp10 * _tmp17;
-  const Scalar _tmp19 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp19 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp20 = -2 * _tmp19;
-  const Scalar _tmp21 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp21 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp22 = 1 - 2 * _tmp21;
   const Scalar _tmp23 = _tmp15 * _tmp17;
   const Scalar _tmp24 = _source_pose[4] - _target_pose[4];
@@ -117,7 +117,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Scalar _tmp40 = _tmp38 + _tmp39;
   const Scalar _tmp41 = -_tmp7;
   const Scalar _tmp42 = _tmp41 + _tmp5;
-  const Scalar _tmp43 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp43 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp44 = -2 * _tmp43;
   const Scalar _tmp45 = _source_pose[6] - _target_pose[6];
   const Scalar _tmp46 = _tmp18 * (_tmp20 + _tmp44 + 1) + _tmp23 * _tmp42 + _tmp30 * _tmp40 +
@@ -133,7 +133,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
                         _tmp53 * source_inverse_range;
   const Scalar _tmp55 = _tmp37 * _tmp46 + _tmp49 * _tmp54;
   const Scalar _tmp56 = _tmp31 * _tmp4 + _tmp55;
-  const Scalar _tmp57 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp57 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp58 = 1 - 2 * _tmp57;
   const Scalar _tmp59 = _tmp1 + _tmp58;
   const Scalar _tmp60 = _tmp33 + _tmp35;
@@ -152,18 +152,18 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Scalar _tmp72 = _tmp48 + _tmp71;
   const Scalar _tmp73 = _tmp31 * _tmp72 + _tmp46 * _tmp70;
   const Scalar _tmp74 = _tmp54 * _tmp69 + _tmp73;
-  const Scalar _tmp75 = std::pow(_tmp56, Scalar(2));
-  const Scalar _tmp76 = std::pow(_tmp66, Scalar(2)) + _tmp75;
+  const Scalar _tmp75 = (_tmp56 * _tmp56);
+  const Scalar _tmp76 = (_tmp66 * _tmp66) + _tmp75;
   const Scalar _tmp77 = _tmp76 + epsilon;
   const Scalar _tmp78 = std::sqrt(_tmp77);
   const Scalar _tmp79 = target_calibration_storage(1, 0) * std::atan2(_tmp74, _tmp78) +
                         target_calibration_storage(3, 0) - target_pixel(1, 0);
-  const Scalar _tmp80 = std::pow(_tmp68, Scalar(2)) + std::pow(_tmp79, Scalar(2)) + epsilon;
-  const Scalar _tmp81 = std::pow(_tmp80, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp80 = (_tmp68 * _tmp68) + (_tmp79 * _tmp79) + epsilon;
+  const Scalar _tmp81 = Scalar(1.0) / std::sqrt(_tmp80);
   const Scalar _tmp82 = std::sqrt(weight);
   const Scalar _tmp83 = Scalar(1.0) / (epsilon - gnc_mu + 1);
   const Scalar _tmp84 = epsilon + std::fabs(_tmp83);
-  const Scalar _tmp85 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp85 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp86 = _tmp80 * _tmp85 / _tmp84 + 1;
   const Scalar _tmp87 = 2 - _tmp83;
   const Scalar _tmp88 =
@@ -176,7 +176,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
              (((Scalar(M_PI) - std::fabs(_tmp9)) > 0) - ((Scalar(M_PI) - std::fabs(_tmp9)) < 0)),
              (((-std::fabs(_tmp11) + Scalar(M_PI_2)) > 0) -
               ((-std::fabs(_tmp11) + Scalar(M_PI_2)) < 0))));
-  const Scalar _tmp92 = std::pow(_tmp74, Scalar(2)) + _tmp76;
+  const Scalar _tmp92 = (_tmp74 * _tmp74) + _tmp76;
   const Scalar _tmp93 = std::max<Scalar>(0, (((_tmp92) > 0) - ((_tmp92) < 0)));
   const Scalar _tmp94 = _tmp82 * _tmp90 * _tmp91 * _tmp93;
   const Scalar _tmp95 = _tmp81 * _tmp94;
@@ -184,7 +184,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Scalar _tmp97 = _tmp79 * _tmp95;
   const Scalar _tmp98 = -_tmp19;
   const Scalar _tmp99 = _tmp43 + _tmp98;
-  const Scalar _tmp100 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp100 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp101 = -_tmp100;
   const Scalar _tmp102 = _tmp101 + _tmp21;
   const Scalar _tmp103 = _tmp18 * (_tmp102 + _tmp99) + _tmp30 * _tmp51;
@@ -207,7 +207,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Scalar _tmp118 = _tmp117 * _tmp79;
   const Scalar _tmp119 = 2 * _tmp118;
   const Scalar _tmp120 = _tmp119 * _tmp77;
-  const Scalar _tmp121 = std::pow(_tmp67, Scalar(2));
+  const Scalar _tmp121 = (_tmp67 * _tmp67);
   const Scalar _tmp122 = _tmp56 / _tmp121;
   const Scalar _tmp123 = Scalar(1.0) / (_tmp67);
   const Scalar _tmp124 = _tmp109 * _tmp123 - _tmp111 * _tmp122;
@@ -294,7 +294,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   const Scalar _tmp202 = _tmp139 * _tmp196 - _tmp141 * _tmp200 + _tmp142 * _tmp200;
   const Scalar _tmp203 = -_tmp61;
   const Scalar _tmp204 = -_tmp48;
-  const Scalar _tmp205 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp205 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp206 = -_tmp205;
   const Scalar _tmp207 = _tmp206 + _tmp57;
   const Scalar _tmp208 = -_tmp0;
@@ -395,7 +395,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp137, Scalar(2)) + std::pow(_tmp143, Scalar(2));
+    _hessian(0, 0) = (_tmp137 * _tmp137) + (_tmp143 * _tmp143);
     _hessian(1, 0) = _tmp137 * _tmp155 + _tmp143 * _tmp156;
     _hessian(2, 0) = _tmp137 * _tmp166 + _tmp143 * _tmp167;
     _hessian(3, 0) = _tmp137 * _tmp181 + _tmp143 * _tmp182;
@@ -408,8 +408,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 0) = _tmp137 * _tmp242 + _tmp143 * _tmp243;
     _hessian(11, 0) = _tmp137 * _tmp247 + _tmp143 * _tmp248;
     _hessian(12, 0) = _tmp137 * _tmp254 + _tmp143 * _tmp255;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp155, Scalar(2)) + std::pow(_tmp156, Scalar(2));
+    _hessian(1, 1) = (_tmp155 * _tmp155) + (_tmp156 * _tmp156);
     _hessian(2, 1) = _tmp155 * _tmp166 + _tmp156 * _tmp167;
     _hessian(3, 1) = _tmp155 * _tmp181 + _tmp156 * _tmp182;
     _hessian(4, 1) = _tmp155 * _tmp191 + _tmp156 * _tmp192;
@@ -421,9 +420,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 1) = _tmp155 * _tmp242 + _tmp156 * _tmp243;
     _hessian(11, 1) = _tmp155 * _tmp247 + _tmp156 * _tmp248;
     _hessian(12, 1) = _tmp155 * _tmp254 + _tmp156 * _tmp255;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp166, Scalar(2)) + std::pow(_tmp167, Scalar(2));
+    _hessian(2, 2) = (_tmp166 * _tmp166) + (_tmp167 * _tmp167);
     _hessian(3, 2) = _tmp166 * _tmp181 + _tmp167 * _tmp182;
     _hessian(4, 2) = _tmp166 * _tmp191 + _tmp167 * _tmp192;
     _hessian(5, 2) = _tmp166 * _tmp201 + _tmp167 * _tmp202;
@@ -434,10 +431,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 2) = _tmp166 * _tmp242 + _tmp167 * _tmp243;
     _hessian(11, 2) = _tmp166 * _tmp247 + _tmp167 * _tmp248;
     _hessian(12, 2) = _tmp166 * _tmp254 + _tmp167 * _tmp255;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp181, Scalar(2)) + std::pow(_tmp182, Scalar(2));
+    _hessian(3, 3) = (_tmp181 * _tmp181) + (_tmp182 * _tmp182);
     _hessian(4, 3) = _tmp181 * _tmp191 + _tmp182 * _tmp192;
     _hessian(5, 3) = _tmp181 * _tmp201 + _tmp182 * _tmp202;
     _hessian(6, 3) = _tmp181 * _tmp215 + _tmp182 * _tmp216;
@@ -447,11 +441,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 3) = _tmp181 * _tmp242 + _tmp182 * _tmp243;
     _hessian(11, 3) = _tmp181 * _tmp247 + _tmp182 * _tmp248;
     _hessian(12, 3) = _tmp181 * _tmp254 + _tmp182 * _tmp255;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp191, Scalar(2)) + std::pow(_tmp192, Scalar(2));
+    _hessian(4, 4) = (_tmp191 * _tmp191) + (_tmp192 * _tmp192);
     _hessian(5, 4) = _tmp191 * _tmp201 + _tmp192 * _tmp202;
     _hessian(6, 4) = _tmp191 * _tmp215 + _tmp192 * _tmp216;
     _hessian(7, 4) = _tmp191 * _tmp225 + _tmp192 * _tmp226;
@@ -460,12 +450,7 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 4) = _tmp191 * _tmp242 + _tmp192 * _tmp243;
     _hessian(11, 4) = _tmp191 * _tmp247 + _tmp192 * _tmp248;
     _hessian(12, 4) = _tmp191 * _tmp254 + _tmp192 * _tmp255;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp201, Scalar(2)) + std::pow(_tmp202, Scalar(2));
+    _hessian(5, 5) = (_tmp201 * _tmp201) + (_tmp202 * _tmp202);
     _hessian(6, 5) = _tmp201 * _tmp215 + _tmp202 * _tmp216;
     _hessian(7, 5) = _tmp201 * _tmp225 + _tmp202 * _tmp226;
     _hessian(8, 5) = _tmp201 * _tmp231 + _tmp202 * _tmp232;
@@ -473,97 +458,34 @@ void InverseRangeLandmarkEquirectangularReprojectionErrorFactor(
     _hessian(10, 5) = _tmp201 * _tmp242 + _tmp202 * _tmp243;
     _hessian(11, 5) = _tmp201 * _tmp247 + _tmp202 * _tmp248;
     _hessian(12, 5) = _tmp201 * _tmp254 + _tmp202 * _tmp255;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp215, Scalar(2)) + std::pow(_tmp216, Scalar(2));
+    _hessian(6, 6) = (_tmp215 * _tmp215) + (_tmp216 * _tmp216);
     _hessian(7, 6) = _tmp215 * _tmp225 + _tmp216 * _tmp226;
     _hessian(8, 6) = _tmp215 * _tmp231 + _tmp216 * _tmp232;
     _hessian(9, 6) = _tmp215 * _tmp237 + _tmp216 * _tmp238;
     _hessian(10, 6) = _tmp215 * _tmp242 + _tmp216 * _tmp243;
     _hessian(11, 6) = _tmp215 * _tmp247 + _tmp216 * _tmp248;
     _hessian(12, 6) = _tmp215 * _tmp254 + _tmp216 * _tmp255;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp225, Scalar(2)) + std::pow(_tmp226, Scalar(2));
+    _hessian(7, 7) = (_tmp225 * _tmp225) + (_tmp226 * _tmp226);
     _hessian(8, 7) = _tmp225 * _tmp231 + _tmp226 * _tmp232;
     _hessian(9, 7) = _tmp225 * _tmp237 + _tmp226 * _tmp238;
     _hessian(10, 7) = _tmp225 * _tmp242 + _tmp226 * _tmp243;
     _hessian(11, 7) = _tmp225 * _tmp247 + _tmp226 * _tmp248;
     _hessian(12, 7) = _tmp225 * _tmp254 + _tmp226 * _tmp255;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp231, Scalar(2)) + std::pow(_tmp232, Scalar(2));
+    _hessian(8, 8) = (_tmp231 * _tmp231) + (_tmp232 * _tmp232);
     _hessian(9, 8) = _tmp231 * _tmp237 + _tmp232 * _tmp238;
     _hessian(10, 8) = _tmp231 * _tmp242 + _tmp232 * _tmp243;
     _hessian(11, 8) = _tmp231 * _tmp247 + _tmp232 * _tmp248;
     _hessian(12, 8) = _tmp231 * _tmp254 + _tmp232 * _tmp255;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp237, Scalar(2)) + std::pow(_tmp238, Scalar(2));
+    _hessian(9, 9) = (_tmp237 * _tmp237) + (_tmp238 * _tmp238);
     _hessian(10, 9) = _tmp237 * _tmp242 + _tmp238 * _tmp243;
     _hessian(11, 9) = _tmp237 * _tmp247 + _tmp238 * _tmp248;
     _hessian(12, 9) = _tmp237 * _tmp254 + _tmp238 * _tmp255;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp242, Scalar(2)) + std::pow(_tmp243, Scalar(2));
+    _hessian(10, 10) = (_tmp242 * _tmp242) + (_tmp243 * _tmp243);
     _hessian(11, 10) = _tmp242 * _tmp247 + _tmp243 * _tmp248;
     _hessian(12, 10) = _tmp242 * _tmp254 + _tmp243 * _tmp255;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp247, Scalar(2)) + std::pow(_tmp248, Scalar(2));
+    _hessian(11, 11) = (_tmp247 * _tmp247) + (_tmp248 * _tmp248);
     _hessian(12, 11) = _tmp247 * _tmp254 + _tmp248 * _tmp255;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp254, Scalar(2)) + std::pow(_tmp255, Scalar(2));
+    _hessian(12, 12) = (_tmp254 * _tmp254) + (_tmp255 * _tmp255);
   }
 
   if (rhs != nullptr) {
@@ -45,7 +45,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -68,23 +69,24 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Eigen::Matrix<Scalar, 7, 1>& _target_pose = target_pose.Data();
 
   // Intermediate terms (228)
-  const Scalar _tmp0 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp0 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp1 = -2 * _tmp0;
-  const Scalar _tmp2 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp2 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp3 = -2 * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3 + 1;
-  const Scalar _tmp5 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp5 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp6 = -2 * _tmp5;
-  const Scalar _tmp7 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp7 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp8 = 1 - 2 * _tmp7;
   const Scalar _tmp9 = -source_calibration_storage(3, 0) + source_pixel(1, 0);
   const Scalar _tmp10 = -source_calibration_storage(2, 0) + source_pixel(0, 0);
   const Scalar _tmp11 = epsilon + 1;
-  const Scalar _tmp12 = std::pow(
-      Scalar(std::pow(_tmp10, Scalar(2)) / std::pow(source_calibration_storage(0, 0), Scalar(2)) +
-             _tmp11 +
-             std::pow(_tmp9, Scalar(2)) / std::pow(source_calibration_storage(1, 0), Scalar(2))),
-      Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp12 =
+      Scalar(1.0) / std::sqrt(Scalar((_tmp10 * _tmp10) / (source_calibration_storage(0, 0) *
+                                                          source_calibration_storage(0, 0)) +
+                                     _tmp11 +
+                                     (_tmp9 * _tmp9) / (source_calibration_storage(1, 0) *
+                                                        source_calibration_storage(1, 0))));
   const Scalar _tmp13 = _tmp10 / source_calibration_storage(0, 0);
   const Scalar _tmp14 = _tmp12 * _tmp13;
   const Scalar _tmp15 = 2 * _source_pose[1];
@@ -113,7 +115,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp37 = _source_pose[1] * _tmp17;
   const Scalar _tmp38 = _tmp36 + _tmp37;
   const Scalar _tmp39 = _source_pose[6] - _target_pose[6];
-  const Scalar _tmp40 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp40 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp41 = -2 * _tmp40;
   const Scalar _tmp42 = _tmp12 * (_tmp41 + _tmp6 + 1) + _tmp13 * _tmp35 + _tmp22 * _tmp38 +
                         _tmp39 * source_inverse_range;
@@ -128,7 +130,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
       _tmp13 * _tmp46 + _tmp22 * (_tmp41 + _tmp8) + _tmp47 * source_inverse_range + _tmp49;
   const Scalar _tmp51 = _tmp33 * _tmp42 + _tmp45 * _tmp50;
   const Scalar _tmp52 = _tmp27 * _tmp4 + _tmp51;
-  const Scalar _tmp53 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp53 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp54 = 1 - 2 * _tmp53;
   const Scalar _tmp55 = _tmp1 + _tmp54;
   const Scalar _tmp56 = _tmp29 + _tmp31;
@@ -150,8 +152,8 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp72 = _tmp50 * _tmp67 + _tmp71;
   const Scalar _tmp73 = _tmp64 * target_calibration_storage(1, 0);
   const Scalar _tmp74 = _tmp72 * _tmp73 + target_calibration_storage(3, 0) - target_pixel(1, 0);
-  const Scalar _tmp75 = std::pow(_tmp66, Scalar(2)) + std::pow(_tmp74, Scalar(2)) + epsilon;
-  const Scalar _tmp76 = std::pow(_tmp75, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp75 = (_tmp66 * _tmp66) + (_tmp74 * _tmp74) + epsilon;
+  const Scalar _tmp76 = Scalar(1.0) / std::sqrt(_tmp75);
   const Scalar _tmp77 = std::max<Scalar>(0, (((_tmp62) > 0) - ((_tmp62) < 0)));
   const Scalar _tmp78 = std::sqrt(weight);
   const Scalar _tmp79 = Scalar(1.0) / (_tmp11 - gnc_mu);
@@ -159,7 +161,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp81 = 2 - _tmp79;
   const Scalar _tmp82 =
       _tmp81 + epsilon * (2 * std::min<Scalar>(0, (((_tmp81) > 0) - ((_tmp81) < 0))) + 1);
-  const Scalar _tmp83 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp83 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp84 = _tmp75 * _tmp83 / _tmp80 + 1;
   const Scalar _tmp85 = (Scalar(1) / Scalar(2)) * _tmp82;
   const Scalar _tmp86 =
@@ -168,7 +170,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp88 = _tmp76 * _tmp87;
   const Scalar _tmp89 = _tmp66 * _tmp88;
   const Scalar _tmp90 = _tmp74 * _tmp88;
-  const Scalar _tmp91 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp91 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp92 = -_tmp5;
   const Scalar _tmp93 = _tmp91 + _tmp92;
   const Scalar _tmp94 = -_tmp40;
@@ -180,7 +182,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp100 = -_tmp16;
   const Scalar _tmp101 = _tmp12 * (_tmp100 + _tmp18) + _tmp21 * _tmp26;
   const Scalar _tmp102 = _tmp101 * _tmp56 + _tmp55 * _tmp97 + _tmp60 * _tmp99;
-  const Scalar _tmp103 = std::pow(_tmp63, Scalar(-2));
+  const Scalar _tmp103 = Scalar(1.0) / (_tmp63 * _tmp63);
   const Scalar _tmp104 = (((_tmp62 - epsilon) > 0) - ((_tmp62 - epsilon) < 0)) + 1;
   const Scalar _tmp105 = (Scalar(1) / Scalar(2)) * _tmp103 * _tmp104;
   const Scalar _tmp106 = _tmp52 * target_calibration_storage(0, 0);
@@ -265,7 +267,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   const Scalar _tmp178 = _tmp136 * _tmp176 - _tmp137 * _tmp176 + _tmp175 * _tmp88;
   const Scalar _tmp179 = -_tmp44;
   const Scalar _tmp180 = -_tmp57;
-  const Scalar _tmp181 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp181 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp182 = -_tmp181;
   const Scalar _tmp183 = -_tmp0;
   const Scalar _tmp184 = _tmp103 * _tmp104 *
@@ -362,7 +364,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp120, Scalar(2)) + std::pow(_tmp123, Scalar(2));
+    _hessian(0, 0) = (_tmp120 * _tmp120) + (_tmp123 * _tmp123);
     _hessian(1, 0) = _tmp120 * _tmp135 + _tmp123 * _tmp138;
     _hessian(2, 0) = _tmp120 * _tmp146 + _tmp123 * _tmp147;
     _hessian(3, 0) = _tmp120 * _tmp159 + _tmp123 * _tmp160;
@@ -375,8 +377,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 0) = _tmp120 * _tmp215 + _tmp123 * _tmp216;
     _hessian(11, 0) = _tmp120 * _tmp220 + _tmp123 * _tmp221;
     _hessian(12, 0) = _tmp120 * _tmp226 + _tmp123 * _tmp227;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp135, Scalar(2)) + std::pow(_tmp138, Scalar(2));
+    _hessian(1, 1) = (_tmp135 * _tmp135) + (_tmp138 * _tmp138);
     _hessian(2, 1) = _tmp135 * _tmp146 + _tmp138 * _tmp147;
     _hessian(3, 1) = _tmp135 * _tmp159 + _tmp138 * _tmp160;
     _hessian(4, 1) = _tmp135 * _tmp168 + _tmp138 * _tmp169;
@@ -388,9 +389,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 1) = _tmp135 * _tmp215 + _tmp138 * _tmp216;
     _hessian(11, 1) = _tmp135 * _tmp220 + _tmp138 * _tmp221;
     _hessian(12, 1) = _tmp135 * _tmp226 + _tmp138 * _tmp227;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp146, Scalar(2)) + std::pow(_tmp147, Scalar(2));
+    _hessian(2, 2) = (_tmp146 * _tmp146) + (_tmp147 * _tmp147);
     _hessian(3, 2) = _tmp146 * _tmp159 + _tmp147 * _tmp160;
     _hessian(4, 2) = _tmp146 * _tmp168 + _tmp147 * _tmp169;
     _hessian(5, 2) = _tmp146 * _tmp177 + _tmp147 * _tmp178;
@@ -401,10 +400,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 2) = _tmp146 * _tmp215 + _tmp147 * _tmp216;
     _hessian(11, 2) = _tmp146 * _tmp220 + _tmp147 * _tmp221;
     _hessian(12, 2) = _tmp146 * _tmp226 + _tmp147 * _tmp227;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp159, Scalar(2)) + std::pow(_tmp160, Scalar(2));
+    _hessian(3, 3) = (_tmp159 * _tmp159) + (_tmp160 * _tmp160);
     _hessian(4, 3) = _tmp159 * _tmp168 + _tmp160 * _tmp169;
     _hessian(5, 3) = _tmp159 * _tmp177 + _tmp160 * _tmp178;
     _hessian(6, 3) = _tmp159 * _tmp191 + _tmp160 * _tmp192;
@@ -414,11 +410,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 3) = _tmp159 * _tmp215 + _tmp160 * _tmp216;
     _hessian(11, 3) = _tmp159 * _tmp220 + _tmp160 * _tmp221;
     _hessian(12, 3) = _tmp159 * _tmp226 + _tmp160 * _tmp227;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp168, Scalar(2)) + std::pow(_tmp169, Scalar(2));
+    _hessian(4, 4) = (_tmp168 * _tmp168) + (_tmp169 * _tmp169);
     _hessian(5, 4) = _tmp168 * _tmp177 + _tmp169 * _tmp178;
     _hessian(6, 4) = _tmp168 * _tmp191 + _tmp169 * _tmp192;
     _hessian(7, 4) = _tmp168 * _tmp200 + _tmp169 * _tmp201;
@@ -427,12 +419,7 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 4) = _tmp168 * _tmp215 + _tmp169 * _tmp216;
     _hessian(11, 4) = _tmp168 * _tmp220 + _tmp169 * _tmp221;
     _hessian(12, 4) = _tmp168 * _tmp226 + _tmp169 * _tmp227;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp177, Scalar(2)) + std::pow(_tmp178, Scalar(2));
+    _hessian(5, 5) = (_tmp177 * _tmp177) + (_tmp178 * _tmp178);
     _hessian(6, 5) = _tmp177 * _tmp191 + _tmp178 * _tmp192;
     _hessian(7, 5) = _tmp177 * _tmp200 + _tmp178 * _tmp201;
     _hessian(8, 5) = _tmp177 * _tmp205 + _tmp178 * _tmp206;
@@ -440,97 +427,34 @@ void InverseRangeLandmarkLinearReprojectionErrorFactor(
     _hessian(10, 5) = _tmp177 * _tmp215 + _tmp178 * _tmp216;
     _hessian(11, 5) = _tmp177 * _tmp220 + _tmp178 * _tmp221;
     _hessian(12, 5) = _tmp177 * _tmp226 + _tmp178 * _tmp227;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp191, Scalar(2)) + std::pow(_tmp192, Scalar(2));
+    _hessian(6, 6) = (_tmp191 * _tmp191) + (_tmp192 * _tmp192);
     _hessian(7, 6) = _tmp191 * _tmp200 + _tmp192 * _tmp201;
     _hessian(8, 6) = _tmp191 * _tmp205 + _tmp192 * _tmp206;
     _hessian(9, 6) = _tmp191 * _tmp210 + _tmp192 * _tmp211;
     _hessian(10, 6) = _tmp191 * _tmp215 + _tmp192 * _tmp216;
     _hessian(11, 6) = _tmp191 * _tmp220 + _tmp192 * _tmp221;
     _hessian(12, 6) = _tmp191 * _tmp226 + _tmp192 * _tmp227;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp200, Scalar(2)) + std::pow(_tmp201, Scalar(2));
+    _hessian(7, 7) = (_tmp200 * _tmp200) + (_tmp201 * _tmp201);
     _hessian(8, 7) = _tmp200 * _tmp205 + _tmp201 * _tmp206;
     _hessian(9, 7) = _tmp200 * _tmp210 + _tmp201 * _tmp211;
     _hessian(10, 7) = _tmp200 * _tmp215 + _tmp201 * _tmp216;
     _hessian(11, 7) = _tmp200 * _tmp220 + _tmp201 * _tmp221;
     _hessian(12, 7) = _tmp200 * _tmp226 + _tmp201 * _tmp227;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp205, Scalar(2)) + std::pow(_tmp206, Scalar(2));
+    _hessian(8, 8) = (_tmp205 * _tmp205) + (_tmp206 * _tmp206);
     _hessian(9, 8) = _tmp205 * _tmp210 + _tmp206 * _tmp211;
     _hessian(10, 8) = _tmp205 * _tmp215 + _tmp206 * _tmp216;
     _hessian(11, 8) = _tmp205 * _tmp220 + _tmp206 * _tmp221;
     _hessian(12, 8) = _tmp205 * _tmp226 + _tmp206 * _tmp227;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp210, Scalar(2)) + std::pow(_tmp211, Scalar(2));
+    _hessian(9, 9) = (_tmp210 * _tmp210) + (_tmp211 * _tmp211);
     _hessian(10, 9) = _tmp210 * _tmp215 + _tmp211 * _tmp216;
     _hessian(11, 9) = _tmp210 * _tmp220 + _tmp211 * _tmp221;
     _hessian(12, 9) = _tmp210 * _tmp226 + _tmp211 * _tmp227;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp215, Scalar(2)) + std::pow(_tmp216, Scalar(2));
+    _hessian(10, 10) = (_tmp215 * _tmp215) + (_tmp216 * _tmp216);
     _hessian(11, 10) = _tmp215 * _tmp220 + _tmp216 * _tmp221;
     _hessian(12, 10) = _tmp215 * _tmp226 + _tmp216 * _tmp227;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp220, Scalar(2)) + std::pow(_tmp221, Scalar(2));
+    _hessian(11, 11) = (_tmp220 * _tmp220) + (_tmp221 * _tmp221);
     _hessian(12, 11) = _tmp220 * _tmp226 + _tmp221 * _tmp227;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp226, Scalar(2)) + std::pow(_tmp227, Scalar(2));
+    _hessian(12, 12) = (_tmp226 * _tmp226) + (_tmp227 * _tmp227);
   }
 
   if (rhs != nullptr) {
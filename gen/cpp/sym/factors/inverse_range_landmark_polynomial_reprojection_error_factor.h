@@ -42,7 +42,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -63,9 +64,9 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Eigen::Matrix<Scalar, 7, 1>& _target_pose = target_pose.Data();
 
   // Intermediate terms (297)
-  const Scalar _tmp0 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp0 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp1 = -2 * _tmp0;
-  const Scalar _tmp2 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp2 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp3 = 1 - 2 * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3;
   const Scalar _tmp5 = 2 * _source_pose[1];
@@ -73,19 +74,19 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp7 = 2 * _source_pose[2] * _source_pose[3];
   const Scalar _tmp8 = -_tmp7;
   const Scalar _tmp9 = _tmp6 + _tmp8;
-  const Scalar _tmp10 = std::pow(Scalar(epsilon + std::pow(p_camera_source(0, 0), Scalar(2)) +
-                                        std::pow(p_camera_source(1, 0), Scalar(2)) +
-                                        std::pow(p_camera_source(2, 0), Scalar(2))),
-                                 Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp10 =
+      Scalar(1.0) / std::sqrt(Scalar(epsilon + (p_camera_source(0, 0) * p_camera_source(0, 0)) +
+                                     (p_camera_source(1, 0) * p_camera_source(1, 0)) +
+                                     (p_camera_source(2, 0) * p_camera_source(2, 0))));
   const Scalar _tmp11 = _tmp10 * p_camera_source(1, 0);
   const Scalar _tmp12 = 2 * _source_pose[0];
   const Scalar _tmp13 = _source_pose[2] * _tmp12;
   const Scalar _tmp14 = _source_pose[3] * _tmp5;
   const Scalar _tmp15 = _tmp13 + _tmp14;
   const Scalar _tmp16 = _tmp10 * p_camera_source(2, 0);
-  const Scalar _tmp17 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp17 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp18 = -2 * _tmp17;
-  const Scalar _tmp19 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp19 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp20 = -2 * _tmp19;
   const Scalar _tmp21 = _tmp10 * p_camera_source(0, 0);
   const Scalar _tmp22 = _source_pose[4] - _target_pose[4];
@@ -102,7 +103,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp32 = _tmp10 * (_tmp30 + _tmp31);
   const Scalar _tmp33 = -_tmp14;
   const Scalar _tmp34 = _tmp13 + _tmp33;
-  const Scalar _tmp35 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp35 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp36 = 1 - 2 * _tmp35;
   const Scalar _tmp37 = _source_pose[6] - _target_pose[6];
   const Scalar _tmp38 = _tmp16 * (_tmp20 + _tmp36) + _tmp21 * _tmp34 +
@@ -118,7 +119,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
                         _tmp45 * source_inverse_range;
   const Scalar _tmp47 = _tmp29 * _tmp38 + _tmp41 * _tmp46;
   const Scalar _tmp48 = _tmp23 * _tmp4 + _tmp47;
-  const Scalar _tmp49 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp49 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp50 = -2 * _tmp49;
   const Scalar _tmp51 = _tmp1 + _tmp50 + 1;
   const Scalar _tmp52 = _target_pose[2] * _tmp26;
@@ -130,40 +131,35 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp58 = _tmp38 * _tmp51 + _tmp57;
   const Scalar _tmp59 = std::max<Scalar>(_tmp58, epsilon);
   const Scalar _tmp60 = Scalar(1.0) / (_tmp59);
-  const Scalar _tmp61 = std::pow(_tmp59, Scalar(-2));
+  const Scalar _tmp61 = Scalar(1.0) / (_tmp59 * _tmp59);
   const Scalar _tmp62 = _tmp3 + _tmp50;
   const Scalar _tmp63 = _tmp52 + _tmp53;
   const Scalar _tmp64 = -_tmp39;
   const Scalar _tmp65 = _tmp40 + _tmp64;
   const Scalar _tmp66 = _tmp23 * _tmp65 + _tmp38 * _tmp63;
   const Scalar _tmp67 = _tmp46 * _tmp62 + _tmp66;
-  const Scalar _tmp68 = std::pow(_tmp67, Scalar(2));
-  const Scalar _tmp69 = std::pow(_tmp48, Scalar(2));
+  const Scalar _tmp68 = (_tmp67 * _tmp67);
+  const Scalar _tmp69 = (_tmp48 * _tmp48);
   const Scalar _tmp70 = _tmp61 * _tmp68 + _tmp61 * _tmp69 + epsilon;
-  const Scalar _tmp71 = std::pow(_tmp70, Scalar(2));
+  const Scalar _tmp71 = (_tmp70 * _tmp70);
   const Scalar _tmp72 = Scalar(1.0) * target_calibration_storage(5, 0);
-  const Scalar _tmp73 = Scalar(1.0) *
-                            [&]() {
-                              const Scalar base = _tmp70;
-                              return base * base * base;
-                            }() *
-                            target_calibration_storage(7, 0) +
-                        _tmp70 * _tmp72 + Scalar(1.0) * _tmp71 * target_calibration_storage(6, 0) +
-                        Scalar(1.0);
+  const Scalar _tmp73 =
+      Scalar(1.0) * (_tmp70 * _tmp70 * _tmp70) * target_calibration_storage(7, 0) +
+      _tmp70 * _tmp72 + Scalar(1.0) * _tmp71 * target_calibration_storage(6, 0) + Scalar(1.0);
   const Scalar _tmp74 = _tmp60 * _tmp73;
   const Scalar _tmp75 = _tmp74 * target_calibration_storage(0, 0);
   const Scalar _tmp76 = _tmp48 * _tmp75 + target_calibration_storage(2, 0) - target_pixel(0, 0);
   const Scalar _tmp77 = _tmp67 * target_calibration_storage(1, 0);
   const Scalar _tmp78 = _tmp74 * _tmp77 + target_calibration_storage(3, 0) - target_pixel(1, 0);
-  const Scalar _tmp79 = std::pow(_tmp76, Scalar(2)) + std::pow(_tmp78, Scalar(2)) + epsilon;
-  const Scalar _tmp80 = std::pow(_tmp79, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp79 = (_tmp76 * _tmp76) + (_tmp78 * _tmp78) + epsilon;
+  const Scalar _tmp80 = Scalar(1.0) / std::sqrt(_tmp79);
   const Scalar _tmp81 = std::sqrt(weight);
   const Scalar _tmp82 = Scalar(1.0) / (epsilon - gnc_mu + 1);
   const Scalar _tmp83 = epsilon + std::fabs(_tmp82);
   const Scalar _tmp84 = 2 - _tmp82;
   const Scalar _tmp85 =
       _tmp84 + epsilon * (2 * std::min<Scalar>(0, (((_tmp84) > 0) - ((_tmp84) < 0))) + 1);
-  const Scalar _tmp86 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp86 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp87 = _tmp79 * _tmp86 / _tmp83 + 1;
   const Scalar _tmp88 = (Scalar(1) / Scalar(2)) * _tmp85;
   const Scalar _tmp89 =
@@ -176,7 +172,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp92 = _tmp80 * _tmp91;
   const Scalar _tmp93 = _tmp76 * _tmp92;
   const Scalar _tmp94 = _tmp78 * _tmp92;
-  const Scalar _tmp95 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp95 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp96 = -_tmp95;
   const Scalar _tmp97 = -_tmp19;
   const Scalar _tmp98 = _tmp11 * _tmp44 + _tmp16 * (_tmp17 + _tmp35 + _tmp96 + _tmp97);
@@ -189,10 +185,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp105 = _tmp11 * _tmp15 + _tmp16 * (_tmp104 + _tmp7);
   const Scalar _tmp106 = _tmp103 * _tmp51 + _tmp105 * _tmp56 + _tmp55 * _tmp98;
   const Scalar _tmp107 = (((_tmp58 - epsilon) > 0) - ((_tmp58 - epsilon) < 0)) + 1;
-  const Scalar _tmp108 = _tmp107 / [&]() {
-    const Scalar base = _tmp59;
-    return base * base * base;
-  }();
+  const Scalar _tmp108 = _tmp107 / (_tmp59 * _tmp59 * _tmp59);
   const Scalar _tmp109 = _tmp108 * _tmp68;
   const Scalar _tmp110 = _tmp103 * _tmp63 + _tmp105 * _tmp65 + _tmp62 * _tmp98;
   const Scalar _tmp111 = 2 * _tmp61;
@@ -315,7 +308,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   const Scalar _tmp223 = _tmp134 * _tmp222 - _tmp137 * _tmp222 + _tmp218 * _tmp92;
   const Scalar _tmp224 = -_tmp139 * _tmp222 + _tmp140 * _tmp222 + _tmp221 * _tmp92;
   const Scalar _tmp225 = -_tmp49;
-  const Scalar _tmp226 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp226 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp227 = _tmp225 + _tmp226;
   const Scalar _tmp228 = -_tmp0;
   const Scalar _tmp229 = _tmp2 + _tmp228;
@@ -434,7 +427,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp138, Scalar(2)) + std::pow(_tmp141, Scalar(2));
+    _hessian(0, 0) = (_tmp138 * _tmp138) + (_tmp141 * _tmp141);
     _hessian(1, 0) = _tmp138 * _tmp157 + _tmp141 * _tmp158;
     _hessian(2, 0) = _tmp138 * _tmp170 + _tmp141 * _tmp171;
     _hessian(3, 0) = _tmp138 * _tmp193 + _tmp141 * _tmp194;
@@ -447,8 +440,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 0) = _tmp138 * _tmp276 + _tmp141 * _tmp277;
     _hessian(11, 0) = _tmp138 * _tmp284 + _tmp141 * _tmp286;
     _hessian(12, 0) = _tmp138 * _tmp295 + _tmp141 * _tmp296;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp157, Scalar(2)) + std::pow(_tmp158, Scalar(2));
+    _hessian(1, 1) = (_tmp157 * _tmp157) + (_tmp158 * _tmp158);
     _hessian(2, 1) = _tmp157 * _tmp170 + _tmp158 * _tmp171;
     _hessian(3, 1) = _tmp157 * _tmp193 + _tmp158 * _tmp194;
     _hessian(4, 1) = _tmp157 * _tmp208 + _tmp158 * _tmp209;
@@ -460,9 +452,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 1) = _tmp157 * _tmp276 + _tmp158 * _tmp277;
     _hessian(11, 1) = _tmp157 * _tmp284 + _tmp158 * _tmp286;
     _hessian(12, 1) = _tmp157 * _tmp295 + _tmp158 * _tmp296;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp170, Scalar(2)) + std::pow(_tmp171, Scalar(2));
+    _hessian(2, 2) = (_tmp170 * _tmp170) + (_tmp171 * _tmp171);
     _hessian(3, 2) = _tmp170 * _tmp193 + _tmp171 * _tmp194;
     _hessian(4, 2) = _tmp170 * _tmp208 + _tmp171 * _tmp209;
     _hessian(5, 2) = _tmp170 * _tmp223 + _tmp171 * _tmp224;
@@ -473,10 +463,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 2) = _tmp170 * _tmp276 + _tmp171 * _tmp277;
     _hessian(11, 2) = _tmp170 * _tmp284 + _tmp171 * _tmp286;
     _hessian(12, 2) = _tmp170 * _tmp295 + _tmp171 * _tmp296;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp193, Scalar(2)) + std::pow(_tmp194, Scalar(2));
+    _hessian(3, 3) = (_tmp193 * _tmp193) + (_tmp194 * _tmp194);
     _hessian(4, 3) = _tmp193 * _tmp208 + _tmp194 * _tmp209;
     _hessian(5, 3) = _tmp193 * _tmp223 + _tmp194 * _tmp224;
     _hessian(6, 3) = _tmp193 * _tmp241 + _tmp194 * _tmp242;
@@ -486,11 +473,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 3) = _tmp193 * _tmp276 + _tmp194 * _tmp277;
     _hessian(11, 3) = _tmp193 * _tmp284 + _tmp194 * _tmp286;
     _hessian(12, 3) = _tmp193 * _tmp295 + _tmp194 * _tmp296;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp208, Scalar(2)) + std::pow(_tmp209, Scalar(2));
+    _hessian(4, 4) = (_tmp208 * _tmp208) + (_tmp209 * _tmp209);
     _hessian(5, 4) = _tmp208 * _tmp223 + _tmp209 * _tmp224;
     _hessian(6, 4) = _tmp208 * _tmp241 + _tmp209 * _tmp242;
     _hessian(7, 4) = _tmp208 * _tmp253 + _tmp209 * _tmp254;
@@ -499,12 +482,7 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 4) = _tmp208 * _tmp276 + _tmp209 * _tmp277;
     _hessian(11, 4) = _tmp208 * _tmp284 + _tmp209 * _tmp286;
     _hessian(12, 4) = _tmp208 * _tmp295 + _tmp209 * _tmp296;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp223, Scalar(2)) + std::pow(_tmp224, Scalar(2));
+    _hessian(5, 5) = (_tmp223 * _tmp223) + (_tmp224 * _tmp224);
     _hessian(6, 5) = _tmp223 * _tmp241 + _tmp224 * _tmp242;
     _hessian(7, 5) = _tmp223 * _tmp253 + _tmp224 * _tmp254;
     _hessian(8, 5) = _tmp223 * _tmp262 + _tmp224 * _tmp263;
@@ -512,97 +490,34 @@ void InverseRangeLandmarkPolynomialReprojectionErrorFactor(
     _hessian(10, 5) = _tmp223 * _tmp276 + _tmp224 * _tmp277;
     _hessian(11, 5) = _tmp223 * _tmp284 + _tmp224 * _tmp286;
     _hessian(12, 5) = _tmp223 * _tmp295 + _tmp224 * _tmp296;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp241, Scalar(2)) + std::pow(_tmp242, Scalar(2));
+    _hessian(6, 6) = (_tmp241 * _tmp241) + (_tmp242 * _tmp242);
     _hessian(7, 6) = _tmp241 * _tmp253 + _tmp242 * _tmp254;
     _hessian(8, 6) = _tmp241 * _tmp262 + _tmp242 * _tmp263;
     _hessian(9, 6) = _tmp241 * _tmp269 + _tmp242 * _tmp270;
     _hessian(10, 6) = _tmp241 * _tmp276 + _tmp242 * _tmp277;
     _hessian(11, 6) = _tmp241 * _tmp284 + _tmp242 * _tmp286;
     _hessian(12, 6) = _tmp241 * _tmp295 + _tmp242 * _tmp296;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp253, Scalar(2)) + std::pow(_tmp254, Scalar(2));
+    _hessian(7, 7) = (_tmp253 * _tmp253) + (_tmp254 * _tmp254);
     _hessian(8, 7) = _tmp253 * _tmp262 + _tmp254 * _tmp263;
     _hessian(9, 7) = _tmp253 * _tmp269 + _tmp254 * _tmp270;
     _hessian(10, 7) = _tmp253 * _tmp276 + _tmp254 * _tmp277;
     _hessian(11, 7) = _tmp253 * _tmp284 + _tmp254 * _tmp286;
     _hessian(12, 7) = _tmp253 * _tmp295 + _tmp254 * _tmp296;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp262, Scalar(2)) + std::pow(_tmp263, Scalar(2));
+    _hessian(8, 8) = (_tmp262 * _tmp262) + (_tmp263 * _tmp263);
     _hessian(9, 8) = _tmp262 * _tmp269 + _tmp263 * _tmp270;
     _hessian(10, 8) = _tmp262 * _tmp276 + _tmp263 * _tmp277;
     _hessian(11, 8) = _tmp262 * _tmp284 + _tmp263 * _tmp286;
     _hessian(12, 8) = _tmp262 * _tmp295 + _tmp263 * _tmp296;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp269, Scalar(2)) + std::pow(_tmp270, Scalar(2));
+    _hessian(9, 9) = (_tmp269 * _tmp269) + (_tmp270 * _tmp270);
     _hessian(10, 9) = _tmp269 * _tmp276 + _tmp270 * _tmp277;
     _hessian(11, 9) = _tmp269 * _tmp284 + _tmp270 * _tmp286;
     _hessian(12, 9) = _tmp269 * _tmp295 + _tmp270 * _tmp296;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp276, Scalar(2)) + std::pow(_tmp277, Scalar(2));
+    _hessian(10, 10) = (_tmp276 * _tmp276) + (_tmp277 * _tmp277);
     _hessian(11, 10) = _tmp276 * _tmp284 + _tmp277 * _tmp286;
     _hessian(12, 10) = _tmp276 * _tmp295 + _tmp277 * _tmp296;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp284, Scalar(2)) + std::pow(_tmp286, Scalar(2));
+    _hessian(11, 11) = (_tmp284 * _tmp284) + (_tmp286 * _tmp286);
     _hessian(12, 11) = _tmp284 * _tmp295 + _tmp286 * _tmp296;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp295, Scalar(2)) + std::pow(_tmp296, Scalar(2));
+    _hessian(12, 12) = (_tmp295 * _tmp295) + (_tmp296 * _tmp296);
   }
 
   if (rhs != nullptr) {
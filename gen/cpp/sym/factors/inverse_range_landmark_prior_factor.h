@@ -23,7 +23,9 @@ namespace sym {
  * Outputs:
  *     res: 1dof residual of the prior
  *     jacobian: (1x1) jacobian of res wrt arg landmark_inverse_range (1)
- *     hessian: (1x1) Gauss-Newton hessian for arg landmark_inverse_range (1)
+ *     hessian: (1x1) Gauss-Newton hessian for arg landmark_inverse_range (1). Only the lower
+ *              triangle is written, the strict upper triangle is left unmodified, so callers which
+ *              read it must initialize it
  *     rhs: (1x1) Gauss-Newton rhs for arg landmark_inverse_range (1)
  */
 template <typename Scalar>
@@ -42,7 +44,7 @@ void InverseRangeLandmarkPriorFactor(const Scalar landmark_inverse_range,
   const Scalar _tmp0 = -inverse_range_prior + landmark_inverse_range;
   const Scalar _tmp1 = epsilon + sigma;
   const Scalar _tmp2 = weight / _tmp1;
-  const Scalar _tmp3 = std::pow(weight, Scalar(2)) / std::pow(_tmp1, Scalar(2));
+  const Scalar _tmp3 = (weight * weight) / (_tmp1 * _tmp1);
 
   // Output terms (4)
   if (res != nullptr) {
@@ -42,7 +42,8 @@ namespace sym {
  *     jacobian: (2x13) jacobian of res wrt args source_pose (6), target_pose (6),
  *               source_inverse_range (1)
  *     hessian: (13x13) Gauss-Newton hessian for args source_pose (6), target_pose (6),
- *              source_inverse_range (1)
+ *              source_inverse_range (1). Only the lower triangle is written, the strict upper
+ *              triangle is left unmodified, so callers which read it must initialize it
  *     rhs: (13x1) Gauss-Newton rhs for args source_pose (6), target_pose (6), source_inverse_range
  *          (1)
  */
@@ -63,9 +64,9 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Eigen::Matrix<Scalar, 7, 1>& _target_pose = target_pose.Data();
 
   // Intermediate terms (317)
-  const Scalar _tmp0 = std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp0 = (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp1 = -2 * _tmp0;
-  const Scalar _tmp2 = std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp2 = (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp3 = 1 - 2 * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3;
   const Scalar _tmp5 = 2 * _source_pose[1];
@@ -74,18 +75,18 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp8 = _source_pose[3] * _tmp7;
   const Scalar _tmp9 = -_tmp8;
   const Scalar _tmp10 = _tmp6 + _tmp9;
-  const Scalar _tmp11 = std::pow(Scalar(epsilon + std::pow(p_camera_source(0, 0), Scalar(2)) +
-                                        std::pow(p_camera_source(1, 0), Scalar(2)) +
-                                        std::pow(p_camera_source(2, 0), Scalar(2))),
-                                 Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp11 =
+      Scalar(1.0) / std::sqrt(Scalar(epsilon + (p_camera_source(0, 0) * p_camera_source(0, 0)) +
+                                     (p_camera_source(1, 0) * p_camera_source(1, 0)) +
+                                     (p_camera_source(2, 0) * p_camera_source(2, 0))));
   const Scalar _tmp12 = _tmp11 * p_camera_source(1, 0);
   const Scalar _tmp13 = _source_pose[0] * _tmp7;
   const Scalar _tmp14 = _source_pose[3] * _tmp5;
   const Scalar _tmp15 = _tmp13 + _tmp14;
   const Scalar _tmp16 = _tmp11 * p_camera_source(2, 0);
-  const Scalar _tmp17 = std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp17 = (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp18 = -2 * _tmp17;
-  const Scalar _tmp19 = std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp19 = (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp20 = 1 - 2 * _tmp19;
   const Scalar _tmp21 = _tmp11 * p_camera_source(0, 0);
   const Scalar _tmp22 = _source_pose[4] - _target_pose[4];
@@ -102,7 +103,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp32 = _tmp30 + _tmp31;
   const Scalar _tmp33 = -_tmp14;
   const Scalar _tmp34 = _tmp13 + _tmp33;
-  const Scalar _tmp35 = std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp35 = (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp36 = -2 * _tmp35;
   const Scalar _tmp37 = _source_pose[6] - _target_pose[6];
   const Scalar _tmp38 = _tmp12 * _tmp32 + _tmp16 * (_tmp20 + _tmp36) + _tmp21 * _tmp34 +
@@ -118,8 +119,8 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
                         _tmp45 * source_inverse_range;
   const Scalar _tmp47 = _tmp29 * _tmp38 + _tmp41 * _tmp46;
   const Scalar _tmp48 = _tmp23 * _tmp4 + _tmp47;
-  const Scalar _tmp49 = std::pow(_tmp48, Scalar(2));
-  const Scalar _tmp50 = std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp49 = (_tmp48 * _tmp48);
+  const Scalar _tmp50 = (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp51 = -2 * _tmp50;
   const Scalar _tmp52 = _tmp1 + _tmp51 + 1;
   const Scalar _tmp53 = _target_pose[2] * _tmp26;
@@ -129,7 +130,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp57 = _tmp40 + _tmp56;
   const Scalar _tmp58 = _tmp23 * _tmp57 + _tmp38 * _tmp55;
   const Scalar _tmp59 = _tmp46 * _tmp52 + _tmp58;
-  const Scalar _tmp60 = std::pow(_tmp59, Scalar(2));
+  const Scalar _tmp60 = (_tmp59 * _tmp59);
   const Scalar _tmp61 = _tmp49 + _tmp60 + epsilon;
   const Scalar _tmp62 = std::sqrt(_tmp61);
   const Scalar _tmp63 = Scalar(1.0) / (_tmp62);
@@ -146,25 +147,20 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp74 = std::pow(_tmp73, Scalar(9)) * target_calibration_storage(8, 0) +
                         std::pow(_tmp73, Scalar(7)) * target_calibration_storage(7, 0) +
                         std::pow(_tmp73, Scalar(5)) * target_calibration_storage(6, 0) +
-                        [&]() {
-                          const Scalar base = _tmp73;
-                          return base * base * base;
-                        }() *
-                            target_calibration_storage(5, 0) +
-                        _tmp73;
+                        (_tmp73 * _tmp73 * _tmp73) * target_calibration_storage(5, 0) + _tmp73;
   const Scalar _tmp75 = _tmp74 * target_calibration_storage(0, 0);
   const Scalar _tmp76 = _tmp64 * _tmp75 + target_calibration_storage(2, 0) - target_pixel(0, 0);
   const Scalar _tmp77 = _tmp63 * target_calibration_storage(1, 0);
   const Scalar _tmp78 = _tmp59 * _tmp77;
   const Scalar _tmp79 = _tmp74 * _tmp78 + target_calibration_storage(3, 0) - target_pixel(1, 0);
-  const Scalar _tmp80 = std::pow(_tmp76, Scalar(2)) + std::pow(_tmp79, Scalar(2)) + epsilon;
-  const Scalar _tmp81 = std::pow(_tmp80, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp80 = (_tmp76 * _tmp76) + (_tmp79 * _tmp79) + epsilon;
+  const Scalar _tmp81 = Scalar(1.0) / std::sqrt(_tmp80);
   const Scalar _tmp82 = std::sqrt(weight);
   const Scalar _tmp83 = -_tmp71 + target_calibration_storage(4, 0);
   const Scalar _tmp84 = std::max<Scalar>(0, (((_tmp83) > 0) - ((_tmp83) < 0)));
   const Scalar _tmp85 = Scalar(1.0) / (epsilon - gnc_mu + 1);
   const Scalar _tmp86 = epsilon + std::fabs(_tmp85);
-  const Scalar _tmp87 = std::pow(gnc_scale, Scalar(-2));
+  const Scalar _tmp87 = Scalar(1.0) / (gnc_scale * gnc_scale);
   const Scalar _tmp88 = _tmp80 * _tmp87 / _tmp86 + 1;
   const Scalar _tmp89 = 2 - _tmp85;
   const Scalar _tmp90 =
@@ -176,7 +172,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp94 = _tmp81 * _tmp93;
   const Scalar _tmp95 = _tmp76 * _tmp94;
   const Scalar _tmp96 = _tmp79 * _tmp94;
-  const Scalar _tmp97 = std::pow(_source_pose[3], Scalar(2));
+  const Scalar _tmp97 = (_source_pose[3] * _source_pose[3]);
   const Scalar _tmp98 = -_tmp97;
   const Scalar _tmp99 = -_tmp19;
   const Scalar _tmp100 = _tmp12 * _tmp44 + _tmp16 * (_tmp17 + _tmp35 + _tmp98 + _tmp99);
@@ -187,7 +183,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp105 = _tmp12 * (_tmp102 + _tmp104) + _tmp16 * (_tmp101 + _tmp43);
   const Scalar _tmp106 = -_tmp6;
   const Scalar _tmp107 = _tmp12 * _tmp15 + _tmp16 * (_tmp106 + _tmp8);
-  const Scalar _tmp108 = std::pow(_tmp70, Scalar(2));
+  const Scalar _tmp108 = (_tmp70 * _tmp70);
   const Scalar _tmp109 = _tmp62 / _tmp108;
   const Scalar _tmp110 = _tmp100 * _tmp52 + _tmp105 * _tmp55 + _tmp107 * _tmp57;
   const Scalar _tmp111 = 2 * _tmp59;
@@ -203,7 +199,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
       ((((_tmp72 + _tmp83) > 0) - ((_tmp72 + _tmp83) < 0)) + 1) / (_tmp108 + _tmp61);
   const Scalar _tmp120 = _tmp108 * _tmp119;
   const Scalar _tmp121 = (Scalar(1) / Scalar(2)) * _tmp120;
-  const Scalar _tmp122 = std::pow(_tmp73, Scalar(4)) * target_calibration_storage(6, 0);
+  const Scalar _tmp122 = (_tmp73 * _tmp73 * _tmp73 * _tmp73) * target_calibration_storage(6, 0);
   const Scalar _tmp123 = (Scalar(5) / Scalar(2)) * _tmp122;
   const Scalar _tmp124 = _tmp120 * _tmp123;
   const Scalar _tmp125 = std::pow(_tmp73, Scalar(6)) * target_calibration_storage(7, 0);
@@ -212,14 +208,14 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp128 = std::pow(_tmp73, Scalar(8)) * target_calibration_storage(8, 0);
   const Scalar _tmp129 = (Scalar(9) / Scalar(2)) * _tmp128;
   const Scalar _tmp130 = _tmp120 * _tmp129;
-  const Scalar _tmp131 = std::pow(_tmp73, Scalar(2)) * target_calibration_storage(5, 0);
+  const Scalar _tmp131 = (_tmp73 * _tmp73) * target_calibration_storage(5, 0);
   const Scalar _tmp132 = (Scalar(3) / Scalar(2)) * _tmp131;
   const Scalar _tmp133 = _tmp120 * _tmp132;
   const Scalar _tmp134 = _tmp118 * _tmp121 + _tmp118 * _tmp124 + _tmp118 * _tmp127 +
                          _tmp118 * _tmp130 + _tmp118 * _tmp133;
   const Scalar _tmp135 = _tmp64 * target_calibration_storage(0, 0);
   const Scalar _tmp136 = _tmp63 * _tmp75;
-  const Scalar _tmp137 = std::pow(_tmp61, Scalar(Scalar(-3) / Scalar(2)));
+  const Scalar _tmp137 = Scalar(1.0) / (_tmp61 * std::sqrt(_tmp61));
   const Scalar _tmp138 = _tmp137 * _tmp75;
   const Scalar _tmp139 = _tmp138 * _tmp48;
   const Scalar _tmp140 = (Scalar(1) / Scalar(2)) * _tmp139;
@@ -330,7 +326,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   const Scalar _tmp235 = -_tmp152 * _tmp234 + _tmp154 * _tmp234 + _tmp233 * _tmp94;
   const Scalar _tmp236 = -_tmp157 * _tmp234 + _tmp158 * _tmp234 + _tmp231 * _tmp94;
   const Scalar _tmp237 = -_tmp53;
-  const Scalar _tmp238 = std::pow(_target_pose[3], Scalar(2));
+  const Scalar _tmp238 = (_target_pose[3] * _target_pose[3]);
   const Scalar _tmp239 = -_tmp238;
   const Scalar _tmp240 = _tmp239 + _tmp50;
   const Scalar _tmp241 = -_tmp2;
@@ -467,7 +463,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 13, 13>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp155, Scalar(2)) + std::pow(_tmp159, Scalar(2));
+    _hessian(0, 0) = (_tmp155 * _tmp155) + (_tmp159 * _tmp159);
     _hessian(1, 0) = _tmp155 * _tmp175 + _tmp159 * _tmp176;
     _hessian(2, 0) = _tmp155 * _tmp189 + _tmp159 * _tmp190;
     _hessian(3, 0) = _tmp155 * _tmp208 + _tmp159 * _tmp209;
@@ -480,8 +476,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 0) = _tmp155 * _tmp295 + _tmp159 * _tmp296;
     _hessian(11, 0) = _tmp155 * _tmp304 + _tmp159 * _tmp305;
     _hessian(12, 0) = _tmp155 * _tmp315 + _tmp159 * _tmp316;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp175, Scalar(2)) + std::pow(_tmp176, Scalar(2));
+    _hessian(1, 1) = (_tmp175 * _tmp175) + (_tmp176 * _tmp176);
     _hessian(2, 1) = _tmp175 * _tmp189 + _tmp176 * _tmp190;
     _hessian(3, 1) = _tmp175 * _tmp208 + _tmp176 * _tmp209;
     _hessian(4, 1) = _tmp175 * _tmp221 + _tmp176 * _tmp222;
@@ -493,9 +488,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 1) = _tmp175 * _tmp295 + _tmp176 * _tmp296;
     _hessian(11, 1) = _tmp175 * _tmp304 + _tmp176 * _tmp305;
     _hessian(12, 1) = _tmp175 * _tmp315 + _tmp176 * _tmp316;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp189, Scalar(2)) + std::pow(_tmp190, Scalar(2));
+    _hessian(2, 2) = (_tmp189 * _tmp189) + (_tmp190 * _tmp190);
     _hessian(3, 2) = _tmp189 * _tmp208 + _tmp190 * _tmp209;
     _hessian(4, 2) = _tmp189 * _tmp221 + _tmp190 * _tmp222;
     _hessian(5, 2) = _tmp189 * _tmp235 + _tmp190 * _tmp236;
@@ -506,10 +499,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 2) = _tmp189 * _tmp295 + _tmp190 * _tmp296;
     _hessian(11, 2) = _tmp189 * _tmp304 + _tmp190 * _tmp305;
     _hessian(12, 2) = _tmp189 * _tmp315 + _tmp190 * _tmp316;
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp208, Scalar(2)) + std::pow(_tmp209, Scalar(2));
+    _hessian(3, 3) = (_tmp208 * _tmp208) + (_tmp209 * _tmp209);
     _hessian(4, 3) = _tmp208 * _tmp221 + _tmp209 * _tmp222;
     _hessian(5, 3) = _tmp208 * _tmp235 + _tmp209 * _tmp236;
     _hessian(6, 3) = _tmp208 * _tmp254 + _tmp209 * _tmp255;
@@ -519,11 +509,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 3) = _tmp208 * _tmp295 + _tmp209 * _tmp296;
     _hessian(11, 3) = _tmp208 * _tmp304 + _tmp209 * _tmp305;
     _hessian(12, 3) = _tmp208 * _tmp315 + _tmp209 * _tmp316;
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp221, Scalar(2)) + std::pow(_tmp222, Scalar(2));
+    _hessian(4, 4) = (_tmp221 * _tmp221) + (_tmp222 * _tmp222);
     _hessian(5, 4) = _tmp221 * _tmp235 + _tmp222 * _tmp236;
     _hessian(6, 4) = _tmp221 * _tmp254 + _tmp222 * _tmp255;
     _hessian(7, 4) = _tmp221 * _tmp265 + _tmp222 * _tmp266;
@@ -532,12 +518,7 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 4) = _tmp221 * _tmp295 + _tmp222 * _tmp296;
     _hessian(11, 4) = _tmp221 * _tmp304 + _tmp222 * _tmp305;
     _hessian(12, 4) = _tmp221 * _tmp315 + _tmp222 * _tmp316;
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp235, Scalar(2)) + std::pow(_tmp236, Scalar(2));
+    _hessian(5, 5) = (_tmp235 * _tmp235) + (_tmp236 * _tmp236);
     _hessian(6, 5) = _tmp235 * _tmp254 + _tmp236 * _tmp255;
     _hessian(7, 5) = _tmp235 * _tmp265 + _tmp236 * _tmp266;
     _hessian(8, 5) = _tmp235 * _tmp275 + _tmp236 * _tmp276;
@@ -545,97 +526,34 @@ void InverseRangeLandmarkSphericalReprojectionErrorFactor(
     _hessian(10, 5) = _tmp235 * _tmp295 + _tmp236 * _tmp296;
     _hessian(11, 5) = _tmp235 * _tmp304 + _tmp236 * _tmp305;
     _hessian(12, 5) = _tmp235 * _tmp315 + _tmp236 * _tmp316;
-    _hessian(0, 6) = 0;
-    _hessian(1, 6) = 0;
-    _hessian(2, 6) = 0;
-    _hessian(3, 6) = 0;
-    _hessian(4, 6) = 0;
-    _hessian(5, 6) = 0;
-    _hessian(6, 6) = std::pow(_tmp254, Scalar(2)) + std::pow(_tmp255, Scalar(2));
+    _hessian(6, 6) = (_tmp254 * _tmp254) + (_tmp255 * _tmp255);
     _hessian(7, 6) = _tmp254 * _tmp265 + _tmp255 * _tmp266;
     _hessian(8, 6) = _tmp254 * _tmp275 + _tmp255 * _tmp276;
     _hessian(9, 6) = _tmp254 * _tmp285 + _tmp255 * _tmp286;
     _hessian(10, 6) = _tmp254 * _tmp295 + _tmp255 * _tmp296;
     _hessian(11, 6) = _tmp254 * _tmp304 + _tmp255 * _tmp305;
     _hessian(12, 6) = _tmp254 * _tmp315 + _tmp255 * _tmp316;
-    _hessian(0, 7) = 0;
-    _hessian(1, 7) = 0;
-    _hessian(2, 7) = 0;
-    _hessian(3, 7) = 0;
-    _hessian(4, 7) = 0;
-    _hessian(5, 7) = 0;
-    _hessian(6, 7) = 0;
-    _hessian(7, 7) = std::pow(_tmp265, Scalar(2)) + std::pow(_tmp266, Scalar(2));
+    _hessian(7, 7) = (_tmp265 * _tmp265) + (_tmp266 * _tmp266);
     _hessian(8, 7) = _tmp265 * _tmp275 + _tmp266 * _tmp276;
     _hessian(9, 7) = _tmp265 * _tmp285 + _tmp266 * _tmp286;
     _hessian(10, 7) = _tmp265 * _tmp295 + _tmp266 * _tmp296;
     _hessian(11, 7) = _tmp265 * _tmp304 + _tmp266 * _tmp305;
     _hessian(12, 7) = _tmp265 * _tmp315 + _tmp266 * _tmp316;
-    _hessian(0, 8) = 0;
-    _hessian(1, 8) = 0;
-    _hessian(2, 8) = 0;
-    _hessian(3, 8) = 0;
-    _hessian(4, 8) = 0;
-    _hessian(5, 8) = 0;
-    _hessian(6, 8) = 0;
-    _hessian(7, 8) = 0;
-    _hessian(8, 8) = std::pow(_tmp275, Scalar(2)) + std::pow(_tmp276, Scalar(2));
+    _hessian(8, 8) = (_tmp275 * _tmp275) + (_tmp276 * _tmp276);
     _hessian(9, 8) = _tmp275 * _tmp285 + _tmp276 * _tmp286;
     _hessian(10, 8) = _tmp275 * _tmp295 + _tmp276 * _tmp296;
     _hessian(11, 8) = _tmp275 * _tmp304 + _tmp276 * _tmp305;
     _hessian(12, 8) = _tmp275 * _tmp315 + _tmp276 * _tmp316;
-    _hessian(0, 9) = 0;
-    _hessian(1, 9) = 0;
-    _hessian(2, 9) = 0;
-    _hessian(3, 9) = 0;
-    _hessian(4, 9) = 0;
-    _hessian(5, 9) = 0;
-    _hessian(6, 9) = 0;
-    _hessian(7, 9) = 0;
-    _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp285, Scalar(2)) + std::pow(_tmp286, Scalar(2));
+    _hessian(9, 9) = (_tmp285 * _tmp285) + (_tmp286 * _tmp286);
     _hessian(10, 9) = _tmp285 * _tmp295 + _tmp286 * _tmp296;
     _hessian(11, 9) = _tmp285 * _tmp304 + _tmp286 * _tmp305;
     _hessian(12, 9) = _tmp285 * _tmp315 + _tmp286 * _tmp316;
-    _hessian(0, 10) = 0;
-    _hessian(1, 10) = 0;
-    _hessian(2, 10) = 0;
-    _hessian(3, 10) = 0;
-    _hessian(4, 10) = 0;
-    _hessian(5, 10) = 0;
-    _hessian(6, 10) = 0;
-    _hessian(7, 10) = 0;
-    _hessian(8, 10) = 0;
-    _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp295, Scalar(2)) + std::pow(_tmp296, Scalar(2));
+    _hessian(10, 10) = (_tmp295 * _tmp295) + (_tmp296 * _tmp296);
     _hessian(11, 10) = _tmp295 * _tmp304 + _tmp296 * _tmp305;
     _hessian(12, 10) = _tmp295 * _tmp315 + _tmp296 * _tmp316;
-    _hessian(0, 11) = 0;
-    _hessian(1, 11) = 0;
-    _hessian(2, 11) = 0;
-    _hessian(3, 11) = 0;
-    _hessian(4, 11) = 0;
-    _hessian(5, 11) = 0;
-    _hessian(6, 11) = 0;
-    _hessian(7, 11) = 0;
-    _hessian(8, 11) = 0;
-    _hessian(9, 11) = 0;
-    _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp304, Scalar(2)) + std::pow(_tmp305, Scalar(2));
+    _hessian(11, 11) = (_tmp304 * _tmp304) + (_tmp305 * _tmp305);
     _hessian(12, 11) = _tmp304 * _tmp315 + _tmp305 * _tmp316;
-    _hessian(0, 12) = 0;
-    _hessian(1, 12) = 0;
-    _hessian(2, 12) = 0;
-    _hessian(3, 12) = 0;
-    _hessian(4, 12) = 0;
-    _hessian(5, 12) = 0;
-    _hessian(6, 12) = 0;
-    _hessian(7, 12) = 0;
-    _hessian(8, 12) = 0;
-    _hessian(9, 12) = 0;
-    _hessian(10, 12) = 0;
-    _hessian(11, 12) = 0;
-    _hessian(12, 12) = std::pow(_tmp315, Scalar(2)) + std::pow(_tmp316, Scalar(2));
+    _hessian(12, 12) = (_tmp315 * _tmp315) + (_tmp316 * _tmp316);
   }
 
   if (rhs != nullptr) {
@@ -56,15 +56,16 @@ void LinearReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp1 = _target_pose[0] * _tmp0;
   const Scalar _tmp2 = 2 * _target_pose[1];
   const Scalar _tmp3 = _target_pose[3] * _tmp2;
-  const Scalar _tmp4 = -2 * std::pow(_source_pose[2], Scalar(2));
-  const Scalar _tmp5 = 1 - 2 * std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp4 = -2 * (_source_pose[2] * _source_pose[2]);
+  const Scalar _tmp5 = 1 - 2 * (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp6 = -source_calibration_storage(3, 0) + source_pixel(1, 0);
   const Scalar _tmp7 = -source_calibration_storage(2, 0) + source_pixel(0, 0);
-  const Scalar _tmp8 = std::pow(
-      Scalar(std::pow(_tmp6, Scalar(2)) / std::pow(source_calibration_storage(1, 0), Scalar(2)) +
-             std::pow(_tmp7, Scalar(2)) / std::pow(source_calibration_storage(0, 0), Scalar(2)) +
-             epsilon + 1),
-      Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp8 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(
+          (_tmp6 * _tmp6) / (source_calibration_storage(1, 0) * source_calibration_storage(1, 0)) +
+          (_tmp7 * _tmp7) / (source_calibration_storage(0, 0) * source_calibration_storage(0, 0)) +
+          epsilon + 1));
   const Scalar _tmp9 = _tmp7 * _tmp8 / source_calibration_storage(0, 0);
   const Scalar _tmp10 = 2 * _source_pose[1];
   const Scalar _tmp11 = _source_pose[0] * _tmp10;
@@ -76,11 +77,11 @@ void LinearReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp17 = _tmp14 * (_tmp11 - _tmp13) + _tmp8 * (_tmp15 + _tmp16) +
                         _tmp9 * (_tmp4 + _tmp5) +
                         source_inverse_range * (_source_pose[4] - _target_pose[4]);
-  const Scalar _tmp18 = -2 * std::pow(_target_pose[0], Scalar(2));
-  const Scalar _tmp19 = 1 - 2 * std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp18 = -2 * (_target_pose[0] * _target_pose[0]);
+  const Scalar _tmp19 = 1 - 2 * (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp20 = _source_pose[0] * _tmp12;
   const Scalar _tmp21 = _source_pose[2] * _tmp10;
-  const Scalar _tmp22 = -2 * std::pow(_source_pose[0], Scalar(2));
+  const Scalar _tmp22 = -2 * (_source_pose[0] * _source_pose[0]);
   const Scalar _tmp23 = _tmp14 * (_tmp20 + _tmp21) + _tmp8 * (_tmp22 + _tmp5) +
                         _tmp9 * (_tmp15 - _tmp16) +
                         source_inverse_range * (_source_pose[6] - _target_pose[6]);
@@ -92,7 +93,7 @@ void LinearReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp27 =
       _tmp17 * (_tmp1 + _tmp3) + _tmp23 * (_tmp18 + _tmp19) + _tmp26 * (_tmp24 - _tmp25);
   const Scalar _tmp28 = Scalar(1.0) / (std::max<Scalar>(_tmp27, epsilon));
-  const Scalar _tmp29 = -2 * std::pow(_target_pose[2], Scalar(2));
+  const Scalar _tmp29 = -2 * (_target_pose[2] * _target_pose[2]);
   const Scalar _tmp30 = _target_pose[3] * _tmp0;
   const Scalar _tmp31 = _target_pose[0] * _tmp2;
 
@@ -58,16 +58,16 @@ void PolynomialReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp4 = _source_pose[0] * _tmp3;
   const Scalar _tmp5 = 2 * _source_pose[1];
   const Scalar _tmp6 = _source_pose[2] * _tmp5;
-  const Scalar _tmp7 = std::pow(Scalar(epsilon + std::pow(p_camera_source(0, 0), Scalar(2)) +
-                                       std::pow(p_camera_source(1, 0), Scalar(2)) +
-                                       std::pow(p_camera_source(2, 0), Scalar(2))),
-                                Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp7 =
+      Scalar(1.0) / std::sqrt(Scalar(epsilon + (p_camera_source(0, 0) * p_camera_source(0, 0)) +
+                                     (p_camera_source(1, 0) * p_camera_source(1, 0)) +
+                                     (p_camera_source(2, 0) * p_camera_source(2, 0))));
   const Scalar _tmp8 = _tmp7 * p_camera_source(1, 0);
   const Scalar _tmp9 = 2 * _source_pose[0] * _source_pose[2];
   const Scalar _tmp10 = _source_pose[3] * _tmp5;
   const Scalar _tmp11 = _tmp7 * p_camera_source(0, 0);
-  const Scalar _tmp12 = -2 * std::pow(_source_pose[0], Scalar(2));
-  const Scalar _tmp13 = 1 - 2 * std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp12 = -2 * (_source_pose[0] * _source_pose[0]);
+  const Scalar _tmp13 = 1 - 2 * (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp14 = _tmp7 * p_camera_source(2, 0);
   const Scalar _tmp15 = _tmp11 * (-_tmp10 + _tmp9) + _tmp14 * (_tmp12 + _tmp13) +
                         _tmp8 * (_tmp4 + _tmp6) +
@@ -77,36 +77,30 @@ void PolynomialReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp18 = _target_pose[1] * _tmp17;
   const Scalar _tmp19 = _source_pose[0] * _tmp5;
   const Scalar _tmp20 = _source_pose[2] * _tmp3;
-  const Scalar _tmp21 = -2 * std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp21 = -2 * (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp22 = _tmp11 * (_tmp19 + _tmp20) + _tmp14 * (-_tmp4 + _tmp6) +
                         _tmp8 * (_tmp12 + _tmp21 + 1) +
                         source_inverse_range * (_source_pose[5] - _target_pose[5]);
-  const Scalar _tmp23 = -2 * std::pow(_target_pose[2], Scalar(2));
-  const Scalar _tmp24 = 1 - 2 * std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp23 = -2 * (_target_pose[2] * _target_pose[2]);
+  const Scalar _tmp24 = 1 - 2 * (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp25 = _tmp11 * (_tmp13 + _tmp21) + _tmp14 * (_tmp10 + _tmp9) +
                         _tmp8 * (_tmp19 - _tmp20) +
                         source_inverse_range * (_source_pose[4] - _target_pose[4]);
   const Scalar _tmp26 =
       _tmp15 * (_tmp1 - _tmp2) + _tmp22 * (_tmp16 + _tmp18) + _tmp25 * (_tmp23 + _tmp24);
-  const Scalar _tmp27 = -2 * std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp27 = -2 * (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp28 = _target_pose[1] * _tmp0;
   const Scalar _tmp29 = _target_pose[3] * _tmp17;
   const Scalar _tmp30 =
       _tmp15 * (_tmp24 + _tmp27) + _tmp22 * (_tmp28 - _tmp29) + _tmp25 * (_tmp1 + _tmp2);
   const Scalar _tmp31 = std::max<Scalar>(_tmp30, epsilon);
-  const Scalar _tmp32 = std::pow(_tmp31, Scalar(-2));
+  const Scalar _tmp32 = Scalar(1.0) / (_tmp31 * _tmp31);
   const Scalar _tmp33 =
       _tmp15 * (_tmp28 + _tmp29) + _tmp22 * (_tmp23 + _tmp27 + 1) + _tmp25 * (-_tmp16 + _tmp18);
-  const Scalar _tmp34 =
-      std::pow(_tmp26, Scalar(2)) * _tmp32 + _tmp32 * std::pow(_tmp33, Scalar(2)) + epsilon;
+  const Scalar _tmp34 = (_tmp26 * _tmp26) * _tmp32 + _tmp32 * (_tmp33 * _tmp33) + epsilon;
   const Scalar _tmp35 =
-      (Scalar(1.0) *
-           [&]() {
-             const Scalar base = _tmp34;
-             return base * base * base;
-           }() *
-           target_calibration_storage(7, 0) +
-       Scalar(1.0) * std::pow(_tmp34, Scalar(2)) * target_calibration_storage(6, 0) +
+      (Scalar(1.0) * (_tmp34 * _tmp34 * _tmp34) * target_calibration_storage(7, 0) +
+       Scalar(1.0) * (_tmp34 * _tmp34) * target_calibration_storage(6, 0) +
        Scalar(1.0) * _tmp34 * target_calibration_storage(5, 0) + Scalar(1.0)) /
       _tmp31;
 
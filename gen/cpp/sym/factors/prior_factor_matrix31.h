@@ -24,7 +24,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x3) jacobian of res wrt arg value (3)
- *     hessian: (3x3) Gauss-Newton hessian for arg value (3)
+ *     hessian: (3x3) Gauss-Newton hessian for arg value (3). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (3x1) Gauss-Newton rhs for arg value (3)
  */
 template <typename Scalar>
@@ -76,21 +78,18 @@ void PriorFactorMatrix31(const Eigen::Matrix<Scalar, 3, 1>& value,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(sqrt_info(0, 0), Scalar(2)) + std::pow(sqrt_info(1, 0), Scalar(2)) +
-                     std::pow(sqrt_info(2, 0), Scalar(2));
+    _hessian(0, 0) = (sqrt_info(0, 0) * sqrt_info(0, 0)) + (sqrt_info(1, 0) * sqrt_info(1, 0)) +
+                     (sqrt_info(2, 0) * sqrt_info(2, 0));
     _hessian(1, 0) = sqrt_info(0, 0) * sqrt_info(0, 1) + sqrt_info(1, 0) * sqrt_info(1, 1) +
                      sqrt_info(2, 0) * sqrt_info(2, 1);
     _hessian(2, 0) = sqrt_info(0, 0) * sqrt_info(0, 2) + sqrt_info(1, 0) * sqrt_info(1, 2) +
                      sqrt_info(2, 0) * sqrt_info(2, 2);
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(sqrt_info(0, 1), Scalar(2)) + std::pow(sqrt_info(1, 1), Scalar(2)) +
-                     std::pow(sqrt_info(2, 1), Scalar(2));
+    _hessian(1, 1) = (sqrt_info(0, 1) * sqrt_info(0, 1)) + (sqrt_info(1, 1) * sqrt_info(1, 1)) +
+                     (sqrt_info(2, 1) * sqrt_info(2, 1));
     _hessian(2, 1) = sqrt_info(0, 1) * sqrt_info(0, 2) + sqrt_info(1, 1) * sqrt_info(1, 2) +
                      sqrt_info(2, 1) * sqrt_info(2, 2);
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(sqrt_info(0, 2), Scalar(2)) + std::pow(sqrt_info(1, 2), Scalar(2)) +
-                     std::pow(sqrt_info(2, 2), Scalar(2));
+    _hessian(2, 2) = (sqrt_info(0, 2) * sqrt_info(0, 2)) + (sqrt_info(1, 2) * sqrt_info(1, 2)) +
+                     (sqrt_info(2, 2) * sqrt_info(2, 2));
   }
 
   if (rhs != nullptr) {
@@ -26,7 +26,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x3) jacobian of res wrt arg value (3)
- *     hessian: (3x3) Gauss-Newton hessian for arg value (3)
+ *     hessian: (3x3) Gauss-Newton hessian for arg value (3). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (3x1) Gauss-Newton rhs for arg value (3)
  */
 template <typename Scalar>
@@ -54,15 +56,14 @@ void PriorFactorPose2(const sym::Pose2<Scalar>& value, const sym::Pose2<Scalar>&
   const Scalar _tmp8 = _tmp0 * sqrt_info(0, 1) + _tmp1 * sqrt_info(0, 2) + _tmp7 * sqrt_info(0, 0);
   const Scalar _tmp9 = _tmp0 * sqrt_info(1, 1) + _tmp1 * sqrt_info(1, 2) + _tmp7 * sqrt_info(1, 0);
   const Scalar _tmp10 = _tmp0 * sqrt_info(2, 1) + _tmp1 * sqrt_info(2, 2) + _tmp7 * sqrt_info(2, 0);
-  const Scalar _tmp11 = std::pow(_tmp6, Scalar(2));
+  const Scalar _tmp11 = (_tmp6 * _tmp6);
   const Scalar _tmp12 = _tmp5 / _tmp6 - _tmp4 * (-_tmp2 + _tmp3) / _tmp11;
-  const Scalar _tmp13 = _tmp11 + std::pow(_tmp4, Scalar(2));
+  const Scalar _tmp13 = _tmp11 + (_tmp4 * _tmp4);
   const Scalar _tmp14 = _tmp11 * _tmp12 / _tmp13;
   const Scalar _tmp15 = _tmp14 * sqrt_info(0, 0);
   const Scalar _tmp16 = _tmp14 * sqrt_info(1, 0);
   const Scalar _tmp17 = _tmp14 * sqrt_info(2, 0);
-  const Scalar _tmp18 =
-      std::pow(_tmp12, Scalar(2)) * std::pow(_tmp6, Scalar(4)) / std::pow(_tmp13, Scalar(2));
+  const Scalar _tmp18 = (_tmp12 * _tmp12) * (_tmp6 * _tmp6 * _tmp6 * _tmp6) / (_tmp13 * _tmp13);
 
   // Output terms (4)
   if (res != nullptr) {
@@ -90,20 +91,17 @@ void PriorFactorPose2(const sym::Pose2<Scalar>& value, const sym::Pose2<Scalar>&
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _hessian = (*hessian);
 
-    _hessian(0, 0) = _tmp18 * std::pow(sqrt_info(0, 0), Scalar(2)) +
-                     _tmp18 * std::pow(sqrt_info(1, 0), Scalar(2)) +
-                     _tmp18 * std::pow(sqrt_info(2, 0), Scalar(2));
+    _hessian(0, 0) = _tmp18 * (sqrt_info(0, 0) * sqrt_info(0, 0)) +
+                     _tmp18 * (sqrt_info(1, 0) * sqrt_info(1, 0)) +
+                     _tmp18 * (sqrt_info(2, 0) * sqrt_info(2, 0));
     _hessian(1, 0) = _tmp15 * sqrt_info(0, 1) + _tmp16 * sqrt_info(1, 1) + _tmp17 * sqrt_info(2, 1);
     _hessian(2, 0) = _tmp15 * sqrt_info(0, 2) + _tmp16 * sqrt_info(1, 2) + _tmp17 * sqrt_info(2, 2);
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(sqrt_info(0, 1), Scalar(2)) + std::pow(sqrt_info(1, 1), Scalar(2)) +
-                     std::pow(sqrt_info(2, 1), Scalar(2));
+    _hessian(1, 1) = (sqrt_info(0, 1) * sqrt_info(0, 1)) + (sqrt_info(1, 1) * sqrt_info(1, 1)) +
+                     (sqrt_info(2, 1) * sqrt_info(2, 1));
     _hessian(2, 1) = sqrt_info(0, 1) * sqrt_info(0, 2) + sqrt_info(1, 1) * sqrt_info(1, 2) +
                      sqrt_info(2, 1) * sqrt_info(2, 2);
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(sqrt_info(0, 2), Scalar(2)) + std::pow(sqrt_info(1, 2), Scalar(2)) +
-                     std::pow(sqrt_info(2, 2), Scalar(2));
+    _hessian(2, 2) = (sqrt_info(0, 2) * sqrt_info(0, 2)) + (sqrt_info(1, 2) * sqrt_info(1, 2)) +
+                     (sqrt_info(2, 2) * sqrt_info(2, 2));
   }
 
   if (rhs != nullptr) {
@@ -26,7 +26,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (6x6) jacobian of res wrt arg value (6)
- *     hessian: (6x6) Gauss-Newton hessian for arg value (6)
+ *     hessian: (6x6) Gauss-Newton hessian for arg value (6). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for arg value (6)
  */
 template <typename Scalar>
@@ -59,7 +61,7 @@ void PriorFactorPose3(const sym::Pose3<Scalar>& value, const sym::Pose3<Scalar>&
   const Scalar _tmp13 = 1 - epsilon;
   const Scalar _tmp14 = std::min<Scalar>(_tmp12, _tmp13);
   const Scalar _tmp15 = std::acos(_tmp14);
-  const Scalar _tmp16 = 1 - std::pow(_tmp14, Scalar(2));
+  const Scalar _tmp16 = 1 - (_tmp14 * _tmp14);
   const Scalar _tmp17 = 2 * _tmp15 / std::sqrt(_tmp16);
   const Scalar _tmp18 = _tmp11 * _tmp17;
   const Scalar _tmp19 = -_prior[6] + _value[6];
@@ -293,9 +295,8 @@ void PriorFactorPose3(const sym::Pose3<Scalar>& value, const sym::Pose3<Scalar>&
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp75, Scalar(2)) + std::pow(_tmp79, Scalar(2)) +
-                     std::pow(_tmp81, Scalar(2)) + std::pow(_tmp83, Scalar(2)) +
-                     std::pow(_tmp86, Scalar(2)) + std::pow(_tmp88, Scalar(2));
+    _hessian(0, 0) = (_tmp75 * _tmp75) + (_tmp79 * _tmp79) + (_tmp81 * _tmp81) + (_tmp83 * _tmp83) +
+                     (_tmp86 * _tmp86) + (_tmp88 * _tmp88);
     _hessian(1, 0) = _tmp102 * _tmp75 + _tmp104 * _tmp79 + _tmp105 * _tmp81 + _tmp106 * _tmp83 +
                      _tmp107 * _tmp86 + _tmp108 * _tmp88;
     _hessian(2, 0) = _tmp120 * _tmp75 + _tmp122 * _tmp79 + _tmp123 * _tmp81 + _tmp124 * _tmp83 +
@@ -309,10 +310,8 @@ void PriorFactorPose3(const sym::Pose3<Scalar>& value, const sym::Pose3<Scalar>&
     _hessian(5, 0) = _tmp75 * sqrt_info(0, 5) + _tmp79 * sqrt_info(1, 5) +
                      _tmp81 * sqrt_info(2, 5) + _tmp83 * sqrt_info(3, 5) +
                      _tmp86 * sqrt_info(4, 5) + _tmp88 * sqrt_info(5, 5);
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp102, Scalar(2)) + std::pow(_tmp104, Scalar(2)) +
-                     std::pow(_tmp105, Scalar(2)) + std::pow(_tmp106, Scalar(2)) +
-                     std::pow(_tmp107, Scalar(2)) + std::pow(_tmp108, Scalar(2));
+    _hessian(1, 1) = (_tmp102 * _tmp102) + (_tmp104 * _tmp104) + (_tmp105 * _tmp105) +
+                     (_tmp106 * _tmp106) + (_tmp107 * _tmp107) + (_tmp108 * _tmp108);
     _hessian(2, 1) = _tmp102 * _tmp120 + _tmp104 * _tmp122 + _tmp105 * _tmp123 + _tmp106 * _tmp124 +
                      _tmp107 * _tmp125 + _tmp108 * _tmp126;
     _hessian(3, 1) = _tmp102 * sqrt_info(0, 3) + _tmp104 * sqrt_info(1, 3) +
@@ -324,11 +323,8 @@ void PriorFactorPose3(const sym::Pose3<Scalar>& value, const sym::Pose3<Scalar>&
     _hessian(5, 1) = _tmp102 * sqrt_info(0, 5) + _tmp104 * sqrt_info(1, 5) +
                      _tmp105 * sqrt_info(2, 5) + _tmp106 * sqrt_info(3, 5) +
                      _tmp107 * sqrt_info(4, 5) + _tmp108 * sqrt_info(5, 5);
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp120, Scalar(2)) + std::pow(_tmp122, Scalar(2)) +
-                     std::pow(_tmp123, Scalar(2)) + std::pow(_tmp124, Scalar(2)) +
-                     std::pow(_tmp125, Scalar(2)) + std::pow(_tmp126, Scalar(2));
+    _hessian(2, 2) = (_tmp120 * _tmp120) + (_tmp122 * _tmp122) + (_tmp123 * _tmp123) +
+                     (_tmp124 * _tmp124) + (_tmp125 * _tmp125) + (_tmp126 * _tmp126);
     _hessian(3, 2) = _tmp120 * sqrt_info(0, 3) + _tmp122 * sqrt_info(1, 3) +
                      _tmp123 * sqrt_info(2, 3) + _tmp124 * sqrt_info(3, 3) +
                      _tmp125 * sqrt_info(4, 3) + _tmp126 * sqrt_info(5, 3);
@@ -338,36 +334,24 @@ void PriorFactorPose3(const sym::Pose3<Scalar>& value, const sym::Pose3<Scalar>&
     _hessian(5, 2) = _tmp120 * sqrt_info(0, 5) + _tmp122 * sqrt_info(1, 5) +
                      _tmp123 * sqrt_info(2, 5) + _tmp124 * sqrt_info(3, 5) +
                      _tmp125 * sqrt_info(4, 5) + _tmp126 * sqrt_info(5, 5);
-    _hessian(0, 3) = 0;
-    _hessian(1, 3) = 0;
-    _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(sqrt_info(0, 3), Scalar(2)) + std::pow(sqrt_info(1, 3), Scalar(2)) +
-                     std::pow(sqrt_info(2, 3), Scalar(2)) + std::pow(sqrt_info(3, 3), Scalar(2)) +
-                     std::pow(sqrt_info(4, 3), Scalar(2)) + std::pow(sqrt_info(5, 3), Scalar(2));
+    _hessian(3, 3) = (sqrt_info(0, 3) * sqrt_info(0, 3)) + (sqrt_info(1, 3) * sqrt_info(1, 3)) +
+                     (sqrt_info(2, 3) * sqrt_info(2, 3)) + (sqrt_info(3, 3) * sqrt_info(3, 3)) +
+                     (sqrt_info(4, 3) * sqrt_info(4, 3)) + (sqrt_info(5, 3) * sqrt_info(5, 3));
     _hessian(4, 3) = sqrt_info(0, 3) * sqrt_info(0, 4) + sqrt_info(1, 3) * sqrt_info(1, 4) +
                      sqrt_info(2, 3) * sqrt_info(2, 4) + sqrt_info(3, 3) * sqrt_info(3, 4) +
                      sqrt_info(4, 3) * sqrt_info(4, 4) + sqrt_info(5, 3) * sqrt_info(5, 4);
     _hessian(5, 3) = sqrt_info(0, 3) * sqrt_info(0, 5) + sqrt_info(1, 3) * sqrt_info(1, 5) +
                      sqrt_info(2, 3) * sqrt_info(2, 5) + sqrt_info(3, 3) * sqrt_info(3, 5) +
                      sqrt_info(4, 3) * sqrt_info(4, 5) + sqrt_info(5, 3) * sqrt_info(5, 5);
-    _hessian(0, 4) = 0;
-    _hessian(1, 4) = 0;
-    _hessian(2, 4) = 0;
-    _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(sqrt_info(0, 4), Scalar(2)) + std::pow(sqrt_info(1, 4), Scalar(2)) +
-                     std::pow(sqrt_info(2, 4), Scalar(2)) + std::pow(sqrt_info(3, 4), Scalar(2)) +
-                     std::pow(sqrt_info(4, 4), Scalar(2)) + std::pow(sqrt_info(5, 4), Scalar(2));
+    _hessian(4, 4) = (sqrt_info(0, 4) * sqrt_info(0, 4)) + (sqrt_info(1, 4) * sqrt_info(1, 4)) +
+                     (sqrt_info(2, 4) * sqrt_info(2, 4)) + (sqrt_info(3, 4) * sqrt_info(3, 4)) +
+                     (sqrt_info(4, 4) * sqrt_info(4, 4)) + (sqrt_info(5, 4) * sqrt_info(5, 4));
     _hessian(5, 4) = sqrt_info(0, 4) * sqrt_info(0, 5) + sqrt_info(1, 4) * sqrt_info(1, 5) +
                      sqrt_info(2, 4) * sqrt_info(2, 5) + sqrt_info(3, 4) * sqrt_info(3, 5) +
                      sqrt_info(4, 4) * sqrt_info(4, 5) + sqrt_info(5, 4) * sqrt_info(5, 5);
-    _hessian(0, 5) = 0;
-    _hessian(1, 5) = 0;
-    _hessian(2, 5) = 0;
-    _hessian(3, 5) = 0;
-    _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(sqrt_info(0, 5), Scalar(2)) + std::pow(sqrt_info(1, 5), Scalar(2)) +
-                     std::pow(sqrt_info(2, 5), Scalar(2)) + std::pow(sqrt_info(3, 5), Scalar(2)) +
-                     std::pow(sqrt_info(4, 5), Scalar(2)) + std::pow(sqrt_info(5, 5), Scalar(2));
+    _hessian(5, 5) = (sqrt_info(0, 5) * sqrt_info(0, 5)) + (sqrt_info(1, 5) * sqrt_info(1, 5)) +
+                     (sqrt_info(2, 5) * sqrt_info(2, 5)) + (sqrt_info(3, 5) * sqrt_info(3, 5)) +
+                     (sqrt_info(4, 5) * sqrt_info(4, 5)) + (sqrt_info(5, 5) * sqrt_info(5, 5));
   }
 
   if (rhs != nullptr) {
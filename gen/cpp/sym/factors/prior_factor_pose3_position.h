@@ -26,7 +26,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x6) jacobian of res wrt arg value (6)
- *     hessian: (6x6) Gauss-Newton hessian for arg value (6)
+ *     hessian: (6x6) Gauss-Newton hessian for arg value (6). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for arg value (6)
  */
 template <typename Scalar>
@@ -88,20 +90,20 @@ void PriorFactorPose3Position(const sym::Pose3<Scalar>& value,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian.setZero();
+    _hessian.template triangularView<Eigen::Lower>().setZero();
 
-    _hessian(3, 3) = std::pow(sqrt_info(0, 0), Scalar(2)) + std::pow(sqrt_info(1, 0), Scalar(2)) +
-                     std::pow(sqrt_info(2, 0), Scalar(2));
+    _hessian(3, 3) = (sqrt_info(0, 0) * sqrt_info(0, 0)) + (sqrt_info(1, 0) * sqrt_info(1, 0)) +
+                     (sqrt_info(2, 0) * sqrt_info(2, 0));
     _hessian(4, 3) = sqrt_info(0, 0) * sqrt_info(0, 1) + sqrt_info(1, 0) * sqrt_info(1, 1) +
                      sqrt_info(2, 0) * sqrt_info(2, 1);
     _hessian(5, 3) = sqrt_info(0, 0) * sqrt_info(0, 2) + sqrt_info(1, 0) * sqrt_info(1, 2) +
                      sqrt_info(2, 0) * sqrt_info(2, 2);
-    _hessian(4, 4) = std::pow(sqrt_info(0, 1), Scalar(2)) + std::pow(sqrt_info(1, 1), Scalar(2)) +
-                     std::pow(sqrt_info(2, 1), Scalar(2));
+    _hessian(4, 4) = (sqrt_info(0, 1) * sqrt_info(0, 1)) + (sqrt_info(1, 1) * sqrt_info(1, 1)) +
+                     (sqrt_info(2, 1) * sqrt_info(2, 1));
     _hessian(5, 4) = sqrt_info(0, 1) * sqrt_info(0, 2) + sqrt_info(1, 1) * sqrt_info(1, 2) +
                      sqrt_info(2, 1) * sqrt_info(2, 2);
-    _hessian(5, 5) = std::pow(sqrt_info(0, 2), Scalar(2)) + std::pow(sqrt_info(1, 2), Scalar(2)) +
-                     std::pow(sqrt_info(2, 2), Scalar(2));
+    _hessian(5, 5) = (sqrt_info(0, 2) * sqrt_info(0, 2)) + (sqrt_info(1, 2) * sqrt_info(1, 2)) +
+                     (sqrt_info(2, 2) * sqrt_info(2, 2));
   }
 
   if (rhs != nullptr) {
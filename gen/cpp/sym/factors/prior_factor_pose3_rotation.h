@@ -27,7 +27,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x6) jacobian of res wrt arg value (6)
- *     hessian: (6x6) Gauss-Newton hessian for arg value (6)
+ *     hessian: (6x6) Gauss-Newton hessian for arg value (6). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (6x1) Gauss-Newton rhs for arg value (6)
  */
 template <typename Scalar>
@@ -59,7 +61,7 @@ void PriorFactorPose3Rotation(const sym::Pose3<Scalar>& value, const sym::Rot3<S
   const Scalar _tmp12 = 2 * _tmp11;
   const Scalar _tmp13 = 1 - epsilon;
   const Scalar _tmp14 = std::min<Scalar>(_tmp13, std::fabs(_tmp10));
-  const Scalar _tmp15 = std::acos(_tmp14) / std::sqrt(Scalar(1 - std::pow(_tmp14, Scalar(2))));
+  const Scalar _tmp15 = std::acos(_tmp14) / std::sqrt(Scalar(1 - (_tmp14 * _tmp14)));
   const Scalar _tmp16 = _tmp12 * _tmp15;
   const Scalar _tmp17 = _tmp16 * _tmp4;
   const Scalar _tmp18 = _prior[0] * _value[1];
@@ -90,7 +92,7 @@ void PriorFactorPose3Rotation(const sym::Pose3<Scalar>& value, const sym::Rot3<S
   const Scalar _tmp42 = _tmp38 - _tmp39 + _tmp40 - _tmp41;
   const Scalar _tmp43 = std::fabs(_tmp5 + _tmp6 + _tmp7 + _tmp8);
   const Scalar _tmp44 = std::min<Scalar>(_tmp13, _tmp43);
-  const Scalar _tmp45 = 1 - std::pow(_tmp44, Scalar(2));
+  const Scalar _tmp45 = 1 - (_tmp44 * _tmp44);
   const Scalar _tmp46 = _tmp11 * ((((_tmp13 - _tmp43) > 0) - ((_tmp13 - _tmp43) < 0)) + 1) *
                         (((-_tmp5 + _tmp9) > 0) - ((-_tmp5 + _tmp9) < 0));
   const Scalar _tmp47 = _tmp46 / _tmp45;
@@ -213,17 +215,14 @@ void PriorFactorPose3Rotation(const sym::Pose3<Scalar>& value, const sym::Rot3<S
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian.setZero();
+    _hessian.template triangularView<Eigen::Lower>().setZero();
 
-    _hessian(0, 0) =
-        std::pow(_tmp76, Scalar(2)) + std::pow(_tmp81, Scalar(2)) + std::pow(_tmp85, Scalar(2));
+    _hessian(0, 0) = (_tmp76 * _tmp76) + (_tmp81 * _tmp81) + (_tmp85 * _tmp85);
     _hessian(1, 0) = _tmp76 * _tmp94 + _tmp81 * _tmp95 + _tmp85 * _tmp96;
     _hessian(2, 0) = _tmp103 * _tmp76 + _tmp104 * _tmp81 + _tmp105 * _tmp85;
-    _hessian(1, 1) =
-        std::pow(_tmp94, Scalar(2)) + std::pow(_tmp95, Scalar(2)) + std::pow(_tmp96, Scalar(2));
+    _hessian(1, 1) = (_tmp94 * _tmp94) + (_tmp95 * _tmp95) + (_tmp96 * _tmp96);
     _hessian(2, 1) = _tmp103 * _tmp94 + _tmp104 * _tmp95 + _tmp105 * _tmp96;
-    _hessian(2, 2) =
-        std::pow(_tmp103, Scalar(2)) + std::pow(_tmp104, Scalar(2)) + std::pow(_tmp105, Scalar(2));
+    _hessian(2, 2) = (_tmp103 * _tmp103) + (_tmp104 * _tmp104) + (_tmp105 * _tmp105);
   }
 
   if (rhs != nullptr) {
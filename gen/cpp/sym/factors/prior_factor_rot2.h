@@ -26,7 +26,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (1x1) jacobian of res wrt arg value (1)
- *     hessian: (1x1) Gauss-Newton hessian for arg value (1)
+ *     hessian: (1x1) Gauss-Newton hessian for arg value (1). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (1x1) Gauss-Newton rhs for arg value (1)
  */
 template <typename Scalar>
@@ -49,11 +51,11 @@ void PriorFactorRot2(const sym::Rot2<Scalar>& value, const sym::Rot2<Scalar>& pr
   const Scalar _tmp3 = _prior[0] * _value[0] + _prior[1] * _value[1];
   const Scalar _tmp4 = _tmp3 + epsilon * ((((_tmp3) > 0) - ((_tmp3) < 0)) + Scalar(0.5));
   const Scalar _tmp5 = std::atan2(_tmp2, _tmp4);
-  const Scalar _tmp6 = std::pow(_tmp4, Scalar(2));
-  const Scalar _tmp7 = std::pow(_tmp2, Scalar(2)) + _tmp6;
+  const Scalar _tmp6 = (_tmp4 * _tmp4);
+  const Scalar _tmp7 = (_tmp2 * _tmp2) + _tmp6;
   const Scalar _tmp8 = -_tmp2 * (_tmp0 - _tmp1) / _tmp6 + _tmp3 / _tmp4;
   const Scalar _tmp9 = _tmp6 * _tmp8 / _tmp7;
-  const Scalar _tmp10 = std::pow(sqrt_info(0, 0), Scalar(2));
+  const Scalar _tmp10 = (sqrt_info(0, 0) * sqrt_info(0, 0));
 
   // Output terms (4)
   if (res != nullptr) {
@@ -71,8 +73,7 @@ void PriorFactorRot2(const sym::Rot2<Scalar>& value, const sym::Rot2<Scalar>& pr
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 1, 1>& _hessian = (*hessian);
 
-    _hessian(0, 0) = _tmp10 * std::pow(_tmp4, Scalar(4)) * std::pow(_tmp8, Scalar(2)) /
-                     std::pow(_tmp7, Scalar(2));
+    _hessian(0, 0) = _tmp10 * (_tmp4 * _tmp4 * _tmp4 * _tmp4) * (_tmp8 * _tmp8) / (_tmp7 * _tmp7);
   }
 
   if (rhs != nullptr) {
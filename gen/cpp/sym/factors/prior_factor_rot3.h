@@ -26,7 +26,9 @@ namespace sym {
  *                a covariance matrix as the cholesky decomposition of the inverse. In the case
  *                of a diagonal it will contain 1/sigma values. Must match the tangent dim.
  *     jacobian: (3x3) jacobian of res wrt arg value (3)
- *     hessian: (3x3) Gauss-Newton hessian for arg value (3)
+ *     hessian: (3x3) Gauss-Newton hessian for arg value (3). Only the lower triangle is written,
+ *              the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
  *     rhs: (3x1) Gauss-Newton rhs for arg value (3)
  */
 template <typename Scalar>
@@ -58,7 +60,7 @@ void PriorFactorRot3(const sym::Rot3<Scalar>& value, const sym::Rot3<Scalar>& pr
   const Scalar _tmp12 = 2 * _tmp11;
   const Scalar _tmp13 = 1 - epsilon;
   const Scalar _tmp14 = std::min<Scalar>(_tmp13, std::fabs(_tmp10));
-  const Scalar _tmp15 = std::acos(_tmp14) / std::sqrt(Scalar(1 - std::pow(_tmp14, Scalar(2))));
+  const Scalar _tmp15 = std::acos(_tmp14) / std::sqrt(Scalar(1 - (_tmp14 * _tmp14)));
   const Scalar _tmp16 = _tmp12 * _tmp15;
   const Scalar _tmp17 = _tmp16 * _tmp4;
   const Scalar _tmp18 = _prior[3] * _value[0];
@@ -89,7 +91,7 @@ void PriorFactorRot3(const sym::Rot3<Scalar>& value, const sym::Rot3<Scalar>& pr
   const Scalar _tmp41 = std::fabs(_tmp5 + _tmp6 + _tmp7 + _tmp8);
   const Scalar _tmp42 = std::min<Scalar>(_tmp13, _tmp41);
   const Scalar _tmp43 = std::acos(_tmp42);
-  const Scalar _tmp44 = 1 - std::pow(_tmp42, Scalar(2));
+  const Scalar _tmp44 = 1 - (_tmp42 * _tmp42);
   const Scalar _tmp45 = _tmp11 * ((((_tmp13 - _tmp41) > 0) - ((_tmp13 - _tmp41) < 0)) + 1) *
                         (((-_tmp5 + _tmp9) > 0) - ((-_tmp5 + _tmp9) < 0));
   const Scalar _tmp46 = _tmp42 * _tmp45 / (_tmp44 * std::sqrt(_tmp44));
@@ -101,7 +103,7 @@ void PriorFactorRot3(const sym::Rot3<Scalar>& value, const sym::Rot3<Scalar>& pr
   const Scalar _tmp52 = (Scalar(1) / Scalar(2)) * _tmp27;
   const Scalar _tmp53 = _tmp49 - _tmp50 - _tmp51 + _tmp52;
   const Scalar _tmp54 = _tmp43 * _tmp53;
-  const Scalar _tmp55 = std::pow(_tmp44, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp55 = Scalar(1.0) / std::sqrt(_tmp44);
   const Scalar _tmp56 = _tmp12 * _tmp55;
   const Scalar _tmp57 = _tmp54 * _tmp56;
   const Scalar _tmp58 = _tmp22 * sqrt_info(0, 0);
@@ -210,18 +212,12 @@ void PriorFactorRot3(const sym::Rot3<Scalar>& value, const sym::Rot3<Scalar>& pr
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _hessian = (*hessian);
 
-    _hessian(0, 0) =
-        std::pow(_tmp75, Scalar(2)) + std::pow(_tmp82, Scalar(2)) + std::pow(_tmp84, Scalar(2));
+    _hessian(0, 0) = (_tmp75 * _tmp75) + (_tmp82 * _tmp82) + (_tmp84 * _tmp84);
     _hessian(1, 0) = _tmp75 * _tmp93 + _tmp82 * _tmp95 + _tmp84 * _tmp97;
     _hessian(2, 0) = _tmp106 * _tmp75 + _tmp107 * _tmp82 + _tmp108 * _tmp84;
-    _hessian(0, 1) = 0;
-    _hessian(1, 1) =
-        std::pow(_tmp93, Scalar(2)) + std::pow(_tmp95, Scalar(2)) + std::pow(_tmp97, Scalar(2));
+    _hessian(1, 1) = (_tmp93 * _tmp93) + (_tmp95 * _tmp95) + (_tmp97 * _tmp97);
     _hessian(2, 1) = _tmp106 * _tmp93 + _tmp107 * _tmp95 + _tmp108 * _tmp97;
-    _hessian(0, 2) = 0;
-    _hessian(1, 2) = 0;
-    _hessian(2, 2) =
-        std::pow(_tmp106, Scalar(2)) + std::pow(_tmp107, Scalar(2)) + std::pow(_tmp108, Scalar(2));
+    _hessian(2, 2) = (_tmp106 * _tmp106) + (_tmp107 * _tmp107) + (_tmp108 * _tmp108);
   }
 
   if (rhs != nullptr) {
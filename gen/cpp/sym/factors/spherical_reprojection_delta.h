@@ -59,16 +59,16 @@ void SphericalReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp5 = _source_pose[0] * _tmp4;
   const Scalar _tmp6 = 2 * _source_pose[1];
   const Scalar _tmp7 = _source_pose[2] * _tmp6;
-  const Scalar _tmp8 = std::pow(Scalar(epsilon + std::pow(p_camera_source(0, 0), Scalar(2)) +
-                                       std::pow(p_camera_source(1, 0), Scalar(2)) +
-                                       std::pow(p_camera_source(2, 0), Scalar(2))),
-                                Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp8 =
+      Scalar(1.0) / std::sqrt(Scalar(epsilon + (p_camera_source(0, 0) * p_camera_source(0, 0)) +
+                                     (p_camera_source(1, 0) * p_camera_source(1, 0)) +
+                                     (p_camera_source(2, 0) * p_camera_source(2, 0))));
   const Scalar _tmp9 = _tmp8 * p_camera_source(1, 0);
   const Scalar _tmp10 = 2 * _source_pose[0] * _source_pose[2];
   const Scalar _tmp11 = _source_pose[1] * _tmp4;
   const Scalar _tmp12 = _tmp8 * p_camera_source(0, 0);
-  const Scalar _tmp13 = -2 * std::pow(_source_pose[0], Scalar(2));
-  const Scalar _tmp14 = 1 - 2 * std::pow(_source_pose[1], Scalar(2));
+  const Scalar _tmp13 = -2 * (_source_pose[0] * _source_pose[0]);
+  const Scalar _tmp14 = 1 - 2 * (_source_pose[1] * _source_pose[1]);
   const Scalar _tmp15 = _tmp8 * p_camera_source(2, 0);
   const Scalar _tmp16 = _tmp12 * (_tmp10 - _tmp11) + _tmp15 * (_tmp13 + _tmp14) +
                         _tmp9 * (_tmp5 + _tmp7) +
@@ -77,12 +77,12 @@ void SphericalReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
   const Scalar _tmp18 = _target_pose[0] * _tmp2;
   const Scalar _tmp19 = _source_pose[0] * _tmp6;
   const Scalar _tmp20 = _source_pose[2] * _tmp4;
-  const Scalar _tmp21 = -2 * std::pow(_source_pose[2], Scalar(2));
+  const Scalar _tmp21 = -2 * (_source_pose[2] * _source_pose[2]);
   const Scalar _tmp22 = _tmp12 * (_tmp19 + _tmp20) + _tmp15 * (-_tmp5 + _tmp7) +
                         _tmp9 * (_tmp13 + _tmp21 + 1) +
                         source_inverse_range * (_source_pose[5] - _target_pose[5]);
-  const Scalar _tmp23 = -2 * std::pow(_target_pose[2], Scalar(2));
-  const Scalar _tmp24 = 1 - 2 * std::pow(_target_pose[1], Scalar(2));
+  const Scalar _tmp23 = -2 * (_target_pose[2] * _target_pose[2]);
+  const Scalar _tmp24 = 1 - 2 * (_target_pose[1] * _target_pose[1]);
   const Scalar _tmp25 = _tmp12 * (_tmp14 + _tmp21) + _tmp15 * (_tmp10 + _tmp11) +
                         _tmp9 * (_tmp19 - _tmp20) +
                         source_inverse_range * (_source_pose[4] - _target_pose[4]);
@@ -90,23 +90,17 @@ void SphericalReprojectionDelta(const sym::Pose3<Scalar>& source_pose,
       _tmp16 * (_tmp1 - _tmp3) + _tmp22 * (_tmp17 + _tmp18) + _tmp25 * (_tmp23 + _tmp24);
   const Scalar _tmp27 = _target_pose[2] * _tmp2;
   const Scalar _tmp28 = 2 * _target_pose[0] * _target_pose[3];
-  const Scalar _tmp29 = -2 * std::pow(_target_pose[0], Scalar(2));
+  const Scalar _tmp29 = -2 * (_target_pose[0] * _target_pose[0]);
   const Scalar _tmp30 =
       _tmp16 * (_tmp27 + _tmp28) + _tmp22 * (_tmp23 + _tmp29 + 1) + _tmp25 * (-_tmp17 + _tmp18);
-  const Scalar _tmp31 =
-      std::sqrt(Scalar(std::pow(_tmp26, Scalar(2)) + std::pow(_tmp30, Scalar(2)) + epsilon));
+  const Scalar _tmp31 = std::sqrt(Scalar((_tmp26 * _tmp26) + (_tmp30 * _tmp30) + epsilon));
   const Scalar _tmp32 = std::atan2(
       _tmp31, _tmp16 * (_tmp24 + _tmp29) + _tmp22 * (_tmp27 - _tmp28) + _tmp25 * (_tmp1 + _tmp3));
   const Scalar _tmp33 = std::min<Scalar>(_tmp32, -epsilon + target_calibration_storage(4, 0));
   const Scalar _tmp34 = (std::pow(_tmp33, Scalar(9)) * target_calibration_storage(8, 0) +
                          std::pow(_tmp33, Scalar(7)) * target_calibration_storage(7, 0) +
                          std::pow(_tmp33, Scalar(5)) * target_calibration_storage(6, 0) +
-                         [&]() {
-                           const Scalar base = _tmp33;
-                           return base * base * base;
-                         }() *
-                             target_calibration_storage(5, 0) +
-                         _tmp33) /
+                         (_tmp33 * _tmp33 * _tmp33) * target_calibration_storage(5, 0) + _tmp33) /
                         _tmp31;
 
   // Output terms (2)
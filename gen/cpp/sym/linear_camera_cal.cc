@@ -88,7 +88,7 @@ Eigen::Matrix<Scalar, 2, 1> LinearCameraCal<Scalar>::PixelFromCameraPointWithJac
   const Scalar _tmp3 = _self[1] * _tmp1;
   const Scalar _tmp4 = (Scalar(1) / Scalar(2)) *
                        ((((-epsilon + point(2, 0)) > 0) - ((-epsilon + point(2, 0)) < 0)) + 1) /
-                       std::pow(_tmp0, Scalar(2));
+                       (_tmp0 * _tmp0);
 
   // Output terms (4)
   Eigen::Matrix<Scalar, 2, 1> _pixel;
@@ -195,8 +195,8 @@ Eigen::Matrix<Scalar, 3, 1> LinearCameraCal<Scalar>::CameraRayFromPixelWithJacob
 
     _point_D_cal.setZero();
 
-    _point_D_cal(0, 0) = -_tmp0 / std::pow(_self[0], Scalar(2));
-    _point_D_cal(1, 1) = -_tmp2 / std::pow(_self[1], Scalar(2));
+    _point_D_cal(0, 0) = -_tmp0 / (_self[0] * _self[0]);
+    _point_D_cal(1, 1) = -_tmp2 / (_self[1] * _self[1]);
     _point_D_cal(0, 2) = -_tmp1;
     _point_D_cal(1, 3) = -_tmp3;
   }
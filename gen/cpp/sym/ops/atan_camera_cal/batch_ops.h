@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/atan_camera_cal.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.cam.atan_camera_cal.ATANCameraCal'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<ATANCameraCal<Scalar>> {
+  /**
+   * Projects each point in the camera frame into pixel coordinates.
+   */
+  static void PixelFromCameraPoint(const size_t count, const size_t stride,
+                                   const Scalar* const __restrict__ self,
+                                   const Scalar* const __restrict__ point,
+                                   const Scalar* const __restrict__ epsilon,
+                                   Scalar* const __restrict__ pixel,
+                                   Scalar* const __restrict__ is_valid) {
+    // Total ops: 25
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (4)
+      const Scalar _tmp0 = std::max<Scalar>(Scalar(epsilon[0]), Scalar(point[2 * stride + k]));
+      const Scalar _tmp1 = Scalar(1.0) / (_tmp0 * _tmp0);
+      const Scalar _tmp2 =
+          std::sqrt(Scalar(_tmp1 * (point[1 * stride + k] * point[1 * stride + k]) +
+                           _tmp1 * (point[k] * point[k]) + epsilon[0]));
+      const Scalar _tmp3 =
+          std::atan(2 * _tmp2 * std::tan(Scalar(0.5) * self[4])) / (_tmp0 * _tmp2 * self[4]);
+
+      // Output terms (2)
+      pixel[k] = _tmp3 * point[k] * self[0] + self[2];
+      pixel[1 * stride + k] = _tmp3 * point[1 * stride + k] * self[1] + self[3];
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0), Scalar((((point[2 * stride + k]) > 0) - ((point[2 * stride + k]) < 0))));
+    }
+  }
+
+  /**
+   * Backprojects each pixel into a ray in the camera frame (NOT normalized).
+   */
+  static void CameraRayFromPixel(const size_t count, const size_t stride,
+                                 const Scalar* const __restrict__ self,
+                                 const Scalar* const __restrict__ pixel,
+                                 const Scalar* const __restrict__ epsilon,
+                                 Scalar* const __restrict__ camera_ray,
+                                 Scalar* const __restrict__ is_valid) {
+    // Total ops: 27
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (5)
+      const Scalar _tmp0 = pixel[k] - self[2];
+      const Scalar _tmp1 = pixel[1 * stride + k] - self[3];
+      const Scalar _tmp2 = std::sqrt(Scalar((_tmp0 * _tmp0) / (self[0] * self[0]) +
+                                            (_tmp1 * _tmp1) / (self[1] * self[1]) + epsilon[0]));
+      const Scalar _tmp3 = _tmp2 * self[4];
+      const Scalar _tmp4 =
+          (Scalar(1) / Scalar(2)) * std::tan(_tmp3) / (_tmp2 * std::tan(Scalar(0.5) * self[4]));
+
+      // Output terms (2)
+      camera_ray[k] = _tmp0 * _tmp4 / self[0];
+      camera_ray[1 * stride + k] = _tmp1 * _tmp4 / self[1];
+      camera_ray[2 * stride + k] = 1;
+
+      is_valid[k] =
+          std::max<Scalar>(Scalar(0), Scalar((((-std::fabs(_tmp3) + Scalar(M_PI_2)) > 0) -
+                                              ((-std::fabs(_tmp3) + Scalar(M_PI_2)) < 0))));
+    }
+  }
+};
+
+}  // namespace sym
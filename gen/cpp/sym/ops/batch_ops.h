@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     geo_package/ops/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "./storage_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps concept, specialized per type in sym/ops/<type>/batch_ops.h, which is not included
+ * by the header of the type.
+ *
+ * Operations on count instances at once, as loops with no heap allocations or branches, which
+ * compilers can vectorize: group and Lie group operations for geo types, and projection and
+ * backprojection of points for camera calibrations.  Every argument is a flat array in
+ * structure-of-arrays layout: entry i of the storage of instance k is at arg[i * stride + k].
+ * ToStructureOfArrays and FromStructureOfArrays convert from and to arrays of objects.  epsilon,
+ * and the calibration (self) of camera operations, are shared by every instance.  Outputs must not
+ * alias inputs.
+ *
+ * See the kernels generated with CppConfig(generate_kernel=True), which these are, for the
+ * compiler flags which let the loops vectorize.  To split the work across threads, call these on
+ * contiguous ranges of instances with sym::ParallelForBlocks.
+ */
+template <typename T>
+struct BatchOps;
+
+/**
+ * Writes the storage of values[0, count) into soa in structure-of-arrays layout, where entry i of
+ * the storage of values[k] is at soa[i * stride + k].  stride must be at least count.
+ */
+template <typename T>
+void ToStructureOfArrays(const T* const values, const size_t count, const size_t stride,
+                         typename StorageOps<T>::Scalar* const soa) {
+  typename StorageOps<T>::Scalar storage[StorageOps<T>::StorageDim()];
+  for (size_t k = 0; k < count; k++) {
+    StorageOps<T>::ToStorage(values[k], storage);
+    for (int i = 0; i < StorageOps<T>::StorageDim(); i++) {
+      soa[i * stride + k] = storage[i];
+    }
+  }
+}
+
+/**
+ * Reads values[0, count) from soa in structure-of-arrays layout, see ToStructureOfArrays.
+ */
+template <typename T>
+void FromStructureOfArrays(const typename StorageOps<T>::Scalar* const soa, const size_t count,
+                           const size_t stride, T* const values) {
+  typename StorageOps<T>::Scalar storage[StorageOps<T>::StorageDim()];
+  for (size_t k = 0; k < count; k++) {
+    for (int i = 0; i < StorageOps<T>::StorageDim(); i++) {
+      storage[i] = soa[i * stride + k];
+    }
+    values[k] = StorageOps<T>::FromStorage(storage);
+  }
+}
+
+}  // namespace sym
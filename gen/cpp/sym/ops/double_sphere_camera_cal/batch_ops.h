@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/double_sphere_camera_cal.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class
+ * 'symforce.cam.double_sphere_camera_cal.DoubleSphereCameraCal'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<DoubleSphereCameraCal<Scalar>> {
+  /**
+   * Projects each point in the camera frame into pixel coordinates.
+   */
+  static void PixelFromCameraPoint(const size_t count, const size_t stride,
+                                   const Scalar* const __restrict__ self,
+                                   const Scalar* const __restrict__ point,
+                                   const Scalar* const __restrict__ epsilon,
+                                   Scalar* const __restrict__ pixel,
+                                   Scalar* const __restrict__ is_valid) {
+    // Total ops: 73
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (13)
+      const Scalar _tmp0 = (epsilon[0] * epsilon[0]) +
+                           (point[1 * stride + k] * point[1 * stride + k]) + (point[k] * point[k]);
+      const Scalar _tmp1 =
+          std::sqrt(Scalar(_tmp0 + (point[2 * stride + k] * point[2 * stride + k])));
+      const Scalar _tmp2 = _tmp1 * self[4] + point[2 * stride + k];
+      const Scalar _tmp3 = std::min<Scalar>(
+          Scalar(0), Scalar((((self[5] + Scalar(-0.5)) > 0) - ((self[5] + Scalar(-0.5)) < 0))));
+      const Scalar _tmp4 = 2 * _tmp3;
+      const Scalar _tmp5 = -epsilon[0] * (_tmp4 + 1) + self[5];
+      const Scalar _tmp6 = -_tmp5;
+      const Scalar _tmp7 =
+          Scalar(1.0) /
+          (std::max<Scalar>(
+              Scalar(epsilon[0]),
+              Scalar(_tmp2 * (_tmp6 + 1) + _tmp5 * std::sqrt(Scalar(_tmp0 + (_tmp2 * _tmp2))))));
+      const Scalar _tmp8 = _tmp3 + _tmp5;
+      const Scalar _tmp9 = (Scalar(1) / Scalar(2)) * _tmp4 + _tmp6 + 1;
+      const Scalar _tmp10 = (self[4] * self[4]);
+      const Scalar _tmp11 = (_tmp9 * _tmp9) / (_tmp8 * _tmp8);
+      const Scalar _tmp12 = _tmp10 * _tmp11 - _tmp10 + 1;
+
+      // Output terms (2)
+      pixel[k] = _tmp7 * point[k] * self[0] + self[2];
+      pixel[1 * stride + k] = _tmp7 * point[1 * stride + k] * self[1] + self[3];
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0),
+          Scalar(std::min<Scalar>(
+              Scalar(std::max<Scalar>(
+                  Scalar(-(((self[4] - 1) > 0) - ((self[4] - 1) < 0))),
+                  Scalar(1 - std::max<Scalar>(
+                                 Scalar(0),
+                                 Scalar(-(((_tmp1 + point[2 * stride + k] * self[4]) > 0) -
+                                          ((_tmp1 + point[2 * stride + k] * self[4]) < 0))))))),
+              Scalar(std::max<Scalar>(
+                  Scalar(-(((_tmp12) > 0) - ((_tmp12) < 0))),
+                  Scalar(
+                      1 -
+                      std::max<Scalar>(
+                          Scalar(0),
+                          Scalar(-(
+                              ((-_tmp1 * (_tmp11 * self[4] - self[4] -
+                                          _tmp9 *
+                                              std::sqrt(Scalar(std::max<Scalar>(
+                                                  Scalar(_tmp12), Scalar(std::sqrt(epsilon[0]))))) /
+                                              _tmp8) +
+                                point[2 * stride + k]) > 0) -
+                              ((-_tmp1 * (_tmp11 * self[4] - self[4] -
+                                          _tmp9 *
+                                              std::sqrt(Scalar(std::max<Scalar>(
+                                                  Scalar(_tmp12), Scalar(std::sqrt(epsilon[0]))))) /
+                                              _tmp8) +
+                                point[2 * stride + k]) < 0))))))))));
+    }
+  }
+
+  /**
+   * Backprojects each pixel into a ray in the camera frame (NOT normalized).
+   */
+  static void CameraRayFromPixel(const size_t count, const size_t stride,
+                                 const Scalar* const __restrict__ self,
+                                 const Scalar* const __restrict__ pixel,
+                                 const Scalar* const __restrict__ epsilon,
+                                 Scalar* const __restrict__ camera_ray,
+                                 Scalar* const __restrict__ is_valid) {
+    // Total ops: 62
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (12)
+      const Scalar _tmp0 = pixel[k] - self[2];
+      const Scalar _tmp1 = pixel[1 * stride + k] - self[3];
+      const Scalar _tmp2 =
+          (_tmp0 * _tmp0) / (self[0] * self[0]) + (_tmp1 * _tmp1) / (self[1] * self[1]);
+      const Scalar _tmp3 = -_tmp2 * (self[5] * self[5]) + 1;
+      const Scalar _tmp4 = -_tmp2 * (2 * self[5] - 1) + 1;
+      const Scalar _tmp5 =
+          self[5] * std::sqrt(Scalar(std::max<Scalar>(Scalar(_tmp4), Scalar(epsilon[0])))) -
+          self[5] + 1;
+      const Scalar _tmp6 =
+          _tmp5 +
+          epsilon[0] *
+              (2 * std::min<Scalar>(Scalar(0), Scalar((((_tmp5) > 0) - ((_tmp5) < 0)))) + 1);
+      const Scalar _tmp7 = (_tmp3 * _tmp3) / (_tmp6 * _tmp6);
+      const Scalar _tmp8 = _tmp2 + _tmp7;
+      const Scalar _tmp9 = _tmp3 / _tmp6;
+      const Scalar _tmp10 = _tmp2 * (1 - (self[4] * self[4])) + _tmp7;
+      const Scalar _tmp11 =
+          (_tmp9 * self[4] +
+           std::sqrt(Scalar(std::max<Scalar>(Scalar(_tmp10), Scalar(epsilon[0]))))) /
+          (_tmp8 +
+           epsilon[0] *
+               (2 * std::min<Scalar>(Scalar(0), Scalar((((_tmp8) > 0) - ((_tmp8) < 0)))) + 1));
+
+      // Output terms (2)
+      camera_ray[k] = _tmp0 * _tmp11 / self[0];
+      camera_ray[1 * stride + k] = _tmp1 * _tmp11 / self[1];
+      camera_ray[2 * stride + k] = _tmp11 * _tmp9 - self[4];
+
+      is_valid[k] = std::min<Scalar>(
+          Scalar(1 - std::max<Scalar>(Scalar(0), Scalar(-(((_tmp10) > 0) - ((_tmp10) < 0))))),
+          Scalar(1 - std::max<Scalar>(Scalar(0), Scalar(-(((_tmp4) > 0) - ((_tmp4) < 0))))));
+    }
+  }
+};
+
+}  // namespace sym
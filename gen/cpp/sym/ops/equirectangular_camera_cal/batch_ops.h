@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/equirectangular_camera_cal.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class
+ * 'symforce.cam.equirectangular_camera_cal.EquirectangularCameraCal'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<EquirectangularCameraCal<Scalar>> {
+  /**
+   * Projects each point in the camera frame into pixel coordinates.
+   */
+  static void PixelFromCameraPoint(const size_t count, const size_t stride,
+                                   const Scalar* const __restrict__ self,
+                                   const Scalar* const __restrict__ point,
+                                   const Scalar* const __restrict__ epsilon,
+                                   Scalar* const __restrict__ pixel,
+                                   Scalar* const __restrict__ is_valid) {
+    // Total ops: 19
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (1)
+      const Scalar _tmp0 = (point[2 * stride + k] * point[2 * stride + k]) + (point[k] * point[k]);
+
+      // Output terms (2)
+      pixel[k] = self[0] * std::atan2(point[k], epsilon[0] * ((((point[2 * stride + k]) > 0) -
+                                                               ((point[2 * stride + k]) < 0)) +
+                                                              Scalar(0.5)) +
+                                                    point[2 * stride + k]) +
+                 self[2];
+      pixel[1 * stride + k] =
+          self[1] * std::atan2(point[1 * stride + k], std::sqrt(Scalar(_tmp0 + epsilon[0]))) +
+          self[3];
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0), Scalar((((_tmp0 + (point[1 * stride + k] * point[1 * stride + k])) > 0) -
+                             ((_tmp0 + (point[1 * stride + k] * point[1 * stride + k])) < 0))));
+    }
+  }
+
+  /**
+   * Backprojects each pixel into a ray in the camera frame (NOT normalized).
+   */
+  static void CameraRayFromPixel(const size_t count, const size_t stride,
+                                 const Scalar* const __restrict__ self,
+                                 const Scalar* const __restrict__ pixel,
+                                 const Scalar* const __restrict__ epsilon,
+                                 Scalar* const __restrict__ camera_ray,
+                                 Scalar* const __restrict__ is_valid) {
+    // Total ops: 19
+
+    // Unused inputs
+    (void)epsilon;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (3)
+      const Scalar _tmp0 = (pixel[1 * stride + k] - self[3]) / self[1];
+      const Scalar _tmp1 = std::cos(_tmp0);
+      const Scalar _tmp2 = (pixel[k] - self[2]) / self[0];
+
+      // Output terms (2)
+      camera_ray[k] = _tmp1 * std::sin(_tmp2);
+      camera_ray[1 * stride + k] = std::sin(_tmp0);
+      camera_ray[2 * stride + k] = _tmp1 * std::cos(_tmp2);
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0),
+          Scalar(std::min<Scalar>(Scalar((((Scalar(M_PI) - std::fabs(_tmp2)) > 0) -
+                                          ((Scalar(M_PI) - std::fabs(_tmp2)) < 0))),
+                                  Scalar((((-std::fabs(_tmp0) + Scalar(M_PI_2)) > 0) -
+                                          ((-std::fabs(_tmp0) + Scalar(M_PI_2)) < 0))))));
+    }
+  }
+};
+
+}  // namespace sym
@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/linear_camera_cal.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.cam.linear_camera_cal.LinearCameraCal'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<LinearCameraCal<Scalar>> {
+  /**
+   * Projects each point in the camera frame into pixel coordinates.
+   */
+  static void PixelFromCameraPoint(const size_t count, const size_t stride,
+                                   const Scalar* const __restrict__ self,
+                                   const Scalar* const __restrict__ point,
+                                   const Scalar* const __restrict__ epsilon,
+                                   Scalar* const __restrict__ pixel,
+                                   Scalar* const __restrict__ is_valid) {
+    // Total ops: 10
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (1)
+      const Scalar _tmp0 =
+          Scalar(1.0) / (std::max<Scalar>(Scalar(epsilon[0]), Scalar(point[2 * stride + k])));
+
+      // Output terms (2)
+      pixel[k] = _tmp0 * point[k] * self[0] + self[2];
+      pixel[1 * stride + k] = _tmp0 * point[1 * stride + k] * self[1] + self[3];
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0), Scalar((((point[2 * stride + k]) > 0) - ((point[2 * stride + k]) < 0))));
+    }
+  }
+
+  /**
+   * Backprojects each pixel into a ray in the camera frame (NOT normalized).
+   */
+  static void CameraRayFromPixel(const size_t count, const size_t stride,
+                                 const Scalar* const __restrict__ self,
+                                 const Scalar* const __restrict__ pixel,
+                                 const Scalar* const __restrict__ epsilon,
+                                 Scalar* const __restrict__ camera_ray,
+                                 Scalar* const __restrict__ is_valid) {
+    // Total ops: 4
+
+    // Unused inputs
+    (void)epsilon;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (2)
+      camera_ray[k] = (pixel[k] - self[2]) / self[0];
+      camera_ray[1 * stride + k] = (pixel[1 * stride + k] - self[3]) / self[1];
+      camera_ray[2 * stride + k] = 1;
+
+      is_valid[k] = 1;
+    }
+  }
+};
+
+}  // namespace sym
@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/polynomial_camera_cal.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.cam.polynomial_camera_cal.PolynomialCameraCal'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<PolynomialCameraCal<Scalar>> {
+  /**
+   * Projects each point in the camera frame into pixel coordinates.
+   */
+  static void PixelFromCameraPoint(const size_t count, const size_t stride,
+                                   const Scalar* const __restrict__ self,
+                                   const Scalar* const __restrict__ point,
+                                   const Scalar* const __restrict__ epsilon,
+                                   Scalar* const __restrict__ pixel,
+                                   Scalar* const __restrict__ is_valid) {
+    // Total ops: 32
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (4)
+      const Scalar _tmp0 = std::max<Scalar>(Scalar(epsilon[0]), Scalar(point[2 * stride + k]));
+      const Scalar _tmp1 = Scalar(1.0) / (_tmp0 * _tmp0);
+      const Scalar _tmp2 = _tmp1 * (point[1 * stride + k] * point[1 * stride + k]) +
+                           _tmp1 * (point[k] * point[k]) + epsilon[0];
+      const Scalar _tmp3 =
+          (Scalar(1.0) * (_tmp2 * _tmp2 * _tmp2) * self[7] +
+           Scalar(1.0) * (_tmp2 * _tmp2) * self[6] + Scalar(1.0) * _tmp2 * self[5] + Scalar(1.0)) /
+          _tmp0;
+
+      // Output terms (2)
+      pixel[k] = _tmp3 * point[k] * self[0] + self[2];
+      pixel[1 * stride + k] = _tmp3 * point[1 * stride + k] * self[1] + self[3];
+
+      is_valid[k] = std::max<Scalar>(
+          Scalar(0), Scalar(std::min<Scalar>(
+                         Scalar((((point[2 * stride + k]) > 0) - ((point[2 * stride + k]) < 0))),
+                         Scalar((((-std::sqrt(_tmp2) + self[4]) > 0) -
+                                 ((-std::sqrt(_tmp2) + self[4]) < 0))))));
+    }
+  }
+};
+
+}  // namespace sym
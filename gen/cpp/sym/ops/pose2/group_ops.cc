@@ -161,7 +161,7 @@ sym::Pose2<Scalar> GroupOps<Pose2<Scalar>>::InverseWithJacobian(const sym::Pose2
   if (res_D_a != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _res_D_a = (*res_D_a);
 
-    _res_D_a(0, 0) = -std::pow(_a[0], Scalar(2)) - std::pow(_a[1], Scalar(2));
+    _res_D_a(0, 0) = -(_a[0] * _a[0]) - (_a[1] * _a[1]);
     _res_D_a(1, 0) = -_tmp2 + _tmp3;
     _res_D_a(2, 0) = _tmp1;
     _res_D_a(0, 1) = 0;
@@ -203,7 +203,7 @@ sym::Pose2<Scalar> GroupOps<Pose2<Scalar>>::ComposeWithJacobians(const sym::Pose
   const Scalar _tmp4 = _a[0] * _b[2] - _a[1] * _b[3];
   const Scalar _tmp5 = _a[1] * _b[2];
   const Scalar _tmp6 = _a[0] * _b[3];
-  const Scalar _tmp7 = std::pow(_tmp0, Scalar(2)) - _tmp3 * (-_tmp1 - _tmp2);
+  const Scalar _tmp7 = (_tmp0 * _tmp0) - _tmp3 * (-_tmp1 - _tmp2);
 
   // Output terms (3)
   Eigen::Matrix<Scalar, 4, 1> _res;
@@ -293,7 +293,7 @@ sym::Pose2<Scalar> GroupOps<Pose2<Scalar>>::BetweenWithJacobians(const sym::Pose
   if (res_D_a != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _res_D_a = (*res_D_a);
 
-    _res_D_a(0, 0) = _tmp2 * (-_tmp0 - _tmp1) - std::pow(_tmp5, Scalar(2));
+    _res_D_a(0, 0) = _tmp2 * (-_tmp0 - _tmp1) - (_tmp5 * _tmp5);
     _res_D_a(1, 0) = _tmp10 + _tmp11 - _tmp9;
     _res_D_a(2, 0) = _tmp6 - _tmp7 - _tmp8;
     _res_D_a(0, 1) = 0;
@@ -307,7 +307,7 @@ sym::Pose2<Scalar> GroupOps<Pose2<Scalar>>::BetweenWithJacobians(const sym::Pose
   if (res_D_b != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _res_D_b = (*res_D_b);
 
-    _res_D_b(0, 0) = std::pow(_tmp2, Scalar(2)) - _tmp5 * (_tmp3 - _tmp4);
+    _res_D_b(0, 0) = (_tmp2 * _tmp2) - _tmp5 * (_tmp3 - _tmp4);
     _res_D_b(1, 0) = 0;
     _res_D_b(2, 0) = 0;
     _res_D_b(0, 1) = 0;
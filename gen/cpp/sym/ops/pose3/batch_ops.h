@@ -0,0 +1,336 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/pose3.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.geo.pose3.Pose3'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<Pose3<Scalar>> {
+  /**
+   * Inverse of each element a.
+   */
+  static void Inverse(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      Scalar* const __restrict__ res) {
+    // Total ops: 49
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (11)
+      const Scalar _tmp0 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp1 = 1 - 2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp2 = 2 * a[k];
+      const Scalar _tmp3 = _tmp2 * a[2 * stride + k];
+      const Scalar _tmp4 = 2 * a[3 * stride + k];
+      const Scalar _tmp5 = _tmp4 * a[1 * stride + k];
+      const Scalar _tmp6 = _tmp2 * a[1 * stride + k];
+      const Scalar _tmp7 = _tmp4 * a[2 * stride + k];
+      const Scalar _tmp8 = -2 * (a[k] * a[k]);
+      const Scalar _tmp9 = 2 * a[1 * stride + k] * a[2 * stride + k];
+      const Scalar _tmp10 = _tmp2 * a[3 * stride + k];
+
+      // Output terms (1)
+      res[k] = -a[k];
+      res[1 * stride + k] = -a[1 * stride + k];
+      res[2 * stride + k] = -a[2 * stride + k];
+      res[3 * stride + k] = a[3 * stride + k];
+      res[4 * stride + k] = -a[4 * stride + k] * (_tmp0 + _tmp1) -
+                            a[5 * stride + k] * (_tmp6 + _tmp7) -
+                            a[6 * stride + k] * (_tmp3 - _tmp5);
+      res[5 * stride + k] = -a[4 * stride + k] * (_tmp6 - _tmp7) -
+                            a[5 * stride + k] * (_tmp1 + _tmp8) -
+                            a[6 * stride + k] * (_tmp10 + _tmp9);
+      res[6 * stride + k] = -a[4 * stride + k] * (_tmp3 + _tmp5) -
+                            a[5 * stride + k] * (-_tmp10 + _tmp9) -
+                            a[6 * stride + k] * (_tmp0 + _tmp8 + 1);
+    }
+  }
+
+  /**
+   * Composition of each pair of elements a and b, i.e. a * b.
+   */
+  static void Compose(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 74
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (11)
+      const Scalar _tmp0 = -2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp1 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp2 = 2 * a[k];
+      const Scalar _tmp3 = _tmp2 * a[2 * stride + k];
+      const Scalar _tmp4 = 2 * a[3 * stride + k];
+      const Scalar _tmp5 = _tmp4 * a[1 * stride + k];
+      const Scalar _tmp6 = _tmp2 * a[1 * stride + k];
+      const Scalar _tmp7 = _tmp4 * a[2 * stride + k];
+      const Scalar _tmp8 = 1 - 2 * (a[k] * a[k]);
+      const Scalar _tmp9 = 2 * a[1 * stride + k] * a[2 * stride + k];
+      const Scalar _tmp10 = _tmp2 * a[3 * stride + k];
+
+      // Output terms (1)
+      res[k] = a[1 * stride + k] * b[2 * stride + k] - a[2 * stride + k] * b[1 * stride + k] +
+               a[3 * stride + k] * b[k] + a[k] * b[3 * stride + k];
+      res[1 * stride + k] = a[1 * stride + k] * b[3 * stride + k] + a[2 * stride + k] * b[k] +
+                            a[3 * stride + k] * b[1 * stride + k] - a[k] * b[2 * stride + k];
+      res[2 * stride + k] = -a[1 * stride + k] * b[k] + a[2 * stride + k] * b[3 * stride + k] +
+                            a[3 * stride + k] * b[2 * stride + k] + a[k] * b[1 * stride + k];
+      res[3 * stride + k] = -a[1 * stride + k] * b[1 * stride + k] -
+                            a[2 * stride + k] * b[2 * stride + k] +
+                            a[3 * stride + k] * b[3 * stride + k] - a[k] * b[k];
+      res[4 * stride + k] = a[4 * stride + k] + b[4 * stride + k] * (_tmp0 + _tmp1 + 1) +
+                            b[5 * stride + k] * (_tmp6 - _tmp7) +
+                            b[6 * stride + k] * (_tmp3 + _tmp5);
+      res[5 * stride + k] = a[5 * stride + k] + b[4 * stride + k] * (_tmp6 + _tmp7) +
+                            b[5 * stride + k] * (_tmp0 + _tmp8) +
+                            b[6 * stride + k] * (-_tmp10 + _tmp9);
+      res[6 * stride + k] = a[6 * stride + k] + b[4 * stride + k] * (_tmp3 - _tmp5) +
+                            b[5 * stride + k] * (_tmp10 + _tmp9) +
+                            b[6 * stride + k] * (_tmp1 + _tmp8);
+    }
+  }
+
+  /**
+   * The element between each pair of elements a and b, i.e. a.inverse() * b.
+   */
+  static void Between(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 89
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (20)
+      const Scalar _tmp0 = -2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp1 = 1 - 2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp2 = _tmp0 + _tmp1;
+      const Scalar _tmp3 = 2 * a[k];
+      const Scalar _tmp4 = _tmp3 * a[2 * stride + k];
+      const Scalar _tmp5 = 2 * a[3 * stride + k];
+      const Scalar _tmp6 = _tmp5 * a[1 * stride + k];
+      const Scalar _tmp7 = _tmp4 - _tmp6;
+      const Scalar _tmp8 = _tmp3 * a[1 * stride + k];
+      const Scalar _tmp9 = _tmp5 * a[2 * stride + k];
+      const Scalar _tmp10 = _tmp8 + _tmp9;
+      const Scalar _tmp11 = -2 * (a[k] * a[k]);
+      const Scalar _tmp12 = _tmp0 + _tmp11 + 1;
+      const Scalar _tmp13 = 2 * a[1 * stride + k] * a[2 * stride + k];
+      const Scalar _tmp14 = _tmp3 * a[3 * stride + k];
+      const Scalar _tmp15 = _tmp13 + _tmp14;
+      const Scalar _tmp16 = _tmp8 - _tmp9;
+      const Scalar _tmp17 = _tmp1 + _tmp11;
+      const Scalar _tmp18 = _tmp13 - _tmp14;
+      const Scalar _tmp19 = _tmp4 + _tmp6;
+
+      // Output terms (1)
+      res[k] = -a[1 * stride + k] * b[2 * stride + k] + a[2 * stride + k] * b[1 * stride + k] +
+               a[3 * stride + k] * b[k] - a[k] * b[3 * stride + k];
+      res[1 * stride + k] = -a[1 * stride + k] * b[3 * stride + k] - a[2 * stride + k] * b[k] +
+                            a[3 * stride + k] * b[1 * stride + k] + a[k] * b[2 * stride + k];
+      res[2 * stride + k] = a[1 * stride + k] * b[k] - a[2 * stride + k] * b[3 * stride + k] +
+                            a[3 * stride + k] * b[2 * stride + k] - a[k] * b[1 * stride + k];
+      res[3 * stride + k] = a[1 * stride + k] * b[1 * stride + k] +
+                            a[2 * stride + k] * b[2 * stride + k] +
+                            a[3 * stride + k] * b[3 * stride + k] + a[k] * b[k];
+      res[4 * stride + k] = -_tmp10 * a[5 * stride + k] + _tmp10 * b[5 * stride + k] -
+                            _tmp2 * a[4 * stride + k] + _tmp2 * b[4 * stride + k] -
+                            _tmp7 * a[6 * stride + k] + _tmp7 * b[6 * stride + k];
+      res[5 * stride + k] = -_tmp12 * a[5 * stride + k] + _tmp12 * b[5 * stride + k] -
+                            _tmp15 * a[6 * stride + k] + _tmp15 * b[6 * stride + k] -
+                            _tmp16 * a[4 * stride + k] + _tmp16 * b[4 * stride + k];
+      res[6 * stride + k] = -_tmp17 * a[6 * stride + k] + _tmp17 * b[6 * stride + k] -
+                            _tmp18 * a[5 * stride + k] + _tmp18 * b[5 * stride + k] -
+                            _tmp19 * a[4 * stride + k] + _tmp19 * b[4 * stride + k];
+    }
+  }
+
+  /**
+   * Applies each tangent space perturbation vec to each element a.
+   */
+  static void Retract(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ vec,
+                      const Scalar* const __restrict__ epsilon, Scalar* const __restrict__ res) {
+    // Total ops: 47
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (8)
+      const Scalar _tmp0 =
+          std::sqrt(Scalar((epsilon[0] * epsilon[0]) + (vec[1 * stride + k] * vec[1 * stride + k]) +
+                           (vec[2 * stride + k] * vec[2 * stride + k]) + (vec[k] * vec[k])));
+      const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
+      const Scalar _tmp2 = std::sin(_tmp1) / _tmp0;
+      const Scalar _tmp3 = _tmp2 * vec[1 * stride + k];
+      const Scalar _tmp4 = _tmp2 * vec[2 * stride + k];
+      const Scalar _tmp5 = _tmp2 * vec[k];
+      const Scalar _tmp6 = std::cos(_tmp1);
+      const Scalar _tmp7 = _tmp2 * a[k];
+
+      // Output terms (1)
+      res[k] = -_tmp3 * a[2 * stride + k] + _tmp4 * a[1 * stride + k] + _tmp5 * a[3 * stride + k] +
+               _tmp6 * a[k];
+      res[1 * stride + k] = _tmp3 * a[3 * stride + k] + _tmp5 * a[2 * stride + k] +
+                            _tmp6 * a[1 * stride + k] - _tmp7 * vec[2 * stride + k];
+      res[2 * stride + k] = _tmp4 * a[3 * stride + k] - _tmp5 * a[1 * stride + k] +
+                            _tmp6 * a[2 * stride + k] + _tmp7 * vec[1 * stride + k];
+      res[3 * stride + k] = -_tmp3 * a[1 * stride + k] - _tmp4 * a[2 * stride + k] +
+                            _tmp6 * a[3 * stride + k] - _tmp7 * vec[k];
+      res[4 * stride + k] = a[4 * stride + k] + vec[3 * stride + k];
+      res[5 * stride + k] = a[5 * stride + k] + vec[4 * stride + k];
+      res[6 * stride + k] = a[6 * stride + k] + vec[5 * stride + k];
+    }
+  }
+
+  /**
+   * The tangent space vector of each element b in the local coordinates of a.
+   */
+  static void LocalCoordinates(const size_t count, const size_t stride,
+                               const Scalar* const __restrict__ a,
+                               const Scalar* const __restrict__ b,
+                               const Scalar* const __restrict__ epsilon,
+                               Scalar* const __restrict__ res) {
+    // Total ops: 50
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (4)
+      const Scalar _tmp0 = -a[1 * stride + k] * b[1 * stride + k] -
+                           a[2 * stride + k] * b[2 * stride + k] - a[k] * b[k];
+      const Scalar _tmp1 = a[3 * stride + k] * b[3 * stride + k];
+      const Scalar _tmp2 =
+          std::min<Scalar>(Scalar(1 - epsilon[0]), Scalar(std::fabs(_tmp0 - _tmp1)));
+      const Scalar _tmp3 =
+          2 *
+          (2 * std::min<Scalar>(Scalar(0),
+                                Scalar((((-_tmp0 + _tmp1) > 0) - ((-_tmp0 + _tmp1) < 0)))) +
+           1) *
+          std::acos(_tmp2) / std::sqrt(Scalar(1 - (_tmp2 * _tmp2)));
+
+      // Output terms (1)
+      res[k] =
+          _tmp3 * (-a[1 * stride + k] * b[2 * stride + k] + a[2 * stride + k] * b[1 * stride + k] +
+                   a[3 * stride + k] * b[k] - a[k] * b[3 * stride + k]);
+      res[1 * stride + k] =
+          _tmp3 * (-a[1 * stride + k] * b[3 * stride + k] - a[2 * stride + k] * b[k] +
+                   a[3 * stride + k] * b[1 * stride + k] + a[k] * b[2 * stride + k]);
+      res[2 * stride + k] =
+          _tmp3 * (a[1 * stride + k] * b[k] - a[2 * stride + k] * b[3 * stride + k] +
+                   a[3 * stride + k] * b[2 * stride + k] - a[k] * b[1 * stride + k]);
+      res[3 * stride + k] = -a[4 * stride + k] + b[4 * stride + k];
+      res[4 * stride + k] = -a[5 * stride + k] + b[5 * stride + k];
+      res[5 * stride + k] = -a[6 * stride + k] + b[6 * stride + k];
+    }
+  }
+
+  /**
+   * Each point transformed by each element a, i.e. a * point.
+   */
+  static void TransformPoints(const size_t count, const size_t stride,
+                              const Scalar* const __restrict__ a,
+                              const Scalar* const __restrict__ point,
+                              Scalar* const __restrict__ res) {
+    // Total ops: 46
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (11)
+      const Scalar _tmp0 = 2 * a[k];
+      const Scalar _tmp1 = _tmp0 * a[2 * stride + k];
+      const Scalar _tmp2 = 2 * a[3 * stride + k];
+      const Scalar _tmp3 = _tmp2 * a[1 * stride + k];
+      const Scalar _tmp4 = _tmp0 * a[1 * stride + k];
+      const Scalar _tmp5 = _tmp2 * a[2 * stride + k];
+      const Scalar _tmp6 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp7 = 1 - 2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp8 = 2 * a[1 * stride + k] * a[2 * stride + k];
+      const Scalar _tmp9 = _tmp0 * a[3 * stride + k];
+      const Scalar _tmp10 = -2 * (a[k] * a[k]);
+
+      // Output terms (1)
+      res[k] = a[4 * stride + k] + point[1 * stride + k] * (_tmp4 - _tmp5) +
+               point[2 * stride + k] * (_tmp1 + _tmp3) + point[k] * (_tmp6 + _tmp7);
+      res[1 * stride + k] = a[5 * stride + k] + point[1 * stride + k] * (_tmp10 + _tmp7) +
+                            point[2 * stride + k] * (_tmp8 - _tmp9) + point[k] * (_tmp4 + _tmp5);
+      res[2 * stride + k] = a[6 * stride + k] + point[1 * stride + k] * (_tmp8 + _tmp9) +
+                            point[2 * stride + k] * (_tmp10 + _tmp6 + 1) +
+                            point[k] * (_tmp1 - _tmp3);
+    }
+  }
+
+  /**
+   * Each point transformed by the inverse of each element a.
+   */
+  static void InverseTransformPoints(const size_t count, const size_t stride,
+                                     const Scalar* const __restrict__ a,
+                                     const Scalar* const __restrict__ point,
+                                     Scalar* const __restrict__ res) {
+    // Total ops: 61
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (20)
+      const Scalar _tmp0 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp1 = 1 - 2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp2 = _tmp0 + _tmp1;
+      const Scalar _tmp3 = 2 * a[k];
+      const Scalar _tmp4 = _tmp3 * a[2 * stride + k];
+      const Scalar _tmp5 = 2 * a[3 * stride + k];
+      const Scalar _tmp6 = _tmp5 * a[1 * stride + k];
+      const Scalar _tmp7 = _tmp4 - _tmp6;
+      const Scalar _tmp8 = _tmp3 * a[1 * stride + k];
+      const Scalar _tmp9 = _tmp5 * a[2 * stride + k];
+      const Scalar _tmp10 = _tmp8 + _tmp9;
+      const Scalar _tmp11 = _tmp8 - _tmp9;
+      const Scalar _tmp12 = 2 * a[1 * stride + k] * a[2 * stride + k];
+      const Scalar _tmp13 = _tmp3 * a[3 * stride + k];
+      const Scalar _tmp14 = _tmp12 + _tmp13;
+      const Scalar _tmp15 = -2 * (a[k] * a[k]);
+      const Scalar _tmp16 = _tmp1 + _tmp15;
+      const Scalar _tmp17 = _tmp4 + _tmp6;
+      const Scalar _tmp18 = _tmp12 - _tmp13;
+      const Scalar _tmp19 = _tmp0 + _tmp15 + 1;
+
+      // Output terms (1)
+      res[k] = -_tmp10 * a[5 * stride + k] + _tmp10 * point[1 * stride + k] -
+               _tmp2 * a[4 * stride + k] + _tmp2 * point[k] - _tmp7 * a[6 * stride + k] +
+               _tmp7 * point[2 * stride + k];
+      res[1 * stride + k] = -_tmp11 * a[4 * stride + k] + _tmp11 * point[k] -
+                            _tmp14 * a[6 * stride + k] + _tmp14 * point[2 * stride + k] -
+                            _tmp16 * a[5 * stride + k] + _tmp16 * point[1 * stride + k];
+      res[2 * stride + k] = -_tmp17 * a[4 * stride + k] + _tmp17 * point[k] -
+                            _tmp18 * a[5 * stride + k] + _tmp18 * point[1 * stride + k] -
+                            _tmp19 * a[6 * stride + k] + _tmp19 * point[2 * stride + k];
+    }
+  }
+};
+
+}  // namespace sym
@@ -58,15 +58,15 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::Inverse(const sym::Pose3<Scalar>& a)
   const Eigen::Matrix<Scalar, 7, 1>& _a = a.Data();
 
   // Intermediate terms (11)
-  const Scalar _tmp0 = -2 * std::pow(_a[1], Scalar(2));
-  const Scalar _tmp1 = 1 - 2 * std::pow(_a[2], Scalar(2));
+  const Scalar _tmp0 = -2 * (_a[1] * _a[1]);
+  const Scalar _tmp1 = 1 - 2 * (_a[2] * _a[2]);
   const Scalar _tmp2 = 2 * _a[0];
   const Scalar _tmp3 = _a[2] * _tmp2;
   const Scalar _tmp4 = 2 * _a[3];
   const Scalar _tmp5 = _a[1] * _tmp4;
   const Scalar _tmp6 = _a[1] * _tmp2;
   const Scalar _tmp7 = _a[2] * _tmp4;
-  const Scalar _tmp8 = -2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp8 = -2 * (_a[0] * _a[0]);
   const Scalar _tmp9 = 2 * _a[1] * _a[2];
   const Scalar _tmp10 = _a[3] * _tmp2;
 
@@ -101,15 +101,15 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::Compose(const sym::Pose3<Scalar>& a,
   const Eigen::Matrix<Scalar, 7, 1>& _b = b.Data();
 
   // Intermediate terms (11)
-  const Scalar _tmp0 = -2 * std::pow(_a[2], Scalar(2));
-  const Scalar _tmp1 = -2 * std::pow(_a[1], Scalar(2));
+  const Scalar _tmp0 = -2 * (_a[2] * _a[2]);
+  const Scalar _tmp1 = -2 * (_a[1] * _a[1]);
   const Scalar _tmp2 = 2 * _a[0];
   const Scalar _tmp3 = _a[2] * _tmp2;
   const Scalar _tmp4 = 2 * _a[3];
   const Scalar _tmp5 = _a[1] * _tmp4;
   const Scalar _tmp6 = _a[1] * _tmp2;
   const Scalar _tmp7 = _a[2] * _tmp4;
-  const Scalar _tmp8 = 1 - 2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp8 = 1 - 2 * (_a[0] * _a[0]);
   const Scalar _tmp9 = 2 * _a[1] * _a[2];
   const Scalar _tmp10 = _a[3] * _tmp2;
 
@@ -146,8 +146,8 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::Between(const sym::Pose3<Scalar>& a,
   const Eigen::Matrix<Scalar, 7, 1>& _b = b.Data();
 
   // Intermediate terms (20)
-  const Scalar _tmp0 = -2 * std::pow(_a[2], Scalar(2));
-  const Scalar _tmp1 = 1 - 2 * std::pow(_a[1], Scalar(2));
+  const Scalar _tmp0 = -2 * (_a[2] * _a[2]);
+  const Scalar _tmp1 = 1 - 2 * (_a[1] * _a[1]);
   const Scalar _tmp2 = _tmp0 + _tmp1;
   const Scalar _tmp3 = 2 * _a[0];
   const Scalar _tmp4 = _a[2] * _tmp3;
@@ -157,7 +157,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::Between(const sym::Pose3<Scalar>& a,
   const Scalar _tmp8 = _a[1] * _tmp3;
   const Scalar _tmp9 = _a[2] * _tmp5;
   const Scalar _tmp10 = _tmp8 + _tmp9;
-  const Scalar _tmp11 = -2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp11 = -2 * (_a[0] * _a[0]);
   const Scalar _tmp12 = _tmp0 + _tmp11 + 1;
   const Scalar _tmp13 = 2 * _a[1] * _a[2];
   const Scalar _tmp14 = _a[3] * _tmp3;
@@ -201,10 +201,10 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::InverseWithJacobian(const sym::Pose3
   const Eigen::Matrix<Scalar, 7, 1>& _a = a.Data();
 
   // Intermediate terms (48)
-  const Scalar _tmp0 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp0 = (_a[2] * _a[2]);
   const Scalar _tmp1 = 2 * _tmp0;
   const Scalar _tmp2 = -_tmp1;
-  const Scalar _tmp3 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp3 = (_a[1] * _a[1]);
   const Scalar _tmp4 = 2 * _tmp3;
   const Scalar _tmp5 = -_tmp4;
   const Scalar _tmp6 = 2 * _a[0];
@@ -216,7 +216,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::InverseWithJacobian(const sym::Pose3
   const Scalar _tmp12 = _a[1] * _tmp6;
   const Scalar _tmp13 = _a[2] * _tmp8;
   const Scalar _tmp14 = _a[5] * (_tmp12 + _tmp13);
-  const Scalar _tmp15 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp15 = (_a[0] * _a[0]);
   const Scalar _tmp16 = 2 * _tmp15;
   const Scalar _tmp17 = 1 - _tmp16;
   const Scalar _tmp18 = 2 * _a[1] * _a[2];
@@ -227,7 +227,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::InverseWithJacobian(const sym::Pose3
   const Scalar _tmp23 = -_tmp19;
   const Scalar _tmp24 = _a[5] * (_tmp18 + _tmp23);
   const Scalar _tmp25 = _a[4] * (_tmp7 + _tmp9);
-  const Scalar _tmp26 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp26 = (_a[3] * _a[3]);
   const Scalar _tmp27 = -_tmp26;
   const Scalar _tmp28 = _tmp0 + _tmp27;
   const Scalar _tmp29 = -_tmp15;
@@ -346,9 +346,9 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::ComposeWithJacobians(const sym::Pose
   const Scalar _tmp17 = _a[0] * _b[0];
   const Scalar _tmp18 = _a[3] * _b[3];
   const Scalar _tmp19 = -_tmp15 - _tmp16 - _tmp17 + _tmp18;
-  const Scalar _tmp20 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp20 = (_a[2] * _a[2]);
   const Scalar _tmp21 = -2 * _tmp20;
-  const Scalar _tmp22 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp22 = (_a[1] * _a[1]);
   const Scalar _tmp23 = -2 * _tmp22;
   const Scalar _tmp24 = _tmp21 + _tmp23 + 1;
   const Scalar _tmp25 = 2 * _a[0];
@@ -360,7 +360,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::ComposeWithJacobians(const sym::Pose
   const Scalar _tmp31 = _a[2] * _tmp27;
   const Scalar _tmp32 = -_tmp31;
   const Scalar _tmp33 = _tmp30 + _tmp32;
-  const Scalar _tmp34 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp34 = (_a[0] * _a[0]);
   const Scalar _tmp35 = 1 - 2 * _tmp34;
   const Scalar _tmp36 = _tmp21 + _tmp35;
   const Scalar _tmp37 = 2 * _a[1] * _a[2];
@@ -413,7 +413,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::ComposeWithJacobians(const sym::Pose
   const Scalar _tmp84 = -_tmp30;
   const Scalar _tmp85 = -_tmp22;
   const Scalar _tmp86 = _tmp34 + _tmp85;
-  const Scalar _tmp87 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp87 = (_a[3] * _a[3]);
   const Scalar _tmp88 = -_tmp87;
   const Scalar _tmp89 = _tmp20 + _tmp88;
   const Scalar _tmp90 = -_tmp34;
@@ -598,10 +598,10 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::BetweenWithJacobians(const sym::Pose
   const Scalar _tmp17 = _a[0] * _b[0];
   const Scalar _tmp18 = _a[3] * _b[3];
   const Scalar _tmp19 = _tmp15 + _tmp16 + _tmp17 + _tmp18;
-  const Scalar _tmp20 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp20 = (_a[2] * _a[2]);
   const Scalar _tmp21 = 2 * _tmp20;
   const Scalar _tmp22 = -_tmp21;
-  const Scalar _tmp23 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp23 = (_a[1] * _a[1]);
   const Scalar _tmp24 = 2 * _tmp23;
   const Scalar _tmp25 = -_tmp24;
   const Scalar _tmp26 = _tmp22 + _tmp25 + 1;
@@ -617,7 +617,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::BetweenWithJacobians(const sym::Pose
   const Scalar _tmp36 = _tmp34 + _tmp35;
   const Scalar _tmp37 = _a[5] * _tmp36;
   const Scalar _tmp38 = _b[5] * _tmp36 + _b[6] * _tmp32;
-  const Scalar _tmp39 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp39 = (_a[0] * _a[0]);
   const Scalar _tmp40 = 2 * _tmp39;
   const Scalar _tmp41 = 1 - _tmp40;
   const Scalar _tmp42 = _tmp22 + _tmp41;
@@ -675,7 +675,7 @@ sym::Pose3<Scalar> GroupOps<Pose3<Scalar>>::BetweenWithJacobians(const sym::Pose
   const Scalar _tmp94 = _tmp63 * _tmp76 + _tmp93;
   const Scalar _tmp95 = -_tmp39;
   const Scalar _tmp96 = -_tmp23;
-  const Scalar _tmp97 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp97 = (_a[3] * _a[3]);
   const Scalar _tmp98 = _tmp20 + _tmp95 + _tmp96 + _tmp97;
   const Scalar _tmp99 = _tmp39 + _tmp96;
   const Scalar _tmp100 = -_tmp97;
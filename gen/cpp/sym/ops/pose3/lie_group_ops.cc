@@ -20,9 +20,8 @@ sym::Pose3<Scalar> LieGroupOps<Pose3<Scalar>>::FromTangent(const TangentVec& vec
   // Input arrays
 
   // Intermediate terms (3)
-  const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2)) + std::pow(vec(2, 0), Scalar(2))));
+  const Scalar _tmp0 = std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) +
+                                        (vec(1, 0) * vec(1, 0)) + (vec(2, 0) * vec(2, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::sin(_tmp1) / _tmp0;
 
@@ -51,7 +50,7 @@ typename LieGroupOps<Pose3<Scalar>>::TangentVec LieGroupOps<Pose3<Scalar>>::ToTa
   // Intermediate terms (2)
   const Scalar _tmp0 = std::min<Scalar>(std::fabs(_a[3]), 1 - epsilon);
   const Scalar _tmp1 = 2 * (2 * std::min<Scalar>(0, (((_a[3]) > 0) - ((_a[3]) < 0))) + 1) *
-                       std::acos(_tmp0) / std::sqrt(Scalar(1 - std::pow(_tmp0, Scalar(2))));
+                       std::acos(_tmp0) / std::sqrt(Scalar(1 - (_tmp0 * _tmp0)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 6, 1> _res;
@@ -76,9 +75,8 @@ sym::Pose3<Scalar> LieGroupOps<Pose3<Scalar>>::Retract(const sym::Pose3<Scalar>&
   const Eigen::Matrix<Scalar, 7, 1>& _a = a.Data();
 
   // Intermediate terms (8)
-  const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2)) + std::pow(vec(2, 0), Scalar(2))));
+  const Scalar _tmp0 = std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) +
+                                        (vec(1, 0) * vec(1, 0)) + (vec(2, 0) * vec(2, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::sin(_tmp1) / _tmp0;
   const Scalar _tmp3 = _tmp2 * vec(1, 0);
@@ -116,7 +114,7 @@ typename LieGroupOps<Pose3<Scalar>>::TangentVec LieGroupOps<Pose3<Scalar>>::Loca
   const Scalar _tmp2 = std::min<Scalar>(1 - epsilon, std::fabs(_tmp0 - _tmp1));
   const Scalar _tmp3 =
       2 * (2 * std::min<Scalar>(0, (((-_tmp0 + _tmp1) > 0) - ((-_tmp0 + _tmp1) < 0))) + 1) *
-      std::acos(_tmp2) / std::sqrt(Scalar(1 - std::pow(_tmp2, Scalar(2))));
+      std::acos(_tmp2) / std::sqrt(Scalar(1 - (_tmp2 * _tmp2)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 6, 1> _res;
@@ -151,13 +149,11 @@ sym::Pose3<Scalar> LieGroupOps<Pose3<Scalar>>::Interpolate(const sym::Pose3<Scal
   const Scalar _tmp5 = std::acos(_tmp4);
   const Scalar _tmp6 =
       2 * std::min<Scalar>(0, (((-_tmp2 + _tmp3) > 0) - ((-_tmp2 + _tmp3) < 0))) + 1;
-  const Scalar _tmp7 = 1 - std::pow(_tmp4, Scalar(2));
-  const Scalar _tmp8 = 4 * std::pow(_tmp5, Scalar(2)) * std::pow(_tmp6, Scalar(2)) *
-                       std::pow(alpha, Scalar(2)) / _tmp7;
+  const Scalar _tmp7 = 1 - (_tmp4 * _tmp4);
+  const Scalar _tmp8 = 4 * (_tmp5 * _tmp5) * (_tmp6 * _tmp6) * (alpha * alpha) / _tmp7;
   const Scalar _tmp9 = -_a[0] * _b[3] - _a[1] * _b[2] + _a[2] * _b[1] + _a[3] * _b[0];
-  const Scalar _tmp10 =
-      std::sqrt(Scalar(std::pow(_tmp0, Scalar(2)) * _tmp8 + std::pow(_tmp1, Scalar(2)) * _tmp8 +
-                       _tmp8 * std::pow(_tmp9, Scalar(2)) + std::pow(epsilon, Scalar(2))));
+  const Scalar _tmp10 = std::sqrt(Scalar((_tmp0 * _tmp0) * _tmp8 + (_tmp1 * _tmp1) * _tmp8 +
+                                         _tmp8 * (_tmp9 * _tmp9) + (epsilon * epsilon)));
   const Scalar _tmp11 = (Scalar(1) / Scalar(2)) * _tmp10;
   const Scalar _tmp12 = 2 * _tmp5 * _tmp6 * alpha * std::sin(_tmp11) / (_tmp10 * std::sqrt(_tmp7));
   const Scalar _tmp13 = _tmp0 * _tmp12;
@@ -0,0 +1,174 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/rot2.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.geo.rot2.Rot2'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<Rot2<Scalar>> {
+  /**
+   * Inverse of each element a.
+   */
+  static void Inverse(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      Scalar* const __restrict__ res) {
+    // Total ops: 1
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = a[k];
+      res[1 * stride + k] = -a[1 * stride + k];
+    }
+  }
+
+  /**
+   * Composition of each pair of elements a and b, i.e. a * b.
+   */
+  static void Compose(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 6
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = -a[1 * stride + k] * b[1 * stride + k] + a[k] * b[k];
+      res[1 * stride + k] = a[1 * stride + k] * b[k] + a[k] * b[1 * stride + k];
+    }
+  }
+
+  /**
+   * The element between each pair of elements a and b, i.e. a.inverse() * b.
+   */
+  static void Between(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 6
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = a[1 * stride + k] * b[1 * stride + k] + a[k] * b[k];
+      res[1 * stride + k] = -a[1 * stride + k] * b[k] + a[k] * b[1 * stride + k];
+    }
+  }
+
+  /**
+   * Applies each tangent space perturbation vec to each element a.
+   */
+  static void Retract(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ vec,
+                      const Scalar* const __restrict__ epsilon, Scalar* const __restrict__ res) {
+    // Total ops: 8
+
+    // Unused inputs
+    (void)epsilon;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (2)
+      const Scalar _tmp0 = std::sin(vec[k]);
+      const Scalar _tmp1 = std::cos(vec[k]);
+
+      // Output terms (1)
+      res[k] = -_tmp0 * a[1 * stride + k] + _tmp1 * a[k];
+      res[1 * stride + k] = _tmp0 * a[k] + _tmp1 * a[1 * stride + k];
+    }
+  }
+
+  /**
+   * The tangent space vector of each element b in the local coordinates of a.
+   */
+  static void LocalCoordinates(const size_t count, const size_t stride,
+                               const Scalar* const __restrict__ a,
+                               const Scalar* const __restrict__ b,
+                               const Scalar* const __restrict__ epsilon,
+                               Scalar* const __restrict__ res) {
+    // Total ops: 11
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (1)
+      const Scalar _tmp0 = a[1 * stride + k] * b[1 * stride + k] + a[k] * b[k];
+
+      // Output terms (1)
+      res[k] = std::atan2(-a[1 * stride + k] * b[k] + a[k] * b[1 * stride + k],
+                          _tmp0 + epsilon[0] * ((((_tmp0) > 0) - ((_tmp0) < 0)) + Scalar(0.5)));
+    }
+  }
+
+  /**
+   * Each point transformed by each element a, i.e. a * point.
+   */
+  static void TransformPoints(const size_t count, const size_t stride,
+                              const Scalar* const __restrict__ a,
+                              const Scalar* const __restrict__ point,
+                              Scalar* const __restrict__ res) {
+    // Total ops: 6
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = -a[1 * stride + k] * point[1 * stride + k] + a[k] * point[k];
+      res[1 * stride + k] = a[1 * stride + k] * point[k] + a[k] * point[1 * stride + k];
+    }
+  }
+
+  /**
+   * Each point transformed by the inverse of each element a.
+   */
+  static void InverseTransformPoints(const size_t count, const size_t stride,
+                                     const Scalar* const __restrict__ a,
+                                     const Scalar* const __restrict__ point,
+                                     Scalar* const __restrict__ res) {
+    // Total ops: 6
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = a[1 * stride + k] * point[1 * stride + k] + a[k] * point[k];
+      res[1 * stride + k] = -a[1 * stride + k] * point[k] + a[k] * point[1 * stride + k];
+    }
+  }
+};
+
+}  // namespace sym
@@ -146,7 +146,7 @@ sym::Rot2<Scalar> GroupOps<Rot2<Scalar>>::InverseWithJacobian(const sym::Rot2<Sc
   if (res_D_a != nullptr) {
     Eigen::Matrix<Scalar, 1, 1>& _res_D_a = (*res_D_a);
 
-    _res_D_a(0, 0) = -std::pow(_a[0], Scalar(2)) - std::pow(_a[1], Scalar(2));
+    _res_D_a(0, 0) = -(_a[0] * _a[0]) - (_a[1] * _a[1]);
   }
 
   return sym::Rot2<Scalar>(_res);
@@ -177,7 +177,7 @@ sym::Rot2<Scalar> GroupOps<Rot2<Scalar>>::ComposeWithJacobians(const sym::Rot2<S
   const Scalar _tmp1 = _a[0] * _b[1];
   const Scalar _tmp2 = _a[1] * _b[0];
   const Scalar _tmp3 = _tmp1 + _tmp2;
-  const Scalar _tmp4 = std::pow(_tmp0, Scalar(2)) - _tmp3 * (-_tmp1 - _tmp2);
+  const Scalar _tmp4 = (_tmp0 * _tmp0) - _tmp3 * (-_tmp1 - _tmp2);
 
   // Output terms (3)
   Eigen::Matrix<Scalar, 2, 1> _res;
@@ -239,13 +239,13 @@ sym::Rot2<Scalar> GroupOps<Rot2<Scalar>>::BetweenWithJacobians(const sym::Rot2<S
   if (res_D_a != nullptr) {
     Eigen::Matrix<Scalar, 1, 1>& _res_D_a = (*res_D_a);
 
-    _res_D_a(0, 0) = _tmp2 * (-_tmp0 - _tmp1) - std::pow(_tmp5, Scalar(2));
+    _res_D_a(0, 0) = _tmp2 * (-_tmp0 - _tmp1) - (_tmp5 * _tmp5);
   }
 
   if (res_D_b != nullptr) {
     Eigen::Matrix<Scalar, 1, 1>& _res_D_b = (*res_D_b);
 
-    _res_D_b(0, 0) = std::pow(_tmp2, Scalar(2)) - _tmp5 * (-_tmp3 + _tmp4);
+    _res_D_b(0, 0) = (_tmp2 * _tmp2) - _tmp5 * (-_tmp3 + _tmp4);
   }
 
   return sym::Rot2<Scalar>(_res);
@@ -0,0 +1,246 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     ops/CLASS/batch_ops.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <sym/rot3.h>
+
+#include "../batch_ops.h"
+
+namespace sym {
+
+/**
+ * C++ BatchOps implementation for <class 'symforce.geo.rot3.Rot3'>.
+ *
+ * Every argument is a flat array in structure-of-arrays layout, see BatchOps.
+ */
+template <typename Scalar>
+struct BatchOps<Rot3<Scalar>> {
+  /**
+   * Inverse of each element a.
+   */
+  static void Inverse(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      Scalar* const __restrict__ res) {
+    // Total ops: 3
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = -a[k];
+      res[1 * stride + k] = -a[1 * stride + k];
+      res[2 * stride + k] = -a[2 * stride + k];
+      res[3 * stride + k] = a[3 * stride + k];
+    }
+  }
+
+  /**
+   * Composition of each pair of elements a and b, i.e. a * b.
+   */
+  static void Compose(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 28
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = a[1 * stride + k] * b[2 * stride + k] - a[2 * stride + k] * b[1 * stride + k] +
+               a[3 * stride + k] * b[k] + a[k] * b[3 * stride + k];
+      res[1 * stride + k] = a[1 * stride + k] * b[3 * stride + k] + a[2 * stride + k] * b[k] +
+                            a[3 * stride + k] * b[1 * stride + k] - a[k] * b[2 * stride + k];
+      res[2 * stride + k] = -a[1 * stride + k] * b[k] + a[2 * stride + k] * b[3 * stride + k] +
+                            a[3 * stride + k] * b[2 * stride + k] + a[k] * b[1 * stride + k];
+      res[3 * stride + k] = -a[1 * stride + k] * b[1 * stride + k] -
+                            a[2 * stride + k] * b[2 * stride + k] +
+                            a[3 * stride + k] * b[3 * stride + k] - a[k] * b[k];
+    }
+  }
+
+  /**
+   * The element between each pair of elements a and b, i.e. a.inverse() * b.
+   */
+  static void Between(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ b, Scalar* const __restrict__ res) {
+    // Total ops: 28
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (0)
+
+      // Output terms (1)
+      res[k] = -a[1 * stride + k] * b[2 * stride + k] + a[2 * stride + k] * b[1 * stride + k] +
+               a[3 * stride + k] * b[k] - a[k] * b[3 * stride + k];
+      res[1 * stride + k] = -a[1 * stride + k] * b[3 * stride + k] - a[2 * stride + k] * b[k] +
+                            a[3 * stride + k] * b[1 * stride + k] + a[k] * b[2 * stride + k];
+      res[2 * stride + k] = a[1 * stride + k] * b[k] - a[2 * stride + k] * b[3 * stride + k] +
+                            a[3 * stride + k] * b[2 * stride + k] - a[k] * b[1 * stride + k];
+      res[3 * stride + k] = a[1 * stride + k] * b[1 * stride + k] +
+                            a[2 * stride + k] * b[2 * stride + k] +
+                            a[3 * stride + k] * b[3 * stride + k] + a[k] * b[k];
+    }
+  }
+
+  /**
+   * Applies each tangent space perturbation vec to each element a.
+   */
+  static void Retract(const size_t count, const size_t stride, const Scalar* const __restrict__ a,
+                      const Scalar* const __restrict__ vec,
+                      const Scalar* const __restrict__ epsilon, Scalar* const __restrict__ res) {
+    // Total ops: 44
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (8)
+      const Scalar _tmp0 =
+          std::sqrt(Scalar((epsilon[0] * epsilon[0]) + (vec[1 * stride + k] * vec[1 * stride + k]) +
+                           (vec[2 * stride + k] * vec[2 * stride + k]) + (vec[k] * vec[k])));
+      const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
+      const Scalar _tmp2 = std::cos(_tmp1);
+      const Scalar _tmp3 = std::sin(_tmp1) / _tmp0;
+      const Scalar _tmp4 = _tmp3 * a[2 * stride + k];
+      const Scalar _tmp5 = _tmp3 * a[3 * stride + k];
+      const Scalar _tmp6 = _tmp3 * a[1 * stride + k];
+      const Scalar _tmp7 = _tmp3 * a[k];
+
+      // Output terms (1)
+      res[k] =
+          _tmp2 * a[k] - _tmp4 * vec[1 * stride + k] + _tmp5 * vec[k] + _tmp6 * vec[2 * stride + k];
+      res[1 * stride + k] = _tmp2 * a[1 * stride + k] + _tmp4 * vec[k] +
+                            _tmp5 * vec[1 * stride + k] - _tmp7 * vec[2 * stride + k];
+      res[2 * stride + k] = _tmp2 * a[2 * stride + k] + _tmp5 * vec[2 * stride + k] -
+                            _tmp6 * vec[k] + _tmp7 * vec[1 * stride + k];
+      res[3 * stride + k] = _tmp2 * a[3 * stride + k] - _tmp4 * vec[2 * stride + k] -
+                            _tmp6 * vec[1 * stride + k] - _tmp7 * vec[k];
+    }
+  }
+
+  /**
+   * The tangent space vector of each element b in the local coordinates of a.
+   */
+  static void LocalCoordinates(const size_t count, const size_t stride,
+                               const Scalar* const __restrict__ a,
+                               const Scalar* const __restrict__ b,
+                               const Scalar* const __restrict__ epsilon,
+                               Scalar* const __restrict__ res) {
+    // Total ops: 45
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (3)
+      const Scalar _tmp0 = a[1 * stride + k] * b[1 * stride + k] +
+                           a[2 * stride + k] * b[2 * stride + k] +
+                           a[3 * stride + k] * b[3 * stride + k] + a[k] * b[k];
+      const Scalar _tmp1 = std::min<Scalar>(Scalar(std::fabs(_tmp0)), Scalar(1 - epsilon[0]));
+      const Scalar _tmp2 =
+          2 * (2 * std::min<Scalar>(Scalar(0), Scalar((((_tmp0) > 0) - ((_tmp0) < 0)))) + 1) *
+          std::acos(_tmp1) / std::sqrt(Scalar(1 - (_tmp1 * _tmp1)));
+
+      // Output terms (1)
+      res[k] =
+          _tmp2 * (-a[1 * stride + k] * b[2 * stride + k] + a[2 * stride + k] * b[1 * stride + k] +
+                   a[3 * stride + k] * b[k] - a[k] * b[3 * stride + k]);
+      res[1 * stride + k] =
+          _tmp2 * (-a[1 * stride + k] * b[3 * stride + k] - a[2 * stride + k] * b[k] +
+                   a[3 * stride + k] * b[1 * stride + k] + a[k] * b[2 * stride + k]);
+      res[2 * stride + k] =
+          _tmp2 * (a[1 * stride + k] * b[k] - a[2 * stride + k] * b[3 * stride + k] +
+                   a[3 * stride + k] * b[2 * stride + k] - a[k] * b[1 * stride + k]);
+    }
+  }
+
+  /**
+   * Each point transformed by each element a, i.e. a * point.
+   */
+  static void TransformPoints(const size_t count, const size_t stride,
+                              const Scalar* const __restrict__ a,
+                              const Scalar* const __restrict__ point,
+                              Scalar* const __restrict__ res) {
+    // Total ops: 43
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (11)
+      const Scalar _tmp0 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp1 = 1 - 2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp2 = 2 * a[3 * stride + k];
+      const Scalar _tmp3 = _tmp2 * a[2 * stride + k];
+      const Scalar _tmp4 = 2 * a[1 * stride + k];
+      const Scalar _tmp5 = _tmp4 * a[k];
+      const Scalar _tmp6 = _tmp4 * a[3 * stride + k];
+      const Scalar _tmp7 = 2 * a[2 * stride + k] * a[k];
+      const Scalar _tmp8 = -2 * (a[k] * a[k]);
+      const Scalar _tmp9 = _tmp2 * a[k];
+      const Scalar _tmp10 = _tmp4 * a[2 * stride + k];
+
+      // Output terms (1)
+      res[k] = point[1 * stride + k] * (-_tmp3 + _tmp5) + point[2 * stride + k] * (_tmp6 + _tmp7) +
+               point[k] * (_tmp0 + _tmp1);
+      res[1 * stride + k] = point[1 * stride + k] * (_tmp1 + _tmp8) +
+                            point[2 * stride + k] * (_tmp10 - _tmp9) + point[k] * (_tmp3 + _tmp5);
+      res[2 * stride + k] = point[1 * stride + k] * (_tmp10 + _tmp9) +
+                            point[2 * stride + k] * (_tmp0 + _tmp8 + 1) +
+                            point[k] * (-_tmp6 + _tmp7);
+    }
+  }
+
+  /**
+   * Each point transformed by the inverse of each element a.
+   */
+  static void InverseTransformPoints(const size_t count, const size_t stride,
+                                     const Scalar* const __restrict__ a,
+                                     const Scalar* const __restrict__ point,
+                                     Scalar* const __restrict__ res) {
+    // Total ops: 43
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t k = 0; k < count; k++) {
+      // Intermediate terms (11)
+      const Scalar _tmp0 = -2 * (a[1 * stride + k] * a[1 * stride + k]);
+      const Scalar _tmp1 = 1 - 2 * (a[2 * stride + k] * a[2 * stride + k]);
+      const Scalar _tmp2 = 2 * a[3 * stride + k];
+      const Scalar _tmp3 = _tmp2 * a[2 * stride + k];
+      const Scalar _tmp4 = 2 * a[1 * stride + k];
+      const Scalar _tmp5 = _tmp4 * a[k];
+      const Scalar _tmp6 = _tmp4 * a[3 * stride + k];
+      const Scalar _tmp7 = 2 * a[2 * stride + k] * a[k];
+      const Scalar _tmp8 = -2 * (a[k] * a[k]);
+      const Scalar _tmp9 = _tmp2 * a[k];
+      const Scalar _tmp10 = _tmp4 * a[2 * stride + k];
+
+      // Output terms (1)
+      res[k] = point[1 * stride + k] * (_tmp3 + _tmp5) + point[2 * stride + k] * (-_tmp6 + _tmp7) +
+               point[k] * (_tmp0 + _tmp1);
+      res[1 * stride + k] = point[1 * stride + k] * (_tmp1 + _tmp8) +
+                            point[2 * stride + k] * (_tmp10 + _tmp9) + point[k] * (-_tmp3 + _tmp5);
+      res[2 * stride + k] = point[1 * stride + k] * (_tmp10 - _tmp9) +
+                            point[2 * stride + k] * (_tmp0 + _tmp8 + 1) +
+                            point[k] * (_tmp6 + _tmp7);
+    }
+  }
+};
+
+}  // namespace sym
@@ -144,10 +144,10 @@ sym::Rot3<Scalar> GroupOps<Rot3<Scalar>>::InverseWithJacobian(const sym::Rot3<Sc
   const Eigen::Matrix<Scalar, 4, 1>& _a = a.Data();
 
   // Intermediate terms (13)
-  const Scalar _tmp0 = std::pow(_a[2], Scalar(2));
-  const Scalar _tmp1 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp2 = -std::pow(_a[3], Scalar(2));
-  const Scalar _tmp3 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp0 = (_a[2] * _a[2]);
+  const Scalar _tmp1 = (_a[0] * _a[0]);
+  const Scalar _tmp2 = -(_a[3] * _a[3]);
+  const Scalar _tmp3 = (_a[1] * _a[1]);
   const Scalar _tmp4 = _tmp2 + _tmp3;
   const Scalar _tmp5 = 2 * _a[2];
   const Scalar _tmp6 = _a[3] * _tmp5;
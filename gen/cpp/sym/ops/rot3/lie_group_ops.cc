@@ -20,9 +20,8 @@ sym::Rot3<Scalar> LieGroupOps<Rot3<Scalar>>::FromTangent(const TangentVec& vec,
   // Input arrays
 
   // Intermediate terms (3)
-  const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2)) + std::pow(vec(2, 0), Scalar(2))));
+  const Scalar _tmp0 = std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) +
+                                        (vec(1, 0) * vec(1, 0)) + (vec(2, 0) * vec(2, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::sin(_tmp1) / _tmp0;
 
@@ -48,7 +47,7 @@ typename LieGroupOps<Rot3<Scalar>>::TangentVec LieGroupOps<Rot3<Scalar>>::ToTang
   // Intermediate terms (2)
   const Scalar _tmp0 = std::min<Scalar>(std::fabs(_a[3]), 1 - epsilon);
   const Scalar _tmp1 = 2 * (2 * std::min<Scalar>(0, (((_a[3]) > 0) - ((_a[3]) < 0))) + 1) *
-                       std::acos(_tmp0) / std::sqrt(Scalar(1 - std::pow(_tmp0, Scalar(2))));
+                       std::acos(_tmp0) / std::sqrt(Scalar(1 - (_tmp0 * _tmp0)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 3, 1> _res;
@@ -69,9 +68,8 @@ sym::Rot3<Scalar> LieGroupOps<Rot3<Scalar>>::Retract(const sym::Rot3<Scalar>& a,
   const Eigen::Matrix<Scalar, 4, 1>& _a = a.Data();
 
   // Intermediate terms (8)
-  const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2)) + std::pow(vec(2, 0), Scalar(2))));
+  const Scalar _tmp0 = std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) +
+                                        (vec(1, 0) * vec(1, 0)) + (vec(2, 0) * vec(2, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::cos(_tmp1);
   const Scalar _tmp3 = std::sin(_tmp1) / _tmp0;
@@ -104,7 +102,7 @@ typename LieGroupOps<Rot3<Scalar>>::TangentVec LieGroupOps<Rot3<Scalar>>::LocalC
   const Scalar _tmp0 = _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2] + _a[3] * _b[3];
   const Scalar _tmp1 = std::min<Scalar>(std::fabs(_tmp0), 1 - epsilon);
   const Scalar _tmp2 = 2 * (2 * std::min<Scalar>(0, (((_tmp0) > 0) - ((_tmp0) < 0))) + 1) *
-                       std::acos(_tmp1) / std::sqrt(Scalar(1 - std::pow(_tmp1, Scalar(2))));
+                       std::acos(_tmp1) / std::sqrt(Scalar(1 - (_tmp1 * _tmp1)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 3, 1> _res;
@@ -130,16 +128,14 @@ sym::Rot3<Scalar> LieGroupOps<Rot3<Scalar>>::Interpolate(const sym::Rot3<Scalar>
   const Scalar _tmp0 = -_a[0] * _b[3] - _a[1] * _b[2] + _a[2] * _b[1] + _a[3] * _b[0];
   const Scalar _tmp1 = _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2] + _a[3] * _b[3];
   const Scalar _tmp2 = std::min<Scalar>(std::fabs(_tmp1), 1 - epsilon);
-  const Scalar _tmp3 = 1 - std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = 1 - (_tmp2 * _tmp2);
   const Scalar _tmp4 = 2 * std::min<Scalar>(0, (((_tmp1) > 0) - ((_tmp1) < 0))) + 1;
   const Scalar _tmp5 = -_a[0] * _b[1] + _a[1] * _b[0] - _a[2] * _b[3] + _a[3] * _b[2];
   const Scalar _tmp6 = std::acos(_tmp2);
-  const Scalar _tmp7 = 4 * std::pow(_tmp4, Scalar(2)) * std::pow(_tmp6, Scalar(2)) *
-                       std::pow(alpha, Scalar(2)) / _tmp3;
+  const Scalar _tmp7 = 4 * (_tmp4 * _tmp4) * (_tmp6 * _tmp6) * (alpha * alpha) / _tmp3;
   const Scalar _tmp8 = _a[0] * _b[2] - _a[1] * _b[3] - _a[2] * _b[0] + _a[3] * _b[1];
-  const Scalar _tmp9 =
-      std::sqrt(Scalar(std::pow(_tmp0, Scalar(2)) * _tmp7 + std::pow(_tmp5, Scalar(2)) * _tmp7 +
-                       _tmp7 * std::pow(_tmp8, Scalar(2)) + std::pow(epsilon, Scalar(2))));
+  const Scalar _tmp9 = std::sqrt(Scalar((_tmp0 * _tmp0) * _tmp7 + (_tmp5 * _tmp5) * _tmp7 +
+                                        _tmp7 * (_tmp8 * _tmp8) + (epsilon * epsilon)));
   const Scalar _tmp10 = (Scalar(1) / Scalar(2)) * _tmp9;
   const Scalar _tmp11 = 2 * _tmp4 * _tmp6 * alpha * std::sin(_tmp10) / (std::sqrt(_tmp3) * _tmp9);
   const Scalar _tmp12 = _a[3] * _tmp11;
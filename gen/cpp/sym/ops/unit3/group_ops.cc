@@ -144,9 +144,9 @@ sym::Unit3<Scalar> GroupOps<Unit3<Scalar>>::InverseWithJacobian(const sym::Unit3
   const Eigen::Matrix<Scalar, 4, 1>& _a = a.Data();
 
   // Intermediate terms (5)
-  const Scalar _tmp0 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp1 = std::pow(_a[1], Scalar(2));
-  const Scalar _tmp2 = std::pow(_a[2], Scalar(2)) - std::pow(_a[3], Scalar(2));
+  const Scalar _tmp0 = (_a[0] * _a[0]);
+  const Scalar _tmp1 = (_a[1] * _a[1]);
+  const Scalar _tmp2 = (_a[2] * _a[2]) - (_a[3] * _a[3]);
   const Scalar _tmp3 = 2 * _a[2] * _a[3];
   const Scalar _tmp4 = 2 * _a[0] * _a[1];
 
@@ -21,8 +21,7 @@ sym::Unit3<Scalar> LieGroupOps<Unit3<Scalar>>::FromTangent(const TangentVec& vec
 
   // Intermediate terms (3)
   const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2))));
+      std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) + (vec(1, 0) * vec(1, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::sin(_tmp1) / _tmp0;
 
@@ -48,7 +47,7 @@ typename LieGroupOps<Unit3<Scalar>>::TangentVec LieGroupOps<Unit3<Scalar>>::ToTa
   // Intermediate terms (2)
   const Scalar _tmp0 = std::min<Scalar>(std::fabs(_a[3]), 1 - epsilon);
   const Scalar _tmp1 = 2 * (2 * std::min<Scalar>(0, (((_a[3]) > 0) - ((_a[3]) < 0))) + 1) *
-                       std::acos(_tmp0) / std::sqrt(Scalar(1 - std::pow(_tmp0, Scalar(2))));
+                       std::acos(_tmp0) / std::sqrt(Scalar(1 - (_tmp0 * _tmp0)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 2, 1> _res;
@@ -70,8 +69,7 @@ sym::Unit3<Scalar> LieGroupOps<Unit3<Scalar>>::Retract(const sym::Unit3<Scalar>&
 
   // Intermediate terms (8)
   const Scalar _tmp0 =
-      std::sqrt(Scalar(std::pow(epsilon, Scalar(2)) + std::pow(vec(0, 0), Scalar(2)) +
-                       std::pow(vec(1, 0), Scalar(2))));
+      std::sqrt(Scalar((epsilon * epsilon) + (vec(0, 0) * vec(0, 0)) + (vec(1, 0) * vec(1, 0))));
   const Scalar _tmp1 = (Scalar(1) / Scalar(2)) * _tmp0;
   const Scalar _tmp2 = std::cos(_tmp1);
   const Scalar _tmp3 = std::sin(_tmp1) / _tmp0;
@@ -104,7 +102,7 @@ typename LieGroupOps<Unit3<Scalar>>::TangentVec LieGroupOps<Unit3<Scalar>>::Loca
   const Scalar _tmp0 = _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2] + _a[3] * _b[3];
   const Scalar _tmp1 = std::min<Scalar>(std::fabs(_tmp0), 1 - epsilon);
   const Scalar _tmp2 = 2 * (2 * std::min<Scalar>(0, (((_tmp0) > 0) - ((_tmp0) < 0))) + 1) *
-                       std::acos(_tmp1) / std::sqrt(Scalar(1 - std::pow(_tmp1, Scalar(2))));
+                       std::acos(_tmp1) / std::sqrt(Scalar(1 - (_tmp1 * _tmp1)));
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 2, 1> _res;
@@ -130,15 +128,13 @@ sym::Unit3<Scalar> LieGroupOps<Unit3<Scalar>>::Interpolate(const sym::Unit3<Scal
   const Scalar _tmp0 = _a[0] * _b[2] - _a[1] * _b[3] - _a[2] * _b[0] + _a[3] * _b[1];
   const Scalar _tmp1 = _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2] + _a[3] * _b[3];
   const Scalar _tmp2 = std::min<Scalar>(std::fabs(_tmp1), 1 - epsilon);
-  const Scalar _tmp3 = 1 - std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = 1 - (_tmp2 * _tmp2);
   const Scalar _tmp4 = 2 * std::min<Scalar>(0, (((_tmp1) > 0) - ((_tmp1) < 0))) + 1;
   const Scalar _tmp5 = -_a[0] * _b[3] - _a[1] * _b[2] + _a[2] * _b[1] + _a[3] * _b[0];
   const Scalar _tmp6 = std::acos(_tmp2);
-  const Scalar _tmp7 = 4 * std::pow(_tmp4, Scalar(2)) * std::pow(_tmp6, Scalar(2)) *
-                       std::pow(alpha, Scalar(2)) / _tmp3;
+  const Scalar _tmp7 = 4 * (_tmp4 * _tmp4) * (_tmp6 * _tmp6) * (alpha * alpha) / _tmp3;
   const Scalar _tmp8 =
-      std::sqrt(Scalar(std::pow(_tmp0, Scalar(2)) * _tmp7 + std::pow(_tmp5, Scalar(2)) * _tmp7 +
-                       std::pow(epsilon, Scalar(2))));
+      std::sqrt(Scalar((_tmp0 * _tmp0) * _tmp7 + (_tmp5 * _tmp5) * _tmp7 + (epsilon * epsilon)));
   const Scalar _tmp9 = (Scalar(1) / Scalar(2)) * _tmp8;
   const Scalar _tmp10 = 2 * _tmp4 * _tmp6 * alpha * std::sin(_tmp9) / (std::sqrt(_tmp3) * _tmp8);
   const Scalar _tmp11 = _tmp0 * _tmp10;
@@ -55,18 +55,12 @@ Eigen::Matrix<Scalar, 2, 1> PolynomialCameraCal<Scalar>::PixelFromCameraPoint(
 
   // Intermediate terms (4)
   const Scalar _tmp0 = std::max<Scalar>(epsilon, point(2, 0));
-  const Scalar _tmp1 = std::pow(_tmp0, Scalar(-2));
+  const Scalar _tmp1 = Scalar(1.0) / (_tmp0 * _tmp0);
   const Scalar _tmp2 =
-      _tmp1 * std::pow(point(0, 0), Scalar(2)) + _tmp1 * std::pow(point(1, 0), Scalar(2)) + epsilon;
-  const Scalar _tmp3 =
-      (Scalar(1.0) * _self[5] * _tmp2 + Scalar(1.0) * _self[6] * std::pow(_tmp2, Scalar(2)) +
-       Scalar(1.0) * _self[7] *
-           [&]() {
-             const Scalar base = _tmp2;
-             return base * base * base;
-           }() +
-       Scalar(1.0)) /
-      _tmp0;
+      _tmp1 * (point(0, 0) * point(0, 0)) + _tmp1 * (point(1, 0) * point(1, 0)) + epsilon;
+  const Scalar _tmp3 = (Scalar(1.0) * _self[5] * _tmp2 + Scalar(1.0) * _self[6] * (_tmp2 * _tmp2) +
+                        Scalar(1.0) * _self[7] * (_tmp2 * _tmp2 * _tmp2) + Scalar(1.0)) /
+                       _tmp0;
 
   // Output terms (2)
   Eigen::Matrix<Scalar, 2, 1> _pixel;
@@ -96,18 +90,15 @@ Eigen::Matrix<Scalar, 2, 1> PolynomialCameraCal<Scalar>::PixelFromCameraPointWit
   const Eigen::Matrix<Scalar, 8, 1>& _self = Data();
 
   // Intermediate terms (35)
-  const Scalar _tmp0 = std::pow(point(1, 0), Scalar(2));
+  const Scalar _tmp0 = (point(1, 0) * point(1, 0));
   const Scalar _tmp1 = std::max<Scalar>(epsilon, point(2, 0));
-  const Scalar _tmp2 = std::pow(_tmp1, Scalar(-2));
+  const Scalar _tmp2 = Scalar(1.0) / (_tmp1 * _tmp1);
   const Scalar _tmp3 = _tmp0 * _tmp2;
-  const Scalar _tmp4 = std::pow(point(0, 0), Scalar(2));
+  const Scalar _tmp4 = (point(0, 0) * point(0, 0));
   const Scalar _tmp5 = _tmp2 * _tmp4;
   const Scalar _tmp6 = _tmp3 + _tmp5 + epsilon;
-  const Scalar _tmp7 = Scalar(1.0) * [&]() {
-    const Scalar base = _tmp6;
-    return base * base * base;
-  }();
-  const Scalar _tmp8 = std::pow(_tmp6, Scalar(2));
+  const Scalar _tmp7 = Scalar(1.0) * (_tmp6 * _tmp6 * _tmp6);
+  const Scalar _tmp8 = (_tmp6 * _tmp6);
   const Scalar _tmp9 = Scalar(1.0) * _tmp8;
   const Scalar _tmp10 = Scalar(1.0) * _self[5];
   const Scalar _tmp11 = _self[6] * _tmp9 + _self[7] * _tmp7 + _tmp10 * _tmp6 + Scalar(1.0);
@@ -132,10 +123,7 @@ Eigen::Matrix<Scalar, 2, 1> PolynomialCameraCal<Scalar>::PixelFromCameraPointWit
   const Scalar _tmp29 = _tmp12 * (_tmp22 * _tmp28 + _tmp24 * _tmp28 + _tmp26 * _tmp28);
   const Scalar _tmp30 = (((-epsilon + point(2, 0)) > 0) - ((-epsilon + point(2, 0)) < 0)) + 1;
   const Scalar _tmp31 = (Scalar(1) / Scalar(2)) * _tmp11 * _tmp30;
-  const Scalar _tmp32 = _tmp30 / [&]() {
-    const Scalar base = _tmp1;
-    return base * base * base;
-  }();
+  const Scalar _tmp32 = _tmp30 / (_tmp1 * _tmp1 * _tmp1);
   const Scalar _tmp33 = -_tmp0 * _tmp32 - _tmp32 * _tmp4;
   const Scalar _tmp34 =
       _tmp12 * (_tmp10 * _tmp33 + Scalar(3.0) * _tmp23 * _tmp33 + Scalar(2.0) * _tmp25 * _tmp33);
@@ -77,12 +77,12 @@ Eigen::Matrix<Scalar, 3, 1> sym::Pose3<Scalar>::ComposeWithPoint(
   const Scalar _tmp0 = 2 * _self[2];
   const Scalar _tmp1 = _self[3] * _tmp0;
   const Scalar _tmp2 = 2 * _self[0] * _self[1];
-  const Scalar _tmp3 = -2 * std::pow(_self[1], Scalar(2));
-  const Scalar _tmp4 = 1 - 2 * std::pow(_self[2], Scalar(2));
+  const Scalar _tmp3 = -2 * (_self[1] * _self[1]);
+  const Scalar _tmp4 = 1 - 2 * (_self[2] * _self[2]);
   const Scalar _tmp5 = _self[0] * _tmp0;
   const Scalar _tmp6 = 2 * _self[3];
   const Scalar _tmp7 = _self[1] * _tmp6;
-  const Scalar _tmp8 = -2 * std::pow(_self[0], Scalar(2));
+  const Scalar _tmp8 = -2 * (_self[0] * _self[0]);
   const Scalar _tmp9 = _self[0] * _tmp6;
   const Scalar _tmp10 = _self[1] * _tmp0;
 
@@ -112,15 +112,15 @@ Eigen::Matrix<Scalar, 3, 1> sym::Pose3<Scalar>::InverseCompose(
   const Scalar _tmp1 = _self[3] * _tmp0;
   const Scalar _tmp2 = 2 * _self[0] * _self[1];
   const Scalar _tmp3 = _tmp1 + _tmp2;
-  const Scalar _tmp4 = -2 * std::pow(_self[1], Scalar(2));
-  const Scalar _tmp5 = 1 - 2 * std::pow(_self[2], Scalar(2));
+  const Scalar _tmp4 = -2 * (_self[1] * _self[1]);
+  const Scalar _tmp5 = 1 - 2 * (_self[2] * _self[2]);
   const Scalar _tmp6 = _tmp4 + _tmp5;
   const Scalar _tmp7 = _self[0] * _tmp0;
   const Scalar _tmp8 = 2 * _self[3];
   const Scalar _tmp9 = _self[1] * _tmp8;
   const Scalar _tmp10 = _tmp7 - _tmp9;
   const Scalar _tmp11 = -_tmp1 + _tmp2;
-  const Scalar _tmp12 = -2 * std::pow(_self[0], Scalar(2));
+  const Scalar _tmp12 = -2 * (_self[0] * _self[0]);
   const Scalar _tmp13 = _tmp12 + _tmp5;
   const Scalar _tmp14 = _self[0] * _tmp8;
   const Scalar _tmp15 = _self[1] * _tmp0;
@@ -150,15 +150,15 @@ Eigen::Matrix<Scalar, 4, 4> sym::Pose3<Scalar>::ToHomogenousMatrix() const {
   const Eigen::Matrix<Scalar, 7, 1>& _self = Data();
 
   // Intermediate terms (11)
-  const Scalar _tmp0 = -2 * std::pow(_self[1], Scalar(2));
-  const Scalar _tmp1 = 1 - 2 * std::pow(_self[2], Scalar(2));
+  const Scalar _tmp0 = -2 * (_self[1] * _self[1]);
+  const Scalar _tmp1 = 1 - 2 * (_self[2] * _self[2]);
   const Scalar _tmp2 = 2 * _self[2] * _self[3];
   const Scalar _tmp3 = 2 * _self[1];
   const Scalar _tmp4 = _self[0] * _tmp3;
   const Scalar _tmp5 = 2 * _self[0];
   const Scalar _tmp6 = _self[2] * _tmp5;
   const Scalar _tmp7 = _self[3] * _tmp3;
-  const Scalar _tmp8 = -2 * std::pow(_self[0], Scalar(2));
+  const Scalar _tmp8 = -2 * (_self[0] * _self[0]);
   const Scalar _tmp9 = _self[3] * _tmp5;
   const Scalar _tmp10 = _self[2] * _tmp3;
 
@@ -41,11 +41,11 @@ Eigen::Matrix<Scalar, 3, 1> sym::Rot3<Scalar>::ComposeWithPoint(
   const Scalar _tmp3 = _self[3] * _tmp2;
   const Scalar _tmp4 = 2 * _self[1] * _self[3];
   const Scalar _tmp5 = _self[2] * _tmp0;
-  const Scalar _tmp6 = -2 * std::pow(_self[1], Scalar(2));
-  const Scalar _tmp7 = 1 - 2 * std::pow(_self[2], Scalar(2));
+  const Scalar _tmp6 = -2 * (_self[1] * _self[1]);
+  const Scalar _tmp7 = 1 - 2 * (_self[2] * _self[2]);
   const Scalar _tmp8 = _self[3] * _tmp0;
   const Scalar _tmp9 = _self[1] * _tmp2;
-  const Scalar _tmp10 = -2 * std::pow(_self[0], Scalar(2));
+  const Scalar _tmp10 = -2 * (_self[0] * _self[0]);
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 3, 1> _res;
@@ -68,15 +68,15 @@ Eigen::Matrix<Scalar, 3, 3> sym::Rot3<Scalar>::ToRotationMatrix() const {
   const Eigen::Matrix<Scalar, 4, 1>& _self = Data();
 
   // Intermediate terms (11)
-  const Scalar _tmp0 = -2 * std::pow(_self[1], Scalar(2));
-  const Scalar _tmp1 = 1 - 2 * std::pow(_self[2], Scalar(2));
+  const Scalar _tmp0 = -2 * (_self[1] * _self[1]);
+  const Scalar _tmp1 = 1 - 2 * (_self[2] * _self[2]);
   const Scalar _tmp2 = 2 * _self[0];
   const Scalar _tmp3 = _self[1] * _tmp2;
   const Scalar _tmp4 = 2 * _self[2];
   const Scalar _tmp5 = _self[3] * _tmp4;
   const Scalar _tmp6 = 2 * _self[1] * _self[3];
   const Scalar _tmp7 = _self[2] * _tmp2;
-  const Scalar _tmp8 = -2 * std::pow(_self[0], Scalar(2));
+  const Scalar _tmp8 = -2 * (_self[0] * _self[0]);
   const Scalar _tmp9 = _self[3] * _tmp2;
   const Scalar _tmp10 = _self[1] * _tmp4;
 
@@ -131,9 +131,9 @@ Eigen::Matrix<Scalar, 3, 1> sym::Rot3<Scalar>::ToYawPitchRoll() const {
   // Intermediate terms (5)
   const Scalar _tmp0 = 2 * _self[0];
   const Scalar _tmp1 = 2 * _self[2];
-  const Scalar _tmp2 = std::pow(_self[2], Scalar(2));
-  const Scalar _tmp3 = std::pow(_self[0], Scalar(2));
-  const Scalar _tmp4 = -std::pow(_self[1], Scalar(2)) + std::pow(_self[3], Scalar(2));
+  const Scalar _tmp2 = (_self[2] * _self[2]);
+  const Scalar _tmp3 = (_self[0] * _self[0]);
+  const Scalar _tmp4 = -(_self[1] * _self[1]) + (_self[3] * _self[3]);
 
   // Output terms (1)
   Eigen::Matrix<Scalar, 3, 1> _res;
@@ -221,11 +221,10 @@ sym::Rot3<Scalar> sym::Rot3<Scalar>::FromTwoUnitVectors(const Eigen::Matrix<Scal
 
   // Intermediate terms (7)
   const Scalar _tmp0 =
-      Scalar(1) / Scalar(2) - Scalar(1) / Scalar(2) *
-                                  (((std::pow(a(1, 0), Scalar(2)) + std::pow(a(2, 0), Scalar(2)) -
-                                     std::pow(epsilon, Scalar(2))) > 0) -
-                                   ((std::pow(a(1, 0), Scalar(2)) + std::pow(a(2, 0), Scalar(2)) -
-                                     std::pow(epsilon, Scalar(2))) < 0));
+      Scalar(1) / Scalar(2) -
+      Scalar(1) / Scalar(2) *
+          ((((a(1, 0) * a(1, 0)) + (a(2, 0) * a(2, 0)) - (epsilon * epsilon)) > 0) -
+           (((a(1, 0) * a(1, 0)) + (a(2, 0) * a(2, 0)) - (epsilon * epsilon)) < 0));
   const Scalar _tmp1 = a(0, 0) * b(0, 0) + a(1, 0) * b(1, 0) + a(2, 0) * b(2, 0);
   const Scalar _tmp2 =
       (((-epsilon + std::fabs(_tmp1 + 1)) > 0) - ((-epsilon + std::fabs(_tmp1 + 1)) < 0)) + 1;
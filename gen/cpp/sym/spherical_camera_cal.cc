@@ -54,18 +54,13 @@ Eigen::Matrix<Scalar, 2, 1> SphericalCameraCal<Scalar>::PixelFromCameraPoint(
   const Eigen::Matrix<Scalar, 9, 1>& _self = Data();
 
   // Intermediate terms (4)
-  const Scalar _tmp0 = std::sqrt(
-      Scalar(epsilon + std::pow(point(0, 0), Scalar(2)) + std::pow(point(1, 0), Scalar(2))));
+  const Scalar _tmp0 =
+      std::sqrt(Scalar(epsilon + (point(0, 0) * point(0, 0)) + (point(1, 0) * point(1, 0))));
   const Scalar _tmp1 = std::atan2(_tmp0, point(2, 0));
   const Scalar _tmp2 = std::min<Scalar>(_tmp1, _self[4] - epsilon);
   const Scalar _tmp3 =
-      (_self[5] *
-           [&]() {
-             const Scalar base = _tmp2;
-             return base * base * base;
-           }() +
-       _self[6] * std::pow(_tmp2, Scalar(5)) + _self[7] * std::pow(_tmp2, Scalar(7)) +
-       _self[8] * std::pow(_tmp2, Scalar(9)) + _tmp2) /
+      (_self[5] * (_tmp2 * _tmp2 * _tmp2) + _self[6] * std::pow(_tmp2, Scalar(5)) +
+       _self[7] * std::pow(_tmp2, Scalar(7)) + _self[8] * std::pow(_tmp2, Scalar(9)) + _tmp2) /
       _tmp0;
 
   // Output terms (2)
@@ -95,8 +90,8 @@ Eigen::Matrix<Scalar, 2, 1> SphericalCameraCal<Scalar>::PixelFromCameraPointWith
 
   // Intermediate terms (40)
   const Scalar _tmp0 = -epsilon;
-  const Scalar _tmp1 = std::pow(point(1, 0), Scalar(2));
-  const Scalar _tmp2 = std::pow(point(0, 0), Scalar(2));
+  const Scalar _tmp1 = (point(1, 0) * point(1, 0));
+  const Scalar _tmp2 = (point(0, 0) * point(0, 0));
   const Scalar _tmp3 = _tmp1 + _tmp2 + epsilon;
   const Scalar _tmp4 = std::sqrt(_tmp3);
   const Scalar _tmp5 = std::atan2(_tmp4, point(2, 0));
@@ -104,10 +99,7 @@ Eigen::Matrix<Scalar, 2, 1> SphericalCameraCal<Scalar>::PixelFromCameraPointWith
   const Scalar _tmp7 = std::pow(_tmp6, Scalar(5));
   const Scalar _tmp8 = std::pow(_tmp6, Scalar(7));
   const Scalar _tmp9 = std::pow(_tmp6, Scalar(9));
-  const Scalar _tmp10 = [&]() {
-    const Scalar base = _tmp6;
-    return base * base * base;
-  }();
+  const Scalar _tmp10 = (_tmp6 * _tmp6 * _tmp6);
   const Scalar _tmp11 =
       _self[5] * _tmp10 + _self[6] * _tmp7 + _self[7] * _tmp8 + _self[8] * _tmp9 + _tmp6;
   const Scalar _tmp12 = Scalar(1.0) / (_tmp4);
@@ -122,15 +114,15 @@ Eigen::Matrix<Scalar, 2, 1> SphericalCameraCal<Scalar>::PixelFromCameraPointWith
   const Scalar _tmp21 = _tmp12 * _tmp9;
   const Scalar _tmp22 = (Scalar(9) / Scalar(2)) * _self[8] * std::pow(_tmp6, Scalar(8));
   const Scalar _tmp23 = ((((_tmp0 + _tmp16) > 0) - ((_tmp0 + _tmp16) < 0)) + 1) /
-                        (_tmp3 + std::pow(point(2, 0), Scalar(2)));
+                        (_tmp3 + (point(2, 0) * point(2, 0)));
   const Scalar _tmp24 = _tmp12 * point(2, 0);
   const Scalar _tmp25 = _tmp23 * _tmp24;
   const Scalar _tmp26 = _tmp22 * _tmp25;
-  const Scalar _tmp27 = (Scalar(5) / Scalar(2)) * _self[6] * std::pow(_tmp6, Scalar(4));
+  const Scalar _tmp27 = (Scalar(5) / Scalar(2)) * _self[6] * (_tmp6 * _tmp6 * _tmp6 * _tmp6);
   const Scalar _tmp28 = _tmp25 * _tmp27;
   const Scalar _tmp29 = (Scalar(7) / Scalar(2)) * _self[7] * std::pow(_tmp6, Scalar(6));
   const Scalar _tmp30 = _tmp25 * _tmp29;
-  const Scalar _tmp31 = (Scalar(3) / Scalar(2)) * _self[5] * std::pow(_tmp6, Scalar(2));
+  const Scalar _tmp31 = (Scalar(3) / Scalar(2)) * _self[5] * (_tmp6 * _tmp6);
   const Scalar _tmp32 = _tmp25 * _tmp31;
   const Scalar _tmp33 = (Scalar(1) / Scalar(2)) * _tmp23;
   const Scalar _tmp34 = _tmp24 * _tmp33;
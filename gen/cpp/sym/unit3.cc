@@ -34,12 +34,12 @@ sym::Unit3<Scalar> sym::Unit3<Scalar>::FromVector(const Eigen::Matrix<Scalar, 3,
   // Input arrays
 
   // Intermediate terms (8)
-  const Scalar _tmp0 = Scalar(1) / Scalar(2) - Scalar(1) / Scalar(2) *
-                                                   (((1 - std::pow(epsilon, Scalar(2))) > 0) -
-                                                    ((1 - std::pow(epsilon, Scalar(2))) < 0));
-  const Scalar _tmp1 = std::pow(Scalar(std::pow(a(0, 0), Scalar(2)) + std::pow(a(1, 0), Scalar(2)) +
-                                       std::pow(a(2, 0), Scalar(2)) + epsilon),
-                                Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp0 =
+      Scalar(1) / Scalar(2) -
+      Scalar(1) / Scalar(2) * (((1 - (epsilon * epsilon)) > 0) - ((1 - (epsilon * epsilon)) < 0));
+  const Scalar _tmp1 =
+      Scalar(1.0) /
+      std::sqrt(Scalar((a(0, 0) * a(0, 0)) + (a(1, 0) * a(1, 0)) + (a(2, 0) * a(2, 0)) + epsilon));
   const Scalar _tmp2 = _tmp1 * a(2, 0);
   const Scalar _tmp3 =
       (((-epsilon + std::fabs(_tmp2 + 1)) > 0) - ((-epsilon + std::fabs(_tmp2 + 1)) < 0)) + 1;
@@ -75,7 +75,7 @@ Eigen::Matrix<Scalar, 3, 1> sym::Unit3<Scalar>::ToUnitVector() const {
 
   _res(0, 0) = _self[2] * _tmp1 + _self[3] * _tmp0;
   _res(1, 0) = _self[2] * _tmp0 - _self[3] * _tmp1;
-  _res(2, 0) = -2 * std::pow(_self[0], Scalar(2)) - 2 * std::pow(_self[1], Scalar(2)) + 1;
+  _res(2, 0) = -2 * (_self[0] * _self[0]) - 2 * (_self[1] * _self[1]) + 1;
 
   return _res;
 }
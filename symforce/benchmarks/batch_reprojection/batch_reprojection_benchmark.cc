@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+///
+/// Run with:
+///
+///     build/bin/benchmarks/batch_reprojection_benchmark
+///
+/// See run_benchmarks.py for more information
+///
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/spdlog.h>
+
+#include <sym/atan_camera_cal.h>
+#include <sym/pose3.h>
+#include <symforce/opt/parallel_for.h>
+#include <symforce/opt/tic_toc.h>
+#include <symforce/opt/util.h>
+
+#include "./gen/reprojection_error.h"
+#include "./gen/reprojection_error_batched.h"
+#include "./gen/reprojection_error_kernel.h"
+
+static constexpr int kNumObservations = 1000000;
+static constexpr int kNumRepeats = 10;
+
+// Squared pixel error above which an observation is an outlier
+static constexpr double kOutlierThresholdSquared = 4.0;
+
+/**
+ * Random observations of points by cameras, where a tenth of the observed pixels are off by a lot.
+ * The data is stored both as geo types, for the scalar function, and as structure-of-arrays, for
+ * the kernel and batched functions.
+ */
+template <typename Scalar>
+struct TestData {
+  TestData() : cal(sym::Vector5<Scalar>(380, 380, 320, 240, 0.9)) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> depth(1.0, 10.0);
+    std::uniform_real_distribution<Scalar> uniform(0.0, 1.0);
+    std::normal_distribution<Scalar> noise(0.0, 0.5);
+
+    for (int i = 0; i < kNumObservations; ++i) {
+      const sym::Pose3<Scalar> cam_T_world = sym::Random<sym::Pose3<Scalar>>(gen);
+      const sym::Vector3<Scalar> cam_t_point =
+          sym::Random<sym::Vector3<Scalar>>(gen) + sym::Vector3<Scalar>(0, 0, depth(gen));
+      const Scalar outlier_error = uniform(gen) < 0.1 ? 20 : 0;
+
+      poses.push_back(cam_T_world);
+      points.push_back(cam_T_world.Inverse() * cam_t_point);
+      pixels.push_back(cal.PixelFromCameraPoint(cam_t_point, sym::kDefaultEpsilon<Scalar>) +
+                       sym::Vector2<Scalar>(noise(gen) + outlier_error, noise(gen)));
+    }
+
+    poses_soa.resize(7 * kNumObservations);
+    points_soa.resize(3 * kNumObservations);
+    pixels_soa.resize(2 * kNumObservations);
+    for (int i = 0; i < kNumObservations; ++i) {
+      for (int j = 0; j < 7; ++j) {
+        poses_soa[j * kNumObservations + i] = poses[i].Data()[j];
+      }
+      for (int j = 0; j < 3; ++j) {
+        points_soa[j * kNumObservations + i] = points[i][j];
+      }
+      for (int j = 0; j < 2; ++j) {
+        pixels_soa[j * kNumObservations + i] = pixels[i][j];
+      }
+    }
+  }
+
+  std::vector<sym::Pose3<Scalar>> poses;
+  std::vector<sym::Vector3<Scalar>> points;
+  std::vector<sym::Vector2<Scalar>> pixels;
+  sym::ATANCameraCal<Scalar> cal;
+
+  std::vector<Scalar> poses_soa;
+  std::vector<Scalar> points_soa;
+  std::vector<Scalar> pixels_soa;
+};
+
+template <typename Scalar>
+int CountInliers(const std::vector<Scalar>& error_squared, const std::vector<Scalar>& is_valid) {
+  int num_inliers = 0;
+  for (int i = 0; i < kNumObservations; ++i) {
+    num_inliers += is_valid[i] > 0 && error_squared[i] < kOutlierThresholdSquared;
+  }
+  return num_inliers;
+}
+
+/**
+ * Evaluates the kernel on observations [begin, end) of the data
+ */
+template <typename Scalar>
+void EvaluateKernel(const TestData<Scalar>& data, const size_t begin, const size_t end,
+                    std::vector<Scalar>* const error_squared, std::vector<Scalar>* const is_valid) {
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+  sym::ReprojectionErrorKernel<Scalar>(
+      end - begin, kNumObservations, data.poses_soa.data() + begin, data.cal.Data().data(),
+      data.points_soa.data() + begin, data.pixels_soa.data() + begin, &epsilon,
+      error_squared->data() + begin, is_valid->data() + begin);
+}
+
+/**
+ * Evaluates the batched function on observations [begin, begin + Width) of the data
+ */
+template <typename Scalar, int Width>
+void EvaluateBatched(const TestData<Scalar>& data, const Eigen::Array<Scalar, Width, 5>& cal,
+                     const size_t begin, std::vector<Scalar>* const error_squared,
+                     std::vector<Scalar>* const is_valid) {
+  using Lanes = Eigen::Array<Scalar, Width, 1>;
+  const auto lanes = [begin](const std::vector<Scalar>& soa, const int rows) {
+    return Eigen::Map<const Eigen::Array<Scalar, Width, Eigen::Dynamic>, 0, Eigen::OuterStride<>>(
+        soa.data() + begin, Width, rows, Eigen::OuterStride<>(kNumObservations));
+  };
+
+  Lanes lanes_error_squared;
+  Lanes lanes_is_valid;
+  sym::ReprojectionErrorBatched<Scalar, Width>(
+      lanes(data.poses_soa, 7), cal, lanes(data.points_soa, 3), lanes(data.pixels_soa, 2),
+      Lanes::Constant(sym::kDefaultEpsilon<Scalar>), &lanes_error_squared, &lanes_is_valid);
+  Eigen::Map<Lanes>(error_squared->data() + begin) = lanes_error_squared;
+  Eigen::Map<Lanes>(is_valid->data() + begin) = lanes_is_valid;
+}
+
+/**
+ * Checks that the results match the scalar function on some of the observations
+ */
+template <typename Scalar>
+void CheckMatchesScalar(const TestData<Scalar>& data, const std::vector<Scalar>& error_squared,
+                        const std::vector<Scalar>& is_valid) {
+  for (int i = 0; i < kNumObservations; i += 997) {
+    Scalar expected_error_squared;
+    Scalar expected_is_valid;
+    sym::ReprojectionError(data.poses[i], data.cal, data.points[i], data.pixels[i],
+                           sym::kDefaultEpsilon<Scalar>, &expected_error_squared,
+                           &expected_is_valid);
+    CHECK(is_valid[i] == expected_is_valid);
+    CHECK(std::abs(error_squared[i] - expected_error_squared) <=
+          Scalar(1e-3) * (1 + expected_error_squared));
+  }
+}
+
+template <typename Scalar>
+void BenchmarkScalar(const std::string& name) {
+  const TestData<Scalar> data;
+  std::vector<Scalar> error_squared(kNumObservations);
+  std::vector<Scalar> is_valid(kNumObservations);
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      for (int i = 0; i < kNumObservations; ++i) {
+        sym::ReprojectionError(data.poses[i], data.cal, data.points[i], data.pixels[i],
+                               sym::kDefaultEpsilon<Scalar>, &error_squared[i], &is_valid[i]);
+      }
+    }
+  }
+  spdlog::info("{}_{} inliers: {}", name, typeid(Scalar).name(),
+               CountInliers(error_squared, is_valid));
+}
+
+template <typename Scalar>
+void BenchmarkKernel(const std::string& name, const int num_threads) {
+  const TestData<Scalar> data;
+  std::vector<Scalar> error_squared(kNumObservations);
+  std::vector<Scalar> is_valid(kNumObservations);
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      sym::ParallelForBlocks(
+          kNumObservations,
+          [&](const size_t begin, const size_t end) {
+            EvaluateKernel(data, begin, end, &error_squared, &is_valid);
+          },
+          /* block_size */ 4096, num_threads);
+    }
+  }
+  spdlog::info("{}_{} inliers: {}", name, typeid(Scalar).name(),
+               CountInliers(error_squared, is_valid));
+
+  // The kernel computes the same thing as the scalar function
+  CheckMatchesScalar(data, error_squared, is_valid);
+}
+
+template <typename Scalar, int Width>
+void BenchmarkBatched(const std::string& name) {
+  static_assert(kNumObservations % Width == 0, "The observations must split into whole batches");
+
+  const TestData<Scalar> data;
+  std::vector<Scalar> error_squared(kNumObservations);
+  std::vector<Scalar> is_valid(kNumObservations);
+  const Eigen::Array<Scalar, Width, 5> cal = data.cal.Data().transpose().replicate(Width, 1);
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      for (int i = 0; i < kNumObservations; i += Width) {
+        EvaluateBatched<Scalar, Width>(data, cal, i, &error_squared, &is_valid);
+      }
+    }
+  }
+  spdlog::info("{}_{} inliers: {}", name, typeid(Scalar).name(),
+               CountInliers(error_squared, is_valid));
+
+  // The batched function computes the same thing as the scalar function
+  CheckMatchesScalar(data, error_squared, is_valid);
+}
+
+TEMPLATE_TEST_CASE("scalar", "", double, float) {
+  BenchmarkScalar<TestType>("scalar");
+}
+
+TEMPLATE_TEST_CASE("kernel", "", double, float) {
+  BenchmarkKernel<TestType>("kernel", 1);
+}
+
+TEMPLATE_TEST_CASE("kernel_parallel", "", double, float) {
+  BenchmarkKernel<TestType>("kernel_parallel", 0);
+}
+
+TEMPLATE_TEST_CASE("batched", "", double, float) {
+  // One AVX2 register of either type
+  BenchmarkBatched<TestType, 32 / sizeof(TestType)>("batched");
+}
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Dense>
+
+#include <sym/pose3.h>
+
+namespace sym {
+
+/**
+ * The squared reprojection error of a point observed at a pixel, and whether the point projects
+ * into the camera at all, which is what outlier rejection needs for every observation
+ */
+template <typename Scalar>
+void ReprojectionError(const sym::Pose3<Scalar>& cam_T_world, const sym::ATANCameraCal<Scalar>& cal,
+                       const Eigen::Matrix<Scalar, 3, 1>& world_t_point,
+                       const Eigen::Matrix<Scalar, 2, 1>& pixel, const Scalar epsilon,
+                       Scalar* const error_squared = nullptr, Scalar* const is_valid = nullptr) {
+  // Total ops: 82
+
+  // Input arrays
+  const Eigen::Matrix<Scalar, 7, 1>& _cam_T_world = cam_T_world.Data();
+  const Eigen::Matrix<Scalar, 5, 1>& _cal = cal.Data();
+
+  // Intermediate terms (15)
+  const Scalar _tmp0 = 2 * _cam_T_world[3];
+  const Scalar _tmp1 = _cam_T_world[2] * _tmp0;
+  const Scalar _tmp2 = _cam_T_world[1] * _tmp0;
+  const Scalar _tmp3 = 2 * _cam_T_world[0];
+  const Scalar _tmp4 = 2 * (_cam_T_world[2] * _cam_T_world[2]);
+  const Scalar _tmp5 = 2 * (_cam_T_world[1] * _cam_T_world[1]) - 1;
+  const Scalar _tmp6 = _cam_T_world[4] + world_t_point(0, 0) * (-_tmp4 - _tmp5) +
+                       world_t_point(1, 0) * (2 * _cam_T_world[0] * _cam_T_world[1] - _tmp1) +
+                       world_t_point(2, 0) * (_cam_T_world[2] * _tmp3 + _tmp2);
+  const Scalar _tmp7 = _cam_T_world[0] * _tmp0;
+  const Scalar _tmp8 = 2 * (_cam_T_world[0] * _cam_T_world[0]);
+  const Scalar _tmp9 = _cam_T_world[6] +
+                       world_t_point(0, 0) * (2 * _cam_T_world[0] * _cam_T_world[2] - _tmp2) +
+                       world_t_point(1, 0) * (2 * _cam_T_world[1] * _cam_T_world[2] + _tmp7) +
+                       world_t_point(2, 0) * (-_tmp5 - _tmp8);
+  const Scalar _tmp10 = std::max<Scalar>(_tmp9, epsilon);
+  const Scalar _tmp11 = Scalar(1.0) / (_tmp10 * _tmp10);
+  const Scalar _tmp12 = _cam_T_world[5] + world_t_point(0, 0) * (_cam_T_world[1] * _tmp3 + _tmp1) +
+                        world_t_point(1, 0) * (-_tmp4 - _tmp8 + 1) +
+                        world_t_point(2, 0) * (2 * _cam_T_world[1] * _cam_T_world[2] - _tmp7);
+  const Scalar _tmp13 =
+      std::sqrt(Scalar(_tmp11 * (_tmp12 * _tmp12) + _tmp11 * (_tmp6 * _tmp6) + epsilon));
+  const Scalar _tmp14 =
+      std::atan(2 * _tmp13 * std::tan(Scalar(0.5) * _cal[4])) / (_cal[4] * _tmp10 * _tmp13);
+
+  // Output terms (2)
+  if (error_squared != nullptr) {
+    Scalar& _error_squared = (*error_squared);
+
+    _error_squared = [&]() {
+      const Scalar base = _cal[0] * _tmp14 * _tmp6 + _cal[2] - pixel(0, 0);
+      return base * base;
+    }() + [&]() {
+      const Scalar base = _cal[1] * _tmp12 * _tmp14 + _cal[3] - pixel(1, 0);
+      return base * base;
+    }();
+  }
+
+  if (is_valid != nullptr) {
+    Scalar& _is_valid = (*is_valid);
+
+    _is_valid = std::max<Scalar>(0, (((_tmp9) > 0) - ((_tmp9) < 0)));
+  }
+}  // NOLINT(readability/fn_size)
+
+// NOLINTNEXTLINE(readability/fn_size)
+}  // namespace sym
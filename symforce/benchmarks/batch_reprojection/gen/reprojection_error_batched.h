@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION_BATCHED.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Dense>
+
+// Only GCC and Clang support the flatten attribute
+#ifndef SYM_BATCHED_FLATTEN
+#if defined(__GNUC__) || defined(__clang__)
+#define SYM_BATCHED_FLATTEN __attribute__((flatten))
+#else
+#define SYM_BATCHED_FLATTEN
+#endif
+#endif
+
+namespace sym {
+
+/**
+ * Batched variant of ReprojectionError, which evaluates Width instances of it at once.
+ *
+ * Every argument is in structure-of-arrays layout: an argument with storage dimension D is an
+ * Eigen::Array<Scalar, Width, D>, where column i holds entry i of the storage of every instance
+ * (matrices are stored column-major).  Scalars are Eigen::Array<Scalar, Width, 1>.  All outputs,
+ * including the one returned by ReprojectionError, are optional pointer arguments.
+ *
+ * The squared reprojection error of a point observed at a pixel, and whether the point projects
+ * into the camera at all, which is what outlier rejection needs for every observation
+ */
+template <typename Scalar, int Width>
+SYM_BATCHED_FLATTEN void ReprojectionErrorBatched(
+    const Eigen::Array<Scalar, Width, 7>& cam_T_world, const Eigen::Array<Scalar, Width, 5>& cal,
+    const Eigen::Array<Scalar, Width, 3>& world_t_point,
+    const Eigen::Array<Scalar, Width, 2>& pixel, const Eigen::Array<Scalar, Width, 1>& epsilon,
+    Eigen::Array<Scalar, Width, 1>* const error_squared = nullptr,
+    Eigen::Array<Scalar, Width, 1>* const is_valid = nullptr) {
+  using Lanes = Eigen::Array<Scalar, Width, 1>;
+
+  // Total ops: 82
+
+  // Intermediate terms (15)
+  const Lanes _tmp0 = 2 * cam_T_world.col(3);
+  const Lanes _tmp1 = _tmp0 * cam_T_world.col(2);
+  const Lanes _tmp2 = _tmp0 * cam_T_world.col(1);
+  const Lanes _tmp3 = 2 * cam_T_world.col(0);
+  const Lanes _tmp4 = 2 * (cam_T_world.col(2)).square();
+  const Lanes _tmp5 = 2 * (cam_T_world.col(1)).square() - 1;
+  const Lanes _tmp6 =
+      cam_T_world.col(4) + world_t_point.col(0) * (-_tmp4 - _tmp5) +
+      world_t_point.col(1) * (-_tmp1 + 2 * cam_T_world.col(0) * cam_T_world.col(1)) +
+      world_t_point.col(2) * (_tmp2 + _tmp3 * cam_T_world.col(2));
+  const Lanes _tmp7 = _tmp0 * cam_T_world.col(0);
+  const Lanes _tmp8 = 2 * (cam_T_world.col(0)).square();
+  const Lanes _tmp9 =
+      cam_T_world.col(6) +
+      world_t_point.col(0) * (-_tmp2 + 2 * cam_T_world.col(0) * cam_T_world.col(2)) +
+      world_t_point.col(1) * (_tmp7 + 2 * cam_T_world.col(1) * cam_T_world.col(2)) +
+      world_t_point.col(2) * (-_tmp5 - _tmp8);
+  const Lanes _tmp10 = (_tmp9).max(epsilon);
+  const Lanes _tmp11 = (_tmp10).pow(Scalar(-2));
+  const Lanes _tmp12 =
+      cam_T_world.col(5) + world_t_point.col(0) * (_tmp1 + _tmp3 * cam_T_world.col(1)) +
+      world_t_point.col(1) * (-_tmp4 - _tmp8 + 1) +
+      world_t_point.col(2) * (-_tmp7 + 2 * cam_T_world.col(1) * cam_T_world.col(2));
+  const Lanes _tmp13 = (_tmp11 * (_tmp12).square() + _tmp11 * (_tmp6).square() + epsilon).sqrt();
+  const Lanes _tmp14 =
+      (2 * _tmp13 * (Scalar(0.5) * cal.col(4)).tan()).atan() / (_tmp10 * _tmp13 * cal.col(4));
+
+  // Output terms (2)
+  if (error_squared != nullptr) {
+    Eigen::Array<Scalar, Width, 1>& _error_squared = (*error_squared);
+
+    _error_squared = (_tmp12 * _tmp14 * cal.col(1) + cal.col(3) - pixel.col(1)).square() +
+                     (_tmp14 * _tmp6 * cal.col(0) + cal.col(2) - pixel.col(0)).square();
+  }
+
+  if (is_valid != nullptr) {
+    Eigen::Array<Scalar, Width, 1>& _is_valid = (*is_valid);
+
+    _is_valid = ((_tmp9).sign()).max(0);
+  }
+
+}  // NOLINT(readability/fn_size)
+
+}  // namespace sym
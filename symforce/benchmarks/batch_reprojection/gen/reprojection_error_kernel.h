@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION_KERNEL.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace sym {
+
+/**
+ * Kernel variant of ReprojectionError, which evaluates count instances of it in one loop.
+ *
+ * Every argument is a flat array in structure-of-arrays layout: entry i of the storage of instance
+ * k is at arg[i * stride + k] (matrices are stored column-major), so instance k of an argument with
+ * storage dimension D is spread over D arrays of at least count Scalars, stride apart.
+ * The uniform arguments (cal, epsilon) are shared by every instance, and are a
+ * single copy of their storage.
+ * Every output, including the one returned by ReprojectionError, is required and written for every
+ * instance.
+ *
+ * The loop body does not allocate or branch, so compilers can vectorize it.  Compile with -fopenmp
+ * to tell the compiler the loop is safe to vectorize, and with -ffast-math if the function calls
+ * math functions such as std::atan or std::sqrt, which otherwise have no vectorized versions or
+ * may set errno.  To split the work across threads, call this on contiguous ranges of instances,
+ * with the non-uniform pointers offset to the first instance of the range and the same stride, e.g.
+ * with sym::ParallelForBlocks.
+ *
+ * The squared reprojection error of a point observed at a pixel, and whether the point projects
+ * into the camera at all, which is what outlier rejection needs for every observation
+ */
+template <typename Scalar>
+void ReprojectionErrorKernel(
+    const size_t count, const size_t stride, const Scalar* const __restrict__ cam_T_world,
+    const Scalar* const __restrict__ cal, const Scalar* const __restrict__ world_t_point,
+    const Scalar* const __restrict__ pixel, const Scalar* const __restrict__ epsilon,
+    Scalar* const __restrict__ error_squared, Scalar* const __restrict__ is_valid) {
+  // Total ops: 82
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (size_t k = 0; k < count; k++) {
+    // Intermediate terms (15)
+    const Scalar _tmp0 = 2 * cam_T_world[3 * stride + k];
+    const Scalar _tmp1 = _tmp0 * cam_T_world[2 * stride + k];
+    const Scalar _tmp2 = _tmp0 * cam_T_world[1 * stride + k];
+    const Scalar _tmp3 = 2 * cam_T_world[k];
+    const Scalar _tmp4 = 2 * (cam_T_world[2 * stride + k] * cam_T_world[2 * stride + k]);
+    const Scalar _tmp5 = 2 * (cam_T_world[1 * stride + k] * cam_T_world[1 * stride + k]) - 1;
+    const Scalar _tmp6 =
+        cam_T_world[4 * stride + k] +
+        world_t_point[1 * stride + k] *
+            (-_tmp1 + 2 * cam_T_world[1 * stride + k] * cam_T_world[k]) +
+        world_t_point[2 * stride + k] * (_tmp2 + _tmp3 * cam_T_world[2 * stride + k]) +
+        world_t_point[k] * (-_tmp4 - _tmp5);
+    const Scalar _tmp7 = _tmp0 * cam_T_world[k];
+    const Scalar _tmp8 = 2 * (cam_T_world[k] * cam_T_world[k]);
+    const Scalar _tmp9 =
+        cam_T_world[6 * stride + k] +
+        world_t_point[1 * stride + k] *
+            (_tmp7 + 2 * cam_T_world[1 * stride + k] * cam_T_world[2 * stride + k]) +
+        world_t_point[2 * stride + k] * (-_tmp5 - _tmp8) +
+        world_t_point[k] * (-_tmp2 + 2 * cam_T_world[2 * stride + k] * cam_T_world[k]);
+    const Scalar _tmp10 = std::max<Scalar>(Scalar(_tmp9), Scalar(epsilon[0]));
+    const Scalar _tmp11 = Scalar(1.0) / (_tmp10 * _tmp10);
+    const Scalar _tmp12 =
+        cam_T_world[5 * stride + k] + world_t_point[1 * stride + k] * (-_tmp4 - _tmp8 + 1) +
+        world_t_point[2 * stride + k] *
+            (-_tmp7 + 2 * cam_T_world[1 * stride + k] * cam_T_world[2 * stride + k]) +
+        world_t_point[k] * (_tmp1 + _tmp3 * cam_T_world[1 * stride + k]);
+    const Scalar _tmp13 =
+        std::sqrt(Scalar(_tmp11 * (_tmp12 * _tmp12) + _tmp11 * (_tmp6 * _tmp6) + epsilon[0]));
+    const Scalar _tmp14 =
+        std::atan(2 * _tmp13 * std::tan(Scalar(0.5) * cal[4])) / (_tmp10 * _tmp13 * cal[4]);
+
+    // Output terms (2)
+    error_squared[k] = [&]() {
+      const Scalar base = _tmp12 * _tmp14 * cal[1] + cal[3] - pixel[1 * stride + k];
+      return base * base;
+    }() + [&]() {
+      const Scalar base = _tmp14 * _tmp6 * cal[0] + cal[2] - pixel[k];
+      return base * base;
+    }();
+
+    is_valid[k] = std::max<Scalar>(Scalar(0), Scalar((((_tmp9) > 0) - ((_tmp9) < 0))));
+  }
+}  // NOLINT(readability/fn_size)
+
+}  // namespace sym
@@ -0,0 +1,41 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+from pathlib import Path
+
+import symforce.symbolic as sf
+from symforce import codegen
+from symforce import typing as T
+
+
+def reprojection_error(
+    cam_T_world: sf.Pose3,
+    cal: sf.ATANCameraCal,
+    world_t_point: sf.V3,
+    pixel: sf.V2,
+    epsilon: sf.Scalar,
+) -> T.Tuple[sf.Scalar, sf.Scalar]:
+    """
+    The squared reprojection error of a point observed at a pixel, and whether the point projects
+    into the camera at all, which is what outlier rejection needs for every observation
+    """
+    projected_pixel, is_valid = cal.pixel_from_camera_point(cam_T_world * world_t_point, epsilon)
+    return (projected_pixel - pixel).squared_norm(), is_valid
+
+
+def generate(output_dir: Path) -> None:
+    """
+    Generates the scalar function, and the kernel and batched variants, which evaluate it for many
+    observations at once.  The calibration is shared by every observation of the kernel.
+    """
+    codegen.Codegen.function(
+        func=reprojection_error,
+        output_names=["error_squared", "is_valid"],
+        config=codegen.CppConfig(
+            generate_batched=True,
+            generate_kernel=True,
+            kernel_uniform_args=["cal", "epsilon"],
+        ),
+    ).generate_function(output_dir=output_dir, namespace="sym", skip_directory_nesting=True)
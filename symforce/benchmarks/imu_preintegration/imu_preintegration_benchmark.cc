@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+///
+/// Run with:
+///
+///     build/bin/benchmarks/imu_preintegration_benchmark
+///
+/// See run_benchmarks.py for more information
+///
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+#include <Eigen/Dense>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/spdlog.h>
+
+#include <symforce/opt/tic_toc.h>
+#include <symforce/slam/imu_preintegration/imu_preintegrator.h>
+
+static constexpr int kNumMeasurements = 100000;
+static constexpr int kNumRepeats = 10;
+
+/**
+ * 100 seconds of a noisy 1 kHz IMU on a body accelerating and rotating at a constant rate
+ */
+template <typename Scalar>
+struct TestData {
+  using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+  using Matrix3X = Eigen::Matrix<Scalar, 3, Eigen::Dynamic>;
+  using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  TestData()
+      : accels(3, kNumMeasurements),
+        gyros(3, kNumMeasurements),
+        dts(VectorX::Constant(kNumMeasurements, 1e-3)),
+        accel_bias(0.1, -0.2, 0.05),
+        gyro_bias(0.01, 0.02, -0.01),
+        accel_cov(Vector3::Constant(1e-3)),
+        gyro_cov(Vector3::Constant(1e-4)) {
+    std::mt19937 gen(42);
+    std::normal_distribution<Scalar> noise(0.0, 0.01);
+
+    for (int i = 0; i < kNumMeasurements; ++i) {
+      accels.col(i) =
+          accel_bias + Vector3(0.3, 0.1, 9.81) + Vector3(noise(gen), noise(gen), noise(gen));
+      gyros.col(i) =
+          gyro_bias + Vector3(0.2, -0.1, 0.4) + Vector3(noise(gen), noise(gen), noise(gen));
+    }
+  }
+
+  Matrix3X accels;
+  Matrix3X gyros;
+  VectorX dts;
+  Vector3 accel_bias;
+  Vector3 gyro_bias;
+  Vector3 accel_cov;
+  Vector3 gyro_cov;
+};
+
+template <typename Scalar>
+void LogThroughput(const std::string& name, const std::chrono::steady_clock::time_point start) {
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  spdlog::info("{}_{}: {:.3g} measurements/second", name, typeid(Scalar).name(),
+               kNumRepeats * kNumMeasurements / elapsed.count());
+}
+
+/**
+ * Integrates the data with ImuPreintegrator::IntegrateMeasurement, one measurement at a time
+ */
+template <typename Scalar>
+sym::ImuPreintegrator<Scalar> IntegrateOneAtATime(const TestData<Scalar>& data) {
+  sym::ImuPreintegrator<Scalar> integrator(data.accel_bias, data.gyro_bias);
+  for (int i = 0; i < kNumMeasurements; ++i) {
+    integrator.IntegrateMeasurement(data.accels.col(i), data.gyros.col(i), data.accel_cov,
+                                    data.gyro_cov, data.dts(i));
+  }
+  return integrator;
+}
+
+template <typename Scalar>
+void BenchmarkIntegrateMeasurement(const std::string& name) {
+  const TestData<Scalar> data;
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  const auto start = std::chrono::steady_clock::now();
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      const auto integrator = IntegrateOneAtATime(data);
+      CHECK(integrator.PreintegratedMeasurements().integrated_dt > 0);
+    }
+  }
+  LogThroughput<Scalar>(name, start);
+}
+
+template <typename Scalar>
+void BenchmarkIntegrateMeasurements(const std::string& name) {
+  const TestData<Scalar> data;
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  const auto start = std::chrono::steady_clock::now();
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      sym::ImuPreintegrator<Scalar> integrator(data.accel_bias, data.gyro_bias);
+      integrator.IntegrateMeasurements(data.accels, data.gyros, data.dts, data.accel_cov,
+                                       data.gyro_cov);
+      CHECK(integrator.PreintegratedMeasurements().integrated_dt > 0);
+    }
+  }
+  LogThroughput<Scalar>(name, start);
+}
+
+TEMPLATE_TEST_CASE("integrate_measurement", "", double, float) {
+  BenchmarkIntegrateMeasurement<TestType>("integrate_measurement");
+}
+
+TEMPLATE_TEST_CASE("integrate_measurements", "", double, float) {
+  BenchmarkIntegrateMeasurements<TestType>("integrate_measurements");
+}
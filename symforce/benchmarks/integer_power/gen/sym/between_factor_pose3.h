@@ -0,0 +1,844 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Dense>
+
+#include <sym/pose3.h>
+
+namespace sym {
+
+/**
+ * This function was autogenerated from a symbolic function. Do not modify by hand.
+ *
+ * Symbolic function: between_factor
+ *
+ * Args:
+ *     a: Pose3
+ *     b: Pose3
+ *     a_T_b: Pose3
+ *     sqrt_info: Matrix66
+ *     epsilon: Scalar
+ *
+ * Outputs:
+ *     res: Matrix61
+ *     jacobian: (6x12) jacobian of res wrt args a (6), b (6)
+ *     hessian: (12x12) Gauss-Newton hessian for args a (6), b (6). Only the lower triangle is
+ *              written, the strict upper triangle is left unmodified, so callers which read it must
+ *              initialize it
+ *     rhs: (12x1) Gauss-Newton rhs for args a (6), b (6)
+ */
+template <typename Scalar>
+__attribute__((noinline)) void BetweenFactorPose3(
+    const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>& b, const sym::Pose3<Scalar>& a_T_b,
+    const Eigen::Matrix<Scalar, 6, 6>& sqrt_info, const Scalar epsilon,
+    Eigen::Matrix<Scalar, 6, 1>* const res = nullptr,
+    Eigen::Matrix<Scalar, 6, 12>* const jacobian = nullptr,
+    Eigen::Matrix<Scalar, 12, 12>* const hessian = nullptr,
+    Eigen::Matrix<Scalar, 12, 1>* const rhs = nullptr) {
+  // Total ops: 2376
+
+  // Input arrays
+  const Eigen::Matrix<Scalar, 7, 1>& _a = a.Data();
+  const Eigen::Matrix<Scalar, 7, 1>& _b = b.Data();
+  const Eigen::Matrix<Scalar, 7, 1>& _a_T_b = a_T_b.Data();
+
+  // Intermediate terms (328)
+  const Scalar _tmp0 = (_a[1] * _a[1]);
+  const Scalar _tmp1 = 2 * _tmp0;
+  const Scalar _tmp2 = (_a[2] * _a[2]);
+  const Scalar _tmp3 = 2 * _tmp2 - 1;
+  const Scalar _tmp4 = _tmp1 + _tmp3;
+  const Scalar _tmp5 = -_tmp4;
+  const Scalar _tmp6 = 2 * _a[3];
+  const Scalar _tmp7 = _a[2] * _tmp6;
+  const Scalar _tmp8 = 2 * _a[0];
+  const Scalar _tmp9 = _a[1] * _tmp8;
+  const Scalar _tmp10 = _tmp7 + _tmp9;
+  const Scalar _tmp11 = _a[1] * _tmp6;
+  const Scalar _tmp12 = _a[2] * _tmp8;
+  const Scalar _tmp13 = _tmp11 - _tmp12;
+  const Scalar _tmp14 = -_tmp13;
+  const Scalar _tmp15 = _a[5] * _tmp10 + _a[6] * _tmp14 - _b[5] * _tmp10 - _b[6] * _tmp14;
+  const Scalar _tmp16 = -_a[4] * _tmp5 - _a_T_b[4] + _b[4] * _tmp5 - _tmp15;
+  const Scalar _tmp17 = (_a[0] * _a[0]);
+  const Scalar _tmp18 = 2 * _tmp17;
+  const Scalar _tmp19 = _tmp18 + _tmp3;
+  const Scalar _tmp20 = -_tmp19;
+  const Scalar _tmp21 = _tmp7 - _tmp9;
+  const Scalar _tmp22 = -_tmp21;
+  const Scalar _tmp23 = _a[0] * _tmp6;
+  const Scalar _tmp24 = 2 * _a[1] * _a[2];
+  const Scalar _tmp25 = _tmp23 + _tmp24;
+  const Scalar _tmp26 = _a[4] * _tmp22 + _a[6] * _tmp25 - _b[4] * _tmp22 - _b[6] * _tmp25;
+  const Scalar _tmp27 = -_a[5] * _tmp20 - _a_T_b[5] + _b[5] * _tmp20 - _tmp26;
+  const Scalar _tmp28 = _tmp1 + _tmp18 - 1;
+  const Scalar _tmp29 = -_tmp28;
+  const Scalar _tmp30 = _tmp11 + _tmp12;
+  const Scalar _tmp31 = _tmp23 - _tmp24;
+  const Scalar _tmp32 = -_tmp31;
+  const Scalar _tmp33 = _a[4] * _tmp30 + _a[5] * _tmp32 - _b[4] * _tmp30 - _b[5] * _tmp32;
+  const Scalar _tmp34 = -_a[6] * _tmp29 - _a_T_b[6] + _b[6] * _tmp29 - _tmp33;
+  const Scalar _tmp35 = epsilon - 1;
+  const Scalar _tmp36 = -_tmp35;
+  const Scalar _tmp37 = _a[3] * _b[2];
+  const Scalar _tmp38 = _a[1] * _b[0];
+  const Scalar _tmp39 = _a[0] * _b[1];
+  const Scalar _tmp40 = _a[2] * _b[3];
+  const Scalar _tmp41 = _tmp37 + _tmp38 - _tmp39 - _tmp40;
+  const Scalar _tmp42 = _a[3] * _b[3];
+  const Scalar _tmp43 = _a[0] * _b[0];
+  const Scalar _tmp44 = _a[1] * _b[1];
+  const Scalar _tmp45 = _a[2] * _b[2];
+  const Scalar _tmp46 = _tmp42 + _tmp43 + _tmp44 + _tmp45;
+  const Scalar _tmp47 = _a_T_b[3] * _tmp46;
+  const Scalar _tmp48 = _a[3] * _b[0];
+  const Scalar _tmp49 = _a[2] * _b[1];
+  const Scalar _tmp50 = _a[0] * _b[3];
+  const Scalar _tmp51 = _a[1] * _b[2];
+  const Scalar _tmp52 = _tmp48 + _tmp49 - _tmp50 - _tmp51;
+  const Scalar _tmp53 = _a[3] * _b[1];
+  const Scalar _tmp54 = _a[0] * _b[2];
+  const Scalar _tmp55 = -_a[1] * _b[3] - _a[2] * _b[0] + _tmp53 + _tmp54;
+  const Scalar _tmp56 = _a_T_b[0] * _tmp52 + _a_T_b[1] * _tmp55 + _tmp47;
+  const Scalar _tmp57 = _a_T_b[2] * _tmp41 + _tmp56;
+  const Scalar _tmp58 = std::fabs(_tmp57);
+  const Scalar _tmp59 = std::min<Scalar>(_tmp36, _tmp58);
+  const Scalar _tmp60 = 1 - (_tmp59 * _tmp59);
+  const Scalar _tmp61 = std::acos(_tmp59);
+  const Scalar _tmp62 = _tmp61 / std::sqrt(_tmp60);
+  const Scalar _tmp63 =
+      -_a_T_b[0] * _tmp46 - _a_T_b[1] * _tmp41 + _a_T_b[2] * _tmp55 + _a_T_b[3] * _tmp52;
+  const Scalar _tmp64 = (((_tmp57) > 0) - ((_tmp57) < 0));
+  const Scalar _tmp65 = 4 * std::min<Scalar>(0, _tmp64) + 2;
+  const Scalar _tmp66 = _tmp65 * sqrt_info(0, 0);
+  const Scalar _tmp67 = _tmp63 * _tmp66;
+  const Scalar _tmp68 =
+      _a_T_b[0] * _tmp41 - _a_T_b[1] * _tmp46 - _a_T_b[2] * _tmp52 + _a_T_b[3] * _tmp55;
+  const Scalar _tmp69 = _tmp62 * _tmp65;
+  const Scalar _tmp70 = _tmp68 * _tmp69;
+  const Scalar _tmp71 =
+      -_a_T_b[0] * _tmp55 + _a_T_b[1] * _tmp52 - _a_T_b[2] * _tmp46 + _a_T_b[3] * _tmp41;
+  const Scalar _tmp72 = _tmp69 * _tmp71;
+  const Scalar _tmp73 = _tmp16 * sqrt_info(0, 3) + _tmp27 * sqrt_info(0, 4) +
+                        _tmp34 * sqrt_info(0, 5) + _tmp62 * _tmp67 + _tmp70 * sqrt_info(0, 1) +
+                        _tmp72 * sqrt_info(0, 2);
+  const Scalar _tmp74 = _tmp63 * _tmp69;
+  const Scalar _tmp75 = _tmp16 * sqrt_info(1, 3) + _tmp27 * sqrt_info(1, 4) +
+                        _tmp34 * sqrt_info(1, 5) + _tmp70 * sqrt_info(1, 1) +
+                        _tmp72 * sqrt_info(1, 2) + _tmp74 * sqrt_info(1, 0);
+  const Scalar _tmp76 = _tmp16 * sqrt_info(2, 3) + _tmp27 * sqrt_info(2, 4) +
+                        _tmp34 * sqrt_info(2, 5) + _tmp70 * sqrt_info(2, 1) +
+                        _tmp72 * sqrt_info(2, 2) + _tmp74 * sqrt_info(2, 0);
+  const Scalar _tmp77 = _tmp16 * sqrt_info(3, 3) + _tmp27 * sqrt_info(3, 4) +
+                        _tmp34 * sqrt_info(3, 5) + _tmp70 * sqrt_info(3, 1) +
+                        _tmp72 * sqrt_info(3, 2) + _tmp74 * sqrt_info(3, 0);
+  const Scalar _tmp78 = _tmp16 * sqrt_info(4, 3) + _tmp27 * sqrt_info(4, 4) +
+                        _tmp34 * sqrt_info(4, 5) + _tmp70 * sqrt_info(4, 1) +
+                        _tmp72 * sqrt_info(4, 2) + _tmp74 * sqrt_info(4, 0);
+  const Scalar _tmp79 = _tmp16 * sqrt_info(5, 3) + _tmp27 * sqrt_info(5, 4) +
+                        _tmp34 * sqrt_info(5, 5) + _tmp70 * sqrt_info(5, 1) +
+                        _tmp72 * sqrt_info(5, 2) + _tmp74 * sqrt_info(5, 0);
+  const Scalar _tmp80 = -_tmp0;
+  const Scalar _tmp81 = (_a[3] * _a[3]);
+  const Scalar _tmp82 = -_tmp17 + _tmp81;
+  const Scalar _tmp83 = _tmp2 + _tmp80 + _tmp82;
+  const Scalar _tmp84 = -_a[6] * _tmp83 + _b[6] * _tmp83 - _tmp33;
+  const Scalar _tmp85 = -_tmp25;
+  const Scalar _tmp86 = -_tmp2;
+  const Scalar _tmp87 = _tmp0 + _tmp82 + _tmp86;
+  const Scalar _tmp88 = -_tmp87;
+  const Scalar _tmp89 = -_a[4] * _tmp21 - _a[5] * _tmp88 - _a[6] * _tmp85 + _b[4] * _tmp21 +
+                        _b[5] * _tmp88 + _b[6] * _tmp85;
+  const Scalar _tmp90 = (Scalar(1) / Scalar(2)) * _tmp42 + (Scalar(1) / Scalar(2)) * _tmp43 +
+                        (Scalar(1) / Scalar(2)) * _tmp44 + (Scalar(1) / Scalar(2)) * _tmp45;
+  const Scalar _tmp91 = -_tmp90;
+  const Scalar _tmp92 = _a_T_b[3] * _tmp91;
+  const Scalar _tmp93 = (Scalar(1) / Scalar(2)) * _tmp48 + (Scalar(1) / Scalar(2)) * _tmp49 -
+                        Scalar(1) / Scalar(2) * _tmp50 - Scalar(1) / Scalar(2) * _tmp51;
+  const Scalar _tmp94 = _a_T_b[0] * _tmp93;
+  const Scalar _tmp95 = (Scalar(1) / Scalar(2)) * _tmp37 + (Scalar(1) / Scalar(2)) * _tmp38 -
+                        Scalar(1) / Scalar(2) * _tmp39 - Scalar(1) / Scalar(2) * _tmp40;
+  const Scalar _tmp96 = _a_T_b[2] * _tmp95;
+  const Scalar _tmp97 = -Scalar(1) / Scalar(2) * _a[1] * _b[3] -
+                        Scalar(1) / Scalar(2) * _a[2] * _b[0] + (Scalar(1) / Scalar(2)) * _tmp53 +
+                        (Scalar(1) / Scalar(2)) * _tmp54;
+  const Scalar _tmp98 = -_tmp97;
+  const Scalar _tmp99 = -_a_T_b[1] * _tmp98;
+  const Scalar _tmp100 = _tmp96 + _tmp99;
+  const Scalar _tmp101 = -_a_T_b[2] * _tmp41;
+  const Scalar _tmp102 = std::fabs(_tmp101 - _tmp56);
+  const Scalar _tmp103 = std::min<Scalar>(_tmp102, _tmp36);
+  const Scalar _tmp104 = 1 - (_tmp103 * _tmp103);
+  const Scalar _tmp105 = std::acos(_tmp103);
+  const Scalar _tmp106 = _tmp105 / std::sqrt(_tmp104);
+  const Scalar _tmp107 = _tmp106 * (_tmp100 + _tmp92 - _tmp94);
+  const Scalar _tmp108 = _a_T_b[1] * _tmp93;
+  const Scalar _tmp109 = -_tmp108;
+  const Scalar _tmp110 = _a_T_b[2] * _tmp91;
+  const Scalar _tmp111 = _a_T_b[3] * _tmp95;
+  const Scalar _tmp112 = _a_T_b[0] * _tmp98;
+  const Scalar _tmp113 = _tmp111 + _tmp112;
+  const Scalar _tmp114 = _tmp106 * _tmp65;
+  const Scalar _tmp115 = _tmp114 * (_tmp109 - _tmp110 + _tmp113);
+  const Scalar _tmp116 = _a_T_b[1] * _tmp91;
+  const Scalar _tmp117 = _a_T_b[2] * _tmp93;
+  const Scalar _tmp118 = _a_T_b[3] * _tmp98;
+  const Scalar _tmp119 = _a_T_b[0] * _tmp95;
+  const Scalar _tmp120 = -_tmp119;
+  const Scalar _tmp121 = _tmp118 + _tmp120;
+  const Scalar _tmp122 = _tmp114 * (_tmp116 - _tmp117 + _tmp121);
+  const Scalar _tmp123 = _a_T_b[0] * _tmp90;
+  const Scalar _tmp124 = -_tmp95;
+  const Scalar _tmp125 = _a_T_b[1] * _tmp124;
+  const Scalar _tmp126 = _a_T_b[2] * _tmp97;
+  const Scalar _tmp127 = _a_T_b[3] * _tmp93;
+  const Scalar _tmp128 = _tmp123 + _tmp125 + _tmp126 - _tmp127;
+  const Scalar _tmp129 = Scalar(0.5) *
+                         ((((-_tmp102 - _tmp35) >= 0) - ((-_tmp102 - _tmp35) < 0)) + 1) *
+                         (((-_a_T_b[0] * _tmp52 - _a_T_b[1] * _tmp55 + _tmp101 - _tmp47) > 0) -
+                          ((-_a_T_b[0] * _tmp52 - _a_T_b[1] * _tmp55 + _tmp101 - _tmp47) < 0));
+  const Scalar _tmp130 = _tmp129 / _tmp104;
+  const Scalar _tmp131 = _tmp128 * _tmp130;
+  const Scalar _tmp132 = _tmp131 * _tmp65;
+  const Scalar _tmp133 = _tmp132 * _tmp68;
+  const Scalar _tmp134 = _tmp132 * _tmp71;
+  const Scalar _tmp135 = _tmp103 * _tmp105 * _tmp129 / (_tmp104 * std::sqrt(_tmp104));
+  const Scalar _tmp136 = _tmp128 * _tmp135;
+  const Scalar _tmp137 = _tmp136 * _tmp65;
+  const Scalar _tmp138 = _tmp137 * _tmp68;
+  const Scalar _tmp139 = _tmp137 * _tmp71;
+  const Scalar _tmp140 = _tmp107 * _tmp66 + _tmp115 * sqrt_info(0, 1) + _tmp122 * sqrt_info(0, 2) -
+                         _tmp131 * _tmp67 - _tmp133 * sqrt_info(0, 1) - _tmp134 * sqrt_info(0, 2) +
+                         _tmp136 * _tmp67 + _tmp138 * sqrt_info(0, 1) + _tmp139 * sqrt_info(0, 2) +
+                         _tmp84 * sqrt_info(0, 4) + _tmp89 * sqrt_info(0, 5);
+  const Scalar _tmp141 = _tmp107 * _tmp65;
+  const Scalar _tmp142 = _tmp132 * _tmp63;
+  const Scalar _tmp143 = _tmp137 * _tmp63;
+  const Scalar _tmp144 =
+      _tmp115 * sqrt_info(1, 1) + _tmp122 * sqrt_info(1, 2) - _tmp133 * sqrt_info(1, 1) -
+      _tmp134 * sqrt_info(1, 2) + _tmp138 * sqrt_info(1, 1) + _tmp139 * sqrt_info(1, 2) +
+      _tmp141 * sqrt_info(1, 0) - _tmp142 * sqrt_info(1, 0) + _tmp143 * sqrt_info(1, 0) +
+      _tmp84 * sqrt_info(1, 4) + _tmp89 * sqrt_info(1, 5);
+  const Scalar _tmp145 =
+      _tmp115 * sqrt_info(2, 1) + _tmp122 * sqrt_info(2, 2) - _tmp133 * sqrt_info(2, 1) -
+      _tmp134 * sqrt_info(2, 2) + _tmp138 * sqrt_info(2, 1) + _tmp139 * sqrt_info(2, 2) +
+      _tmp141 * sqrt_info(2, 0) - _tmp142 * sqrt_info(2, 0) + _tmp143 * sqrt_info(2, 0) +
+      _tmp84 * sqrt_info(2, 4) + _tmp89 * sqrt_info(2, 5);
+  const Scalar _tmp146 =
+      _tmp115 * sqrt_info(3, 1) + _tmp122 * sqrt_info(3, 2) - _tmp133 * sqrt_info(3, 1) -
+      _tmp134 * sqrt_info(3, 2) + _tmp138 * sqrt_info(3, 1) + _tmp139 * sqrt_info(3, 2) +
+      _tmp141 * sqrt_info(3, 0) - _tmp142 * sqrt_info(3, 0) + _tmp143 * sqrt_info(3, 0) +
+      _tmp84 * sqrt_info(3, 4) + _tmp89 * sqrt_info(3, 5);
+  const Scalar _tmp147 =
+      _tmp115 * sqrt_info(4, 1) + _tmp122 * sqrt_info(4, 2) - _tmp133 * sqrt_info(4, 1) -
+      _tmp134 * sqrt_info(4, 2) + _tmp138 * sqrt_info(4, 1) + _tmp139 * sqrt_info(4, 2) +
+      _tmp141 * sqrt_info(4, 0) - _tmp142 * sqrt_info(4, 0) + _tmp143 * sqrt_info(4, 0) +
+      _tmp84 * sqrt_info(4, 4) + _tmp89 * sqrt_info(4, 5);
+  const Scalar _tmp148 =
+      _tmp115 * sqrt_info(5, 1) + _tmp122 * sqrt_info(5, 2) - _tmp133 * sqrt_info(5, 1) -
+      _tmp134 * sqrt_info(5, 2) + _tmp138 * sqrt_info(5, 1) + _tmp139 * sqrt_info(5, 2) +
+      _tmp141 * sqrt_info(5, 0) - _tmp142 * sqrt_info(5, 0) + _tmp143 * sqrt_info(5, 0) +
+      _tmp84 * sqrt_info(5, 4) + _tmp89 * sqrt_info(5, 5);
+  const Scalar _tmp149 = -_tmp30;
+  const Scalar _tmp150 = -_tmp83;
+  const Scalar _tmp151 = -_a[4] * _tmp149 - _a[5] * _tmp31 - _a[6] * _tmp150 + _b[4] * _tmp149 +
+                         _b[5] * _tmp31 + _b[6] * _tmp150;
+  const Scalar _tmp152 = _tmp17 + _tmp80 + _tmp81 + _tmp86;
+  const Scalar _tmp153 = -_a[4] * _tmp152 + _b[4] * _tmp152 - _tmp15;
+  const Scalar _tmp154 = _a_T_b[0] * _tmp97;
+  const Scalar _tmp155 = _a_T_b[3] * _tmp124;
+  const Scalar _tmp156 = _tmp109 + _tmp155;
+  const Scalar _tmp157 = _tmp110 - _tmp154 + _tmp156;
+  const Scalar _tmp158 = _tmp106 * _tmp66;
+  const Scalar _tmp159 = _a_T_b[1] * _tmp97;
+  const Scalar _tmp160 = -_a_T_b[2] * _tmp124;
+  const Scalar _tmp161 = _tmp160 + _tmp94;
+  const Scalar _tmp162 = _tmp114 * (-_tmp159 + _tmp161 + _tmp92);
+  const Scalar _tmp163 = _a_T_b[0] * _tmp91;
+  const Scalar _tmp164 = -_tmp126;
+  const Scalar _tmp165 = _tmp125 + _tmp127;
+  const Scalar _tmp166 = _tmp114 * (-_tmp163 + _tmp164 + _tmp165);
+  const Scalar _tmp167 = _a_T_b[1] * _tmp90;
+  const Scalar _tmp168 = -_tmp93;
+  const Scalar _tmp169 = _a_T_b[2] * _tmp168;
+  const Scalar _tmp170 = _a_T_b[3] * _tmp97;
+  const Scalar _tmp171 = _tmp119 + _tmp167 + _tmp169 - _tmp170;
+  const Scalar _tmp172 = _tmp130 * _tmp171;
+  const Scalar _tmp173 = _tmp172 * _tmp65;
+  const Scalar _tmp174 = _tmp173 * _tmp68;
+  const Scalar _tmp175 = _tmp173 * _tmp71;
+  const Scalar _tmp176 = _tmp135 * _tmp171;
+  const Scalar _tmp177 = _tmp176 * _tmp65;
+  const Scalar _tmp178 = _tmp177 * _tmp68;
+  const Scalar _tmp179 = _tmp177 * _tmp71;
+  const Scalar _tmp180 = _tmp151 * sqrt_info(0, 3) + _tmp153 * sqrt_info(0, 5) + _tmp157 * _tmp158 +
+                         _tmp162 * sqrt_info(0, 1) + _tmp166 * sqrt_info(0, 2) - _tmp172 * _tmp67 -
+                         _tmp174 * sqrt_info(0, 1) - _tmp175 * sqrt_info(0, 2) + _tmp176 * _tmp67 +
+                         _tmp178 * sqrt_info(0, 1) + _tmp179 * sqrt_info(0, 2);
+  const Scalar _tmp181 = _tmp114 * _tmp157;
+  const Scalar _tmp182 = _tmp173 * _tmp63;
+  const Scalar _tmp183 = _tmp177 * _tmp63;
+  const Scalar _tmp184 =
+      _tmp151 * sqrt_info(1, 3) + _tmp153 * sqrt_info(1, 5) + _tmp162 * sqrt_info(1, 1) +
+      _tmp166 * sqrt_info(1, 2) - _tmp174 * sqrt_info(1, 1) - _tmp175 * sqrt_info(1, 2) +
+      _tmp178 * sqrt_info(1, 1) + _tmp179 * sqrt_info(1, 2) + _tmp181 * sqrt_info(1, 0) -
+      _tmp182 * sqrt_info(1, 0) + _tmp183 * sqrt_info(1, 0);
+  const Scalar _tmp185 =
+      _tmp151 * sqrt_info(2, 3) + _tmp153 * sqrt_info(2, 5) + _tmp162 * sqrt_info(2, 1) +
+      _tmp166 * sqrt_info(2, 2) - _tmp174 * sqrt_info(2, 1) - _tmp175 * sqrt_info(2, 2) +
+      _tmp178 * sqrt_info(2, 1) + _tmp179 * sqrt_info(2, 2) + _tmp181 * sqrt_info(2, 0) -
+      _tmp182 * sqrt_info(2, 0) + _tmp183 * sqrt_info(2, 0);
+  const Scalar _tmp186 =
+      _tmp151 * sqrt_info(3, 3) + _tmp153 * sqrt_info(3, 5) + _tmp162 * sqrt_info(3, 1) +
+      _tmp166 * sqrt_info(3, 2) - _tmp174 * sqrt_info(3, 1) - _tmp175 * sqrt_info(3, 2) +
+      _tmp178 * sqrt_info(3, 1) + _tmp179 * sqrt_info(3, 2) + _tmp181 * sqrt_info(3, 0) -
+      _tmp182 * sqrt_info(3, 0) + _tmp183 * sqrt_info(3, 0);
+  const Scalar _tmp187 =
+      _tmp151 * sqrt_info(4, 3) + _tmp153 * sqrt_info(4, 5) + _tmp162 * sqrt_info(4, 1) +
+      _tmp166 * sqrt_info(4, 2) - _tmp174 * sqrt_info(4, 1) - _tmp175 * sqrt_info(4, 2) +
+      _tmp178 * sqrt_info(4, 1) + _tmp179 * sqrt_info(4, 2) + _tmp181 * sqrt_info(4, 0) -
+      _tmp182 * sqrt_info(4, 0) + _tmp183 * sqrt_info(4, 0);
+  const Scalar _tmp188 =
+      _tmp151 * sqrt_info(5, 3) + _tmp153 * sqrt_info(5, 5) + _tmp162 * sqrt_info(5, 1) +
+      _tmp166 * sqrt_info(5, 2) - _tmp174 * sqrt_info(5, 1) - _tmp175 * sqrt_info(5, 2) +
+      _tmp178 * sqrt_info(5, 1) + _tmp179 * sqrt_info(5, 2) + _tmp181 * sqrt_info(5, 0) -
+      _tmp182 * sqrt_info(5, 0) + _tmp183 * sqrt_info(5, 0);
+  const Scalar _tmp189 = -_a[5] * _tmp87 + _b[5] * _tmp87 - _tmp26;
+  const Scalar _tmp190 = -_tmp10;
+  const Scalar _tmp191 = -_tmp152;
+  const Scalar _tmp192 = -_a[4] * _tmp191 - _a[5] * _tmp190 - _a[6] * _tmp13 + _b[4] * _tmp191 +
+                         _b[5] * _tmp190 + _b[6] * _tmp13;
+  const Scalar _tmp193 = _tmp169 + _tmp170;
+  const Scalar _tmp194 = -_tmp116 + _tmp120 + _tmp193;
+  const Scalar _tmp195 = _a_T_b[1] * _tmp95;
+  const Scalar _tmp196 = _a_T_b[3] * _tmp168;
+  const Scalar _tmp197 = _tmp164 + _tmp196;
+  const Scalar _tmp198 = _tmp114 * (_tmp163 - _tmp195 + _tmp197);
+  const Scalar _tmp199 = -_a_T_b[0] * _tmp168;
+  const Scalar _tmp200 = _tmp159 + _tmp199;
+  const Scalar _tmp201 = _tmp114 * (_tmp200 + _tmp92 - _tmp96);
+  const Scalar _tmp202 = _a_T_b[2] * _tmp90;
+  const Scalar _tmp203 = _tmp108 - _tmp111 + _tmp112 + _tmp202;
+  const Scalar _tmp204 = _tmp130 * _tmp203;
+  const Scalar _tmp205 = _tmp204 * _tmp65;
+  const Scalar _tmp206 = _tmp205 * _tmp68;
+  const Scalar _tmp207 = _tmp205 * _tmp71;
+  const Scalar _tmp208 = _tmp135 * _tmp203;
+  const Scalar _tmp209 = _tmp208 * _tmp65;
+  const Scalar _tmp210 = _tmp209 * _tmp68;
+  const Scalar _tmp211 = _tmp209 * _tmp71;
+  const Scalar _tmp212 = _tmp158 * _tmp194 + _tmp189 * sqrt_info(0, 3) + _tmp192 * sqrt_info(0, 4) +
+                         _tmp198 * sqrt_info(0, 1) + _tmp201 * sqrt_info(0, 2) - _tmp204 * _tmp67 -
+                         _tmp206 * sqrt_info(0, 1) - _tmp207 * sqrt_info(0, 2) + _tmp208 * _tmp67 +
+                         _tmp210 * sqrt_info(0, 1) + _tmp211 * sqrt_info(0, 2);
+  const Scalar _tmp213 = _tmp114 * _tmp194;
+  const Scalar _tmp214 = _tmp205 * _tmp63;
+  const Scalar _tmp215 = _tmp209 * _tmp63;
+  const Scalar _tmp216 =
+      _tmp189 * sqrt_info(1, 3) + _tmp192 * sqrt_info(1, 4) + _tmp198 * sqrt_info(1, 1) +
+      _tmp201 * sqrt_info(1, 2) - _tmp206 * sqrt_info(1, 1) - _tmp207 * sqrt_info(1, 2) +
+      _tmp210 * sqrt_info(1, 1) + _tmp211 * sqrt_info(1, 2) + _tmp213 * sqrt_info(1, 0) -
+      _tmp214 * sqrt_info(1, 0) + _tmp215 * sqrt_info(1, 0);
+  const Scalar _tmp217 =
+      _tmp189 * sqrt_info(2, 3) + _tmp192 * sqrt_info(2, 4) + _tmp198 * sqrt_info(2, 1) +
+      _tmp201 * sqrt_info(2, 2) - _tmp206 * sqrt_info(2, 1) - _tmp207 * sqrt_info(2, 2) +
+      _tmp210 * sqrt_info(2, 1) + _tmp211 * sqrt_info(2, 2) + _tmp213 * sqrt_info(2, 0) -
+      _tmp214 * sqrt_info(2, 0) + _tmp215 * sqrt_info(2, 0);
+  const Scalar _tmp218 =
+      _tmp189 * sqrt_info(3, 3) + _tmp192 * sqrt_info(3, 4) + _tmp198 * sqrt_info(3, 1) +
+      _tmp201 * sqrt_info(3, 2) - _tmp206 * sqrt_info(3, 1) - _tmp207 * sqrt_info(3, 2) +
+      _tmp210 * sqrt_info(3, 1) + _tmp211 * sqrt_info(3, 2) + _tmp213 * sqrt_info(3, 0) -
+      _tmp214 * sqrt_info(3, 0) + _tmp215 * sqrt_info(3, 0);
+  const Scalar _tmp219 =
+      _tmp189 * sqrt_info(4, 3) + _tmp192 * sqrt_info(4, 4) + _tmp198 * sqrt_info(4, 1) +
+      _tmp201 * sqrt_info(4, 2) - _tmp206 * sqrt_info(4, 1) - _tmp207 * sqrt_info(4, 2) +
+      _tmp210 * sqrt_info(4, 1) + _tmp211 * sqrt_info(4, 2) + _tmp213 * sqrt_info(4, 0) -
+      _tmp214 * sqrt_info(4, 0) + _tmp215 * sqrt_info(4, 0);
+  const Scalar _tmp220 =
+      _tmp189 * sqrt_info(5, 3) + _tmp192 * sqrt_info(5, 4) + _tmp198 * sqrt_info(5, 1) +
+      _tmp201 * sqrt_info(5, 2) - _tmp206 * sqrt_info(5, 1) - _tmp207 * sqrt_info(5, 2) +
+      _tmp210 * sqrt_info(5, 1) + _tmp211 * sqrt_info(5, 2) + _tmp213 * sqrt_info(5, 0) -
+      _tmp214 * sqrt_info(5, 0) + _tmp215 * sqrt_info(5, 0);
+  const Scalar _tmp221 =
+      _tmp149 * sqrt_info(0, 5) + _tmp21 * sqrt_info(0, 4) + _tmp4 * sqrt_info(0, 3);
+  const Scalar _tmp222 =
+      _tmp149 * sqrt_info(1, 5) + _tmp21 * sqrt_info(1, 4) + _tmp4 * sqrt_info(1, 3);
+  const Scalar _tmp223 =
+      _tmp149 * sqrt_info(2, 5) + _tmp21 * sqrt_info(2, 4) + _tmp4 * sqrt_info(2, 3);
+  const Scalar _tmp224 =
+      _tmp149 * sqrt_info(3, 5) + _tmp21 * sqrt_info(3, 4) + _tmp4 * sqrt_info(3, 3);
+  const Scalar _tmp225 =
+      _tmp149 * sqrt_info(4, 5) + _tmp21 * sqrt_info(4, 4) + _tmp4 * sqrt_info(4, 3);
+  const Scalar _tmp226 =
+      _tmp149 * sqrt_info(5, 5) + _tmp21 * sqrt_info(5, 4) + _tmp4 * sqrt_info(5, 3);
+  const Scalar _tmp227 =
+      _tmp19 * sqrt_info(0, 4) + _tmp190 * sqrt_info(0, 3) + _tmp31 * sqrt_info(0, 5);
+  const Scalar _tmp228 =
+      _tmp19 * sqrt_info(1, 4) + _tmp190 * sqrt_info(1, 3) + _tmp31 * sqrt_info(1, 5);
+  const Scalar _tmp229 =
+      _tmp19 * sqrt_info(2, 4) + _tmp190 * sqrt_info(2, 3) + _tmp31 * sqrt_info(2, 5);
+  const Scalar _tmp230 =
+      _tmp19 * sqrt_info(3, 4) + _tmp190 * sqrt_info(3, 3) + _tmp31 * sqrt_info(3, 5);
+  const Scalar _tmp231 =
+      _tmp19 * sqrt_info(4, 4) + _tmp190 * sqrt_info(4, 3) + _tmp31 * sqrt_info(4, 5);
+  const Scalar _tmp232 =
+      _tmp19 * sqrt_info(5, 4) + _tmp190 * sqrt_info(5, 3) + _tmp31 * sqrt_info(5, 5);
+  const Scalar _tmp233 =
+      _tmp13 * sqrt_info(0, 3) + _tmp28 * sqrt_info(0, 5) + _tmp85 * sqrt_info(0, 4);
+  const Scalar _tmp234 =
+      _tmp13 * sqrt_info(1, 3) + _tmp28 * sqrt_info(1, 5) + _tmp85 * sqrt_info(1, 4);
+  const Scalar _tmp235 =
+      _tmp13 * sqrt_info(2, 3) + _tmp28 * sqrt_info(2, 5) + _tmp85 * sqrt_info(2, 4);
+  const Scalar _tmp236 =
+      _tmp13 * sqrt_info(3, 3) + _tmp28 * sqrt_info(3, 5) + _tmp85 * sqrt_info(3, 4);
+  const Scalar _tmp237 =
+      _tmp13 * sqrt_info(4, 3) + _tmp28 * sqrt_info(4, 5) + _tmp85 * sqrt_info(4, 4);
+  const Scalar _tmp238 =
+      _tmp13 * sqrt_info(5, 3) + _tmp28 * sqrt_info(5, 5) + _tmp85 * sqrt_info(5, 4);
+  const Scalar _tmp239 = _a_T_b[3] * _tmp90;
+  const Scalar _tmp240 = _tmp100 + _tmp199 + _tmp239;
+  const Scalar _tmp241 = _tmp62 * _tmp66;
+  const Scalar _tmp242 = _a_T_b[1] * _tmp168;
+  const Scalar _tmp243 = _tmp69 * (_tmp113 - _tmp202 - _tmp242);
+  const Scalar _tmp244 = _tmp69 * (_tmp121 + _tmp167 - _tmp169);
+  const Scalar _tmp245 = _a_T_b[2] * _tmp98;
+  const Scalar _tmp246 = _tmp123 + _tmp195 + _tmp196 + _tmp245;
+  const Scalar _tmp247 =
+      _tmp64 * Scalar(0.5) * ((((-_tmp35 - _tmp58) >= 0) - ((-_tmp35 - _tmp58) < 0)) + 1);
+  const Scalar _tmp248 = _tmp247 / _tmp60;
+  const Scalar _tmp249 = _tmp246 * _tmp248;
+  const Scalar _tmp250 = _tmp249 * _tmp65;
+  const Scalar _tmp251 = _tmp250 * _tmp68;
+  const Scalar _tmp252 = _tmp250 * _tmp71;
+  const Scalar _tmp253 = _tmp247 * _tmp59 * _tmp61 / (_tmp60 * std::sqrt(_tmp60));
+  const Scalar _tmp254 = _tmp246 * _tmp253;
+  const Scalar _tmp255 = _tmp254 * _tmp65;
+  const Scalar _tmp256 = _tmp255 * _tmp68;
+  const Scalar _tmp257 = _tmp255 * _tmp71;
+  const Scalar _tmp258 = _tmp240 * _tmp241 + _tmp243 * sqrt_info(0, 1) + _tmp244 * sqrt_info(0, 2) -
+                         _tmp249 * _tmp67 - _tmp251 * sqrt_info(0, 1) - _tmp252 * sqrt_info(0, 2) +
+                         _tmp254 * _tmp67 + _tmp256 * sqrt_info(0, 1) + _tmp257 * sqrt_info(0, 2);
+  const Scalar _tmp259 = _tmp240 * _tmp69;
+  const Scalar _tmp260 = _tmp250 * _tmp63;
+  const Scalar _tmp261 = _tmp255 * _tmp63;
+  const Scalar _tmp262 =
+      _tmp243 * sqrt_info(1, 1) + _tmp244 * sqrt_info(1, 2) - _tmp251 * sqrt_info(1, 1) -
+      _tmp252 * sqrt_info(1, 2) + _tmp256 * sqrt_info(1, 1) + _tmp257 * sqrt_info(1, 2) +
+      _tmp259 * sqrt_info(1, 0) - _tmp260 * sqrt_info(1, 0) + _tmp261 * sqrt_info(1, 0);
+  const Scalar _tmp263 =
+      _tmp243 * sqrt_info(2, 1) + _tmp244 * sqrt_info(2, 2) - _tmp251 * sqrt_info(2, 1) -
+      _tmp252 * sqrt_info(2, 2) + _tmp256 * sqrt_info(2, 1) + _tmp257 * sqrt_info(2, 2) +
+      _tmp259 * sqrt_info(2, 0) - _tmp260 * sqrt_info(2, 0) + _tmp261 * sqrt_info(2, 0);
+  const Scalar _tmp264 =
+      _tmp243 * sqrt_info(3, 1) + _tmp244 * sqrt_info(3, 2) - _tmp251 * sqrt_info(3, 1) -
+      _tmp252 * sqrt_info(3, 2) + _tmp256 * sqrt_info(3, 1) + _tmp257 * sqrt_info(3, 2) +
+      _tmp259 * sqrt_info(3, 0) - _tmp260 * sqrt_info(3, 0) + _tmp261 * sqrt_info(3, 0);
+  const Scalar _tmp265 =
+      _tmp243 * sqrt_info(4, 1) + _tmp244 * sqrt_info(4, 2) - _tmp251 * sqrt_info(4, 1) -
+      _tmp252 * sqrt_info(4, 2) + _tmp256 * sqrt_info(4, 1) + _tmp257 * sqrt_info(4, 2) +
+      _tmp259 * sqrt_info(4, 0) - _tmp260 * sqrt_info(4, 0) + _tmp261 * sqrt_info(4, 0);
+  const Scalar _tmp266 =
+      _tmp243 * sqrt_info(5, 1) + _tmp244 * sqrt_info(5, 2) - _tmp251 * sqrt_info(5, 1) -
+      _tmp252 * sqrt_info(5, 2) + _tmp256 * sqrt_info(5, 1) + _tmp257 * sqrt_info(5, 2) +
+      _tmp259 * sqrt_info(5, 0) - _tmp260 * sqrt_info(5, 0) + _tmp261 * sqrt_info(5, 0);
+  const Scalar _tmp267 = -_tmp112 + _tmp156 + _tmp202;
+  const Scalar _tmp268 = _tmp69 * (_tmp161 + _tmp239 + _tmp99);
+  const Scalar _tmp269 = _tmp69 * (-_tmp123 + _tmp165 - _tmp245);
+  const Scalar _tmp270 = _a_T_b[0] * _tmp124;
+  const Scalar _tmp271 = _tmp117 + _tmp118 + _tmp167 + _tmp270;
+  const Scalar _tmp272 = _tmp248 * _tmp271;
+  const Scalar _tmp273 = _tmp272 * _tmp65;
+  const Scalar _tmp274 = _tmp273 * _tmp68;
+  const Scalar _tmp275 = _tmp273 * _tmp71;
+  const Scalar _tmp276 = _tmp253 * _tmp271;
+  const Scalar _tmp277 = _tmp276 * _tmp65;
+  const Scalar _tmp278 = _tmp277 * _tmp68;
+  const Scalar _tmp279 = _tmp277 * _tmp71;
+  const Scalar _tmp280 = _tmp241 * _tmp267 + _tmp268 * sqrt_info(0, 1) + _tmp269 * sqrt_info(0, 2) -
+                         _tmp272 * _tmp67 - _tmp274 * sqrt_info(0, 1) - _tmp275 * sqrt_info(0, 2) +
+                         _tmp276 * _tmp67 + _tmp278 * sqrt_info(0, 1) + _tmp279 * sqrt_info(0, 2);
+  const Scalar _tmp281 = _tmp267 * _tmp69;
+  const Scalar _tmp282 = _tmp273 * _tmp63;
+  const Scalar _tmp283 = _tmp277 * _tmp63;
+  const Scalar _tmp284 =
+      _tmp268 * sqrt_info(1, 1) + _tmp269 * sqrt_info(1, 2) - _tmp274 * sqrt_info(1, 1) -
+      _tmp275 * sqrt_info(1, 2) + _tmp278 * sqrt_info(1, 1) + _tmp279 * sqrt_info(1, 2) +
+      _tmp281 * sqrt_info(1, 0) - _tmp282 * sqrt_info(1, 0) + _tmp283 * sqrt_info(1, 0);
+  const Scalar _tmp285 =
+      _tmp268 * sqrt_info(2, 1) + _tmp269 * sqrt_info(2, 2) - _tmp274 * sqrt_info(2, 1) -
+      _tmp275 * sqrt_info(2, 2) + _tmp278 * sqrt_info(2, 1) + _tmp279 * sqrt_info(2, 2) +
+      _tmp281 * sqrt_info(2, 0) - _tmp282 * sqrt_info(2, 0) + _tmp283 * sqrt_info(2, 0);
+  const Scalar _tmp286 =
+      _tmp268 * sqrt_info(3, 1) + _tmp269 * sqrt_info(3, 2) - _tmp274 * sqrt_info(3, 1) -
+      _tmp275 * sqrt_info(3, 2) + _tmp278 * sqrt_info(3, 1) + _tmp279 * sqrt_info(3, 2) +
+      _tmp281 * sqrt_info(3, 0) - _tmp282 * sqrt_info(3, 0) + _tmp283 * sqrt_info(3, 0);
+  const Scalar _tmp287 =
+      _tmp268 * sqrt_info(4, 1) + _tmp269 * sqrt_info(4, 2) - _tmp274 * sqrt_info(4, 1) -
+      _tmp275 * sqrt_info(4, 2) + _tmp278 * sqrt_info(4, 1) + _tmp279 * sqrt_info(4, 2) +
+      _tmp281 * sqrt_info(4, 0) - _tmp282 * sqrt_info(4, 0) + _tmp283 * sqrt_info(4, 0);
+  const Scalar _tmp288 =
+      _tmp268 * sqrt_info(5, 1) + _tmp269 * sqrt_info(5, 2) - _tmp274 * sqrt_info(5, 1) -
+      _tmp275 * sqrt_info(5, 2) + _tmp278 * sqrt_info(5, 1) + _tmp279 * sqrt_info(5, 2) +
+      _tmp281 * sqrt_info(5, 0) - _tmp282 * sqrt_info(5, 0) + _tmp283 * sqrt_info(5, 0);
+  const Scalar _tmp289 = -_tmp167 + _tmp193 - _tmp270;
+  const Scalar _tmp290 = _tmp69 * (_tmp123 - _tmp125 + _tmp197);
+  const Scalar _tmp291 = _tmp69 * (_tmp160 + _tmp200 + _tmp239);
+  const Scalar _tmp292 = _tmp154 + _tmp155 + _tmp202 + _tmp242;
+  const Scalar _tmp293 = _tmp248 * _tmp292;
+  const Scalar _tmp294 = _tmp293 * _tmp65;
+  const Scalar _tmp295 = _tmp294 * _tmp68;
+  const Scalar _tmp296 = _tmp294 * _tmp71;
+  const Scalar _tmp297 = _tmp253 * _tmp292;
+  const Scalar _tmp298 = _tmp297 * _tmp65;
+  const Scalar _tmp299 = _tmp298 * _tmp68;
+  const Scalar _tmp300 = _tmp298 * _tmp71;
+  const Scalar _tmp301 = _tmp241 * _tmp289 + _tmp290 * sqrt_info(0, 1) + _tmp291 * sqrt_info(0, 2) -
+                         _tmp293 * _tmp67 - _tmp295 * sqrt_info(0, 1) - _tmp296 * sqrt_info(0, 2) +
+                         _tmp297 * _tmp67 + _tmp299 * sqrt_info(0, 1) + _tmp300 * sqrt_info(0, 2);
+  const Scalar _tmp302 = _tmp289 * _tmp69;
+  const Scalar _tmp303 = _tmp294 * _tmp63;
+  const Scalar _tmp304 = _tmp298 * _tmp63;
+  const Scalar _tmp305 =
+      _tmp290 * sqrt_info(1, 1) + _tmp291 * sqrt_info(1, 2) - _tmp295 * sqrt_info(1, 1) -
+      _tmp296 * sqrt_info(1, 2) + _tmp299 * sqrt_info(1, 1) + _tmp300 * sqrt_info(1, 2) +
+      _tmp302 * sqrt_info(1, 0) - _tmp303 * sqrt_info(1, 0) + _tmp304 * sqrt_info(1, 0);
+  const Scalar _tmp306 =
+      _tmp290 * sqrt_info(2, 1) + _tmp291 * sqrt_info(2, 2) - _tmp295 * sqrt_info(2, 1) -
+      _tmp296 * sqrt_info(2, 2) + _tmp299 * sqrt_info(2, 1) + _tmp300 * sqrt_info(2, 2) +
+      _tmp302 * sqrt_info(2, 0) - _tmp303 * sqrt_info(2, 0) + _tmp304 * sqrt_info(2, 0);
+  const Scalar _tmp307 =
+      _tmp290 * sqrt_info(3, 1) + _tmp291 * sqrt_info(3, 2) - _tmp295 * sqrt_info(3, 1) -
+      _tmp296 * sqrt_info(3, 2) + _tmp299 * sqrt_info(3, 1) + _tmp300 * sqrt_info(3, 2) +
+      _tmp302 * sqrt_info(3, 0) - _tmp303 * sqrt_info(3, 0) + _tmp304 * sqrt_info(3, 0);
+  const Scalar _tmp308 =
+      _tmp290 * sqrt_info(4, 1) + _tmp291 * sqrt_info(4, 2) - _tmp295 * sqrt_info(4, 1) -
+      _tmp296 * sqrt_info(4, 2) + _tmp299 * sqrt_info(4, 1) + _tmp300 * sqrt_info(4, 2) +
+      _tmp302 * sqrt_info(4, 0) - _tmp303 * sqrt_info(4, 0) + _tmp304 * sqrt_info(4, 0);
+  const Scalar _tmp309 =
+      _tmp290 * sqrt_info(5, 1) + _tmp291 * sqrt_info(5, 2) - _tmp295 * sqrt_info(5, 1) -
+      _tmp296 * sqrt_info(5, 2) + _tmp299 * sqrt_info(5, 1) + _tmp300 * sqrt_info(5, 2) +
+      _tmp302 * sqrt_info(5, 0) - _tmp303 * sqrt_info(5, 0) + _tmp304 * sqrt_info(5, 0);
+  const Scalar _tmp310 =
+      _tmp22 * sqrt_info(0, 4) + _tmp30 * sqrt_info(0, 5) + _tmp5 * sqrt_info(0, 3);
+  const Scalar _tmp311 =
+      _tmp22 * sqrt_info(1, 4) + _tmp30 * sqrt_info(1, 5) + _tmp5 * sqrt_info(1, 3);
+  const Scalar _tmp312 =
+      _tmp22 * sqrt_info(2, 4) + _tmp30 * sqrt_info(2, 5) + _tmp5 * sqrt_info(2, 3);
+  const Scalar _tmp313 =
+      _tmp22 * sqrt_info(3, 4) + _tmp30 * sqrt_info(3, 5) + _tmp5 * sqrt_info(3, 3);
+  const Scalar _tmp314 =
+      _tmp22 * sqrt_info(4, 4) + _tmp30 * sqrt_info(4, 5) + _tmp5 * sqrt_info(4, 3);
+  const Scalar _tmp315 =
+      _tmp22 * sqrt_info(5, 4) + _tmp30 * sqrt_info(5, 5) + _tmp5 * sqrt_info(5, 3);
+  const Scalar _tmp316 =
+      _tmp10 * sqrt_info(0, 3) + _tmp20 * sqrt_info(0, 4) + _tmp32 * sqrt_info(0, 5);
+  const Scalar _tmp317 =
+      _tmp10 * sqrt_info(1, 3) + _tmp20 * sqrt_info(1, 4) + _tmp32 * sqrt_info(1, 5);
+  const Scalar _tmp318 =
+      _tmp10 * sqrt_info(2, 3) + _tmp20 * sqrt_info(2, 4) + _tmp32 * sqrt_info(2, 5);
+  const Scalar _tmp319 =
+      _tmp10 * sqrt_info(3, 3) + _tmp20 * sqrt_info(3, 4) + _tmp32 * sqrt_info(3, 5);
+  const Scalar _tmp320 =
+      _tmp10 * sqrt_info(4, 3) + _tmp20 * sqrt_info(4, 4) + _tmp32 * sqrt_info(4, 5);
+  const Scalar _tmp321 =
+      _tmp10 * sqrt_info(5, 3) + _tmp20 * sqrt_info(5, 4) + _tmp32 * sqrt_info(5, 5);
+  const Scalar _tmp322 =
+      _tmp14 * sqrt_info(0, 3) + _tmp25 * sqrt_info(0, 4) + _tmp29 * sqrt_info(0, 5);
+  const Scalar _tmp323 =
+      _tmp14 * sqrt_info(1, 3) + _tmp25 * sqrt_info(1, 4) + _tmp29 * sqrt_info(1, 5);
+  const Scalar _tmp324 =
+      _tmp14 * sqrt_info(2, 3) + _tmp25 * sqrt_info(2, 4) + _tmp29 * sqrt_info(2, 5);
+  const Scalar _tmp325 =
+      _tmp14 * sqrt_info(3, 3) + _tmp25 * sqrt_info(3, 4) + _tmp29 * sqrt_info(3, 5);
+  const Scalar _tmp326 =
+      _tmp14 * sqrt_info(4, 3) + _tmp25 * sqrt_info(4, 4) + _tmp29 * sqrt_info(4, 5);
+  const Scalar _tmp327 =
+      _tmp14 * sqrt_info(5, 3) + _tmp25 * sqrt_info(5, 4) + _tmp29 * sqrt_info(5, 5);
+
+  // Output terms (4)
+  if (res != nullptr) {
+    Eigen::Matrix<Scalar, 6, 1>& _res = (*res);
+
+    _res(0, 0) = _tmp73;
+    _res(1, 0) = _tmp75;
+    _res(2, 0) = _tmp76;
+    _res(3, 0) = _tmp77;
+    _res(4, 0) = _tmp78;
+    _res(5, 0) = _tmp79;
+  }
+
+  if (jacobian != nullptr) {
+    Eigen::Matrix<Scalar, 6, 12>& _jacobian = (*jacobian);
+
+    _jacobian(0, 0) = _tmp140;
+    _jacobian(1, 0) = _tmp144;
+    _jacobian(2, 0) = _tmp145;
+    _jacobian(3, 0) = _tmp146;
+    _jacobian(4, 0) = _tmp147;
+    _jacobian(5, 0) = _tmp148;
+    _jacobian(0, 1) = _tmp180;
+    _jacobian(1, 1) = _tmp184;
+    _jacobian(2, 1) = _tmp185;
+    _jacobian(3, 1) = _tmp186;
+    _jacobian(4, 1) = _tmp187;
+    _jacobian(5, 1) = _tmp188;
+    _jacobian(0, 2) = _tmp212;
+    _jacobian(1, 2) = _tmp216;
+    _jacobian(2, 2) = _tmp217;
+    _jacobian(3, 2) = _tmp218;
+    _jacobian(4, 2) = _tmp219;
+    _jacobian(5, 2) = _tmp220;
+    _jacobian(0, 3) = _tmp221;
+    _jacobian(1, 3) = _tmp222;
+    _jacobian(2, 3) = _tmp223;
+    _jacobian(3, 3) = _tmp224;
+    _jacobian(4, 3) = _tmp225;
+    _jacobian(5, 3) = _tmp226;
+    _jacobian(0, 4) = _tmp227;
+    _jacobian(1, 4) = _tmp228;
+    _jacobian(2, 4) = _tmp229;
+    _jacobian(3, 4) = _tmp230;
+    _jacobian(4, 4) = _tmp231;
+    _jacobian(5, 4) = _tmp232;
+    _jacobian(0, 5) = _tmp233;
+    _jacobian(1, 5) = _tmp234;
+    _jacobian(2, 5) = _tmp235;
+    _jacobian(3, 5) = _tmp236;
+    _jacobian(4, 5) = _tmp237;
+    _jacobian(5, 5) = _tmp238;
+    _jacobian(0, 6) = _tmp258;
+    _jacobian(1, 6) = _tmp262;
+    _jacobian(2, 6) = _tmp263;
+    _jacobian(3, 6) = _tmp264;
+    _jacobian(4, 6) = _tmp265;
+    _jacobian(5, 6) = _tmp266;
+    _jacobian(0, 7) = _tmp280;
+    _jacobian(1, 7) = _tmp284;
+    _jacobian(2, 7) = _tmp285;
+    _jacobian(3, 7) = _tmp286;
+    _jacobian(4, 7) = _tmp287;
+    _jacobian(5, 7) = _tmp288;
+    _jacobian(0, 8) = _tmp301;
+    _jacobian(1, 8) = _tmp305;
+    _jacobian(2, 8) = _tmp306;
+    _jacobian(3, 8) = _tmp307;
+    _jacobian(4, 8) = _tmp308;
+    _jacobian(5, 8) = _tmp309;
+    _jacobian(0, 9) = _tmp310;
+    _jacobian(1, 9) = _tmp311;
+    _jacobian(2, 9) = _tmp312;
+    _jacobian(3, 9) = _tmp313;
+    _jacobian(4, 9) = _tmp314;
+    _jacobian(5, 9) = _tmp315;
+    _jacobian(0, 10) = _tmp316;
+    _jacobian(1, 10) = _tmp317;
+    _jacobian(2, 10) = _tmp318;
+    _jacobian(3, 10) = _tmp319;
+    _jacobian(4, 10) = _tmp320;
+    _jacobian(5, 10) = _tmp321;
+    _jacobian(0, 11) = _tmp322;
+    _jacobian(1, 11) = _tmp323;
+    _jacobian(2, 11) = _tmp324;
+    _jacobian(3, 11) = _tmp325;
+    _jacobian(4, 11) = _tmp326;
+    _jacobian(5, 11) = _tmp327;
+  }
+
+  if (hessian != nullptr) {
+    Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
+
+    _hessian(0, 0) = (_tmp140 * _tmp140) + (_tmp144 * _tmp144) + (_tmp145 * _tmp145) +
+                     (_tmp146 * _tmp146) + (_tmp147 * _tmp147) + (_tmp148 * _tmp148);
+    _hessian(1, 0) = _tmp140 * _tmp180 + _tmp144 * _tmp184 + _tmp145 * _tmp185 + _tmp146 * _tmp186 +
+                     _tmp147 * _tmp187 + _tmp148 * _tmp188;
+    _hessian(2, 0) = _tmp140 * _tmp212 + _tmp144 * _tmp216 + _tmp145 * _tmp217 + _tmp146 * _tmp218 +
+                     _tmp147 * _tmp219 + _tmp148 * _tmp220;
+    _hessian(3, 0) = _tmp140 * _tmp221 + _tmp144 * _tmp222 + _tmp145 * _tmp223 + _tmp146 * _tmp224 +
+                     _tmp147 * _tmp225 + _tmp148 * _tmp226;
+    _hessian(4, 0) = _tmp140 * _tmp227 + _tmp144 * _tmp228 + _tmp145 * _tmp229 + _tmp146 * _tmp230 +
+                     _tmp147 * _tmp231 + _tmp148 * _tmp232;
+    _hessian(5, 0) = _tmp140 * _tmp233 + _tmp144 * _tmp234 + _tmp145 * _tmp235 + _tmp146 * _tmp236 +
+                     _tmp147 * _tmp237 + _tmp148 * _tmp238;
+    _hessian(6, 0) = _tmp140 * _tmp258 + _tmp144 * _tmp262 + _tmp145 * _tmp263 + _tmp146 * _tmp264 +
+                     _tmp147 * _tmp265 + _tmp148 * _tmp266;
+    _hessian(7, 0) = _tmp140 * _tmp280 + _tmp144 * _tmp284 + _tmp145 * _tmp285 + _tmp146 * _tmp286 +
+                     _tmp147 * _tmp287 + _tmp148 * _tmp288;
+    _hessian(8, 0) = _tmp140 * _tmp301 + _tmp144 * _tmp305 + _tmp145 * _tmp306 + _tmp146 * _tmp307 +
+                     _tmp147 * _tmp308 + _tmp148 * _tmp309;
+    _hessian(9, 0) = _tmp140 * _tmp310 + _tmp144 * _tmp311 + _tmp145 * _tmp312 + _tmp146 * _tmp313 +
+                     _tmp147 * _tmp314 + _tmp148 * _tmp315;
+    _hessian(10, 0) = _tmp140 * _tmp316 + _tmp144 * _tmp317 + _tmp145 * _tmp318 +
+                      _tmp146 * _tmp319 + _tmp147 * _tmp320 + _tmp148 * _tmp321;
+    _hessian(11, 0) = _tmp140 * _tmp322 + _tmp144 * _tmp323 + _tmp145 * _tmp324 +
+                      _tmp146 * _tmp325 + _tmp147 * _tmp326 + _tmp148 * _tmp327;
+    _hessian(1, 1) = (_tmp180 * _tmp180) + (_tmp184 * _tmp184) + (_tmp185 * _tmp185) +
+                     (_tmp186 * _tmp186) + (_tmp187 * _tmp187) + (_tmp188 * _tmp188);
+    _hessian(2, 1) = _tmp180 * _tmp212 + _tmp184 * _tmp216 + _tmp185 * _tmp217 + _tmp186 * _tmp218 +
+                     _tmp187 * _tmp219 + _tmp188 * _tmp220;
+    _hessian(3, 1) = _tmp180 * _tmp221 + _tmp184 * _tmp222 + _tmp185 * _tmp223 + _tmp186 * _tmp224 +
+                     _tmp187 * _tmp225 + _tmp188 * _tmp226;
+    _hessian(4, 1) = _tmp180 * _tmp227 + _tmp184 * _tmp228 + _tmp185 * _tmp229 + _tmp186 * _tmp230 +
+                     _tmp187 * _tmp231 + _tmp188 * _tmp232;
+    _hessian(5, 1) = _tmp180 * _tmp233 + _tmp184 * _tmp234 + _tmp185 * _tmp235 + _tmp186 * _tmp236 +
+                     _tmp187 * _tmp237 + _tmp188 * _tmp238;
+    _hessian(6, 1) = _tmp180 * _tmp258 + _tmp184 * _tmp262 + _tmp185 * _tmp263 + _tmp186 * _tmp264 +
+                     _tmp187 * _tmp265 + _tmp188 * _tmp266;
+    _hessian(7, 1) = _tmp180 * _tmp280 + _tmp184 * _tmp284 + _tmp185 * _tmp285 + _tmp186 * _tmp286 +
+                     _tmp187 * _tmp287 + _tmp188 * _tmp288;
+    _hessian(8, 1) = _tmp180 * _tmp301 + _tmp184 * _tmp305 + _tmp185 * _tmp306 + _tmp186 * _tmp307 +
+                     _tmp187 * _tmp308 + _tmp188 * _tmp309;
+    _hessian(9, 1) = _tmp180 * _tmp310 + _tmp184 * _tmp311 + _tmp185 * _tmp312 + _tmp186 * _tmp313 +
+                     _tmp187 * _tmp314 + _tmp188 * _tmp315;
+    _hessian(10, 1) = _tmp180 * _tmp316 + _tmp184 * _tmp317 + _tmp185 * _tmp318 +
+                      _tmp186 * _tmp319 + _tmp187 * _tmp320 + _tmp188 * _tmp321;
+    _hessian(11, 1) = _tmp180 * _tmp322 + _tmp184 * _tmp323 + _tmp185 * _tmp324 +
+                      _tmp186 * _tmp325 + _tmp187 * _tmp326 + _tmp188 * _tmp327;
+    _hessian(2, 2) = (_tmp212 * _tmp212) + (_tmp216 * _tmp216) + (_tmp217 * _tmp217) +
+                     (_tmp218 * _tmp218) + (_tmp219 * _tmp219) + (_tmp220 * _tmp220);
+    _hessian(3, 2) = _tmp212 * _tmp221 + _tmp216 * _tmp222 + _tmp217 * _tmp223 + _tmp218 * _tmp224 +
+                     _tmp219 * _tmp225 + _tmp220 * _tmp226;
+    _hessian(4, 2) = _tmp212 * _tmp227 + _tmp216 * _tmp228 + _tmp217 * _tmp229 + _tmp218 * _tmp230 +
+                     _tmp219 * _tmp231 + _tmp220 * _tmp232;
+    _hessian(5, 2) = _tmp212 * _tmp233 + _tmp216 * _tmp234 + _tmp217 * _tmp235 + _tmp218 * _tmp236 +
+                     _tmp219 * _tmp237 + _tmp220 * _tmp238;
+    _hessian(6, 2) = _tmp212 * _tmp258 + _tmp216 * _tmp262 + _tmp217 * _tmp263 + _tmp218 * _tmp264 +
+                     _tmp219 * _tmp265 + _tmp220 * _tmp266;
+    _hessian(7, 2) = _tmp212 * _tmp280 + _tmp216 * _tmp284 + _tmp217 * _tmp285 + _tmp218 * _tmp286 +
+                     _tmp219 * _tmp287 + _tmp220 * _tmp288;
+    _hessian(8, 2) = _tmp212 * _tmp301 + _tmp216 * _tmp305 + _tmp217 * _tmp306 + _tmp218 * _tmp307 +
+                     _tmp219 * _tmp308 + _tmp220 * _tmp309;
+    _hessian(9, 2) = _tmp212 * _tmp310 + _tmp216 * _tmp311 + _tmp217 * _tmp312 + _tmp218 * _tmp313 +
+                     _tmp219 * _tmp314 + _tmp220 * _tmp315;
+    _hessian(10, 2) = _tmp212 * _tmp316 + _tmp216 * _tmp317 + _tmp217 * _tmp318 +
+                      _tmp218 * _tmp319 + _tmp219 * _tmp320 + _tmp220 * _tmp321;
+    _hessian(11, 2) = _tmp212 * _tmp322 + _tmp216 * _tmp323 + _tmp217 * _tmp324 +
+                      _tmp218 * _tmp325 + _tmp219 * _tmp326 + _tmp220 * _tmp327;
+    _hessian(3, 3) = (_tmp221 * _tmp221) + (_tmp222 * _tmp222) + (_tmp223 * _tmp223) +
+                     (_tmp224 * _tmp224) + (_tmp225 * _tmp225) + (_tmp226 * _tmp226);
+    _hessian(4, 3) = _tmp221 * _tmp227 + _tmp222 * _tmp228 + _tmp223 * _tmp229 + _tmp224 * _tmp230 +
+                     _tmp225 * _tmp231 + _tmp226 * _tmp232;
+    _hessian(5, 3) = _tmp221 * _tmp233 + _tmp222 * _tmp234 + _tmp223 * _tmp235 + _tmp224 * _tmp236 +
+                     _tmp225 * _tmp237 + _tmp226 * _tmp238;
+    _hessian(6, 3) = _tmp221 * _tmp258 + _tmp222 * _tmp262 + _tmp223 * _tmp263 + _tmp224 * _tmp264 +
+                     _tmp225 * _tmp265 + _tmp226 * _tmp266;
+    _hessian(7, 3) = _tmp221 * _tmp280 + _tmp222 * _tmp284 + _tmp223 * _tmp285 + _tmp224 * _tmp286 +
+                     _tmp225 * _tmp287 + _tmp226 * _tmp288;
+    _hessian(8, 3) = _tmp221 * _tmp301 + _tmp222 * _tmp305 + _tmp223 * _tmp306 + _tmp224 * _tmp307 +
+                     _tmp225 * _tmp308 + _tmp226 * _tmp309;
+    _hessian(9, 3) = _tmp221 * _tmp310 + _tmp222 * _tmp311 + _tmp223 * _tmp312 + _tmp224 * _tmp313 +
+                     _tmp225 * _tmp314 + _tmp226 * _tmp315;
+    _hessian(10, 3) = _tmp221 * _tmp316 + _tmp222 * _tmp317 + _tmp223 * _tmp318 +
+                      _tmp224 * _tmp319 + _tmp225 * _tmp320 + _tmp226 * _tmp321;
+    _hessian(11, 3) = _tmp221 * _tmp322 + _tmp222 * _tmp323 + _tmp223 * _tmp324 +
+                      _tmp224 * _tmp325 + _tmp225 * _tmp326 + _tmp226 * _tmp327;
+    _hessian(4, 4) = (_tmp227 * _tmp227) + (_tmp228 * _tmp228) + (_tmp229 * _tmp229) +
+                     (_tmp230 * _tmp230) + (_tmp231 * _tmp231) + (_tmp232 * _tmp232);
+    _hessian(5, 4) = _tmp227 * _tmp233 + _tmp228 * _tmp234 + _tmp229 * _tmp235 + _tmp230 * _tmp236 +
+                     _tmp231 * _tmp237 + _tmp232 * _tmp238;
+    _hessian(6, 4) = _tmp227 * _tmp258 + _tmp228 * _tmp262 + _tmp229 * _tmp263 + _tmp230 * _tmp264 +
+                     _tmp231 * _tmp265 + _tmp232 * _tmp266;
+    _hessian(7, 4) = _tmp227 * _tmp280 + _tmp228 * _tmp284 + _tmp229 * _tmp285 + _tmp230 * _tmp286 +
+                     _tmp231 * _tmp287 + _tmp232 * _tmp288;
+    _hessian(8, 4) = _tmp227 * _tmp301 + _tmp228 * _tmp305 + _tmp229 * _tmp306 + _tmp230 * _tmp307 +
+                     _tmp231 * _tmp308 + _tmp232 * _tmp309;
+    _hessian(9, 4) = _tmp227 * _tmp310 + _tmp228 * _tmp311 + _tmp229 * _tmp312 + _tmp230 * _tmp313 +
+                     _tmp231 * _tmp314 + _tmp232 * _tmp315;
+    _hessian(10, 4) = _tmp227 * _tmp316 + _tmp228 * _tmp317 + _tmp229 * _tmp318 +
+                      _tmp230 * _tmp319 + _tmp231 * _tmp320 + _tmp232 * _tmp321;
+    _hessian(11, 4) = _tmp227 * _tmp322 + _tmp228 * _tmp323 + _tmp229 * _tmp324 +
+                      _tmp230 * _tmp325 + _tmp231 * _tmp326 + _tmp232 * _tmp327;
+    _hessian(5, 5) = (_tmp233 * _tmp233) + (_tmp234 * _tmp234) + (_tmp235 * _tmp235) +
+                     (_tmp236 * _tmp236) + (_tmp237 * _tmp237) + (_tmp238 * _tmp238);
+    _hessian(6, 5) = _tmp233 * _tmp258 + _tmp234 * _tmp262 + _tmp235 * _tmp263 + _tmp236 * _tmp264 +
+                     _tmp237 * _tmp265 + _tmp238 * _tmp266;
+    _hessian(7, 5) = _tmp233 * _tmp280 + _tmp234 * _tmp284 + _tmp235 * _tmp285 + _tmp236 * _tmp286 +
+                     _tmp237 * _tmp287 + _tmp238 * _tmp288;
+    _hessian(8, 5) = _tmp233 * _tmp301 + _tmp234 * _tmp305 + _tmp235 * _tmp306 + _tmp236 * _tmp307 +
+                     _tmp237 * _tmp308 + _tmp238 * _tmp309;
+    _hessian(9, 5) = _tmp233 * _tmp310 + _tmp234 * _tmp311 + _tmp235 * _tmp312 + _tmp236 * _tmp313 +
+                     _tmp237 * _tmp314 + _tmp238 * _tmp315;
+    _hessian(10, 5) = _tmp233 * _tmp316 + _tmp234 * _tmp317 + _tmp235 * _tmp318 +
+                      _tmp236 * _tmp319 + _tmp237 * _tmp320 + _tmp238 * _tmp321;
+    _hessian(11, 5) = _tmp233 * _tmp322 + _tmp234 * _tmp323 + _tmp235 * _tmp324 +
+                      _tmp236 * _tmp325 + _tmp237 * _tmp326 + _tmp238 * _tmp327;
+    _hessian(6, 6) = (_tmp258 * _tmp258) + (_tmp262 * _tmp262) + (_tmp263 * _tmp263) +
+                     (_tmp264 * _tmp264) + (_tmp265 * _tmp265) + (_tmp266 * _tmp266);
+    _hessian(7, 6) = _tmp258 * _tmp280 + _tmp262 * _tmp284 + _tmp263 * _tmp285 + _tmp264 * _tmp286 +
+                     _tmp265 * _tmp287 + _tmp266 * _tmp288;
+    _hessian(8, 6) = _tmp258 * _tmp301 + _tmp262 * _tmp305 + _tmp263 * _tmp306 + _tmp264 * _tmp307 +
+                     _tmp265 * _tmp308 + _tmp266 * _tmp309;
+    _hessian(9, 6) = _tmp258 * _tmp310 + _tmp262 * _tmp311 + _tmp263 * _tmp312 + _tmp264 * _tmp313 +
+                     _tmp265 * _tmp314 + _tmp266 * _tmp315;
+    _hessian(10, 6) = _tmp258 * _tmp316 + _tmp262 * _tmp317 + _tmp263 * _tmp318 +
+                      _tmp264 * _tmp319 + _tmp265 * _tmp320 + _tmp266 * _tmp321;
+    _hessian(11, 6) = _tmp258 * _tmp322 + _tmp262 * _tmp323 + _tmp263 * _tmp324 +
+                      _tmp264 * _tmp325 + _tmp265 * _tmp326 + _tmp266 * _tmp327;
+    _hessian(7, 7) = (_tmp280 * _tmp280) + (_tmp284 * _tmp284) + (_tmp285 * _tmp285) +
+                     (_tmp286 * _tmp286) + (_tmp287 * _tmp287) + (_tmp288 * _tmp288);
+    _hessian(8, 7) = _tmp280 * _tmp301 + _tmp284 * _tmp305 + _tmp285 * _tmp306 + _tmp286 * _tmp307 +
+                     _tmp287 * _tmp308 + _tmp288 * _tmp309;
+    _hessian(9, 7) = _tmp280 * _tmp310 + _tmp284 * _tmp311 + _tmp285 * _tmp312 + _tmp286 * _tmp313 +
+                     _tmp287 * _tmp314 + _tmp288 * _tmp315;
+    _hessian(10, 7) = _tmp280 * _tmp316 + _tmp284 * _tmp317 + _tmp285 * _tmp318 +
+                      _tmp286 * _tmp319 + _tmp287 * _tmp320 + _tmp288 * _tmp321;
+    _hessian(11, 7) = _tmp280 * _tmp322 + _tmp284 * _tmp323 + _tmp285 * _tmp324 +
+                      _tmp286 * _tmp325 + _tmp287 * _tmp326 + _tmp288 * _tmp327;
+    _hessian(8, 8) = (_tmp301 * _tmp301) + (_tmp305 * _tmp305) + (_tmp306 * _tmp306) +
+                     (_tmp307 * _tmp307) + (_tmp308 * _tmp308) + (_tmp309 * _tmp309);
+    _hessian(9, 8) = _tmp301 * _tmp310 + _tmp305 * _tmp311 + _tmp306 * _tmp312 + _tmp307 * _tmp313 +
+                     _tmp308 * _tmp314 + _tmp309 * _tmp315;
+    _hessian(10, 8) = _tmp301 * _tmp316 + _tmp305 * _tmp317 + _tmp306 * _tmp318 +
+                      _tmp307 * _tmp319 + _tmp308 * _tmp320 + _tmp309 * _tmp321;
+    _hessian(11, 8) = _tmp301 * _tmp322 + _tmp305 * _tmp323 + _tmp306 * _tmp324 +
+                      _tmp307 * _tmp325 + _tmp308 * _tmp326 + _tmp309 * _tmp327;
+    _hessian(9, 9) = (_tmp310 * _tmp310) + (_tmp311 * _tmp311) + (_tmp312 * _tmp312) +
+                     (_tmp313 * _tmp313) + (_tmp314 * _tmp314) + (_tmp315 * _tmp315);
+    _hessian(10, 9) = _tmp310 * _tmp316 + _tmp311 * _tmp317 + _tmp312 * _tmp318 +
+                      _tmp313 * _tmp319 + _tmp314 * _tmp320 + _tmp315 * _tmp321;
+    _hessian(11, 9) = _tmp310 * _tmp322 + _tmp311 * _tmp323 + _tmp312 * _tmp324 +
+                      _tmp313 * _tmp325 + _tmp314 * _tmp326 + _tmp315 * _tmp327;
+    _hessian(10, 10) = (_tmp316 * _tmp316) + (_tmp317 * _tmp317) + (_tmp318 * _tmp318) +
+                       (_tmp319 * _tmp319) + (_tmp320 * _tmp320) + (_tmp321 * _tmp321);
+    _hessian(11, 10) = _tmp316 * _tmp322 + _tmp317 * _tmp323 + _tmp318 * _tmp324 +
+                       _tmp319 * _tmp325 + _tmp320 * _tmp326 + _tmp321 * _tmp327;
+    _hessian(11, 11) = (_tmp322 * _tmp322) + (_tmp323 * _tmp323) + (_tmp324 * _tmp324) +
+                       (_tmp325 * _tmp325) + (_tmp326 * _tmp326) + (_tmp327 * _tmp327);
+  }
+
+  if (rhs != nullptr) {
+    Eigen::Matrix<Scalar, 12, 1>& _rhs = (*rhs);
+
+    _rhs(0, 0) = _tmp140 * _tmp73 + _tmp144 * _tmp75 + _tmp145 * _tmp76 + _tmp146 * _tmp77 +
+                 _tmp147 * _tmp78 + _tmp148 * _tmp79;
+    _rhs(1, 0) = _tmp180 * _tmp73 + _tmp184 * _tmp75 + _tmp185 * _tmp76 + _tmp186 * _tmp77 +
+                 _tmp187 * _tmp78 + _tmp188 * _tmp79;
+    _rhs(2, 0) = _tmp212 * _tmp73 + _tmp216 * _tmp75 + _tmp217 * _tmp76 + _tmp218 * _tmp77 +
+                 _tmp219 * _tmp78 + _tmp220 * _tmp79;
+    _rhs(3, 0) = _tmp221 * _tmp73 + _tmp222 * _tmp75 + _tmp223 * _tmp76 + _tmp224 * _tmp77 +
+                 _tmp225 * _tmp78 + _tmp226 * _tmp79;
+    _rhs(4, 0) = _tmp227 * _tmp73 + _tmp228 * _tmp75 + _tmp229 * _tmp76 + _tmp230 * _tmp77 +
+                 _tmp231 * _tmp78 + _tmp232 * _tmp79;
+    _rhs(5, 0) = _tmp233 * _tmp73 + _tmp234 * _tmp75 + _tmp235 * _tmp76 + _tmp236 * _tmp77 +
+                 _tmp237 * _tmp78 + _tmp238 * _tmp79;
+    _rhs(6, 0) = _tmp258 * _tmp73 + _tmp262 * _tmp75 + _tmp263 * _tmp76 + _tmp264 * _tmp77 +
+                 _tmp265 * _tmp78 + _tmp266 * _tmp79;
+    _rhs(7, 0) = _tmp280 * _tmp73 + _tmp284 * _tmp75 + _tmp285 * _tmp76 + _tmp286 * _tmp77 +
+                 _tmp287 * _tmp78 + _tmp288 * _tmp79;
+    _rhs(8, 0) = _tmp301 * _tmp73 + _tmp305 * _tmp75 + _tmp306 * _tmp76 + _tmp307 * _tmp77 +
+                 _tmp308 * _tmp78 + _tmp309 * _tmp79;
+    _rhs(9, 0) = _tmp310 * _tmp73 + _tmp311 * _tmp75 + _tmp312 * _tmp76 + _tmp313 * _tmp77 +
+                 _tmp314 * _tmp78 + _tmp315 * _tmp79;
+    _rhs(10, 0) = _tmp316 * _tmp73 + _tmp317 * _tmp75 + _tmp318 * _tmp76 + _tmp319 * _tmp77 +
+                  _tmp320 * _tmp78 + _tmp321 * _tmp79;
+    _rhs(11, 0) = _tmp322 * _tmp73 + _tmp323 * _tmp75 + _tmp324 * _tmp76 + _tmp325 * _tmp77 +
+                  _tmp326 * _tmp78 + _tmp327 * _tmp79;
+  }
+}  // NOLINT(readability/fn_size)
+
+// NOLINTNEXTLINE(readability/fn_size)
+}  // namespace sym
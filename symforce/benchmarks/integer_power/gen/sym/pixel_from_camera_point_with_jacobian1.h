@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Dense>
+
+namespace sym {
+
+/**
+ * This function was autogenerated from a symbolic function. Do not modify by hand.
+ *
+ * Symbolic function: pixel_from_camera_point
+ *
+ * Args:
+ *     cal: ATANCameraCal
+ *     point: Matrix31
+ *     epsilon: Scalar
+ *
+ * Outputs:
+ *     res: Matrix21
+ *     res_D_point: (2x3) jacobian of res (2) wrt arg point (3)
+ */
+template <typename Scalar>
+__attribute__((noinline)) Eigen::Matrix<Scalar, 2, 1> PixelFromCameraPointWithJacobian1(
+    const sym::ATANCameraCal<Scalar>& cal, const Eigen::Matrix<Scalar, 3, 1>& point,
+    const Scalar epsilon, Eigen::Matrix<Scalar, 2, 3>* const res_D_point = nullptr) {
+  // Total ops: 100
+
+  // Input arrays
+  const Eigen::Matrix<Scalar, 5, 1>& _cal = cal.Data();
+
+  // Intermediate terms (35)
+  const Scalar _tmp0 = Scalar(1.0) / (_cal[4]);
+  const Scalar _tmp1 = (point(0, 0) * point(0, 0));
+  const Scalar _tmp2 = std::max<Scalar>(epsilon, point(2, 0));
+  const Scalar _tmp3 = Scalar(1.0) / (_tmp2 * _tmp2);
+  const Scalar _tmp4 = (point(1, 0) * point(1, 0));
+  const Scalar _tmp5 = _tmp1 * _tmp3 + _tmp3 * _tmp4 + epsilon;
+  const Scalar _tmp6 = std::sqrt(_tmp5);
+  const Scalar _tmp7 = std::tan(Scalar(0.5) * _cal[4]);
+  const Scalar _tmp8 = 2 * _tmp7;
+  const Scalar _tmp9 = _tmp0 * std::atan(_tmp6 * _tmp8);
+  const Scalar _tmp10 = _cal[0] * _tmp9;
+  const Scalar _tmp11 = Scalar(1.0) / (_tmp6);
+  const Scalar _tmp12 = Scalar(1.0) / (_tmp2);
+  const Scalar _tmp13 = _tmp11 * _tmp12;
+  const Scalar _tmp14 = _tmp10 * _tmp13;
+  const Scalar _tmp15 = _cal[1] * _tmp9;
+  const Scalar _tmp16 = _tmp13 * _tmp15;
+  const Scalar _tmp17 = Scalar(1.0) / (_tmp2 * _tmp2 * _tmp2);
+  const Scalar _tmp18 = Scalar(1.0) / (_tmp5 * std::sqrt(_tmp5));
+  const Scalar _tmp19 = _tmp17 * _tmp18;
+  const Scalar _tmp20 = _tmp10 * _tmp19;
+  const Scalar _tmp21 = Scalar(1.0) / (4 * _tmp5 * (_tmp7 * _tmp7) + 1);
+  const Scalar _tmp22 = Scalar(1.0) / (_tmp5);
+  const Scalar _tmp23 = _tmp0 * _tmp21 * _tmp22 * _tmp8;
+  const Scalar _tmp24 = _tmp17 * _tmp23;
+  const Scalar _tmp25 = _tmp15 * _tmp19;
+  const Scalar _tmp26 = point(0, 0) * point(1, 0);
+  const Scalar _tmp27 = _tmp10 * point(0, 0);
+  const Scalar _tmp28 =
+      Scalar(0.5) * ((((-epsilon + point(2, 0)) >= 0) - ((-epsilon + point(2, 0)) < 0)) + 1);
+  const Scalar _tmp29 = _tmp11 * _tmp28 * _tmp3;
+  const Scalar _tmp30 = _tmp17 * _tmp28;
+  const Scalar _tmp31 = _tmp1 * _tmp30 + _tmp30 * _tmp4;
+  const Scalar _tmp32 = _tmp12 * _tmp18 * _tmp31;
+  const Scalar _tmp33 = -_tmp12 * _tmp23 * _tmp31;
+  const Scalar _tmp34 = _tmp15 * point(1, 0);
+
+  // Output terms (2)
+  Eigen::Matrix<Scalar, 2, 1> _res;
+
+  _res(0, 0) = _cal[2] + _tmp14 * point(0, 0);
+  _res(1, 0) = _cal[3] + _tmp16 * point(1, 0);
+
+  if (res_D_point != nullptr) {
+    Eigen::Matrix<Scalar, 2, 3>& _res_D_point = (*res_D_point);
+
+    _res_D_point(0, 0) = _cal[0] * _tmp1 * _tmp24 - _tmp1 * _tmp20 + _tmp14;
+    _res_D_point(1, 0) =
+        2 * _cal[1] * _tmp0 * _tmp17 * _tmp21 * _tmp22 * _tmp7 * point(0, 0) * point(1, 0) -
+        _tmp25 * _tmp26;
+    _res_D_point(0, 1) =
+        2 * _cal[0] * _tmp0 * _tmp17 * _tmp21 * _tmp22 * _tmp7 * point(0, 0) * point(1, 0) -
+        _tmp20 * _tmp26;
+    _res_D_point(1, 1) = _cal[1] * _tmp24 * _tmp4 + _tmp16 - _tmp25 * _tmp4;
+    _res_D_point(0, 2) = _cal[0] * _tmp33 * point(0, 0) - _tmp27 * _tmp29 + _tmp27 * _tmp32;
+    _res_D_point(1, 2) = _cal[1] * _tmp33 * point(1, 0) - _tmp29 * _tmp34 + _tmp32 * _tmp34;
+  }
+
+  return _res;
+}  // NOLINT(readability/fn_size)
+
+// NOLINTNEXTLINE(readability/fn_size)
+}  // namespace sym
@@ -0,0 +1,74 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+from dataclasses import dataclass
+from pathlib import Path
+
+from sympy.printing.codeprinter import CodePrinter
+
+import symforce.symbolic as sf
+from symforce import codegen
+from symforce import typing as T
+from symforce.codegen.backends.cpp.cpp_code_printer import CppCodePrinter
+from symforce.codegen.geo_factors_codegen import between_factor
+
+
+class StdPowCppCodePrinter(CppCodePrinter):
+    """
+    CppCodePrinter that prints constant powers with std::pow, except for the ones the printer
+    always special-cased (-1, 1/2, and 3/2).  This is the baseline for the benchmark.
+    """
+
+    def _print_Pow(self, expr: sf.sympy.Pow, rational: bool = False) -> str:
+        if not expr.exp.is_Number or expr.exp in (-1, sf.S.One / 2, sf.S(3) / 2):
+            return super()._print_Pow(expr, rational)
+
+        base_str = self._print(expr.base)
+        if not isinstance(expr.base, sf.sympy.Symbol):
+            base_str = f"Scalar({base_str})"
+
+        return f"std::pow({base_str}, Scalar({self._print(expr.exp)}))"
+
+
+@dataclass
+class StdPowCppConfig(codegen.CppConfig):
+    def printer(self) -> CodePrinter:
+        return StdPowCppCodePrinter(override_methods=self.override_methods)
+
+
+def pixel_from_camera_point(cal: sf.ATANCameraCal, point: sf.V3, epsilon: sf.Scalar) -> sf.V2:
+    pixel, _ = cal.pixel_from_camera_point(point, epsilon=epsilon)
+    return pixel
+
+
+def generate(output_dir: Path) -> None:
+    """
+    Generates each function twice, once with the default printer into the sym namespace and once
+    with StdPowCppCodePrinter into the std_pow namespace
+    """
+    # Not inlined, so that the compiler's inlining decisions don't differ between the two variants
+    kwargs: T.Dict[str, T.Any] = dict(force_no_inline=True)
+    configs: T.Dict[str, codegen.CppConfig] = {
+        "sym": codegen.CppConfig(**kwargs),
+        "std_pow": StdPowCppConfig(**kwargs),
+    }
+
+    for namespace, config in configs.items():
+        codegen.Codegen.function(
+            func=between_factor,
+            input_types=[sf.Pose3, sf.Pose3, sf.Pose3, sf.M66, sf.Symbol],
+            output_names=["res"],
+            config=config,
+        ).with_linearization(
+            name="between_factor_pose3", which_args=["a", "b"], lower_triangular_hessian=True
+        ).generate_function(
+            output_dir=output_dir / namespace, namespace=namespace, skip_directory_nesting=True
+        )
+
+        codegen.Codegen.function(func=pixel_from_camera_point, config=config).with_jacobians(
+            which_args=["point"]
+        ).generate_function(
+            output_dir=output_dir / namespace, namespace=namespace, skip_directory_nesting=True
+        )
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+///
+/// Run with:
+///
+///     build/bin/benchmarks/integer_power_benchmark
+///
+/// See run_benchmarks.py for more information
+///
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/spdlog.h>
+
+#include <sym/atan_camera_cal.h>
+#include <sym/pose3.h>
+#include <symforce/opt/tic_toc.h>
+#include <symforce/opt/util.h>
+
+#include "./gen/std_pow/between_factor_pose3.h"
+#include "./gen/std_pow/pixel_from_camera_point_with_jacobian1.h"
+#include "./gen/sym/between_factor_pose3.h"
+#include "./gen/sym/pixel_from_camera_point_with_jacobian1.h"
+
+static constexpr int kNumSamples = 100000;
+static constexpr int kNumRepeats = 10;
+
+/**
+ * Random test data utility.
+ */
+template <typename Scalar>
+struct TestData {
+  TestData() : cal(sym::Vector5<Scalar>(380, 380, 320, 240, 0.9)) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> depth(1.0, 10.0);
+    for (int i = 0; i < kNumSamples; ++i) {
+      a.push_back(sym::Random<sym::Pose3<Scalar>>(gen));
+      b.push_back(a.back().Retract(Scalar(0.1) * sym::Random<sym::Vector6<Scalar>>(gen)));
+      a_T_b.push_back(sym::Random<sym::Pose3<Scalar>>(gen));
+      points.push_back(
+          (sym::Random<sym::Vector3<Scalar>>(gen) + sym::Vector3<Scalar>(0, 0, depth(gen))).eval());
+    }
+
+    sqrt_info = sym::Random<sym::Vector6<Scalar>>(gen).cwiseAbs().asDiagonal();
+  }
+
+  std::vector<sym::Pose3<Scalar>> a;
+  std::vector<sym::Pose3<Scalar>> b;
+  std::vector<sym::Pose3<Scalar>> a_T_b;
+  std::vector<sym::Vector3<Scalar>> points;
+  sym::Matrix66<Scalar> sqrt_info;
+  sym::ATANCameraCal<Scalar> cal;
+};
+
+// Functors calling the two variants of each generated function, so that both variants run through
+// exactly the same benchmark loop
+struct SymBetweenFactorPose3 {
+  template <typename... Args>
+  void operator()(Args&&... args) const {
+    sym::BetweenFactorPose3(std::forward<Args>(args)...);
+  }
+};
+
+struct StdPowBetweenFactorPose3 {
+  template <typename... Args>
+  void operator()(Args&&... args) const {
+    std_pow::BetweenFactorPose3(std::forward<Args>(args)...);
+  }
+};
+
+struct SymPixelFromCameraPoint {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return sym::PixelFromCameraPointWithJacobian1(std::forward<Args>(args)...);
+  }
+};
+
+struct StdPowPixelFromCameraPoint {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return std_pow::PixelFromCameraPointWithJacobian1(std::forward<Args>(args)...);
+  }
+};
+
+template <typename Scalar, typename Function>
+void BenchmarkBetweenFactor(const std::string& name) {
+  const TestData<Scalar> data;
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  sym::Vector6<Scalar> residual;
+  Eigen::Matrix<Scalar, 6, 12> jacobian;
+  Eigen::Matrix<Scalar, 12, 12> hessian;
+  Eigen::Matrix<Scalar, 12, 1> rhs;
+
+  Scalar sum = 0.0;
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      for (int i = 0; i < kNumSamples; ++i) {
+        Function{}(data.a[i], data.b[i], data.a_T_b[i], data.sqrt_info,
+                   sym::kDefaultEpsilon<Scalar>, &residual, &jacobian, &hessian, &rhs);
+        sum += residual(0) + jacobian(1, 2) + hessian(11, 0) + rhs(3);
+      }
+    }
+  }
+  spdlog::info("{}_{} sum: {}", name, typeid(Scalar).name(), sum);
+}
+
+template <typename Scalar, typename Function>
+void BenchmarkPixelFromCameraPoint(const std::string& name) {
+  const TestData<Scalar> data;
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  Eigen::Matrix<Scalar, 2, 3> jacobian;
+
+  Scalar sum = 0.0;
+  {
+    SYM_TIME_SCOPE("{}_{}", name, typeid(Scalar).name());
+    for (int repeat = 0; repeat < kNumRepeats; ++repeat) {
+      for (int i = 0; i < kNumSamples; ++i) {
+        const sym::Vector2<Scalar> pixel =
+            Function{}(data.cal, data.points[i], sym::kDefaultEpsilon<Scalar>, &jacobian);
+        sum += pixel(0) + jacobian(1, 2);
+      }
+    }
+  }
+  spdlog::info("{}_{} sum: {}", name, typeid(Scalar).name(), sum);
+}
+
+TEMPLATE_TEST_CASE("between_factor_multiply", "", double, float) {
+  BenchmarkBetweenFactor<TestType, SymBetweenFactorPose3>("between_factor_multiply");
+}
+
+TEMPLATE_TEST_CASE("between_factor_std_pow", "", double, float) {
+  BenchmarkBetweenFactor<TestType, StdPowBetweenFactorPose3>("between_factor_std_pow");
+}
+
+TEMPLATE_TEST_CASE("pixel_from_camera_point_multiply", "", double, float) {
+  BenchmarkPixelFromCameraPoint<TestType, SymPixelFromCameraPoint>(
+      "pixel_from_camera_point_multiply");
+}
+
+TEMPLATE_TEST_CASE("pixel_from_camera_point_std_pow", "", double, float) {
+  BenchmarkPixelFromCameraPoint<TestType, StdPowPixelFromCameraPoint>(
+      "pixel_from_camera_point_std_pow");
+}
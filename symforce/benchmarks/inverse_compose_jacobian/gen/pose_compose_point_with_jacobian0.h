@@ -43,20 +43,20 @@ __attribute__((noinline)) Eigen::Matrix<Scalar, 3, 1> PoseComposePointWithJacobi
   const Scalar _tmp5 = _pose[3] * _tmp2;
   const Scalar _tmp6 = _pose[0] * _tmp0;
   const Scalar _tmp7 = _tmp5 + _tmp6;
-  const Scalar _tmp8 = std::pow(_pose[1], Scalar(2));
+  const Scalar _tmp8 = (_pose[1] * _pose[1]);
   const Scalar _tmp9 = 2 * _tmp8;
-  const Scalar _tmp10 = std::pow(_pose[2], Scalar(2));
+  const Scalar _tmp10 = (_pose[2] * _pose[2]);
   const Scalar _tmp11 = 2 * _tmp10 - 1;
   const Scalar _tmp12 = _tmp1 + _tmp3;
   const Scalar _tmp13 = 2 * _pose[0] * _pose[3];
   const Scalar _tmp14 = _pose[2] * _tmp2;
   const Scalar _tmp15 = _tmp13 - _tmp14;
-  const Scalar _tmp16 = std::pow(_pose[0], Scalar(2));
+  const Scalar _tmp16 = (_pose[0] * _pose[0]);
   const Scalar _tmp17 = 2 * _tmp16;
   const Scalar _tmp18 = _tmp5 - _tmp6;
   const Scalar _tmp19 = _tmp13 + _tmp14;
   const Scalar _tmp20 = -_tmp10;
-  const Scalar _tmp21 = std::pow(_pose[3], Scalar(2));
+  const Scalar _tmp21 = (_pose[3] * _pose[3]);
   const Scalar _tmp22 = -_tmp16 + _tmp21;
   const Scalar _tmp23 = _tmp20 + _tmp22 + _tmp8;
   const Scalar _tmp24 = -_tmp8;
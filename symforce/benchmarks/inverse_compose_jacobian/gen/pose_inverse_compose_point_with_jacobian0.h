@@ -47,12 +47,12 @@ __attribute__((noinline)) Eigen::Matrix<Scalar, 3, 1> PoseInverseComposePointWit
   const Scalar _tmp9 = _pose[5] * _tmp8;
   const Scalar _tmp10 = _tmp8 * point(1, 0);
   const Scalar _tmp11 = _pose[6] * _tmp4;
-  const Scalar _tmp12 = std::pow(_pose[1], Scalar(2));
+  const Scalar _tmp12 = (_pose[1] * _pose[1]);
   const Scalar _tmp13 = 2 * _tmp12;
-  const Scalar _tmp14 = std::pow(_pose[2], Scalar(2));
+  const Scalar _tmp14 = (_pose[2] * _pose[2]);
   const Scalar _tmp15 = 2 * _tmp14 - 1;
   const Scalar _tmp16 = _tmp13 + _tmp15;
-  const Scalar _tmp17 = std::pow(_pose[0], Scalar(2));
+  const Scalar _tmp17 = (_pose[0] * _pose[0]);
   const Scalar _tmp18 = 2 * _tmp17;
   const Scalar _tmp19 = _tmp15 + _tmp18;
   const Scalar _tmp20 = _tmp6 - _tmp7;
@@ -67,7 +67,7 @@ __attribute__((noinline)) Eigen::Matrix<Scalar, 3, 1> PoseInverseComposePointWit
   const Scalar _tmp28 =
       -_pose[4] * _tmp26 + _pose[5] * _tmp27 + _tmp26 * point(0, 0) - _tmp27 * point(1, 0);
   const Scalar _tmp29 = -_tmp12;
-  const Scalar _tmp30 = std::pow(_pose[3], Scalar(2));
+  const Scalar _tmp30 = (_pose[3] * _pose[3]);
   const Scalar _tmp31 = -_tmp17 + _tmp30;
   const Scalar _tmp32 = _tmp14 + _tmp29 + _tmp31;
   const Scalar _tmp33 = -_pose[6] * _tmp32 + _tmp28 + _tmp32 * point(2, 0);
@@ -42,9 +42,9 @@ __attribute__((noinline)) sym::Pose3<Scalar> PoseInverseWithJacobian(
   const Scalar _tmp6 = _pose[0] * _tmp0;
   const Scalar _tmp7 = _tmp5 + _tmp6;
   const Scalar _tmp8 = _pose[5] * _tmp7;
-  const Scalar _tmp9 = std::pow(_pose[1], Scalar(2));
+  const Scalar _tmp9 = (_pose[1] * _pose[1]);
   const Scalar _tmp10 = 2 * _tmp9;
-  const Scalar _tmp11 = std::pow(_pose[2], Scalar(2));
+  const Scalar _tmp11 = (_pose[2] * _pose[2]);
   const Scalar _tmp12 = 2 * _tmp11 - 1;
   const Scalar _tmp13 = _tmp10 + _tmp12;
   const Scalar _tmp14 = _tmp5 - _tmp6;
@@ -53,7 +53,7 @@ __attribute__((noinline)) sym::Pose3<Scalar> PoseInverseWithJacobian(
   const Scalar _tmp17 = _pose[1] * _tmp2;
   const Scalar _tmp18 = _tmp16 + _tmp17;
   const Scalar _tmp19 = _pose[6] * _tmp18;
-  const Scalar _tmp20 = std::pow(_pose[0], Scalar(2));
+  const Scalar _tmp20 = (_pose[0] * _pose[0]);
   const Scalar _tmp21 = 2 * _tmp20;
   const Scalar _tmp22 = _tmp12 + _tmp21;
   const Scalar _tmp23 = _tmp16 - _tmp17;
@@ -61,7 +61,7 @@ __attribute__((noinline)) sym::Pose3<Scalar> PoseInverseWithJacobian(
   const Scalar _tmp25 = _pose[4] * _tmp24;
   const Scalar _tmp26 = _tmp10 + _tmp21 - 1;
   const Scalar _tmp27 = -_tmp11;
-  const Scalar _tmp28 = std::pow(_pose[3], Scalar(2));
+  const Scalar _tmp28 = (_pose[3] * _pose[3]);
   const Scalar _tmp29 = _tmp28 - _tmp9;
   const Scalar _tmp30 = _tmp20 + _tmp27 + _tmp29;
   const Scalar _tmp31 = -_tmp7;
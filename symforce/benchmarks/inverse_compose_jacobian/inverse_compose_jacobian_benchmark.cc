@@ -13,6 +13,7 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
@@ -22,6 +23,7 @@
 #include <sophus/se3.hpp>
 #include <spdlog/spdlog.h>
 
+#include <sym/ops/pose3/batch_ops.h>
 #include <sym/pose3.h>
 #include <symforce/opt/tic_toc.h>
 #include <symforce/opt/util.h>
@@ -248,3 +250,77 @@ TEMPLATE_TEST_CASE("sophus_chained", "", double, float) {
 
   spdlog::info("sophus_chained_{} sum: {}", typeid(Scalar).name(), sum);
 }
+
+/**
+ * Every pair of a pose and a point in TestData, as arrays of objects and in structure-of-arrays
+ * layout, for the cases below which compute only the result, without the jacobian.
+ */
+template <typename Scalar>
+struct PairsTestData {
+  PairsTestData() {
+    const TestData<Scalar> data;
+    count = data.poses.size() * data.points.size();
+    for (const auto& pose : data.poses) {
+      for (const auto& point : data.points) {
+        poses.push_back(pose);
+        points.push_back(point);
+      }
+    }
+
+    poses_soa.resize(7 * count);
+    points_soa.resize(3 * count);
+    sym::ToStructureOfArrays(poses.data(), count, count, poses_soa.data());
+    sym::ToStructureOfArrays(points.data(), count, count, points_soa.data());
+  }
+
+  size_t count;
+  std::vector<sym::Pose3<Scalar>> poses;
+  std::vector<sym::Vector3<Scalar>> points;
+  std::vector<Scalar> poses_soa;
+  std::vector<Scalar> points_soa;
+};
+
+TEMPLATE_TEST_CASE("sym_per_object_values", "", double, float) {
+  using Scalar = TestType;
+
+  const PairsTestData<Scalar> data;
+  std::vector<sym::Vector3<Scalar>> results(data.count);
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  Scalar sum = 0.0;
+  {
+    SYM_TIME_SCOPE("sym_per_object_values_{}", typeid(Scalar).name());
+    for (size_t k = 0; k < data.count; ++k) {
+      results[k] = data.poses[k].InverseCompose(data.points[k]);
+    }
+    for (size_t k = 0; k < data.count; ++k) {
+      sum += results[k](2);
+    }
+  }
+  spdlog::info("sym_per_object_values_{} sum: {}", typeid(Scalar).name(), sum);
+}
+
+TEMPLATE_TEST_CASE("sym_batch_values", "", double, float) {
+  using Scalar = TestType;
+
+  const PairsTestData<Scalar> data;
+  std::vector<Scalar> results_soa(3 * data.count);
+
+  // Wait so perf can ignore initialization
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  Scalar sum = 0.0;
+  {
+    SYM_TIME_SCOPE("sym_batch_values_{}", typeid(Scalar).name());
+    sym::BatchOps<sym::Pose3<Scalar>>::InverseTransformPoints(
+        data.count, data.count, data.poses_soa.data(), data.points_soa.data(), results_soa.data());
+    for (size_t k = 0; k < data.count; ++k) {
+      sum += results_soa[2 * data.count + k];
+    }
+  }
+  spdlog::info("sym_batch_values_{} sum: {}", typeid(Scalar).name(), sum);
+}
@@ -73,7 +73,7 @@ Eigen::SparseMatrix<Scalar> ComputeATinaDiscog(const Scalar x0, const Scalar x1,
 
 
     result_value_ptr[0] = x2*x4;
-    result_value_ptr[1] = -std::pow(x0, Scalar(2)) + 2 + Scalar(1.0) / (x0);
+    result_value_ptr[1] = -(x0 * x0) + 2 + Scalar(1.0) / (x0);
     result_value_ptr[2] = 2 - x4;
     result_value_ptr[3] = -_tmp0/x3;
     result_value_ptr[4] = 4 - x1;
@@ -86,7 +86,7 @@ Eigen::SparseMatrix<Scalar> ComputeATinaDiscog(const Scalar x0, const Scalar x1,
     result_value_ptr[11] = -_tmp3;
     result_value_ptr[12] = _tmp8 + x0 + Scalar(1.0);
     result_value_ptr[13] = _tmp9*x3;
-    result_value_ptr[14] = -_tmp10*std::pow(x1, Scalar(2));
+    result_value_ptr[14] = -_tmp10*(x1 * x1);
     result_value_ptr[15] = -x1*x2 - x3;
     result_value_ptr[16] = -x2*(x1 + x4);
     result_value_ptr[17] = x0*(_tmp1 + x0);
@@ -103,7 +103,7 @@ Eigen::SparseMatrix<Scalar> ComputeATinaDiscog(const Scalar x0, const Scalar x1,
     result_value_ptr[28] = _tmp4;
     result_value_ptr[29] = 1;
     result_value_ptr[30] = _tmp16*_tmp9;
-    result_value_ptr[31] = -_tmp1 - _tmp11*std::pow(x2, Scalar(2))*x4;
+    result_value_ptr[31] = -_tmp1 - _tmp11*(x2 * x2)*x4;
     result_value_ptr[32] = -_tmp15 - _tmp8;
     result_value_ptr[33] = -x3 - x4 - 2;
     result_value_ptr[34] = -_tmp14*(_tmp8 + x1) + 1;
@@ -68,7 +68,7 @@ Eigen::SparseMatrix<Scalar> ComputeAB1Ss(const Scalar x0, const Scalar x1, const
     result_value_ptr[7] = 2/(x4 + 2);
     result_value_ptr[8] = -x0*x1*x4*(x2 + 2);
     result_value_ptr[9] = -_tmp1*x1*(x0 + 2) - _tmp2;
-    result_value_ptr[10] = -2*std::pow(x3, Scalar(2))*x4;
+    result_value_ptr[10] = -2*(x3 * x3)*x4;
     result_value_ptr[11] = x0 - x1*(x3 - 3);
     result_value_ptr[12] = Scalar(1.0) / (_tmp2 + x2);
     result_value_ptr[13] = x2*(x2 + 4)*(x4 + 1);
@@ -54,7 +54,7 @@ Eigen::Matrix<Scalar, 7, 7> ComputeADenseB1Ss(const Scalar x0, const Scalar x1,
     _result(0, 3) = 2/(x4 + 2);
     _result(3, 3) = -x0*x1*x4*(x2 + 2);
     _result(1, 4) = -_tmp1*x1*(x0 + 2) - _tmp2;
-    _result(4, 4) = -2*std::pow(x3, Scalar(2))*x4;
+    _result(4, 4) = -2*(x3 * x3)*x4;
     _result(2, 5) = x0 - x1*(x3 - 3);
     _result(5, 5) = Scalar(1.0) / (_tmp2 + x2);
     _result(3, 6) = x2*(x2 + 4)*(x4 + 1);
@@ -62,7 +62,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeADenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp24 = 2*x0;
     const Scalar _tmp25 = x0 + x1;
     const Scalar _tmp26 = x2 - 2;
-    const Scalar _tmp27 = std::pow(x1, Scalar(2));
+    const Scalar _tmp27 = (x1 * x1);
     const Scalar _tmp28 = 2*_tmp27;
     const Scalar _tmp29 = Scalar(1.0) / (x1);
     const Scalar _tmp30 = -x4;
@@ -86,7 +86,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeADenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp48 = _tmp12 + 2;
     const Scalar _tmp49 = x1 + 2;
     const Scalar _tmp50 = x0 + x4;
-    const Scalar _tmp51 = std::pow(x4, Scalar(2));
+    const Scalar _tmp51 = (x4 * x4);
     const Scalar _tmp52 = _tmp30 + x2;
     const Scalar _tmp53 = _tmp52*x2;
     const Scalar _tmp54 = x1 + 1;
@@ -96,7 +96,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeADenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp58 = _tmp57*x2;
     const Scalar _tmp59 = _tmp21 + x1;
     const Scalar _tmp60 = x3 + 2;
-    const Scalar _tmp61 = std::pow(x0, Scalar(2));
+    const Scalar _tmp61 = (x0 * x0);
     const Scalar _tmp62 = x1 - 2;
     const Scalar _tmp63 = x1*x2;
     const Scalar _tmp64 = x3 - 2;
@@ -116,7 +116,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeADenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp78 = _tmp48 + _tmp77;
     const Scalar _tmp79 = x0 - 2;
     const Scalar _tmp80 = -_tmp69;
-    const Scalar _tmp81 = std::pow(x2, Scalar(2));
+    const Scalar _tmp81 = (x2 * x2);
     const Scalar _tmp82 = x0 - 1;
     const Scalar _tmp83 = _tmp24 + 2;
     const Scalar _tmp84 = x1 - 1;
@@ -244,7 +244,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeADenseBibd93(const Scalar x0, const Scalar
     _result(12, 36) = x3 - x4/_tmp49;
     _result(23, 36) = _tmp30 + _tmp5;
     _result(9, 37) = _tmp17*_tmp24*_tmp47;
-    _result(13, 37) = x2/(x0 - 2*std::pow(x3, Scalar(2)));
+    _result(13, 37) = x2/(x0 - 2*(x3 * x3));
     _result(24, 37) = _tmp66 + 2;
     _result(9, 38) = _tmp35 + x2;
     _result(14, 38) = -_tmp5*x4 - x0;
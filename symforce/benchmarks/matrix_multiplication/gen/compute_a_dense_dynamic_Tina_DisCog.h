@@ -59,7 +59,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicTinaDi
     _result.setZero();
 
     _result(2, 0) = x2*x4;
-    _result(9, 0) = -std::pow(x0, Scalar(2)) + 2 + Scalar(1.0) / (x0);
+    _result(9, 0) = -(x0 * x0) + 2 + Scalar(1.0) / (x0);
     _result(0, 1) = 2 - x4;
     _result(2, 1) = -_tmp0/x3;
     _result(4, 1) = 4 - x1;
@@ -72,7 +72,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicTinaDi
     _result(9, 2) = -_tmp3;
     _result(2, 3) = _tmp8 + x0 + Scalar(1.0);
     _result(4, 3) = _tmp9*x3;
-    _result(5, 3) = -_tmp10*std::pow(x1, Scalar(2));
+    _result(5, 3) = -_tmp10*(x1 * x1);
     _result(6, 3) = -x1*x2 - x3;
     _result(7, 3) = -x2*(x1 + x4);
     _result(10, 3) = x0*(_tmp1 + x0);
@@ -89,7 +89,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicTinaDi
     _result(5, 6) = _tmp4;
     _result(7, 6) = 1;
     _result(8, 6) = _tmp16*_tmp9;
-    _result(1, 7) = -_tmp1 - _tmp11*std::pow(x2, Scalar(2))*x4;
+    _result(1, 7) = -_tmp1 - _tmp11*(x2 * x2)*x4;
     _result(2, 7) = -_tmp15 - _tmp8;
     _result(3, 7) = -x3 - x4 - 2;
     _result(5, 7) = -_tmp14*(_tmp8 + x1) + 1;
@@ -42,7 +42,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     const Scalar _tmp4 = x2 + 2;
     const Scalar _tmp5 = _tmp4 + x3;
     const Scalar _tmp6 = x2 + x4;
-    const Scalar _tmp7 = std::pow(x2, Scalar(2));
+    const Scalar _tmp7 = (x2 * x2);
     const Scalar _tmp8 = x2 - 4;
     const Scalar _tmp9 = x1*x2;
     const Scalar _tmp10 = _tmp1 + x1;
@@ -58,7 +58,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     const Scalar _tmp20 = x3 + x4;
     const Scalar _tmp21 = 2*x0;
     const Scalar _tmp22 = x4 + 4;
-    const Scalar _tmp23 = std::pow(x4, Scalar(2));
+    const Scalar _tmp23 = (x4 * x4);
     const Scalar _tmp24 = -x3;
     const Scalar _tmp25 = _tmp15 + 1;
     const Scalar _tmp26 = -x1;
@@ -66,13 +66,13 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     const Scalar _tmp28 = x1 - 1;
     const Scalar _tmp29 = x3 - 2;
     const Scalar _tmp30 = x3 + 1;
-    const Scalar _tmp31 = std::pow(x0, Scalar(2));
+    const Scalar _tmp31 = (x0 * x0);
     const Scalar _tmp32 = 2*_tmp31;
     const Scalar _tmp33 = x1 + x2;
     const Scalar _tmp34 = x0*x1;
     const Scalar _tmp35 = Scalar(1.0) / (x3);
     const Scalar _tmp36 = (Scalar(1)/Scalar(2))*_tmp35;
-    const Scalar _tmp37 = std::pow(x3, Scalar(2));
+    const Scalar _tmp37 = (x3 * x3);
     const Scalar _tmp38 = 2*_tmp37;
     const Scalar _tmp39 = -_tmp38;
     const Scalar _tmp40 = x3 + 2;
@@ -328,7 +328,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     _result(45, 103) = -_tmp96*(_tmp24 + _tmp86);
     _result(43, 104) = -_tmp42 - 6;
     _result(44, 104) = -_tmp52*_tmp69;
-    _result(48, 104) = -Scalar(1.0)*[&]() { const Scalar base = x1; return base * base * base; }();
+    _result(48, 104) = -Scalar(1.0)*(x1 * x1 * x1);
     _result(43, 105) = -_tmp75;
     _result(44, 105) = -_tmp40*x4 + x0;
     _result(49, 105) = -2/(_tmp22 + x0);
@@ -424,7 +424,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     _result(76, 139) = _tmp0 + _tmp92;
     _result(77, 139) = 2;
     _result(83, 139) = -_tmp7*x3;
-    _result(79, 140) = [&]() { const Scalar base = x2; return base * base * base; }() - 1;
+    _result(79, 140) = (x2 * x2 * x2) - 1;
     _result(80, 140) = -x1*(_tmp21 + 4);
     _result(90, 140) = -_tmp93;
     _result(80, 141) = _tmp21 + 2*_tmp7;
@@ -455,7 +455,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicLpSc10
     _result(90, 151) = -Scalar(1)/Scalar(2)*_tmp58*x4;
     _result(91, 151) = -x3/(_tmp95 + x0);
     _result(101, 151) = -_tmp29 - x1;
-    _result(91, 152) = -std::pow(x1, Scalar(2))*x2;
+    _result(91, 152) = -(x1 * x1)*x2;
     _result(100, 152) = -x3 - 3;
     _result(92, 153) = -1;
     _result(95, 153) = _tmp2*x0;
@@ -41,7 +41,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicN3C4B2
     const Scalar _tmp3 = _tmp2 + x4;
     const Scalar _tmp4 = 4*x4;
     const Scalar _tmp5 = -x4;
-    const Scalar _tmp6 = std::pow(x2, Scalar(2));
+    const Scalar _tmp6 = (x2 * x2);
     const Scalar _tmp7 = 2*_tmp6;
     const Scalar _tmp8 = 2*x0;
     const Scalar _tmp9 = x3*x4;
@@ -70,7 +70,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicN3C4B2
     _result(19, 0) = x3*(x3 - 1) - 1;
     _result(8, 1) = 2;
     _result(14, 1) = -_tmp3 - 2;
-    _result(17, 1) = x0*std::pow(x3, Scalar(2))*(x0 - 2);
+    _result(17, 1) = x0*(x3 * x3)*(x0 - 2);
     _result(19, 1) = -2/x1;
     _result(7, 2) = _tmp4;
     _result(13, 2) = -_tmp5 - x1/x2;
@@ -46,7 +46,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     const Scalar _tmp8 = 2*x0;
     const Scalar _tmp9 = 2*x3;
     const Scalar _tmp10 = _tmp9 - 2;
-    const Scalar _tmp11 = std::pow(x2, Scalar(2));
+    const Scalar _tmp11 = (x2 * x2);
     const Scalar _tmp12 = -x4;
     const Scalar _tmp13 = x4 + 1;
     const Scalar _tmp14 = -x1;
@@ -59,7 +59,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     const Scalar _tmp21 = x3 - 3;
     const Scalar _tmp22 = 4*x2;
     const Scalar _tmp23 = _tmp6*x1;
-    const Scalar _tmp24 = std::pow(x1, Scalar(2));
+    const Scalar _tmp24 = (x1 * x1);
     const Scalar _tmp25 = x0 + 2;
     const Scalar _tmp26 = _tmp5*x4;
     const Scalar _tmp27 = -_tmp26;
@@ -74,7 +74,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     const Scalar _tmp36 = -x2;
     const Scalar _tmp37 = Scalar(1.0) / (x0);
     const Scalar _tmp38 = 4*x1;
-    const Scalar _tmp39 = std::pow(x3, Scalar(2));
+    const Scalar _tmp39 = (x3 * x3);
     const Scalar _tmp40 = x1 + x2;
     const Scalar _tmp41 = -_tmp19;
     const Scalar _tmp42 = _tmp40 + 4;
@@ -87,7 +87,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     const Scalar _tmp49 = x1 + 4;
     const Scalar _tmp50 = x0 - 1;
     const Scalar _tmp51 = x3 - 1;
-    const Scalar _tmp52 = std::pow(x4, Scalar(2));
+    const Scalar _tmp52 = (x4 * x4);
     const Scalar _tmp53 = -_tmp30;
     const Scalar _tmp54 = x0*x1;
     const Scalar _tmp55 = (Scalar(1)/Scalar(2))*x4 + Scalar(1)/Scalar(2);
@@ -113,7 +113,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     const Scalar _tmp75 = (Scalar(1)/Scalar(4))*x2;
     const Scalar _tmp76 = x1*x4;
     const Scalar _tmp77 = x2 + 2;
-    const Scalar _tmp78 = std::pow(x0, Scalar(2));
+    const Scalar _tmp78 = (x0 * x0);
     const Scalar _tmp79 = x0 + x3;
     const Scalar _tmp80 = Scalar(1.0) / (x1);
     const Scalar _tmp81 = x1 + x4;
@@ -483,7 +483,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     _result(21, 21) = _tmp86 + x4;
     _result(16, 22) = _tmp59;
     _result(22, 22) = _tmp6*x2;
-    _result(17, 23) = -[&]() { const Scalar base = x4; return base * base * base; }();
+    _result(17, 23) = -(x4 * x4 * x4);
     _result(23, 23) = -_tmp67 - x0;
     _result(24, 24) = -_tmp5*_tmp8;
     _result(29, 24) = _tmp124;
@@ -549,7 +549,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     _result(33, 31) = _tmp29;
     _result(35, 31) = -_tmp160*x1;
     _result(26, 32) = -x1/_tmp172;
-    _result(32, 32) = -std::pow(_tmp13, Scalar(2))*x2;
+    _result(32, 32) = -(_tmp13 * _tmp13)*x2;
     _result(33, 32) = 2 - _tmp97;
     _result(34, 32) = _tmp70;
     _result(27, 33) = -_tmp152*x1;
@@ -716,7 +716,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeADenseDynamicRotor1
     _result(1, 61) = _tmp39 + _tmp43;
     _result(2, 62) = -_tmp18*_tmp43;
     _result(3, 63) = _tmp60;
-    _result(4, 64) = std::pow(_tmp28, Scalar(2));
+    _result(4, 64) = (_tmp28 * _tmp28);
     _result(5, 65) = -_tmp108*_tmp135;
     _result(0, 66) = _tmp13 + _tmp74;
     _result(6, 66) = _tmp44;
@@ -43,7 +43,7 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp4 = x2 + 2;
     const Scalar _tmp5 = _tmp4 + x3;
     const Scalar _tmp6 = x2 + x4;
-    const Scalar _tmp7 = std::pow(x2, Scalar(2));
+    const Scalar _tmp7 = (x2 * x2);
     const Scalar _tmp8 = x2 - 4;
     const Scalar _tmp9 = x1*x2;
     const Scalar _tmp10 = _tmp1 + x1;
@@ -59,7 +59,7 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp20 = x3 + x4;
     const Scalar _tmp21 = 2*x0;
     const Scalar _tmp22 = x4 + 4;
-    const Scalar _tmp23 = std::pow(x4, Scalar(2));
+    const Scalar _tmp23 = (x4 * x4);
     const Scalar _tmp24 = -x3;
     const Scalar _tmp25 = _tmp15 + 1;
     const Scalar _tmp26 = -x1;
@@ -67,13 +67,13 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp28 = x1 - 1;
     const Scalar _tmp29 = x3 - 2;
     const Scalar _tmp30 = x3 + 1;
-    const Scalar _tmp31 = std::pow(x0, Scalar(2));
+    const Scalar _tmp31 = (x0 * x0);
     const Scalar _tmp32 = 2*_tmp31;
     const Scalar _tmp33 = x1 + x2;
     const Scalar _tmp34 = x0*x1;
     const Scalar _tmp35 = Scalar(1.0) / (x3);
     const Scalar _tmp36 = (Scalar(1)/Scalar(2))*_tmp35;
-    const Scalar _tmp37 = std::pow(x3, Scalar(2));
+    const Scalar _tmp37 = (x3 * x3);
     const Scalar _tmp38 = 2*_tmp37;
     const Scalar _tmp39 = -_tmp38;
     const Scalar _tmp40 = x3 + 2;
@@ -342,7 +342,7 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     result_value_ptr[174] = -_tmp96*(_tmp24 + _tmp86);
     result_value_ptr[175] = -_tmp42 - 6;
     result_value_ptr[176] = -_tmp52*_tmp69;
-    result_value_ptr[177] = -Scalar(1.0)*[&]() { const Scalar base = x1; return base * base * base; }();
+    result_value_ptr[177] = -Scalar(1.0)*(x1 * x1 * x1);
     result_value_ptr[178] = -_tmp75;
     result_value_ptr[179] = -_tmp40*x4 + x0;
     result_value_ptr[180] = -2/(_tmp22 + x0);
@@ -438,7 +438,7 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     result_value_ptr[270] = _tmp0 + _tmp92;
     result_value_ptr[271] = 2;
     result_value_ptr[272] = -_tmp7*x3;
-    result_value_ptr[273] = [&]() { const Scalar base = x2; return base * base * base; }() - 1;
+    result_value_ptr[273] = (x2 * x2 * x2) - 1;
     result_value_ptr[274] = -x1*(_tmp21 + 4);
     result_value_ptr[275] = -_tmp93;
     result_value_ptr[276] = _tmp21 + 2*_tmp7;
@@ -469,7 +469,7 @@ Eigen::SparseMatrix<Scalar> ComputeALpSc105(const Scalar x0, const Scalar x1, co
     result_value_ptr[301] = -Scalar(1)/Scalar(2)*_tmp58*x4;
     result_value_ptr[302] = -x3/(_tmp95 + x0);
     result_value_ptr[303] = -_tmp29 - x1;
-    result_value_ptr[304] = -std::pow(x1, Scalar(2))*x2;
+    result_value_ptr[304] = -(x1 * x1)*x2;
     result_value_ptr[305] = -x3 - 3;
     result_value_ptr[306] = -1;
     result_value_ptr[307] = _tmp2*x0;
@@ -42,7 +42,7 @@ Eigen::SparseMatrix<Scalar> ComputeAN3C4B2(const Scalar x0, const Scalar x1, con
     const Scalar _tmp3 = _tmp2 + x4;
     const Scalar _tmp4 = 4*x4;
     const Scalar _tmp5 = -x4;
-    const Scalar _tmp6 = std::pow(x2, Scalar(2));
+    const Scalar _tmp6 = (x2 * x2);
     const Scalar _tmp7 = 2*_tmp6;
     const Scalar _tmp8 = 2*x0;
     const Scalar _tmp9 = x3*x4;
@@ -84,7 +84,7 @@ Eigen::SparseMatrix<Scalar> ComputeAN3C4B2(const Scalar x0, const Scalar x1, con
     result_value_ptr[3] = x3*(x3 - 1) - 1;
     result_value_ptr[4] = 2;
     result_value_ptr[5] = -_tmp3 - 2;
-    result_value_ptr[6] = x0*std::pow(x3, Scalar(2))*(x0 - 2);
+    result_value_ptr[6] = x0*(x3 * x3)*(x0 - 2);
     result_value_ptr[7] = -2/x1;
     result_value_ptr[8] = _tmp4;
     result_value_ptr[9] = -_tmp5 - x1/x2;
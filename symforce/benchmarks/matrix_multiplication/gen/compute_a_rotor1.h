@@ -47,7 +47,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp8 = 2*x0;
     const Scalar _tmp9 = 2*x3;
     const Scalar _tmp10 = _tmp9 - 2;
-    const Scalar _tmp11 = std::pow(x2, Scalar(2));
+    const Scalar _tmp11 = (x2 * x2);
     const Scalar _tmp12 = -x4;
     const Scalar _tmp13 = x4 + 1;
     const Scalar _tmp14 = -x1;
@@ -60,7 +60,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp21 = x3 - 3;
     const Scalar _tmp22 = 4*x2;
     const Scalar _tmp23 = _tmp6*x1;
-    const Scalar _tmp24 = std::pow(x1, Scalar(2));
+    const Scalar _tmp24 = (x1 * x1);
     const Scalar _tmp25 = x0 + 2;
     const Scalar _tmp26 = _tmp5*x4;
     const Scalar _tmp27 = -_tmp26;
@@ -75,7 +75,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp36 = -x2;
     const Scalar _tmp37 = Scalar(1.0) / (x0);
     const Scalar _tmp38 = 4*x1;
-    const Scalar _tmp39 = std::pow(x3, Scalar(2));
+    const Scalar _tmp39 = (x3 * x3);
     const Scalar _tmp40 = x1 + x2;
     const Scalar _tmp41 = -_tmp19;
     const Scalar _tmp42 = _tmp40 + 4;
@@ -88,7 +88,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp49 = x1 + 4;
     const Scalar _tmp50 = x0 - 1;
     const Scalar _tmp51 = x3 - 1;
-    const Scalar _tmp52 = std::pow(x4, Scalar(2));
+    const Scalar _tmp52 = (x4 * x4);
     const Scalar _tmp53 = -_tmp30;
     const Scalar _tmp54 = x0*x1;
     const Scalar _tmp55 = (Scalar(1)/Scalar(2))*x4 + Scalar(1)/Scalar(2);
@@ -114,7 +114,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp75 = (Scalar(1)/Scalar(4))*x2;
     const Scalar _tmp76 = x1*x4;
     const Scalar _tmp77 = x2 + 2;
-    const Scalar _tmp78 = std::pow(x0, Scalar(2));
+    const Scalar _tmp78 = (x0 * x0);
     const Scalar _tmp79 = x0 + x3;
     const Scalar _tmp80 = Scalar(1.0) / (x1);
     const Scalar _tmp81 = x1 + x4;
@@ -497,7 +497,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     result_value_ptr[237] = _tmp86 + x4;
     result_value_ptr[238] = _tmp59;
     result_value_ptr[239] = _tmp6*x2;
-    result_value_ptr[240] = -[&]() { const Scalar base = x4; return base * base * base; }();
+    result_value_ptr[240] = -(x4 * x4 * x4);
     result_value_ptr[241] = -_tmp67 - x0;
     result_value_ptr[242] = -_tmp5*_tmp8;
     result_value_ptr[243] = _tmp124;
@@ -563,7 +563,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     result_value_ptr[303] = _tmp29;
     result_value_ptr[304] = -_tmp160*x1;
     result_value_ptr[305] = -x1/_tmp172;
-    result_value_ptr[306] = -std::pow(_tmp13, Scalar(2))*x2;
+    result_value_ptr[306] = -(_tmp13 * _tmp13)*x2;
     result_value_ptr[307] = 2 - _tmp97;
     result_value_ptr[308] = _tmp70;
     result_value_ptr[309] = -_tmp152*x1;
@@ -730,7 +730,7 @@ Eigen::SparseMatrix<Scalar> ComputeARotor1(const Scalar x0, const Scalar x1, con
     result_value_ptr[470] = _tmp39 + _tmp43;
     result_value_ptr[471] = -_tmp18*_tmp43;
     result_value_ptr[472] = _tmp60;
-    result_value_ptr[473] = std::pow(_tmp28, Scalar(2));
+    result_value_ptr[473] = (_tmp28 * _tmp28);
     result_value_ptr[474] = -_tmp108*_tmp135;
     result_value_ptr[475] = _tmp13 + _tmp74;
     result_value_ptr[476] = _tmp44;
@@ -42,7 +42,7 @@ Eigen::Matrix<Scalar, 11, 11> ComputeAtBTinaDiscog(const Scalar x0, const Scalar
     const Scalar _tmp3 = x2*x4;
     const Scalar _tmp4 = 2*x2;
     const Scalar _tmp5 = _tmp4 + 6;
-    const Scalar _tmp6 = std::pow(x0, Scalar(2));
+    const Scalar _tmp6 = (x0 * x0);
     const Scalar _tmp7 = -_tmp6 + 2 + Scalar(1.0) / (x0);
     const Scalar _tmp8 = -x4;
     const Scalar _tmp9 = _tmp8 + x2;
@@ -70,7 +70,7 @@ Eigen::Matrix<Scalar, 11, 11> ComputeAtBTinaDiscog(const Scalar x0, const Scalar
     const Scalar _tmp31 = x1 + 3;
     const Scalar _tmp32 = _tmp17 + _tmp31;
     const Scalar _tmp33 = Scalar(2.0)*x0;
-    const Scalar _tmp34 = std::pow(x4, Scalar(2));
+    const Scalar _tmp34 = (x4 * x4);
     const Scalar _tmp35 = _tmp34*x0;
     const Scalar _tmp36 = _tmp15 + x0;
     const Scalar _tmp37 = _tmp36 + 6;
@@ -90,7 +90,7 @@ Eigen::Matrix<Scalar, 11, 11> ComputeAtBTinaDiscog(const Scalar x0, const Scalar
     const Scalar _tmp51 = _tmp50*x3;
     const Scalar _tmp52 = _tmp42*x3;
     const Scalar _tmp53 = x1 + x4;
-    const Scalar _tmp54 = std::pow(x2, Scalar(2));
+    const Scalar _tmp54 = (x2 * x2);
     const Scalar _tmp55 = _tmp53*_tmp54;
     const Scalar _tmp56 = x3 - 2;
     const Scalar _tmp57 = x1 + 4;
@@ -114,7 +114,7 @@ Eigen::Matrix<Scalar, 11, 11> ComputeAtBTinaDiscog(const Scalar x0, const Scalar
     const Scalar _tmp75 = x0 - 3;
     const Scalar _tmp76 = _tmp18 + _tmp70;
     const Scalar _tmp77 = _tmp38 + 3*x0;
-    const Scalar _tmp78 = std::pow(x1, Scalar(2));
+    const Scalar _tmp78 = (x1 * x1);
     const Scalar _tmp79 = 4*_tmp78;
     const Scalar _tmp80 = x3 + 1;
     const Scalar _tmp81 = _tmp36*x0;
@@ -244,7 +244,7 @@ Eigen::Matrix<Scalar, 11, 11> ComputeAtBTinaDiscog(const Scalar x0, const Scalar
     _result(1, 6) = -_tmp10*_tmp111 + _tmp112 - _tmp113*_tmp75 - _tmp114*_tmp115 - _tmp116*_tmp46 - 24;
     _result(2, 6) = _tmp116*_tmp49;
     _result(3, 6) = _tmp111*_tmp19 + _tmp113*_tmp86 - _tmp114*_tmp117 - 6*_tmp51;
-    _result(4, 6) = -_tmp111*_tmp20 - _tmp4*_tmp68*std::pow(x3, Scalar(2));
+    _result(4, 6) = -_tmp111*_tmp20 - _tmp4*_tmp68*(x3 * x3);
     _result(5, 6) = -_tmp111*_tmp30 - _tmp112 - 24;
     _result(6, 6) = _tmp1*_tmp116*_tmp50 - _tmp11*_tmp113 - _tmp111*_tmp61 - _tmp17 - _tmp21 - 12*_tmp59*x4 - 2;
     _result(7, 6) = -_tmp111*_tmp32 - _tmp113*_tmp99 + _tmp116*_tmp63 + _tmp119*(_tmp110 + _tmp17);
@@ -36,7 +36,7 @@ Eigen::Matrix<Scalar, 7, 7> ComputeAtBB1Ss(const Scalar x0, const Scalar x1, con
     // Input arrays
 
     // Intermediate terms (31)
-    const Scalar _tmp0 = std::pow(x2, Scalar(2));
+    const Scalar _tmp0 = (x2 * x2);
     const Scalar _tmp1 = x2 - 2;
     const Scalar _tmp2 = x2 + 3;
     const Scalar _tmp3 = _tmp2 + x4;
@@ -74,7 +74,7 @@ Eigen::Matrix<Scalar, 7, 7> ComputeAtBB1Ss(const Scalar x0, const Scalar x1, con
     _result.setZero();
 
     _result(0, 0) = -_tmp0*_tmp1*x0 + 2*_tmp3*_tmp4 + _tmp5*_tmp6;
-    _result(4, 0) = -_tmp7*_tmp8*std::pow(x3, Scalar(2));
+    _result(4, 0) = -_tmp7*_tmp8*(x3 * x3);
     _result(5, 0) = _tmp10*_tmp5;
     _result(6, 0) = _tmp11*_tmp4/x1;
     _result(1, 1) = _tmp1*_tmp15 - _tmp12*_tmp13;
@@ -94,9 +94,9 @@ Eigen::Matrix<Scalar, 7, 7> ComputeAtBB1Ss(const Scalar x0, const Scalar x1, con
     _result(0, 5) = -_tmp29*_tmp6;
     _result(2, 5) = -_tmp30;
     _result(5, 5) = -_tmp10*_tmp29 + _tmp23*_tmp30;
-    _result(0, 6) = _tmp3*[&]() { const Scalar base = x1; return base * base * base; }();
-    _result(3, 6) = -_tmp26*_tmp8*[&]() { const Scalar base = x0; return base * base * base; }();
-    _result(6, 6) = _tmp0*_tmp27*std::pow(x0, Scalar(2)) + x0*std::pow(x1, Scalar(2))*x3;
+    _result(0, 6) = _tmp3*(x1 * x1 * x1);
+    _result(3, 6) = -_tmp26*_tmp8*(x0 * x0 * x0);
+    _result(6, 6) = _tmp0*_tmp27*(x0 * x0) + x0*(x1 * x1)*x3;
 
     return _result;
 }  // NOLINT(readability/fn_size)
@@ -95,7 +95,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp55 = x3 - 3;
     const Scalar _tmp56 = _tmp47*_tmp55 - 1;
     const Scalar _tmp57 = _tmp56*x3;
-    const Scalar _tmp58 = std::pow(x1, Scalar(2));
+    const Scalar _tmp58 = (x1 * x1);
     const Scalar _tmp59 = 2*_tmp58;
     const Scalar _tmp60 = _tmp59 + 4;
     const Scalar _tmp61 = _tmp60*x3;
@@ -167,7 +167,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp127 = x2 + 1;
     const Scalar _tmp128 = Scalar(1.0)*x0;
     const Scalar _tmp129 = _tmp127*_tmp128 + 2;
-    const Scalar _tmp130 = std::pow(x3, Scalar(2));
+    const Scalar _tmp130 = (x3 * x3);
     const Scalar _tmp131 = _tmp70 - 2;
     const Scalar _tmp132 = _tmp21 + x2;
     const Scalar _tmp133 = _tmp122*_tmp58;
@@ -187,12 +187,12 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp147 = Scalar(1.0)*x3;
     const Scalar _tmp148 = x4 - 1;
     const Scalar _tmp149 = _tmp36 + _tmp49*x3;
-    const Scalar _tmp150 = std::pow(x4, Scalar(2));
+    const Scalar _tmp150 = (x4 * x4);
     const Scalar _tmp151 = -_tmp115 + _tmp18;
     const Scalar _tmp152 = _tmp1 + x0;
     const Scalar _tmp153 = Scalar(1.0)*_tmp13;
     const Scalar _tmp154 = x3 - 1;
-    const Scalar _tmp155 = std::pow(x0, Scalar(2));
+    const Scalar _tmp155 = (x0 * x0);
     const Scalar _tmp156 = _tmp29 - 4;
     const Scalar _tmp157 = _tmp140 + _tmp156;
     const Scalar _tmp158 = _tmp157*x4;
@@ -214,7 +214,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp174 = x1*x2;
     const Scalar _tmp175 = _tmp174*_tmp32;
     const Scalar _tmp176 = 8*_tmp65;
-    const Scalar _tmp177 = std::pow(x2, Scalar(2));
+    const Scalar _tmp177 = (x2 * x2);
     const Scalar _tmp178 = 2*_tmp130;
     const Scalar _tmp179 = Scalar(1.0) / (-_tmp178 + x0);
     const Scalar _tmp180 = 8*x3;
@@ -412,7 +412,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp372 = 4*x0;
     const Scalar _tmp373 = _tmp13*_tmp372;
     const Scalar _tmp374 = 4*_tmp177;
-    const Scalar _tmp375 = [&]() { const Scalar base = x0; return base * base * base; }();
+    const Scalar _tmp375 = (x0 * x0 * x0);
     const Scalar _tmp376 = x1 + Scalar(1.0);
     const Scalar _tmp377 = _tmp376*_tmp8;
     const Scalar _tmp378 = 2*_tmp377;
@@ -550,7 +550,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp510 = _tmp155*_tmp78;
     const Scalar _tmp511 = _tmp155*x1;
     const Scalar _tmp512 = _tmp134*_tmp511;
-    const Scalar _tmp513 = [&]() { const Scalar base = x1; return base * base * base; }();
+    const Scalar _tmp513 = (x1 * x1 * x1);
     const Scalar _tmp514 = _tmp155*x4;
     const Scalar _tmp515 = _tmp134*_tmp47;
     const Scalar _tmp516 = _tmp3 + _tmp421;
@@ -674,7 +674,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     const Scalar _tmp634 = _tmp148 + x3;
     const Scalar _tmp635 = _tmp372*_tmp634;
     const Scalar _tmp636 = _tmp195 + _tmp462*x1;
-    const Scalar _tmp637 = std::pow(_tmp39, Scalar(2)) - 2;
+    const Scalar _tmp637 = (_tmp39 * _tmp39) - 2;
     const Scalar _tmp638 = _tmp137 + _tmp94 + 1;
     const Scalar _tmp639 = _tmp0 + _tmp195;
     const Scalar _tmp640 = _tmp47*_tmp97;
@@ -1119,7 +1119,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[390] = _tmp122*_tmp337;
     result_value_ptr[391] = -_tmp369*_tmp371;
     result_value_ptr[392] = 8*_tmp130*_tmp189*_tmp97;
-    result_value_ptr[393] = _tmp373*[&]() { const Scalar base = x2; return base * base * base; }();
+    result_value_ptr[393] = _tmp373*(x2 * x2 * x2);
     result_value_ptr[394] = -_tmp26*_tmp374*_tmp67;
     result_value_ptr[395] = _tmp213*_tmp37*_tmp373;
     result_value_ptr[396] = _tmp180*_tmp375;
@@ -1173,7 +1173,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[444] = -_tmp122*_tmp32*_tmp65 - _tmp235*_tmp395 + _tmp398*_tmp399;
     result_value_ptr[445] = -_tmp37*_tmp395;
     result_value_ptr[446] = -_tmp170*_tmp397;
-    result_value_ptr[447] = std::pow(_tmp122, Scalar(2))*_tmp214;
+    result_value_ptr[447] = (_tmp122 * _tmp122)*_tmp214;
     result_value_ptr[448] = -_tmp398*_tmp400;
     result_value_ptr[449] = -_tmp398*_tmp402;
     result_value_ptr[450] = _tmp398*_tmp403;
@@ -1313,7 +1313,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[584] = _tmp43*_tmp49;
     result_value_ptr[585] = -_tmp46*_tmp49;
     result_value_ptr[586] = -_tmp253*_tmp462 + _tmp372 + _tmp428 + _tmp48*_tmp49;
-    result_value_ptr[587] = std::pow(_tmp49, Scalar(2));
+    result_value_ptr[587] = (_tmp49 * _tmp49);
     result_value_ptr[588] = -_tmp449*_tmp49;
     result_value_ptr[589] = -_tmp140*_tmp159 + _tmp47;
     result_value_ptr[590] = -_tmp115*_tmp162;
@@ -1502,7 +1502,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[773] = _tmp134*_tmp177*_tmp244;
     result_value_ptr[774] = -_tmp134*_tmp155*_tmp174*_tmp67;
     result_value_ptr[775] = _tmp213*_tmp244*_tmp503;
-    result_value_ptr[776] = _tmp134*_tmp18*_tmp23*std::pow(x0, Scalar(4));
+    result_value_ptr[776] = _tmp134*_tmp18*_tmp23*(x0 * x0 * x0 * x0);
     result_value_ptr[777] = -_tmp516*_tmp91;
     result_value_ptr[778] = -_tmp143*_tmp187;
     result_value_ptr[779] = -_tmp381*_tmp518;
@@ -1655,7 +1655,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[926] = _tmp105*_tmp555;
     result_value_ptr[927] = -_tmp127*_tmp558 + _tmp2*_tmp214*_tmp28 + _tmp294*_tmp557;
     result_value_ptr[928] = -_tmp28*_tmp559;
-    result_value_ptr[929] = -std::pow(_tmp28, Scalar(2))*x3;
+    result_value_ptr[929] = -(_tmp28 * _tmp28)*x3;
     result_value_ptr[930] = _tmp216*_tmp555;
     result_value_ptr[931] = -_tmp238*_tmp558;
     result_value_ptr[932] = -_tmp239*_tmp558;
@@ -1726,7 +1726,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[997] = -_tmp127*_tmp237;
     result_value_ptr[998] = _tmp503*_tmp569;
     result_value_ptr[999] = _tmp458;
-    result_value_ptr[1000] = -std::pow(_tmp127, Scalar(2));
+    result_value_ptr[1000] = -(_tmp127 * _tmp127);
     result_value_ptr[1001] = _tmp228 + _tmp504*_tmp569 - _tmp570*_tmp67;
     result_value_ptr[1002] = -4;
     result_value_ptr[1003] = -_tmp571;
@@ -1800,7 +1800,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBBibd93(const Scalar x0, const Scalar x1, c
     result_value_ptr[1071] = _tmp527*x4;
     result_value_ptr[1072] = _tmp570;
     result_value_ptr[1073] = -_tmp254*_tmp587;
-    result_value_ptr[1074] = std::pow(_tmp215, Scalar(2))*_tmp67;
+    result_value_ptr[1074] = (_tmp215 * _tmp215)*_tmp67;
     result_value_ptr[1075] = -Scalar(1)/Scalar(4)*_tmp342;
     result_value_ptr[1076] = _tmp215*_tmp239 + (Scalar(1)/Scalar(4))*_tmp255*_tmp345 - _tmp42*_tmp527;
     result_value_ptr[1077] = -_tmp215*_tmp241;
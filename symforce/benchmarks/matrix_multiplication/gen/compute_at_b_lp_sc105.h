@@ -58,7 +58,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp18 = -x1;
     const Scalar _tmp19 = _tmp18 + x0;
     const Scalar _tmp20 = _tmp19 + x4;
-    const Scalar _tmp21 = std::pow(x3, Scalar(2));
+    const Scalar _tmp21 = (x3 * x3);
     const Scalar _tmp22 = _tmp21*x4;
     const Scalar _tmp23 = -x4;
     const Scalar _tmp24 = x0 + x2;
@@ -68,7 +68,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp28 = _tmp27 + x3;
     const Scalar _tmp29 = x3 + Scalar(-1.0);
     const Scalar _tmp30 = _tmp10*x1;
-    const Scalar _tmp31 = std::pow(x4, Scalar(2));
+    const Scalar _tmp31 = (x4 * x4);
     const Scalar _tmp32 = Scalar(1.0) / (x1);
     const Scalar _tmp33 = (Scalar(1)/Scalar(2))*x0;
     const Scalar _tmp34 = _tmp31 + _tmp32*_tmp33;
@@ -80,12 +80,12 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp40 = _tmp39 + x0;
     const Scalar _tmp41 = _tmp31*_tmp40;
     const Scalar _tmp42 = _tmp15*x0;
-    const Scalar _tmp43 = std::pow(x0, Scalar(2));
+    const Scalar _tmp43 = (x0 * x0);
     const Scalar _tmp44 = 4*x2;
     const Scalar _tmp45 = _tmp43*_tmp44;
     const Scalar _tmp46 = x2*x3;
     const Scalar _tmp47 = 12*x0;
-    const Scalar _tmp48 = std::pow(x2, Scalar(2));
+    const Scalar _tmp48 = (x2 * x2);
     const Scalar _tmp49 = _tmp36 - _tmp48 + 2;
     const Scalar _tmp50 = _tmp4 + _tmp48 + x3;
     const Scalar _tmp51 = _tmp15*x4;
@@ -212,7 +212,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp172 = _tmp24*x2;
     const Scalar _tmp173 = _tmp172 + x0;
     const Scalar _tmp174 = x3 + 1;
-    const Scalar _tmp175 = 2*_tmp174*[&]() { const Scalar base = x0; return base * base * base; }();
+    const Scalar _tmp175 = 2*_tmp174*(x0 * x0 * x0);
     const Scalar _tmp176 = _tmp170*x0;
     const Scalar _tmp177 = _tmp57 + x0;
     const Scalar _tmp178 = x0 - 3;
@@ -269,7 +269,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp229 = _tmp174 + x0;
     const Scalar _tmp230 = _tmp229*x2 + x3;
     const Scalar _tmp231 = _tmp35 + 2;
-    const Scalar _tmp232 = std::pow(x1, Scalar(2));
+    const Scalar _tmp232 = (x1 * x1);
     const Scalar _tmp233 = _tmp4 + x1;
     const Scalar _tmp234 = _tmp12*_tmp157;
     const Scalar _tmp235 = 3*x2;
@@ -477,7 +477,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp437 = _tmp376 + x4;
     const Scalar _tmp438 = Scalar(2.0)*x1;
     const Scalar _tmp439 = _tmp132*_tmp36;
-    const Scalar _tmp440 = [&]() { const Scalar base = x2; return base * base * base; }();
+    const Scalar _tmp440 = (x2 * x2 * x2);
     const Scalar _tmp441 = _tmp26*_tmp81;
     const Scalar _tmp442 = _tmp57*x0;
     const Scalar _tmp443 = 2*_tmp48;
@@ -494,7 +494,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp454 = _tmp81*x3;
     const Scalar _tmp455 = _tmp290 + 1;
     const Scalar _tmp456 = x3/_tmp72;
-    const Scalar _tmp457 = [&]() { const Scalar base = x1; return base * base * base; }();
+    const Scalar _tmp457 = (x1 * x1 * x1);
     const Scalar _tmp458 = Scalar(1.0)*_tmp457;
     const Scalar _tmp459 = _tmp24*(_tmp157 + x3);
     const Scalar _tmp460 = _tmp120 + _tmp27;
@@ -612,7 +612,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     const Scalar _tmp572 = _tmp12*_tmp19 + x1;
     const Scalar _tmp573 = _tmp24*x0 + x3;
     const Scalar _tmp574 = x4 - 4;
-    const Scalar _tmp575 = std::pow(_tmp37, Scalar(2));
+    const Scalar _tmp575 = (_tmp37 * _tmp37);
     const Scalar _tmp576 = _tmp177*_tmp74;
     const Scalar _tmp577 = _tmp21*x0;
     const Scalar _tmp578 = -_tmp76;
@@ -912,7 +912,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     result_value_ptr[219] = 8*_tmp157 + _tmp195;
     result_value_ptr[220] = _tmp16*_tmp316*_tmp90;
     result_value_ptr[221] = -_tmp20*_tmp316*_tmp46 - _tmp44 + 16;
-    result_value_ptr[222] = -16*_tmp109 + _tmp316*[&]() { const Scalar base = x3; return base * base * base; }()*x4;
+    result_value_ptr[222] = -16*_tmp109 + _tmp316*(x3 * x3 * x3)*x4;
     result_value_ptr[223] = -4*_tmp11 + _tmp25*_tmp316*x3 - _tmp317*_tmp318*x0;
     result_value_ptr[224] = -_tmp318*_tmp320;
     result_value_ptr[225] = _tmp145*_tmp324*_tmp325 + _tmp321*_tmp323;
@@ -932,7 +932,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     result_value_ptr[239] = -_tmp181*_tmp342;
     result_value_ptr[240] = _tmp345*_tmp35;
     result_value_ptr[241] = _tmp328;
-    result_value_ptr[242] = -_tmp284 + _tmp315*x4 - _tmp346*_tmp40*[&]() { const Scalar base = x4; return base * base * base; }();
+    result_value_ptr[242] = -_tmp284 + _tmp315*x4 - _tmp346*_tmp40*(x4 * x4 * x4);
     result_value_ptr[243] = _tmp266*_tmp59*_tmp6;
     result_value_ptr[244] = _tmp232*_tmp242*_tmp43;
     result_value_ptr[245] = -_tmp12*_tmp69;
@@ -1186,7 +1186,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBLpSc105(const Scalar x0, const Scalar x1,
     result_value_ptr[493] = _tmp456*_tmp484;
     result_value_ptr[494] = _tmp482*_tmp485;
     result_value_ptr[495] = _tmp174*_tmp483;
-    result_value_ptr[496] = -_tmp134*std::pow(_tmp181, Scalar(2))*_tmp373 - _tmp164*_tmp482 + Scalar(1.0)*_tmp457*_tmp484;
+    result_value_ptr[496] = -_tmp134*(_tmp181 * _tmp181)*_tmp373 - _tmp164*_tmp482 + Scalar(1.0)*_tmp457*_tmp484;
     result_value_ptr[497] = -_tmp165*_tmp482 + _tmp478*_tmp483;
     result_value_ptr[498] = -_tmp166*_tmp482 + _tmp479*_tmp483;
     result_value_ptr[499] = _tmp459*_tmp484;
@@ -42,7 +42,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     const Scalar _tmp3 = _tmp0*_tmp2;
     const Scalar _tmp4 = Scalar(1.0) / (x4);
     const Scalar _tmp5 = _tmp4*x0;
-    const Scalar _tmp6 = std::pow(x1, Scalar(2));
+    const Scalar _tmp6 = (x1 * x1);
     const Scalar _tmp7 = x0 + x3;
     const Scalar _tmp8 = _tmp6*_tmp7;
     const Scalar _tmp9 = x1 + 2;
@@ -50,7 +50,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     const Scalar _tmp11 = x3 - 1;
     const Scalar _tmp12 = _tmp11*x3;
     const Scalar _tmp13 = _tmp12 - 1;
-    const Scalar _tmp14 = std::pow(x2, Scalar(2));
+    const Scalar _tmp14 = (x2 * x2);
     const Scalar _tmp15 = x4 - 2;
     const Scalar _tmp16 = _tmp14*(x2 - x3/_tmp15);
     const Scalar _tmp17 = Scalar(1.0) / (x1);
@@ -78,7 +78,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     const Scalar _tmp39 = -_tmp38;
     const Scalar _tmp40 = x1 + 1;
     const Scalar _tmp41 = x3*(_tmp39 + _tmp40);
-    const Scalar _tmp42 = std::pow(x3, Scalar(2));
+    const Scalar _tmp42 = (x3 * x3);
     const Scalar _tmp43 = x0 - 2;
     const Scalar _tmp44 = x2 + 3;
     const Scalar _tmp45 = (Scalar(1)/Scalar(2))*x0;
@@ -115,7 +115,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     const Scalar _tmp76 = x1 - 4;
     const Scalar _tmp77 = x1 + 4;
     const Scalar _tmp78 = x0 + x1;
-    const Scalar _tmp79 = std::pow(x4, Scalar(2));
+    const Scalar _tmp79 = (x4 * x4);
     const Scalar _tmp80 = _tmp78*_tmp79;
     const Scalar _tmp81 = 2*_tmp14;
     const Scalar _tmp82 = 2*x1;
@@ -186,7 +186,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     const Scalar _tmp147 = x1 - 5;
     const Scalar _tmp148 = _tmp48 + 2;
     const Scalar _tmp149 = _tmp60 + x0*x2 + x3;
-    const Scalar _tmp150 = _tmp98*[&]() { const Scalar base = x3; return base * base * base; }();
+    const Scalar _tmp150 = _tmp98*(x3 * x3 * x3);
 
     // Output terms (1)
     Eigen::Matrix<Scalar, 15, 15> _result;
@@ -208,7 +208,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     _result(13, 0) = 0;
     _result(14, 0) = 0;
     _result(0, 1) = -_tmp13*_tmp34;
-    _result(1, 1) = _tmp18*_tmp34 + _tmp21 + _tmp28 - _tmp37*_tmp41 - Scalar(1)/Scalar(2)*_tmp4*_tmp42*_tmp43*std::pow(x0, Scalar(2))*x2 + 8;
+    _result(1, 1) = _tmp18*_tmp34 + _tmp21 + _tmp28 - _tmp37*_tmp41 - Scalar(1)/Scalar(2)*_tmp4*_tmp42*_tmp43*(x0 * x0)*x2 + 8;
     _result(2, 1) = _tmp20*_tmp34;
     _result(3, 1) = -_tmp44*_tmp47;
     _result(4, 1) = 0;
@@ -256,7 +256,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     _result(1, 4) = 0;
     _result(2, 4) = _tmp60*_tmp90;
     _result(3, 4) = _tmp23*_tmp89;
-    _result(4, 4) = _tmp26*_tmp89 + _tmp27*[&]() { const Scalar base = x2; return base * base * base; }() - _tmp56*_tmp80 + _tmp90*_tmp91;
+    _result(4, 4) = _tmp26*_tmp89 + _tmp27*(x2 * x2 * x2) - _tmp56*_tmp80 + _tmp90*_tmp91;
     _result(5, 4) = _tmp68*_tmp90;
     _result(6, 4) = 0;
     _result(7, 4) = -_tmp92*_tmp93;
@@ -410,7 +410,7 @@ Eigen::Matrix<Scalar, 15, 15> ComputeAtBN3C4B2(const Scalar x0, const Scalar x1,
     _result(5, 14) = 0;
     _result(6, 14) = _tmp111*_tmp149;
     _result(7, 14) = -_tmp116*x1;
-    _result(8, 14) = -_tmp127*_tmp98*std::pow(x3, Scalar(4));
+    _result(8, 14) = -_tmp127*_tmp98*(x3 * x3 * x3 * x3);
     _result(9, 14) = -_tmp11*_tmp148;
     _result(10, 14) = -_tmp112*_tmp149;
     _result(11, 14) = -_tmp120;
@@ -41,8 +41,8 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp1 = Scalar(4.0)*x3;
     const Scalar _tmp2 = 2*x2;
     const Scalar _tmp3 = _tmp2 - 1;
-    const Scalar _tmp4 = std::pow(x3, Scalar(2));
-    const Scalar _tmp5 = std::pow(x0, Scalar(2));
+    const Scalar _tmp4 = (x3 * x3);
+    const Scalar _tmp5 = (x0 * x0);
     const Scalar _tmp6 = _tmp5*x4;
     const Scalar _tmp7 = _tmp4*_tmp6;
     const Scalar _tmp8 = x3*x4;
@@ -70,7 +70,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp30 = Scalar(1.0) / (_tmp29);
     const Scalar _tmp31 = _tmp30*x2;
     const Scalar _tmp32 = x4 + 4;
-    const Scalar _tmp33 = std::pow(x2, Scalar(2));
+    const Scalar _tmp33 = (x2 * x2);
     const Scalar _tmp34 = 4*_tmp33;
     const Scalar _tmp35 = _tmp34 + x4;
     const Scalar _tmp36 = x4 - 2;
@@ -104,7 +104,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp64 = 2*x3;
     const Scalar _tmp65 = _tmp40 - 2;
     const Scalar _tmp66 = _tmp64 + _tmp65;
-    const Scalar _tmp67 = std::pow(x1, Scalar(2));
+    const Scalar _tmp67 = (x1 * x1);
     const Scalar _tmp68 = _tmp26*_tmp67;
     const Scalar _tmp69 = x0 + 2;
     const Scalar _tmp70 = x3 - 3;
@@ -164,7 +164,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp124 = _tmp123*x3;
     const Scalar _tmp125 = 4*_tmp62;
     const Scalar _tmp126 = _tmp125 + x1;
-    const Scalar _tmp127 = std::pow(x4, Scalar(2));
+    const Scalar _tmp127 = (x4 * x4);
     const Scalar _tmp128 = _tmp127*_tmp26;
     const Scalar _tmp129 = x1*x4;
     const Scalar _tmp130 = _tmp129*_tmp2;
@@ -226,7 +226,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp186 = _tmp185 - 3;
     const Scalar _tmp187 = _tmp80 + x2;
     const Scalar _tmp188 = x4 + 2;
-    const Scalar _tmp189 = std::pow(_tmp188, Scalar(2));
+    const Scalar _tmp189 = (_tmp188 * _tmp188);
     const Scalar _tmp190 = _tmp36*_tmp47;
     const Scalar _tmp191 = _tmp40 - 4;
     const Scalar _tmp192 = _tmp119*_tmp59 + _tmp19;
@@ -560,7 +560,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp520 = _tmp56 + 2;
     const Scalar _tmp521 = _tmp511*_tmp64;
     const Scalar _tmp522 = _tmp169 - Scalar(3)/Scalar(2)*x1;
-    const Scalar _tmp523 = [&]() { const Scalar base = x4; return base * base * base; }();
+    const Scalar _tmp523 = (x4 * x4 * x4);
     const Scalar _tmp524 = 4*_tmp5;
     const Scalar _tmp525 = _tmp129 + _tmp45;
     const Scalar _tmp526 = _tmp40 + x4;
@@ -894,7 +894,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp854 = _tmp24*_tmp33;
     const Scalar _tmp855 = _tmp50*_tmp854;
     const Scalar _tmp856 = -1 + x0/_tmp752;
-    const Scalar _tmp857 = [&]() { const Scalar base = x1; return base * base * base; }();
+    const Scalar _tmp857 = (x1 * x1 * x1);
     const Scalar _tmp858 = _tmp849*_tmp857;
     const Scalar _tmp859 = _tmp849*x1;
     const Scalar _tmp860 = _tmp43 + _tmp651;
@@ -1011,7 +1011,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp971 = _tmp119 + _tmp64;
     const Scalar _tmp972 = _tmp40 + _tmp971;
     const Scalar _tmp973 = _tmp575*x2 + x2;
-    const Scalar _tmp974 = std::pow(x1, Scalar(4));
+    const Scalar _tmp974 = (x1 * x1 * x1 * x1);
     const Scalar _tmp975 = _tmp19*_tmp974;
     const Scalar _tmp976 = _tmp254*_tmp83;
     const Scalar _tmp977 = _tmp973*x3;
@@ -1528,7 +1528,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp1488 = _tmp1487 + 1;
     const Scalar _tmp1489 = _tmp169*x0;
     const Scalar _tmp1490 = _tmp1489 - 1;
-    const Scalar _tmp1491 = std::pow(_tmp28, Scalar(2));
+    const Scalar _tmp1491 = (_tmp28 * _tmp28);
     const Scalar _tmp1492 = _tmp1491*_tmp83;
     const Scalar _tmp1493 = _tmp868 + x1;
     const Scalar _tmp1494 = _tmp1291*x0;
@@ -1592,7 +1592,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp1552 = _tmp165 + _tmp55;
     const Scalar _tmp1553 = _tmp1325 + _tmp371;
     const Scalar _tmp1554 = _tmp267 - _tmp5;
-    const Scalar _tmp1555 = [&]() { const Scalar base = x3; return base * base * base; }();
+    const Scalar _tmp1555 = (x3 * x3 * x3);
     const Scalar _tmp1556 = _tmp1550*x4;
     const Scalar _tmp1557 = _tmp1457 - 2;
     const Scalar _tmp1558 = _tmp1557*x4;
@@ -1628,7 +1628,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp1588 = _tmp1586*_tmp67;
     const Scalar _tmp1589 = _tmp270 + x0;
     const Scalar _tmp1590 = _tmp1589*x0;
-    const Scalar _tmp1591 = [&]() { const Scalar base = x0; return base * base * base; }();
+    const Scalar _tmp1591 = (x0 * x0 * x0);
     const Scalar _tmp1592 = _tmp379*_tmp4;
     const Scalar _tmp1593 = _tmp153*_tmp5;
     const Scalar _tmp1594 = _tmp486*x4;
@@ -2161,7 +2161,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     const Scalar _tmp2121 = _tmp2116*x1;
     const Scalar _tmp2122 = _tmp3 + _tmp56;
     const Scalar _tmp2123 = _tmp2122*x2;
-    const Scalar _tmp2124 = [&]() { const Scalar base = x2; return base * base * base; }();
+    const Scalar _tmp2124 = (x2 * x2 * x2);
     const Scalar _tmp2125 = _tmp514 + _tmp936;
     const Scalar _tmp2126 = Scalar(16.0)*x3;
     const Scalar _tmp2127 = _tmp469*x4 + _tmp59;
@@ -3709,7 +3709,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     result_value_ptr[1261] = -_tmp1584 + _tmp250*_tmp43 - _tmp3*_tmp822 - _tmp67*_tmp674 - _tmp73;
     result_value_ptr[1262] = -_tmp1557*_tmp252 - _tmp1562*_tmp824 - _tmp253*_tmp43 - _tmp542 - _tmp823*_tmp999;
     result_value_ptr[1263] = -_tmp1557*_tmp255 + _tmp1559*_tmp593 - _tmp1585 - _tmp3*_tmp828 + _tmp827*_tmp999 + 6;
-    result_value_ptr[1264] = -_tmp1557*_tmp2 + _tmp1562*_tmp830 + _tmp3*_tmp832 + _tmp396*_tmp674 + std::pow(_tmp43, Scalar(2)) + _tmp831*_tmp999;
+    result_value_ptr[1264] = -_tmp1557*_tmp2 + _tmp1562*_tmp830 + _tmp3*_tmp832 + _tmp396*_tmp674 + (_tmp43 * _tmp43) + _tmp831*_tmp999;
     result_value_ptr[1265] = -_tmp1274*_tmp674 + _tmp1583;
     result_value_ptr[1266] = -_tmp1581*_tmp261 + _tmp259*_tmp43;
     result_value_ptr[1267] = _tmp1557*_tmp262 - _tmp674*_tmp835;
@@ -3723,7 +3723,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     result_value_ptr[1275] = -_tmp460*_tmp65;
     result_value_ptr[1276] = _tmp940;
     result_value_ptr[1277] = -_tmp107*_tmp1588 + 2*_tmp110*_tmp1591*x2 - Scalar(3)/Scalar(2)*_tmp1590 - _tmp1592*_tmp647 - _tmp818;
-    result_value_ptr[1278] = _tmp120*_tmp1593 + _tmp1587 + _tmp1589*_tmp665 + _tmp1594*_tmp678 - _tmp374*_tmp65 + _tmp379*_tmp467*std::pow(x3, Scalar(4)) + _tmp524 + _tmp572*_tmp80;
+    result_value_ptr[1278] = _tmp120*_tmp1593 + _tmp1587 + _tmp1589*_tmp665 + _tmp1594*_tmp678 - _tmp374*_tmp65 + _tmp379*_tmp467*(x3 * x3 * x3 * x3) + _tmp524 + _tmp572*_tmp80;
     result_value_ptr[1279] = -_tmp135*_tmp395 - _tmp1589*_tmp688 - _tmp1594*_tmp82 - _tmp1595*_tmp693 - _tmp1597 + _tmp5*_tmp535;
     result_value_ptr[1280] = _tmp143*_tmp395 - _tmp144*_tmp508 + _tmp145*_tmp1598;
     result_value_ptr[1281] = -_tmp147*_tmp1586 + _tmp149*_tmp395 - _tmp151*_tmp508;
@@ -3842,7 +3842,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     result_value_ptr[1394] = -_tmp1519*_tmp763 + _tmp1655*_tmp760 - _tmp1657;
     result_value_ptr[1395] = -_tmp1655*_tmp765;
     result_value_ptr[1396] = -_tmp1057*_tmp29;
-    result_value_ptr[1397] = _tmp1655*_tmp768*x3 - std::pow(_tmp29, Scalar(2))*x0;
+    result_value_ptr[1397] = _tmp1655*_tmp768*x3 - (_tmp29 * _tmp29)*x0;
     result_value_ptr[1398] = -_tmp1518*_tmp1656 - _tmp1519*_tmp770 - _tmp1655*_tmp771;
     result_value_ptr[1399] = _tmp133*_tmp1655 + _tmp1657*_tmp59 - _tmp1658*_tmp772;
     result_value_ptr[1400] = _tmp1526*_tmp1656 + _tmp1655*_tmp779 + _tmp1659*_tmp1660 + _tmp29*_tmp565;
@@ -4967,7 +4967,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     result_value_ptr[2519] = -_tmp1173 + _tmp206*_tmp2104;
     result_value_ptr[2520] = -_tmp1175 - _tmp1949;
     result_value_ptr[2521] = -_tmp1944;
-    result_value_ptr[2522] = _tmp1078*std::pow(_tmp185, Scalar(2)) - _tmp194 + _tmp20*_tmp879;
+    result_value_ptr[2522] = _tmp1078*(_tmp185 * _tmp185) - _tmp194 + _tmp20*_tmp879;
     result_value_ptr[2523] = -_tmp2104*_tmp220;
     result_value_ptr[2524] = -_tmp1177;
     result_value_ptr[2525] = _tmp1178 + _tmp1895*_tmp243 + _tmp2104*_tmp227;
@@ -5602,7 +5602,7 @@ Eigen::SparseMatrix<Scalar> ComputeAtBRotor1(const Scalar x0, const Scalar x1, c
     result_value_ptr[3154] = -_tmp1874*_tmp822 - _tmp202*_tmp37*_tmp62 - _tmp2248*_tmp438;
     result_value_ptr[3155] = _tmp202*_tmp269*_tmp337 - _tmp2251*_tmp252 + _tmp2256*_tmp823;
     result_value_ptr[3156] = -_tmp0*_tmp1871 - _tmp101*_tmp65 - _tmp1874*_tmp828 + _tmp1906*_tmp24 - _tmp202*_tmp241*_tmp656 - _tmp2248*_tmp439 - _tmp2251*_tmp255 - _tmp2256*_tmp827 + Scalar(-2.0);
-    result_value_ptr[3157] = _tmp101*_tmp259 + _tmp1874*_tmp832 + _tmp2248*_tmp440 - _tmp2256*_tmp831 - std::pow(_tmp24, Scalar(2))*x1 - _tmp950;
+    result_value_ptr[3157] = _tmp101*_tmp259 + _tmp1874*_tmp832 + _tmp2248*_tmp440 - _tmp2256*_tmp831 - (_tmp24 * _tmp24)*x1 - _tmp950;
     result_value_ptr[3158] = -_tmp2248*_tmp442;
     result_value_ptr[3159] = -_tmp47*_tmp834*_tmp876;
     result_value_ptr[3160] = -_tmp2248*_tmp443 - _tmp24*_tmp547 + (Scalar(1)/Scalar(2))*_tmp262*_tmp876*x1;
@@ -84,7 +84,7 @@ Eigen::SparseMatrix<Scalar> ComputeBTinaDiscog(const Scalar x0, const Scalar x1,
     result_value_ptr[13] = _tmp6 + 3*x0;
     result_value_ptr[14] = _tmp3 + _tmp7 + x0;
     result_value_ptr[15] = _tmp2 + x0;
-    result_value_ptr[16] = -4*std::pow(x1, Scalar(2))*x2;
+    result_value_ptr[16] = -4*(x1 * x1)*x2;
     result_value_ptr[17] = -x3 - 1;
     result_value_ptr[18] = -_tmp0*x4 + x2*x4;
     result_value_ptr[19] = -x0 - 3;
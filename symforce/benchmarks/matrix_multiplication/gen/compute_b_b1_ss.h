@@ -58,7 +58,7 @@ Eigen::SparseMatrix<Scalar> ComputeBB1Ss(const Scalar x0, const Scalar x1, const
 
 
     result_value_ptr[0] = x0*x2;
-    result_value_ptr[1] = x1 + std::pow(x2, Scalar(2));
+    result_value_ptr[1] = x1 + (x2 * x2);
     result_value_ptr[2] = -2*(x0 - 2)*(x1 + 1);
     result_value_ptr[3] = 1 + x2/x0;
     result_value_ptr[4] = _tmp0 - x3;
@@ -69,8 +69,8 @@ Eigen::SparseMatrix<Scalar> ComputeBB1Ss(const Scalar x0, const Scalar x1, const
     result_value_ptr[9] = -1/(x3 + 4);
     result_value_ptr[10] = _tmp1 + 2;
     result_value_ptr[11] = -x1/x4;
-    result_value_ptr[12] = std::pow(x0, Scalar(2))*x2;
-    result_value_ptr[13] = -[&]() { const Scalar base = x1; return base * base * base; }();
+    result_value_ptr[12] = (x0 * x0)*x2;
+    result_value_ptr[13] = -(x1 * x1 * x1);
 
     return result;
 }  // NOLINT(readability/fn_size)
@@ -44,7 +44,7 @@ Eigen::SparseMatrix<Scalar> ComputeBBibd93(const Scalar x0, const Scalar x1, con
     const Scalar _tmp5 = -_tmp0;
     const Scalar _tmp6 = x1*x3;
     const Scalar _tmp7 = 2*x1;
-    const Scalar _tmp8 = std::pow(x1, Scalar(2));
+    const Scalar _tmp8 = (x1 * x1);
     const Scalar _tmp9 = (Scalar(1)/Scalar(2))*x1;
     const Scalar _tmp10 = x1 - 2;
     const Scalar _tmp11 = x1*x4;
@@ -98,7 +98,7 @@ Eigen::SparseMatrix<Scalar> ComputeBBibd93(const Scalar x0, const Scalar x1, con
     const Scalar _tmp59 = _tmp36 + x1;
     const Scalar _tmp60 = _tmp13 - 2;
     const Scalar _tmp61 = _tmp21 + x3;
-    const Scalar _tmp62 = std::pow(x0, Scalar(2));
+    const Scalar _tmp62 = (x0 * x0);
     const Scalar _tmp63 = x1*x2;
     const Scalar _tmp64 = _tmp40 + 2;
     const Scalar _tmp65 = x3 + 2;
@@ -155,7 +155,7 @@ Eigen::SparseMatrix<Scalar> ComputeBBibd93(const Scalar x0, const Scalar x1, con
     result_value_ptr[20] = _tmp16 + x1;
     result_value_ptr[21] = _tmp17;
     result_value_ptr[22] = -_tmp18 + _tmp7 - 8;
-    result_value_ptr[23] = -_tmp20 - 2*std::pow(x3, Scalar(2)) - 1;
+    result_value_ptr[23] = -_tmp20 - 2*(x3 * x3) - 1;
     result_value_ptr[24] = _tmp13 + _tmp7;
     result_value_ptr[25] = -_tmp21 - _tmp9;
     result_value_ptr[26] = x2*(_tmp1*_tmp12 + x0);
@@ -247,7 +247,7 @@ Eigen::SparseMatrix<Scalar> ComputeBBibd93(const Scalar x0, const Scalar x1, con
     result_value_ptr[112] = _tmp13*_tmp66;
     result_value_ptr[113] = _tmp19 - 4;
     result_value_ptr[114] = -5;
-    result_value_ptr[115] = -x0*std::pow(x4, Scalar(2)) - 2;
+    result_value_ptr[115] = -x0*(x4 * x4) - 2;
     result_value_ptr[116] = _tmp42*x3 - 1;
     result_value_ptr[117] = _tmp30;
     result_value_ptr[118] = -_tmp56;
@@ -348,7 +348,7 @@ Eigen::SparseMatrix<Scalar> ComputeBBibd93(const Scalar x0, const Scalar x1, con
     result_value_ptr[213] = -4;
     result_value_ptr[214] = _tmp40;
     result_value_ptr[215] = -_tmp45 - _tmp60*x1;
-    result_value_ptr[216] = 2 - std::pow(_tmp73, Scalar(2));
+    result_value_ptr[216] = 2 - (_tmp73 * _tmp73);
     result_value_ptr[217] = _tmp75;
     result_value_ptr[218] = x1;
     result_value_ptr[219] = -x0 - 3;
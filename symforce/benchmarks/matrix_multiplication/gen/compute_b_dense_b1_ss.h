@@ -44,7 +44,7 @@ Eigen::Matrix<Scalar, 7, 7> ComputeBDenseB1Ss(const Scalar x0, const Scalar x1,
     _result.setZero();
 
     _result(4, 0) = x0*x2;
-    _result(5, 0) = x1 + std::pow(x2, Scalar(2));
+    _result(5, 0) = x1 + (x2 * x2);
     _result(6, 0) = -2*(x0 - 2)*(x1 + 1);
     _result(0, 1) = 1 + x2/x0;
     _result(1, 1) = _tmp0 - x3;
@@ -55,8 +55,8 @@ Eigen::Matrix<Scalar, 7, 7> ComputeBDenseB1Ss(const Scalar x0, const Scalar x1,
     _result(1, 4) = -1/(x3 + 4);
     _result(2, 5) = _tmp1 + 2;
     _result(5, 5) = -x1/x4;
-    _result(3, 6) = std::pow(x0, Scalar(2))*x2;
-    _result(6, 6) = -[&]() { const Scalar base = x1; return base * base * base; }();
+    _result(3, 6) = (x0 * x0)*x2;
+    _result(6, 6) = -(x1 * x1 * x1);
 
     return _result;
 }  // NOLINT(readability/fn_size)
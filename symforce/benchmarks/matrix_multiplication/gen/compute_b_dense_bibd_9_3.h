@@ -43,7 +43,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeBDenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp5 = -_tmp0;
     const Scalar _tmp6 = x1*x3;
     const Scalar _tmp7 = 2*x1;
-    const Scalar _tmp8 = std::pow(x1, Scalar(2));
+    const Scalar _tmp8 = (x1 * x1);
     const Scalar _tmp9 = (Scalar(1)/Scalar(2))*x1;
     const Scalar _tmp10 = x1 - 2;
     const Scalar _tmp11 = x1*x4;
@@ -97,7 +97,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeBDenseBibd93(const Scalar x0, const Scalar
     const Scalar _tmp59 = _tmp36 + x1;
     const Scalar _tmp60 = _tmp13 - 2;
     const Scalar _tmp61 = _tmp21 + x3;
-    const Scalar _tmp62 = std::pow(x0, Scalar(2));
+    const Scalar _tmp62 = (x0 * x0);
     const Scalar _tmp63 = x1*x2;
     const Scalar _tmp64 = _tmp40 + 2;
     const Scalar _tmp65 = x3 + 2;
@@ -141,7 +141,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeBDenseBibd93(const Scalar x0, const Scalar
     _result(14, 6) = _tmp16 + x1;
     _result(1, 7) = _tmp17;
     _result(2, 7) = -_tmp18 + _tmp7 - 8;
-    _result(15, 7) = -_tmp20 - 2*std::pow(x3, Scalar(2)) - 1;
+    _result(15, 7) = -_tmp20 - 2*(x3 * x3) - 1;
     _result(1, 8) = _tmp13 + _tmp7;
     _result(3, 8) = -_tmp21 - _tmp9;
     _result(16, 8) = x2*(_tmp1*_tmp12 + x0);
@@ -233,7 +233,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeBDenseBibd93(const Scalar x0, const Scalar
     _result(14, 38) = _tmp13*_tmp66;
     _result(25, 38) = _tmp19 - 4;
     _result(10, 39) = -5;
-    _result(11, 39) = -x0*std::pow(x4, Scalar(2)) - 2;
+    _result(11, 39) = -x0*(x4 * x4) - 2;
     _result(26, 39) = _tmp42*x3 - 1;
     _result(10, 40) = _tmp30;
     _result(12, 40) = -_tmp56;
@@ -334,7 +334,7 @@ Eigen::Matrix<Scalar, 36, 84> ComputeBDenseBibd93(const Scalar x0, const Scalar
     _result(34, 72) = -4;
     _result(24, 73) = _tmp40;
     _result(25, 73) = -_tmp45 - _tmp60*x1;
-    _result(35, 73) = 2 - std::pow(_tmp73, Scalar(2));
+    _result(35, 73) = 2 - (_tmp73 * _tmp73);
     _result(26, 74) = _tmp75;
     _result(27, 74) = x1;
     _result(30, 74) = -x0 - 3;
@@ -70,7 +70,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeBDenseDynamicTinaDi
     _result(4, 3) = _tmp6 + 3*x0;
     _result(5, 3) = _tmp3 + _tmp7 + x0;
     _result(6, 3) = _tmp2 + x0;
-    _result(7, 3) = -4*std::pow(x1, Scalar(2))*x2;
+    _result(7, 3) = -4*(x1 * x1)*x2;
     _result(10, 3) = -x3 - 1;
     _result(2, 4) = -_tmp0*x4 + x2*x4;
     _result(5, 4) = -x0 - 3;
@@ -37,7 +37,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeBDenseDynamicN3C4B2
     // Intermediate terms (19)
     const Scalar _tmp0 = Scalar(1.0) / (x3);
     const Scalar _tmp1 = Scalar(1.0) / (x4);
-    const Scalar _tmp2 = std::pow(x1, Scalar(2));
+    const Scalar _tmp2 = (x1 * x1);
     const Scalar _tmp3 = x0 + x3;
     const Scalar _tmp4 = x4 - 2;
     const Scalar _tmp5 = 2*x4;
@@ -63,14 +63,14 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeBDenseDynamicN3C4B2
     _result(9, 0) = -Scalar(1)/Scalar(2)*_tmp0*x4;
     _result(15, 0) = -_tmp0*_tmp1*x0;
     _result(18, 0) = _tmp2*_tmp3;
-    _result(19, 0) = -std::pow(x2, Scalar(2))*(x2 - x3/_tmp4);
+    _result(19, 0) = -(x2 * x2)*(x2 - x3/_tmp4);
     _result(8, 1) = _tmp6 + 4;
     _result(14, 1) = x3*(_tmp7 + _tmp8);
     _result(17, 1) = -Scalar(1)/Scalar(2)*_tmp1*_tmp9;
     _result(19, 1) = 3 - x4;
     _result(7, 2) = _tmp10;
     _result(13, 2) = (4*x0 + x3)/x2;
-    _result(16, 2) = -x0*(2*std::pow(x3, Scalar(2)) + 4);
+    _result(16, 2) = -x0*(2*(x3 * x3) + 4);
     _result(19, 2) = -x4*(_tmp5 + 2);
     _result(6, 3) = _tmp11*x4;
     _result(12, 3) = x1 + 4;
@@ -84,7 +84,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeBDenseDynamicN3C4B2
     _result(16, 5) = -_tmp12 - _tmp14 - x4;
     _result(17, 5) = _tmp3 + x1 - 1;
     _result(3, 6) = -x3*(_tmp15 + x0) - 2;
-    _result(12, 6) = _tmp16 + std::pow(x4, Scalar(2));
+    _result(12, 6) = _tmp16 + (x4 * x4);
     _result(14, 6) = -x0*(x0 - 2) - x4;
     _result(15, 6) = -_tmp8*x3;
     _result(2, 7) = -x0*x1*(x2 + x4);
@@ -113,7 +113,7 @@ Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> ComputeBDenseDynamicN3C4B2
     _result(5, 13) = _tmp18;
     _result(6, 13) = _tmp18 + 1;
     _result(0, 14) = x3 - 1;
-    _result(1, 14) = -_tmp13*[&]() { const Scalar base = x3; return base * base * base; }();
+    _result(1, 14) = -_tmp13*(x3 * x3 * x3);
     _result(2, 14) = x1;
     _result(3, 14) = _tmp17 + _tmp9 - 2;
 
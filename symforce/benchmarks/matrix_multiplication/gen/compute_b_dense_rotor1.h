@@ -36,7 +36,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
 
     // Intermediate terms (213)
     const Scalar _tmp0 = 4*x3;
-    const Scalar _tmp1 = std::pow(x0, Scalar(2));
+    const Scalar _tmp1 = (x0 * x0);
     const Scalar _tmp2 = _tmp1*x4;
     const Scalar _tmp3 = x0 - 4;
     const Scalar _tmp4 = x2 + 2;
@@ -55,7 +55,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
     const Scalar _tmp17 = -x2;
     const Scalar _tmp18 = _tmp17 + x1;
     const Scalar _tmp19 = _tmp18 + 2;
-    const Scalar _tmp20 = std::pow(x4, Scalar(2));
+    const Scalar _tmp20 = (x4 * x4);
     const Scalar _tmp21 = Scalar(1.0) / (x1);
     const Scalar _tmp22 = (Scalar(1)/Scalar(2))*_tmp21;
     const Scalar _tmp23 = 2*x0;
@@ -76,7 +76,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
     const Scalar _tmp38 = _tmp37 - 1;
     const Scalar _tmp39 = x0 - 1;
     const Scalar _tmp40 = -_tmp39;
-    const Scalar _tmp41 = std::pow(x2, Scalar(2));
+    const Scalar _tmp41 = (x2 * x2);
     const Scalar _tmp42 = 2*x4;
     const Scalar _tmp43 = _tmp8 + x4;
     const Scalar _tmp44 = _tmp6*x4;
@@ -116,7 +116,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
     const Scalar _tmp78 = _tmp77 + 1;
     const Scalar _tmp79 = _tmp6*x3;
     const Scalar _tmp80 = x2*x3;
-    const Scalar _tmp81 = std::pow(x1, Scalar(2));
+    const Scalar _tmp81 = (x1 * x1);
     const Scalar _tmp82 = x0*x4;
     const Scalar _tmp83 = _tmp36 + x0;
     const Scalar _tmp84 = x1 - 1;
@@ -127,7 +127,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
     const Scalar _tmp89 = x1*x4;
     const Scalar _tmp90 = Scalar(1.0) / (x4);
     const Scalar _tmp91 = -_tmp6;
-    const Scalar _tmp92 = std::pow(x3, Scalar(2));
+    const Scalar _tmp92 = (x3 * x3);
     const Scalar _tmp93 = _tmp92*x2;
     const Scalar _tmp94 = x0 - 2;
     const Scalar _tmp95 = x3 - 1;
@@ -812,7 +812,7 @@ Eigen::Matrix<Scalar, 100, 100> ComputeBDenseRotor1(const Scalar x0, const Scala
     _result(6, 79) = _tmp204;
     _result(10, 79) = _tmp162;
     _result(11, 79) = _tmp142;
-    _result(30, 79) = 2*[&]() { const Scalar base = x1; return base * base * base; }();
+    _result(30, 79) = 2*(x1 * x1 * x1);
     _result(7, 80) = _tmp159;
     _result(9, 80) = -_tmp70*x1;
     _result(11, 80) = _tmp91;
@@ -76,7 +76,7 @@ Eigen::SparseMatrix<Scalar> ComputeBLpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp37 = 3*x1;
     const Scalar _tmp38 = x2 + x4;
     const Scalar _tmp39 = Scalar(1.0) / (x3);
-    const Scalar _tmp40 = std::pow(x2, Scalar(2));
+    const Scalar _tmp40 = (x2 * x2);
     const Scalar _tmp41 = 2*x0;
     const Scalar _tmp42 = -_tmp41;
     const Scalar _tmp43 = x0 + x3;
@@ -85,14 +85,14 @@ Eigen::SparseMatrix<Scalar> ComputeBLpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp46 = x0 + 1;
     const Scalar _tmp47 = _tmp19 + _tmp27;
     const Scalar _tmp48 = 3*x4;
-    const Scalar _tmp49 = std::pow(x4, Scalar(2));
+    const Scalar _tmp49 = (x4 * x4);
     const Scalar _tmp50 = x1 + 1;
     const Scalar _tmp51 = -x1;
     const Scalar _tmp52 = x2 - 1;
     const Scalar _tmp53 = _tmp11 + x0;
     const Scalar _tmp54 = x0*x3;
     const Scalar _tmp55 = _tmp10*_tmp2;
-    const Scalar _tmp56 = std::pow(x3, Scalar(2));
+    const Scalar _tmp56 = (x3 * x3);
     const Scalar _tmp57 = x3 + x4;
     const Scalar _tmp58 = _tmp14 + 1;
     const Scalar _tmp59 = x3 + 2;
@@ -104,7 +104,7 @@ Eigen::SparseMatrix<Scalar> ComputeBLpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp65 = -_tmp48;
     const Scalar _tmp66 = _tmp0*x2;
     const Scalar _tmp67 = x3 - 1;
-    const Scalar _tmp68 = std::pow(x0, Scalar(2));
+    const Scalar _tmp68 = (x0 * x0);
     const Scalar _tmp69 = x1 - 2;
     const Scalar _tmp70 = _tmp69*x1;
     const Scalar _tmp71 = _tmp29 + x1;
@@ -139,7 +139,7 @@ Eigen::SparseMatrix<Scalar> ComputeBLpSc105(const Scalar x0, const Scalar x1, co
     const Scalar _tmp100 = x2*x3;
     const Scalar _tmp101 = _tmp2 - 2;
     const Scalar _tmp102 = _tmp0 + _tmp101;
-    const Scalar _tmp103 = std::pow(x1, Scalar(2));
+    const Scalar _tmp103 = (x1 * x1);
     const Scalar _tmp104 = x0*x1;
     const Scalar _tmp105 = -_tmp5;
     const Scalar _tmp106 = -_tmp31;
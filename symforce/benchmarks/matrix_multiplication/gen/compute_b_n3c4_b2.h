@@ -38,7 +38,7 @@ Eigen::SparseMatrix<Scalar> ComputeBN3C4B2(const Scalar x0, const Scalar x1, con
     // Intermediate terms (19)
     const Scalar _tmp0 = Scalar(1.0) / (x3);
     const Scalar _tmp1 = Scalar(1.0) / (x4);
-    const Scalar _tmp2 = std::pow(x1, Scalar(2));
+    const Scalar _tmp2 = (x1 * x1);
     const Scalar _tmp3 = x0 + x3;
     const Scalar _tmp4 = x4 - 2;
     const Scalar _tmp5 = 2*x4;
@@ -77,14 +77,14 @@ Eigen::SparseMatrix<Scalar> ComputeBN3C4B2(const Scalar x0, const Scalar x1, con
     result_value_ptr[0] = -Scalar(1)/Scalar(2)*_tmp0*x4;
     result_value_ptr[1] = -_tmp0*_tmp1*x0;
     result_value_ptr[2] = _tmp2*_tmp3;
-    result_value_ptr[3] = -std::pow(x2, Scalar(2))*(x2 - x3/_tmp4);
+    result_value_ptr[3] = -(x2 * x2)*(x2 - x3/_tmp4);
     result_value_ptr[4] = _tmp6 + 4;
     result_value_ptr[5] = x3*(_tmp7 + _tmp8);
     result_value_ptr[6] = -Scalar(1)/Scalar(2)*_tmp1*_tmp9;
     result_value_ptr[7] = 3 - x4;
     result_value_ptr[8] = _tmp10;
     result_value_ptr[9] = (4*x0 + x3)/x2;
-    result_value_ptr[10] = -x0*(2*std::pow(x3, Scalar(2)) + 4);
+    result_value_ptr[10] = -x0*(2*(x3 * x3) + 4);
     result_value_ptr[11] = -x4*(_tmp5 + 2);
     result_value_ptr[12] = _tmp11*x4;
     result_value_ptr[13] = x1 + 4;
@@ -98,7 +98,7 @@ Eigen::SparseMatrix<Scalar> ComputeBN3C4B2(const Scalar x0, const Scalar x1, con
     result_value_ptr[21] = -_tmp12 - _tmp14 - x4;
     result_value_ptr[22] = _tmp3 + x1 - 1;
     result_value_ptr[23] = -x3*(_tmp15 + x0) - 2;
-    result_value_ptr[24] = _tmp16 + std::pow(x4, Scalar(2));
+    result_value_ptr[24] = _tmp16 + (x4 * x4);
     result_value_ptr[25] = -x0*(x0 - 2) - x4;
     result_value_ptr[26] = -_tmp8*x3;
     result_value_ptr[27] = -x0*x1*(x2 + x4);
@@ -127,7 +127,7 @@ Eigen::SparseMatrix<Scalar> ComputeBN3C4B2(const Scalar x0, const Scalar x1, con
     result_value_ptr[50] = _tmp18;
     result_value_ptr[51] = _tmp18 + 1;
     result_value_ptr[52] = x3 - 1;
-    result_value_ptr[53] = -_tmp13*[&]() { const Scalar base = x3; return base * base * base; }();
+    result_value_ptr[53] = -_tmp13*(x3 * x3 * x3);
     result_value_ptr[54] = x1;
     result_value_ptr[55] = _tmp17 + _tmp9 - 2;
 
@@ -37,7 +37,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
 
     // Intermediate terms (213)
     const Scalar _tmp0 = 4*x3;
-    const Scalar _tmp1 = std::pow(x0, Scalar(2));
+    const Scalar _tmp1 = (x0 * x0);
     const Scalar _tmp2 = _tmp1*x4;
     const Scalar _tmp3 = x0 - 4;
     const Scalar _tmp4 = x2 + 2;
@@ -56,7 +56,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp17 = -x2;
     const Scalar _tmp18 = _tmp17 + x1;
     const Scalar _tmp19 = _tmp18 + 2;
-    const Scalar _tmp20 = std::pow(x4, Scalar(2));
+    const Scalar _tmp20 = (x4 * x4);
     const Scalar _tmp21 = Scalar(1.0) / (x1);
     const Scalar _tmp22 = (Scalar(1)/Scalar(2))*_tmp21;
     const Scalar _tmp23 = 2*x0;
@@ -77,7 +77,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp38 = _tmp37 - 1;
     const Scalar _tmp39 = x0 - 1;
     const Scalar _tmp40 = -_tmp39;
-    const Scalar _tmp41 = std::pow(x2, Scalar(2));
+    const Scalar _tmp41 = (x2 * x2);
     const Scalar _tmp42 = 2*x4;
     const Scalar _tmp43 = _tmp8 + x4;
     const Scalar _tmp44 = _tmp6*x4;
@@ -117,7 +117,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp78 = _tmp77 + 1;
     const Scalar _tmp79 = _tmp6*x3;
     const Scalar _tmp80 = x2*x3;
-    const Scalar _tmp81 = std::pow(x1, Scalar(2));
+    const Scalar _tmp81 = (x1 * x1);
     const Scalar _tmp82 = x0*x4;
     const Scalar _tmp83 = _tmp36 + x0;
     const Scalar _tmp84 = x1 - 1;
@@ -128,7 +128,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
     const Scalar _tmp89 = x1*x4;
     const Scalar _tmp90 = Scalar(1.0) / (x4);
     const Scalar _tmp91 = -_tmp6;
-    const Scalar _tmp92 = std::pow(x3, Scalar(2));
+    const Scalar _tmp92 = (x3 * x3);
     const Scalar _tmp93 = _tmp92*x2;
     const Scalar _tmp94 = x0 - 2;
     const Scalar _tmp95 = x3 - 1;
@@ -826,7 +826,7 @@ Eigen::SparseMatrix<Scalar> ComputeBRotor1(const Scalar x0, const Scalar x1, con
     result_value_ptr[555] = _tmp204;
     result_value_ptr[556] = _tmp162;
     result_value_ptr[557] = _tmp142;
-    result_value_ptr[558] = 2*[&]() { const Scalar base = x1; return base * base * base; }();
+    result_value_ptr[558] = 2*(x1 * x1 * x1);
     result_value_ptr[559] = _tmp159;
     result_value_ptr[560] = -_tmp70*x1;
     result_value_ptr[561] = _tmp91;
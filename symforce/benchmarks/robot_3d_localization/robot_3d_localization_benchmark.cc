@@ -32,6 +32,7 @@
 #include <symforce/examples/robot_3d_localization/run_dynamic_size.h>
 #include <symforce/examples/robot_3d_localization/run_fixed_size.h>
 #include <symforce/opt/factor.h>
+#include <symforce/opt/fixed_factor.h>
 #include <symforce/opt/optimizer.h>
 #include <symforce/opt/tic_toc.h>
 
@@ -146,6 +147,76 @@ TEMPLATE_TEST_CASE("sym_fixed_iterate", "", double, float) {
   }
 }
 
+TEMPLATE_TEST_CASE("sym_dynamic_factor_linearize", "", double, float) {
+  using Scalar = TestType;
+
+  const sym::Values<Scalar> values = BuildValues<Scalar>(kNumPoses, kNumLandmarks);
+
+  // Only the matching factors, which are evaluated through a type-erased Factor
+  std::vector<sym::Factor<Scalar>> factors;
+  std::vector<std::vector<sym::index_entry_t>> indices;
+  for (int i = 0; i < kNumPoses; i++) {
+    for (int j = 0; j < kNumLandmarks; j++) {
+      factors.push_back(CreateMatchingFactor<Scalar>(i, j));
+      indices.push_back(values.CreateIndex(factors.back().AllKeys()).entries);
+    }
+  }
+
+  typename sym::Factor<Scalar>::LinearizedDenseFactor linearized_factor{};
+
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  {
+    SYM_TIME_SCOPE("sym_dynamic_factor_{}/linearize", typeid(Scalar).name());
+    for (int i = 0; i < 1000; i++) {
+      for (size_t f = 0; f < factors.size(); f++) {
+        factors[f].Linearize(values, linearized_factor, &indices[f]);
+      }
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("sym_fixed_factor_linearize", "", double, float) {
+  using Scalar = TestType;
+
+  const sym::Values<Scalar> values = BuildValues<Scalar>(kNumPoses, kNumLandmarks);
+
+  // The same matching factors as sym_dynamic_factor_linearize, evaluated through FixedFactor
+  using MatchingFixedFactor = sym::FixedFactor<Scalar, decltype(&sym::MatchingFactor<Scalar>)>;
+  std::vector<MatchingFixedFactor> factors;
+  std::vector<std::vector<sym::index_entry_t>> indices;
+  for (int i = 0; i < kNumPoses; i++) {
+    for (int j = 0; j < kNumLandmarks; j++) {
+      factors.emplace_back(sym::MatchingFactor<Scalar>,
+                           std::vector<sym::Key>{
+                               sym::Key::WithSuper(sym::Keys::WORLD_T_BODY, i),
+                               sym::Key::WithSuper(sym::Keys::WORLD_T_LANDMARK, j),
+                               {sym::Keys::BODY_T_LANDMARK_MEASUREMENTS.Letter(), i, j},
+                               sym::Keys::MATCHING_SIGMA},
+                           std::vector<sym::Key>{sym::Key::WithSuper(sym::Keys::WORLD_T_BODY, i)});
+      indices.push_back(values.CreateIndex(factors.back().AllKeys()).entries);
+    }
+  }
+
+  typename MatchingFixedFactor::ResidualVec residual;
+  typename MatchingFixedFactor::JacobianMat jacobian;
+  typename MatchingFixedFactor::HessianMat hessian;
+  typename MatchingFixedFactor::RhsVec rhs;
+
+  std::chrono::milliseconds timespan(100);
+  std::this_thread::sleep_for(timespan);
+
+  {
+    SYM_TIME_SCOPE("sym_fixed_factor_{}/linearize", typeid(Scalar).name());
+    for (int i = 0; i < 1000; i++) {
+      for (size_t f = 0; f < factors.size(); f++) {
+        factors[f].Linearize(values, &residual, &jacobian, &hessian, &rhs, &indices[f]);
+      }
+    }
+  }
+}
+
 TEST_CASE("gtsam_linearize") {
   using namespace gtsam;
 
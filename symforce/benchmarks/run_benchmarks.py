@@ -23,18 +23,58 @@ from symforce.benchmarks.matrix_multiplication.generate_matrix_multiplication_be
 )
 
 CONFIG = {
+    "batch_reprojection": {
+        "double": {
+            "scalar - double",
+            "kernel - double",
+            "batched - double",
+        },
+        "float": {
+            "scalar - float",
+            "kernel - float",
+            "batched - float",
+        },
+    },
+    "imu_preintegration": {
+        "double": {
+            "integrate_measurement - double",
+            "integrate_measurements - double",
+        },
+        "float": {
+            "integrate_measurement - float",
+            "integrate_measurements - float",
+        },
+    },
     "inverse_compose_jacobian": {
         "double": {
             "gtsam_chained",
             "gtsam_flattened",
             "sophus_chained - double",
+            "sym_batch_values - double",
             "sym_chained - double",
             "sym_flattened - double",
+            "sym_per_object_values - double",
         },
         "float": {
             "sophus_chained - float",
+            "sym_batch_values - float",
             "sym_chained - float",
             "sym_flattened - float",
+            "sym_per_object_values - float",
+        },
+    },
+    "integer_power": {
+        "double": {
+            "between_factor_multiply - double",
+            "between_factor_std_pow - double",
+            "pixel_from_camera_point_multiply - double",
+            "pixel_from_camera_point_std_pow - double",
+        },
+        "float": {
+            "between_factor_multiply - float",
+            "between_factor_std_pow - float",
+            "pixel_from_camera_point_multiply - float",
+            "pixel_from_camera_point_std_pow - float",
         },
     },
     "robot_3d_localization": {
@@ -17,3 +17,4 @@ from .codegen import InvalidNamespaceError
 from .codegen import LinearizationMode
 from .codegen_config import CodegenConfig
 from .codegen_config import RenderTemplateConfig
+from .cost_model import CostModel
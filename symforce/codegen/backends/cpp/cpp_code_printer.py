@@ -5,7 +5,9 @@
 
 import sympy
 from sympy.printing.c import get_math_macros
+from sympy.printing.c import known_functions_C99
 from sympy.printing.cxx import CXX11CodePrinter
+from sympy.printing.cxx import _math_functions as cxx_math_functions
 
 from symforce import typing as T
 
@@ -16,6 +18,9 @@ class CppCodePrinter(CXX11CodePrinter):
     behavior for codegen compatibility and efficiency.
     """
 
+    # Integer powers up to this magnitude are printed as repeated multiplies instead of std::pow
+    MAX_MULTIPLY_POWER = 4
+
     def __init__(
         self,
         settings: T.Optional[T.Dict[str, T.Any]] = None,
@@ -68,7 +73,8 @@ class CppCodePrinter(CXX11CodePrinter):
     def _print_Pow(self, expr: sympy.Pow, rational: bool = False) -> str:
         """
         Customizations:
-            * Convert small powers into multiplies, divides, and square roots.
+            * Convert small integer powers into multiplies and divides, and half-integer powers
+              into square roots.
         """
         # std::pow(float, integral_type), std::pow(integral_type, float), and
         # std::sqrt(integral_type) will convert all arguments to double; so, we have to cast
@@ -91,17 +97,32 @@ class CppCodePrinter(CXX11CodePrinter):
         else:
             exp_str = f"Scalar({raw_exp_str})"
 
-        # We don't special-case 2, because std::pow(x, 2) compiles to x * x under all circumstances
-        # we tested (floats or doubles, fast-math or not)
+        one = self._print_Float(sympy.S(1.0))
 
         if expr.exp == -1:
-            return f"{self._print_Float(sympy.S(1.0))} / ({raw_base_str})"
-        elif expr.exp == 3:
-            return f"[&]() {{ const Scalar base = {raw_base_str}; return base * base * base; }}()"
+            return f"{one} / ({raw_base_str})"
+        elif expr.exp.is_Integer and 2 <= abs(expr.exp) <= self.MAX_MULTIPLY_POWER:
+            # Whether std::pow(x, n) with a constant n is lowered to multiplies depends on the
+            # compiler and flags (e.g. GCC only does it for n == 2 without -ffast-math), so we do it
+            # ourselves
+            power = abs(int(expr.exp))
+            if isinstance(expr.base, sympy.Symbol):
+                product = "({})".format(" * ".join([raw_base_str] * power))
+            else:
+                product = "[&]() {{ const Scalar base = {}; return {}; }}()".format(
+                    raw_base_str, " * ".join(["base"] * power)
+                )
+            return product if expr.exp > 0 else f"{one} / {product}"
         elif expr.exp == sympy.S.One / 2:
             return f"{self._ns}sqrt({base_str})"
+        elif expr.exp == -sympy.S.One / 2:
+            # This is a reciprocal square root, which compilers fuse into one instruction where
+            # the flags allow it
+            return f"{one} / {self._ns}sqrt({base_str})"
         elif expr.exp == sympy.S(3) / 2:
-            return f"({raw_base_str} * {self._ns}sqrt({base_str}))"
+            return f"({base_str} * {self._ns}sqrt({base_str}))"
+        elif expr.exp == -sympy.S(3) / 2:
+            return f"{one} / ({base_str} * {self._ns}sqrt({base_str}))"
         else:
             return f"{self._ns}pow({base_str}, {exp_str})"
 
@@ -176,3 +197,252 @@ class ComplexCppCodePrinter(CppCodePrinter):  # pylint: disable=too-many-ancesto
             * Cast to Scalar, since the literal is of type std::complex<double>
         """
         return "Scalar(1i)"
+
+
+class KernelCppCodePrinter(CppCodePrinter):  # pylint: disable=too-many-ancestors
+    """
+    Code printer for the kernel variant of a C++ function (see `CppConfig.generate_kernel`), whose
+    body is the body of a loop that compilers should be able to vectorize
+    """
+
+    def _print_min_max(self, name: str, args: T.Sequence[sympy.Basic]) -> str:
+        if len(args) == 1:
+            return self._print(args[0])
+
+        return "{}{}<Scalar>(Scalar({}), Scalar({}))".format(
+            self._ns, name, self._print(args[0]), self._print_min_max(name, args[1:])
+        )
+
+    def _print_Max(self, expr: sympy.Max) -> str:
+        """
+        Customizations:
+            * Pass the arguments as temporaries.  std::max takes and returns references, so when an
+              argument is an element of an argument array the result is a pointer to one of two
+              array elements, and a load through it is not vectorizable.
+        """
+        return self._print_min_max("max", expr.args)
+
+    def _print_Min(self, expr: sympy.Min) -> str:
+        """
+        Customizations:
+            * Pass the arguments as temporaries, see _print_Max
+        """
+        return self._print_min_max("min", expr.args)
+
+
+class BatchedCppCodePrinter(CppCodePrinter):  # pylint: disable=too-many-ancestors
+    """
+    Code printer for the batched variant of a C++ function (see `CppConfig.generate_batched`).
+
+    Every expression that depends on a symbol is an `Eigen::Array` with one lane per instance,
+    referred to as `Lanes` in the generated code, so operations on it are printed as Eigen array
+    operations instead of calls into std.  Subexpressions that do not depend on any symbol are
+    still printed as `Scalar`, and only broadcast to `Lanes` where Eigen needs an array.
+    """
+
+    # Functions with an elementwise Eigen array method of the same meaning
+    ARRAY_METHODS = {
+        "Abs": "abs",
+        "sin": "sin",
+        "cos": "cos",
+        "tan": "tan",
+        "asin": "asin",
+        "acos": "acos",
+        "atan": "atan",
+        "sinh": "sinh",
+        "cosh": "cosh",
+        "tanh": "tanh",
+        "exp": "exp",
+        "log": "log",
+        "log1p": "log1p",
+        "floor": "floor",
+        "ceiling": "ceil",
+        "sign": "sign",
+    }
+
+    @staticmethod
+    def _is_lanes(expr: sympy.Basic) -> bool:
+        return bool(expr.free_symbols)
+
+    def _print_lanes(self, expr: sympy.Basic) -> str:
+        """
+        Print expr so that the result is an Eigen array expression, even if it is a constant
+        """
+        if self._is_lanes(expr):
+            return f"({self._print(expr)})"
+        return f"Lanes::Constant({self._print(expr)})"
+
+    def _print_elementwise(self, name: str, args: T.Sequence[sympy.Basic]) -> str:
+        """
+        Fallback for functions without an Eigen array method, which applies the std function to
+        each lane
+        """
+        if len(args) == 1:
+            return "{}.unaryExpr([](const Scalar a) {{ return {}{}(a); }})".format(
+                self._print_lanes(args[0]), self._ns, name
+            )
+        if len(args) == 2:
+            return (
+                "{}.binaryExpr({}, [](const Scalar a, const Scalar b) {{ return {}{}(a, b); }})"
+            ).format(self._print_lanes(args[0]), self._print_lanes(args[1]), self._ns, name)
+        raise NotImplementedError(f"Batched code does not support {name} with {len(args)} args")
+
+    def doprint(self, expr: sympy.Basic, assign_to: T.Any = None) -> str:
+        """
+        Customizations:
+            * Broadcast constant terms, since every term is assigned to a `Lanes`
+        """
+        if isinstance(expr, sympy.Basic) and not self._is_lanes(expr):
+            if expr == 0:
+                return "Lanes::Zero()"
+            return f"Lanes::Constant({super().doprint(expr, assign_to)})"
+        return super().doprint(expr, assign_to)
+
+    def _print_Pow(self, expr: sympy.Pow, rational: bool = False) -> str:
+        """
+        Customizations:
+            * Use Eigen array methods for the powers we special-case for scalars
+        """
+        if not self._is_lanes(expr):
+            return super()._print_Pow(expr, rational)
+
+        if self._is_lanes(expr.exp):
+            return "{}.pow({})".format(self._print_lanes(expr.base), self._print_lanes(expr.exp))
+
+        base_str = self._print_lanes(expr.base)
+        if expr.exp == -1:
+            return f"{self._print_Float(sympy.S(1.0))} / {base_str}"
+        elif expr.exp == 2:
+            return f"{base_str}.square()"
+        elif expr.exp == 3:
+            return f"{base_str}.cube()"
+        elif expr.exp == sympy.S.One / 2:
+            return f"{base_str}.sqrt()"
+        elif expr.exp == -sympy.S.One / 2:
+            return f"{base_str}.rsqrt()"
+        elif expr.exp == sympy.S(3) / 2:
+            return f"({base_str} * {base_str}.sqrt())"
+        else:
+            return f"{base_str}.pow(Scalar({self._print(expr.exp)}))"
+
+    def _print_lanes_function(
+        self, expr: sympy.Function, std_name: str, print_scalar: T.Callable[..., str]
+    ) -> str:
+        """
+        Customizations:
+            * Use Eigen array methods where they exist, and apply the std function lane by lane
+              otherwise
+        """
+        if not self._is_lanes(expr):
+            return print_scalar(self, expr)
+
+        name = type(expr).__name__
+        if name in self.ARRAY_METHODS and len(expr.args) == 1:
+            return "{}.{}()".format(self._print_lanes(expr.args[0]), self.ARRAY_METHODS[name])
+
+        return self._print_elementwise(std_name, expr.args)
+
+    def _print_Max(self, expr: sympy.Max) -> str:
+        """
+        Customizations:
+            * Use the Eigen array method, which takes either an array or a scalar
+        """
+        if not self._is_lanes(expr) or len(expr.args) == 1:
+            return super()._print_Max(expr)
+
+        lanes_args = [arg for arg in expr.args if self._is_lanes(arg)]
+        scalar_args = [arg for arg in expr.args if not self._is_lanes(arg)]
+        result = self._print_lanes(lanes_args[0])
+        for arg in lanes_args[1:] + scalar_args:
+            result = f"{result}.max({self._print(arg)})"
+        return result
+
+    def _print_Min(self, expr: sympy.Min) -> str:
+        """
+        Customizations:
+            * Use the Eigen array method, which takes either an array or a scalar
+        """
+        if not self._is_lanes(expr) or len(expr.args) == 1:
+            return super()._print_Min(expr)
+
+        lanes_args = [arg for arg in expr.args if self._is_lanes(arg)]
+        scalar_args = [arg for arg in expr.args if not self._is_lanes(arg)]
+        result = self._print_lanes(lanes_args[0])
+        for arg in lanes_args[1:] + scalar_args:
+            result = f"{result}.min({self._print(arg)})"
+        return result
+
+    def _print_Heaviside(self, expr: sympy.Heaviside) -> str:  # type: ignore[override]
+        """
+        Customizations:
+            * Compare lane by lane, with the same value at 0 as the scalar version
+        """
+        if not self._is_lanes(expr):
+            return super()._print_Heaviside(expr)
+
+        return "({} >= Scalar(0)).template cast<Scalar>()".format(self._print_lanes(expr.args[0]))
+
+    def _print_Relational(self, expr: sympy.core.relational.Relational) -> str:
+        """
+        Customizations:
+            * Make sure the left hand side is an array, so the comparison is lane by lane even if
+              only the right hand side depends on a symbol
+        """
+        if not self._is_lanes(expr):
+            return super()._print_Relational(expr)
+
+        return "({} {} {})".format(self._print_lanes(expr.lhs), expr.rel_op, self._print(expr.rhs))
+
+    def _print_Piecewise(self, expr: sympy.Piecewise) -> str:
+        """
+        Customizations:
+            * Select lane by lane instead of branching
+        """
+        if not self._is_lanes(expr):
+            return super()._print_Piecewise(expr)
+
+        if expr.args[-1].cond != True:  # pylint: disable=singleton-comparison
+            raise ValueError("All Piecewise expressions must have a default (expr, True) case")
+
+        result = self._print_lanes(expr.args[-1].expr)
+        for piece in reversed(expr.args[:-1]):
+            result = "({}).select({}, {})".format(
+                self._print(piece.cond), self._print_lanes(piece.expr), result
+            )
+        return result
+
+    def _print_MatrixElement(self, expr: sympy.matrices.expressions.matexpr.MatrixElement) -> str:
+        raise NotImplementedError("DataBuffer arguments are not supported in batched code")
+
+
+def _attach_lanes_function_printers() -> None:
+    """
+    The C++ printers print each math function with its own `_print_<name>` method, so override
+    each of them on BatchedCppCodePrinter to go through `_print_lanes_function`
+    """
+    std_names = dict(BatchedCppCodePrinter.ARRAY_METHODS)
+    std_names.update(
+        (name, std_name)
+        for name, std_name in known_functions_C99.items()
+        if isinstance(std_name, str)
+    )
+    std_names.update(cxx_math_functions["C++11"])
+
+    for name, std_name in std_names.items():
+        method_name = f"_print_{name}"
+        print_scalar = getattr(CppCodePrinter, method_name, None)
+        if print_scalar is None or method_name in BatchedCppCodePrinter.__dict__:
+            continue
+
+        def _print_method(
+            self: BatchedCppCodePrinter,
+            expr: sympy.Function,
+            std_name: str = std_name,
+            print_scalar: T.Callable[..., str] = print_scalar,
+        ) -> str:
+            return self._print_lanes_function(expr, std_name, print_scalar)
+
+        setattr(BatchedCppCodePrinter, method_name, _print_method)
+
+
+_attach_lanes_function_printers()
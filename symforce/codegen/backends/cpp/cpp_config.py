@@ -2,6 +2,9 @@
 # SymForce - Copyright 2022, Skydio, Inc.
 # This source code is under the Apache 2.0 license found in the LICENSE file.
 # ----------------------------------------------------------------------------
+from __future__ import annotations
+
+import dataclasses
 from dataclasses import dataclass
 from pathlib import Path
 
@@ -28,6 +31,8 @@ class CppConfig(CodegenConfig):
         custom_preamble: An optional string to be prepended on the front of the rendered template
         cse_optimizations: Optimizations argument to pass to sf.cse
         zero_epsilon_behavior: What should codegen do if a default epsilon is not set?
+        cost_model: If set, used to inline cheap temporaries and reorder the rest after CSE, and
+                    the estimated cycles are printed in the generated code, see CostModel
         support_complex: Generate code that can work with std::complex or with regular float types
         force_no_inline: Mark generated functions as `__attribute__((noinline))`
         zero_initialization_sparsity_threshold: Threshold between 0 and 1 for the sparsity below
@@ -49,6 +54,23 @@ class CppConfig(CodegenConfig):
         extra_imports: Add extra imports to the file if you use custom overrides for some functions
             (i.e. add fast_math.h). Note that these are only added on a call to `generate_function`, i.e.
             you can't define custom functions in e.g. the geo package using this
+        generate_batched: Also generate `{Name}Batched` into `{name}_batched.h`, which evaluates the
+            function for `Width` instances at once on structure-of-arrays arguments, so that the
+            generated straight-line code operates on SIMD vectors instead of single scalars.  See
+            the generated docstring for the argument layout.  Width is usually best set to the
+            number of Scalars in one SIMD register, e.g. 4 doubles for AVX2.  Not supported for
+            functions with sparse outputs or DataBuffer inputs
+        generate_kernel: Also generate `{Name}Kernel` into `{name}_kernel.h`, which evaluates the
+            function for `count` instances in one loop over structure-of-arrays arguments, in the
+            style of a GPU kernel with one thread per instance.  Every argument, including geo and
+            cam types, is passed as a flat array of its storage, and every output is required.  The
+            loop has no heap allocations or branches, so compilers can vectorize it, see the
+            generated docstring for the flags this needs.  sym::ParallelForBlocks splits the
+            instances across threads.  Not supported for functions with sparse outputs or
+            DataBuffer inputs
+        kernel_uniform_args: Names of inputs of the kernel which are the same for every instance,
+            e.g. a camera calibration.  These are passed as a single copy of their storage instead
+            of one per instance
     """
 
     doc_comment_line_prefix: str = " * "
@@ -60,6 +82,9 @@ class CppConfig(CodegenConfig):
     explicit_template_instantiation_types: T.Optional[T.Sequence[str]] = None
     override_methods: T.Optional[T.Dict[sympy.Function, str]] = None
     extra_imports: T.Optional[T.List[str]] = None
+    generate_batched: bool = False
+    generate_kernel: bool = False
+    kernel_uniform_args: T.Optional[T.Sequence[str]] = None
 
     @classmethod
     def backend_name(cls) -> str:
@@ -77,6 +102,16 @@ class CppConfig(CodegenConfig):
         if self.explicit_template_instantiation_types is not None:
             templates.append(("function/FUNCTION.cc.jinja", f"{generated_file_name}.cc"))
 
+        if self.generate_batched:
+            templates.append(
+                ("function/FUNCTION_BATCHED.h.jinja", f"{generated_file_name}_batched.h")
+            )
+
+        if self.generate_kernel:
+            templates.append(
+                ("function/FUNCTION_KERNEL.h.jinja", f"{generated_file_name}_kernel.h")
+            )
+
         return templates
 
     def printer(self) -> CodePrinter:
@@ -87,6 +122,31 @@ class CppConfig(CodegenConfig):
 
         return cpp_code_printer.CppCodePrinter(**kwargs)
 
+    def batched_config(self) -> BatchedCppConfig:
+        """
+        Returns the config used to print the body of the batched variant of a function, see
+        `generate_batched`
+        """
+        return BatchedCppConfig(
+            **{field.name: getattr(self, field.name) for field in dataclasses.fields(self)}
+        )
+
+    def kernel_config(self) -> KernelCppConfig:
+        """
+        Returns the config used to print the body of the kernel variant of a function, see
+        `generate_kernel`
+        """
+        return KernelCppConfig(
+            **{field.name: getattr(self, field.name) for field in dataclasses.fields(self)}
+        )
+
+    def flattened_variant_config(self, variant: str) -> CppConfig:
+        if variant == "Batched":
+            return self.batched_config()
+        if variant == "Kernel":
+            return self.kernel_config()
+        return super().flattened_variant_config(variant)
+
     @staticmethod
     def format_data_accessor(prefix: str, index: int) -> str:
         return f"{prefix}.Data()[{index}]"
@@ -101,3 +161,51 @@ class CppConfig(CodegenConfig):
         Format accessor for eigen_lcm types.
         """
         return f"{key}.data()[{i}]"
+
+
+@dataclass
+class BatchedCppConfig(CppConfig):
+    """
+    Config for printing the body of the batched variant of a C++ function.  Every argument is
+    flattened to a column of its storage before printing, and stored as an
+    `Eigen::Array<Scalar, Width, storage_dim>` where column `i` holds storage entry `i` of every
+    instance.
+
+    Not meant to be used directly, set `CppConfig.generate_batched` instead.
+    """
+
+    def printer(self) -> CodePrinter:
+        if self.support_complex:
+            raise NotImplementedError("Batched code does not support complex numbers")
+
+        return cpp_code_printer.BatchedCppCodePrinter(override_methods=self.override_methods)
+
+    def format_matrix_accessor(self, key: str, i: int, j: int, *, shape: T.Tuple[int, int]) -> str:
+        CppConfig._assert_indices_in_bounds(i, j, shape)
+        return f"{key}.col({i + j * shape[0]})"
+
+
+@dataclass
+class KernelCppConfig(CppConfig):
+    """
+    Config for printing the body of the kernel variant of a C++ function.  Every argument is
+    flattened to a column of its storage before printing, and stored as a flat array where entry
+    `i` of instance `k` is at `arg[i * stride + k]`, or at `arg[i]` for `kernel_uniform_args`.
+
+    Not meant to be used directly, set `CppConfig.generate_kernel` instead.
+    """
+
+    def printer(self) -> CodePrinter:
+        if self.support_complex:
+            raise NotImplementedError("Kernel code does not support complex numbers")
+
+        return cpp_code_printer.KernelCppCodePrinter(override_methods=self.override_methods)
+
+    def format_matrix_accessor(self, key: str, i: int, j: int, *, shape: T.Tuple[int, int]) -> str:
+        CppConfig._assert_indices_in_bounds(i, j, shape)
+        index = i + j * shape[0]
+        if self.kernel_uniform_args is not None and key in self.kernel_uniform_args:
+            return f"{key}[{index}]"
+        elif index == 0:
+            return f"{key}[k]"
+        return f"{key}[{index} * stride + k]"
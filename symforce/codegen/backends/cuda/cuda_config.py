@@ -29,6 +29,8 @@ class CudaConfig(CodegenConfig):
         custom_preamble: An optional string to be prepended on the front of the rendered template
         cse_optimizations: Optimizations argument to pass to sf.cse
         zero_epsilon_behavior: What should codegen do if a default epsilon is not set?
+        cost_model: If set, used to inline cheap temporaries and reorder the rest after CSE, see
+                    CostModel
         override_methods: Add special function overrides in dictionary with symforce function keys
             (e.g. sf.sin) and a string for the new method (e.g. fast_math::sin_lut), note that this bypasses
             the default namespace (so std:: won't be added in front automatically). Note that the keys here
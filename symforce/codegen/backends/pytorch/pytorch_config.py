@@ -27,6 +27,8 @@ class PyTorchConfig(CodegenConfig):
         custom_preamble: An optional string to be prepended on the front of the rendered template
         cse_optimizations: Optimizations argument to pass to sf.cse
         zero_epsilon_behavior: What should codegen do if a default epsilon is not set?
+        cost_model: If set, used to inline cheap temporaries and reorder the rest after CSE, see
+                    CostModel
     """
 
     doc_comment_line_prefix: str = ""
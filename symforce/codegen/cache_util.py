@@ -0,0 +1,230 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+"""
+On-disk cache for the expensive steps of code generation, i.e. CSE and printing of each function,
+and autoformatting of each generated file.
+
+Results are keyed on a hash of everything that determines them: the symbolic expressions and
+config for printing, and the unformatted file for formatting.  The hash also covers the Python
+sources and templates of the whole symforce package (which includes the geo and cam types, ops and
+the symbolic API as well as the code generator), the versions of symforce and the symbolic API, and
+the files of the symengine module if it's the symbolic API, so that changes to anything that
+determines the generated code invalidate the cache.  Unchanged functions are then skipped when
+regenerating a package.
+
+Results are stored as JSON, so reading an entry never runs code, but anyone who can write to the
+cache directory can still change the code that's generated from it.  Only use a directory which
+only trusted users can write to.
+
+The cache is disabled by default.  Enable it by calling set_cache_dir, or by setting the
+SYMFORCE_CODEGEN_CACHE_DIR environment variable.  Entries are never evicted, the directory can be
+deleted at any time.
+"""
+
+from __future__ import annotations
+
+import dataclasses
+import enum
+import functools
+import hashlib
+import json
+import os
+import tempfile
+from pathlib import Path
+
+import sympy
+
+import symforce
+import symforce.symbolic as sf
+from symforce import logger
+from symforce import typing as T
+from symforce.values import Values
+
+CURRENT_DIR = Path(__file__).parent
+SYMFORCE_DIR = CURRENT_DIR.parent
+
+_cache_dir: T.Optional[Path] = None
+
+_T = T.TypeVar("_T")
+
+
+def set_cache_dir(cache_dir: T.Optional[T.Openable]) -> None:
+    """
+    Set the directory to cache codegen results in, or None to disable caching
+    """
+    global _cache_dir  # pylint: disable=global-statement
+    _cache_dir = Path(cache_dir) if cache_dir is not None else None
+
+
+def get_cache_dir() -> T.Optional[Path]:
+    """
+    The directory codegen results are cached in, or None if caching is disabled
+    """
+    return _cache_dir
+
+
+if "SYMFORCE_CODEGEN_CACHE_DIR" in os.environ:
+    set_cache_dir(os.environ["SYMFORCE_CODEGEN_CACHE_DIR"])
+
+
+@functools.lru_cache
+def _generator_fingerprint() -> str:
+    """
+    Hash of the code generator itself, which is part of every key.  This covers the sources of the
+    whole symforce package, since e.g. changes to the geo types or ops also change generated code,
+    and the symengine module, which is built from source and so may change without its version
+    changing.  Sympy is covered by its version.
+    """
+    hasher = hashlib.sha256()
+    hasher.update(f"{symforce.__version__} {symforce.get_symbolic_api()}".encode())
+    hasher.update(f"sympy {sympy.__version__} {sf.sympy.__name__}".encode())
+    hasher.update(getattr(sf.sympy, "__version__", "").encode())
+
+    def hash_files(root: Path, suffixes: T.Tuple[str, ...]) -> None:
+        for path in sorted(root.rglob("*")):
+            if path.suffix in suffixes and path.is_file():
+                hasher.update(os.fspath(path.relative_to(root)).encode())
+                hasher.update(path.read_bytes())
+
+    hash_files(SYMFORCE_DIR, (".py", ".jinja"))
+    if sf.sympy is not sympy:
+        hash_files(Path(sf.sympy.__file__).parent, (".py", ".so", ".pyd", ".dylib"))
+    return hasher.hexdigest()
+
+
+def _expr_digest(expr: T.Any, digests: T.Dict[T.Any, str]) -> str:
+    """
+    Hash of a symbolic expression.  Unlike str(expr), this visits each distinct subexpression once,
+    which matters for expressions like jacobians that share most of their subexpressions.
+
+    Args:
+        expr: The expression to hash
+        digests: Hashes of subexpressions that have already been visited, which is updated
+    """
+    # Keyed on the type too, since e.g. sympy considers the Integer 1 and the Float 1.0 equal
+    key = lambda node: (type(node), node)
+
+    stack = [expr]
+    while stack:
+        node = stack[-1]
+        if key(node) in digests:
+            stack.pop()
+            continue
+
+        args = node.args
+        missing_args = [arg for arg in args if key(arg) not in digests]
+        if missing_args:
+            stack.extend(missing_args)
+            continue
+
+        stack.pop()
+        hasher = hashlib.sha256(type(node).__name__.encode())
+        if args:
+            for arg in args:
+                hasher.update(digests[key(arg)].encode())
+        else:
+            hasher.update(str(node).encode())
+            # Symbols with the same name but different assumptions (e.g. positive=True) or dummy
+            # indices are different symbols, which can simplify and print differently
+            if isinstance(node, (sympy.Symbol, sf.sympy.Symbol)):
+                assumptions = getattr(node, "assumptions0", {})
+                hasher.update(repr(sorted(assumptions.items())).encode())
+                hasher.update(repr(getattr(node, "dummy_index", None)).encode())
+        digests[key(node)] = hasher.hexdigest()
+
+    return digests[key(expr)]
+
+
+def stable_repr(obj: T.Any, expr_digests: T.Optional[T.Dict[T.Any, str]] = None) -> str:
+    """
+    A string representation of obj for hashing, which unlike repr does not depend on the memory
+    addresses of objects, and so is the same across processes.  Symbolic expressions are
+    represented by their hash.
+
+    Args:
+        obj: The object to represent
+        expr_digests: Hashes of symbolic expressions already visited, shared between calls
+    """
+    if expr_digests is None:
+        expr_digests = {}
+    recurse = functools.partial(stable_repr, expr_digests=expr_digests)
+
+    if obj is None or isinstance(obj, (bool, int, float, str, bytes, enum.Enum)):
+        return repr(obj)
+    if isinstance(obj, (list, tuple)):
+        return f"{type(obj).__name__}[{', '.join(recurse(x) for x in obj)}]"
+    if isinstance(obj, dict):
+        items = sorted(f"{recurse(k)}: {recurse(v)}" for k, v in obj.items())
+        return f"{{{', '.join(items)}}}"
+    if isinstance(obj, Values):
+        return f"Values{recurse(list(obj.items()))}"
+    if isinstance(obj, (sympy.Basic, sf.sympy.Basic)):
+        return f"{type(obj).__name__}#{_expr_digest(obj, expr_digests)}"
+    if isinstance(obj, (sympy.MatrixBase, sf.sympy.MatrixBase)):
+        # Matrices aren't Basic in symengine, and their repr expands every shared subexpression
+        return f"{type(obj).__name__}{recurse([tuple(obj.shape), list(obj)])}"
+    if dataclasses.is_dataclass(obj) and not isinstance(obj, type):
+        fields = {f.name: getattr(obj, f.name) for f in dataclasses.fields(obj)}
+        return f"{type(obj).__qualname__}{recurse(fields)}"
+    if isinstance(obj, type):
+        # For sympy UndefinedFunctions, this is the name of the function
+        return repr(obj)
+    if isinstance(obj, functools.partial):
+        return f"partial({recurse([obj.func, obj.args, obj.keywords])})"
+    if callable(obj) and hasattr(obj, "__qualname__"):
+        # Lambdas all have the same name, so also hash their bytecode and constants
+        code = getattr(obj, "__code__", None)
+        code_repr = (
+            hashlib.sha256(code.co_code + repr(code.co_consts).encode()).hexdigest()
+            if code is not None
+            else ""
+        )
+        return f"{getattr(obj, '__module__', '')}.{obj.__qualname__}:{code_repr}"
+    if hasattr(obj, "__dict__"):
+        return f"{type(obj).__qualname__}{recurse(vars(obj))}"
+    return repr(obj)
+
+
+def cached(namespace: str, key: T.Any, compute: T.Callable[[], _T]) -> _T:
+    """
+    Return compute(), or its result from a previous call with the same namespace and key if the
+    cache is enabled.  The result must be made of JSON types, and is returned after a round trip
+    through JSON even on a cache miss, so that e.g. tuples are always returned as lists.
+
+    Args:
+        namespace: The kind of result being cached, which is also the subdirectory it's stored in
+        key: Everything that compute depends on, hashed with stable_repr
+        compute: Function to compute the result on a cache miss
+    """
+    cache_dir = get_cache_dir()
+    if cache_dir is None:
+        return compute()
+
+    hasher = hashlib.sha256(_generator_fingerprint().encode())
+    hasher.update(stable_repr(key).encode())
+    digest = hasher.hexdigest()
+    path = cache_dir / namespace / digest[:2] / digest
+
+    try:
+        with open(path, "r", encoding="utf-8") as f:
+            result = json.load(f)
+        logger.debug(f"Codegen cache hit: {namespace}/{digest}")
+        return result
+    except FileNotFoundError:
+        pass
+    except (ValueError, UnicodeDecodeError) as ex:
+        logger.warning(f"Ignoring unreadable codegen cache entry {path}: {ex}")
+
+    serialized = json.dumps(compute())
+
+    # Write to a temporary file and rename it into place, so that other processes generating the
+    # same function never see a partially written entry
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with tempfile.NamedTemporaryFile("w", encoding="utf-8", dir=path.parent, delete=False) as f:
+        f.write(serialized)
+    os.replace(f.name, path)
+
+    return json.loads(serialized)
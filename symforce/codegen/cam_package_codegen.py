@@ -4,6 +4,7 @@
 # ----------------------------------------------------------------------------
 
 import collections
+import dataclasses
 import tempfile
 import textwrap
 from pathlib import Path
@@ -147,6 +148,43 @@ def make_camera_funcs(cls: T.Type, config: CodegenConfig) -> T.List[Codegen]:
     )
 
 
+def make_batch_camera_funcs(cls: T.Type, config: CppConfig) -> T.List[Codegen]:
+    """
+    Create func spec arguments for batch projection and backprojection with the given class, which
+    are printed as kernels over structure-of-arrays storage of the points or pixels.  The
+    calibration and epsilon are shared by every point.
+    """
+    config = dataclasses.replace(
+        config, generate_kernel=True, kernel_uniform_args=["self", "epsilon"]
+    )
+
+    funcs = [
+        Codegen.function(
+            func=cls.pixel_from_camera_point,
+            input_types=[cls, sf.V3, sf.Symbol],
+            config=config,
+            output_names=["pixel", "is_valid"],
+            docstring="Projects each point in the camera frame into pixel coordinates.",
+        )
+    ]
+
+    try:
+        funcs.append(
+            Codegen.function(
+                func=cls.camera_ray_from_pixel,
+                input_types=[cls, sf.V2, sf.Symbol],
+                config=config,
+                output_names=["camera_ray", "is_valid"],
+                docstring="Backprojects each pixel into a ray in the camera frame (NOT normalized).",
+            )
+        )
+    except NotImplementedError:
+        # Not all cameras implement backprojection
+        pass
+
+    return funcs
+
+
 def cam_class_data(cls: T.Type, config: CodegenConfig) -> T.Dict[str, T.Any]:
     """
     Data for template generation of this class. Contains all useful info for
@@ -325,9 +363,12 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
         for cls in DEFAULT_CAM_TYPES:
             data = cam_class_data(cls, config=config)
 
+            data["specs"]["BatchOps"] = make_batch_camera_funcs(cls, config)
+
             for base_dir, relative_path in (
                 ("cam_package", "CLASS.h"),
                 ("cam_package", "CLASS.cc"),
+                (".", "ops/CLASS/batch_ops.h"),
                 (".", "ops/CLASS/storage_ops.h"),
                 (".", "ops/CLASS/storage_ops.cc"),
                 (".", "ops/CLASS/group_ops.h"),
@@ -343,7 +384,7 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
                     template_path, data, config.render_template_config, output_path=output_path
                 )
 
-        # Add Camera and PosedCamera
+        # Add Camera, PosedCamera and CameraRayLut
         templates.add(
             template_path=Path("cam_package", "camera.h.jinja"),
             output_path=cam_package_dir / "camera.h",
@@ -356,6 +397,12 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
             data=posed_camera_data(),
             config=config.render_template_config,
         )
+        templates.add(
+            template_path=Path("cam_package", "camera_ray_lut.h.jinja"),
+            output_path=cam_package_dir / "camera_ray_lut.h",
+            data=Codegen.common_data(),
+            config=config.render_template_config,
+        )
 
         # Test example
         for name in (
@@ -394,6 +441,7 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
     else:
         raise NotImplementedError(f'Unknown config type: "{config}"')
 
-    templates.render()
+    # Printing the functions in each template is most of the work, so render them in parallel
+    templates.render(num_processes=None)
 
     return output_dir
@@ -93,6 +93,7 @@ class Codegen:
         name: T.Optional[str] = None,
         return_key: T.Optional[str] = None,
         sparse_matrices: T.Sequence[str] = None,
+        lower_triangular_matrices: T.Sequence[str] = None,
         docstring: str = None,
     ) -> None:
         """
@@ -110,6 +111,12 @@ class Codegen:
             return_key: If specified, the output with this key is returned rather than filled
                         in as a named output argument.
             sparse_matrices: Outputs with this key will be returned as sparse matrices
+            lower_triangular_matrices: Outputs with this key are square matrices whose upper
+                                       triangle is zero (e.g. the hessian of a factor), and for
+                                       which only the lower triangle is written.  The strict upper
+                                       triangle of the output is left unmodified.  Currently only
+                                       the C++ backend skips the upper triangle, other backends
+                                       write it as usual
             docstring: The docstring to be used with the generated function
         """
 
@@ -228,6 +235,17 @@ class Codegen:
             for key in sparse_matrices:
                 self.sparse_mat_data[key] = codegen_util.CSCFormat.from_matrix(outputs[key])
 
+        self.lower_triangular_matrices: T.Set[str] = set()
+        if lower_triangular_matrices is not None:
+            for key in lower_triangular_matrices:
+                assert key in outputs and key not in self.sparse_mat_data
+                mat = outputs[key]
+                assert isinstance(mat, sf.Matrix) and mat.shape[0] == mat.shape[1]
+                assert all(
+                    mat[i, j] == 0 for j in range(mat.shape[1]) for i in range(j)
+                ), f"Output {key} is not lower triangular"
+            self.lower_triangular_matrices = set(lower_triangular_matrices)
+
         self.docstring = (
             docstring or Codegen.default_docstring(inputs=inputs, outputs=outputs)
         ).rstrip()
@@ -407,6 +425,62 @@ class Codegen:
         except (TypeError, LookupError, AttributeError) as ex:
             raise CodeGenerationException("Exception printing code results, see above") from ex
 
+    @functools.cached_property
+    def batched_print_code_results(self) -> codegen_util.PrintCodeResult:
+        """
+        The code for the batched variant of this function, see `CppConfig.generate_batched`
+        """
+        return self._flattened_print_code_results("Batched", include_scalars=False)
+
+    @functools.cached_property
+    def kernel_print_code_results(self) -> codegen_util.PrintCodeResult:
+        """
+        The code for the kernel variant of this function, see `CppConfig.generate_kernel`
+        """
+        for arg in getattr(self.config, "kernel_uniform_args", None) or []:
+            if arg not in self.inputs:
+                raise CodeGenerationException(f"Uniform kernel argument {arg} is not an input")
+
+        return self._flattened_print_code_results("Kernel", include_scalars=True)
+
+    def _flattened_print_code_results(
+        self,
+        variant: str,
+        include_scalars: bool,
+    ) -> codegen_util.PrintCodeResult:
+        """
+        Print the code for a variant of this function whose inputs and outputs are flattened to
+        columns of their storage, with the config for that variant, see
+        `CodegenConfig.flattened_variant_config`
+
+        Args:
+            variant: Name of the variant
+            include_scalars: Whether scalars are also flattened to columns, see
+                             `codegen_util.flatten_to_storage_columns`
+        """
+        try:
+            variant_config = self.config.flattened_variant_config(variant)
+        except NotImplementedError as ex:
+            raise CodeGenerationException(str(ex)) from ex
+        if self.sparse_mat_data:
+            raise CodeGenerationException(f"{variant} functions do not support sparse outputs")
+
+        try:
+            return codegen_util.print_code(
+                inputs=codegen_util.flatten_to_storage_columns(
+                    self.inputs, include_scalars=include_scalars
+                ),
+                outputs=codegen_util.flatten_to_storage_columns(
+                    self.outputs, include_scalars=include_scalars
+                ),
+                sparse_mat_data={},
+                config=variant_config,
+            )
+        except (TypeError, LookupError, AttributeError, ValueError, NotImplementedError) as ex:
+            raise CodeGenerationException(
+                f"Exception printing {variant.lower()} code, see above"
+            ) from ex
+
     @functools.cached_property
     def unused_arguments(self) -> T.List[str]:
         """
@@ -429,6 +503,15 @@ class Codegen:
         """
         return self.print_code_results.total_ops
 
+    def estimated_cycles(self) -> int:
+        """
+        The estimated CPU cycles to evaluate the expression, see CostModel.  Only computed if
+        config.cost_model is set.
+        """
+        if self.print_code_results.estimated_cycles is None:
+            raise ValueError("Estimated cycles are only computed if config.cost_model is set")
+        return round(self.print_code_results.estimated_cycles)
+
     def generate_function(
         self,
         output_dir: T.Openable = None,
@@ -672,6 +755,7 @@ class Codegen:
         linearization_mode: LinearizationMode = LinearizationMode.FULL_LINEARIZATION,
         sparse_linearization: bool = False,
         custom_jacobian: sf.Matrix = None,
+        lower_triangular_hessian: bool = False,
     ) -> Codegen:
         """
         Given a codegen object that takes some number of inputs and computes a single result,
@@ -705,6 +789,15 @@ class Codegen:
                              should have shape (result_dim, input_tangent_dim), where
                              input_tangent_dim is the sum of the tangent dimensions of arguments
                              corresponding to which_args
+            lower_triangular_hessian: For the FULL_LINEARIZATION mode with a dense hessian, only
+                                      write the lower triangle of the hessian.  The strict upper
+                                      triangle of the hessian output is left unmodified, instead of
+                                      being set to zero, so direct callers of the generated
+                                      function which read it must initialize it themselves.  The
+                                      lower triangle is all that Factor::Hessian and the Linearizer
+                                      read, and this saves the stores for the upper triangle.  The
+                                      generated docstring states this contract.  Sparse hessians
+                                      only ever contain the lower triangle.
         """
         if which_args is None:
             which_args = list(self.inputs.keys())
@@ -772,12 +865,17 @@ class Codegen:
 
             hessian = jacobian.compute_AtA(lower_only=True)
             outputs["hessian"] = hessian
-            docstring_lines.extend(
-                self.wrap_docstring_arg_description(
-                    "    hessian: ",
-                    f"({hessian.shape[0]}x{hessian.shape[1]}) Gauss-Newton hessian for {formatted_arg_list}",
-                    self.config,
+            hessian_description = (
+                f"({hessian.shape[0]}x{hessian.shape[1]}) Gauss-Newton hessian for "
+                f"{formatted_arg_list}"
+            )
+            if lower_triangular_hessian and not sparse_linearization:
+                hessian_description += (
+                    ". Only the lower triangle is written, the strict upper triangle is left "
+                    "unmodified, so callers which read it must initialize it"
                 )
+            docstring_lines.extend(
+                self.wrap_docstring_arg_description("    hessian: ", hessian_description, self.config)
             )
 
             rhs = jacobian.T * result
@@ -804,6 +902,11 @@ class Codegen:
             if sparse_linearization
             else None
         )
+        lower_triangular_matrices = (
+            ["hessian"]
+            if lower_triangular_hessian and not sparse_linearization and "hessian" in outputs
+            else None
+        )
         return Codegen(
             name=name,
             inputs=self.inputs,
@@ -811,6 +914,7 @@ class Codegen:
             config=self.config,
             return_key=return_key,
             sparse_matrices=sparse_matrices,
+            lower_triangular_matrices=lower_triangular_matrices,
             docstring="\n".join(docstring_lines),
         )
 
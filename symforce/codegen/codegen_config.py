@@ -11,6 +11,7 @@ from pathlib import Path
 from sympy.printing.codeprinter import CodePrinter
 
 from symforce import typing as T
+from symforce.codegen.cost_model import CostModel
 
 CURRENT_DIR = Path(__file__).parent
 
@@ -59,6 +60,8 @@ class CodegenConfig:
                                 more information
         cse_optimizations: Optimizations argument to pass to sf.cse
         zero_epsilon_behavior: What should codegen do if a default epsilon is not set?
+        cost_model: If set, used to inline cheap temporaries and reorder the rest after CSE, and
+                    the estimated cycles are printed in the generated code, see CostModel
     """
 
     doc_comment_line_prefix: str
@@ -71,6 +74,7 @@ class CodegenConfig:
     zero_epsilon_behavior: ZeroEpsilonBehavior = field(
         default_factory=lambda: DEFAULT_ZERO_EPSILON_BEHAVIOR
     )
+    cost_model: T.Optional[CostModel] = None
 
     @classmethod
     @abstractmethod
@@ -104,6 +108,18 @@ class CodegenConfig:
         """
         pass
 
+    def flattened_variant_config(self, variant: str) -> "CodegenConfig":
+        """
+        Return the config to print the given variant of a function with, for variants whose inputs
+        and outputs are flattened to columns of their storage (e.g. the "Batched" and "Kernel"
+        variants of the C++ backend).
+
+        Raises NotImplementedError if this backend doesn't support the variant.
+        """
+        raise NotImplementedError(
+            f"{variant} functions are not supported by the {self.backend_name()} backend"
+        )
+
     # TODO(hayk): Move this into code printer.
     @staticmethod
     def format_data_accessor(prefix: str, index: int) -> str:
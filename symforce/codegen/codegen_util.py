@@ -24,6 +24,7 @@ from symforce import _sympy_count_ops
 from symforce import ops
 from symforce import typing as T
 from symforce import typing_util
+from symforce.codegen import cache_util
 from symforce.codegen import codegen_config
 from symforce.codegen import format_util
 from symforce.values import IndexEntry
@@ -52,6 +53,8 @@ class PrintCodeResult(T.NamedTuple):
     dense_terms: T.List[OutputWithTerms]
     sparse_terms: T.List[OutputWithTerms]
     total_ops: int
+    # Estimated cycles from config.cost_model, or None if that isn't set
+    estimated_cycles: T.Optional[float]
 
 
 @dataclasses.dataclass
@@ -136,6 +139,7 @@ def print_code(
         T.List[OutputWithTerms]: Collection of lines of code per dense output variable
         T.List[OutputWithTerms]: Collection of lines of code per sparse output variable
         int: Total number of ops
+        float: Estimated cycles, see CostModel, or None if config.cost_model isn't set
     """
     # Split outputs into dense and sparse outputs, since we treat them differently when doing codegen
     dense_outputs = Values()
@@ -151,6 +155,67 @@ def print_code(
         sparse=[ops.StorageOps.to_storage(value) for key, value in sparse_outputs.items()],
     )
 
+    # CSE and printing are most of the time spent generating code, so they're cached on disk if
+    # enabled, see cache_util
+    (
+        intermediate_terms,
+        dense_outputs_code_no_names,
+        sparse_outputs_code_no_names,
+        total_ops,
+        estimated_cycles,
+    ) = cache_util.cached(
+        "print_code",
+        key=(inputs, dense_outputs, sparse_mat_data, config, cse),
+        compute=lambda: _print_terms(
+            inputs=inputs,
+            dense_outputs=dense_outputs,
+            sparse_outputs=sparse_outputs,
+            output_exprs=output_exprs,
+            config=config,
+            cse=cse,
+        ),
+    )
+
+    # Pack names and types with outputs
+    dense_terms = [
+        OutputWithTerms(key, value, output_code_no_name)
+        for output_code_no_name, (key, value) in zip(
+            dense_outputs_code_no_names, dense_outputs.items()
+        )
+    ]
+    sparse_terms = [
+        OutputWithTerms(key, value, sparse_output_code_no_name)
+        for sparse_output_code_no_name, (key, value) in zip(
+            sparse_outputs_code_no_names, sparse_outputs.items()
+        )
+    ]
+
+    return PrintCodeResult(
+        intermediate_terms=intermediate_terms,
+        dense_terms=dense_terms,
+        sparse_terms=sparse_terms,
+        total_ops=total_ops,
+        estimated_cycles=estimated_cycles,
+    )
+
+
+def _print_terms(
+    inputs: Values,
+    dense_outputs: Values,
+    sparse_outputs: Values,
+    output_exprs: DenseAndSparseOutputTerms,
+    config: codegen_config.CodegenConfig,
+    cse: bool,
+) -> T.Tuple[
+    T_terms_printed, T.List[T_terms_printed], T.List[T_terms_printed], int, T.Optional[float]
+]:
+    """
+    Run CSE on output_exprs and print the results, for print_code
+
+    Returns:
+        The printed intermediate terms, printed terms for each dense and sparse output, total ops,
+        and estimated cycles if config.cost_model is set
+    """
     # CSE If needed
     if cse:
         temps, simplified_outputs = perform_cse(
@@ -178,6 +243,13 @@ def print_code(
     dense_outputs_formatted = simpify_nested_lists(dense_outputs_formatted)
     sparse_outputs_formatted = simpify_nested_lists(sparse_outputs_formatted)
 
+    if cse and config.cost_model is not None:
+        temps_formatted, output_terms = config.cost_model.optimize_terms(
+            temps_formatted, dense_outputs_formatted + sparse_outputs_formatted
+        )
+        dense_outputs_formatted = output_terms[: len(dense_outputs_formatted)]
+        sparse_outputs_formatted = output_terms[len(dense_outputs_formatted) :]
+
     def count_ops(expr: T.Any) -> int:
         op_count = _sympy_count_ops.count_ops(expr)
         assert isinstance(op_count, int)
@@ -189,6 +261,12 @@ def print_code(
         + count_ops(sparse_outputs_formatted)
     )
 
+    estimated_cycles = None
+    if config.cost_model is not None:
+        estimated_cycles = config.cost_model.total_cost(
+            temps_formatted, *dense_outputs_formatted, *sparse_outputs_formatted
+        )
+
     # Get printer
     printer = config.printer()
 
@@ -203,25 +281,12 @@ def print_code(
         for single_output_terms in sparse_outputs_formatted
     ]
 
-    # Pack names and types with outputs
-    dense_terms = [
-        OutputWithTerms(key, value, output_code_no_name)
-        for output_code_no_name, (key, value) in zip(
-            dense_outputs_code_no_names, dense_outputs.items()
-        )
-    ]
-    sparse_terms = [
-        OutputWithTerms(key, value, sparse_output_code_no_name)
-        for sparse_output_code_no_name, (key, value) in zip(
-            sparse_outputs_code_no_names, sparse_outputs.items()
-        )
-    ]
-
-    return PrintCodeResult(
-        intermediate_terms=intermediate_terms,
-        dense_terms=dense_terms,
-        sparse_terms=sparse_terms,
-        total_ops=total_ops,
+    return (
+        intermediate_terms,
+        dense_outputs_code_no_names,
+        sparse_outputs_code_no_names,
+        total_ops,
+        estimated_cycles,
     )
 
 
@@ -512,6 +577,29 @@ def _get_scalar_keys_recursive(
     return vec
 
 
+def flatten_to_storage_columns(values: Values, include_scalars: bool = False) -> Values:
+    """
+    Returns a copy of values where every entry that isn't a scalar is replaced with a column
+    matrix of its storage, for backends which lay out every argument as a flat array.
+
+    Args:
+        values: The inputs or outputs of a function
+        include_scalars: Also replace scalars with 1x1 matrices
+
+    Raises:
+        ValueError: If values contains a DataBuffer, which has no storage
+    """
+    flattened = Values()
+    for key, value in values.items():
+        if isinstance(value, sf.DataBuffer):
+            raise ValueError(f"DataBuffer {key} cannot be flattened to its storage")
+        elif isinstance(value, (sf.Expr, sf.Symbol)) and not include_scalars:
+            flattened[key] = value
+        else:
+            flattened[key] = sf.Matrix(ops.StorageOps.to_storage(value))
+    return flattened
+
+
 def get_formatted_sparse_list(sparse_outputs: Values) -> T.List[T.List[sf.Scalar]]:
     """
     Returns a nested list of symbols for use in generated functions for sparse matrices.
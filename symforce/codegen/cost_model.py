@@ -0,0 +1,264 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+"""
+A rough model of what generated code costs to run on a CPU, and the passes over the output of CSE
+that use it.
+"""
+
+from __future__ import annotations
+
+import dataclasses
+import itertools
+
+import sympy
+
+from symforce import typing as T
+
+# Intermediate terms, and the terms of each output, as (lhs, rhs) pairs
+T_terms = T.List[T.Tuple[T.Any, sympy.Expr]]
+T_nested_terms = T.List[T_terms]
+
+# Functions which compile to a single compare, select, or bit operation
+_CHEAP_FUNCTIONS = {"Abs", "Max", "Min", "sign", "Heaviside", "floor", "ceiling"}
+
+
+@dataclasses.dataclass
+class CostModel:
+    """
+    Weights for each kind of operation in generated code, in approximate CPU cycles.
+
+    Unlike count_ops, which counts every operation the same, this tells apart an add from a
+    division or a call to a transcendental function.  The defaults are roughly the latencies of
+    double precision operations on recent x86 and ARM cores, and are only meant to rank different
+    formulations of the same function against each other.
+
+    Powers are costed the way the C++ printer prints them, i.e. small integer powers as multiplies
+    and half-integer powers as square roots.
+
+    Args:
+        add: Cost of an add, subtract or negation
+        mul: Cost of a multiply
+        div: Cost of a division
+        sqrt: Cost of a square root
+        pow: Cost of a call to pow that isn't printed as multiplies or square roots
+        transcendental: Cost of sin, cos, exp, log, atan2, etc, and of any unknown function
+        select: Cost of a comparison, min, max, abs, etc.
+        max_recompute_cycles: Intermediate terms used more than once which cost at most this much
+            in total to recompute at each use are inlined into their uses by `optimize_terms`.
+            Inlining shortens live ranges, which reduces register pressure and spills in large
+            functions.  The default of 0 only inlines terms which cost nothing, which CSE rarely
+            produces, so by default nothing is inlined.  A negation costs `add` even where it
+            would become a subtraction, so set this to at least `add` to inline negations
+        inline_single_use: Whether `optimize_terms` also inlines intermediate terms that are used
+            once.  This changes the generated code the most, so is off by default
+    """
+
+    add: float = 1.0
+    mul: float = 1.0
+    div: float = 8.0
+    sqrt: float = 10.0
+    pow: float = 60.0
+    transcendental: float = 40.0
+    select: float = 1.0
+    max_recompute_cycles: float = 0.0
+    inline_single_use: bool = False
+
+    def cost(self, expr: T.Any) -> float:
+        """
+        Estimated cycles to evaluate expr, which may be a sympy or symengine expression
+        """
+        return self._cost(sympy.S(expr), in_add=False)
+
+    def _cost(self, expr: T.Any, in_add: bool) -> float:
+        if not isinstance(expr, sympy.Basic) or expr.is_Atom or not expr.args:
+            return 0.0
+
+        if isinstance(expr, sympy.Add):
+            return self.add * (len(expr.args) - 1) + sum(
+                self._cost(arg, in_add=True) for arg in expr.args
+            )
+
+        if isinstance(expr, sympy.Mul):
+            numerator: T.List[sympy.Expr] = []
+            denominator: T.List[sympy.Expr] = []
+            cost = 0.0
+            for arg in expr.args:
+                if arg == -1:
+                    # Inside a sum this is a subtraction instead of an add
+                    if not in_add:
+                        cost += self.add
+                elif isinstance(arg, sympy.Pow) and arg.exp.is_Number and arg.exp < 0:
+                    denominator.append(sympy.Pow(arg.base, -arg.exp, evaluate=False))
+                else:
+                    numerator.append(arg)
+            cost += sum(self.cost(arg) for arg in itertools.chain(numerator, denominator))
+            cost += self.mul * (max(len(numerator), 1) - 1)
+            if denominator:
+                cost += self.div + self.mul * (len(denominator) - 1)
+            return cost
+
+        if isinstance(expr, sympy.Pow):
+            return self.cost(expr.base) + self._pow_cost(expr.exp)
+
+        if isinstance(expr, (sympy.Piecewise, sympy.logic.boolalg.Boolean)):
+            return self.select * len(expr.args) + sum(self.cost(arg) for arg in expr.args)
+
+        if isinstance(expr, sympy.Function):
+            name = type(expr).__name__
+            if name in _CHEAP_FUNCTIONS:
+                op_cost = self.select * max(len(expr.args) - 1, 1)
+            else:
+                op_cost = self.transcendental
+            return op_cost + sum(self.cost(arg) for arg in expr.args)
+
+        return sum(self.cost(arg) for arg in expr.args)
+
+    def _pow_cost(self, exp: sympy.Expr) -> float:
+        if not exp.is_Number:
+            return self.pow
+
+        # Negative powers are a division, of the positive power
+        recip = self.div if exp < 0 else 0.0
+        exp = abs(exp)
+        if exp == 1:
+            return recip
+        elif exp.is_Integer and exp <= 4:
+            return recip + self.mul * (int(exp) - 1)
+        elif exp == sympy.S.One / 2:
+            return recip + self.sqrt
+        elif exp == sympy.S(3) / 2:
+            return recip + self.sqrt + self.mul
+        else:
+            return self.pow
+
+    def total_cost(self, *nested_terms: T.Iterable[T.Tuple[T.Any, sympy.Expr]]) -> float:
+        """
+        Total cost of the rhs of every term in any of nested_terms
+        """
+        return sum(self.cost(rhs) for terms in nested_terms for _, rhs in terms)
+
+    def optimize_terms(
+        self, intermediate_terms: T_terms, output_terms: T_nested_terms
+    ) -> T.Tuple[T_terms, T_nested_terms]:
+        """
+        Improve the result of CSE using this cost model:
+
+        1) Inline intermediate terms which cost at most max_recompute_cycles in total to recompute
+           at each use, and if inline_single_use is set, those which are used once
+        2) Reorder the intermediate terms so that each is computed right before it's first needed,
+           in the order the outputs use them, and renumber them in the new order
+
+        Args:
+            intermediate_terms: (symbol, expression) for each temporary, in dependency order, with
+                                symbols named `_tmp{i}`
+            output_terms: Terms for each output, which may use the temporaries
+
+        Returns:
+            The new intermediate terms and output terms
+        """
+        # The passes below walk sympy expressions
+        intermediate_terms = [(sympy.S(lhs), sympy.S(rhs)) for lhs, rhs in intermediate_terms]
+        output_terms = [
+            [(sympy.S(lhs), sympy.S(rhs)) for lhs, rhs in terms] for terms in output_terms
+        ]
+
+        intermediate_terms, output_terms = self._inline_terms(intermediate_terms, output_terms)
+        return _schedule_terms(intermediate_terms, output_terms)
+
+    def _inline_terms(
+        self, intermediate_terms: T_terms, output_terms: T_nested_terms
+    ) -> T.Tuple[T_terms, T_nested_terms]:
+        temps = [lhs for lhs, _ in intermediate_terms]
+        temps_set = set(temps)
+
+        # All expressions, with the temporaries first.  Expressions are indexed into this list
+        exprs = [rhs for _, rhs in intermediate_terms] + [
+            rhs for terms in output_terms for _, rhs in terms
+        ]
+
+        # The expressions that use each temporary
+        users: T.Dict[T.Any, T.Set[int]] = {temp: set() for temp in temps}
+        for i, expr in enumerate(exprs):
+            for symbol in expr.free_symbols & temps_set:
+                users[symbol].add(i)
+
+        inlined = set()
+        for i, temp in enumerate(temps):
+            uses = len(users[temp])
+            if uses == 1 and not self.inline_single_use:
+                continue
+            if uses > 1 and self.cost(exprs[i]) * (uses - 1) > self.max_recompute_cycles:
+                continue
+
+            inlined.add(i)
+            for user in users[temp]:
+                exprs[user] = exprs[user].xreplace({temp: exprs[i]})
+                # The user now also uses everything temp used
+                for symbol in exprs[i].free_symbols & temps_set:
+                    users[symbol].add(user)
+            for symbol in exprs[i].free_symbols & temps_set:
+                users[symbol].discard(i)
+
+        new_intermediate_terms = [
+            (temp, exprs[i]) for i, temp in enumerate(temps) if i not in inlined
+        ]
+
+        new_output_terms = []
+        i = len(temps)
+        for terms in output_terms:
+            new_output_terms.append([(lhs, exprs[i + j]) for j, (lhs, _) in enumerate(terms)])
+            i += len(terms)
+
+        return new_intermediate_terms, new_output_terms
+
+
+def _schedule_terms(
+    intermediate_terms: T_terms, output_terms: T_nested_terms
+) -> T.Tuple[T_terms, T_nested_terms]:
+    """
+    Order intermediate terms depth first from the outputs, see CostModel.optimize_terms
+    """
+    rhs_for_temp = dict(intermediate_terms)
+    original_index = {temp: i for i, (temp, _) in enumerate(intermediate_terms)}
+
+    def sorted_deps(expr: sympy.Expr) -> T.List[T.Any]:
+        return sorted(
+            (s for s in expr.free_symbols if s in rhs_for_temp), key=original_index.__getitem__
+        )
+
+    order: T.List[T.Any] = []
+    visited: T.Set[T.Any] = set()
+
+    def visit(roots: T.List[T.Any]) -> None:
+        # Iterative post-order DFS, since dependency chains can be longer than the recursion limit
+        stack = [(temp, False) for temp in reversed(roots)]
+        while stack:
+            temp, deps_done = stack.pop()
+            if deps_done:
+                order.append(temp)
+                continue
+            if temp in visited:
+                continue
+            visited.add(temp)
+            stack.append((temp, True))
+            stack.extend((dep, False) for dep in reversed(sorted_deps(rhs_for_temp[temp])))
+
+    for terms in output_terms:
+        for _, rhs in terms:
+            visit(sorted_deps(rhs))
+
+    # Temporaries that no output uses are kept, at the end
+    visit([temp for temp, _ in intermediate_terms])
+
+    renames = {temp: sympy.Symbol(f"_tmp{i}") for i, temp in enumerate(order)}
+    new_intermediate_terms = [
+        (renames[temp], rhs_for_temp[temp].xreplace(renames)) for temp in order
+    ]
+    new_output_terms = [
+        [(lhs, rhs.xreplace(renames)) for lhs, rhs in terms] for terms in output_terms
+    ]
+
+    return new_intermediate_terms, new_output_terms
@@ -4,6 +4,7 @@
 # ----------------------------------------------------------------------------
 
 import copy
+import functools
 import os
 from pathlib import Path
 
@@ -11,6 +12,7 @@ import black
 
 from symforce import python_util
 from symforce import typing as T
+from symforce.codegen import cache_util
 
 # TODO(aaron): Put this in a pyproject.toml and fetch from there
 BLACK_FILE_MODE = black.FileMode(line_length=100)
@@ -30,29 +32,65 @@ def format_cpp(file_contents: str, filename: str) -> str:
     Returns:
         formatted_file_contents (str): The contents of the file after formatting
     """
+    clang_format_path = _clang_format_path()
+
+    def run_clang_format() -> str:
+        return python_util.execute_subprocess(
+            [clang_format_path, f"-assume-filename={filename}"],
+            stdin_data=file_contents,
+            log_stdout=False,
+        )
+
+    # Only look up the version and style of clang-format if they're needed for the cache key
+    if cache_util.get_cache_dir() is None:
+        return run_clang_format()
+
+    return cache_util.cached(
+        "format_cpp",
+        key=(
+            _clang_format_version(clang_format_path),
+            _clang_format_style(filename),
+            os.path.basename(filename),
+            file_contents,
+        ),
+        compute=run_clang_format,
+    )
+
+
+def _clang_format_path() -> str:
     try:
         import clang_format  # type: ignore[import]
 
-        clang_format_path = str(
-            Path(clang_format.__file__).parent / "data" / "bin" / "clang-format"
-        )
+        return str(Path(clang_format.__file__).parent / "data" / "bin" / "clang-format")
     except ImportError:
-        clang_format_path = "clang-format"
+        return "clang-format"
 
-    formatted_file_contents = python_util.execute_subprocess(
-        [clang_format_path, f"-assume-filename={filename}"],
-        stdin_data=file_contents,
-        log_stdout=False,
-    )
 
-    return formatted_file_contents
+@functools.lru_cache
+def _clang_format_version(clang_format_path: str) -> str:
+    return python_util.execute_subprocess([clang_format_path, "--version"], log_stdout=False)
+
+
+def _clang_format_style(filename: str) -> str:
+    """
+    Contents of the .clang-format file clang-format would use for filename, or "" if none exists
+    """
+    for directory in Path(filename).absolute().parents:
+        style_file = directory / ".clang-format"
+        if style_file.is_file():
+            return style_file.read_text()
+    return ""
 
 
 def format_py(file_contents: str) -> str:
     """
     Autoformat a given Python file using black
     """
-    return black.format_str(file_contents, mode=BLACK_FILE_MODE)
+    return cache_util.cached(
+        "format_py",
+        key=(black.__version__, str(BLACK_FILE_MODE), file_contents),
+        compute=lambda: black.format_str(file_contents, mode=BLACK_FILE_MODE),
+    )
 
 
 def format_pyi(file_contents: str) -> str:
@@ -61,7 +99,11 @@ def format_pyi(file_contents: str) -> str:
     """
     mode = copy.copy(BLACK_FILE_MODE)
     mode.is_pyi = True
-    return black.format_str(file_contents, mode=mode)
+    return cache_util.cached(
+        "format_py",
+        key=(black.__version__, str(mode), file_contents),
+        compute=lambda: black.format_str(file_contents, mode=mode),
+    )
 
 
 def format_py_dir(dirname: T.Openable) -> None:
@@ -7,6 +7,7 @@ from pathlib import Path
 
 import symforce.symbolic as sf
 from symforce import ops
+from symforce import python_util
 from symforce import typing as T
 from symforce.codegen import Codegen
 from symforce.codegen import CppConfig
@@ -85,9 +86,10 @@ def prior_factor(
 
 def generate_between_factors(types: T.Sequence[T.Type], output_dir: T.Openable) -> None:
     """
-    Generates between factors for each type in types into output_dir.
+    Generates between factors for each type in types into output_dir, in parallel across types.
     """
-    for cls in types:
+
+    def generate_for_type(cls: T.Type) -> None:
         tangent_dim = ops.LieGroupOps.tangent_dim(cls)
         between_codegen = Codegen.function(
             func=between_factor,
@@ -95,7 +97,11 @@ def generate_between_factors(types: T.Sequence[T.Type], output_dir: T.Openable)
             output_names=["res"],
             config=CppConfig(),
             docstring=get_between_factor_docstring("a_T_b"),
-        ).with_linearization(name=f"between_factor_{cls.__name__.lower()}", which_args=["a", "b"])
+        ).with_linearization(
+            name=f"between_factor_{cls.__name__.lower()}",
+            which_args=["a", "b"],
+            lower_triangular_hessian=True,
+        )
         between_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
         prior_codegen = Codegen.function(
@@ -104,9 +110,15 @@ def generate_between_factors(types: T.Sequence[T.Type], output_dir: T.Openable)
             output_names=["res"],
             config=CppConfig(),
             docstring=get_prior_docstring(),
-        ).with_linearization(name=f"prior_factor_{cls.__name__.lower()}", which_args=["value"])
+        ).with_linearization(
+            name=f"prior_factor_{cls.__name__.lower()}",
+            which_args=["value"],
+            lower_triangular_hessian=True,
+        )
         prior_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
+    python_util.parallel_map(generate_for_type, types)
+
 
 def generate_pose3_extra_factors(output_dir: T.Openable) -> None:
     """
@@ -178,7 +190,11 @@ def generate_pose3_extra_factors(output_dir: T.Openable) -> None:
         output_names=["res"],
         config=CppConfig(),
         docstring=get_between_factor_docstring("a_R_b"),
-    ).with_linearization(name="between_factor_pose3_rotation", which_args=["a", "b"])
+    ).with_linearization(
+        name="between_factor_pose3_rotation",
+        which_args=["a", "b"],
+        lower_triangular_hessian=True,
+    )
     between_rotation_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
     between_position_codegen = Codegen.function(
@@ -186,12 +202,20 @@ def generate_pose3_extra_factors(output_dir: T.Openable) -> None:
         output_names=["res"],
         config=CppConfig(),
         docstring=get_between_factor_docstring("a_t_b"),
-    ).with_linearization(name="between_factor_pose3_position", which_args=["a", "b"])
+    ).with_linearization(
+        name="between_factor_pose3_position",
+        which_args=["a", "b"],
+        lower_triangular_hessian=True,
+    )
     between_position_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
     between_translation_norm_codegen = Codegen.function(
         func=between_factor_pose3_translation_norm, output_names=["res"], config=CppConfig()
-    ).with_linearization(name="between_factor_pose3_translation_norm", which_args=["a", "b"])
+    ).with_linearization(
+        name="between_factor_pose3_translation_norm",
+        which_args=["a", "b"],
+        lower_triangular_hessian=True,
+    )
     between_translation_norm_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
     prior_rotation_codegen = Codegen.function(
@@ -199,7 +223,11 @@ def generate_pose3_extra_factors(output_dir: T.Openable) -> None:
         output_names=["res"],
         config=CppConfig(),
         docstring=get_prior_docstring(),
-    ).with_linearization(name="prior_factor_pose3_rotation", which_args=["value"])
+    ).with_linearization(
+        name="prior_factor_pose3_rotation",
+        which_args=["value"],
+        lower_triangular_hessian=True,
+    )
     prior_rotation_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
     prior_position_codegen = Codegen.function(
@@ -207,7 +235,11 @@ def generate_pose3_extra_factors(output_dir: T.Openable) -> None:
         output_names=["res"],
         config=CppConfig(),
         docstring=get_prior_docstring(),
-    ).with_linearization(name="prior_factor_pose3_position", which_args=["value"])
+    ).with_linearization(
+        name="prior_factor_pose3_position",
+        which_args=["value"],
+        lower_triangular_hessian=True,
+    )
     prior_position_codegen.generate_function(output_dir, skip_directory_nesting=True)
 
 
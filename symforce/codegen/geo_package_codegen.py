@@ -20,12 +20,16 @@ from symforce.codegen import PythonConfig
 from symforce.codegen import codegen_util
 from symforce.codegen import lcm_types_codegen
 from symforce.codegen import template_util
+from symforce.codegen.ops_codegen_util import make_batch_ops_funcs
 from symforce.codegen.ops_codegen_util import make_group_ops_funcs
 from symforce.codegen.ops_codegen_util import make_lie_group_ops_funcs
 
 # Default geo types to generate
 DEFAULT_GEO_TYPES = (sf.Rot2, sf.Pose2, sf.Rot3, sf.Pose3, sf.Unit3)
 
+# Geo types to generate C++ BatchOps for, and the type of the points they transform
+BATCH_OPS_POINT_TYPES = {sf.Rot2: sf.V2, sf.Pose2: sf.V2, sf.Rot3: sf.V3, sf.Pose3: sf.V3}
+
 
 def geo_class_common_data(cls: T.Type, config: CodegenConfig) -> T.Dict[str, T.Any]:
     """
@@ -286,6 +290,17 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
                     template_path, data, config.render_template_config, output_path=output_path
                 )
 
+            if cls in BATCH_OPS_POINT_TYPES:
+                data["specs"]["BatchOps"] = make_batch_ops_funcs(
+                    cls, BATCH_OPS_POINT_TYPES[cls], config
+                )
+                templates.add(
+                    Path("ops", "CLASS", "batch_ops.h.jinja"),
+                    data,
+                    config.render_template_config,
+                    output_path=package_dir / "ops" / cls.__name__.lower() / "batch_ops.h",
+                )
+
         # Render non geo type specific templates
         for template_name in python_util.files_in_dir(
             template_dir / "geo_package" / "ops", relative=True
@@ -337,7 +352,8 @@ def generate(config: CodegenConfig, output_dir: Path = None) -> Path:
         output_path=package_dir / ".." / "lcmtypes" / "lcmtypes" / "symforce_types.lcm",
     )
 
-    templates.render()
+    # Printing the functions in each template is most of the work, so render them in parallel
+    templates.render(num_processes=None)
 
     # Codegen for LCM type_t
     codegen_util.generate_lcm_types(
@@ -0,0 +1,178 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+"""
+JIT compilation of linearization functions, for evaluating candidate residuals from C++ without
+generating code and rebuilding C++.
+
+Functions are only compiled to machine code if symengine was built with LLVM, which is off by
+default (see the SYMFORCE_SYMENGINE_WITH_LLVM CMake option).  Otherwise they are interpreted by
+symengine's LambdaDouble, which still avoids calling into Python but is much slower than compiled
+code.
+"""
+
+from __future__ import annotations
+
+import ctypes
+
+import numpy as np
+
+import symforce
+import symforce.symbolic as sf
+from symforce import typing as T
+from symforce.codegen.codegen import Codegen
+from symforce.ops import StorageOps
+
+if T.TYPE_CHECKING:
+    from symforce import cc_sym
+
+
+class JitLinearization:
+    """
+    A linearization function compiled from a Codegen object, which computes the residual, jacobian,
+    Gauss-Newton hessian and rhs of the single output of the Codegen with respect to some of its
+    inputs.
+
+    With the symengine symbolic API, this is compiled with LLVM if symengine was built with LLVM,
+    and otherwise interpreted by symengine's LambdaDouble, whose calls are also serialized since it
+    isn't thread safe; either way it can be called from C++ as the linearization function of a
+    cc_sym.Factor, without going through Python.  The backend used is stored in ``backend``.  With
+    the sympy API it falls back to sympy.lambdify, and the cc_sym.Factor calls into Python.
+
+    Example:
+
+        >>> def residual(x: sf.Pose3, y: sf.Pose3, epsilon: sf.Scalar) -> sf.V6:
+        ...     return sf.V6(x.local_coordinates(y, epsilon=epsilon))
+        >>> linearization = JitLinearization(
+        ...     Codegen.function(residual, config=PythonConfig()), which_args=["x"]
+        ... )
+        >>> factor = linearization.cc_factor([cc_sym.Key("x"), cc_sym.Key("y"), cc_sym.Key("e")])
+
+    Args:
+        codegen: A Codegen object with a single output, the residual, which must be a column
+                 vector
+        which_args: Names of the inputs to compute the linearization with respect to.  If not
+                    given, uses all.
+        cse: Whether to eliminate common subexpressions before compiling
+    """
+
+    def __init__(
+        self, codegen: Codegen, which_args: T.Sequence[str] = None, cse: bool = True
+    ) -> None:
+        if which_args is None:
+            which_args = list(codegen.inputs.keys())
+        linearization = codegen.with_linearization(which_args=which_args)
+        self.optimized_args = list(which_args)
+
+        self.name = linearization.name
+        self.input_names = list(codegen.inputs.keys())
+
+        residual, jacobian, hessian, rhs = linearization.outputs.values()
+        self.residual_dim = residual.shape[0]
+        self.tangent_dim = jacobian.shape[1]
+
+        self.input_symbols = linearization.inputs.to_storage()
+        for s in self.input_symbols:
+            if not isinstance(s, sf.Symbol):
+                raise ValueError(f"Inputs must be made of symbols, got {s}")
+
+        # The layout expected by cc_sym.Factor.native
+        outputs = (
+            residual.to_storage()
+            + jacobian.to_storage()
+            + [hessian[row, col] for col in range(hessian.cols) for row in range(col, hessian.rows)]
+            + rhs.to_storage()
+        )
+        outputs = [sf.S(output) for output in outputs]
+
+        self.backend: T.Optional[str] = None
+        if symforce.get_symbolic_api() == "symengine":
+            self.backend = "llvm" if sf.sympy.have_llvm else "lambda"
+            self._lambdified = sf.sympy.Lambdify(
+                self.input_symbols, outputs, backend=self.backend, cse=cse
+            )
+            self._evaluate_flat = lambda inputs: np.asarray(self._lambdified(inputs)).ravel()
+        else:
+            self._lambdified = sf.sympy.lambdify(
+                self.input_symbols, outputs, modules="numpy", cse=cse
+            )
+            self._evaluate_flat = lambda inputs: np.array(
+                self._lambdified(*inputs), dtype=np.float64
+            )
+
+    def is_native(self) -> bool:
+        """
+        Whether the compiled function can be called from C++ without going through Python
+        """
+        return self.backend is not None
+
+    def _unflatten(
+        self, output: np.ndarray
+    ) -> T.Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+        """
+        Split the flat output of the compiled function into the residual, jacobian, hessian and rhs
+        """
+        M, N = self.residual_dim, self.tangent_dim
+        residual = output[:M]
+        jacobian = output[M : M + M * N].reshape(N, M).T
+        # The hessian is stored as its lower triangle in column-major order, which is the upper
+        # triangle of its transpose in row-major order
+        hessian_upper = np.zeros((N, N))
+        hessian_upper[np.triu_indices(N)] = output[M + M * N : M + M * N + N * (N + 1) // 2]
+        hessian = hessian_upper.T + np.triu(hessian_upper, 1)
+        rhs = output[M + M * N + N * (N + 1) // 2 :]
+        return residual, jacobian, hessian, rhs
+
+    def __call__(self, *args: T.Any) -> T.Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+        """
+        Evaluate the linearization at numerical values of each input of the Codegen, e.g. floats,
+        numpy arrays, or sym geo types
+
+        Returns:
+            The residual, jacobian, hessian and rhs, like the generated linearization function
+        """
+        if len(args) != len(self.input_names):
+            raise ValueError(f"Expected {len(self.input_names)} inputs, got {len(args)}")
+
+        flat_inputs = [x for arg in args for x in StorageOps.to_storage(arg)]
+        return self._unflatten(self._evaluate_flat(np.array(flat_inputs, dtype=np.float64)))
+
+    def cc_factor(self, keys: T.Sequence[cc_sym.Key]) -> cc_sym.Factor:
+        """
+        Create a C++ Factor which calls this linearization function
+
+        Args:
+            keys: The key for each input of the Codegen, in order
+
+        Returns:
+            A C++ wrapped Factor object
+        """
+        from symforce import cc_sym  # pylint: disable=import-outside-toplevel
+
+        if len(keys) != len(self.input_names):
+            raise ValueError(f"Expected {len(self.input_names)} keys, got {len(keys)}")
+        key_map = dict(zip(self.input_names, keys))
+        optimized_keys = [key_map[name] for name in self.optimized_args]
+
+        if self.is_native():
+            function, user_data = self._lambdified.as_ctypes()
+            return cc_sym.Factor.native(
+                func_address=ctypes.cast(function, ctypes.c_void_p).value,
+                user_data=user_data.value,
+                owner=self._lambdified,
+                keys_to_func=list(keys),
+                keys_to_optimize=optimized_keys,
+                input_dim=len(self.input_symbols),
+                residual_dim=self.residual_dim,
+                tangent_dim=self.tangent_dim,
+                thread_safe=self.backend == "llvm",
+            )
+
+        def wrapped(
+            values: cc_sym.Values, index_entries: T.Sequence[cc_sym.index_entry_t]
+        ) -> T.Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+            return self(*[values.at(entry) for entry in index_entries])
+
+        return cc_sym.Factor(wrapped, list(keys), optimized_keys)
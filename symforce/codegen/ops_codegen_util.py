@@ -3,11 +3,14 @@
 # This source code is under the Apache 2.0 license found in the LICENSE file.
 # ----------------------------------------------------------------------------
 
+import dataclasses
+
 import symforce.symbolic as sf
 from symforce import ops
 from symforce import typing as T
 from symforce.codegen import Codegen
 from symforce.codegen import CodegenConfig
+from symforce.codegen import CppConfig
 
 
 def make_group_ops_funcs(cls: T.Type, config: CodegenConfig) -> T.List[Codegen]:
@@ -83,3 +86,64 @@ def make_lie_group_ops_funcs(cls: T.Type, config: CodegenConfig) -> T.List[Codeg
             docstring=ops.LieGroupOps.interpolate.__doc__,
         ),
     ]
+
+
+def make_batch_ops_funcs(cls: T.Type, point_type: T.Type, config: CppConfig) -> T.List[Codegen]:
+    """
+    Create func spec arguments for batch ops on the given class, which are printed as kernels over
+    structure-of-arrays storage.  point_type is the type of the points the class acts on.
+    """
+    config = dataclasses.replace(config, generate_kernel=True)
+    uniform_epsilon_config = dataclasses.replace(config, kernel_uniform_args=["epsilon"])
+    tangent_vec = sf.M(list(range(ops.LieGroupOps.tangent_dim(cls))))
+
+    def transform_points(a: T.Any, point: T.Any) -> T.Any:
+        return a * point
+
+    def inverse_transform_points(a: T.Any, point: T.Any) -> T.Any:
+        return a.inverse() * point
+
+    return [
+        Codegen.function(
+            func=ops.GroupOps.inverse,
+            input_types=[cls],
+            config=config,
+            docstring="Inverse of each element a.",
+        ),
+        Codegen.function(
+            func=ops.GroupOps.compose,
+            input_types=[cls, cls],
+            config=config,
+            docstring="Composition of each pair of elements a and b, i.e. a * b.",
+        ),
+        Codegen.function(
+            func=ops.GroupOps.between,
+            input_types=[cls, cls],
+            config=config,
+            docstring="The element between each pair of elements a and b, i.e. a.inverse() * b.",
+        ),
+        Codegen.function(
+            func=ops.LieGroupOps.retract,
+            input_types=[cls, tangent_vec, sf.Symbol],
+            config=uniform_epsilon_config,
+            docstring="Applies each tangent space perturbation vec to each element a.",
+        ),
+        Codegen.function(
+            func=ops.LieGroupOps.local_coordinates,
+            input_types=[cls, cls, sf.Symbol],
+            config=uniform_epsilon_config,
+            docstring="The tangent space vector of each element b in the local coordinates of a.",
+        ),
+        Codegen.function(
+            func=transform_points,
+            input_types=[cls, point_type],
+            config=config,
+            docstring="Each point transformed by each element a, i.e. a * point.",
+        ),
+        Codegen.function(
+            func=inverse_transform_points,
+            input_types=[cls, point_type],
+            config=config,
+            docstring="Each point transformed by the inverse of each element a.",
+        ),
+    ]
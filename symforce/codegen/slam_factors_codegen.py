@@ -306,11 +306,11 @@ def generate(output_dir: Path, config: codegen.CodegenConfig = None) -> None:
 
     codegen.Codegen.function(
         func=inverse_range_landmark_prior_residual, config=config
-    ).with_linearization(which_args=["landmark_inverse_range"]).generate_function(
-        output_dir=factors_dir, skip_directory_nesting=True
-    )
+    ).with_linearization(
+        which_args=["landmark_inverse_range"], lower_triangular_hessian=True
+    ).generate_function(output_dir=factors_dir, skip_directory_nesting=True)
 
-    for cam_type in cam_types:
+    def generate_camera_factors(cam_type: T.Type) -> None:
         cam_type_name = python_util.camelcase_to_snakecase(
             python_util.str_removesuffix(cam_type.__name__, "CameraCal")
         )
@@ -336,7 +336,8 @@ def generate(output_dir: Path, config: codegen.CodegenConfig = None) -> None:
                     sf.Scalar,
                 ],
             ).with_linearization(
-                which_args=["source_pose", "target_pose", "source_inverse_range"]
+                which_args=["source_pose", "target_pose", "source_inverse_range"],
+                lower_triangular_hessian=True,
             ).generate_function(
                 output_dir=factors_dir, skip_directory_nesting=True
             )
@@ -380,7 +381,8 @@ def generate(output_dir: Path, config: codegen.CodegenConfig = None) -> None:
                     sf.Scalar,
                 ],
             ).with_linearization(
-                which_args=["source_pose", "target_pose", "source_inverse_range"]
+                which_args=["source_pose", "target_pose", "source_inverse_range"],
+                lower_triangular_hessian=True,
             ).generate_function(
                 output_dir=factors_dir, skip_directory_nesting=True
             )
@@ -400,3 +402,6 @@ def generate(output_dir: Path, config: codegen.CodegenConfig = None) -> None:
                 ],
                 output_names=["reprojection_delta", "is_valid"],
             ).generate_function(output_dir=factors_dir, skip_directory_nesting=True)
+
+    # The factors for each camera model are independent, so generate them in parallel
+    python_util.parallel_map(generate_camera_factors, cam_types)
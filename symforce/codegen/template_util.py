@@ -16,6 +16,7 @@ import jinja2
 import jinja2.ext
 
 from symforce import logger
+from symforce import python_util
 from symforce import typing as T
 from symforce.codegen import format_util
 from symforce.codegen.codegen_config import RenderTemplateConfig
@@ -196,9 +197,8 @@ def render_template(
         )
 
     if output_path:
-        directory = os.path.dirname(output_path)
-        if not os.path.exists(directory):
-            os.makedirs(directory)
+        # exist_ok, since other processes may be rendering into the same directory
+        os.makedirs(os.path.dirname(output_path), exist_ok=True)
 
         with open(output_path, "w") as f:
             f.write(rendered_str)
@@ -250,16 +250,24 @@ class TemplateList:
             )
         )
 
-    def render(self) -> T.List[str]:
-        rendered_templates = []
-        for entry in self.items:
-            rendered_templates.append(
-                render_template(
-                    template_path=entry.template_path,
-                    data=entry.data,
-                    config=entry.config,
-                    template_dir=entry.template_dir,
-                    output_path=entry.output_path,
-                )
+    def render(self, num_processes: T.Optional[int] = 1) -> T.List[str]:
+        """
+        Render all templates, returning the rendered strings
+
+        Args:
+            num_processes: Number of processes to render templates in, see
+                           python_util.parallel_map.  Templates are independent, so this is useful
+                           when printing the functions in each template is expensive.  None uses
+                           the default number of processes
+        """
+
+        def render_entry(entry: TemplateList.TemplateListEntry) -> str:
+            return render_template(
+                template_path=entry.template_path,
+                data=entry.data,
+                config=entry.config,
+                template_dir=entry.template_dir,
+                output_path=entry.output_path,
             )
-        return rendered_templates
+
+        return python_util.parallel_map(render_entry, self.items, num_processes=num_processes)
@@ -166,8 +166,8 @@ void Linearization(
   const Scalar _tmp2 = 2 * _views_0_pose[0];
   const Scalar _tmp3 = _tmp2 * _views_0_pose[1];
   const Scalar _tmp4 = -_tmp1 + _tmp3;
-  const Scalar _tmp5 = -2 * std::pow(_views_0_pose[0], Scalar(2));
-  const Scalar _tmp6 = 1 - 2 * std::pow(_views_0_pose[2], Scalar(2));
+  const Scalar _tmp5 = -2 * (_views_0_pose[0] * _views_0_pose[0]);
+  const Scalar _tmp6 = 1 - 2 * (_views_0_pose[2] * _views_0_pose[2]);
   const Scalar _tmp7 = _tmp5 + _tmp6;
   const Scalar _tmp8 = 2 * _views_0_pose[1] * _views_0_pose[2];
   const Scalar _tmp9 = _tmp2 * _views_0_pose[3];
@@ -210,10 +210,10 @@ void Linearization(
   const Scalar _tmp41 = -epsilon;
   const Scalar _tmp42 = _tmp41 + 1;
   const Scalar _tmp43 = std::min<Scalar>(_tmp42, std::fabs(_tmp38));
-  const Scalar _tmp44 = std::acos(_tmp43) / std::sqrt(Scalar(1 - std::pow(_tmp43, Scalar(2))));
+  const Scalar _tmp44 = std::acos(_tmp43) / std::sqrt(Scalar(1 - (_tmp43 * _tmp43)));
   const Scalar _tmp45 = _tmp40 * _tmp44;
   const Scalar _tmp46 = _tmp32 * _tmp45;
-  const Scalar _tmp47 = -2 * std::pow(_views_0_pose[1], Scalar(2));
+  const Scalar _tmp47 = -2 * (_views_0_pose[1] * _views_0_pose[1]);
   const Scalar _tmp48 = _tmp47 + _tmp5 + 1;
   const Scalar _tmp49 = _tmp2 * _views_0_pose[2];
   const Scalar _tmp50 = _tmp0 * _views_0_pose[1];
@@ -259,10 +259,10 @@ void Linearization(
   const Scalar _tmp70 = _tmp11 * priors_0_1_sqrt_info(5, 4) + _tmp46 * priors_0_1_sqrt_info(5, 1) +
                         _tmp53 * priors_0_1_sqrt_info(5, 5) + _tmp56 * priors_0_1_sqrt_info(5, 0) +
                         _tmp58 * priors_0_1_sqrt_info(5, 2) + _tmp62 * priors_0_1_sqrt_info(5, 3);
-  const Scalar _tmp71 = std::pow(_views_1_pose[2], Scalar(2));
+  const Scalar _tmp71 = (_views_1_pose[2] * _views_1_pose[2]);
   const Scalar _tmp72 = 2 * _tmp71;
   const Scalar _tmp73 = -_tmp72;
-  const Scalar _tmp74 = std::pow(_views_1_pose[1], Scalar(2));
+  const Scalar _tmp74 = (_views_1_pose[1] * _views_1_pose[1]);
   const Scalar _tmp75 = 2 * _tmp74;
   const Scalar _tmp76 = -_tmp75;
   const Scalar _tmp77 = _tmp73 + _tmp76 + 1;
@@ -280,7 +280,7 @@ void Linearization(
   const Scalar _tmp89 = _tmp83 * _views_0_pose[6] + _tmp87 * _views_0_pose[5];
   const Scalar _tmp90 = -_priors_1_0_target_T_src[4] + _tmp77 * _views_0_pose[4] -
                         _tmp77 * _views_1_pose[4] - _tmp84 - _tmp88 + _tmp89;
-  const Scalar _tmp91 = std::pow(_views_1_pose[0], Scalar(2));
+  const Scalar _tmp91 = (_views_1_pose[0] * _views_1_pose[0]);
   const Scalar _tmp92 = 2 * _tmp91;
   const Scalar _tmp93 = 1 - _tmp92;
   const Scalar _tmp94 = _tmp73 + _tmp93;
@@ -318,7 +318,7 @@ void Linearization(
       -_priors_1_0_target_T_src[0] * _tmp115 + _priors_1_0_target_T_src[1] * _tmp117 -
       _priors_1_0_target_T_src[2] * _tmp16 + _priors_1_0_target_T_src[3] * _tmp113;
   const Scalar _tmp124 = std::min<Scalar>(_tmp42, std::fabs(_tmp120));
-  const Scalar _tmp125 = std::acos(_tmp124) / std::sqrt(Scalar(1 - std::pow(_tmp124, Scalar(2))));
+  const Scalar _tmp125 = std::acos(_tmp124) / std::sqrt(Scalar(1 - (_tmp124 * _tmp124)));
   const Scalar _tmp126 = _tmp123 * _tmp125;
   const Scalar _tmp127 = _tmp122 * _tmp126;
   const Scalar _tmp128 =
@@ -361,14 +361,14 @@ void Linearization(
   const Scalar _tmp143 = _tmp142 * _tmp4;
   const Scalar _tmp144 = -views_0_calibration(2, 0);
   const Scalar _tmp145 = _tmp144 + matches_0_0_source_coords(0, 0);
-  const Scalar _tmp146 = std::pow(views_0_calibration(0, 0), Scalar(-2));
+  const Scalar _tmp146 = Scalar(1.0) / (views_0_calibration(0, 0) * views_0_calibration(0, 0));
   const Scalar _tmp147 = -views_0_calibration(3, 0);
   const Scalar _tmp148 = _tmp147 + matches_0_0_source_coords(1, 0);
-  const Scalar _tmp149 = std::pow(views_0_calibration(1, 0), Scalar(-2));
+  const Scalar _tmp149 = Scalar(1.0) / (views_0_calibration(1, 0) * views_0_calibration(1, 0));
   const Scalar _tmp150 = epsilon + 1;
-  const Scalar _tmp151 = std::pow(Scalar(std::pow(_tmp145, Scalar(2)) * _tmp146 +
-                                         std::pow(_tmp148, Scalar(2)) * _tmp149 + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp151 =
+      Scalar(1.0) /
+      std::sqrt(Scalar((_tmp145 * _tmp145) * _tmp146 + (_tmp148 * _tmp148) * _tmp149 + _tmp150));
   const Scalar _tmp152 = _tmp148 * _tmp151;
   const Scalar _tmp153 = _views_0_pose[4] - _views_1_pose[4];
   const Scalar _tmp154 = Scalar(1.0) / (views_0_calibration(0, 0));
@@ -400,10 +400,11 @@ void Linearization(
   const Scalar _tmp176 = _tmp171 * views_1_calibration(1, 0);
   const Scalar _tmp177 =
       _tmp175 * _tmp176 - matches_0_0_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp178 = std::pow(_tmp173, Scalar(2)) + std::pow(_tmp177, Scalar(2)) + epsilon;
-  const Scalar _tmp179 = std::pow(_tmp178, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp178 = (_tmp173 * _tmp173) + (_tmp177 * _tmp177) + epsilon;
+  const Scalar _tmp179 = Scalar(1.0) / std::sqrt(_tmp178);
   const Scalar _tmp180 = std::sqrt(matches_0_0_weight);
-  const Scalar _tmp181 = std::pow(costs_reprojection_error_gnc_scale, Scalar(-2));
+  const Scalar _tmp181 =
+      Scalar(1.0) / (costs_reprojection_error_gnc_scale * costs_reprojection_error_gnc_scale);
   const Scalar _tmp182 = Scalar(1.0) / (_tmp150 - costs_reprojection_error_gnc_mu);
   const Scalar _tmp183 = epsilon + std::fabs(_tmp182);
   const Scalar _tmp184 = _tmp181 / _tmp183;
@@ -421,9 +422,9 @@ void Linearization(
   const Scalar _tmp195 = _tmp177 * _tmp193;
   const Scalar _tmp196 = _tmp144 + matches_0_1_source_coords(0, 0);
   const Scalar _tmp197 = _tmp147 + matches_0_1_source_coords(1, 0);
-  const Scalar _tmp198 = std::pow(Scalar(_tmp146 * std::pow(_tmp196, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp197, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp198 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp196 * _tmp196) + _tmp149 * (_tmp197 * _tmp197) + _tmp150));
   const Scalar _tmp199 = _tmp197 * _tmp198;
   const Scalar _tmp200 = _tmp196 * _tmp198;
   const Scalar _tmp201 =
@@ -446,8 +447,8 @@ void Linearization(
   const Scalar _tmp214 = _tmp209 * views_1_calibration(1, 0);
   const Scalar _tmp215 =
       _tmp213 * _tmp214 - matches_0_1_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp216 = std::pow(_tmp211, Scalar(2)) + std::pow(_tmp215, Scalar(2)) + epsilon;
-  const Scalar _tmp217 = std::pow(_tmp216, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp216 = (_tmp211 * _tmp211) + (_tmp215 * _tmp215) + epsilon;
+  const Scalar _tmp217 = Scalar(1.0) / std::sqrt(_tmp216);
   const Scalar _tmp218 = _tmp184 * _tmp216 + 1;
   const Scalar _tmp219 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp218, _tmp188) - 1)));
   const Scalar _tmp220 = std::sqrt(matches_0_1_weight);
@@ -458,9 +459,9 @@ void Linearization(
   const Scalar _tmp225 = _tmp215 * _tmp223;
   const Scalar _tmp226 = _tmp147 + matches_0_2_source_coords(1, 0);
   const Scalar _tmp227 = _tmp144 + matches_0_2_source_coords(0, 0);
-  const Scalar _tmp228 = std::pow(Scalar(_tmp146 * std::pow(_tmp227, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp226, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp228 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp227 * _tmp227) + _tmp149 * (_tmp226 * _tmp226) + _tmp150));
   const Scalar _tmp229 = _tmp226 * _tmp228;
   const Scalar _tmp230 = _tmp227 * _tmp228;
   const Scalar _tmp231 =
@@ -483,8 +484,8 @@ void Linearization(
   const Scalar _tmp244 = _tmp239 * views_1_calibration(1, 0);
   const Scalar _tmp245 =
       _tmp243 * _tmp244 - matches_0_2_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp246 = std::pow(_tmp241, Scalar(2)) + std::pow(_tmp245, Scalar(2)) + epsilon;
-  const Scalar _tmp247 = std::pow(_tmp246, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp246 = (_tmp241 * _tmp241) + (_tmp245 * _tmp245) + epsilon;
+  const Scalar _tmp247 = Scalar(1.0) / std::sqrt(_tmp246);
   const Scalar _tmp248 = std::max<Scalar>(0, (((_tmp237) > 0) - ((_tmp237) < 0)));
   const Scalar _tmp249 = std::sqrt(matches_0_2_weight);
   const Scalar _tmp250 = _tmp184 * _tmp246 + 1;
@@ -495,9 +496,9 @@ void Linearization(
   const Scalar _tmp255 = _tmp245 * _tmp253;
   const Scalar _tmp256 = _tmp144 + matches_0_3_source_coords(0, 0);
   const Scalar _tmp257 = _tmp147 + matches_0_3_source_coords(1, 0);
-  const Scalar _tmp258 = std::pow(Scalar(_tmp146 * std::pow(_tmp256, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp257, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp258 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp256 * _tmp256) + _tmp149 * (_tmp257 * _tmp257) + _tmp150));
   const Scalar _tmp259 = _tmp257 * _tmp258;
   const Scalar _tmp260 = _tmp256 * _tmp258;
   const Scalar _tmp261 =
@@ -520,8 +521,8 @@ void Linearization(
   const Scalar _tmp274 = _tmp269 * views_1_calibration(1, 0);
   const Scalar _tmp275 =
       _tmp273 * _tmp274 - matches_0_3_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp276 = std::pow(_tmp271, Scalar(2)) + std::pow(_tmp275, Scalar(2)) + epsilon;
-  const Scalar _tmp277 = std::pow(_tmp276, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp276 = (_tmp271 * _tmp271) + (_tmp275 * _tmp275) + epsilon;
+  const Scalar _tmp277 = Scalar(1.0) / std::sqrt(_tmp276);
   const Scalar _tmp278 = std::sqrt(matches_0_3_weight);
   const Scalar _tmp279 = _tmp184 * _tmp276 + 1;
   const Scalar _tmp280 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp279, _tmp188) - 1)));
@@ -532,9 +533,9 @@ void Linearization(
   const Scalar _tmp285 = _tmp275 * _tmp283;
   const Scalar _tmp286 = _tmp147 + matches_0_4_source_coords(1, 0);
   const Scalar _tmp287 = _tmp144 + matches_0_4_source_coords(0, 0);
-  const Scalar _tmp288 = std::pow(Scalar(_tmp146 * std::pow(_tmp287, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp286, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp288 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp287 * _tmp287) + _tmp149 * (_tmp286 * _tmp286) + _tmp150));
   const Scalar _tmp289 = _tmp286 * _tmp288;
   const Scalar _tmp290 = _tmp287 * _tmp288;
   const Scalar _tmp291 =
@@ -557,8 +558,8 @@ void Linearization(
   const Scalar _tmp304 = _tmp299 * views_1_calibration(1, 0);
   const Scalar _tmp305 =
       _tmp303 * _tmp304 - matches_0_4_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp306 = std::pow(_tmp301, Scalar(2)) + std::pow(_tmp305, Scalar(2)) + epsilon;
-  const Scalar _tmp307 = std::pow(_tmp306, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp306 = (_tmp301 * _tmp301) + (_tmp305 * _tmp305) + epsilon;
+  const Scalar _tmp307 = Scalar(1.0) / std::sqrt(_tmp306);
   const Scalar _tmp308 = std::sqrt(matches_0_4_weight);
   const Scalar _tmp309 = std::max<Scalar>(0, (((_tmp297) > 0) - ((_tmp297) < 0)));
   const Scalar _tmp310 = _tmp184 * _tmp306 + 1;
@@ -569,9 +570,9 @@ void Linearization(
   const Scalar _tmp315 = _tmp305 * _tmp313;
   const Scalar _tmp316 = _tmp147 + matches_0_5_source_coords(1, 0);
   const Scalar _tmp317 = _tmp144 + matches_0_5_source_coords(0, 0);
-  const Scalar _tmp318 = std::pow(Scalar(_tmp146 * std::pow(_tmp317, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp316, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp318 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp317 * _tmp317) + _tmp149 * (_tmp316 * _tmp316) + _tmp150));
   const Scalar _tmp319 = _tmp316 * _tmp318;
   const Scalar _tmp320 = _tmp317 * _tmp318;
   const Scalar _tmp321 =
@@ -594,8 +595,8 @@ void Linearization(
   const Scalar _tmp334 = _tmp329 * views_1_calibration(1, 0);
   const Scalar _tmp335 =
       _tmp333 * _tmp334 - matches_0_5_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp336 = std::pow(_tmp331, Scalar(2)) + std::pow(_tmp335, Scalar(2)) + epsilon;
-  const Scalar _tmp337 = std::pow(_tmp336, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp336 = (_tmp331 * _tmp331) + (_tmp335 * _tmp335) + epsilon;
+  const Scalar _tmp337 = Scalar(1.0) / std::sqrt(_tmp336);
   const Scalar _tmp338 = std::sqrt(matches_0_5_weight);
   const Scalar _tmp339 = std::max<Scalar>(0, (((_tmp327) > 0) - ((_tmp327) < 0)));
   const Scalar _tmp340 = _tmp184 * _tmp336 + 1;
@@ -606,9 +607,9 @@ void Linearization(
   const Scalar _tmp345 = _tmp335 * _tmp343;
   const Scalar _tmp346 = _tmp144 + matches_0_6_source_coords(0, 0);
   const Scalar _tmp347 = _tmp147 + matches_0_6_source_coords(1, 0);
-  const Scalar _tmp348 = std::pow(Scalar(_tmp146 * std::pow(_tmp346, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp347, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp348 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp346 * _tmp346) + _tmp149 * (_tmp347 * _tmp347) + _tmp150));
   const Scalar _tmp349 = _tmp347 * _tmp348;
   const Scalar _tmp350 = _tmp346 * _tmp348;
   const Scalar _tmp351 =
@@ -631,8 +632,8 @@ void Linearization(
   const Scalar _tmp364 = _tmp359 * views_1_calibration(1, 0);
   const Scalar _tmp365 =
       _tmp363 * _tmp364 - matches_0_6_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp366 = std::pow(_tmp361, Scalar(2)) + std::pow(_tmp365, Scalar(2)) + epsilon;
-  const Scalar _tmp367 = std::pow(_tmp366, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp366 = (_tmp361 * _tmp361) + (_tmp365 * _tmp365) + epsilon;
+  const Scalar _tmp367 = Scalar(1.0) / std::sqrt(_tmp366);
   const Scalar _tmp368 = std::sqrt(matches_0_6_weight);
   const Scalar _tmp369 = std::max<Scalar>(0, (((_tmp357) > 0) - ((_tmp357) < 0)));
   const Scalar _tmp370 = _tmp184 * _tmp366 + 1;
@@ -643,9 +644,9 @@ void Linearization(
   const Scalar _tmp375 = _tmp365 * _tmp373;
   const Scalar _tmp376 = _tmp147 + matches_0_7_source_coords(1, 0);
   const Scalar _tmp377 = _tmp144 + matches_0_7_source_coords(0, 0);
-  const Scalar _tmp378 = std::pow(Scalar(_tmp146 * std::pow(_tmp377, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp376, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp378 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp377 * _tmp377) + _tmp149 * (_tmp376 * _tmp376) + _tmp150));
   const Scalar _tmp379 = _tmp376 * _tmp378;
   const Scalar _tmp380 = _tmp377 * _tmp378;
   const Scalar _tmp381 =
@@ -668,8 +669,8 @@ void Linearization(
   const Scalar _tmp394 = _tmp389 * views_1_calibration(1, 0);
   const Scalar _tmp395 =
       _tmp393 * _tmp394 - matches_0_7_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp396 = std::pow(_tmp391, Scalar(2)) + std::pow(_tmp395, Scalar(2)) + epsilon;
-  const Scalar _tmp397 = std::pow(_tmp396, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp396 = (_tmp391 * _tmp391) + (_tmp395 * _tmp395) + epsilon;
+  const Scalar _tmp397 = Scalar(1.0) / std::sqrt(_tmp396);
   const Scalar _tmp398 = std::sqrt(matches_0_7_weight);
   const Scalar _tmp399 = std::max<Scalar>(0, (((_tmp387) > 0) - ((_tmp387) < 0)));
   const Scalar _tmp400 = _tmp184 * _tmp396 + 1;
@@ -680,9 +681,9 @@ void Linearization(
   const Scalar _tmp405 = _tmp395 * _tmp403;
   const Scalar _tmp406 = _tmp147 + matches_0_8_source_coords(1, 0);
   const Scalar _tmp407 = _tmp144 + matches_0_8_source_coords(0, 0);
-  const Scalar _tmp408 = std::pow(Scalar(_tmp146 * std::pow(_tmp407, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp406, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp408 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp407 * _tmp407) + _tmp149 * (_tmp406 * _tmp406) + _tmp150));
   const Scalar _tmp409 = _tmp406 * _tmp408;
   const Scalar _tmp410 = _tmp407 * _tmp408;
   const Scalar _tmp411 =
@@ -705,8 +706,8 @@ void Linearization(
   const Scalar _tmp424 = _tmp419 * views_1_calibration(1, 0);
   const Scalar _tmp425 =
       _tmp423 * _tmp424 - matches_0_8_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp426 = std::pow(_tmp421, Scalar(2)) + std::pow(_tmp425, Scalar(2)) + epsilon;
-  const Scalar _tmp427 = std::pow(_tmp426, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp426 = (_tmp421 * _tmp421) + (_tmp425 * _tmp425) + epsilon;
+  const Scalar _tmp427 = Scalar(1.0) / std::sqrt(_tmp426);
   const Scalar _tmp428 = std::sqrt(matches_0_8_weight);
   const Scalar _tmp429 = _tmp184 * _tmp426 + 1;
   const Scalar _tmp430 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp429, _tmp188) - 1)));
@@ -717,9 +718,9 @@ void Linearization(
   const Scalar _tmp435 = _tmp425 * _tmp433;
   const Scalar _tmp436 = _tmp147 + matches_0_9_source_coords(1, 0);
   const Scalar _tmp437 = _tmp144 + matches_0_9_source_coords(0, 0);
-  const Scalar _tmp438 = std::pow(Scalar(_tmp146 * std::pow(_tmp437, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp436, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp438 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp437 * _tmp437) + _tmp149 * (_tmp436 * _tmp436) + _tmp150));
   const Scalar _tmp439 = _tmp436 * _tmp438;
   const Scalar _tmp440 = _tmp437 * _tmp438;
   const Scalar _tmp441 =
@@ -742,8 +743,8 @@ void Linearization(
   const Scalar _tmp454 = _tmp449 * views_1_calibration(1, 0);
   const Scalar _tmp455 =
       _tmp453 * _tmp454 - matches_0_9_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp456 = std::pow(_tmp451, Scalar(2)) + std::pow(_tmp455, Scalar(2)) + epsilon;
-  const Scalar _tmp457 = std::pow(_tmp456, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp456 = (_tmp451 * _tmp451) + (_tmp455 * _tmp455) + epsilon;
+  const Scalar _tmp457 = Scalar(1.0) / std::sqrt(_tmp456);
   const Scalar _tmp458 = std::sqrt(matches_0_9_weight);
   const Scalar _tmp459 = std::max<Scalar>(0, (((_tmp447) > 0) - ((_tmp447) < 0)));
   const Scalar _tmp460 = _tmp184 * _tmp456 + 1;
@@ -754,9 +755,9 @@ void Linearization(
   const Scalar _tmp465 = _tmp455 * _tmp463;
   const Scalar _tmp466 = _tmp147 + matches_0_10_source_coords(1, 0);
   const Scalar _tmp467 = _tmp144 + matches_0_10_source_coords(0, 0);
-  const Scalar _tmp468 = std::pow(Scalar(_tmp146 * std::pow(_tmp467, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp466, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp468 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp467 * _tmp467) + _tmp149 * (_tmp466 * _tmp466) + _tmp150));
   const Scalar _tmp469 = _tmp466 * _tmp468;
   const Scalar _tmp470 = _tmp467 * _tmp468;
   const Scalar _tmp471 =
@@ -779,8 +780,8 @@ void Linearization(
   const Scalar _tmp484 = _tmp479 * views_1_calibration(1, 0);
   const Scalar _tmp485 =
       _tmp483 * _tmp484 - matches_0_10_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp486 = std::pow(_tmp481, Scalar(2)) + std::pow(_tmp485, Scalar(2)) + epsilon;
-  const Scalar _tmp487 = std::pow(_tmp486, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp486 = (_tmp481 * _tmp481) + (_tmp485 * _tmp485) + epsilon;
+  const Scalar _tmp487 = Scalar(1.0) / std::sqrt(_tmp486);
   const Scalar _tmp488 = std::sqrt(matches_0_10_weight);
   const Scalar _tmp489 = _tmp184 * _tmp486 + 1;
   const Scalar _tmp490 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp489, _tmp188) - 1)));
@@ -791,9 +792,9 @@ void Linearization(
   const Scalar _tmp495 = _tmp485 * _tmp493;
   const Scalar _tmp496 = _tmp147 + matches_0_11_source_coords(1, 0);
   const Scalar _tmp497 = _tmp144 + matches_0_11_source_coords(0, 0);
-  const Scalar _tmp498 = std::pow(Scalar(_tmp146 * std::pow(_tmp497, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp496, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp498 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp497 * _tmp497) + _tmp149 * (_tmp496 * _tmp496) + _tmp150));
   const Scalar _tmp499 = _tmp496 * _tmp498;
   const Scalar _tmp500 = _tmp497 * _tmp498;
   const Scalar _tmp501 =
@@ -816,8 +817,8 @@ void Linearization(
   const Scalar _tmp514 = _tmp509 * views_1_calibration(1, 0);
   const Scalar _tmp515 =
       _tmp513 * _tmp514 - matches_0_11_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp516 = std::pow(_tmp511, Scalar(2)) + std::pow(_tmp515, Scalar(2)) + epsilon;
-  const Scalar _tmp517 = std::pow(_tmp516, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp516 = (_tmp511 * _tmp511) + (_tmp515 * _tmp515) + epsilon;
+  const Scalar _tmp517 = Scalar(1.0) / std::sqrt(_tmp516);
   const Scalar _tmp518 = _tmp184 * _tmp516 + 1;
   const Scalar _tmp519 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp518, _tmp188) - 1)));
   const Scalar _tmp520 = std::sqrt(matches_0_11_weight);
@@ -828,9 +829,9 @@ void Linearization(
   const Scalar _tmp525 = _tmp515 * _tmp523;
   const Scalar _tmp526 = _tmp147 + matches_0_12_source_coords(1, 0);
   const Scalar _tmp527 = _tmp144 + matches_0_12_source_coords(0, 0);
-  const Scalar _tmp528 = std::pow(Scalar(_tmp146 * std::pow(_tmp527, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp526, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp528 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp527 * _tmp527) + _tmp149 * (_tmp526 * _tmp526) + _tmp150));
   const Scalar _tmp529 = _tmp526 * _tmp528;
   const Scalar _tmp530 = _tmp527 * _tmp528;
   const Scalar _tmp531 =
@@ -853,8 +854,8 @@ void Linearization(
   const Scalar _tmp544 = _tmp539 * views_1_calibration(1, 0);
   const Scalar _tmp545 =
       _tmp543 * _tmp544 - matches_0_12_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp546 = std::pow(_tmp541, Scalar(2)) + std::pow(_tmp545, Scalar(2)) + epsilon;
-  const Scalar _tmp547 = std::pow(_tmp546, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp546 = (_tmp541 * _tmp541) + (_tmp545 * _tmp545) + epsilon;
+  const Scalar _tmp547 = Scalar(1.0) / std::sqrt(_tmp546);
   const Scalar _tmp548 = _tmp184 * _tmp546 + 1;
   const Scalar _tmp549 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp548, _tmp188) - 1)));
   const Scalar _tmp550 = std::sqrt(matches_0_12_weight);
@@ -865,9 +866,9 @@ void Linearization(
   const Scalar _tmp555 = _tmp545 * _tmp553;
   const Scalar _tmp556 = _tmp147 + matches_0_13_source_coords(1, 0);
   const Scalar _tmp557 = _tmp144 + matches_0_13_source_coords(0, 0);
-  const Scalar _tmp558 = std::pow(Scalar(_tmp146 * std::pow(_tmp557, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp556, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp558 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp557 * _tmp557) + _tmp149 * (_tmp556 * _tmp556) + _tmp150));
   const Scalar _tmp559 = _tmp556 * _tmp558;
   const Scalar _tmp560 = _tmp557 * _tmp558;
   const Scalar _tmp561 =
@@ -890,8 +891,8 @@ void Linearization(
   const Scalar _tmp574 = _tmp569 * views_1_calibration(1, 0);
   const Scalar _tmp575 =
       _tmp573 * _tmp574 - matches_0_13_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp576 = std::pow(_tmp571, Scalar(2)) + std::pow(_tmp575, Scalar(2)) + epsilon;
-  const Scalar _tmp577 = std::pow(_tmp576, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp576 = (_tmp571 * _tmp571) + (_tmp575 * _tmp575) + epsilon;
+  const Scalar _tmp577 = Scalar(1.0) / std::sqrt(_tmp576);
   const Scalar _tmp578 = _tmp184 * _tmp576 + 1;
   const Scalar _tmp579 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp578, _tmp188) - 1)));
   const Scalar _tmp580 = std::sqrt(matches_0_13_weight);
@@ -902,9 +903,9 @@ void Linearization(
   const Scalar _tmp585 = _tmp575 * _tmp583;
   const Scalar _tmp586 = _tmp147 + matches_0_14_source_coords(1, 0);
   const Scalar _tmp587 = _tmp144 + matches_0_14_source_coords(0, 0);
-  const Scalar _tmp588 = std::pow(Scalar(_tmp146 * std::pow(_tmp587, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp586, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp588 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp587 * _tmp587) + _tmp149 * (_tmp586 * _tmp586) + _tmp150));
   const Scalar _tmp589 = _tmp586 * _tmp588;
   const Scalar _tmp590 = _tmp587 * _tmp588;
   const Scalar _tmp591 =
@@ -927,8 +928,8 @@ void Linearization(
   const Scalar _tmp604 = _tmp599 * views_1_calibration(1, 0);
   const Scalar _tmp605 =
       _tmp603 * _tmp604 - matches_0_14_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp606 = std::pow(_tmp601, Scalar(2)) + std::pow(_tmp605, Scalar(2)) + epsilon;
-  const Scalar _tmp607 = std::pow(_tmp606, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp606 = (_tmp601 * _tmp601) + (_tmp605 * _tmp605) + epsilon;
+  const Scalar _tmp607 = Scalar(1.0) / std::sqrt(_tmp606);
   const Scalar _tmp608 = std::sqrt(matches_0_14_weight);
   const Scalar _tmp609 = _tmp184 * _tmp606 + 1;
   const Scalar _tmp610 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp609, _tmp188) - 1)));
@@ -939,9 +940,9 @@ void Linearization(
   const Scalar _tmp615 = _tmp605 * _tmp613;
   const Scalar _tmp616 = _tmp147 + matches_0_15_source_coords(1, 0);
   const Scalar _tmp617 = _tmp144 + matches_0_15_source_coords(0, 0);
-  const Scalar _tmp618 = std::pow(Scalar(_tmp146 * std::pow(_tmp617, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp616, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp618 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp617 * _tmp617) + _tmp149 * (_tmp616 * _tmp616) + _tmp150));
   const Scalar _tmp619 = _tmp616 * _tmp618;
   const Scalar _tmp620 = _tmp617 * _tmp618;
   const Scalar _tmp621 =
@@ -964,8 +965,8 @@ void Linearization(
   const Scalar _tmp634 = _tmp629 * views_1_calibration(1, 0);
   const Scalar _tmp635 =
       _tmp633 * _tmp634 - matches_0_15_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp636 = std::pow(_tmp631, Scalar(2)) + std::pow(_tmp635, Scalar(2)) + epsilon;
-  const Scalar _tmp637 = std::pow(_tmp636, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp636 = (_tmp631 * _tmp631) + (_tmp635 * _tmp635) + epsilon;
+  const Scalar _tmp637 = Scalar(1.0) / std::sqrt(_tmp636);
   const Scalar _tmp638 = _tmp184 * _tmp636 + 1;
   const Scalar _tmp639 = std::sqrt(Scalar(_tmp189 * (std::pow(_tmp638, _tmp188) - 1)));
   const Scalar _tmp640 = std::sqrt(matches_0_15_weight);
@@ -976,9 +977,9 @@ void Linearization(
   const Scalar _tmp645 = _tmp635 * _tmp643;
   const Scalar _tmp646 = _tmp147 + matches_0_16_source_coords(1, 0);
   const Scalar _tmp647 = _tmp144 + matches_0_16_source_coords(0, 0);
-  const Scalar _tmp648 = std::pow(Scalar(_tmp146 * std::pow(_tmp647, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp646, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp648 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp647 * _tmp647) + _tmp149 * (_tmp646 * _tmp646) + _tmp150));
   const Scalar _tmp649 = _tmp646 * _tmp648;
   const Scalar _tmp650 = _tmp647 * _tmp648;
   const Scalar _tmp651 =
@@ -1001,8 +1002,8 @@ void Linearization(
   const Scalar _tmp664 = _tmp659 * views_1_calibration(1, 0);
   const Scalar _tmp665 =
       _tmp663 * _tmp664 - matches_0_16_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp666 = std::pow(_tmp661, Scalar(2)) + std::pow(_tmp665, Scalar(2)) + epsilon;
-  const Scalar _tmp667 = std::pow(_tmp666, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp666 = (_tmp661 * _tmp661) + (_tmp665 * _tmp665) + epsilon;
+  const Scalar _tmp667 = Scalar(1.0) / std::sqrt(_tmp666);
   const Scalar _tmp668 = std::sqrt(matches_0_16_weight);
   const Scalar _tmp669 = std::max<Scalar>(0, (((_tmp657) > 0) - ((_tmp657) < 0)));
   const Scalar _tmp670 = _tmp184 * _tmp666 + 1;
@@ -1013,9 +1014,9 @@ void Linearization(
   const Scalar _tmp675 = _tmp665 * _tmp673;
   const Scalar _tmp676 = _tmp147 + matches_0_17_source_coords(1, 0);
   const Scalar _tmp677 = _tmp144 + matches_0_17_source_coords(0, 0);
-  const Scalar _tmp678 = std::pow(Scalar(_tmp146 * std::pow(_tmp677, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp676, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp678 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp677 * _tmp677) + _tmp149 * (_tmp676 * _tmp676) + _tmp150));
   const Scalar _tmp679 = _tmp676 * _tmp678;
   const Scalar _tmp680 = _tmp677 * _tmp678;
   const Scalar _tmp681 =
@@ -1038,8 +1039,8 @@ void Linearization(
   const Scalar _tmp694 = _tmp689 * views_1_calibration(1, 0);
   const Scalar _tmp695 =
       _tmp693 * _tmp694 - matches_0_17_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp696 = std::pow(_tmp691, Scalar(2)) + std::pow(_tmp695, Scalar(2)) + epsilon;
-  const Scalar _tmp697 = std::pow(_tmp696, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp696 = (_tmp691 * _tmp691) + (_tmp695 * _tmp695) + epsilon;
+  const Scalar _tmp697 = Scalar(1.0) / std::sqrt(_tmp696);
   const Scalar _tmp698 = std::sqrt(matches_0_17_weight);
   const Scalar _tmp699 = std::max<Scalar>(0, (((_tmp687) > 0) - ((_tmp687) < 0)));
   const Scalar _tmp700 = _tmp184 * _tmp696 + 1;
@@ -1050,9 +1051,9 @@ void Linearization(
   const Scalar _tmp705 = _tmp695 * _tmp703;
   const Scalar _tmp706 = _tmp147 + matches_0_18_source_coords(1, 0);
   const Scalar _tmp707 = _tmp144 + matches_0_18_source_coords(0, 0);
-  const Scalar _tmp708 = std::pow(Scalar(_tmp146 * std::pow(_tmp707, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp706, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp708 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp707 * _tmp707) + _tmp149 * (_tmp706 * _tmp706) + _tmp150));
   const Scalar _tmp709 = _tmp706 * _tmp708;
   const Scalar _tmp710 = _tmp707 * _tmp708;
   const Scalar _tmp711 =
@@ -1075,8 +1076,8 @@ void Linearization(
   const Scalar _tmp724 = _tmp719 * views_1_calibration(1, 0);
   const Scalar _tmp725 =
       _tmp723 * _tmp724 - matches_0_18_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp726 = std::pow(_tmp721, Scalar(2)) + std::pow(_tmp725, Scalar(2)) + epsilon;
-  const Scalar _tmp727 = std::pow(_tmp726, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp726 = (_tmp721 * _tmp721) + (_tmp725 * _tmp725) + epsilon;
+  const Scalar _tmp727 = Scalar(1.0) / std::sqrt(_tmp726);
   const Scalar _tmp728 = std::max<Scalar>(0, (((_tmp717) > 0) - ((_tmp717) < 0)));
   const Scalar _tmp729 = std::sqrt(matches_0_18_weight);
   const Scalar _tmp730 = _tmp184 * _tmp726 + 1;
@@ -1087,9 +1088,9 @@ void Linearization(
   const Scalar _tmp735 = _tmp725 * _tmp733;
   const Scalar _tmp736 = _tmp147 + matches_0_19_source_coords(1, 0);
   const Scalar _tmp737 = _tmp144 + matches_0_19_source_coords(0, 0);
-  const Scalar _tmp738 = std::pow(Scalar(_tmp146 * std::pow(_tmp737, Scalar(2)) +
-                                         _tmp149 * std::pow(_tmp736, Scalar(2)) + _tmp150),
-                                  Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp738 =
+      Scalar(1.0) /
+      std::sqrt(Scalar(_tmp146 * (_tmp737 * _tmp737) + _tmp149 * (_tmp736 * _tmp736) + _tmp150));
   const Scalar _tmp739 = _tmp736 * _tmp738;
   const Scalar _tmp740 = _tmp737 * _tmp738;
   const Scalar _tmp741 =
@@ -1112,8 +1113,8 @@ void Linearization(
   const Scalar _tmp754 = _tmp749 * views_1_calibration(1, 0);
   const Scalar _tmp755 =
       _tmp753 * _tmp754 - matches_0_19_target_coords(1, 0) + views_1_calibration(3, 0);
-  const Scalar _tmp756 = std::pow(_tmp751, Scalar(2)) + std::pow(_tmp755, Scalar(2)) + epsilon;
-  const Scalar _tmp757 = std::pow(_tmp756, Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp756 = (_tmp751 * _tmp751) + (_tmp755 * _tmp755) + epsilon;
+  const Scalar _tmp757 = Scalar(1.0) / std::sqrt(_tmp756);
   const Scalar _tmp758 = std::sqrt(matches_0_19_weight);
   const Scalar _tmp759 = std::max<Scalar>(0, (((_tmp747) > 0) - ((_tmp747) < 0)));
   const Scalar _tmp760 = _tmp184 * _tmp756 + 1;
@@ -1209,7 +1210,7 @@ void Linearization(
   const Scalar _tmp850 = std::fabs(_tmp33 + _tmp34 + _tmp35 + _tmp36);
   const Scalar _tmp851 = std::min<Scalar>(_tmp42, _tmp850);
   const Scalar _tmp852 = std::acos(_tmp851);
-  const Scalar _tmp853 = 1 - std::pow(_tmp851, Scalar(2));
+  const Scalar _tmp853 = 1 - (_tmp851 * _tmp851);
   const Scalar _tmp854 = _tmp39 * ((((_tmp42 - _tmp850) > 0) - ((_tmp42 - _tmp850) < 0)) + 1) *
                          (((-_tmp33 + _tmp37) > 0) - ((-_tmp33 + _tmp37) < 0));
   const Scalar _tmp855 = _tmp851 * _tmp852 * _tmp854 / (_tmp853 * std::sqrt(_tmp853));
@@ -1250,7 +1251,7 @@ void Linearization(
   const Scalar _tmp883 = -_tmp74;
   const Scalar _tmp884 = _tmp71 + _tmp883;
   const Scalar _tmp885 = -_tmp91;
-  const Scalar _tmp886 = std::pow(_views_1_pose[3], Scalar(2));
+  const Scalar _tmp886 = (_views_1_pose[3] * _views_1_pose[3]);
   const Scalar _tmp887 = _tmp885 + _tmp886;
   const Scalar _tmp888 = _tmp884 + _tmp887;
   const Scalar _tmp889 = -_tmp85;
@@ -1261,7 +1262,7 @@ void Linearization(
   const Scalar _tmp894 = -_tmp96;
   const Scalar _tmp895 = _tmp105 + _tmp894;
   const Scalar _tmp896 =
-      ((((_tmp41 + _tmp597) > 0) - ((_tmp41 + _tmp597) < 0)) + 1) / std::pow(_tmp598, Scalar(2));
+      ((((_tmp41 + _tmp597) > 0) - ((_tmp41 + _tmp597) < 0)) + 1) / (_tmp598 * _tmp598);
   const Scalar _tmp897 = _tmp896 * (_tmp591 * _tmp890 + _tmp592 * _tmp893 + _tmp593 * _tmp895);
   const Scalar _tmp898 = (Scalar(1) / Scalar(2)) * views_1_calibration(1, 0);
   const Scalar _tmp899 = _tmp603 * _tmp898;
@@ -1279,7 +1280,7 @@ void Linearization(
   const Scalar _tmp909 = _tmp613 * _tmp900 - _tmp902 * _tmp905 + _tmp902 * _tmp908;
   const Scalar _tmp910 = _tmp501 * _tmp890 + _tmp502 * _tmp893 + _tmp503 * _tmp895;
   const Scalar _tmp911 =
-      ((((_tmp41 + _tmp507) > 0) - ((_tmp41 + _tmp507) < 0)) + 1) / std::pow(_tmp508, Scalar(2));
+      ((((_tmp41 + _tmp507) > 0) - ((_tmp41 + _tmp507) < 0)) + 1) / (_tmp508 * _tmp508);
   const Scalar _tmp912 = _tmp505 * _tmp911;
   const Scalar _tmp913 = _tmp513 * _tmp911;
   const Scalar _tmp914 = _tmp898 * _tmp913;
@@ -1311,7 +1312,7 @@ void Linearization(
   const Scalar _tmp938 = -_priors_1_0_target_T_src[2] * _tmp934 + _tmp933 - _tmp935 + _tmp937;
   const Scalar _tmp939 = std::fabs(_tmp112 + _tmp114 + _tmp116 + _tmp118);
   const Scalar _tmp940 = std::min<Scalar>(_tmp42, _tmp939);
-  const Scalar _tmp941 = 1 - std::pow(_tmp940, Scalar(2));
+  const Scalar _tmp941 = 1 - (_tmp940 * _tmp940);
   const Scalar _tmp942 = _tmp121 * ((((_tmp42 - _tmp939) > 0) - ((_tmp42 - _tmp939) < 0)) + 1) *
                          (((-_tmp112 + _tmp119) > 0) - ((-_tmp112 + _tmp119) < 0));
   const Scalar _tmp943 = _tmp942 / _tmp941;
@@ -1356,7 +1357,7 @@ void Linearization(
       _tmp966 * priors_1_0_sqrt_info(1, 2) + _tmp971 * priors_1_0_sqrt_info(1, 0);
   const Scalar _tmp973 = _tmp561 * _tmp890 + _tmp562 * _tmp893 + _tmp563 * _tmp895;
   const Scalar _tmp974 =
-      ((((_tmp41 + _tmp567) > 0) - ((_tmp41 + _tmp567) < 0)) + 1) / std::pow(_tmp568, Scalar(2));
+      ((((_tmp41 + _tmp567) > 0) - ((_tmp41 + _tmp567) < 0)) + 1) / (_tmp568 * _tmp568);
   const Scalar _tmp975 = _tmp565 * _tmp974;
   const Scalar _tmp976 = _tmp573 * _tmp974;
   const Scalar _tmp977 = _tmp898 * _tmp976;
@@ -1380,7 +1381,7 @@ void Linearization(
       _tmp965 * priors_1_0_sqrt_info(2, 2) - _tmp966 * priors_1_0_sqrt_info(2, 2);
   const Scalar _tmp989 = _tmp201 * _tmp890 + _tmp202 * _tmp893 + _tmp203 * _tmp895;
   const Scalar _tmp990 =
-      ((((_tmp207 + _tmp41) > 0) - ((_tmp207 + _tmp41) < 0)) + 1) / std::pow(_tmp208, Scalar(2));
+      ((((_tmp207 + _tmp41) > 0) - ((_tmp207 + _tmp41) < 0)) + 1) / (_tmp208 * _tmp208);
   const Scalar _tmp991 = _tmp205 * _tmp990;
   const Scalar _tmp992 = _tmp213 * _tmp990;
   const Scalar _tmp993 = _tmp898 * _tmp992;
@@ -1397,7 +1398,7 @@ void Linearization(
   const Scalar _tmp1002 = _tmp1001 * _tmp996 + _tmp223 * _tmp994 - _tmp996 * _tmp999;
   const Scalar _tmp1003 = _tmp471 * _tmp890 + _tmp472 * _tmp895 + _tmp473 * _tmp893;
   const Scalar _tmp1004 =
-      ((((_tmp41 + _tmp477) > 0) - ((_tmp41 + _tmp477) < 0)) + 1) / std::pow(_tmp478, Scalar(2));
+      ((((_tmp41 + _tmp477) > 0) - ((_tmp41 + _tmp477) < 0)) + 1) / (_tmp478 * _tmp478);
   const Scalar _tmp1005 = _tmp1004 * _tmp475;
   const Scalar _tmp1006 = _tmp1004 * _tmp483;
   const Scalar _tmp1007 = _tmp1006 * _tmp898;
@@ -1421,7 +1422,7 @@ void Linearization(
       _tmp881 * priors_0_1_sqrt_info(2, 1);
   const Scalar _tmp1021 = _tmp351 * _tmp890 + _tmp352 * _tmp893 + _tmp353 * _tmp895;
   const Scalar _tmp1022 =
-      ((((_tmp357 + _tmp41) > 0) - ((_tmp357 + _tmp41) < 0)) + 1) / std::pow(_tmp358, Scalar(2));
+      ((((_tmp357 + _tmp41) > 0) - ((_tmp357 + _tmp41) < 0)) + 1) / (_tmp358 * _tmp358);
   const Scalar _tmp1023 = _tmp1022 * _tmp363;
   const Scalar _tmp1024 = _tmp1023 * _tmp898;
   const Scalar _tmp1025 = -_tmp1021 * _tmp1024 + _tmp364 * (_tmp353 * _tmp888 + _tmp356);
@@ -1440,7 +1441,7 @@ void Linearization(
       -_tmp1021 * _tmp1032 * _tmp373 + _tmp1028 * _tmp1034 - _tmp1030 * _tmp1031;
   const Scalar _tmp1036 = _tmp531 * _tmp890 + _tmp532 * _tmp895 + _tmp533 * _tmp893;
   const Scalar _tmp1037 =
-      ((((_tmp41 + _tmp537) > 0) - ((_tmp41 + _tmp537) < 0)) + 1) / std::pow(_tmp538, Scalar(2));
+      ((((_tmp41 + _tmp537) > 0) - ((_tmp41 + _tmp537) < 0)) + 1) / (_tmp538 * _tmp538);
   const Scalar _tmp1038 = _tmp1037 * _tmp535;
   const Scalar _tmp1039 = _tmp1037 * _tmp543;
   const Scalar _tmp1040 = _tmp1039 * _tmp898;
@@ -1459,7 +1460,7 @@ void Linearization(
       -_tmp1036 * _tmp1047 * _tmp553 - _tmp1043 * _tmp1046 + _tmp1043 * _tmp1049;
   const Scalar _tmp1051 = _tmp261 * _tmp890 + _tmp262 * _tmp893 + _tmp263 * _tmp895;
   const Scalar _tmp1052 =
-      ((((_tmp267 + _tmp41) > 0) - ((_tmp267 + _tmp41) < 0)) + 1) / std::pow(_tmp268, Scalar(2));
+      ((((_tmp267 + _tmp41) > 0) - ((_tmp267 + _tmp41) < 0)) + 1) / (_tmp268 * _tmp268);
   const Scalar _tmp1053 = _tmp1052 * _tmp265;
   const Scalar _tmp1054 = _tmp1052 * _tmp273;
   const Scalar _tmp1055 = _tmp1054 * _tmp898;
@@ -1478,7 +1479,7 @@ void Linearization(
   const Scalar _tmp1066 =
       -_tmp1051 * _tmp1062 * _tmp283 + _tmp1058 * _tmp1061 - _tmp1058 * _tmp1065;
   const Scalar _tmp1067 =
-      ((((_tmp327 + _tmp41) > 0) - ((_tmp327 + _tmp41) < 0)) + 1) / std::pow(_tmp328, Scalar(2));
+      ((((_tmp327 + _tmp41) > 0) - ((_tmp327 + _tmp41) < 0)) + 1) / (_tmp328 * _tmp328);
   const Scalar _tmp1068 = _tmp1067 * (_tmp321 * _tmp890 + _tmp322 * _tmp893 + _tmp323 * _tmp895);
   const Scalar _tmp1069 = _tmp333 * _tmp898;
   const Scalar _tmp1070 = -_tmp1068 * _tmp1069 + _tmp334 * (_tmp323 * _tmp888 + _tmp326);
@@ -1494,7 +1495,7 @@ void Linearization(
   const Scalar _tmp1080 = -_tmp1072 * _tmp343 * _tmp924 - _tmp1073 * _tmp1076 + _tmp1079 * _tmp331;
   const Scalar _tmp1081 = _tmp681 * _tmp890 + _tmp682 * _tmp893 + _tmp683 * _tmp895;
   const Scalar _tmp1082 =
-      ((((_tmp41 + _tmp687) > 0) - ((_tmp41 + _tmp687) < 0)) + 1) / std::pow(_tmp688, Scalar(2));
+      ((((_tmp41 + _tmp687) > 0) - ((_tmp41 + _tmp687) < 0)) + 1) / (_tmp688 * _tmp688);
   const Scalar _tmp1083 = _tmp1082 * _tmp693;
   const Scalar _tmp1084 = _tmp1083 * _tmp898;
   const Scalar _tmp1085 = -_tmp1081 * _tmp1084 + _tmp694 * (_tmp683 * _tmp888 + _tmp686);
@@ -1510,7 +1511,7 @@ void Linearization(
   const Scalar _tmp1094 = _tmp1090 * _tmp1093;
   const Scalar _tmp1095 = -_tmp1088 * _tmp703 * _tmp924 + _tmp1089 * _tmp1092 - _tmp1089 * _tmp1094;
   const Scalar _tmp1096 =
-      ((((_tmp41 + _tmp747) > 0) - ((_tmp41 + _tmp747) < 0)) + 1) / std::pow(_tmp748, Scalar(2));
+      ((((_tmp41 + _tmp747) > 0) - ((_tmp41 + _tmp747) < 0)) + 1) / (_tmp748 * _tmp748);
   const Scalar _tmp1097 = _tmp1096 * (_tmp741 * _tmp890 + _tmp742 * _tmp895 + _tmp743 * _tmp893);
   const Scalar _tmp1098 = _tmp753 * _tmp898;
   const Scalar _tmp1099 = -_tmp1097 * _tmp1098 + _tmp754 * (_tmp742 * _tmp888 + _tmp746);
@@ -1526,7 +1527,7 @@ void Linearization(
   const Scalar _tmp1108 = _tmp1099 * _tmp763 - _tmp1102 * _tmp1105 + _tmp1102 * _tmp1107;
   const Scalar _tmp1109 = _tmp157 * _tmp890 + _tmp161 * _tmp893 + _tmp165 * _tmp895;
   const Scalar _tmp1110 =
-      ((((_tmp169 + _tmp41) > 0) - ((_tmp169 + _tmp41) < 0)) + 1) / std::pow(_tmp170, Scalar(2));
+      ((((_tmp169 + _tmp41) > 0) - ((_tmp169 + _tmp41) < 0)) + 1) / (_tmp170 * _tmp170);
   const Scalar _tmp1111 = _tmp1110 * _tmp175;
   const Scalar _tmp1112 = _tmp1111 * _tmp898;
   const Scalar _tmp1113 = -_tmp1109 * _tmp1112 + _tmp176 * (_tmp165 * _tmp888 + _tmp168);
@@ -1543,7 +1544,7 @@ void Linearization(
   const Scalar _tmp1122 = _tmp1113 * _tmp193 + _tmp1116 * _tmp1119 - _tmp1116 * _tmp1121;
   const Scalar _tmp1123 = _tmp381 * _tmp890 + _tmp382 * _tmp893 + _tmp383 * _tmp895;
   const Scalar _tmp1124 =
-      ((((_tmp387 + _tmp41) > 0) - ((_tmp387 + _tmp41) < 0)) + 1) / std::pow(_tmp388, Scalar(2));
+      ((((_tmp387 + _tmp41) > 0) - ((_tmp387 + _tmp41) < 0)) + 1) / (_tmp388 * _tmp388);
   const Scalar _tmp1125 = _tmp1124 * _tmp393;
   const Scalar _tmp1126 = _tmp1125 * _tmp898;
   const Scalar _tmp1127 = -_tmp1123 * _tmp1126 + _tmp394 * (_tmp383 * _tmp888 + _tmp386);
@@ -1570,7 +1571,7 @@ void Linearization(
       _tmp966 * priors_1_0_sqrt_info(4, 2) + _tmp971 * priors_1_0_sqrt_info(4, 0);
   const Scalar _tmp1143 = _tmp711 * _tmp890 + _tmp712 * _tmp895 + _tmp713 * _tmp893;
   const Scalar _tmp1144 =
-      ((((_tmp41 + _tmp717) > 0) - ((_tmp41 + _tmp717) < 0)) + 1) / std::pow(_tmp718, Scalar(2));
+      ((((_tmp41 + _tmp717) > 0) - ((_tmp41 + _tmp717) < 0)) + 1) / (_tmp718 * _tmp718);
   const Scalar _tmp1145 = _tmp1144 * _tmp723;
   const Scalar _tmp1146 = _tmp1145 * _tmp898;
   const Scalar _tmp1147 = -_tmp1143 * _tmp1146 + _tmp724 * (_tmp712 * _tmp888 + _tmp716);
@@ -1588,7 +1589,7 @@ void Linearization(
   const Scalar _tmp1157 = _tmp1147 * _tmp733 - _tmp1150 * _tmp1153 + _tmp1150 * _tmp1156;
   const Scalar _tmp1158 = _tmp231 * _tmp890 + _tmp232 * _tmp895 + _tmp233 * _tmp893;
   const Scalar _tmp1159 =
-      ((((_tmp237 + _tmp41) > 0) - ((_tmp237 + _tmp41) < 0)) + 1) / std::pow(_tmp238, Scalar(2));
+      ((((_tmp237 + _tmp41) > 0) - ((_tmp237 + _tmp41) < 0)) + 1) / (_tmp238 * _tmp238);
   const Scalar _tmp1160 = _tmp235 * _tmp924;
   const Scalar _tmp1161 = _tmp1159 * _tmp1160;
   const Scalar _tmp1162 = _tmp1159 * _tmp235;
@@ -1630,7 +1631,7 @@ void Linearization(
       _tmp873 * priors_0_1_sqrt_info(5, 0) + _tmp875 * priors_0_1_sqrt_info(5, 1) +
       _tmp879 * priors_0_1_sqrt_info(5, 2) - _tmp881 * priors_0_1_sqrt_info(5, 1);
   const Scalar _tmp1187 =
-      ((((_tmp297 + _tmp41) > 0) - ((_tmp297 + _tmp41) < 0)) + 1) / std::pow(_tmp298, Scalar(2));
+      ((((_tmp297 + _tmp41) > 0) - ((_tmp297 + _tmp41) < 0)) + 1) / (_tmp298 * _tmp298);
   const Scalar _tmp1188 = _tmp1187 * (_tmp291 * _tmp890 + _tmp292 * _tmp895 + _tmp293 * _tmp893);
   const Scalar _tmp1189 = _tmp303 * _tmp898;
   const Scalar _tmp1190 = -_tmp1188 * _tmp1189 + _tmp304 * (_tmp292 * _tmp888 + _tmp296);
@@ -1646,7 +1647,7 @@ void Linearization(
   const Scalar _tmp1198 = _tmp1190 * _tmp313 - _tmp1192 * _tmp1195 + _tmp1192 * _tmp1197;
   const Scalar _tmp1199 = _tmp621 * _tmp890 + _tmp622 * _tmp895 + _tmp623 * _tmp893;
   const Scalar _tmp1200 =
-      ((((_tmp41 + _tmp627) > 0) - ((_tmp41 + _tmp627) < 0)) + 1) / std::pow(_tmp628, Scalar(2));
+      ((((_tmp41 + _tmp627) > 0) - ((_tmp41 + _tmp627) < 0)) + 1) / (_tmp628 * _tmp628);
   const Scalar _tmp1201 = _tmp1200 * _tmp633;
   const Scalar _tmp1202 = _tmp1201 * _tmp898;
   const Scalar _tmp1203 = -_tmp1199 * _tmp1202 + _tmp634 * (_tmp622 * _tmp888 + _tmp626);
@@ -1669,7 +1670,7 @@ void Linearization(
   const Scalar _tmp1217 = -_tmp1130 * _tmp403 * _tmp924 + _tmp1131 * _tmp1215 - _tmp1131 * _tmp1216;
   const Scalar _tmp1218 = _tmp411 * _tmp890 + _tmp412 * _tmp893 + _tmp413 * _tmp895;
   const Scalar _tmp1219 =
-      ((((_tmp41 + _tmp417) > 0) - ((_tmp41 + _tmp417) < 0)) + 1) / std::pow(_tmp418, Scalar(2));
+      ((((_tmp41 + _tmp417) > 0) - ((_tmp41 + _tmp417) < 0)) + 1) / (_tmp418 * _tmp418);
   const Scalar _tmp1220 = _tmp1219 * _tmp415;
   const Scalar _tmp1221 = _tmp1218 * _tmp1220;
   const Scalar _tmp1222 = _tmp1219 * _tmp423;
@@ -1760,7 +1761,7 @@ void Linearization(
       -_tmp1188 * _tmp1281 * _tmp313 + _tmp1192 * _tmp1283 - _tmp1192 * _tmp1284;
   const Scalar _tmp1286 = _tmp441 * _tmp890 + _tmp442 * _tmp893 + _tmp443 * _tmp895;
   const Scalar _tmp1287 =
-      ((((_tmp41 + _tmp447) > 0) - ((_tmp41 + _tmp447) < 0)) + 1) / std::pow(_tmp448, Scalar(2));
+      ((((_tmp41 + _tmp447) > 0) - ((_tmp41 + _tmp447) < 0)) + 1) / (_tmp448 * _tmp448);
   const Scalar _tmp1288 = _tmp1287 * _tmp445;
   const Scalar _tmp1289 = _tmp1287 * _tmp453;
   const Scalar _tmp1290 = _tmp1289 * _tmp898;
@@ -1780,7 +1781,7 @@ void Linearization(
   const Scalar _tmp1302 = _tmp1206 * _tmp1300;
   const Scalar _tmp1303 = _tmp1203 * _tmp643 + _tmp1205 * _tmp1301 - _tmp1205 * _tmp1302;
   const Scalar _tmp1304 =
-      ((((_tmp41 + _tmp657) > 0) - ((_tmp41 + _tmp657) < 0)) + 1) / std::pow(_tmp658, Scalar(2));
+      ((((_tmp41 + _tmp657) > 0) - ((_tmp41 + _tmp657) < 0)) + 1) / (_tmp658 * _tmp658);
   const Scalar _tmp1305 = _tmp1304 * (_tmp651 * _tmp890 + _tmp652 * _tmp893 + _tmp653 * _tmp895);
   const Scalar _tmp1306 = _tmp663 * _tmp898;
   const Scalar _tmp1307 = -_tmp1305 * _tmp1306 + _tmp664 * (_tmp653 * _tmp888 + _tmp656);
@@ -2867,16 +2868,16 @@ void Linearization(
   const Scalar _tmp2153 = -_tmp1114 * _tmp2152 + _tmp171 * _tmp2151;
   const Scalar _tmp2154 = _tmp1115 * _tmp2149 + _tmp1444 * _tmp2153;
   const Scalar _tmp2155 = -_tmp1238 * _tmp2154 + _tmp1239 * _tmp2154 + _tmp193 * _tmp2153;
-  const Scalar _tmp2156 = std::pow(matches_0_0_weight, Scalar(2)) / std::pow(_tmp767, Scalar(2));
+  const Scalar _tmp2156 = (matches_0_0_weight * matches_0_0_weight) / (_tmp767 * _tmp767);
   const Scalar _tmp2157 = _tmp1119 * _tmp2154 - _tmp1121 * _tmp2154 + _tmp193 * _tmp2149;
-  const Scalar _tmp2158 = std::pow(matches_0_1_weight, Scalar(2)) / std::pow(_tmp770, Scalar(2));
+  const Scalar _tmp2158 = (matches_0_1_weight * matches_0_1_weight) / (_tmp770 * _tmp770);
   const Scalar _tmp2159 = _tmp209 * _tmp2151 - _tmp2152 * _tmp991;
   const Scalar _tmp2160 = _tmp209 * _tmp2146 - _tmp2148 * _tmp992;
   const Scalar _tmp2161 = _tmp1402 * _tmp2159 + _tmp2160 * _tmp995;
   const Scalar _tmp2162 = _tmp1322 * _tmp2161 - _tmp1324 * _tmp2161 + _tmp2159 * _tmp223;
   const Scalar _tmp2163 = _tmp2161 * _tmp997;
   const Scalar _tmp2164 = _tmp1000 * _tmp2163 + _tmp2160 * _tmp223 - _tmp2163 * _tmp998;
-  const Scalar _tmp2165 = std::pow(matches_0_2_weight, Scalar(2)) / std::pow(_tmp773, Scalar(2));
+  const Scalar _tmp2165 = (matches_0_2_weight * matches_0_2_weight) / (_tmp773 * _tmp773);
   const Scalar _tmp2166 = -_tmp1162 * _tmp2152 + _tmp2151 * _tmp239;
   const Scalar _tmp2167 = -_tmp1163 * _tmp2148 + _tmp2146 * _tmp239;
   const Scalar _tmp2168 = _tmp1166 * _tmp2167 + _tmp1511 * _tmp2166;
@@ -2888,10 +2889,10 @@ void Linearization(
       (Scalar(1) / Scalar(2)) * _tmp1057 * _tmp2172 + (Scalar(1) / Scalar(2)) * _tmp1412 * _tmp2171;
   const Scalar _tmp2174 = _tmp2173 * _tmp271;
   const Scalar _tmp2175 = _tmp1059 * _tmp2174 - _tmp1063 * _tmp2174 + _tmp2171 * _tmp283;
-  const Scalar _tmp2176 = std::pow(matches_0_3_weight, Scalar(2)) / std::pow(_tmp776, Scalar(2));
+  const Scalar _tmp2176 = (matches_0_3_weight * matches_0_3_weight) / (_tmp776 * _tmp776);
   const Scalar _tmp2177 = _tmp2173 * _tmp275;
   const Scalar _tmp2178 = _tmp1059 * _tmp2177 - _tmp1063 * _tmp2177 + _tmp2172 * _tmp283;
-  const Scalar _tmp2179 = std::pow(matches_0_4_weight, Scalar(2)) / std::pow(_tmp779, Scalar(2));
+  const Scalar _tmp2179 = (matches_0_4_weight * matches_0_4_weight) / (_tmp779 * _tmp779);
   const Scalar _tmp2180 = -_tmp1187 * _tmp2148 * _tmp303 + _tmp2146 * _tmp299;
   const Scalar _tmp2181 = -_tmp1187 * _tmp2152 * _tmp295 + _tmp2151 * _tmp299;
   const Scalar _tmp2182 = _tmp1191 * _tmp2180 + _tmp1417 * _tmp2181;
@@ -2903,14 +2904,14 @@ void Linearization(
   const Scalar _tmp2188 = _tmp1071 * _tmp2187 + _tmp1458 * _tmp2186;
   const Scalar _tmp2189 = -_tmp1076 * _tmp2188 + _tmp1460 * _tmp2188 + _tmp2186 * _tmp343;
   const Scalar _tmp2190 = -_tmp1279 * _tmp2188 + _tmp1538 * _tmp2188 + _tmp2187 * _tmp343;
-  const Scalar _tmp2191 = std::pow(matches_0_5_weight, Scalar(2)) / std::pow(_tmp782, Scalar(2));
+  const Scalar _tmp2191 = (matches_0_5_weight * matches_0_5_weight) / (_tmp782 * _tmp782);
   const Scalar _tmp2192 = -_tmp1023 * _tmp2148 + _tmp2146 * _tmp359;
   const Scalar _tmp2193 = -_tmp1027 * _tmp2152 + _tmp2151 * _tmp359;
   const Scalar _tmp2194 = _tmp1026 * _tmp2192 + _tmp1466 * _tmp2193;
   const Scalar _tmp2195 = _tmp1034 * _tmp2194 - _tmp1497 * _tmp2194 + _tmp2193 * _tmp373;
   const Scalar _tmp2196 = _tmp1256 * _tmp2194 - _tmp1468 * _tmp2194 + _tmp2192 * _tmp373;
-  const Scalar _tmp2197 = std::pow(matches_0_6_weight, Scalar(2)) / std::pow(_tmp785, Scalar(2));
-  const Scalar _tmp2198 = std::pow(matches_0_7_weight, Scalar(2)) / std::pow(_tmp788, Scalar(2));
+  const Scalar _tmp2197 = (matches_0_6_weight * matches_0_6_weight) / (_tmp785 * _tmp785);
+  const Scalar _tmp2198 = (matches_0_7_weight * matches_0_7_weight) / (_tmp788 * _tmp788);
   const Scalar _tmp2199 = -_tmp1129 * _tmp2152 + _tmp2151 * _tmp389;
   const Scalar _tmp2200 = -_tmp1125 * _tmp2148 + _tmp2146 * _tmp389;
   const Scalar _tmp2201 = _tmp1128 * _tmp2200 + _tmp1432 * _tmp2199;
@@ -2920,21 +2921,21 @@ void Linearization(
   const Scalar _tmp2205 = -_tmp1222 * _tmp2148 + _tmp2146 * _tmp419;
   const Scalar _tmp2206 = _tmp1225 * _tmp2205 + _tmp1360 * _tmp2204;
   const Scalar _tmp2207 = -_tmp1268 * _tmp2206 + _tmp1269 * _tmp2206 + _tmp2204 * _tmp433;
-  const Scalar _tmp2208 = std::pow(matches_0_8_weight, Scalar(2)) / std::pow(_tmp791, Scalar(2));
+  const Scalar _tmp2208 = (matches_0_8_weight * matches_0_8_weight) / (_tmp791 * _tmp791);
   const Scalar _tmp2209 = _tmp1229 * _tmp2206 - _tmp1231 * _tmp2206 + _tmp2205 * _tmp433;
   const Scalar _tmp2210 = -_tmp1290 * _tmp2147 + _tmp2146 * _tmp449;
   const Scalar _tmp2211 = -_tmp1288 * _tmp2152 + _tmp2151 * _tmp449;
   const Scalar _tmp2212 = _tmp1292 * _tmp2210 + _tmp1407 * _tmp2211;
   const Scalar _tmp2213 = _tmp1296 * _tmp2212 - _tmp1298 * _tmp2212 + _tmp2210 * _tmp463;
-  const Scalar _tmp2214 = std::pow(matches_0_9_weight, Scalar(2)) / std::pow(_tmp794, Scalar(2));
+  const Scalar _tmp2214 = (matches_0_9_weight * matches_0_9_weight) / (_tmp794 * _tmp794);
   const Scalar _tmp2215 = _tmp1318 * _tmp2212 - _tmp1319 * _tmp2212 + _tmp2211 * _tmp463;
   const Scalar _tmp2216 = -_tmp1005 * _tmp2152 + _tmp2151 * _tmp479;
   const Scalar _tmp2217 = -_tmp1006 * _tmp2148 + _tmp2146 * _tmp479;
   const Scalar _tmp2218 = _tmp1009 * _tmp2217 + _tmp1438 * _tmp2216;
   const Scalar _tmp2219 = -_tmp1333 * _tmp2218 + _tmp1334 * _tmp2218 + _tmp2216 * _tmp493;
   const Scalar _tmp2220 = _tmp1014 * _tmp2218 - _tmp1017 * _tmp2218 + _tmp2217 * _tmp493;
-  const Scalar _tmp2221 = std::pow(matches_0_10_weight, Scalar(2)) / std::pow(_tmp797, Scalar(2));
-  const Scalar _tmp2222 = std::pow(matches_0_11_weight, Scalar(2)) / std::pow(_tmp800, Scalar(2));
+  const Scalar _tmp2221 = (matches_0_10_weight * matches_0_10_weight) / (_tmp797 * _tmp797);
+  const Scalar _tmp2222 = (matches_0_11_weight * matches_0_11_weight) / (_tmp800 * _tmp800);
   const Scalar _tmp2223 = _tmp2146 * _tmp509 - _tmp2148 * _tmp913;
   const Scalar _tmp2224 = _tmp2151 * _tmp509 - _tmp2152 * _tmp912;
   const Scalar _tmp2225 = _tmp1352 * _tmp2224 + _tmp2223 * _tmp916;
@@ -2944,9 +2945,9 @@ void Linearization(
   const Scalar _tmp2229 = -_tmp1039 * _tmp2148 + _tmp2146 * _tmp539;
   const Scalar _tmp2230 = _tmp1042 * _tmp2229 + _tmp1522 * _tmp2228;
   const Scalar _tmp2231 = -_tmp1259 * _tmp2230 + _tmp1260 * _tmp2230 + _tmp2229 * _tmp553;
-  const Scalar _tmp2232 = std::pow(matches_0_12_weight, Scalar(2)) / std::pow(_tmp803, Scalar(2));
+  const Scalar _tmp2232 = (matches_0_12_weight * matches_0_12_weight) / (_tmp803 * _tmp803);
   const Scalar _tmp2233 = -_tmp1046 * _tmp2230 + _tmp1049 * _tmp2230 + _tmp2228 * _tmp553;
-  const Scalar _tmp2234 = std::pow(matches_0_13_weight, Scalar(2)) / std::pow(_tmp806, Scalar(2));
+  const Scalar _tmp2234 = (matches_0_13_weight * matches_0_13_weight) / (_tmp806 * _tmp806);
   const Scalar _tmp2235 = _tmp2146 * _tmp569 - _tmp2148 * _tmp976;
   const Scalar _tmp2236 = _tmp2151 * _tmp569 - _tmp2152 * _tmp975;
   const Scalar _tmp2237 = _tmp1502 * _tmp2236 + _tmp2235 * _tmp979;
@@ -2957,20 +2958,20 @@ void Linearization(
   const Scalar _tmp2242 = _tmp1450 * _tmp2240 + _tmp2241 * _tmp901;
   const Scalar _tmp2243 = _tmp1252 * _tmp2242 - _tmp1253 * _tmp2242 + _tmp2240 * _tmp613;
   const Scalar _tmp2244 = _tmp2241 * _tmp613 - _tmp2242 * _tmp905 + _tmp2242 * _tmp908;
-  const Scalar _tmp2245 = std::pow(matches_0_14_weight, Scalar(2)) / std::pow(_tmp809, Scalar(2));
-  const Scalar _tmp2246 = std::pow(matches_0_15_weight, Scalar(2)) / std::pow(_tmp812, Scalar(2));
+  const Scalar _tmp2245 = (matches_0_14_weight * matches_0_14_weight) / (_tmp809 * _tmp809);
+  const Scalar _tmp2246 = (matches_0_15_weight * matches_0_15_weight) / (_tmp812 * _tmp812);
   const Scalar _tmp2247 = -_tmp1201 * _tmp2148 + _tmp2146 * _tmp629;
   const Scalar _tmp2248 = -_tmp1210 * _tmp2147 + _tmp2150 * _tmp630;
   const Scalar _tmp2249 = _tmp1204 * _tmp2247 + _tmp1531 * _tmp2248;
   const Scalar _tmp2250 = -_tmp1208 * _tmp2249 + _tmp1212 * _tmp2249 + _tmp2248 * _tmp643;
   const Scalar _tmp2251 = _tmp1301 * _tmp2249 - _tmp1302 * _tmp2249 + _tmp2247 * _tmp643;
-  const Scalar _tmp2252 = std::pow(matches_0_16_weight, Scalar(2)) / std::pow(_tmp815, Scalar(2));
+  const Scalar _tmp2252 = (matches_0_16_weight * matches_0_16_weight) / (_tmp815 * _tmp815);
   const Scalar _tmp2253 = -_tmp1304 * _tmp2152 * _tmp655 + _tmp2151 * _tmp659;
   const Scalar _tmp2254 = -_tmp1850 * _tmp2147 + _tmp2146 * _tmp659;
   const Scalar _tmp2255 = _tmp1308 * _tmp2254 + _tmp1425 * _tmp2253;
   const Scalar _tmp2256 = _tmp1312 * _tmp2255 - _tmp1314 * _tmp2255 + _tmp2254 * _tmp673;
   const Scalar _tmp2257 = _tmp1329 * _tmp2255 - _tmp1330 * _tmp2255 + _tmp2253 * _tmp673;
-  const Scalar _tmp2258 = std::pow(matches_0_17_weight, Scalar(2)) / std::pow(_tmp818, Scalar(2));
+  const Scalar _tmp2258 = (matches_0_17_weight * matches_0_17_weight) / (_tmp818 * _tmp818);
   const Scalar _tmp2259 = -_tmp1087 * _tmp2152 + _tmp2151 * _tmp689;
   const Scalar _tmp2260 = -_tmp1083 * _tmp2148 + _tmp2146 * _tmp689;
   const Scalar _tmp2261 = _tmp1086 * _tmp2260 + _tmp1347 * _tmp2259;
@@ -2981,9 +2982,9 @@ void Linearization(
   const Scalar _tmp2266 = -_tmp1149 * _tmp2152 + _tmp2151 * _tmp719;
   const Scalar _tmp2267 = _tmp1148 * _tmp2265 + _tmp1493 * _tmp2266;
   const Scalar _tmp2268 = _tmp1177 * _tmp2267 - _tmp1178 * _tmp2267 + _tmp2266 * _tmp733;
-  const Scalar _tmp2269 = std::pow(matches_0_18_weight, Scalar(2)) / std::pow(_tmp821, Scalar(2));
+  const Scalar _tmp2269 = (matches_0_18_weight * matches_0_18_weight) / (_tmp821 * _tmp821);
   const Scalar _tmp2270 = -_tmp1153 * _tmp2267 + _tmp1156 * _tmp2267 + _tmp2265 * _tmp733;
-  const Scalar _tmp2271 = std::pow(matches_0_19_weight, Scalar(2)) / std::pow(_tmp824, Scalar(2));
+  const Scalar _tmp2271 = (matches_0_19_weight * matches_0_19_weight) / (_tmp824 * _tmp824);
   const Scalar _tmp2272 = -_tmp1479 * _tmp2147 + _tmp2145 * _tmp754;
   const Scalar _tmp2273 = -_tmp1471 * _tmp2152 + _tmp2151 * _tmp749;
   const Scalar _tmp2274 = _tmp1100 * _tmp2272 + _tmp1474 * _tmp2273;
@@ -3606,32 +3607,24 @@ void Linearization(
     }
     Scalar* hessian_value_ptr = hessian->valuePtr();
 
-    hessian_value_ptr[0] = std::pow(_tmp1002, Scalar(2)) + std::pow(_tmp1018, Scalar(2)) +
-                           std::pow(_tmp1020, Scalar(2)) + std::pow(_tmp1035, Scalar(2)) +
-                           std::pow(_tmp1050, Scalar(2)) + std::pow(_tmp1066, Scalar(2)) +
-                           std::pow(_tmp1080, Scalar(2)) + std::pow(_tmp1095, Scalar(2)) +
-                           std::pow(_tmp1108, Scalar(2)) + std::pow(_tmp1122, Scalar(2)) +
-                           std::pow(_tmp1137, Scalar(2)) + std::pow(_tmp1142, Scalar(2)) +
-                           std::pow(_tmp1157, Scalar(2)) + std::pow(_tmp1173, Scalar(2)) +
-                           std::pow(_tmp1176, Scalar(2)) + std::pow(_tmp1180, Scalar(2)) +
-                           std::pow(_tmp1184, Scalar(2)) + std::pow(_tmp1186, Scalar(2)) +
-                           std::pow(_tmp1198, Scalar(2)) + std::pow(_tmp1213, Scalar(2)) +
-                           std::pow(_tmp1217, Scalar(2)) + std::pow(_tmp1232, Scalar(2)) +
-                           std::pow(_tmp1235, Scalar(2)) + std::pow(_tmp1240, Scalar(2)) +
-                           std::pow(_tmp1244, Scalar(2)) + std::pow(_tmp1249, Scalar(2)) +
-                           std::pow(_tmp1254, Scalar(2)) + std::pow(_tmp1257, Scalar(2)) +
-                           std::pow(_tmp1261, Scalar(2)) + std::pow(_tmp1263, Scalar(2)) +
-                           std::pow(_tmp1266, Scalar(2)) + std::pow(_tmp1270, Scalar(2)) +
-                           std::pow(_tmp1273, Scalar(2)) + std::pow(_tmp1277, Scalar(2)) +
-                           std::pow(_tmp1278, Scalar(2)) + std::pow(_tmp1280, Scalar(2)) +
-                           std::pow(_tmp1285, Scalar(2)) + std::pow(_tmp1299, Scalar(2)) +
-                           std::pow(_tmp1303, Scalar(2)) + std::pow(_tmp1315, Scalar(2)) +
-                           std::pow(_tmp1320, Scalar(2)) + std::pow(_tmp1325, Scalar(2)) +
-                           std::pow(_tmp1326, Scalar(2)) + std::pow(_tmp1331, Scalar(2)) +
-                           std::pow(_tmp1335, Scalar(2)) + std::pow(_tmp882, Scalar(2)) +
-                           std::pow(_tmp909, Scalar(2)) + std::pow(_tmp927, Scalar(2)) +
-                           std::pow(_tmp930, Scalar(2)) + std::pow(_tmp972, Scalar(2)) +
-                           std::pow(_tmp986, Scalar(2)) + std::pow(_tmp988, Scalar(2));
+    hessian_value_ptr[0] = (_tmp1002 * _tmp1002) + (_tmp1018 * _tmp1018) + (_tmp1020 * _tmp1020) +
+                           (_tmp1035 * _tmp1035) + (_tmp1050 * _tmp1050) + (_tmp1066 * _tmp1066) +
+                           (_tmp1080 * _tmp1080) + (_tmp1095 * _tmp1095) + (_tmp1108 * _tmp1108) +
+                           (_tmp1122 * _tmp1122) + (_tmp1137 * _tmp1137) + (_tmp1142 * _tmp1142) +
+                           (_tmp1157 * _tmp1157) + (_tmp1173 * _tmp1173) + (_tmp1176 * _tmp1176) +
+                           (_tmp1180 * _tmp1180) + (_tmp1184 * _tmp1184) + (_tmp1186 * _tmp1186) +
+                           (_tmp1198 * _tmp1198) + (_tmp1213 * _tmp1213) + (_tmp1217 * _tmp1217) +
+                           (_tmp1232 * _tmp1232) + (_tmp1235 * _tmp1235) + (_tmp1240 * _tmp1240) +
+                           (_tmp1244 * _tmp1244) + (_tmp1249 * _tmp1249) + (_tmp1254 * _tmp1254) +
+                           (_tmp1257 * _tmp1257) + (_tmp1261 * _tmp1261) + (_tmp1263 * _tmp1263) +
+                           (_tmp1266 * _tmp1266) + (_tmp1270 * _tmp1270) + (_tmp1273 * _tmp1273) +
+                           (_tmp1277 * _tmp1277) + (_tmp1278 * _tmp1278) + (_tmp1280 * _tmp1280) +
+                           (_tmp1285 * _tmp1285) + (_tmp1299 * _tmp1299) + (_tmp1303 * _tmp1303) +
+                           (_tmp1315 * _tmp1315) + (_tmp1320 * _tmp1320) + (_tmp1325 * _tmp1325) +
+                           (_tmp1326 * _tmp1326) + (_tmp1331 * _tmp1331) + (_tmp1335 * _tmp1335) +
+                           (_tmp882 * _tmp882) + (_tmp909 * _tmp909) + (_tmp927 * _tmp927) +
+                           (_tmp930 * _tmp930) + (_tmp972 * _tmp972) + (_tmp986 * _tmp986) +
+                           (_tmp988 * _tmp988);
     hessian_value_ptr[1] =
         _tmp1002 * _tmp1404 + _tmp1018 * _tmp1534 + _tmp1020 * _tmp1378 + _tmp1035 * _tmp1498 +
         _tmp1050 * _tmp1525 + _tmp1066 * _tmp1499 + _tmp1080 * _tmp1461 + _tmp1095 * _tmp1349 +
@@ -3722,32 +3715,24 @@ void Linearization(
     hessian_value_ptr[23] = _tmp1095 * _tmp2263 + _tmp1244 * _tmp2264;
     hessian_value_ptr[24] = _tmp1157 * _tmp2270 + _tmp1180 * _tmp2268;
     hessian_value_ptr[25] = _tmp1108 * _tmp2277 + _tmp1184 * _tmp2276;
-    hessian_value_ptr[26] = std::pow(_tmp1349, Scalar(2)) + std::pow(_tmp1355, Scalar(2)) +
-                            std::pow(_tmp1362, Scalar(2)) + std::pow(_tmp1363, Scalar(2)) +
-                            std::pow(_tmp1378, Scalar(2)) + std::pow(_tmp1379, Scalar(2)) +
-                            std::pow(_tmp1398, Scalar(2)) + std::pow(_tmp1404, Scalar(2)) +
-                            std::pow(_tmp1409, Scalar(2)) + std::pow(_tmp1414, Scalar(2)) +
-                            std::pow(_tmp1421, Scalar(2)) + std::pow(_tmp1422, Scalar(2)) +
-                            std::pow(_tmp1427, Scalar(2)) + std::pow(_tmp1435, Scalar(2)) +
-                            std::pow(_tmp1441, Scalar(2)) + std::pow(_tmp1446, Scalar(2)) +
-                            std::pow(_tmp1452, Scalar(2)) + std::pow(_tmp1461, Scalar(2)) +
-                            std::pow(_tmp1463, Scalar(2)) + std::pow(_tmp1469, Scalar(2)) +
-                            std::pow(_tmp1477, Scalar(2)) + std::pow(_tmp1478, Scalar(2)) +
-                            std::pow(_tmp1480, Scalar(2)) + std::pow(_tmp1481, Scalar(2)) +
-                            std::pow(_tmp1484, Scalar(2)) + std::pow(_tmp1487, Scalar(2)) +
-                            std::pow(_tmp1488, Scalar(2)) + std::pow(_tmp1490, Scalar(2)) +
-                            std::pow(_tmp1496, Scalar(2)) + std::pow(_tmp1498, Scalar(2)) +
-                            std::pow(_tmp1499, Scalar(2)) + std::pow(_tmp1504, Scalar(2)) +
-                            std::pow(_tmp1505, Scalar(2)) + std::pow(_tmp1508, Scalar(2)) +
-                            std::pow(_tmp1515, Scalar(2)) + std::pow(_tmp1516, Scalar(2)) +
-                            std::pow(_tmp1517, Scalar(2)) + std::pow(_tmp1518, Scalar(2)) +
-                            std::pow(_tmp1519, Scalar(2)) + std::pow(_tmp1525, Scalar(2)) +
-                            std::pow(_tmp1527, Scalar(2)) + std::pow(_tmp1533, Scalar(2)) +
-                            std::pow(_tmp1534, Scalar(2)) + std::pow(_tmp1535, Scalar(2)) +
-                            std::pow(_tmp1536, Scalar(2)) + std::pow(_tmp1539, Scalar(2)) +
-                            std::pow(_tmp1540, Scalar(2)) + std::pow(_tmp1541, Scalar(2)) +
-                            std::pow(_tmp1542, Scalar(2)) + std::pow(_tmp1544, Scalar(2)) +
-                            std::pow(_tmp1545, Scalar(2)) + std::pow(_tmp1547, Scalar(2));
+    hessian_value_ptr[26] = (_tmp1349 * _tmp1349) + (_tmp1355 * _tmp1355) + (_tmp1362 * _tmp1362) +
+                            (_tmp1363 * _tmp1363) + (_tmp1378 * _tmp1378) + (_tmp1379 * _tmp1379) +
+                            (_tmp1398 * _tmp1398) + (_tmp1404 * _tmp1404) + (_tmp1409 * _tmp1409) +
+                            (_tmp1414 * _tmp1414) + (_tmp1421 * _tmp1421) + (_tmp1422 * _tmp1422) +
+                            (_tmp1427 * _tmp1427) + (_tmp1435 * _tmp1435) + (_tmp1441 * _tmp1441) +
+                            (_tmp1446 * _tmp1446) + (_tmp1452 * _tmp1452) + (_tmp1461 * _tmp1461) +
+                            (_tmp1463 * _tmp1463) + (_tmp1469 * _tmp1469) + (_tmp1477 * _tmp1477) +
+                            (_tmp1478 * _tmp1478) + (_tmp1480 * _tmp1480) + (_tmp1481 * _tmp1481) +
+                            (_tmp1484 * _tmp1484) + (_tmp1487 * _tmp1487) + (_tmp1488 * _tmp1488) +
+                            (_tmp1490 * _tmp1490) + (_tmp1496 * _tmp1496) + (_tmp1498 * _tmp1498) +
+                            (_tmp1499 * _tmp1499) + (_tmp1504 * _tmp1504) + (_tmp1505 * _tmp1505) +
+                            (_tmp1508 * _tmp1508) + (_tmp1515 * _tmp1515) + (_tmp1516 * _tmp1516) +
+                            (_tmp1517 * _tmp1517) + (_tmp1518 * _tmp1518) + (_tmp1519 * _tmp1519) +
+                            (_tmp1525 * _tmp1525) + (_tmp1527 * _tmp1527) + (_tmp1533 * _tmp1533) +
+                            (_tmp1534 * _tmp1534) + (_tmp1535 * _tmp1535) + (_tmp1536 * _tmp1536) +
+                            (_tmp1539 * _tmp1539) + (_tmp1540 * _tmp1540) + (_tmp1541 * _tmp1541) +
+                            (_tmp1542 * _tmp1542) + (_tmp1544 * _tmp1544) + (_tmp1545 * _tmp1545) +
+                            (_tmp1547 * _tmp1547);
     hessian_value_ptr[27] =
         _tmp1349 * _tmp1665 + _tmp1355 * _tmp1652 + _tmp1362 * _tmp1637 + _tmp1363 * _tmp1559 +
         _tmp1378 * _tmp1687 + _tmp1379 * _tmp1664 + _tmp1398 * _tmp1648 + _tmp1404 * _tmp1674 +
@@ -3824,32 +3809,24 @@ void Linearization(
     hessian_value_ptr[48] = _tmp1349 * _tmp2263 + _tmp1490 * _tmp2264;
     hessian_value_ptr[49] = _tmp1496 * _tmp2270 + _tmp1547 * _tmp2268;
     hessian_value_ptr[50] = _tmp1477 * _tmp2276 + _tmp1480 * _tmp2277;
-    hessian_value_ptr[51] = std::pow(_tmp1555, Scalar(2)) + std::pow(_tmp1559, Scalar(2)) +
-                            std::pow(_tmp1563, Scalar(2)) + std::pow(_tmp1576, Scalar(2)) +
-                            std::pow(_tmp1580, Scalar(2)) + std::pow(_tmp1582, Scalar(2)) +
-                            std::pow(_tmp1584, Scalar(2)) + std::pow(_tmp1588, Scalar(2)) +
-                            std::pow(_tmp1592, Scalar(2)) + std::pow(_tmp1596, Scalar(2)) +
-                            std::pow(_tmp1597, Scalar(2)) + std::pow(_tmp1610, Scalar(2)) +
-                            std::pow(_tmp1614, Scalar(2)) + std::pow(_tmp1615, Scalar(2)) +
-                            std::pow(_tmp1619, Scalar(2)) + std::pow(_tmp1621, Scalar(2)) +
-                            std::pow(_tmp1625, Scalar(2)) + std::pow(_tmp1629, Scalar(2)) +
-                            std::pow(_tmp1630, Scalar(2)) + std::pow(_tmp1631, Scalar(2)) +
-                            std::pow(_tmp1636, Scalar(2)) + std::pow(_tmp1637, Scalar(2)) +
-                            std::pow(_tmp1641, Scalar(2)) + std::pow(_tmp1646, Scalar(2)) +
-                            std::pow(_tmp1647, Scalar(2)) + std::pow(_tmp1648, Scalar(2)) +
-                            std::pow(_tmp1652, Scalar(2)) + std::pow(_tmp1653, Scalar(2)) +
-                            std::pow(_tmp1654, Scalar(2)) + std::pow(_tmp1655, Scalar(2)) +
-                            std::pow(_tmp1659, Scalar(2)) + std::pow(_tmp1663, Scalar(2)) +
-                            std::pow(_tmp1664, Scalar(2)) + std::pow(_tmp1665, Scalar(2)) +
-                            std::pow(_tmp1669, Scalar(2)) + std::pow(_tmp1670, Scalar(2)) +
-                            std::pow(_tmp1674, Scalar(2)) + std::pow(_tmp1675, Scalar(2)) +
-                            std::pow(_tmp1676, Scalar(2)) + std::pow(_tmp1677, Scalar(2)) +
-                            std::pow(_tmp1678, Scalar(2)) + std::pow(_tmp1679, Scalar(2)) +
-                            std::pow(_tmp1680, Scalar(2)) + std::pow(_tmp1681, Scalar(2)) +
-                            std::pow(_tmp1682, Scalar(2)) + std::pow(_tmp1683, Scalar(2)) +
-                            std::pow(_tmp1685, Scalar(2)) + std::pow(_tmp1686, Scalar(2)) +
-                            std::pow(_tmp1687, Scalar(2)) + std::pow(_tmp1692, Scalar(2)) +
-                            std::pow(_tmp1693, Scalar(2)) + std::pow(_tmp1694, Scalar(2));
+    hessian_value_ptr[51] = (_tmp1555 * _tmp1555) + (_tmp1559 * _tmp1559) + (_tmp1563 * _tmp1563) +
+                            (_tmp1576 * _tmp1576) + (_tmp1580 * _tmp1580) + (_tmp1582 * _tmp1582) +
+                            (_tmp1584 * _tmp1584) + (_tmp1588 * _tmp1588) + (_tmp1592 * _tmp1592) +
+                            (_tmp1596 * _tmp1596) + (_tmp1597 * _tmp1597) + (_tmp1610 * _tmp1610) +
+                            (_tmp1614 * _tmp1614) + (_tmp1615 * _tmp1615) + (_tmp1619 * _tmp1619) +
+                            (_tmp1621 * _tmp1621) + (_tmp1625 * _tmp1625) + (_tmp1629 * _tmp1629) +
+                            (_tmp1630 * _tmp1630) + (_tmp1631 * _tmp1631) + (_tmp1636 * _tmp1636) +
+                            (_tmp1637 * _tmp1637) + (_tmp1641 * _tmp1641) + (_tmp1646 * _tmp1646) +
+                            (_tmp1647 * _tmp1647) + (_tmp1648 * _tmp1648) + (_tmp1652 * _tmp1652) +
+                            (_tmp1653 * _tmp1653) + (_tmp1654 * _tmp1654) + (_tmp1655 * _tmp1655) +
+                            (_tmp1659 * _tmp1659) + (_tmp1663 * _tmp1663) + (_tmp1664 * _tmp1664) +
+                            (_tmp1665 * _tmp1665) + (_tmp1669 * _tmp1669) + (_tmp1670 * _tmp1670) +
+                            (_tmp1674 * _tmp1674) + (_tmp1675 * _tmp1675) + (_tmp1676 * _tmp1676) +
+                            (_tmp1677 * _tmp1677) + (_tmp1678 * _tmp1678) + (_tmp1679 * _tmp1679) +
+                            (_tmp1680 * _tmp1680) + (_tmp1681 * _tmp1681) + (_tmp1682 * _tmp1682) +
+                            (_tmp1683 * _tmp1683) + (_tmp1685 * _tmp1685) + (_tmp1686 * _tmp1686) +
+                            (_tmp1687 * _tmp1687) + (_tmp1692 * _tmp1692) + (_tmp1693 * _tmp1693) +
+                            (_tmp1694 * _tmp1694);
     hessian_value_ptr[52] =
         _tmp1555 * _tmp1878 + _tmp1559 * _tmp1832 + _tmp1563 * _tmp1710 + _tmp1576 * _tmp1890 +
         _tmp1580 * _tmp1870 + _tmp1582 * _tmp1802 + _tmp1584 * _tmp1833 + _tmp1588 * _tmp1860 +
@@ -3912,32 +3889,24 @@ void Linearization(
     hessian_value_ptr[72] = _tmp1625 * _tmp2264 + _tmp1665 * _tmp2263;
     hessian_value_ptr[73] = _tmp1580 * _tmp2270 + _tmp1677 * _tmp2268;
     hessian_value_ptr[74] = _tmp1563 * _tmp2276 + _tmp1682 * _tmp2277;
-    hessian_value_ptr[75] = std::pow(_tmp1703, Scalar(2)) + std::pow(_tmp1710, Scalar(2)) +
-                            std::pow(_tmp1718, Scalar(2)) + std::pow(_tmp1719, Scalar(2)) +
-                            std::pow(_tmp1727, Scalar(2)) + std::pow(_tmp1728, Scalar(2)) +
-                            std::pow(_tmp1729, Scalar(2)) + std::pow(_tmp1737, Scalar(2)) +
-                            std::pow(_tmp1746, Scalar(2)) + std::pow(_tmp1747, Scalar(2)) +
-                            std::pow(_tmp1748, Scalar(2)) + std::pow(_tmp1756, Scalar(2)) +
-                            std::pow(_tmp1757, Scalar(2)) + std::pow(_tmp1765, Scalar(2)) +
-                            std::pow(_tmp1773, Scalar(2)) + std::pow(_tmp1782, Scalar(2)) +
-                            std::pow(_tmp1789, Scalar(2)) + std::pow(_tmp1791, Scalar(2)) +
-                            std::pow(_tmp1792, Scalar(2)) + std::pow(_tmp1800, Scalar(2)) +
-                            std::pow(_tmp1801, Scalar(2)) + std::pow(_tmp1802, Scalar(2)) +
-                            std::pow(_tmp1803, Scalar(2)) + std::pow(_tmp1805, Scalar(2)) +
-                            std::pow(_tmp1814, Scalar(2)) + std::pow(_tmp1815, Scalar(2)) +
-                            std::pow(_tmp1824, Scalar(2)) + std::pow(_tmp1831, Scalar(2)) +
-                            std::pow(_tmp1832, Scalar(2)) + std::pow(_tmp1833, Scalar(2)) +
-                            std::pow(_tmp1835, Scalar(2)) + std::pow(_tmp1836, Scalar(2)) +
-                            std::pow(_tmp1837, Scalar(2)) + std::pow(_tmp1838, Scalar(2)) +
-                            std::pow(_tmp1839, Scalar(2)) + std::pow(_tmp1849, Scalar(2)) +
-                            std::pow(_tmp1858, Scalar(2)) + std::pow(_tmp1860, Scalar(2)) +
-                            std::pow(_tmp1869, Scalar(2)) + std::pow(_tmp1870, Scalar(2)) +
-                            std::pow(_tmp1877, Scalar(2)) + std::pow(_tmp1878, Scalar(2)) +
-                            std::pow(_tmp1879, Scalar(2)) + std::pow(_tmp1887, Scalar(2)) +
-                            std::pow(_tmp1888, Scalar(2)) + std::pow(_tmp1889, Scalar(2)) +
-                            std::pow(_tmp1890, Scalar(2)) + std::pow(_tmp1891, Scalar(2)) +
-                            std::pow(_tmp1892, Scalar(2)) + std::pow(_tmp1893, Scalar(2)) +
-                            std::pow(_tmp1894, Scalar(2)) + std::pow(_tmp1895, Scalar(2));
+    hessian_value_ptr[75] = (_tmp1703 * _tmp1703) + (_tmp1710 * _tmp1710) + (_tmp1718 * _tmp1718) +
+                            (_tmp1719 * _tmp1719) + (_tmp1727 * _tmp1727) + (_tmp1728 * _tmp1728) +
+                            (_tmp1729 * _tmp1729) + (_tmp1737 * _tmp1737) + (_tmp1746 * _tmp1746) +
+                            (_tmp1747 * _tmp1747) + (_tmp1748 * _tmp1748) + (_tmp1756 * _tmp1756) +
+                            (_tmp1757 * _tmp1757) + (_tmp1765 * _tmp1765) + (_tmp1773 * _tmp1773) +
+                            (_tmp1782 * _tmp1782) + (_tmp1789 * _tmp1789) + (_tmp1791 * _tmp1791) +
+                            (_tmp1792 * _tmp1792) + (_tmp1800 * _tmp1800) + (_tmp1801 * _tmp1801) +
+                            (_tmp1802 * _tmp1802) + (_tmp1803 * _tmp1803) + (_tmp1805 * _tmp1805) +
+                            (_tmp1814 * _tmp1814) + (_tmp1815 * _tmp1815) + (_tmp1824 * _tmp1824) +
+                            (_tmp1831 * _tmp1831) + (_tmp1832 * _tmp1832) + (_tmp1833 * _tmp1833) +
+                            (_tmp1835 * _tmp1835) + (_tmp1836 * _tmp1836) + (_tmp1837 * _tmp1837) +
+                            (_tmp1838 * _tmp1838) + (_tmp1839 * _tmp1839) + (_tmp1849 * _tmp1849) +
+                            (_tmp1858 * _tmp1858) + (_tmp1860 * _tmp1860) + (_tmp1869 * _tmp1869) +
+                            (_tmp1870 * _tmp1870) + (_tmp1877 * _tmp1877) + (_tmp1878 * _tmp1878) +
+                            (_tmp1879 * _tmp1879) + (_tmp1887 * _tmp1887) + (_tmp1888 * _tmp1888) +
+                            (_tmp1889 * _tmp1889) + (_tmp1890 * _tmp1890) + (_tmp1891 * _tmp1891) +
+                            (_tmp1892 * _tmp1892) + (_tmp1893 * _tmp1893) + (_tmp1894 * _tmp1894) +
+                            (_tmp1895 * _tmp1895);
     hessian_value_ptr[76] =
         _tmp1703 * _tmp1951 + _tmp1710 * _tmp2014 + _tmp1718 * _tmp1911 + _tmp1719 * _tmp1922 +
         _tmp1727 * _tmp1965 + _tmp1728 * _tmp2016 + _tmp1729 * _tmp1952 + _tmp1737 * _tmp2019 +
@@ -3986,32 +3955,24 @@ void Linearization(
     hessian_value_ptr[95] = _tmp1869 * _tmp2264 + _tmp1893 * _tmp2263;
     hessian_value_ptr[96] = _tmp1727 * _tmp2268 + _tmp1870 * _tmp2270;
     hessian_value_ptr[97] = _tmp1710 * _tmp2276 + _tmp1728 * _tmp2277;
-    hessian_value_ptr[98] = std::pow(_tmp1899, Scalar(2)) + std::pow(_tmp1903, Scalar(2)) +
-                            std::pow(_tmp1907, Scalar(2)) + std::pow(_tmp1911, Scalar(2)) +
-                            std::pow(_tmp1912, Scalar(2)) + std::pow(_tmp1916, Scalar(2)) +
-                            std::pow(_tmp1921, Scalar(2)) + std::pow(_tmp1922, Scalar(2)) +
-                            std::pow(_tmp1923, Scalar(2)) + std::pow(_tmp1929, Scalar(2)) +
-                            std::pow(_tmp1935, Scalar(2)) + std::pow(_tmp1939, Scalar(2)) +
-                            std::pow(_tmp1943, Scalar(2)) + std::pow(_tmp1947, Scalar(2)) +
-                            std::pow(_tmp1951, Scalar(2)) + std::pow(_tmp1952, Scalar(2)) +
-                            std::pow(_tmp1955, Scalar(2)) + std::pow(_tmp1961, Scalar(2)) +
-                            std::pow(_tmp1962, Scalar(2)) + std::pow(_tmp1963, Scalar(2)) +
-                            std::pow(_tmp1964, Scalar(2)) + std::pow(_tmp1965, Scalar(2)) +
-                            std::pow(_tmp1966, Scalar(2)) + std::pow(_tmp1971, Scalar(2)) +
-                            std::pow(_tmp1972, Scalar(2)) + std::pow(_tmp1973, Scalar(2)) +
-                            std::pow(_tmp1978, Scalar(2)) + std::pow(_tmp1982, Scalar(2)) +
-                            std::pow(_tmp1983, Scalar(2)) + std::pow(_tmp1984, Scalar(2)) +
-                            std::pow(_tmp1988, Scalar(2)) + std::pow(_tmp1989, Scalar(2)) +
-                            std::pow(_tmp1990, Scalar(2)) + std::pow(_tmp1994, Scalar(2)) +
-                            std::pow(_tmp1995, Scalar(2)) + std::pow(_tmp1996, Scalar(2)) +
-                            std::pow(_tmp1997, Scalar(2)) + std::pow(_tmp2002, Scalar(2)) +
-                            std::pow(_tmp2003, Scalar(2)) + std::pow(_tmp2004, Scalar(2)) +
-                            std::pow(_tmp2005, Scalar(2)) + std::pow(_tmp2006, Scalar(2)) +
-                            std::pow(_tmp2007, Scalar(2)) + std::pow(_tmp2014, Scalar(2)) +
-                            std::pow(_tmp2015, Scalar(2)) + std::pow(_tmp2016, Scalar(2)) +
-                            std::pow(_tmp2017, Scalar(2)) + std::pow(_tmp2018, Scalar(2)) +
-                            std::pow(_tmp2019, Scalar(2)) + std::pow(_tmp2021, Scalar(2)) +
-                            std::pow(_tmp2022, Scalar(2)) + std::pow(_tmp2023, Scalar(2));
+    hessian_value_ptr[98] = (_tmp1899 * _tmp1899) + (_tmp1903 * _tmp1903) + (_tmp1907 * _tmp1907) +
+                            (_tmp1911 * _tmp1911) + (_tmp1912 * _tmp1912) + (_tmp1916 * _tmp1916) +
+                            (_tmp1921 * _tmp1921) + (_tmp1922 * _tmp1922) + (_tmp1923 * _tmp1923) +
+                            (_tmp1929 * _tmp1929) + (_tmp1935 * _tmp1935) + (_tmp1939 * _tmp1939) +
+                            (_tmp1943 * _tmp1943) + (_tmp1947 * _tmp1947) + (_tmp1951 * _tmp1951) +
+                            (_tmp1952 * _tmp1952) + (_tmp1955 * _tmp1955) + (_tmp1961 * _tmp1961) +
+                            (_tmp1962 * _tmp1962) + (_tmp1963 * _tmp1963) + (_tmp1964 * _tmp1964) +
+                            (_tmp1965 * _tmp1965) + (_tmp1966 * _tmp1966) + (_tmp1971 * _tmp1971) +
+                            (_tmp1972 * _tmp1972) + (_tmp1973 * _tmp1973) + (_tmp1978 * _tmp1978) +
+                            (_tmp1982 * _tmp1982) + (_tmp1983 * _tmp1983) + (_tmp1984 * _tmp1984) +
+                            (_tmp1988 * _tmp1988) + (_tmp1989 * _tmp1989) + (_tmp1990 * _tmp1990) +
+                            (_tmp1994 * _tmp1994) + (_tmp1995 * _tmp1995) + (_tmp1996 * _tmp1996) +
+                            (_tmp1997 * _tmp1997) + (_tmp2002 * _tmp2002) + (_tmp2003 * _tmp2003) +
+                            (_tmp2004 * _tmp2004) + (_tmp2005 * _tmp2005) + (_tmp2006 * _tmp2006) +
+                            (_tmp2007 * _tmp2007) + (_tmp2014 * _tmp2014) + (_tmp2015 * _tmp2015) +
+                            (_tmp2016 * _tmp2016) + (_tmp2017 * _tmp2017) + (_tmp2018 * _tmp2018) +
+                            (_tmp2019 * _tmp2019) + (_tmp2021 * _tmp2021) + (_tmp2022 * _tmp2022) +
+                            (_tmp2023 * _tmp2023);
     hessian_value_ptr[99] =
         _tmp1899 * _tmp2129 + _tmp1903 * _tmp2044 + _tmp1907 * _tmp2035 + _tmp1911 * _tmp2085 +
         _tmp1912 * _tmp2048 + _tmp1916 * _tmp2134 + _tmp1921 * _tmp2118 + _tmp1922 * _tmp2066 +
@@ -4046,32 +4007,24 @@ void Linearization(
     hessian_value_ptr[117] = _tmp1907 * _tmp2264 + _tmp1964 * _tmp2263;
     hessian_value_ptr[118] = _tmp1939 * _tmp2270 + _tmp1965 * _tmp2268;
     hessian_value_ptr[119] = _tmp2014 * _tmp2276 + _tmp2016 * _tmp2277;
-    hessian_value_ptr[120] = std::pow(_tmp2027, Scalar(2)) + std::pow(_tmp2031, Scalar(2)) +
-                             std::pow(_tmp2035, Scalar(2)) + std::pow(_tmp2036, Scalar(2)) +
-                             std::pow(_tmp2040, Scalar(2)) + std::pow(_tmp2044, Scalar(2)) +
-                             std::pow(_tmp2048, Scalar(2)) + std::pow(_tmp2052, Scalar(2)) +
-                             std::pow(_tmp2053, Scalar(2)) + std::pow(_tmp2054, Scalar(2)) +
-                             std::pow(_tmp2060, Scalar(2)) + std::pow(_tmp2064, Scalar(2)) +
-                             std::pow(_tmp2065, Scalar(2)) + std::pow(_tmp2066, Scalar(2)) +
-                             std::pow(_tmp2070, Scalar(2)) + std::pow(_tmp2075, Scalar(2)) +
-                             std::pow(_tmp2079, Scalar(2)) + std::pow(_tmp2080, Scalar(2)) +
-                             std::pow(_tmp2084, Scalar(2)) + std::pow(_tmp2085, Scalar(2)) +
-                             std::pow(_tmp2090, Scalar(2)) + std::pow(_tmp2094, Scalar(2)) +
-                             std::pow(_tmp2095, Scalar(2)) + std::pow(_tmp2100, Scalar(2)) +
-                             std::pow(_tmp2101, Scalar(2)) + std::pow(_tmp2102, Scalar(2)) +
-                             std::pow(_tmp2106, Scalar(2)) + std::pow(_tmp2108, Scalar(2)) +
-                             std::pow(_tmp2110, Scalar(2)) + std::pow(_tmp2111, Scalar(2)) +
-                             std::pow(_tmp2112, Scalar(2)) + std::pow(_tmp2113, Scalar(2)) +
-                             std::pow(_tmp2118, Scalar(2)) + std::pow(_tmp2123, Scalar(2)) +
-                             std::pow(_tmp2124, Scalar(2)) + std::pow(_tmp2125, Scalar(2)) +
-                             std::pow(_tmp2129, Scalar(2)) + std::pow(_tmp2130, Scalar(2)) +
-                             std::pow(_tmp2131, Scalar(2)) + std::pow(_tmp2132, Scalar(2)) +
-                             std::pow(_tmp2133, Scalar(2)) + std::pow(_tmp2134, Scalar(2)) +
-                             std::pow(_tmp2135, Scalar(2)) + std::pow(_tmp2136, Scalar(2)) +
-                             std::pow(_tmp2137, Scalar(2)) + std::pow(_tmp2138, Scalar(2)) +
-                             std::pow(_tmp2139, Scalar(2)) + std::pow(_tmp2140, Scalar(2)) +
-                             std::pow(_tmp2141, Scalar(2)) + std::pow(_tmp2142, Scalar(2)) +
-                             std::pow(_tmp2143, Scalar(2)) + std::pow(_tmp2144, Scalar(2));
+    hessian_value_ptr[120] = (_tmp2027 * _tmp2027) + (_tmp2031 * _tmp2031) + (_tmp2035 * _tmp2035) +
+                             (_tmp2036 * _tmp2036) + (_tmp2040 * _tmp2040) + (_tmp2044 * _tmp2044) +
+                             (_tmp2048 * _tmp2048) + (_tmp2052 * _tmp2052) + (_tmp2053 * _tmp2053) +
+                             (_tmp2054 * _tmp2054) + (_tmp2060 * _tmp2060) + (_tmp2064 * _tmp2064) +
+                             (_tmp2065 * _tmp2065) + (_tmp2066 * _tmp2066) + (_tmp2070 * _tmp2070) +
+                             (_tmp2075 * _tmp2075) + (_tmp2079 * _tmp2079) + (_tmp2080 * _tmp2080) +
+                             (_tmp2084 * _tmp2084) + (_tmp2085 * _tmp2085) + (_tmp2090 * _tmp2090) +
+                             (_tmp2094 * _tmp2094) + (_tmp2095 * _tmp2095) + (_tmp2100 * _tmp2100) +
+                             (_tmp2101 * _tmp2101) + (_tmp2102 * _tmp2102) + (_tmp2106 * _tmp2106) +
+                             (_tmp2108 * _tmp2108) + (_tmp2110 * _tmp2110) + (_tmp2111 * _tmp2111) +
+                             (_tmp2112 * _tmp2112) + (_tmp2113 * _tmp2113) + (_tmp2118 * _tmp2118) +
+                             (_tmp2123 * _tmp2123) + (_tmp2124 * _tmp2124) + (_tmp2125 * _tmp2125) +
+                             (_tmp2129 * _tmp2129) + (_tmp2130 * _tmp2130) + (_tmp2131 * _tmp2131) +
+                             (_tmp2132 * _tmp2132) + (_tmp2133 * _tmp2133) + (_tmp2134 * _tmp2134) +
+                             (_tmp2135 * _tmp2135) + (_tmp2136 * _tmp2136) + (_tmp2137 * _tmp2137) +
+                             (_tmp2138 * _tmp2138) + (_tmp2139 * _tmp2139) + (_tmp2140 * _tmp2140) +
+                             (_tmp2141 * _tmp2141) + (_tmp2142 * _tmp2142) + (_tmp2143 * _tmp2143) +
+                             (_tmp2144 * _tmp2144);
     hessian_value_ptr[121] = _tmp2064 * _tmp2155 + _tmp2136 * _tmp2157;
     hessian_value_ptr[122] = _tmp2090 * _tmp2162 + _tmp2132 * _tmp2164;
     hessian_value_ptr[123] = _tmp2040 * _tmp2170 + _tmp2141 * _tmp2169;
@@ -4092,46 +4045,26 @@ void Linearization(
     hessian_value_ptr[138] = _tmp2035 * _tmp2264 + _tmp2142 * _tmp2263;
     hessian_value_ptr[139] = _tmp2027 * _tmp2270 + _tmp2054 * _tmp2268;
     hessian_value_ptr[140] = _tmp2070 * _tmp2277 + _tmp2101 * _tmp2276;
-    hessian_value_ptr[141] =
-        std::pow(_tmp2155, Scalar(2)) + _tmp2156 + std::pow(_tmp2157, Scalar(2));
-    hessian_value_ptr[142] =
-        _tmp2158 + std::pow(_tmp2162, Scalar(2)) + std::pow(_tmp2164, Scalar(2));
-    hessian_value_ptr[143] =
-        _tmp2165 + std::pow(_tmp2169, Scalar(2)) + std::pow(_tmp2170, Scalar(2));
-    hessian_value_ptr[144] =
-        std::pow(_tmp2175, Scalar(2)) + _tmp2176 + std::pow(_tmp2178, Scalar(2));
-    hessian_value_ptr[145] =
-        _tmp2179 + std::pow(_tmp2184, Scalar(2)) + std::pow(_tmp2185, Scalar(2));
-    hessian_value_ptr[146] =
-        std::pow(_tmp2189, Scalar(2)) + std::pow(_tmp2190, Scalar(2)) + _tmp2191;
-    hessian_value_ptr[147] =
-        std::pow(_tmp2195, Scalar(2)) + std::pow(_tmp2196, Scalar(2)) + _tmp2197;
-    hessian_value_ptr[148] =
-        _tmp2198 + std::pow(_tmp2202, Scalar(2)) + std::pow(_tmp2203, Scalar(2));
-    hessian_value_ptr[149] =
-        std::pow(_tmp2207, Scalar(2)) + _tmp2208 + std::pow(_tmp2209, Scalar(2));
-    hessian_value_ptr[150] =
-        std::pow(_tmp2213, Scalar(2)) + _tmp2214 + std::pow(_tmp2215, Scalar(2));
-    hessian_value_ptr[151] =
-        std::pow(_tmp2219, Scalar(2)) + std::pow(_tmp2220, Scalar(2)) + _tmp2221;
-    hessian_value_ptr[152] =
-        _tmp2222 + std::pow(_tmp2226, Scalar(2)) + std::pow(_tmp2227, Scalar(2));
-    hessian_value_ptr[153] =
-        std::pow(_tmp2231, Scalar(2)) + _tmp2232 + std::pow(_tmp2233, Scalar(2));
-    hessian_value_ptr[154] =
-        _tmp2234 + std::pow(_tmp2238, Scalar(2)) + std::pow(_tmp2239, Scalar(2));
-    hessian_value_ptr[155] =
-        std::pow(_tmp2243, Scalar(2)) + std::pow(_tmp2244, Scalar(2)) + _tmp2245;
-    hessian_value_ptr[156] =
-        _tmp2246 + std::pow(_tmp2250, Scalar(2)) + std::pow(_tmp2251, Scalar(2));
-    hessian_value_ptr[157] =
-        _tmp2252 + std::pow(_tmp2256, Scalar(2)) + std::pow(_tmp2257, Scalar(2));
-    hessian_value_ptr[158] =
-        _tmp2258 + std::pow(_tmp2263, Scalar(2)) + std::pow(_tmp2264, Scalar(2));
-    hessian_value_ptr[159] =
-        std::pow(_tmp2268, Scalar(2)) + _tmp2269 + std::pow(_tmp2270, Scalar(2));
-    hessian_value_ptr[160] =
-        _tmp2271 + std::pow(_tmp2276, Scalar(2)) + std::pow(_tmp2277, Scalar(2));
+    hessian_value_ptr[141] = (_tmp2155 * _tmp2155) + _tmp2156 + (_tmp2157 * _tmp2157);
+    hessian_value_ptr[142] = _tmp2158 + (_tmp2162 * _tmp2162) + (_tmp2164 * _tmp2164);
+    hessian_value_ptr[143] = _tmp2165 + (_tmp2169 * _tmp2169) + (_tmp2170 * _tmp2170);
+    hessian_value_ptr[144] = (_tmp2175 * _tmp2175) + _tmp2176 + (_tmp2178 * _tmp2178);
+    hessian_value_ptr[145] = _tmp2179 + (_tmp2184 * _tmp2184) + (_tmp2185 * _tmp2185);
+    hessian_value_ptr[146] = (_tmp2189 * _tmp2189) + (_tmp2190 * _tmp2190) + _tmp2191;
+    hessian_value_ptr[147] = (_tmp2195 * _tmp2195) + (_tmp2196 * _tmp2196) + _tmp2197;
+    hessian_value_ptr[148] = _tmp2198 + (_tmp2202 * _tmp2202) + (_tmp2203 * _tmp2203);
+    hessian_value_ptr[149] = (_tmp2207 * _tmp2207) + _tmp2208 + (_tmp2209 * _tmp2209);
+    hessian_value_ptr[150] = (_tmp2213 * _tmp2213) + _tmp2214 + (_tmp2215 * _tmp2215);
+    hessian_value_ptr[151] = (_tmp2219 * _tmp2219) + (_tmp2220 * _tmp2220) + _tmp2221;
+    hessian_value_ptr[152] = _tmp2222 + (_tmp2226 * _tmp2226) + (_tmp2227 * _tmp2227);
+    hessian_value_ptr[153] = (_tmp2231 * _tmp2231) + _tmp2232 + (_tmp2233 * _tmp2233);
+    hessian_value_ptr[154] = _tmp2234 + (_tmp2238 * _tmp2238) + (_tmp2239 * _tmp2239);
+    hessian_value_ptr[155] = (_tmp2243 * _tmp2243) + (_tmp2244 * _tmp2244) + _tmp2245;
+    hessian_value_ptr[156] = _tmp2246 + (_tmp2250 * _tmp2250) + (_tmp2251 * _tmp2251);
+    hessian_value_ptr[157] = _tmp2252 + (_tmp2256 * _tmp2256) + (_tmp2257 * _tmp2257);
+    hessian_value_ptr[158] = _tmp2258 + (_tmp2263 * _tmp2263) + (_tmp2264 * _tmp2264);
+    hessian_value_ptr[159] = (_tmp2268 * _tmp2268) + _tmp2269 + (_tmp2270 * _tmp2270);
+    hessian_value_ptr[160] = _tmp2271 + (_tmp2276 * _tmp2276) + (_tmp2277 * _tmp2277);
   }
 }  // NOLINT(readability/fn_size)
 
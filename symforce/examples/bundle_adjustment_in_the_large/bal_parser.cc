@@ -0,0 +1,407 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include "./bal_parser.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <symforce/opt/parallel_for.h>
+
+namespace bundle_adjustment_in_the_large {
+
+namespace {
+
+// Size of the chunks the file is split into for parsing
+constexpr size_t kChunkSize = 1 << 20;
+
+// Longest number we expect in a BAL file
+constexpr size_t kMaxTokenLength = 63;
+
+constexpr std::array<char, 8> kCacheMagic = {'S', 'Y', 'M', 'B', 'A', 'L', '\0', '\2'};
+
+struct CacheHeader {
+  std::array<char, 8> magic;
+  int32_t num_cameras;
+  int32_t num_points;
+  int32_t num_observations;
+  int32_t padding;
+  // The size and modification time of the file the cache was parsed from
+  uint64_t source_size;
+  int64_t source_mtime_ns;
+};
+
+struct FileStamp {
+  uint64_t size;
+  int64_t mtime_ns;
+};
+
+/**
+ * The size and modification time of filename, or false if it can't be stat'ed
+ */
+bool GetFileStamp(const std::string& filename, FileStamp* const stamp) {
+  struct stat file_stat;
+  if (stat(filename.c_str(), &file_stat) != 0) {
+    return false;
+  }
+  // POSIX.1-2008 calls the modification time st_mtim, which macOS calls st_mtimespec
+#ifdef __APPLE__
+  const struct timespec& mtime = file_stat.st_mtimespec;
+#else
+  const struct timespec& mtime = file_stat.st_mtim;
+#endif
+  stamp->size = static_cast<uint64_t>(file_stat.st_size);
+  stamp->mtime_ns = static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+  return true;
+}
+
+/**
+ * A read-only memory mapping of a whole file, unmapped on destruction
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error(fmt::format("Could not open {}", filename));
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+      close(fd);
+      throw std::runtime_error(fmt::format("Could not stat {}", filename));
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+
+    if (size_ > 0) {
+      void* const data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error(fmt::format("Could not mmap {}", filename));
+      }
+      data_ = static_cast<const char*>(data);
+      madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+    }
+    close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* Data() const {
+    return data_;
+  }
+
+  size_t Size() const {
+    return size_;
+  }
+
+ private:
+  const char* data_{nullptr};
+  size_t size_{0};
+};
+
+bool IsSpace(const char c) {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * Calls func(token_begin, token_end) for each whitespace-separated token in [begin, end), stopping
+ * early if func returns false.  Returns false if stopped early.
+ */
+template <typename Func>
+bool ForEachToken(const char* begin, const char* const end, Func&& func) {
+  while (true) {
+    while (begin != end && IsSpace(*begin)) {
+      ++begin;
+    }
+    if (begin == end) {
+      return true;
+    }
+    const char* const token_end = std::find_if(begin, end, IsSpace);
+    if (!func(begin, token_end)) {
+      return false;
+    }
+    begin = token_end;
+  }
+}
+
+/**
+ * Copy the token [begin, end) into buffer with a null terminator, since the mapped file isn't
+ * null-terminated.  Returns false if it's too long to be a number.
+ */
+bool CopyToken(const char* const begin, const char* const end,
+               std::array<char, kMaxTokenLength + 1>* const buffer) {
+  const size_t length = end - begin;
+  if (length > kMaxTokenLength) {
+    return false;
+  }
+  std::copy(begin, end, buffer->begin());
+  (*buffer)[length] = '\0';
+  return true;
+}
+
+/**
+ * Parse the token [begin, end) as a number with strtod.  Returns false if it isn't a number.
+ */
+bool ParseToken(const char* const begin, const char* const end, double* const value) {
+  std::array<char, kMaxTokenLength + 1> buffer;
+  if (!CopyToken(begin, end, &buffer)) {
+    return false;
+  }
+
+  char* parsed_end;
+  *value = std::strtod(buffer.data(), &parsed_end);
+  return parsed_end == buffer.data() + (end - begin);
+}
+
+/**
+ * Parse the token [begin, end) as an integer in [0, limit).  Returns false if it isn't one, so
+ * that e.g. "1.5" or "1e9" is an error rather than being truncated.
+ */
+bool ParseIndexToken(const char* const begin, const char* const end, const int64_t limit,
+                     int32_t* const value) {
+  std::array<char, kMaxTokenLength + 1> buffer;
+  if (!CopyToken(begin, end, &buffer) ||
+      !std::all_of(begin, end, [](const char c) { return c >= '0' && c <= '9'; })) {
+    return false;
+  }
+
+  errno = 0;
+  const long long parsed = std::strtoll(buffer.data(), nullptr, 10);
+  if (errno == ERANGE || parsed >= limit) {
+    return false;
+  }
+  *value = static_cast<int32_t>(parsed);
+  return true;
+}
+
+}  // namespace
+
+BalData ParseBalFile(const std::string& filename, const int num_threads) {
+  const MappedFile file(filename);
+  const char* const file_begin = file.Data();
+  const char* const file_end = file.Data() + file.Size();
+
+  // Read the header
+  BalData data;
+  std::array<int32_t, 3> header;
+  size_t num_header_tokens = 0;
+  const char* header_end = file_begin;
+  ForEachToken(file_begin, file_end, [&](const char* const begin, const char* const end) {
+    if (!ParseIndexToken(begin, end, std::numeric_limits<int32_t>::max(),
+                         &header[num_header_tokens])) {
+      return false;
+    }
+    header_end = end;
+    return ++num_header_tokens < header.size();
+  });
+  if (num_header_tokens != header.size()) {
+    throw std::runtime_error(fmt::format("Invalid BAL header in {}", filename));
+  }
+  data.num_cameras = header[0];
+  data.num_points = header[1];
+  data.num_observations = header[2];
+
+  data.observation_cameras.resize(data.num_observations);
+  data.observation_points.resize(data.num_observations);
+  data.pixels.resize(2 * data.num_observations);
+  data.cameras.resize(9 * data.num_cameras);
+  data.points.resize(3 * data.num_points);
+
+  // Split the rest of the file into chunks that begin at whitespace, so no number is split
+  std::vector<const char*> chunk_begins = {header_end};
+  while (file_end - chunk_begins.back() > static_cast<std::ptrdiff_t>(kChunkSize)) {
+    chunk_begins.push_back(std::find_if(chunk_begins.back() + kChunkSize, file_end, IsSpace));
+  }
+  chunk_begins.push_back(file_end);
+  const size_t num_chunks = chunk_begins.size() - 1;
+
+  // Count the numbers in each chunk, to get the index of the first number of each chunk
+  std::vector<size_t> chunk_first_token(num_chunks + 1, 0);
+  sym::ParallelForBlocks(
+      num_chunks,
+      [&](const size_t begin, const size_t end) {
+        for (size_t chunk = begin; chunk < end; chunk++) {
+          ForEachToken(chunk_begins[chunk], chunk_begins[chunk + 1],
+                       [&](const char* /* token_begin */, const char* /* token_end */) {
+                         chunk_first_token[chunk + 1]++;
+                         return true;
+                       });
+        }
+      },
+      /* block_size */ 1, num_threads);
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    chunk_first_token[chunk + 1] += chunk_first_token[chunk];
+  }
+
+  const size_t num_observation_tokens = 4 * static_cast<size_t>(data.num_observations);
+  const size_t num_camera_tokens = 9 * static_cast<size_t>(data.num_cameras);
+  const size_t num_point_tokens = 3 * static_cast<size_t>(data.num_points);
+  if (chunk_first_token.back() != num_observation_tokens + num_camera_tokens + num_point_tokens) {
+    throw std::runtime_error(fmt::format(
+        "Wrong number of values in {}: expected {}, got {}", filename,
+        num_observation_tokens + num_camera_tokens + num_point_tokens, chunk_first_token.back()));
+  }
+
+  // Parse the numbers in each chunk into their place in data
+  std::vector<char> chunk_failed(num_chunks, false);
+  sym::ParallelForBlocks(
+      num_chunks,
+      [&](const size_t begin, const size_t end) {
+        for (size_t chunk = begin; chunk < end; chunk++) {
+          size_t token = chunk_first_token[chunk];
+          chunk_failed[chunk] = !ForEachToken(
+              chunk_begins[chunk], chunk_begins[chunk + 1],
+              [&](const char* const token_begin, const char* const token_end) {
+                bool parsed;
+                if (token < num_observation_tokens) {
+                  const size_t observation = token / 4;
+                  switch (token % 4) {
+                    case 0:
+                      parsed = ParseIndexToken(token_begin, token_end, data.num_cameras,
+                                               &data.observation_cameras[observation]);
+                      break;
+                    case 1:
+                      parsed = ParseIndexToken(token_begin, token_end, data.num_points,
+                                               &data.observation_points[observation]);
+                      break;
+                    default:
+                      parsed = ParseToken(token_begin, token_end,
+                                          &data.pixels[2 * observation + token % 4 - 2]);
+                  }
+                } else if (token < num_observation_tokens + num_camera_tokens) {
+                  parsed = ParseToken(token_begin, token_end,
+                                      &data.cameras[token - num_observation_tokens]);
+                } else {
+                  parsed =
+                      ParseToken(token_begin, token_end,
+                                 &data.points[token - num_observation_tokens - num_camera_tokens]);
+                }
+
+                token++;
+                return parsed;
+              });
+        }
+      },
+      /* block_size */ 1, num_threads);
+  if (std::any_of(chunk_failed.begin(), chunk_failed.end(), [](const char c) { return c; })) {
+    throw std::runtime_error(
+        fmt::format("Invalid number or camera or point index in {}", filename));
+  }
+
+  return data;
+}
+
+namespace {
+
+template <typename T>
+void WriteArray(std::ofstream& file, const std::vector<T>& array) {
+  file.write(reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T));
+}
+
+template <typename T>
+void ReadArray(std::ifstream& file, std::vector<T>* const array) {
+  file.read(reinterpret_cast<char*>(array->data()), array->size() * sizeof(T));
+}
+
+}  // namespace
+
+void WriteBalCache(const BalData& data, const std::string& source_filename,
+                   const std::string& filename) {
+  FileStamp source_stamp;
+  if (!GetFileStamp(source_filename, &source_stamp)) {
+    throw std::runtime_error(fmt::format("Could not stat {}", source_filename));
+  }
+
+  CacheHeader header{};
+  header.magic = kCacheMagic;
+  header.num_cameras = data.num_cameras;
+  header.num_points = data.num_points;
+  header.num_observations = data.num_observations;
+  header.source_size = source_stamp.size;
+  header.source_mtime_ns = source_stamp.mtime_ns;
+
+  std::ofstream file(filename, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  WriteArray(file, data.observation_cameras);
+  WriteArray(file, data.observation_points);
+  WriteArray(file, data.pixels);
+  WriteArray(file, data.cameras);
+  WriteArray(file, data.points);
+  if (!file) {
+    throw std::runtime_error(fmt::format("Could not write {}", filename));
+  }
+}
+
+bool BalCacheIsCurrent(const std::string& filename, const std::string& source_filename) {
+  FileStamp source_stamp;
+  if (!GetFileStamp(source_filename, &source_stamp)) {
+    return false;
+  }
+
+  std::ifstream file(filename, std::ios::binary);
+  CacheHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  return file && header.magic == kCacheMagic && header.source_size == source_stamp.size &&
+         header.source_mtime_ns == source_stamp.mtime_ns;
+}
+
+BalData ReadBalCache(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  CacheHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file || header.magic != kCacheMagic || header.num_cameras < 0 || header.num_points < 0 ||
+      header.num_observations < 0) {
+    throw std::runtime_error(fmt::format("{} is not a BAL cache", filename));
+  }
+
+  BalData data;
+  data.num_cameras = header.num_cameras;
+  data.num_points = header.num_points;
+  data.num_observations = header.num_observations;
+  data.observation_cameras.resize(data.num_observations);
+  data.observation_points.resize(data.num_observations);
+  data.pixels.resize(2 * data.num_observations);
+  data.cameras.resize(9 * data.num_cameras);
+  data.points.resize(3 * data.num_points);
+
+  ReadArray(file, &data.observation_cameras);
+  ReadArray(file, &data.observation_points);
+  ReadArray(file, &data.pixels);
+  ReadArray(file, &data.cameras);
+  ReadArray(file, &data.points);
+  const auto index_is_invalid = [](const int32_t count) {
+    return [count](const int32_t index) { return index < 0 || index >= count; };
+  };
+  if (!file || file.peek() != std::ifstream::traits_type::eof() ||
+      std::any_of(data.observation_cameras.begin(), data.observation_cameras.end(),
+                  index_is_invalid(data.num_cameras)) ||
+      std::any_of(data.observation_points.begin(), data.observation_points.end(),
+                  index_is_invalid(data.num_points))) {
+    throw std::runtime_error(fmt::format("{} is truncated or corrupted", filename));
+  }
+
+  return data;
+}
+
+}  // namespace bundle_adjustment_in_the_large
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bundle_adjustment_in_the_large {
+
+/**
+ * The contents of a BAL problem file, as flat arrays
+ *
+ * See https://grail.cs.washington.edu/projects/bal/ for file format description
+ */
+struct BalData {
+  int num_cameras;
+  int num_points;
+  int num_observations;
+
+  // The camera and point of each observation
+  std::vector<int32_t> observation_cameras;
+  std::vector<int32_t> observation_points;
+
+  // The observed pixel of each observation, [u, v] per observation
+  std::vector<double> pixels;
+
+  // The parameters of each camera, [rx, ry, rz, tx, ty, tz, f, k1, k2] per camera
+  std::vector<double> cameras;
+
+  // The position of each point, [x, y, z] per point
+  std::vector<double> points;
+};
+
+/**
+ * Parse a BAL problem text file.
+ *
+ * The file is memory-mapped and split into chunks at whitespace, which are parsed on num_threads
+ * threads (or std::thread::hardware_concurrency() if 0): one pass counts the numbers in each chunk,
+ * so that the second pass knows which entry of BalData each number in the chunk goes to.
+ *
+ * Throws std::runtime_error if the file can't be read or isn't a valid BAL problem, including if a
+ * count or index isn't a non-negative integer, or an observation refers to a camera or point that
+ * isn't in the file.
+ */
+BalData ParseBalFile(const std::string& filename, int num_threads = 0);
+
+/**
+ * Write the data parsed from source_filename to filename in a compact binary format, which
+ * ReadBalCache loads much faster than ParseBalFile parses the text file.  The format is
+ * native-endian, so is only meant as a cache on the same machine.
+ *
+ * The size and modification time of source_filename are stored in the cache, so that
+ * BalCacheIsCurrent can tell when the source has changed.
+ *
+ * Throws std::runtime_error if the source can't be read or the file can't be written.
+ */
+void WriteBalCache(const BalData& data, const std::string& source_filename,
+                   const std::string& filename);
+
+/**
+ * Whether filename is a BAL cache written by WriteBalCache from source_filename as it is now, i.e.
+ * the size and modification time of source_filename match the ones stored in the cache.  Returns
+ * false if either file doesn't exist.
+ */
+bool BalCacheIsCurrent(const std::string& filename, const std::string& source_filename);
+
+/**
+ * Read data written by WriteBalCache
+ *
+ * Throws std::runtime_error if the file can't be read, isn't a BAL cache, or is corrupted.
+ */
+BalData ReadBalCache(const std::string& filename);
+
+}  // namespace bundle_adjustment_in_the_large
@@ -3,8 +3,6 @@
  * This source code is under the Apache 2.0 license found in the LICENSE file.
  * ---------------------------------------------------------------------------- */
 
-#include <fstream>
-
 #include <spdlog/spdlog.h>
 
 #include <sym/pose3.h>
@@ -12,6 +10,7 @@
 #include <symforce/opt/optimizer.h>
 #include <symforce/opt/values.h>
 
+#include "./bal_parser.h"
 #include "./gen/keys.h"
 #include "./gen/snavely_reprojection_factor.h"
 
@@ -52,74 +51,77 @@ struct Problem {
 };
 
 /**
- * Read the problem description from the given path
- *
- * See https://grail.cs.washington.edu/projects/bal/ for file format description
+ * Build the Values and factors for the parsed problem, with storage for all of them allocated up
+ * front
  */
-Problem ReadProblem(const std::string& filename) {
-  std::ifstream file(filename);
-
-  int num_cameras, num_points, num_observations;
-  file >> num_cameras;
-  file >> num_points;
-  file >> num_observations;
-
+Problem BuildProblem(const bundle_adjustment_in_the_large::BalData& data) {
   std::vector<sym::Factord> factors;
-  sym::Valuesd values;
-
-  for (int i = 0; i < num_observations; i++) {
-    int camera, point;
-    file >> camera;
-    file >> point;
-
-    double px, py;
-    file >> px;
-    file >> py;
+  factors.reserve(data.num_observations);
 
-    factors.push_back(MakeFactor(camera, point, i));
-    values.Set(sym::Key::WithSuper(PIXEL, i), Eigen::Vector2d(px, py));
+  sym::Valuesd values;
+  values.Reserve(
+      /* num_entries */ data.num_observations + 2 * data.num_cameras + data.num_points + 1,
+      /* num_scalars */ 2 * data.num_observations + 10 * data.num_cameras + 3 * data.num_points +
+          1);
+
+  for (int i = 0; i < data.num_observations; i++) {
+    factors.push_back(MakeFactor(data.observation_cameras[i], data.observation_points[i], i));
+    values.Set(sym::Key::WithSuper(PIXEL, i), Eigen::Vector2d::Map(&data.pixels[2 * i]));
   }
 
-  for (int i = 0; i < num_cameras; i++) {
-    double rx, ry, rz, tx, ty, tz, f, k1, k2;
-    file >> rx;
-    file >> ry;
-    file >> rz;
-    file >> tx;
-    file >> ty;
-    file >> tz;
-    file >> f;
-    file >> k1;
-    file >> k2;
-
+  for (int i = 0; i < data.num_cameras; i++) {
+    const double* const camera = &data.cameras[9 * i];
     values.Set(sym::Key::WithSuper(CAM_T_WORLD, i),
-               sym::Pose3d(sym::Rot3d::FromTangent(Eigen::Vector3d(rx, ry, rz)),
-                           Eigen::Vector3d(tx, ty, tz)));
-    values.Set(sym::Key::WithSuper(INTRINSICS, i), Eigen::Vector3d(f, k1, k2));
+               sym::Pose3d(sym::Rot3d::FromTangent(Eigen::Vector3d::Map(camera)),
+                           Eigen::Vector3d::Map(camera + 3)));
+    values.Set(sym::Key::WithSuper(INTRINSICS, i), Eigen::Vector3d::Map(camera + 6));
   }
 
-  for (int i = 0; i < num_points; i++) {
-    double x, y, z;
-    file >> x;
-    file >> y;
-    file >> z;
-
-    values.Set(sym::Key::WithSuper(POINT, i), Eigen::Vector3d(x, y, z));
+  for (int i = 0; i < data.num_points; i++) {
+    values.Set(sym::Key::WithSuper(POINT, i), Eigen::Vector3d::Map(&data.points[3 * i]));
   }
 
   values.Set(EPSILON, sym::kDefaultEpsilond);
 
-  return {std::move(factors), std::move(values), num_cameras, num_points, num_observations};
+  return {std::move(factors), std::move(values), data.num_cameras, data.num_points,
+          data.num_observations};
+}
+
+/**
+ * Read the problem description from the given path
+ *
+ * See https://grail.cs.washington.edu/projects/bal/ for file format description
+ *
+ * If cache_filename is given, the problem is read from it if it was written from filename as it is
+ * now, and otherwise parsed from filename and written to it, so later runs don't have to parse the
+ * text file again
+ */
+Problem ReadProblem(const std::string& filename, const std::string& cache_filename = "") {
+  bundle_adjustment_in_the_large::BalData data;
+  if (!cache_filename.empty() &&
+      bundle_adjustment_in_the_large::BalCacheIsCurrent(cache_filename, filename)) {
+    data = bundle_adjustment_in_the_large::ReadBalCache(cache_filename);
+  } else {
+    data = bundle_adjustment_in_the_large::ParseBalFile(filename);
+    if (!cache_filename.empty()) {
+      bundle_adjustment_in_the_large::WriteBalCache(data, filename, cache_filename);
+    }
+  }
+
+  return BuildProblem(data);
 }
 
 /**
  * Example usage: `bundle_adjustment_in_the_large_example data/problem-21-11315-pre.txt`
+ *
+ * Optionally pass the path of a binary cache of the problem as a second argument, which is
+ * written on the first run and read instead of the text file on later runs
  */
 int main(int argc, char** argv) {
-  SYM_ASSERT(argc == 2);
+  SYM_ASSERT(argc == 2 || argc == 3);
 
   // Read the problem from disk, and create the Values and factors
-  const auto problem = ReadProblem(argv[1]);
+  const auto problem = ReadProblem(argv[1], argc == 3 ? argv[2] : "");
 
   // Create a copy of the Values - we'll optimize this one in place
   sym::Valuesd optimized_values = problem.values;
@@ -57,9 +57,9 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   const Scalar _tmp9 = _cam_T_world[0] * _tmp8;
   const Scalar _tmp10 = _tmp7 + _tmp9;
   const Scalar _tmp11 = _tmp10 * point(2, 0);
-  const Scalar _tmp12 = std::pow(_cam_T_world[2], Scalar(2));
+  const Scalar _tmp12 = (_cam_T_world[2] * _cam_T_world[2]);
   const Scalar _tmp13 = 2 * _tmp12;
-  const Scalar _tmp14 = std::pow(_cam_T_world[1], Scalar(2));
+  const Scalar _tmp14 = (_cam_T_world[1] * _cam_T_world[1]);
   const Scalar _tmp15 = 2 * _tmp14 - 1;
   const Scalar _tmp16 = -_tmp13 - _tmp15;
   const Scalar _tmp17 = _tmp16 * point(0, 0);
@@ -69,15 +69,15 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   const Scalar _tmp21 = _cam_T_world[0] * _tmp0;
   const Scalar _tmp22 = _cam_T_world[1] * _tmp8;
   const Scalar _tmp23 = _tmp21 + _tmp22;
-  const Scalar _tmp24 = std::pow(_cam_T_world[0], Scalar(2));
+  const Scalar _tmp24 = (_cam_T_world[0] * _cam_T_world[0]);
   const Scalar _tmp25 = 2 * _tmp24;
   const Scalar _tmp26 = _tmp15 + _tmp25;
   const Scalar _tmp27 =
       _cam_T_world[6] + _tmp20 * point(0, 0) + _tmp23 * point(1, 0) - _tmp26 * point(2, 0);
   const Scalar _tmp28 = std::max<Scalar>(epsilon, -_tmp27);
   const Scalar _tmp29 = Scalar(1.0) / (_tmp28);
-  const Scalar _tmp30 = std::pow(_tmp18, Scalar(2));
-  const Scalar _tmp31 = std::pow(_tmp28, Scalar(-2));
+  const Scalar _tmp30 = (_tmp18 * _tmp18);
+  const Scalar _tmp31 = Scalar(1.0) / (_tmp28 * _tmp28);
   const Scalar _tmp32 = _tmp30 * _tmp31;
   const Scalar _tmp33 = _tmp1 + _tmp3;
   const Scalar _tmp34 = _tmp33 * point(0, 0);
@@ -87,10 +87,10 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   const Scalar _tmp38 = -_tmp13 - _tmp25 + 1;
   const Scalar _tmp39 = _tmp38 * point(1, 0);
   const Scalar _tmp40 = _cam_T_world[5] + _tmp34 + _tmp37 + _tmp39;
-  const Scalar _tmp41 = std::pow(_tmp40, Scalar(2));
+  const Scalar _tmp41 = (_tmp40 * _tmp40);
   const Scalar _tmp42 = _tmp31 * _tmp41;
   const Scalar _tmp43 = _tmp32 + _tmp42;
-  const Scalar _tmp44 = std::pow(_tmp43, Scalar(2));
+  const Scalar _tmp44 = (_tmp43 * _tmp43);
   const Scalar _tmp45 = _tmp43 * intrinsics(1, 0) + _tmp44 * intrinsics(2, 0) + 1;
   const Scalar _tmp46 = _tmp29 * _tmp45;
   const Scalar _tmp47 = _tmp46 * intrinsics(0, 0);
@@ -100,7 +100,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   const Scalar _tmp51 = _tmp4 * point(2, 0);
   const Scalar _tmp52 = -_tmp23;
   const Scalar _tmp53 = -_tmp14;
-  const Scalar _tmp54 = std::pow(_cam_T_world[3], Scalar(2));
+  const Scalar _tmp54 = (_cam_T_world[3] * _cam_T_world[3]);
   const Scalar _tmp55 = -_tmp24 + _tmp54;
   const Scalar _tmp56 = _tmp12 + _tmp53 + _tmp55;
   const Scalar _tmp57 = -_tmp52 * point(2, 0) - _tmp56 * point(1, 0);
@@ -117,10 +117,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   const Scalar _tmp67 = -_tmp66 * point(2, 0);
   const Scalar _tmp68 = _tmp31 * _tmp40;
   const Scalar _tmp69 = _tmp68 * (2 * _tmp64 + 2 * _tmp67);
-  const Scalar _tmp70 = _tmp59 / [&]() {
-    const Scalar base = _tmp28;
-    return base * base * base;
-  }();
+  const Scalar _tmp70 = _tmp59 / (_tmp28 * _tmp28 * _tmp28);
   const Scalar _tmp71 = 2 * _tmp70;
   const Scalar _tmp72 = _tmp30 * _tmp71;
   const Scalar _tmp73 = _tmp41 * _tmp71;
@@ -216,19 +213,16 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
                 intrinsics(1, 0) * (_tmp140 + _tmp141 - _tmp26 * _tmp72 - _tmp26 * _tmp73));
   const Scalar _tmp143 = _tmp10 * _tmp47 + _tmp142 * _tmp18 - _tmp26 * _tmp62;
   const Scalar _tmp144 = _tmp142 * _tmp40 - _tmp26 * _tmp81 + _tmp36 * _tmp47;
-  const Scalar _tmp145 = std::pow(intrinsics(0, 0), Scalar(2));
+  const Scalar _tmp145 = (intrinsics(0, 0) * intrinsics(0, 0));
   const Scalar _tmp146 = _tmp145 * _tmp42;
   const Scalar _tmp147 = _tmp42 * _tmp60;
   const Scalar _tmp148 = _tmp146 * _tmp44;
   const Scalar _tmp149 = _tmp145 * _tmp32;
   const Scalar _tmp150 = _tmp32 * _tmp60;
   const Scalar _tmp151 = _tmp149 * _tmp44;
-  const Scalar _tmp152 = std::pow(_tmp45, Scalar(2));
-  const Scalar _tmp153 = [&]() {
-    const Scalar base = _tmp43;
-    return base * base * base;
-  }();
-  const Scalar _tmp154 = std::pow(_tmp43, Scalar(4));
+  const Scalar _tmp152 = (_tmp45 * _tmp45);
+  const Scalar _tmp153 = (_tmp43 * _tmp43 * _tmp43);
+  const Scalar _tmp154 = (_tmp43 * _tmp43 * _tmp43 * _tmp43);
 
   // Output terms (4)
   if (res != nullptr) {
@@ -270,7 +264,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 12, 12>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp80, Scalar(2)) + std::pow(_tmp82, Scalar(2));
+    _hessian(0, 0) = (_tmp80 * _tmp80) + (_tmp82 * _tmp82);
     _hessian(1, 0) = _tmp80 * _tmp92 + _tmp82 * _tmp93;
     _hessian(2, 0) = _tmp102 * _tmp80 + _tmp103 * _tmp82;
     _hessian(3, 0) = _tmp109 * _tmp80 + _tmp110 * _tmp82;
@@ -283,7 +277,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(10, 0) = _tmp138 * _tmp80 + _tmp139 * _tmp82;
     _hessian(11, 0) = _tmp143 * _tmp80 + _tmp144 * _tmp82;
     _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp92, Scalar(2)) + std::pow(_tmp93, Scalar(2));
+    _hessian(1, 1) = (_tmp92 * _tmp92) + (_tmp93 * _tmp93);
     _hessian(2, 1) = _tmp102 * _tmp92 + _tmp103 * _tmp93;
     _hessian(3, 1) = _tmp109 * _tmp92 + _tmp110 * _tmp93;
     _hessian(4, 1) = _tmp114 * _tmp92 + _tmp115 * _tmp93;
@@ -296,7 +290,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(11, 1) = _tmp143 * _tmp92 + _tmp144 * _tmp93;
     _hessian(0, 2) = 0;
     _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp102, Scalar(2)) + std::pow(_tmp103, Scalar(2));
+    _hessian(2, 2) = (_tmp102 * _tmp102) + (_tmp103 * _tmp103);
     _hessian(3, 2) = _tmp102 * _tmp109 + _tmp103 * _tmp110;
     _hessian(4, 2) = _tmp102 * _tmp114 + _tmp103 * _tmp115;
     _hessian(5, 2) = _tmp102 * _tmp117 + _tmp103 * _tmp118;
@@ -309,7 +303,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(0, 3) = 0;
     _hessian(1, 3) = 0;
     _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp107, Scalar(2)) * _tmp146 + std::pow(_tmp109, Scalar(2));
+    _hessian(3, 3) = (_tmp107 * _tmp107) * _tmp146 + (_tmp109 * _tmp109);
     _hessian(4, 3) = _tmp109 * _tmp114 + _tmp110 * _tmp115;
     _hessian(5, 3) = _tmp109 * _tmp117 + _tmp110 * _tmp118;
     _hessian(6, 3) = _tmp107 * _tmp147 + _tmp109 * _tmp119;
@@ -322,7 +316,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(1, 4) = 0;
     _hessian(2, 4) = 0;
     _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp112, Scalar(2)) * _tmp149 + std::pow(_tmp115, Scalar(2));
+    _hessian(4, 4) = (_tmp112 * _tmp112) * _tmp149 + (_tmp115 * _tmp115);
     _hessian(5, 4) = _tmp114 * _tmp117 + _tmp115 * _tmp118;
     _hessian(6, 4) = _tmp112 * _tmp150 + _tmp115 * _tmp120;
     _hessian(7, 4) = _tmp112 * _tmp149 * _tmp43 + _tmp115 * _tmp123;
@@ -335,7 +329,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(2, 5) = 0;
     _hessian(3, 5) = 0;
     _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp117, Scalar(2)) + std::pow(_tmp118, Scalar(2));
+    _hessian(5, 5) = (_tmp117 * _tmp117) + (_tmp118 * _tmp118);
     _hessian(6, 5) = _tmp117 * _tmp119 + _tmp118 * _tmp120;
     _hessian(7, 5) = _tmp117 * _tmp122 + _tmp118 * _tmp123;
     _hessian(8, 5) = _tmp117 * _tmp125 + _tmp118 * _tmp126;
@@ -387,7 +381,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(6, 9) = 0;
     _hessian(7, 9) = 0;
     _hessian(8, 9) = 0;
-    _hessian(9, 9) = std::pow(_tmp133, Scalar(2)) + std::pow(_tmp134, Scalar(2));
+    _hessian(9, 9) = (_tmp133 * _tmp133) + (_tmp134 * _tmp134);
     _hessian(10, 9) = _tmp133 * _tmp138 + _tmp134 * _tmp139;
     _hessian(11, 9) = _tmp133 * _tmp143 + _tmp134 * _tmp144;
     _hessian(0, 10) = 0;
@@ -400,7 +394,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(7, 10) = 0;
     _hessian(8, 10) = 0;
     _hessian(9, 10) = 0;
-    _hessian(10, 10) = std::pow(_tmp138, Scalar(2)) + std::pow(_tmp139, Scalar(2));
+    _hessian(10, 10) = (_tmp138 * _tmp138) + (_tmp139 * _tmp139);
     _hessian(11, 10) = _tmp138 * _tmp143 + _tmp139 * _tmp144;
     _hessian(0, 11) = 0;
     _hessian(1, 11) = 0;
@@ -413,7 +407,7 @@ void SnavelyReprojectionFactor(const sym::Pose3<Scalar>& cam_T_world,
     _hessian(8, 11) = 0;
     _hessian(9, 11) = 0;
     _hessian(10, 11) = 0;
-    _hessian(11, 11) = std::pow(_tmp143, Scalar(2)) + std::pow(_tmp144, Scalar(2));
+    _hessian(11, 11) = (_tmp143 * _tmp143) + (_tmp144 * _tmp144);
   }
 
   if (rhs != nullptr) {
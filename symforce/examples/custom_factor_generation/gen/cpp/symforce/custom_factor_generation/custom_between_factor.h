@@ -85,7 +85,7 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
   const Scalar _tmp30 = _tmp21 * _tmp29;
   const Scalar _tmp31 = 1 - epsilon;
   const Scalar _tmp32 = std::min<Scalar>(_tmp31, std::fabs(_tmp26 - _tmp27));
-  const Scalar _tmp33 = std::acos(_tmp32) / std::sqrt(Scalar(1 - std::pow(_tmp32, Scalar(2))));
+  const Scalar _tmp33 = std::acos(_tmp32) / std::sqrt(Scalar(1 - (_tmp32 * _tmp32)));
   const Scalar _tmp34 = _tmp20 * _tmp30 * _tmp33;
   const Scalar _tmp35 = _tmp29 * _tmp33;
   const Scalar _tmp36 = Scalar(1.0) / (epsilon + prior_sigmas(1, 0));
@@ -97,10 +97,10 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
       _tmp39 * (-_target_T_src_prior[0] * _tmp9 + _target_T_src_prior[1] * _tmp14 -
                 _target_T_src_prior[2] * _tmp19 + _target_T_src_prior[3] * _tmp4);
   const Scalar _tmp41 = _tmp35 * _tmp40;
-  const Scalar _tmp42 = std::pow(_nav_T_target[1], Scalar(2));
+  const Scalar _tmp42 = (_nav_T_target[1] * _nav_T_target[1]);
   const Scalar _tmp43 = 2 * _tmp42;
   const Scalar _tmp44 = -_tmp43;
-  const Scalar _tmp45 = std::pow(_nav_T_target[2], Scalar(2));
+  const Scalar _tmp45 = (_nav_T_target[2] * _nav_T_target[2]);
   const Scalar _tmp46 = 2 * _tmp45;
   const Scalar _tmp47 = -_tmp46;
   const Scalar _tmp48 = _tmp44 + _tmp47 + 1;
@@ -120,7 +120,7 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
                         _target_T_src_prior[4] - _tmp53 - _tmp59 + _tmp60;
   const Scalar _tmp62 = epsilon + prior_sigmas(3, 0);
   const Scalar _tmp63 = _tmp22 / _tmp62;
-  const Scalar _tmp64 = std::pow(_nav_T_target[0], Scalar(2));
+  const Scalar _tmp64 = (_nav_T_target[0] * _nav_T_target[0]);
   const Scalar _tmp65 = 2 * _tmp64;
   const Scalar _tmp66 = 1 - _tmp65;
   const Scalar _tmp67 = _tmp47 + _tmp66;
@@ -178,7 +178,7 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
   const Scalar _tmp117 = std::fabs(_tmp116);
   const Scalar _tmp118 = std::min<Scalar>(_tmp117, _tmp31);
   const Scalar _tmp119 = std::acos(_tmp118);
-  const Scalar _tmp120 = 1 - std::pow(_tmp118, Scalar(2));
+  const Scalar _tmp120 = 1 - (_tmp118 * _tmp118);
   const Scalar _tmp121 = _tmp28 * ((((-_tmp117 + _tmp31) > 0) - ((-_tmp117 + _tmp31) < 0)) + 1) *
                          (((_tmp116) > 0) - ((_tmp116) < 0));
   const Scalar _tmp122 = _tmp118 * _tmp119 * _tmp121 / (_tmp120 * std::sqrt(_tmp120));
@@ -265,7 +265,7 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
   const Scalar _tmp193 = _target_T_src_prior[1] * _tmp185;
   const Scalar _tmp194 =
       _tmp143 * _tmp187 + _tmp149 * (_tmp148 - _tmp156 + _tmp193) - _tmp189 * _tmp40;
-  const Scalar _tmp195 = std::pow(_nav_T_target[3], Scalar(2));
+  const Scalar _tmp195 = (_nav_T_target[3] * _nav_T_target[3]);
   const Scalar _tmp196 = -_tmp42;
   const Scalar _tmp197 = -_tmp64;
   const Scalar _tmp198 = _tmp195 + _tmp196 + _tmp197 + _tmp45;
@@ -324,9 +324,9 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
   const Scalar _tmp236 = _tmp65 - 1;
   const Scalar _tmp237 = _tmp236 + _tmp46;
   const Scalar _tmp238 = _tmp236 + _tmp43;
-  const Scalar _tmp239 = prior_weight / std::pow(_tmp87, Scalar(2));
-  const Scalar _tmp240 = prior_weight / std::pow(_tmp77, Scalar(2));
-  const Scalar _tmp241 = prior_weight / std::pow(_tmp62, Scalar(2));
+  const Scalar _tmp239 = prior_weight / (_tmp87 * _tmp87);
+  const Scalar _tmp240 = prior_weight / (_tmp77 * _tmp77);
+  const Scalar _tmp241 = prior_weight / (_tmp62 * _tmp62);
   const Scalar _tmp242 = _tmp239 * _tmp81;
   const Scalar _tmp243 = _tmp241 * _tmp52;
   const Scalar _tmp244 = _tmp240 * _tmp67;
@@ -443,26 +443,23 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
 
     _hessian.setZero();
 
-    _hessian(0, 0) =
-        std::pow(_tmp133, Scalar(2)) + std::pow(_tmp142, Scalar(2)) + std::pow(_tmp150, Scalar(2));
+    _hessian(0, 0) = (_tmp133 * _tmp133) + (_tmp142 * _tmp142) + (_tmp150 * _tmp150);
     _hessian(1, 0) = _tmp133 * _tmp161 + _tmp142 * _tmp166 + _tmp150 * _tmp170;
     _hessian(2, 0) = _tmp133 * _tmp178 + _tmp142 * _tmp181 + _tmp150 * _tmp184;
     _hessian(6, 0) = _tmp133 * _tmp190 + _tmp142 * _tmp192 + _tmp150 * _tmp194;
     _hessian(7, 0) = _tmp133 * _tmp211 + _tmp142 * _tmp212 + _tmp150 * _tmp213;
     _hessian(8, 0) = _tmp133 * _tmp225 + _tmp142 * _tmp226 + _tmp150 * _tmp227;
-    _hessian(1, 1) =
-        std::pow(_tmp161, Scalar(2)) + std::pow(_tmp166, Scalar(2)) + std::pow(_tmp170, Scalar(2));
+    _hessian(1, 1) = (_tmp161 * _tmp161) + (_tmp166 * _tmp166) + (_tmp170 * _tmp170);
     _hessian(2, 1) = _tmp161 * _tmp178 + _tmp166 * _tmp181 + _tmp170 * _tmp184;
     _hessian(6, 1) = _tmp161 * _tmp190 + _tmp166 * _tmp192 + _tmp170 * _tmp194;
     _hessian(7, 1) = _tmp161 * _tmp211 + _tmp166 * _tmp212 + _tmp170 * _tmp213;
     _hessian(8, 1) = _tmp161 * _tmp225 + _tmp166 * _tmp226 + _tmp170 * _tmp227;
-    _hessian(2, 2) =
-        std::pow(_tmp178, Scalar(2)) + std::pow(_tmp181, Scalar(2)) + std::pow(_tmp184, Scalar(2));
+    _hessian(2, 2) = (_tmp178 * _tmp178) + (_tmp181 * _tmp181) + (_tmp184 * _tmp184);
     _hessian(6, 2) = _tmp178 * _tmp190 + _tmp181 * _tmp192 + _tmp184 * _tmp194;
     _hessian(7, 2) = _tmp178 * _tmp211 + _tmp181 * _tmp212 + _tmp184 * _tmp213;
     _hessian(8, 2) = _tmp178 * _tmp225 + _tmp181 * _tmp226 + _tmp184 * _tmp227;
-    _hessian(3, 3) = _tmp239 * std::pow(_tmp83, Scalar(2)) + _tmp240 * std::pow(_tmp73, Scalar(2)) +
-                     _tmp241 * std::pow(_tmp48, Scalar(2));
+    _hessian(3, 3) =
+        _tmp239 * (_tmp83 * _tmp83) + _tmp240 * (_tmp73 * _tmp73) + _tmp241 * (_tmp48 * _tmp48);
     _hessian(4, 3) = _tmp242 * _tmp83 + _tmp243 * _tmp48 + _tmp244 * _tmp73;
     _hessian(5, 3) = _tmp240 * _tmp70 * _tmp73 + _tmp245 * _tmp83 + _tmp246 * _tmp48;
     _hessian(6, 3) = _tmp247 * _tmp73 + _tmp248 * _tmp83;
@@ -471,8 +468,8 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
     _hessian(9, 3) = _tmp218 * _tmp239 * _tmp83 + _tmp253 * _tmp73 + _tmp254 * _tmp48;
     _hessian(10, 3) = _tmp255 * _tmp83 + _tmp256 * _tmp48 + _tmp257 * _tmp73;
     _hessian(11, 3) = _tmp233 * _tmp241 * _tmp48 + _tmp258 * _tmp83 + _tmp259 * _tmp73;
-    _hessian(4, 4) = _tmp239 * std::pow(_tmp81, Scalar(2)) + _tmp240 * std::pow(_tmp67, Scalar(2)) +
-                     _tmp241 * std::pow(_tmp52, Scalar(2));
+    _hessian(4, 4) =
+        _tmp239 * (_tmp81 * _tmp81) + _tmp240 * (_tmp67 * _tmp67) + _tmp241 * (_tmp52 * _tmp52);
     _hessian(5, 4) = _tmp242 * _tmp79 + _tmp243 * _tmp58 + _tmp244 * _tmp70;
     _hessian(6, 4) = _tmp199 * _tmp244 + _tmp208 * _tmp242;
     _hessian(7, 4) = _tmp222 * _tmp242 + _tmp250 * _tmp52;
@@ -480,47 +477,41 @@ void CustomBetweenFactor(const sym::Pose3<Scalar>& nav_T_src,
     _hessian(9, 4) = _tmp207 * _tmp244 + _tmp218 * _tmp242 + _tmp254 * _tmp52;
     _hessian(10, 4) = _tmp255 * _tmp81 + _tmp256 * _tmp52 + _tmp257 * _tmp67;
     _hessian(11, 4) = _tmp233 * _tmp243 + _tmp238 * _tmp242 + _tmp259 * _tmp67;
-    _hessian(5, 5) = _tmp239 * std::pow(_tmp79, Scalar(2)) + _tmp240 * std::pow(_tmp70, Scalar(2)) +
-                     _tmp241 * std::pow(_tmp58, Scalar(2));
+    _hessian(5, 5) =
+        _tmp239 * (_tmp79 * _tmp79) + _tmp240 * (_tmp70 * _tmp70) + _tmp241 * (_tmp58 * _tmp58);
     _hessian(6, 5) = _tmp247 * _tmp70 + _tmp248 * _tmp79;
     _hessian(7, 5) = _tmp249 * _tmp79 + _tmp250 * _tmp58;
     _hessian(8, 5) = _tmp251 * _tmp70 + _tmp252 * _tmp58;
     _hessian(9, 5) = _tmp218 * _tmp245 + _tmp253 * _tmp70 + _tmp254 * _tmp58;
     _hessian(10, 5) = _tmp255 * _tmp79 + _tmp256 * _tmp58 + _tmp257 * _tmp70;
     _hessian(11, 5) = _tmp233 * _tmp246 + _tmp258 * _tmp79 + _tmp259 * _tmp70;
-    _hessian(6, 6) = std::pow(_tmp190, Scalar(2)) + std::pow(_tmp192, Scalar(2)) +
-                     std::pow(_tmp194, Scalar(2)) + std::pow(_tmp199, Scalar(2)) * _tmp240 +
-                     std::pow(_tmp208, Scalar(2)) * _tmp239;
+    _hessian(6, 6) = (_tmp190 * _tmp190) + (_tmp192 * _tmp192) + (_tmp194 * _tmp194) +
+                     (_tmp199 * _tmp199) * _tmp240 + (_tmp208 * _tmp208) * _tmp239;
     _hessian(7, 6) = _tmp190 * _tmp211 + _tmp192 * _tmp212 + _tmp194 * _tmp213 + _tmp222 * _tmp248;
     _hessian(8, 6) = _tmp190 * _tmp225 + _tmp192 * _tmp226 + _tmp194 * _tmp227 + _tmp199 * _tmp251;
     _hessian(9, 6) = _tmp199 * _tmp253 + _tmp218 * _tmp248;
     _hessian(10, 6) = _tmp199 * _tmp257 + _tmp208 * _tmp255;
     _hessian(11, 6) = _tmp199 * _tmp259 + _tmp238 * _tmp248;
-    _hessian(7, 7) = std::pow(_tmp211, Scalar(2)) + std::pow(_tmp212, Scalar(2)) +
-                     std::pow(_tmp213, Scalar(2)) + std::pow(_tmp219, Scalar(2)) * _tmp241 +
-                     std::pow(_tmp222, Scalar(2)) * _tmp239;
+    _hessian(7, 7) = (_tmp211 * _tmp211) + (_tmp212 * _tmp212) + (_tmp213 * _tmp213) +
+                     (_tmp219 * _tmp219) * _tmp241 + (_tmp222 * _tmp222) * _tmp239;
     _hessian(8, 7) = _tmp211 * _tmp225 + _tmp212 * _tmp226 + _tmp213 * _tmp227 + _tmp230 * _tmp250;
     _hessian(9, 7) = _tmp218 * _tmp249 + _tmp235 * _tmp250;
     _hessian(10, 7) = _tmp222 * _tmp255 + _tmp232 * _tmp250;
     _hessian(11, 7) = _tmp233 * _tmp250 + _tmp238 * _tmp249;
-    _hessian(8, 8) = std::pow(_tmp225, Scalar(2)) + std::pow(_tmp226, Scalar(2)) +
-                     std::pow(_tmp227, Scalar(2)) + std::pow(_tmp230, Scalar(2)) * _tmp241 +
-                     std::pow(_tmp234, Scalar(2)) * _tmp240;
+    _hessian(8, 8) = (_tmp225 * _tmp225) + (_tmp226 * _tmp226) + (_tmp227 * _tmp227) +
+                     (_tmp230 * _tmp230) * _tmp241 + (_tmp234 * _tmp234) * _tmp240;
     _hessian(9, 8) = _tmp207 * _tmp251 + _tmp230 * _tmp254;
     _hessian(10, 8) = _tmp232 * _tmp252 + _tmp234 * _tmp257;
     _hessian(11, 8) = _tmp233 * _tmp252 + _tmp234 * _tmp259;
-    _hessian(9, 9) = std::pow(_tmp207, Scalar(2)) * _tmp240 +
-                     std::pow(_tmp218, Scalar(2)) * _tmp239 +
-                     std::pow(_tmp235, Scalar(2)) * _tmp241;
+    _hessian(9, 9) = (_tmp207 * _tmp207) * _tmp240 + (_tmp218 * _tmp218) * _tmp239 +
+                     (_tmp235 * _tmp235) * _tmp241;
     _hessian(10, 9) = _tmp207 * _tmp257 + _tmp218 * _tmp255 + _tmp232 * _tmp254;
     _hessian(11, 9) = _tmp207 * _tmp259 + _tmp218 * _tmp258 + _tmp233 * _tmp254;
-    _hessian(10, 10) = std::pow(_tmp216, Scalar(2)) * _tmp239 +
-                       std::pow(_tmp232, Scalar(2)) * _tmp241 +
-                       std::pow(_tmp237, Scalar(2)) * _tmp240;
+    _hessian(10, 10) = (_tmp216 * _tmp216) * _tmp239 + (_tmp232 * _tmp232) * _tmp241 +
+                       (_tmp237 * _tmp237) * _tmp240;
     _hessian(11, 10) = _tmp205 * _tmp257 + _tmp233 * _tmp256 + _tmp238 * _tmp255;
-    _hessian(11, 11) = std::pow(_tmp205, Scalar(2)) * _tmp240 +
-                       std::pow(_tmp233, Scalar(2)) * _tmp241 +
-                       std::pow(_tmp238, Scalar(2)) * _tmp239;
+    _hessian(11, 11) = (_tmp205 * _tmp205) * _tmp240 + (_tmp233 * _tmp233) * _tmp241 +
+                       (_tmp238 * _tmp238) * _tmp239;
   }
 
   if (rhs != nullptr) {
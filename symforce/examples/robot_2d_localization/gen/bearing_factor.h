@@ -45,17 +45,17 @@ void BearingFactor(const sym::Pose2<Scalar>& pose, const Eigen::Matrix<Scalar, 2
       _tmp9 - 2 * Scalar(M_PI) *
                   std::floor((Scalar(1) / Scalar(2)) * (_tmp9 + Scalar(M_PI)) / Scalar(M_PI));
   const Scalar _tmp11 = Scalar(1.0) / (_tmp8);
-  const Scalar _tmp12 = std::pow(_tmp8, Scalar(2));
+  const Scalar _tmp12 = (_tmp8 * _tmp8);
   const Scalar _tmp13 = _tmp3 / _tmp12;
   const Scalar _tmp14 = _tmp11 * (_tmp4 - _tmp5 - _tmp6) - _tmp13 * (_tmp0 - _tmp1 + _tmp2);
-  const Scalar _tmp15 = _tmp12 + std::pow(_tmp3, Scalar(2));
+  const Scalar _tmp15 = _tmp12 + (_tmp3 * _tmp3);
   const Scalar _tmp16 = _tmp12 / _tmp15;
   const Scalar _tmp17 = _tmp14 * _tmp16;
   const Scalar _tmp18 = _pose[0] * _tmp13 + _pose[1] * _tmp11;
   const Scalar _tmp19 = _tmp16 * _tmp18;
   const Scalar _tmp20 = -_pose[0] * _tmp11 + _pose[1] * _tmp13;
   const Scalar _tmp21 = _tmp16 * _tmp20;
-  const Scalar _tmp22 = std::pow(_tmp8, Scalar(4)) / std::pow(_tmp15, Scalar(2));
+  const Scalar _tmp22 = (_tmp8 * _tmp8 * _tmp8 * _tmp8) / (_tmp15 * _tmp15);
   const Scalar _tmp23 = _tmp18 * _tmp22;
 
   // Output terms (4)
@@ -76,15 +76,15 @@ void BearingFactor(const sym::Pose2<Scalar>& pose, const Eigen::Matrix<Scalar, 2
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 3, 3>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp14, Scalar(2)) * _tmp22;
+    _hessian(0, 0) = (_tmp14 * _tmp14) * _tmp22;
     _hessian(1, 0) = _tmp14 * _tmp23;
     _hessian(2, 0) = _tmp14 * _tmp20 * _tmp22;
     _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp18, Scalar(2)) * _tmp22;
+    _hessian(1, 1) = (_tmp18 * _tmp18) * _tmp22;
     _hessian(2, 1) = _tmp20 * _tmp23;
     _hessian(0, 2) = 0;
     _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp20, Scalar(2)) * _tmp22;
+    _hessian(2, 2) = (_tmp20 * _tmp20) * _tmp22;
   }
 
   if (rhs != nullptr) {
@@ -33,9 +33,9 @@ void OdometryFactor(const sym::Pose2<Scalar>& pose_a, const sym::Pose2<Scalar>&
 
   // Intermediate terms (17)
   const Scalar _tmp0 = -_pose_a[3] + _pose_b[3];
-  const Scalar _tmp1 = std::pow(_tmp0, Scalar(2));
+  const Scalar _tmp1 = (_tmp0 * _tmp0);
   const Scalar _tmp2 = -_pose_a[2] + _pose_b[2];
-  const Scalar _tmp3 = std::pow(_tmp2, Scalar(2));
+  const Scalar _tmp3 = (_tmp2 * _tmp2);
   const Scalar _tmp4 = _tmp1 + _tmp3 + epsilon;
   const Scalar _tmp5 = std::sqrt(_tmp4);
   const Scalar _tmp6 = _tmp5 - dist;
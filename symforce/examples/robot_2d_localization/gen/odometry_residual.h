@@ -30,9 +30,12 @@ Eigen::Matrix<Scalar, 1, 1> OdometryResidual(const sym::Pose2<Scalar>& pose_a,
   // Output terms (1)
   Eigen::Matrix<Scalar, 1, 1> _res;
 
-  _res(0, 0) =
-      -dist + std::sqrt(Scalar(epsilon + std::pow(Scalar(-_pose_a[2] + _pose_b[2]), Scalar(2)) +
-                               std::pow(Scalar(-_pose_a[3] + _pose_b[3]), Scalar(2))));
+  _res(0, 0) = -dist +
+               std::sqrt(Scalar(epsilon +
+                                [&]() { const Scalar base = -_pose_a[2] +
+                                    _pose_b[2]; return base * base; }() +
+                                [&]() { const Scalar base = -_pose_a[3] +
+                                    _pose_b[3]; return base * base; }()));
 
   return _res;
 }  // NOLINT(readability/fn_size)
@@ -184,10 +184,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
       odometry_relative_pose_measurements_3_.Data();
 
   // Intermediate terms (2870)
-  const Scalar _tmp0 = std::pow(_world_T_body_0_[2], Scalar(2));
+  const Scalar _tmp0 = (_world_T_body_0_[2] * _world_T_body_0_[2]);
   const Scalar _tmp1 = 2 * _tmp0;
   const Scalar _tmp2 = -_tmp1;
-  const Scalar _tmp3 = std::pow(_world_T_body_0_[1], Scalar(2));
+  const Scalar _tmp3 = (_world_T_body_0_[1] * _world_T_body_0_[1]);
   const Scalar _tmp4 = 2 * _tmp3;
   const Scalar _tmp5 = 1 - _tmp4;
   const Scalar _tmp6 = _tmp2 + _tmp5;
@@ -208,7 +208,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp21 =
       _tmp19 + _tmp20 + _tmp6 * world_t_landmark_0_(0, 0) - body_t_landmark_measurements_0_0_(0, 0);
   const Scalar _tmp22 = Scalar(1.0) / (matching_sigma);
-  const Scalar _tmp23 = std::pow(_world_T_body_0_[0], Scalar(2));
+  const Scalar _tmp23 = (_world_T_body_0_[0] * _world_T_body_0_[0]);
   const Scalar _tmp24 = 2 * _tmp23;
   const Scalar _tmp25 = -_tmp24;
   const Scalar _tmp26 = _tmp2 + _tmp25 + 1;
@@ -406,10 +406,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp160 = _tmp39 * world_t_landmark_19_(0, 0) + _tmp42 * world_t_landmark_19_(1, 0);
   const Scalar _tmp161 = _tmp160 + _tmp38 * world_t_landmark_19_(2, 0) + _tmp45 -
                          body_t_landmark_measurements_0_19_(2, 0);
-  const Scalar _tmp162 = std::pow(_world_T_body_1_[2], Scalar(2));
+  const Scalar _tmp162 = (_world_T_body_1_[2] * _world_T_body_1_[2]);
   const Scalar _tmp163 = 2 * _tmp162;
   const Scalar _tmp164 = -_tmp163;
-  const Scalar _tmp165 = std::pow(_world_T_body_1_[1], Scalar(2));
+  const Scalar _tmp165 = (_world_T_body_1_[1] * _world_T_body_1_[1]);
   const Scalar _tmp166 = 2 * _tmp165;
   const Scalar _tmp167 = -_tmp166;
   const Scalar _tmp168 = _tmp164 + _tmp167 + 1;
@@ -429,7 +429,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp182 = _tmp172 * world_t_landmark_0_(1, 0) + _tmp178 * world_t_landmark_0_(2, 0);
   const Scalar _tmp183 = _tmp168 * world_t_landmark_0_(0, 0) + _tmp181 + _tmp182 -
                          body_t_landmark_measurements_1_0_(0, 0);
-  const Scalar _tmp184 = std::pow(_world_T_body_1_[0], Scalar(2));
+  const Scalar _tmp184 = (_world_T_body_1_[0] * _world_T_body_1_[0]);
   const Scalar _tmp185 = 2 * _tmp184;
   const Scalar _tmp186 = 1 - _tmp185;
   const Scalar _tmp187 = _tmp164 + _tmp186;
@@ -657,10 +657,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
       _tmp200 * world_t_landmark_19_(0, 0) + _tmp203 * world_t_landmark_19_(1, 0);
   const Scalar _tmp322 = _tmp199 * world_t_landmark_19_(2, 0) + _tmp206 + _tmp321 -
                          body_t_landmark_measurements_1_19_(2, 0);
-  const Scalar _tmp323 = std::pow(_world_T_body_2_[1], Scalar(2));
+  const Scalar _tmp323 = (_world_T_body_2_[1] * _world_T_body_2_[1]);
   const Scalar _tmp324 = 2 * _tmp323;
   const Scalar _tmp325 = -_tmp324;
-  const Scalar _tmp326 = std::pow(_world_T_body_2_[2], Scalar(2));
+  const Scalar _tmp326 = (_world_T_body_2_[2] * _world_T_body_2_[2]);
   const Scalar _tmp327 = 2 * _tmp326;
   const Scalar _tmp328 = 1 - _tmp327;
   const Scalar _tmp329 = _tmp325 + _tmp328;
@@ -680,7 +680,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp343 = _tmp335 * world_t_landmark_0_(2, 0) + _tmp339 * world_t_landmark_0_(1, 0);
   const Scalar _tmp344 = _tmp329 * world_t_landmark_0_(0, 0) + _tmp342 + _tmp343 -
                          body_t_landmark_measurements_2_0_(0, 0);
-  const Scalar _tmp345 = std::pow(_world_T_body_2_[0], Scalar(2));
+  const Scalar _tmp345 = (_world_T_body_2_[0] * _world_T_body_2_[0]);
   const Scalar _tmp346 = 2 * _tmp345;
   const Scalar _tmp347 = -_tmp346;
   const Scalar _tmp348 = _tmp328 + _tmp347;
@@ -908,10 +908,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
       _tmp361 * world_t_landmark_19_(0, 0) + _tmp364 * world_t_landmark_19_(1, 0);
   const Scalar _tmp483 = _tmp360 * world_t_landmark_19_(2, 0) + _tmp367 + _tmp482 -
                          body_t_landmark_measurements_2_19_(2, 0);
-  const Scalar _tmp484 = std::pow(_world_T_body_3_[2], Scalar(2));
+  const Scalar _tmp484 = (_world_T_body_3_[2] * _world_T_body_3_[2]);
   const Scalar _tmp485 = 2 * _tmp484;
   const Scalar _tmp486 = -_tmp485;
-  const Scalar _tmp487 = std::pow(_world_T_body_3_[1], Scalar(2));
+  const Scalar _tmp487 = (_world_T_body_3_[1] * _world_T_body_3_[1]);
   const Scalar _tmp488 = 2 * _tmp487;
   const Scalar _tmp489 = 1 - _tmp488;
   const Scalar _tmp490 = _tmp486 + _tmp489;
@@ -931,7 +931,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp504 = _tmp495 * world_t_landmark_0_(1, 0) + _tmp500 * world_t_landmark_0_(2, 0);
   const Scalar _tmp505 = _tmp490 * world_t_landmark_0_(0, 0) + _tmp503 + _tmp504 -
                          body_t_landmark_measurements_3_0_(0, 0);
-  const Scalar _tmp506 = std::pow(_world_T_body_3_[0], Scalar(2));
+  const Scalar _tmp506 = (_world_T_body_3_[0] * _world_T_body_3_[0]);
   const Scalar _tmp507 = 2 * _tmp506;
   const Scalar _tmp508 = -_tmp507;
   const Scalar _tmp509 = _tmp486 + _tmp508 + 1;
@@ -1159,10 +1159,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
       _tmp523 * world_t_landmark_19_(1, 0) + _tmp525 * world_t_landmark_19_(0, 0);
   const Scalar _tmp644 = _tmp521 * world_t_landmark_19_(2, 0) + _tmp528 + _tmp643 -
                          body_t_landmark_measurements_3_19_(2, 0);
-  const Scalar _tmp645 = std::pow(_world_T_body_4_[1], Scalar(2));
+  const Scalar _tmp645 = (_world_T_body_4_[1] * _world_T_body_4_[1]);
   const Scalar _tmp646 = 2 * _tmp645;
   const Scalar _tmp647 = -_tmp646;
-  const Scalar _tmp648 = std::pow(_world_T_body_4_[2], Scalar(2));
+  const Scalar _tmp648 = (_world_T_body_4_[2] * _world_T_body_4_[2]);
   const Scalar _tmp649 = 2 * _tmp648;
   const Scalar _tmp650 = 1 - _tmp649;
   const Scalar _tmp651 = _tmp647 + _tmp650;
@@ -1181,7 +1181,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp664 = _tmp655 * world_t_landmark_0_(1, 0) + _tmp661 * world_t_landmark_0_(2, 0);
   const Scalar _tmp665 = _tmp651 * world_t_landmark_0_(0, 0) + _tmp663 + _tmp664 -
                          body_t_landmark_measurements_4_0_(0, 0);
-  const Scalar _tmp666 = std::pow(_world_T_body_4_[0], Scalar(2));
+  const Scalar _tmp666 = (_world_T_body_4_[0] * _world_T_body_4_[0]);
   const Scalar _tmp667 = 2 * _tmp666;
   const Scalar _tmp668 = -_tmp667;
   const Scalar _tmp669 = _tmp650 + _tmp668;
@@ -1441,7 +1441,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp831 = 2 * std::min<Scalar>(0, (((_tmp830) > 0) - ((_tmp830) < 0))) + 1;
   const Scalar _tmp832 = 1 - epsilon;
   const Scalar _tmp833 = std::min<Scalar>(_tmp832, std::fabs(_tmp830));
-  const Scalar _tmp834 = std::acos(_tmp833) / std::sqrt(Scalar(1 - std::pow(_tmp833, Scalar(2))));
+  const Scalar _tmp834 = std::acos(_tmp833) / std::sqrt(Scalar(1 - (_tmp833 * _tmp833)));
   const Scalar _tmp835 = _tmp831 * _tmp834;
   const Scalar _tmp836 = _tmp823 * _tmp825 * _tmp835;
   const Scalar _tmp837 = Scalar(1.0) / (odometry_diagonal_sigmas(1, 0));
@@ -1506,7 +1506,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp884 =
       2 * std::min<Scalar>(0, (((-_tmp882 + _tmp883) > 0) - ((-_tmp882 + _tmp883) < 0))) + 1;
   const Scalar _tmp885 = std::min<Scalar>(_tmp832, std::fabs(_tmp882 - _tmp883));
-  const Scalar _tmp886 = std::acos(_tmp885) / std::sqrt(Scalar(1 - std::pow(_tmp885, Scalar(2))));
+  const Scalar _tmp886 = std::acos(_tmp885) / std::sqrt(Scalar(1 - (_tmp885 * _tmp885)));
   const Scalar _tmp887 = _tmp884 * _tmp886;
   const Scalar _tmp888 = _tmp825 * _tmp878 * _tmp887;
   const Scalar _tmp889 = -_odometry_relative_pose_measurements_1_[0] * _tmp867 +
@@ -1558,7 +1558,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp926 = _tmp922 + _tmp923 + _tmp924 + _tmp925;
   const Scalar _tmp927 = _odometry_relative_pose_measurements_2_[3] * _tmp926;
   const Scalar _tmp928 = std::min<Scalar>(_tmp832, std::fabs(_tmp921 - _tmp927));
-  const Scalar _tmp929 = std::acos(_tmp928) / std::sqrt(Scalar(1 - std::pow(_tmp928, Scalar(2))));
+  const Scalar _tmp929 = std::acos(_tmp928) / std::sqrt(Scalar(1 - (_tmp928 * _tmp928)));
   const Scalar _tmp930 =
       2 * std::min<Scalar>(0, (((-_tmp921 + _tmp927) > 0) - ((-_tmp921 + _tmp927) < 0))) + 1;
   const Scalar _tmp931 = _tmp930 * (_odometry_relative_pose_measurements_2_[0] * _tmp926 +
@@ -1620,7 +1620,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp972 = _tmp968 + _tmp969 + _tmp970 + _tmp971;
   const Scalar _tmp973 = std::fabs(_tmp972);
   const Scalar _tmp974 = std::min<Scalar>(_tmp832, _tmp973);
-  const Scalar _tmp975 = 1 - std::pow(_tmp974, Scalar(2));
+  const Scalar _tmp975 = 1 - (_tmp974 * _tmp974);
   const Scalar _tmp976 = (((_tmp972) > 0) - ((_tmp972) < 0));
   const Scalar _tmp977 = 2 * std::min<Scalar>(0, _tmp976) + 1;
   const Scalar _tmp978 = _tmp977 * std::acos(_tmp974);
@@ -1679,7 +1679,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1022 = _tmp826 + _tmp827 + _tmp828 + _tmp829;
   const Scalar _tmp1023 = std::fabs(_tmp1022);
   const Scalar _tmp1024 = std::min<Scalar>(_tmp1023, _tmp832);
-  const Scalar _tmp1025 = 1 - std::pow(_tmp1024, Scalar(2));
+  const Scalar _tmp1025 = 1 - (_tmp1024 * _tmp1024);
   const Scalar _tmp1026 = _tmp831 * std::acos(_tmp1024);
   const Scalar _tmp1027 = _tmp1026 / std::sqrt(_tmp1025);
   const Scalar _tmp1028 = _tmp1027 * _tmp844;
@@ -1714,7 +1714,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1054 = _tmp1053 + _tmp41;
   const Scalar _tmp1055 = -_tmp14;
   const Scalar _tmp1056 = _tmp1055 + _tmp15;
-  const Scalar _tmp1057 = std::pow(_world_T_body_0_[3], Scalar(2));
+  const Scalar _tmp1057 = (_world_T_body_0_[3] * _world_T_body_0_[3]);
   const Scalar _tmp1058 = -_tmp1057;
   const Scalar _tmp1059 = -_tmp3;
   const Scalar _tmp1060 = _tmp0 + _tmp1058 + _tmp1059 + _tmp23;
@@ -1725,7 +1725,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1065 = _tmp1054 * world_t_landmark_7_(2, 0) +
                           _tmp1056 * world_t_landmark_7_(0, 0) +
                           _tmp1060 * world_t_landmark_7_(1, 0) + _tmp1064;
-  const Scalar _tmp1066 = std::pow(matching_sigma, Scalar(-2));
+  const Scalar _tmp1066 = Scalar(1.0) / (matching_sigma * matching_sigma);
   const Scalar _tmp1067 = _tmp1066 * _tmp89;
   const Scalar _tmp1068 = -_tmp23;
   const Scalar _tmp1069 = _tmp0 + _tmp1068;
@@ -1784,7 +1784,8 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1102 = _tmp1066 * _tmp1101;
   const Scalar _tmp1103 = _tmp100 + _tmp1071 * world_t_landmark_9_(2, 0) + _tmp1073;
   const Scalar _tmp1104 = _tmp1066 * _tmp1103;
-  const Scalar _tmp1105 = std::pow(odometry_diagonal_sigmas(4, 0), Scalar(-2));
+  const Scalar _tmp1105 =
+      Scalar(1.0) / (odometry_diagonal_sigmas(4, 0) * odometry_diagonal_sigmas(4, 0));
   const Scalar _tmp1106 = -_tmp1071 * _world_T_body_1_[6] + _tmp1072 + _tmp44 - _tmp854 - _tmp855;
   const Scalar _tmp1107 = _tmp1105 * _tmp1106;
   const Scalar _tmp1108 = _tmp1054 * world_t_landmark_13_(2, 0) +
@@ -1841,7 +1842,8 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1145 = _tmp1040 * _tmp1143;
   const Scalar _tmp1146 =
       -_tmp1034 * _tmp1144 + _tmp1034 * _tmp1145 + _tmp1142 * (_tmp1137 + _tmp1138 + _tmp1141);
-  const Scalar _tmp1147 = std::pow(odometry_diagonal_sigmas(5, 0), Scalar(-2));
+  const Scalar _tmp1147 =
+      Scalar(1.0) / (odometry_diagonal_sigmas(5, 0) * odometry_diagonal_sigmas(5, 0));
   const Scalar _tmp1148 = -_tmp1054 * _world_T_body_1_[6] - _tmp1056 * _world_T_body_1_[4] -
                           _tmp1060 * _world_T_body_1_[5] + _tmp1061 + _tmp1062 + _tmp1063;
   const Scalar _tmp1149 = _tmp1147 * _tmp1148;
@@ -1887,7 +1889,8 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1184 = -_tmp1177 * _world_T_body_1_[6] + _tmp1178 -
                           _tmp1180 * _world_T_body_1_[4] + _tmp1181 -
                           _tmp1182 * _world_T_body_1_[5] + _tmp1183;
-  const Scalar _tmp1185 = std::pow(odometry_diagonal_sigmas(3, 0), Scalar(-2));
+  const Scalar _tmp1185 =
+      Scalar(1.0) / (odometry_diagonal_sigmas(3, 0) * odometry_diagonal_sigmas(3, 0));
   const Scalar _tmp1186 = -_tmp1178 - _tmp1181 - _tmp1183;
   const Scalar _tmp1187 = _tmp1177 * world_t_landmark_0_(2, 0) +
                           _tmp1180 * world_t_landmark_0_(0, 0) +
@@ -2148,7 +2151,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1356 = _tmp1355 + _tmp170;
   const Scalar _tmp1357 = -_tmp165;
   const Scalar _tmp1358 = _tmp1357 + _tmp162;
-  const Scalar _tmp1359 = std::pow(_world_T_body_1_[3], Scalar(2));
+  const Scalar _tmp1359 = (_world_T_body_1_[3] * _world_T_body_1_[3]);
   const Scalar _tmp1360 = -_tmp1359;
   const Scalar _tmp1361 = _tmp1360 + _tmp184;
   const Scalar _tmp1362 = _tmp1358 + _tmp1361;
@@ -2251,7 +2254,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1445 = _tmp879 + _tmp880 + _tmp881 + _tmp883;
   const Scalar _tmp1446 = std::fabs(_tmp1445);
   const Scalar _tmp1447 = std::min<Scalar>(_tmp1446, _tmp832);
-  const Scalar _tmp1448 = 1 - std::pow(_tmp1447, Scalar(2));
+  const Scalar _tmp1448 = 1 - (_tmp1447 * _tmp1447);
   const Scalar _tmp1449 = _tmp884 *
                           ((((-_tmp1446 + _tmp832) > 0) - ((-_tmp1446 + _tmp832) < 0)) + 1) *
                           (((_tmp1445) > 0) - ((_tmp1445) < 0));
@@ -2665,7 +2668,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1730 = _tmp166 + _tmp1717;
   const Scalar _tmp1731 = _tmp1066 * _tmp1730;
   const Scalar _tmp1732 = _tmp1185 * _tmp1264;
-  const Scalar _tmp1733 = std::pow(_world_T_body_2_[3], Scalar(2));
+  const Scalar _tmp1733 = (_world_T_body_2_[3] * _world_T_body_2_[3]);
   const Scalar _tmp1734 = -_tmp323;
   const Scalar _tmp1735 = _tmp1733 + _tmp1734;
   const Scalar _tmp1736 = -_tmp345;
@@ -2747,7 +2750,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp1801 = _tmp908 + _tmp914 + _tmp920 + _tmp927;
   const Scalar _tmp1802 = std::fabs(_tmp1801);
   const Scalar _tmp1803 = std::min<Scalar>(_tmp1802, _tmp832);
-  const Scalar _tmp1804 = 1 - std::pow(_tmp1803, Scalar(2));
+  const Scalar _tmp1804 = 1 - (_tmp1803 * _tmp1803);
   const Scalar _tmp1805 = std::acos(_tmp1803);
   const Scalar _tmp1806 = _tmp1805 / std::sqrt(_tmp1804);
   const Scalar _tmp1807 = _tmp1806 * _tmp930;
@@ -3179,7 +3182,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2101 = _tmp1105 * _tmp354;
   const Scalar _tmp2102 = -_tmp487;
   const Scalar _tmp2103 = -_tmp506;
-  const Scalar _tmp2104 = std::pow(_world_T_body_3_[3], Scalar(2));
+  const Scalar _tmp2104 = (_world_T_body_3_[3] * _world_T_body_3_[3]);
   const Scalar _tmp2105 = _tmp2102 + _tmp2103 + _tmp2104 + _tmp484;
   const Scalar _tmp2106 = _tmp2105 * _world_T_body_3_[6];
   const Scalar _tmp2107 = -_tmp2106 - _tmp524 - _tmp526;
@@ -3689,7 +3692,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2470 = _tmp1105 * _tmp1748;
   const Scalar _tmp2471 = -_tmp666;
   const Scalar _tmp2472 = _tmp2471 + _tmp648;
-  const Scalar _tmp2473 = std::pow(_world_T_body_4_[3], Scalar(2));
+  const Scalar _tmp2473 = (_world_T_body_4_[3] * _world_T_body_4_[3]);
   const Scalar _tmp2474 = -_tmp645;
   const Scalar _tmp2475 = _tmp2473 + _tmp2474;
   const Scalar _tmp2476 = _tmp2472 + _tmp2475;
@@ -3742,7 +3745,7 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2504 = _tmp968 + _tmp969 + _tmp970 + _tmp971;
   const Scalar _tmp2505 = std::fabs(_tmp2504);
   const Scalar _tmp2506 = std::min<Scalar>(_tmp2505, _tmp832);
-  const Scalar _tmp2507 = 1 - std::pow(_tmp2506, Scalar(2));
+  const Scalar _tmp2507 = 1 - (_tmp2506 * _tmp2506);
   const Scalar _tmp2508 = _tmp977 * std::acos(_tmp2506);
   const Scalar _tmp2509 = _tmp2508 / std::sqrt(_tmp2507);
   const Scalar _tmp2510 = _tmp2509 * _tmp844;
@@ -4131,25 +4134,25 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2779 = _tmp22 * _tmp2664;
   const Scalar _tmp2780 = _tmp22 * _tmp2482;
   const Scalar _tmp2781 = _tmp22 * _tmp2735;
-  const Scalar _tmp2782 = std::pow(_tmp1180, Scalar(2));
+  const Scalar _tmp2782 = (_tmp1180 * _tmp1180);
   const Scalar _tmp2783 = 20 * _tmp1066;
-  const Scalar _tmp2784 = std::pow(_tmp1056, Scalar(2));
-  const Scalar _tmp2785 = std::pow(_tmp1333, Scalar(2));
+  const Scalar _tmp2784 = (_tmp1056 * _tmp1056);
+  const Scalar _tmp2785 = (_tmp1333 * _tmp1333);
   const Scalar _tmp2786 = 20 * _tmp1337;
   const Scalar _tmp2787 = 20 * _tmp1346;
   const Scalar _tmp2788 = 20 * _tmp1348;
-  const Scalar _tmp2789 = std::pow(_tmp1262, Scalar(2));
-  const Scalar _tmp2790 = std::pow(_tmp1182, Scalar(2));
-  const Scalar _tmp2791 = std::pow(_tmp1340, Scalar(2));
-  const Scalar _tmp2792 = std::pow(_tmp1264, Scalar(2));
-  const Scalar _tmp2793 = std::pow(_tmp1054, Scalar(2));
-  const Scalar _tmp2794 = std::pow(_tmp1350, Scalar(2));
+  const Scalar _tmp2789 = (_tmp1262 * _tmp1262);
+  const Scalar _tmp2790 = (_tmp1182 * _tmp1182);
+  const Scalar _tmp2791 = (_tmp1340 * _tmp1340);
+  const Scalar _tmp2792 = (_tmp1264 * _tmp1264);
+  const Scalar _tmp2793 = (_tmp1054 * _tmp1054);
+  const Scalar _tmp2794 = (_tmp1350 * _tmp1350);
   const Scalar _tmp2795 = _tmp1105 * _tmp1388;
   const Scalar _tmp2796 = _tmp1147 * _tmp1601;
   const Scalar _tmp2797 = _tmp1105 * _tmp1690;
-  const Scalar _tmp2798 = std::pow(_tmp1709, Scalar(2));
-  const Scalar _tmp2799 = std::pow(_tmp1356, Scalar(2));
-  const Scalar _tmp2800 = std::pow(_tmp1528, Scalar(2));
+  const Scalar _tmp2798 = (_tmp1709 * _tmp1709);
+  const Scalar _tmp2799 = (_tmp1356 * _tmp1356);
+  const Scalar _tmp2800 = (_tmp1528 * _tmp1528);
   const Scalar _tmp2801 = _tmp1105 * _tmp189;
   const Scalar _tmp2802 = _tmp1528 * _tmp1529;
   const Scalar _tmp2803 = _tmp1718 * _tmp2783;
@@ -4161,14 +4164,14 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2809 = _tmp1185 * _tmp1709;
   const Scalar _tmp2810 = _tmp1147 * _tmp200;
   const Scalar _tmp2811 = _tmp1147 * _tmp1730;
-  const Scalar _tmp2812 = std::pow(_tmp1718, Scalar(2));
-  const Scalar _tmp2813 = std::pow(_tmp1633, Scalar(2));
-  const Scalar _tmp2814 = std::pow(_tmp1529, Scalar(2));
+  const Scalar _tmp2812 = (_tmp1718 * _tmp1718);
+  const Scalar _tmp2813 = (_tmp1633 * _tmp1633);
+  const Scalar _tmp2814 = (_tmp1529 * _tmp1529);
   const Scalar _tmp2815 = _tmp1105 * _tmp187;
   const Scalar _tmp2816 = _tmp1105 * _tmp1356;
-  const Scalar _tmp2817 = std::pow(_tmp1730, Scalar(2));
-  const Scalar _tmp2818 = std::pow(_tmp1634, Scalar(2));
-  const Scalar _tmp2819 = std::pow(_tmp1354, Scalar(2));
+  const Scalar _tmp2817 = (_tmp1730 * _tmp1730);
+  const Scalar _tmp2818 = (_tmp1634 * _tmp1634);
+  const Scalar _tmp2819 = (_tmp1354 * _tmp1354);
   const Scalar _tmp2820 = _tmp1105 * _tmp1718;
   const Scalar _tmp2821 = _tmp1066 * _tmp1967;
   const Scalar _tmp2822 = _tmp1185 * _tmp2068;
@@ -4177,18 +4180,18 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2825 = _tmp1185 * _tmp335;
   const Scalar _tmp2826 = _tmp1185 * _tmp2003;
   const Scalar _tmp2827 = _tmp1185 * _tmp2004;
-  const Scalar _tmp2828 = std::pow(_tmp1895, Scalar(2));
-  const Scalar _tmp2829 = std::pow(_tmp1744, Scalar(2));
-  const Scalar _tmp2830 = std::pow(_tmp2087, Scalar(2));
+  const Scalar _tmp2828 = (_tmp1895 * _tmp1895);
+  const Scalar _tmp2829 = (_tmp1744 * _tmp1744);
+  const Scalar _tmp2830 = (_tmp2087 * _tmp2087);
   const Scalar _tmp2831 = 20 * _tmp2095;
   const Scalar _tmp2832 = _tmp1896 * _tmp2783;
   const Scalar _tmp2833 = _tmp2004 * _tmp2783;
-  const Scalar _tmp2834 = std::pow(_tmp2003, Scalar(2));
-  const Scalar _tmp2835 = std::pow(_tmp2094, Scalar(2));
-  const Scalar _tmp2836 = std::pow(_tmp1896, Scalar(2));
-  const Scalar _tmp2837 = std::pow(_tmp2004, Scalar(2));
-  const Scalar _tmp2838 = std::pow(_tmp2097, Scalar(2));
-  const Scalar _tmp2839 = std::pow(_tmp1748, Scalar(2));
+  const Scalar _tmp2834 = (_tmp2003 * _tmp2003);
+  const Scalar _tmp2835 = (_tmp2094 * _tmp2094);
+  const Scalar _tmp2836 = (_tmp1896 * _tmp1896);
+  const Scalar _tmp2837 = (_tmp2004 * _tmp2004);
+  const Scalar _tmp2838 = (_tmp2097 * _tmp2097);
+  const Scalar _tmp2839 = (_tmp1748 * _tmp1748);
   const Scalar _tmp2840 = _tmp1147 * _tmp2330;
   const Scalar _tmp2841 = _tmp1147 * _tmp525;
   const Scalar _tmp2842 = _tmp1147 * _tmp523;
@@ -4199,19 +4202,19 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
   const Scalar _tmp2847 = _tmp1066 * _tmp2344;
   const Scalar _tmp2848 = _tmp1066 * _tmp2336;
   const Scalar _tmp2849 = _tmp1066 * _tmp2356;
-  const Scalar _tmp2850 = std::pow(_tmp2270, Scalar(2));
-  const Scalar _tmp2851 = std::pow(_tmp2117, Scalar(2));
-  const Scalar _tmp2852 = std::pow(_tmp2451, Scalar(2));
+  const Scalar _tmp2850 = (_tmp2270 * _tmp2270);
+  const Scalar _tmp2851 = (_tmp2117 * _tmp2117);
+  const Scalar _tmp2852 = (_tmp2451 * _tmp2451);
   const Scalar _tmp2853 = _tmp2270 * _tmp2783;
   const Scalar _tmp2854 = _tmp2451 * _tmp2783;
   const Scalar _tmp2855 = _tmp2115 * _tmp2783;
   const Scalar _tmp2856 = _tmp1185 * _tmp2451;
-  const Scalar _tmp2857 = std::pow(_tmp2271, Scalar(2));
-  const Scalar _tmp2858 = std::pow(_tmp2362, Scalar(2));
-  const Scalar _tmp2859 = std::pow(_tmp2459, Scalar(2));
-  const Scalar _tmp2860 = std::pow(_tmp2361, Scalar(2));
-  const Scalar _tmp2861 = std::pow(_tmp2115, Scalar(2));
-  const Scalar _tmp2862 = std::pow(_tmp2468, Scalar(2));
+  const Scalar _tmp2857 = (_tmp2271 * _tmp2271);
+  const Scalar _tmp2858 = (_tmp2362 * _tmp2362);
+  const Scalar _tmp2859 = (_tmp2459 * _tmp2459);
+  const Scalar _tmp2860 = (_tmp2361 * _tmp2361);
+  const Scalar _tmp2861 = (_tmp2115 * _tmp2115);
+  const Scalar _tmp2862 = (_tmp2468 * _tmp2468);
   const Scalar _tmp2863 = _tmp1066 * _tmp2707;
   const Scalar _tmp2864 = _tmp1066 * _tmp2706;
   const Scalar _tmp2865 = _tmp1066 * _tmp2716;
@@ -6858,29 +6861,28 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     Scalar* hessian_value_ptr = hessian->valuePtr();
 
     hessian_value_ptr[0] =
-        std::pow(_tmp1042, Scalar(2)) + std::pow(_tmp1052, Scalar(2)) +
-        std::pow(_tmp1065, Scalar(2)) * _tmp1066 + _tmp1066 * std::pow(_tmp1074, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1076, Scalar(2)) + _tmp1066 * std::pow(_tmp1078, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1080, Scalar(2)) + _tmp1066 * std::pow(_tmp1082, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1084, Scalar(2)) + _tmp1066 * std::pow(_tmp1086, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1088, Scalar(2)) + _tmp1066 * std::pow(_tmp1090, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1092, Scalar(2)) + _tmp1066 * std::pow(_tmp1094, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1095, Scalar(2)) + _tmp1066 * std::pow(_tmp1096, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1097, Scalar(2)) + _tmp1066 * std::pow(_tmp1098, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1100, Scalar(2)) + _tmp1066 * std::pow(_tmp1101, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1103, Scalar(2)) + _tmp1066 * std::pow(_tmp1108, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1109, Scalar(2)) + _tmp1066 * std::pow(_tmp1111, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1113, Scalar(2)) + _tmp1066 * std::pow(_tmp1114, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1116, Scalar(2)) + _tmp1066 * std::pow(_tmp1118, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1120, Scalar(2)) + _tmp1066 * std::pow(_tmp1122, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1124, Scalar(2)) + _tmp1066 * std::pow(_tmp1126, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1128, Scalar(2)) + _tmp1066 * std::pow(_tmp1130, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1132, Scalar(2)) + _tmp1066 * std::pow(_tmp1134, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1135, Scalar(2)) + _tmp1066 * std::pow(_tmp1150, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1152, Scalar(2)) + _tmp1066 * std::pow(_tmp1154, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1156, Scalar(2)) + _tmp1066 * std::pow(_tmp1158, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp1106, Scalar(2)) + std::pow(_tmp1146, Scalar(2)) +
-        _tmp1147 * std::pow(_tmp1148, Scalar(2));
+        (_tmp1042 * _tmp1042) + (_tmp1052 * _tmp1052) + (_tmp1065 * _tmp1065) * _tmp1066 +
+        _tmp1066 * (_tmp1074 * _tmp1074) + _tmp1066 * (_tmp1076 * _tmp1076) +
+        _tmp1066 * (_tmp1078 * _tmp1078) + _tmp1066 * (_tmp1080 * _tmp1080) +
+        _tmp1066 * (_tmp1082 * _tmp1082) + _tmp1066 * (_tmp1084 * _tmp1084) +
+        _tmp1066 * (_tmp1086 * _tmp1086) + _tmp1066 * (_tmp1088 * _tmp1088) +
+        _tmp1066 * (_tmp1090 * _tmp1090) + _tmp1066 * (_tmp1092 * _tmp1092) +
+        _tmp1066 * (_tmp1094 * _tmp1094) + _tmp1066 * (_tmp1095 * _tmp1095) +
+        _tmp1066 * (_tmp1096 * _tmp1096) + _tmp1066 * (_tmp1097 * _tmp1097) +
+        _tmp1066 * (_tmp1098 * _tmp1098) + _tmp1066 * (_tmp1100 * _tmp1100) +
+        _tmp1066 * (_tmp1101 * _tmp1101) + _tmp1066 * (_tmp1103 * _tmp1103) +
+        _tmp1066 * (_tmp1108 * _tmp1108) + _tmp1066 * (_tmp1109 * _tmp1109) +
+        _tmp1066 * (_tmp1111 * _tmp1111) + _tmp1066 * (_tmp1113 * _tmp1113) +
+        _tmp1066 * (_tmp1114 * _tmp1114) + _tmp1066 * (_tmp1116 * _tmp1116) +
+        _tmp1066 * (_tmp1118 * _tmp1118) + _tmp1066 * (_tmp1120 * _tmp1120) +
+        _tmp1066 * (_tmp1122 * _tmp1122) + _tmp1066 * (_tmp1124 * _tmp1124) +
+        _tmp1066 * (_tmp1126 * _tmp1126) + _tmp1066 * (_tmp1128 * _tmp1128) +
+        _tmp1066 * (_tmp1130 * _tmp1130) + _tmp1066 * (_tmp1132 * _tmp1132) +
+        _tmp1066 * (_tmp1134 * _tmp1134) + _tmp1066 * (_tmp1135 * _tmp1135) +
+        _tmp1066 * (_tmp1150 * _tmp1150) + _tmp1066 * (_tmp1152 * _tmp1152) +
+        _tmp1066 * (_tmp1154 * _tmp1154) + _tmp1066 * (_tmp1156 * _tmp1156) +
+        _tmp1066 * (_tmp1158 * _tmp1158) + _tmp1105 * (_tmp1106 * _tmp1106) +
+        (_tmp1146 * _tmp1146) + _tmp1147 * (_tmp1148 * _tmp1148);
     hessian_value_ptr[1] =
         _tmp1042 * _tmp1194 + _tmp1052 * _tmp1233 + _tmp1065 * _tmp1066 * _tmp1165 +
         _tmp1066 * _tmp1078 * _tmp1252 + _tmp1066 * _tmp1080 * _tmp1253 +
@@ -6944,29 +6946,28 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[10] = _tmp1106 * _tmp1724 + _tmp1148 * _tmp1725;
     hessian_value_ptr[11] = _tmp1106 * _tmp1726 + _tmp1149 * _tmp1350;
     hessian_value_ptr[12] =
-        _tmp1066 * std::pow(_tmp1165, Scalar(2)) + _tmp1066 * std::pow(_tmp1187, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1188, Scalar(2)) + _tmp1066 * std::pow(_tmp1189, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1195, Scalar(2)) + _tmp1066 * std::pow(_tmp1197, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1198, Scalar(2)) + _tmp1066 * std::pow(_tmp1200, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1202, Scalar(2)) + _tmp1066 * std::pow(_tmp1204, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1206, Scalar(2)) + _tmp1066 * std::pow(_tmp1207, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1209, Scalar(2)) + _tmp1066 * std::pow(_tmp1210, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1212, Scalar(2)) + _tmp1066 * std::pow(_tmp1214, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1216, Scalar(2)) + _tmp1066 * std::pow(_tmp1218, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1219, Scalar(2)) + _tmp1066 * std::pow(_tmp1221, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1222, Scalar(2)) + _tmp1066 * std::pow(_tmp1223, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1225, Scalar(2)) + _tmp1066 * std::pow(_tmp1226, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1227, Scalar(2)) + _tmp1066 * std::pow(_tmp1228, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1234, Scalar(2)) + _tmp1066 * std::pow(_tmp1236, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1237, Scalar(2)) + _tmp1066 * std::pow(_tmp1238, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1239, Scalar(2)) + _tmp1066 * std::pow(_tmp1241, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1243, Scalar(2)) + _tmp1066 * std::pow(_tmp1244, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1246, Scalar(2)) + _tmp1066 * std::pow(_tmp1248, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1250, Scalar(2)) + _tmp1066 * std::pow(_tmp1252, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1253, Scalar(2)) + _tmp1066 * std::pow(_tmp1254, Scalar(2)) +
-        _tmp1147 * std::pow(_tmp1229, Scalar(2)) + std::pow(_tmp1175, Scalar(2)) +
-        std::pow(_tmp1184, Scalar(2)) * _tmp1185 + std::pow(_tmp1194, Scalar(2)) +
-        std::pow(_tmp1233, Scalar(2));
+        _tmp1066 * (_tmp1165 * _tmp1165) + _tmp1066 * (_tmp1187 * _tmp1187) +
+        _tmp1066 * (_tmp1188 * _tmp1188) + _tmp1066 * (_tmp1189 * _tmp1189) +
+        _tmp1066 * (_tmp1195 * _tmp1195) + _tmp1066 * (_tmp1197 * _tmp1197) +
+        _tmp1066 * (_tmp1198 * _tmp1198) + _tmp1066 * (_tmp1200 * _tmp1200) +
+        _tmp1066 * (_tmp1202 * _tmp1202) + _tmp1066 * (_tmp1204 * _tmp1204) +
+        _tmp1066 * (_tmp1206 * _tmp1206) + _tmp1066 * (_tmp1207 * _tmp1207) +
+        _tmp1066 * (_tmp1209 * _tmp1209) + _tmp1066 * (_tmp1210 * _tmp1210) +
+        _tmp1066 * (_tmp1212 * _tmp1212) + _tmp1066 * (_tmp1214 * _tmp1214) +
+        _tmp1066 * (_tmp1216 * _tmp1216) + _tmp1066 * (_tmp1218 * _tmp1218) +
+        _tmp1066 * (_tmp1219 * _tmp1219) + _tmp1066 * (_tmp1221 * _tmp1221) +
+        _tmp1066 * (_tmp1222 * _tmp1222) + _tmp1066 * (_tmp1223 * _tmp1223) +
+        _tmp1066 * (_tmp1225 * _tmp1225) + _tmp1066 * (_tmp1226 * _tmp1226) +
+        _tmp1066 * (_tmp1227 * _tmp1227) + _tmp1066 * (_tmp1228 * _tmp1228) +
+        _tmp1066 * (_tmp1234 * _tmp1234) + _tmp1066 * (_tmp1236 * _tmp1236) +
+        _tmp1066 * (_tmp1237 * _tmp1237) + _tmp1066 * (_tmp1238 * _tmp1238) +
+        _tmp1066 * (_tmp1239 * _tmp1239) + _tmp1066 * (_tmp1241 * _tmp1241) +
+        _tmp1066 * (_tmp1243 * _tmp1243) + _tmp1066 * (_tmp1244 * _tmp1244) +
+        _tmp1066 * (_tmp1246 * _tmp1246) + _tmp1066 * (_tmp1248 * _tmp1248) +
+        _tmp1066 * (_tmp1250 * _tmp1250) + _tmp1066 * (_tmp1252 * _tmp1252) +
+        _tmp1066 * (_tmp1253 * _tmp1253) + _tmp1066 * (_tmp1254 * _tmp1254) +
+        _tmp1147 * (_tmp1229 * _tmp1229) + (_tmp1175 * _tmp1175) +
+        (_tmp1184 * _tmp1184) * _tmp1185 + (_tmp1194 * _tmp1194) + (_tmp1233 * _tmp1233);
     hessian_value_ptr[13] =
         _tmp1066 * _tmp1195 * _tmp1309 + _tmp1066 * _tmp1200 * _tmp1270 +
         _tmp1066 * _tmp1202 * _tmp1286 + _tmp1066 * _tmp1207 * _tmp1284 +
@@ -7018,30 +7019,28 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[20] = _tmp1184 * _tmp1715 + _tmp1229 * _tmp1716;
     hessian_value_ptr[21] = _tmp1184 * _tmp1722 + _tmp1229 * _tmp1725;
     hessian_value_ptr[22] = _tmp1184 * _tmp1732 + _tmp1229 * _tmp1729;
-    hessian_value_ptr[23] =
-        _tmp1066 * std::pow(_tmp1258, Scalar(2)) + _tmp1066 * std::pow(_tmp1259, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1260, Scalar(2)) + _tmp1066 * std::pow(_tmp1261, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1269, Scalar(2)) + _tmp1066 * std::pow(_tmp1270, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1271, Scalar(2)) + _tmp1066 * std::pow(_tmp1280, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1282, Scalar(2)) + _tmp1066 * std::pow(_tmp1283, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1284, Scalar(2)) + _tmp1066 * std::pow(_tmp1285, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1286, Scalar(2)) + _tmp1066 * std::pow(_tmp1287, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1288, Scalar(2)) + _tmp1066 * std::pow(_tmp1292, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1294, Scalar(2)) + _tmp1066 * std::pow(_tmp1295, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1297, Scalar(2)) + _tmp1066 * std::pow(_tmp1298, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1299, Scalar(2)) + _tmp1066 * std::pow(_tmp1300, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1301, Scalar(2)) + _tmp1066 * std::pow(_tmp1302, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1303, Scalar(2)) + _tmp1066 * std::pow(_tmp1305, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1306, Scalar(2)) + _tmp1066 * std::pow(_tmp1309, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1313, Scalar(2)) + _tmp1066 * std::pow(_tmp1315, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1316, Scalar(2)) + _tmp1066 * std::pow(_tmp1317, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1319, Scalar(2)) + _tmp1066 * std::pow(_tmp1320, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1321, Scalar(2)) + _tmp1066 * std::pow(_tmp1323, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1324, Scalar(2)) + _tmp1066 * std::pow(_tmp1326, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1329, Scalar(2)) + _tmp1066 * std::pow(_tmp1330, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp1307, Scalar(2)) + _tmp1185 * std::pow(_tmp1327, Scalar(2)) +
-        std::pow(_tmp1279, Scalar(2)) + std::pow(_tmp1291, Scalar(2)) +
-        std::pow(_tmp1312, Scalar(2));
+    hessian_value_ptr[23] = _tmp1066 * (_tmp1258 * _tmp1258) + _tmp1066 * (_tmp1259 * _tmp1259) +
+                            _tmp1066 * (_tmp1260 * _tmp1260) + _tmp1066 * (_tmp1261 * _tmp1261) +
+                            _tmp1066 * (_tmp1269 * _tmp1269) + _tmp1066 * (_tmp1270 * _tmp1270) +
+                            _tmp1066 * (_tmp1271 * _tmp1271) + _tmp1066 * (_tmp1280 * _tmp1280) +
+                            _tmp1066 * (_tmp1282 * _tmp1282) + _tmp1066 * (_tmp1283 * _tmp1283) +
+                            _tmp1066 * (_tmp1284 * _tmp1284) + _tmp1066 * (_tmp1285 * _tmp1285) +
+                            _tmp1066 * (_tmp1286 * _tmp1286) + _tmp1066 * (_tmp1287 * _tmp1287) +
+                            _tmp1066 * (_tmp1288 * _tmp1288) + _tmp1066 * (_tmp1292 * _tmp1292) +
+                            _tmp1066 * (_tmp1294 * _tmp1294) + _tmp1066 * (_tmp1295 * _tmp1295) +
+                            _tmp1066 * (_tmp1297 * _tmp1297) + _tmp1066 * (_tmp1298 * _tmp1298) +
+                            _tmp1066 * (_tmp1299 * _tmp1299) + _tmp1066 * (_tmp1300 * _tmp1300) +
+                            _tmp1066 * (_tmp1301 * _tmp1301) + _tmp1066 * (_tmp1302 * _tmp1302) +
+                            _tmp1066 * (_tmp1303 * _tmp1303) + _tmp1066 * (_tmp1305 * _tmp1305) +
+                            _tmp1066 * (_tmp1306 * _tmp1306) + _tmp1066 * (_tmp1309 * _tmp1309) +
+                            _tmp1066 * (_tmp1313 * _tmp1313) + _tmp1066 * (_tmp1315 * _tmp1315) +
+                            _tmp1066 * (_tmp1316 * _tmp1316) + _tmp1066 * (_tmp1317 * _tmp1317) +
+                            _tmp1066 * (_tmp1319 * _tmp1319) + _tmp1066 * (_tmp1320 * _tmp1320) +
+                            _tmp1066 * (_tmp1321 * _tmp1321) + _tmp1066 * (_tmp1323 * _tmp1323) +
+                            _tmp1066 * (_tmp1324 * _tmp1324) + _tmp1066 * (_tmp1326 * _tmp1326) +
+                            _tmp1066 * (_tmp1329 * _tmp1329) + _tmp1066 * (_tmp1330 * _tmp1330) +
+                            _tmp1105 * (_tmp1307 * _tmp1307) + _tmp1185 * (_tmp1327 * _tmp1327) +
+                            (_tmp1279 * _tmp1279) + (_tmp1291 * _tmp1291) + (_tmp1312 * _tmp1312);
     hessian_value_ptr[24] =
         _tmp1258 * _tmp1334 + _tmp1259 * _tmp1334 + _tmp1260 * _tmp1334 + _tmp1261 * _tmp1334 +
         _tmp1269 * _tmp1335 + _tmp1270 * _tmp1334 + _tmp1271 * _tmp1335 + _tmp1280 * _tmp1335 +
@@ -7084,10 +7083,9 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[30] = _tmp1307 * _tmp1713 + _tmp1328 * _tmp1333;
     hessian_value_ptr[31] = _tmp1262 * _tmp1328 + _tmp1307 * _tmp1724;
     hessian_value_ptr[32] = _tmp1264 * _tmp1328 + _tmp1307 * _tmp1726;
-    hessian_value_ptr[33] = _tmp1105 * std::pow(_tmp32, Scalar(2)) +
-                            _tmp1147 * std::pow(_tmp39, Scalar(2)) +
-                            _tmp1185 * std::pow(_tmp6, Scalar(2)) + _tmp2782 * _tmp2783 +
-                            _tmp2783 * _tmp2784 + _tmp2783 * _tmp2785;
+    hessian_value_ptr[33] =
+        _tmp1105 * (_tmp32 * _tmp32) + _tmp1147 * (_tmp39 * _tmp39) + _tmp1185 * (_tmp6 * _tmp6) +
+        _tmp2782 * _tmp2783 + _tmp2783 * _tmp2784 + _tmp2783 * _tmp2785;
     hessian_value_ptr[34] = _tmp1056 * _tmp1340 * _tmp2783 + _tmp1182 * _tmp2786 +
                             _tmp1262 * _tmp1333 * _tmp2783 + _tmp1336 * _tmp26 + _tmp1342 * _tmp6 +
                             _tmp1345 * _tmp39;
@@ -7096,48 +7094,44 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[36] = _tmp1180 * _tmp1339 + _tmp1713 * _tmp32 + _tmp1715 * _tmp6;
     hessian_value_ptr[37] = _tmp1336 * _tmp1340 + _tmp1722 * _tmp6 + _tmp1725 * _tmp39;
     hessian_value_ptr[38] = _tmp1339 * _tmp1350 + _tmp1726 * _tmp32 + _tmp1732 * _tmp6;
-    hessian_value_ptr[39] = _tmp1105 * std::pow(_tmp26, Scalar(2)) +
-                            _tmp1147 * std::pow(_tmp42, Scalar(2)) +
-                            _tmp1185 * std::pow(_tmp16, Scalar(2)) + _tmp2783 * _tmp2789 +
-                            _tmp2783 * _tmp2790 + _tmp2783 * _tmp2791;
+    hessian_value_ptr[39] =
+        _tmp1105 * (_tmp26 * _tmp26) + _tmp1147 * (_tmp42 * _tmp42) + _tmp1185 * (_tmp16 * _tmp16) +
+        _tmp2783 * _tmp2789 + _tmp2783 * _tmp2790 + _tmp2783 * _tmp2791;
     hessian_value_ptr[40] = _tmp1182 * _tmp1350 * _tmp2783 + _tmp12 * _tmp1342 +
                             _tmp1262 * _tmp2788 + _tmp1340 * _tmp2787 + _tmp1345 * _tmp38 +
                             _tmp1347 * _tmp26;
     hessian_value_ptr[41] = _tmp1180 * _tmp1345 + _tmp1333 * _tmp1342 + _tmp1713 * _tmp26;
     hessian_value_ptr[42] = _tmp1182 * _tmp1345 + _tmp1262 * _tmp1342 + _tmp1724 * _tmp26;
     hessian_value_ptr[43] = _tmp1264 * _tmp1342 + _tmp1345 * _tmp1350 + _tmp1726 * _tmp26;
-    hessian_value_ptr[44] = _tmp1105 * std::pow(_tmp29, Scalar(2)) +
-                            _tmp1147 * std::pow(_tmp38, Scalar(2)) +
-                            _tmp1185 * std::pow(_tmp12, Scalar(2)) + _tmp2783 * _tmp2792 +
-                            _tmp2783 * _tmp2793 + _tmp2783 * _tmp2794;
+    hessian_value_ptr[44] =
+        _tmp1105 * (_tmp29 * _tmp29) + _tmp1147 * (_tmp38 * _tmp38) + _tmp1185 * (_tmp12 * _tmp12) +
+        _tmp2783 * _tmp2792 + _tmp2783 * _tmp2793 + _tmp2783 * _tmp2794;
     hessian_value_ptr[45] = _tmp1333 * _tmp1352 + _tmp1713 * _tmp29 + _tmp1716 * _tmp38;
     hessian_value_ptr[46] = _tmp1262 * _tmp1352 + _tmp1340 * _tmp1347 + _tmp1725 * _tmp38;
     hessian_value_ptr[47] = _tmp1264 * _tmp1352 + _tmp1349 * _tmp1350 + _tmp1726 * _tmp29;
-    hessian_value_ptr[48] =
-        _tmp1066 * std::pow(_tmp1367, Scalar(2)) + _tmp1066 * std::pow(_tmp1369, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1371, Scalar(2)) + _tmp1066 * std::pow(_tmp1373, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1379, Scalar(2)) + _tmp1066 * std::pow(_tmp1380, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1390, Scalar(2)) + _tmp1066 * std::pow(_tmp1391, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1392, Scalar(2)) + _tmp1066 * std::pow(_tmp1394, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1396, Scalar(2)) + _tmp1066 * std::pow(_tmp1398, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1400, Scalar(2)) + _tmp1066 * std::pow(_tmp1402, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1404, Scalar(2)) + _tmp1066 * std::pow(_tmp1406, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1408, Scalar(2)) + _tmp1066 * std::pow(_tmp1410, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1412, Scalar(2)) + _tmp1066 * std::pow(_tmp1414, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1464, Scalar(2)) + _tmp1066 * std::pow(_tmp1465, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1466, Scalar(2)) + _tmp1066 * std::pow(_tmp1468, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1470, Scalar(2)) + _tmp1066 * std::pow(_tmp1492, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1494, Scalar(2)) + _tmp1066 * std::pow(_tmp1496, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1498, Scalar(2)) + _tmp1066 * std::pow(_tmp1500, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1502, Scalar(2)) + _tmp1066 * std::pow(_tmp1504, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1506, Scalar(2)) + _tmp1066 * std::pow(_tmp1508, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1510, Scalar(2)) + _tmp1066 * std::pow(_tmp1512, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1514, Scalar(2)) + _tmp1066 * std::pow(_tmp1518, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1520, Scalar(2)) + _tmp1066 * std::pow(_tmp1522, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp1388, Scalar(2)) + _tmp1147 * std::pow(_tmp1416, Scalar(2)) +
-        std::pow(_tmp1387, Scalar(2)) + std::pow(_tmp1463, Scalar(2)) +
-        std::pow(_tmp1473, Scalar(2)) + std::pow(_tmp1482, Scalar(2)) +
-        std::pow(_tmp1491, Scalar(2)) + std::pow(_tmp1517, Scalar(2));
+    hessian_value_ptr[48] = _tmp1066 * (_tmp1367 * _tmp1367) + _tmp1066 * (_tmp1369 * _tmp1369) +
+                            _tmp1066 * (_tmp1371 * _tmp1371) + _tmp1066 * (_tmp1373 * _tmp1373) +
+                            _tmp1066 * (_tmp1379 * _tmp1379) + _tmp1066 * (_tmp1380 * _tmp1380) +
+                            _tmp1066 * (_tmp1390 * _tmp1390) + _tmp1066 * (_tmp1391 * _tmp1391) +
+                            _tmp1066 * (_tmp1392 * _tmp1392) + _tmp1066 * (_tmp1394 * _tmp1394) +
+                            _tmp1066 * (_tmp1396 * _tmp1396) + _tmp1066 * (_tmp1398 * _tmp1398) +
+                            _tmp1066 * (_tmp1400 * _tmp1400) + _tmp1066 * (_tmp1402 * _tmp1402) +
+                            _tmp1066 * (_tmp1404 * _tmp1404) + _tmp1066 * (_tmp1406 * _tmp1406) +
+                            _tmp1066 * (_tmp1408 * _tmp1408) + _tmp1066 * (_tmp1410 * _tmp1410) +
+                            _tmp1066 * (_tmp1412 * _tmp1412) + _tmp1066 * (_tmp1414 * _tmp1414) +
+                            _tmp1066 * (_tmp1464 * _tmp1464) + _tmp1066 * (_tmp1465 * _tmp1465) +
+                            _tmp1066 * (_tmp1466 * _tmp1466) + _tmp1066 * (_tmp1468 * _tmp1468) +
+                            _tmp1066 * (_tmp1470 * _tmp1470) + _tmp1066 * (_tmp1492 * _tmp1492) +
+                            _tmp1066 * (_tmp1494 * _tmp1494) + _tmp1066 * (_tmp1496 * _tmp1496) +
+                            _tmp1066 * (_tmp1498 * _tmp1498) + _tmp1066 * (_tmp1500 * _tmp1500) +
+                            _tmp1066 * (_tmp1502 * _tmp1502) + _tmp1066 * (_tmp1504 * _tmp1504) +
+                            _tmp1066 * (_tmp1506 * _tmp1506) + _tmp1066 * (_tmp1508 * _tmp1508) +
+                            _tmp1066 * (_tmp1510 * _tmp1510) + _tmp1066 * (_tmp1512 * _tmp1512) +
+                            _tmp1066 * (_tmp1514 * _tmp1514) + _tmp1066 * (_tmp1518 * _tmp1518) +
+                            _tmp1066 * (_tmp1520 * _tmp1520) + _tmp1066 * (_tmp1522 * _tmp1522) +
+                            _tmp1105 * (_tmp1388 * _tmp1388) + _tmp1147 * (_tmp1416 * _tmp1416) +
+                            (_tmp1387 * _tmp1387) + (_tmp1463 * _tmp1463) + (_tmp1473 * _tmp1473) +
+                            (_tmp1482 * _tmp1482) + (_tmp1491 * _tmp1491) + (_tmp1517 * _tmp1517);
     hessian_value_ptr[49] =
         _tmp1066 * _tmp1367 * _tmp1559 + _tmp1066 * _tmp1369 * _tmp1560 +
         _tmp1066 * _tmp1371 * _tmp1561 + _tmp1066 * _tmp1380 * _tmp1564 +
@@ -7202,31 +7196,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[57] = _tmp1356 * _tmp2795 + _tmp1417 * _tmp1528;
     hessian_value_ptr[58] = _tmp1417 * _tmp1529 + _tmp1718 * _tmp2795;
     hessian_value_ptr[59] = _tmp1354 * _tmp2795 + _tmp1417 * _tmp1730;
-    hessian_value_ptr[60] =
-        _tmp1066 * std::pow(_tmp1534, Scalar(2)) + _tmp1066 * std::pow(_tmp1548, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1559, Scalar(2)) + _tmp1066 * std::pow(_tmp1560, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1561, Scalar(2)) + _tmp1066 * std::pow(_tmp1562, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1564, Scalar(2)) + _tmp1066 * std::pow(_tmp1565, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1567, Scalar(2)) + _tmp1066 * std::pow(_tmp1574, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1576, Scalar(2)) + _tmp1066 * std::pow(_tmp1577, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1579, Scalar(2)) + _tmp1066 * std::pow(_tmp1581, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1583, Scalar(2)) + _tmp1066 * std::pow(_tmp1585, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1587, Scalar(2)) + _tmp1066 * std::pow(_tmp1589, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1591, Scalar(2)) + _tmp1066 * std::pow(_tmp1593, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1595, Scalar(2)) + _tmp1066 * std::pow(_tmp1597, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1599, Scalar(2)) + _tmp1066 * std::pow(_tmp1603, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1604, Scalar(2)) + _tmp1066 * std::pow(_tmp1605, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1606, Scalar(2)) + _tmp1066 * std::pow(_tmp1612, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1613, Scalar(2)) + _tmp1066 * std::pow(_tmp1616, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1617, Scalar(2)) + _tmp1066 * std::pow(_tmp1618, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1620, Scalar(2)) + _tmp1066 * std::pow(_tmp1622, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1624, Scalar(2)) + _tmp1066 * std::pow(_tmp1625, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1627, Scalar(2)) + _tmp1066 * std::pow(_tmp1628, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1629, Scalar(2)) + _tmp1066 * std::pow(_tmp1630, Scalar(2)) +
-        _tmp1147 * std::pow(_tmp1601, Scalar(2)) + _tmp1185 * std::pow(_tmp1546, Scalar(2)) +
-        std::pow(_tmp1545, Scalar(2)) + std::pow(_tmp1555, Scalar(2)) +
-        std::pow(_tmp1573, Scalar(2)) + std::pow(_tmp1611, Scalar(2)) +
-        std::pow(_tmp1615, Scalar(2)) + std::pow(_tmp1626, Scalar(2));
+    hessian_value_ptr[60] = _tmp1066 * (_tmp1534 * _tmp1534) + _tmp1066 * (_tmp1548 * _tmp1548) +
+                            _tmp1066 * (_tmp1559 * _tmp1559) + _tmp1066 * (_tmp1560 * _tmp1560) +
+                            _tmp1066 * (_tmp1561 * _tmp1561) + _tmp1066 * (_tmp1562 * _tmp1562) +
+                            _tmp1066 * (_tmp1564 * _tmp1564) + _tmp1066 * (_tmp1565 * _tmp1565) +
+                            _tmp1066 * (_tmp1567 * _tmp1567) + _tmp1066 * (_tmp1574 * _tmp1574) +
+                            _tmp1066 * (_tmp1576 * _tmp1576) + _tmp1066 * (_tmp1577 * _tmp1577) +
+                            _tmp1066 * (_tmp1579 * _tmp1579) + _tmp1066 * (_tmp1581 * _tmp1581) +
+                            _tmp1066 * (_tmp1583 * _tmp1583) + _tmp1066 * (_tmp1585 * _tmp1585) +
+                            _tmp1066 * (_tmp1587 * _tmp1587) + _tmp1066 * (_tmp1589 * _tmp1589) +
+                            _tmp1066 * (_tmp1591 * _tmp1591) + _tmp1066 * (_tmp1593 * _tmp1593) +
+                            _tmp1066 * (_tmp1595 * _tmp1595) + _tmp1066 * (_tmp1597 * _tmp1597) +
+                            _tmp1066 * (_tmp1599 * _tmp1599) + _tmp1066 * (_tmp1603 * _tmp1603) +
+                            _tmp1066 * (_tmp1604 * _tmp1604) + _tmp1066 * (_tmp1605 * _tmp1605) +
+                            _tmp1066 * (_tmp1606 * _tmp1606) + _tmp1066 * (_tmp1612 * _tmp1612) +
+                            _tmp1066 * (_tmp1613 * _tmp1613) + _tmp1066 * (_tmp1616 * _tmp1616) +
+                            _tmp1066 * (_tmp1617 * _tmp1617) + _tmp1066 * (_tmp1618 * _tmp1618) +
+                            _tmp1066 * (_tmp1620 * _tmp1620) + _tmp1066 * (_tmp1622 * _tmp1622) +
+                            _tmp1066 * (_tmp1624 * _tmp1624) + _tmp1066 * (_tmp1625 * _tmp1625) +
+                            _tmp1066 * (_tmp1627 * _tmp1627) + _tmp1066 * (_tmp1628 * _tmp1628) +
+                            _tmp1066 * (_tmp1629 * _tmp1629) + _tmp1066 * (_tmp1630 * _tmp1630) +
+                            _tmp1147 * (_tmp1601 * _tmp1601) + _tmp1185 * (_tmp1546 * _tmp1546) +
+                            (_tmp1545 * _tmp1545) + (_tmp1555 * _tmp1555) + (_tmp1573 * _tmp1573) +
+                            (_tmp1611 * _tmp1611) + (_tmp1615 * _tmp1615) + (_tmp1626 * _tmp1626);
     hessian_value_ptr[61] = _tmp1066 * _tmp1577 * _tmp1656 + _tmp1066 * _tmp1579 * _tmp1659 +
                             _tmp1066 * _tmp1581 * _tmp1658 + _tmp1066 * _tmp1583 * _tmp1662 +
                             _tmp1066 * _tmp1585 * _tmp1657 + _tmp1066 * _tmp1587 * _tmp1653 +
@@ -7280,31 +7272,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[68] = _tmp1528 * _tmp2796 + _tmp1547 * _tmp1709;
     hessian_value_ptr[69] = _tmp1529 * _tmp2796 + _tmp1547 * _tmp1633;
     hessian_value_ptr[70] = _tmp1547 * _tmp1634 + _tmp1730 * _tmp2796;
-    hessian_value_ptr[71] =
-        _tmp1066 * std::pow(_tmp1639, Scalar(2)) + _tmp1066 * std::pow(_tmp1640, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1641, Scalar(2)) + _tmp1066 * std::pow(_tmp1645, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1647, Scalar(2)) + _tmp1066 * std::pow(_tmp1648, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1649, Scalar(2)) + _tmp1066 * std::pow(_tmp1650, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1651, Scalar(2)) + _tmp1066 * std::pow(_tmp1652, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1653, Scalar(2)) + _tmp1066 * std::pow(_tmp1654, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1655, Scalar(2)) + _tmp1066 * std::pow(_tmp1656, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1657, Scalar(2)) + _tmp1066 * std::pow(_tmp1658, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1659, Scalar(2)) + _tmp1066 * std::pow(_tmp1660, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1661, Scalar(2)) + _tmp1066 * std::pow(_tmp1662, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1663, Scalar(2)) + _tmp1066 * std::pow(_tmp1664, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1665, Scalar(2)) + _tmp1066 * std::pow(_tmp1666, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1667, Scalar(2)) + _tmp1066 * std::pow(_tmp1668, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1669, Scalar(2)) + _tmp1066 * std::pow(_tmp1670, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1671, Scalar(2)) + _tmp1066 * std::pow(_tmp1672, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1673, Scalar(2)) + _tmp1066 * std::pow(_tmp1674, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1676, Scalar(2)) + _tmp1066 * std::pow(_tmp1677, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1680, Scalar(2)) + _tmp1066 * std::pow(_tmp1681, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1682, Scalar(2)) + _tmp1066 * std::pow(_tmp1687, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1688, Scalar(2)) + _tmp1066 * std::pow(_tmp1691, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp1690, Scalar(2)) + _tmp1185 * std::pow(_tmp1704, Scalar(2)) +
-        std::pow(_tmp1679, Scalar(2)) + std::pow(_tmp1685, Scalar(2)) +
-        std::pow(_tmp1686, Scalar(2)) + std::pow(_tmp1700, Scalar(2)) +
-        std::pow(_tmp1703, Scalar(2)) + std::pow(_tmp1708, Scalar(2));
+    hessian_value_ptr[71] = _tmp1066 * (_tmp1639 * _tmp1639) + _tmp1066 * (_tmp1640 * _tmp1640) +
+                            _tmp1066 * (_tmp1641 * _tmp1641) + _tmp1066 * (_tmp1645 * _tmp1645) +
+                            _tmp1066 * (_tmp1647 * _tmp1647) + _tmp1066 * (_tmp1648 * _tmp1648) +
+                            _tmp1066 * (_tmp1649 * _tmp1649) + _tmp1066 * (_tmp1650 * _tmp1650) +
+                            _tmp1066 * (_tmp1651 * _tmp1651) + _tmp1066 * (_tmp1652 * _tmp1652) +
+                            _tmp1066 * (_tmp1653 * _tmp1653) + _tmp1066 * (_tmp1654 * _tmp1654) +
+                            _tmp1066 * (_tmp1655 * _tmp1655) + _tmp1066 * (_tmp1656 * _tmp1656) +
+                            _tmp1066 * (_tmp1657 * _tmp1657) + _tmp1066 * (_tmp1658 * _tmp1658) +
+                            _tmp1066 * (_tmp1659 * _tmp1659) + _tmp1066 * (_tmp1660 * _tmp1660) +
+                            _tmp1066 * (_tmp1661 * _tmp1661) + _tmp1066 * (_tmp1662 * _tmp1662) +
+                            _tmp1066 * (_tmp1663 * _tmp1663) + _tmp1066 * (_tmp1664 * _tmp1664) +
+                            _tmp1066 * (_tmp1665 * _tmp1665) + _tmp1066 * (_tmp1666 * _tmp1666) +
+                            _tmp1066 * (_tmp1667 * _tmp1667) + _tmp1066 * (_tmp1668 * _tmp1668) +
+                            _tmp1066 * (_tmp1669 * _tmp1669) + _tmp1066 * (_tmp1670 * _tmp1670) +
+                            _tmp1066 * (_tmp1671 * _tmp1671) + _tmp1066 * (_tmp1672 * _tmp1672) +
+                            _tmp1066 * (_tmp1673 * _tmp1673) + _tmp1066 * (_tmp1674 * _tmp1674) +
+                            _tmp1066 * (_tmp1676 * _tmp1676) + _tmp1066 * (_tmp1677 * _tmp1677) +
+                            _tmp1066 * (_tmp1680 * _tmp1680) + _tmp1066 * (_tmp1681 * _tmp1681) +
+                            _tmp1066 * (_tmp1682 * _tmp1682) + _tmp1066 * (_tmp1687 * _tmp1687) +
+                            _tmp1066 * (_tmp1688 * _tmp1688) + _tmp1066 * (_tmp1691 * _tmp1691) +
+                            _tmp1105 * (_tmp1690 * _tmp1690) + _tmp1185 * (_tmp1704 * _tmp1704) +
+                            (_tmp1679 * _tmp1679) + (_tmp1685 * _tmp1685) + (_tmp1686 * _tmp1686) +
+                            (_tmp1700 * _tmp1700) + (_tmp1703 * _tmp1703) + (_tmp1708 * _tmp1708);
     hessian_value_ptr[72] =
         _tmp1356 * _tmp1689 + _tmp1356 * _tmp1692 + _tmp1639 * _tmp1712 + _tmp1640 * _tmp1712 +
         _tmp1641 * _tmp1712 + _tmp1645 * _tmp1710 + _tmp1647 * _tmp1710 + _tmp1648 * _tmp1712 +
@@ -7347,10 +7337,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[78] = _tmp1356 * _tmp2797 + _tmp1705 * _tmp1709;
     hessian_value_ptr[79] = _tmp1633 * _tmp1705 + _tmp1718 * _tmp2797;
     hessian_value_ptr[80] = _tmp1354 * _tmp2797 + _tmp1634 * _tmp1705;
-    hessian_value_ptr[81] = _tmp1105 * std::pow(_tmp189, Scalar(2)) + _tmp1105 * _tmp2784 +
-                            _tmp1147 * std::pow(_tmp200, Scalar(2)) + _tmp1147 * _tmp2782 +
-                            _tmp1185 * std::pow(_tmp168, Scalar(2)) + _tmp1185 * _tmp2785 +
-                            _tmp2783 * _tmp2798 + _tmp2783 * _tmp2799 + _tmp2783 * _tmp2800;
+    hessian_value_ptr[81] =
+        _tmp1105 * (_tmp189 * _tmp189) + _tmp1105 * _tmp2784 + _tmp1147 * (_tmp200 * _tmp200) +
+        _tmp1147 * _tmp2782 + _tmp1185 * (_tmp168 * _tmp168) + _tmp1185 * _tmp2785 +
+        _tmp2783 * _tmp2798 + _tmp2783 * _tmp2799 + _tmp2783 * _tmp2800;
     hessian_value_ptr[82] = _tmp1180 * _tmp1725 + _tmp1333 * _tmp1722 + _tmp1340 * _tmp1713 +
                             _tmp1356 * _tmp2803 + _tmp1633 * _tmp2804 + _tmp168 * _tmp1721 +
                             _tmp187 * _tmp2801 + _tmp200 * _tmp2805 + _tmp2783 * _tmp2802;
@@ -7361,10 +7351,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[84] = _tmp1356 * _tmp2801 + _tmp1528 * _tmp2810 + _tmp168 * _tmp2809;
     hessian_value_ptr[85] = _tmp1529 * _tmp2810 + _tmp168 * _tmp2091 + _tmp1718 * _tmp2801;
     hessian_value_ptr[86] = _tmp1354 * _tmp2801 + _tmp1634 * _tmp2807 + _tmp200 * _tmp2811;
-    hessian_value_ptr[87] = _tmp1105 * std::pow(_tmp187, Scalar(2)) + _tmp1105 * _tmp2791 +
-                            _tmp1147 * std::pow(_tmp203, Scalar(2)) + _tmp1147 * _tmp2790 +
-                            _tmp1185 * std::pow(_tmp172, Scalar(2)) + _tmp1185 * _tmp2789 +
-                            _tmp2783 * _tmp2812 + _tmp2783 * _tmp2813 + _tmp2783 * _tmp2814;
+    hessian_value_ptr[87] =
+        _tmp1105 * (_tmp187 * _tmp187) + _tmp1105 * _tmp2791 + _tmp1147 * (_tmp203 * _tmp203) +
+        _tmp1147 * _tmp2790 + _tmp1185 * (_tmp172 * _tmp172) + _tmp1185 * _tmp2789 +
+        _tmp2783 * _tmp2812 + _tmp2783 * _tmp2813 + _tmp2783 * _tmp2814;
     hessian_value_ptr[88] = _tmp1262 * _tmp1732 + _tmp1340 * _tmp1726 + _tmp1350 * _tmp1725 +
                             _tmp1354 * _tmp2803 + _tmp1529 * _tmp2808 +
                             _tmp1633 * _tmp1634 * _tmp2783 + _tmp1721 * _tmp178 +
@@ -7372,39 +7362,37 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[89] = _tmp1528 * _tmp2805 + _tmp1709 * _tmp1721 + _tmp187 * _tmp2816;
     hessian_value_ptr[90] = _tmp1529 * _tmp2805 + _tmp1718 * _tmp2815 + _tmp172 * _tmp2091;
     hessian_value_ptr[91] = _tmp1354 * _tmp2815 + _tmp1634 * _tmp1721 + _tmp203 * _tmp2811;
-    hessian_value_ptr[92] = _tmp1105 * std::pow(_tmp193, Scalar(2)) + _tmp1105 * _tmp2793 +
-                            _tmp1147 * std::pow(_tmp199, Scalar(2)) + _tmp1147 * _tmp2794 +
-                            _tmp1185 * std::pow(_tmp178, Scalar(2)) + _tmp1185 * _tmp2792 +
-                            _tmp2783 * _tmp2817 + _tmp2783 * _tmp2818 + _tmp2783 * _tmp2819;
+    hessian_value_ptr[92] =
+        _tmp1105 * (_tmp193 * _tmp193) + _tmp1105 * _tmp2793 + _tmp1147 * (_tmp199 * _tmp199) +
+        _tmp1147 * _tmp2794 + _tmp1185 * (_tmp178 * _tmp178) + _tmp1185 * _tmp2792 +
+        _tmp2783 * _tmp2817 + _tmp2783 * _tmp2818 + _tmp2783 * _tmp2819;
     hessian_value_ptr[93] = _tmp1528 * _tmp2806 + _tmp178 * _tmp2809 + _tmp193 * _tmp2816;
     hessian_value_ptr[94] = _tmp1529 * _tmp2806 + _tmp178 * _tmp2091 + _tmp193 * _tmp2820;
     hessian_value_ptr[95] =
         _tmp1105 * _tmp1354 * _tmp193 + _tmp1185 * _tmp1634 * _tmp178 + _tmp1730 * _tmp2806;
-    hessian_value_ptr[96] =
-        _tmp1066 * std::pow(_tmp1741, Scalar(2)) + _tmp1066 * std::pow(_tmp1742, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1753, Scalar(2)) + _tmp1066 * std::pow(_tmp1759, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1760, Scalar(2)) + _tmp1066 * std::pow(_tmp1761, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1762, Scalar(2)) + _tmp1066 * std::pow(_tmp1763, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1765, Scalar(2)) + _tmp1066 * std::pow(_tmp1766, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1767, Scalar(2)) + _tmp1066 * std::pow(_tmp1768, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1770, Scalar(2)) + _tmp1066 * std::pow(_tmp1772, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1774, Scalar(2)) + _tmp1066 * std::pow(_tmp1821, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1823, Scalar(2)) + _tmp1066 * std::pow(_tmp1824, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1825, Scalar(2)) + _tmp1066 * std::pow(_tmp1826, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1827, Scalar(2)) + _tmp1066 * std::pow(_tmp1828, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1829, Scalar(2)) + _tmp1066 * std::pow(_tmp1830, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1832, Scalar(2)) + _tmp1066 * std::pow(_tmp1833, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1834, Scalar(2)) + _tmp1066 * std::pow(_tmp1835, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1837, Scalar(2)) + _tmp1066 * std::pow(_tmp1838, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1842, Scalar(2)) + _tmp1066 * std::pow(_tmp1856, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1858, Scalar(2)) + _tmp1066 * std::pow(_tmp1860, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1864, Scalar(2)) + _tmp1066 * std::pow(_tmp1865, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1866, Scalar(2)) + _tmp1066 * std::pow(_tmp1868, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1872, Scalar(2)) + _tmp1066 * std::pow(_tmp1884, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp1844, Scalar(2)) + _tmp1147 * std::pow(_tmp1862, Scalar(2)) +
-        std::pow(_tmp1758, Scalar(2)) + std::pow(_tmp1820, Scalar(2)) +
-        std::pow(_tmp1841, Scalar(2)) + std::pow(_tmp1855, Scalar(2)) +
-        std::pow(_tmp1871, Scalar(2)) + std::pow(_tmp1883, Scalar(2));
+    hessian_value_ptr[96] = _tmp1066 * (_tmp1741 * _tmp1741) + _tmp1066 * (_tmp1742 * _tmp1742) +
+                            _tmp1066 * (_tmp1753 * _tmp1753) + _tmp1066 * (_tmp1759 * _tmp1759) +
+                            _tmp1066 * (_tmp1760 * _tmp1760) + _tmp1066 * (_tmp1761 * _tmp1761) +
+                            _tmp1066 * (_tmp1762 * _tmp1762) + _tmp1066 * (_tmp1763 * _tmp1763) +
+                            _tmp1066 * (_tmp1765 * _tmp1765) + _tmp1066 * (_tmp1766 * _tmp1766) +
+                            _tmp1066 * (_tmp1767 * _tmp1767) + _tmp1066 * (_tmp1768 * _tmp1768) +
+                            _tmp1066 * (_tmp1770 * _tmp1770) + _tmp1066 * (_tmp1772 * _tmp1772) +
+                            _tmp1066 * (_tmp1774 * _tmp1774) + _tmp1066 * (_tmp1821 * _tmp1821) +
+                            _tmp1066 * (_tmp1823 * _tmp1823) + _tmp1066 * (_tmp1824 * _tmp1824) +
+                            _tmp1066 * (_tmp1825 * _tmp1825) + _tmp1066 * (_tmp1826 * _tmp1826) +
+                            _tmp1066 * (_tmp1827 * _tmp1827) + _tmp1066 * (_tmp1828 * _tmp1828) +
+                            _tmp1066 * (_tmp1829 * _tmp1829) + _tmp1066 * (_tmp1830 * _tmp1830) +
+                            _tmp1066 * (_tmp1832 * _tmp1832) + _tmp1066 * (_tmp1833 * _tmp1833) +
+                            _tmp1066 * (_tmp1834 * _tmp1834) + _tmp1066 * (_tmp1835 * _tmp1835) +
+                            _tmp1066 * (_tmp1837 * _tmp1837) + _tmp1066 * (_tmp1838 * _tmp1838) +
+                            _tmp1066 * (_tmp1842 * _tmp1842) + _tmp1066 * (_tmp1856 * _tmp1856) +
+                            _tmp1066 * (_tmp1858 * _tmp1858) + _tmp1066 * (_tmp1860 * _tmp1860) +
+                            _tmp1066 * (_tmp1864 * _tmp1864) + _tmp1066 * (_tmp1865 * _tmp1865) +
+                            _tmp1066 * (_tmp1866 * _tmp1866) + _tmp1066 * (_tmp1868 * _tmp1868) +
+                            _tmp1066 * (_tmp1872 * _tmp1872) + _tmp1066 * (_tmp1884 * _tmp1884) +
+                            _tmp1105 * (_tmp1844 * _tmp1844) + _tmp1147 * (_tmp1862 * _tmp1862) +
+                            (_tmp1758 * _tmp1758) + (_tmp1820 * _tmp1820) + (_tmp1841 * _tmp1841) +
+                            (_tmp1855 * _tmp1855) + (_tmp1871 * _tmp1871) + (_tmp1883 * _tmp1883);
     hessian_value_ptr[97] =
         _tmp1066 * _tmp1770 * _tmp1960 + _tmp1066 * _tmp1866 * _tmp1969 +
         _tmp1066 * _tmp1872 * _tmp1974 + _tmp1753 * _tmp1949 + _tmp1758 * _tmp1952 +
@@ -7464,31 +7452,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[105] = _tmp1744 * _tmp1845 + _tmp1863 * _tmp1895;
     hessian_value_ptr[106] = _tmp1845 * _tmp2094 + _tmp1862 * _tmp2456;
     hessian_value_ptr[107] = _tmp1748 * _tmp1845 + _tmp1863 * _tmp2097;
-    hessian_value_ptr[108] =
-        _tmp1066 * std::pow(_tmp1891, Scalar(2)) + _tmp1066 * std::pow(_tmp1892, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1903, Scalar(2)) + _tmp1066 * std::pow(_tmp1905, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1907, Scalar(2)) + _tmp1066 * std::pow(_tmp1909, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1910, Scalar(2)) + _tmp1066 * std::pow(_tmp1912, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1913, Scalar(2)) + _tmp1066 * std::pow(_tmp1916, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1918, Scalar(2)) + _tmp1066 * std::pow(_tmp1930, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1931, Scalar(2)) + _tmp1066 * std::pow(_tmp1932, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1933, Scalar(2)) + _tmp1066 * std::pow(_tmp1934, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1936, Scalar(2)) + _tmp1066 * std::pow(_tmp1938, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1940, Scalar(2)) + _tmp1066 * std::pow(_tmp1942, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1944, Scalar(2)) + _tmp1066 * std::pow(_tmp1946, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1948, Scalar(2)) + _tmp1066 * std::pow(_tmp1950, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1955, Scalar(2)) + _tmp1066 * std::pow(_tmp1956, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1957, Scalar(2)) + _tmp1066 * std::pow(_tmp1959, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1960, Scalar(2)) + _tmp1066 * std::pow(_tmp1961, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1967, Scalar(2)) + _tmp1066 * std::pow(_tmp1968, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1969, Scalar(2)) + _tmp1066 * std::pow(_tmp1972, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1974, Scalar(2)) + _tmp1066 * std::pow(_tmp1979, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1981, Scalar(2)) + _tmp1066 * std::pow(_tmp1983, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp1985, Scalar(2)) + _tmp1066 * std::pow(_tmp1988, Scalar(2)) +
-        _tmp1147 * std::pow(_tmp1970, Scalar(2)) + _tmp1185 * std::pow(_tmp1953, Scalar(2)) +
-        std::pow(_tmp1915, Scalar(2)) + std::pow(_tmp1929, Scalar(2)) +
-        std::pow(_tmp1952, Scalar(2)) + std::pow(_tmp1966, Scalar(2)) +
-        std::pow(_tmp1978, Scalar(2)) + std::pow(_tmp1987, Scalar(2));
+    hessian_value_ptr[108] = _tmp1066 * (_tmp1891 * _tmp1891) + _tmp1066 * (_tmp1892 * _tmp1892) +
+                             _tmp1066 * (_tmp1903 * _tmp1903) + _tmp1066 * (_tmp1905 * _tmp1905) +
+                             _tmp1066 * (_tmp1907 * _tmp1907) + _tmp1066 * (_tmp1909 * _tmp1909) +
+                             _tmp1066 * (_tmp1910 * _tmp1910) + _tmp1066 * (_tmp1912 * _tmp1912) +
+                             _tmp1066 * (_tmp1913 * _tmp1913) + _tmp1066 * (_tmp1916 * _tmp1916) +
+                             _tmp1066 * (_tmp1918 * _tmp1918) + _tmp1066 * (_tmp1930 * _tmp1930) +
+                             _tmp1066 * (_tmp1931 * _tmp1931) + _tmp1066 * (_tmp1932 * _tmp1932) +
+                             _tmp1066 * (_tmp1933 * _tmp1933) + _tmp1066 * (_tmp1934 * _tmp1934) +
+                             _tmp1066 * (_tmp1936 * _tmp1936) + _tmp1066 * (_tmp1938 * _tmp1938) +
+                             _tmp1066 * (_tmp1940 * _tmp1940) + _tmp1066 * (_tmp1942 * _tmp1942) +
+                             _tmp1066 * (_tmp1944 * _tmp1944) + _tmp1066 * (_tmp1946 * _tmp1946) +
+                             _tmp1066 * (_tmp1948 * _tmp1948) + _tmp1066 * (_tmp1950 * _tmp1950) +
+                             _tmp1066 * (_tmp1955 * _tmp1955) + _tmp1066 * (_tmp1956 * _tmp1956) +
+                             _tmp1066 * (_tmp1957 * _tmp1957) + _tmp1066 * (_tmp1959 * _tmp1959) +
+                             _tmp1066 * (_tmp1960 * _tmp1960) + _tmp1066 * (_tmp1961 * _tmp1961) +
+                             _tmp1066 * (_tmp1967 * _tmp1967) + _tmp1066 * (_tmp1968 * _tmp1968) +
+                             _tmp1066 * (_tmp1969 * _tmp1969) + _tmp1066 * (_tmp1972 * _tmp1972) +
+                             _tmp1066 * (_tmp1974 * _tmp1974) + _tmp1066 * (_tmp1979 * _tmp1979) +
+                             _tmp1066 * (_tmp1981 * _tmp1981) + _tmp1066 * (_tmp1983 * _tmp1983) +
+                             _tmp1066 * (_tmp1985 * _tmp1985) + _tmp1066 * (_tmp1988 * _tmp1988) +
+                             _tmp1147 * (_tmp1970 * _tmp1970) + _tmp1185 * (_tmp1953 * _tmp1953) +
+                             (_tmp1915 * _tmp1915) + (_tmp1929 * _tmp1929) + (_tmp1952 * _tmp1952) +
+                             (_tmp1966 * _tmp1966) + (_tmp1978 * _tmp1978) + (_tmp1987 * _tmp1987);
     hessian_value_ptr[109] =
         _tmp1066 * _tmp1905 * _tmp2013 + _tmp1066 * _tmp1907 * _tmp2014 +
         _tmp1066 * _tmp1910 * _tmp2019 + _tmp1066 * _tmp1936 * _tmp2038 +
@@ -7541,31 +7527,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[116] = _tmp1185 * _tmp1953 * _tmp2087 + _tmp1895 * _tmp1971;
     hessian_value_ptr[117] = _tmp1896 * _tmp1971 + _tmp1953 * _tmp2826;
     hessian_value_ptr[118] = _tmp1953 * _tmp2827 + _tmp1971 * _tmp2097;
-    hessian_value_ptr[119] =
-        _tmp1066 * std::pow(_tmp2000, Scalar(2)) + _tmp1066 * std::pow(_tmp2010, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2012, Scalar(2)) + _tmp1066 * std::pow(_tmp2013, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2014, Scalar(2)) + _tmp1066 * std::pow(_tmp2015, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2017, Scalar(2)) + _tmp1066 * std::pow(_tmp2019, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2020, Scalar(2)) + _tmp1066 * std::pow(_tmp2022, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2024, Scalar(2)) + _tmp1066 * std::pow(_tmp2025, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2026, Scalar(2)) + _tmp1066 * std::pow(_tmp2028, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2032, Scalar(2)) + _tmp1066 * std::pow(_tmp2034, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2036, Scalar(2)) + _tmp1066 * std::pow(_tmp2038, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2039, Scalar(2)) + _tmp1066 * std::pow(_tmp2041, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2043, Scalar(2)) + _tmp1066 * std::pow(_tmp2048, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2049, Scalar(2)) + _tmp1066 * std::pow(_tmp2051, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2052, Scalar(2)) + _tmp1066 * std::pow(_tmp2054, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2056, Scalar(2)) + _tmp1066 * std::pow(_tmp2061, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2063, Scalar(2)) + _tmp1066 * std::pow(_tmp2065, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2066, Scalar(2)) + _tmp1066 * std::pow(_tmp2069, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2071, Scalar(2)) + _tmp1066 * std::pow(_tmp2073, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2074, Scalar(2)) + _tmp1066 * std::pow(_tmp2076, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2078, Scalar(2)) + _tmp1066 * std::pow(_tmp2080, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2081, Scalar(2)) + _tmp1066 * std::pow(_tmp2082, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp2007, Scalar(2)) + _tmp1185 * std::pow(_tmp2068, Scalar(2)) +
-        std::pow(_tmp1996, Scalar(2)) + std::pow(_tmp2031, Scalar(2)) +
-        std::pow(_tmp2047, Scalar(2)) + std::pow(_tmp2060, Scalar(2)) +
-        std::pow(_tmp2064, Scalar(2)) + std::pow(_tmp2072, Scalar(2));
+    hessian_value_ptr[119] = _tmp1066 * (_tmp2000 * _tmp2000) + _tmp1066 * (_tmp2010 * _tmp2010) +
+                             _tmp1066 * (_tmp2012 * _tmp2012) + _tmp1066 * (_tmp2013 * _tmp2013) +
+                             _tmp1066 * (_tmp2014 * _tmp2014) + _tmp1066 * (_tmp2015 * _tmp2015) +
+                             _tmp1066 * (_tmp2017 * _tmp2017) + _tmp1066 * (_tmp2019 * _tmp2019) +
+                             _tmp1066 * (_tmp2020 * _tmp2020) + _tmp1066 * (_tmp2022 * _tmp2022) +
+                             _tmp1066 * (_tmp2024 * _tmp2024) + _tmp1066 * (_tmp2025 * _tmp2025) +
+                             _tmp1066 * (_tmp2026 * _tmp2026) + _tmp1066 * (_tmp2028 * _tmp2028) +
+                             _tmp1066 * (_tmp2032 * _tmp2032) + _tmp1066 * (_tmp2034 * _tmp2034) +
+                             _tmp1066 * (_tmp2036 * _tmp2036) + _tmp1066 * (_tmp2038 * _tmp2038) +
+                             _tmp1066 * (_tmp2039 * _tmp2039) + _tmp1066 * (_tmp2041 * _tmp2041) +
+                             _tmp1066 * (_tmp2043 * _tmp2043) + _tmp1066 * (_tmp2048 * _tmp2048) +
+                             _tmp1066 * (_tmp2049 * _tmp2049) + _tmp1066 * (_tmp2051 * _tmp2051) +
+                             _tmp1066 * (_tmp2052 * _tmp2052) + _tmp1066 * (_tmp2054 * _tmp2054) +
+                             _tmp1066 * (_tmp2056 * _tmp2056) + _tmp1066 * (_tmp2061 * _tmp2061) +
+                             _tmp1066 * (_tmp2063 * _tmp2063) + _tmp1066 * (_tmp2065 * _tmp2065) +
+                             _tmp1066 * (_tmp2066 * _tmp2066) + _tmp1066 * (_tmp2069 * _tmp2069) +
+                             _tmp1066 * (_tmp2071 * _tmp2071) + _tmp1066 * (_tmp2073 * _tmp2073) +
+                             _tmp1066 * (_tmp2074 * _tmp2074) + _tmp1066 * (_tmp2076 * _tmp2076) +
+                             _tmp1066 * (_tmp2078 * _tmp2078) + _tmp1066 * (_tmp2080 * _tmp2080) +
+                             _tmp1066 * (_tmp2081 * _tmp2081) + _tmp1066 * (_tmp2082 * _tmp2082) +
+                             _tmp1105 * (_tmp2007 * _tmp2007) + _tmp1185 * (_tmp2068 * _tmp2068) +
+                             (_tmp1996 * _tmp1996) + (_tmp2031 * _tmp2031) + (_tmp2047 * _tmp2047) +
+                             (_tmp2060 * _tmp2060) + (_tmp2064 * _tmp2064) + (_tmp2072 * _tmp2072);
     hessian_value_ptr[120] =
         _tmp1744 * _tmp2011 + _tmp1744 * _tmp2018 + _tmp1744 * _tmp2033 + _tmp1744 * _tmp2035 +
         _tmp1744 * _tmp2037 + _tmp1744 * _tmp2040 + _tmp1744 * _tmp2042 + _tmp1744 * _tmp2044 +
@@ -7608,10 +7592,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[126] = _tmp1744 * _tmp2008 + _tmp2087 * _tmp2822;
     hessian_value_ptr[127] = _tmp2003 * _tmp2822 + _tmp2008 * _tmp2094;
     hessian_value_ptr[128] = _tmp1748 * _tmp2008 + _tmp2004 * _tmp2822;
-    hessian_value_ptr[129] = _tmp1105 * _tmp2799 + _tmp1105 * std::pow(_tmp350, Scalar(2)) +
-                             _tmp1147 * _tmp2800 + _tmp1147 * std::pow(_tmp361, Scalar(2)) +
-                             _tmp1185 * _tmp2798 + _tmp1185 * std::pow(_tmp329, Scalar(2)) +
-                             _tmp2783 * _tmp2828 + _tmp2783 * _tmp2829 + _tmp2783 * _tmp2830;
+    hessian_value_ptr[129] =
+        _tmp1105 * _tmp2799 + _tmp1105 * (_tmp350 * _tmp350) + _tmp1147 * _tmp2800 +
+        _tmp1147 * (_tmp361 * _tmp361) + _tmp1185 * _tmp2798 + _tmp1185 * (_tmp329 * _tmp329) +
+        _tmp2783 * _tmp2828 + _tmp2783 * _tmp2829 + _tmp2783 * _tmp2830;
     hessian_value_ptr[130] = _tmp1147 * _tmp2802 + _tmp1709 * _tmp2091 + _tmp1718 * _tmp2816 +
                              _tmp1744 * _tmp2831 + _tmp1895 * _tmp2832 +
                              _tmp2003 * _tmp2087 * _tmp2783 + _tmp2089 * _tmp348 +
@@ -7623,49 +7607,47 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[132] = _tmp1744 * _tmp2089 + _tmp1895 * _tmp2085 + _tmp2087 * _tmp2823;
     hessian_value_ptr[133] = _tmp2456 * _tmp361 + _tmp2461 * _tmp350 + _tmp2826 * _tmp329;
     hessian_value_ptr[134] = _tmp2085 * _tmp2097 + _tmp2470 * _tmp350 + _tmp2827 * _tmp329;
-    hessian_value_ptr[135] = _tmp1105 * _tmp2812 + _tmp1105 * std::pow(_tmp348, Scalar(2)) +
-                             _tmp1147 * _tmp2814 + _tmp1147 * std::pow(_tmp364, Scalar(2)) +
-                             _tmp1185 * _tmp2813 + _tmp1185 * std::pow(_tmp339, Scalar(2)) +
-                             _tmp2783 * _tmp2834 + _tmp2783 * _tmp2835 + _tmp2783 * _tmp2836;
+    hessian_value_ptr[135] =
+        _tmp1105 * _tmp2812 + _tmp1105 * (_tmp348 * _tmp348) + _tmp1147 * _tmp2814 +
+        _tmp1147 * (_tmp364 * _tmp364) + _tmp1185 * _tmp2813 + _tmp1185 * (_tmp339 * _tmp339) +
+        _tmp2783 * _tmp2834 + _tmp2783 * _tmp2835 + _tmp2783 * _tmp2836;
     hessian_value_ptr[136] = _tmp1354 * _tmp2820 + _tmp1529 * _tmp2811 + _tmp1634 * _tmp2091 +
                              _tmp1748 * _tmp2831 + _tmp2003 * _tmp2833 + _tmp2090 * _tmp360 +
                              _tmp2097 * _tmp2832 + _tmp2101 * _tmp348 + _tmp2824 * _tmp335;
     hessian_value_ptr[137] = _tmp1895 * _tmp2090 + _tmp2087 * _tmp2824 + _tmp2454 * _tmp348;
     hessian_value_ptr[138] = _tmp2456 * _tmp364 + _tmp2461 * _tmp348 + _tmp2826 * _tmp339;
     hessian_value_ptr[139] = _tmp2004 * _tmp2824 + _tmp2090 * _tmp2097 + _tmp2470 * _tmp348;
-    hessian_value_ptr[140] = _tmp1105 * _tmp2819 + _tmp1105 * std::pow(_tmp354, Scalar(2)) +
-                             _tmp1147 * _tmp2817 + _tmp1147 * std::pow(_tmp360, Scalar(2)) +
-                             _tmp1185 * _tmp2818 + _tmp1185 * std::pow(_tmp335, Scalar(2)) +
-                             _tmp2783 * _tmp2837 + _tmp2783 * _tmp2838 + _tmp2783 * _tmp2839;
+    hessian_value_ptr[140] =
+        _tmp1105 * _tmp2819 + _tmp1105 * (_tmp354 * _tmp354) + _tmp1147 * _tmp2817 +
+        _tmp1147 * (_tmp360 * _tmp360) + _tmp1185 * _tmp2818 + _tmp1185 * (_tmp335 * _tmp335) +
+        _tmp2783 * _tmp2837 + _tmp2783 * _tmp2838 + _tmp2783 * _tmp2839;
     hessian_value_ptr[141] = _tmp1744 * _tmp2101 + _tmp2087 * _tmp2825 + _tmp2453 * _tmp360;
     hessian_value_ptr[142] = _tmp2094 * _tmp2101 + _tmp2456 * _tmp360 + _tmp2826 * _tmp335;
     hessian_value_ptr[143] =
         _tmp1147 * _tmp2097 * _tmp360 + _tmp1748 * _tmp2101 + _tmp2827 * _tmp335;
-    hessian_value_ptr[144] =
-        _tmp1066 * std::pow(_tmp2108, Scalar(2)) + _tmp1066 * std::pow(_tmp2122, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2124, Scalar(2)) + _tmp1066 * std::pow(_tmp2131, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2133, Scalar(2)) + _tmp1066 * std::pow(_tmp2175, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2181, Scalar(2)) + _tmp1066 * std::pow(_tmp2183, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2185, Scalar(2)) + _tmp1066 * std::pow(_tmp2187, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2189, Scalar(2)) + _tmp1066 * std::pow(_tmp2191, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2202, Scalar(2)) + _tmp1066 * std::pow(_tmp2203, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2204, Scalar(2)) + _tmp1066 * std::pow(_tmp2205, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2208, Scalar(2)) + _tmp1066 * std::pow(_tmp2210, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2212, Scalar(2)) + _tmp1066 * std::pow(_tmp2213, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2215, Scalar(2)) + _tmp1066 * std::pow(_tmp2216, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2217, Scalar(2)) + _tmp1066 * std::pow(_tmp2218, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2219, Scalar(2)) + _tmp1066 * std::pow(_tmp2221, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2223, Scalar(2)) + _tmp1066 * std::pow(_tmp2225, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2227, Scalar(2)) + _tmp1066 * std::pow(_tmp2229, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2231, Scalar(2)) + _tmp1066 * std::pow(_tmp2233, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2235, Scalar(2)) + _tmp1066 * std::pow(_tmp2237, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2239, Scalar(2)) + _tmp1066 * std::pow(_tmp2241, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2243, Scalar(2)) + _tmp1066 * std::pow(_tmp2245, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2247, Scalar(2)) + _tmp1066 * std::pow(_tmp2248, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp2135, Scalar(2)) + _tmp1147 * std::pow(_tmp2206, Scalar(2)) +
-        std::pow(_tmp2130, Scalar(2)) + std::pow(_tmp2174, Scalar(2)) +
-        std::pow(_tmp2180, Scalar(2)) + std::pow(_tmp2201, Scalar(2)) +
-        std::pow(_tmp2258, Scalar(2)) + std::pow(_tmp2260, Scalar(2));
+    hessian_value_ptr[144] = _tmp1066 * (_tmp2108 * _tmp2108) + _tmp1066 * (_tmp2122 * _tmp2122) +
+                             _tmp1066 * (_tmp2124 * _tmp2124) + _tmp1066 * (_tmp2131 * _tmp2131) +
+                             _tmp1066 * (_tmp2133 * _tmp2133) + _tmp1066 * (_tmp2175 * _tmp2175) +
+                             _tmp1066 * (_tmp2181 * _tmp2181) + _tmp1066 * (_tmp2183 * _tmp2183) +
+                             _tmp1066 * (_tmp2185 * _tmp2185) + _tmp1066 * (_tmp2187 * _tmp2187) +
+                             _tmp1066 * (_tmp2189 * _tmp2189) + _tmp1066 * (_tmp2191 * _tmp2191) +
+                             _tmp1066 * (_tmp2202 * _tmp2202) + _tmp1066 * (_tmp2203 * _tmp2203) +
+                             _tmp1066 * (_tmp2204 * _tmp2204) + _tmp1066 * (_tmp2205 * _tmp2205) +
+                             _tmp1066 * (_tmp2208 * _tmp2208) + _tmp1066 * (_tmp2210 * _tmp2210) +
+                             _tmp1066 * (_tmp2212 * _tmp2212) + _tmp1066 * (_tmp2213 * _tmp2213) +
+                             _tmp1066 * (_tmp2215 * _tmp2215) + _tmp1066 * (_tmp2216 * _tmp2216) +
+                             _tmp1066 * (_tmp2217 * _tmp2217) + _tmp1066 * (_tmp2218 * _tmp2218) +
+                             _tmp1066 * (_tmp2219 * _tmp2219) + _tmp1066 * (_tmp2221 * _tmp2221) +
+                             _tmp1066 * (_tmp2223 * _tmp2223) + _tmp1066 * (_tmp2225 * _tmp2225) +
+                             _tmp1066 * (_tmp2227 * _tmp2227) + _tmp1066 * (_tmp2229 * _tmp2229) +
+                             _tmp1066 * (_tmp2231 * _tmp2231) + _tmp1066 * (_tmp2233 * _tmp2233) +
+                             _tmp1066 * (_tmp2235 * _tmp2235) + _tmp1066 * (_tmp2237 * _tmp2237) +
+                             _tmp1066 * (_tmp2239 * _tmp2239) + _tmp1066 * (_tmp2241 * _tmp2241) +
+                             _tmp1066 * (_tmp2243 * _tmp2243) + _tmp1066 * (_tmp2245 * _tmp2245) +
+                             _tmp1066 * (_tmp2247 * _tmp2247) + _tmp1066 * (_tmp2248 * _tmp2248) +
+                             _tmp1105 * (_tmp2135 * _tmp2135) + _tmp1147 * (_tmp2206 * _tmp2206) +
+                             (_tmp2130 * _tmp2130) + (_tmp2174 * _tmp2174) + (_tmp2180 * _tmp2180) +
+                             (_tmp2201 * _tmp2201) + (_tmp2258 * _tmp2258) + (_tmp2260 * _tmp2260);
     hessian_value_ptr[145] = _tmp1066 * _tmp2181 * _tmp2281 + _tmp1066 * _tmp2183 * _tmp2287 +
                              _tmp1066 * _tmp2185 * _tmp2288 + _tmp1066 * _tmp2187 * _tmp2289 +
                              _tmp1066 * _tmp2189 * _tmp2290 + _tmp1066 * _tmp2191 * _tmp2297 +
@@ -7730,31 +7712,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[153] = _tmp2135 * _tmp2721 + _tmp2206 * _tmp2844;
     hessian_value_ptr[154] = _tmp2135 * _tmp2728 + _tmp2206 * _tmp2845;
     hessian_value_ptr[155] = _tmp1147 * _tmp2206 * _tmp2468 + _tmp2135 * _tmp2732;
-    hessian_value_ptr[156] =
-        _tmp1066 * std::pow(_tmp2266, Scalar(2)) + _tmp1066 * std::pow(_tmp2276, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2278, Scalar(2)) + _tmp1066 * std::pow(_tmp2279, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2280, Scalar(2)) + _tmp1066 * std::pow(_tmp2281, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2282, Scalar(2)) + _tmp1066 * std::pow(_tmp2283, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2284, Scalar(2)) + _tmp1066 * std::pow(_tmp2286, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2287, Scalar(2)) + _tmp1066 * std::pow(_tmp2288, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2289, Scalar(2)) + _tmp1066 * std::pow(_tmp2290, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2291, Scalar(2)) + _tmp1066 * std::pow(_tmp2297, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2298, Scalar(2)) + _tmp1066 * std::pow(_tmp2299, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2300, Scalar(2)) + _tmp1066 * std::pow(_tmp2302, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2304, Scalar(2)) + _tmp1066 * std::pow(_tmp2305, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2307, Scalar(2)) + _tmp1066 * std::pow(_tmp2308, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2319, Scalar(2)) + _tmp1066 * std::pow(_tmp2322, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2324, Scalar(2)) + _tmp1066 * std::pow(_tmp2326, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2328, Scalar(2)) + _tmp1066 * std::pow(_tmp2331, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2332, Scalar(2)) + _tmp1066 * std::pow(_tmp2334, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2335, Scalar(2)) + _tmp1066 * std::pow(_tmp2336, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2338, Scalar(2)) + _tmp1066 * std::pow(_tmp2340, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2342, Scalar(2)) + _tmp1066 * std::pow(_tmp2344, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2356, Scalar(2)) + _tmp1066 * std::pow(_tmp2358, Scalar(2)) +
-        _tmp1147 * std::pow(_tmp2330, Scalar(2)) + _tmp1185 * std::pow(_tmp2320, Scalar(2)) +
-        std::pow(_tmp2296, Scalar(2)) + std::pow(_tmp2318, Scalar(2)) +
-        std::pow(_tmp2323, Scalar(2)) + std::pow(_tmp2333, Scalar(2)) +
-        std::pow(_tmp2350, Scalar(2)) + std::pow(_tmp2355, Scalar(2));
+    hessian_value_ptr[156] = _tmp1066 * (_tmp2266 * _tmp2266) + _tmp1066 * (_tmp2276 * _tmp2276) +
+                             _tmp1066 * (_tmp2278 * _tmp2278) + _tmp1066 * (_tmp2279 * _tmp2279) +
+                             _tmp1066 * (_tmp2280 * _tmp2280) + _tmp1066 * (_tmp2281 * _tmp2281) +
+                             _tmp1066 * (_tmp2282 * _tmp2282) + _tmp1066 * (_tmp2283 * _tmp2283) +
+                             _tmp1066 * (_tmp2284 * _tmp2284) + _tmp1066 * (_tmp2286 * _tmp2286) +
+                             _tmp1066 * (_tmp2287 * _tmp2287) + _tmp1066 * (_tmp2288 * _tmp2288) +
+                             _tmp1066 * (_tmp2289 * _tmp2289) + _tmp1066 * (_tmp2290 * _tmp2290) +
+                             _tmp1066 * (_tmp2291 * _tmp2291) + _tmp1066 * (_tmp2297 * _tmp2297) +
+                             _tmp1066 * (_tmp2298 * _tmp2298) + _tmp1066 * (_tmp2299 * _tmp2299) +
+                             _tmp1066 * (_tmp2300 * _tmp2300) + _tmp1066 * (_tmp2302 * _tmp2302) +
+                             _tmp1066 * (_tmp2304 * _tmp2304) + _tmp1066 * (_tmp2305 * _tmp2305) +
+                             _tmp1066 * (_tmp2307 * _tmp2307) + _tmp1066 * (_tmp2308 * _tmp2308) +
+                             _tmp1066 * (_tmp2319 * _tmp2319) + _tmp1066 * (_tmp2322 * _tmp2322) +
+                             _tmp1066 * (_tmp2324 * _tmp2324) + _tmp1066 * (_tmp2326 * _tmp2326) +
+                             _tmp1066 * (_tmp2328 * _tmp2328) + _tmp1066 * (_tmp2331 * _tmp2331) +
+                             _tmp1066 * (_tmp2332 * _tmp2332) + _tmp1066 * (_tmp2334 * _tmp2334) +
+                             _tmp1066 * (_tmp2335 * _tmp2335) + _tmp1066 * (_tmp2336 * _tmp2336) +
+                             _tmp1066 * (_tmp2338 * _tmp2338) + _tmp1066 * (_tmp2340 * _tmp2340) +
+                             _tmp1066 * (_tmp2342 * _tmp2342) + _tmp1066 * (_tmp2344 * _tmp2344) +
+                             _tmp1066 * (_tmp2356 * _tmp2356) + _tmp1066 * (_tmp2358 * _tmp2358) +
+                             _tmp1147 * (_tmp2330 * _tmp2330) + _tmp1185 * (_tmp2320 * _tmp2320) +
+                             (_tmp2296 * _tmp2296) + (_tmp2318 * _tmp2318) + (_tmp2323 * _tmp2323) +
+                             (_tmp2333 * _tmp2333) + (_tmp2350 * _tmp2350) + (_tmp2355 * _tmp2355);
     hessian_value_ptr[157] =
         _tmp1066 * _tmp2276 * _tmp2377 + _tmp1066 * _tmp2284 * _tmp2376 +
         _tmp1066 * _tmp2291 * _tmp2387 + _tmp1066 * _tmp2300 * _tmp2394 +
@@ -7807,31 +7787,29 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[164] = _tmp2321 * _tmp2451 + _tmp2330 * _tmp2844;
     hessian_value_ptr[165] = _tmp2271 * _tmp2840 + _tmp2320 * _tmp2729;
     hessian_value_ptr[166] = _tmp2321 * _tmp2361 + _tmp2468 * _tmp2840;
-    hessian_value_ptr[167] =
-        _tmp1066 * std::pow(_tmp2367, Scalar(2)) + _tmp1066 * std::pow(_tmp2371, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2376, Scalar(2)) + _tmp1066 * std::pow(_tmp2377, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2385, Scalar(2)) + _tmp1066 * std::pow(_tmp2387, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2388, Scalar(2)) + _tmp1066 * std::pow(_tmp2390, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2392, Scalar(2)) + _tmp1066 * std::pow(_tmp2394, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2395, Scalar(2)) + _tmp1066 * std::pow(_tmp2397, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2399, Scalar(2)) + _tmp1066 * std::pow(_tmp2401, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2402, Scalar(2)) + _tmp1066 * std::pow(_tmp2404, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2406, Scalar(2)) + _tmp1066 * std::pow(_tmp2408, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2413, Scalar(2)) + _tmp1066 * std::pow(_tmp2414, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2415, Scalar(2)) + _tmp1066 * std::pow(_tmp2421, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2422, Scalar(2)) + _tmp1066 * std::pow(_tmp2423, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2424, Scalar(2)) + _tmp1066 * std::pow(_tmp2425, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2426, Scalar(2)) + _tmp1066 * std::pow(_tmp2427, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2428, Scalar(2)) + _tmp1066 * std::pow(_tmp2429, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2430, Scalar(2)) + _tmp1066 * std::pow(_tmp2433, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2434, Scalar(2)) + _tmp1066 * std::pow(_tmp2435, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2437, Scalar(2)) + _tmp1066 * std::pow(_tmp2438, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2440, Scalar(2)) + _tmp1066 * std::pow(_tmp2441, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2442, Scalar(2)) + _tmp1066 * std::pow(_tmp2443, Scalar(2)) +
-        _tmp1105 * std::pow(_tmp2419, Scalar(2)) + _tmp1185 * std::pow(_tmp2431, Scalar(2)) +
-        std::pow(_tmp2375, Scalar(2)) + std::pow(_tmp2384, Scalar(2)) +
-        std::pow(_tmp2412, Scalar(2)) + std::pow(_tmp2417, Scalar(2)) +
-        std::pow(_tmp2418, Scalar(2)) + std::pow(_tmp2446, Scalar(2));
+    hessian_value_ptr[167] = _tmp1066 * (_tmp2367 * _tmp2367) + _tmp1066 * (_tmp2371 * _tmp2371) +
+                             _tmp1066 * (_tmp2376 * _tmp2376) + _tmp1066 * (_tmp2377 * _tmp2377) +
+                             _tmp1066 * (_tmp2385 * _tmp2385) + _tmp1066 * (_tmp2387 * _tmp2387) +
+                             _tmp1066 * (_tmp2388 * _tmp2388) + _tmp1066 * (_tmp2390 * _tmp2390) +
+                             _tmp1066 * (_tmp2392 * _tmp2392) + _tmp1066 * (_tmp2394 * _tmp2394) +
+                             _tmp1066 * (_tmp2395 * _tmp2395) + _tmp1066 * (_tmp2397 * _tmp2397) +
+                             _tmp1066 * (_tmp2399 * _tmp2399) + _tmp1066 * (_tmp2401 * _tmp2401) +
+                             _tmp1066 * (_tmp2402 * _tmp2402) + _tmp1066 * (_tmp2404 * _tmp2404) +
+                             _tmp1066 * (_tmp2406 * _tmp2406) + _tmp1066 * (_tmp2408 * _tmp2408) +
+                             _tmp1066 * (_tmp2413 * _tmp2413) + _tmp1066 * (_tmp2414 * _tmp2414) +
+                             _tmp1066 * (_tmp2415 * _tmp2415) + _tmp1066 * (_tmp2421 * _tmp2421) +
+                             _tmp1066 * (_tmp2422 * _tmp2422) + _tmp1066 * (_tmp2423 * _tmp2423) +
+                             _tmp1066 * (_tmp2424 * _tmp2424) + _tmp1066 * (_tmp2425 * _tmp2425) +
+                             _tmp1066 * (_tmp2426 * _tmp2426) + _tmp1066 * (_tmp2427 * _tmp2427) +
+                             _tmp1066 * (_tmp2428 * _tmp2428) + _tmp1066 * (_tmp2429 * _tmp2429) +
+                             _tmp1066 * (_tmp2430 * _tmp2430) + _tmp1066 * (_tmp2433 * _tmp2433) +
+                             _tmp1066 * (_tmp2434 * _tmp2434) + _tmp1066 * (_tmp2435 * _tmp2435) +
+                             _tmp1066 * (_tmp2437 * _tmp2437) + _tmp1066 * (_tmp2438 * _tmp2438) +
+                             _tmp1066 * (_tmp2440 * _tmp2440) + _tmp1066 * (_tmp2441 * _tmp2441) +
+                             _tmp1066 * (_tmp2442 * _tmp2442) + _tmp1066 * (_tmp2443 * _tmp2443) +
+                             _tmp1105 * (_tmp2419 * _tmp2419) + _tmp1185 * (_tmp2431 * _tmp2431) +
+                             (_tmp2375 * _tmp2375) + (_tmp2384 * _tmp2384) + (_tmp2412 * _tmp2412) +
+                             (_tmp2417 * _tmp2417) + (_tmp2418 * _tmp2418) + (_tmp2446 * _tmp2446);
     hessian_value_ptr[168] =
         _tmp2117 * _tmp2436 + _tmp2117 * _tmp2439 + _tmp2367 * _tmp2449 + _tmp2371 * _tmp2452 +
         _tmp2376 * _tmp2452 + _tmp2377 * _tmp2452 + _tmp2386 * _tmp2451 + _tmp2387 * _tmp2452 +
@@ -7874,10 +7852,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[174] = _tmp2419 * _tmp2721 + _tmp2432 * _tmp2451;
     hessian_value_ptr[175] = _tmp2362 * _tmp2432 + _tmp2420 * _tmp2459;
     hessian_value_ptr[176] = _tmp2361 * _tmp2432 + _tmp2419 * _tmp2732;
-    hessian_value_ptr[177] = _tmp1105 * _tmp2829 + _tmp1105 * std::pow(_tmp511, Scalar(2)) +
-                             _tmp1147 * _tmp2828 + _tmp1147 * std::pow(_tmp525, Scalar(2)) +
-                             _tmp1185 * _tmp2830 + _tmp1185 * std::pow(_tmp490, Scalar(2)) +
-                             _tmp2783 * _tmp2850 + _tmp2783 * _tmp2851 + _tmp2783 * _tmp2852;
+    hessian_value_ptr[177] =
+        _tmp1105 * _tmp2829 + _tmp1105 * (_tmp511 * _tmp511) + _tmp1147 * _tmp2828 +
+        _tmp1147 * (_tmp525 * _tmp525) + _tmp1185 * _tmp2830 + _tmp1185 * (_tmp490 * _tmp490) +
+        _tmp2783 * _tmp2850 + _tmp2783 * _tmp2851 + _tmp2783 * _tmp2852;
     hessian_value_ptr[178] = _tmp1744 * _tmp2461 + _tmp1895 * _tmp2456 + _tmp2087 * _tmp2826 +
                              _tmp2117 * _tmp2459 * _tmp2783 + _tmp2271 * _tmp2853 +
                              _tmp2362 * _tmp2854 + _tmp2448 * _tmp509 + _tmp2462 * _tmp490 +
@@ -7889,10 +7867,10 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[181] = _tmp2271 * _tmp2841 + _tmp2448 * _tmp2459 + _tmp2729 * _tmp490;
     hessian_value_ptr[182] =
         _tmp1185 * _tmp2361 * _tmp490 + _tmp2468 * _tmp2841 + _tmp2732 * _tmp511;
-    hessian_value_ptr[183] = _tmp1105 * _tmp2835 + _tmp1105 * std::pow(_tmp509, Scalar(2)) +
-                             _tmp1147 * _tmp2836 + _tmp1147 * std::pow(_tmp523, Scalar(2)) +
-                             _tmp1185 * _tmp2834 + _tmp1185 * std::pow(_tmp495, Scalar(2)) +
-                             _tmp2783 * _tmp2857 + _tmp2783 * _tmp2858 + _tmp2783 * _tmp2859;
+    hessian_value_ptr[183] =
+        _tmp1105 * _tmp2835 + _tmp1105 * (_tmp509 * _tmp509) + _tmp1147 * _tmp2836 +
+        _tmp1147 * (_tmp523 * _tmp523) + _tmp1185 * _tmp2834 + _tmp1185 * (_tmp495 * _tmp495) +
+        _tmp2783 * _tmp2857 + _tmp2783 * _tmp2858 + _tmp2783 * _tmp2859;
     hessian_value_ptr[184] = _tmp2004 * _tmp2826 + _tmp2094 * _tmp2470 + _tmp2097 * _tmp2456 +
                              _tmp2271 * _tmp2468 * _tmp2783 + _tmp2361 * _tmp2362 * _tmp2783 +
                              _tmp2459 * _tmp2855 + _tmp2464 * _tmp509 + _tmp2467 * _tmp495 +
@@ -7900,36 +7878,34 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
     hessian_value_ptr[185] = _tmp2451 * _tmp2462 + _tmp2721 * _tmp509 + _tmp2844 * _tmp523;
     hessian_value_ptr[186] = _tmp2271 * _tmp2842 + _tmp2362 * _tmp2462 + _tmp2728 * _tmp509;
     hessian_value_ptr[187] = _tmp2361 * _tmp2462 + _tmp2468 * _tmp2842 + _tmp2732 * _tmp509;
-    hessian_value_ptr[188] = _tmp1105 * _tmp2839 + _tmp1105 * std::pow(_tmp515, Scalar(2)) +
-                             _tmp1147 * _tmp2838 + _tmp1147 * std::pow(_tmp521, Scalar(2)) +
-                             _tmp1185 * _tmp2837 + _tmp1185 * std::pow(_tmp500, Scalar(2)) +
-                             _tmp2783 * _tmp2860 + _tmp2783 * _tmp2861 + _tmp2783 * _tmp2862;
+    hessian_value_ptr[188] =
+        _tmp1105 * _tmp2839 + _tmp1105 * (_tmp515 * _tmp515) + _tmp1147 * _tmp2838 +
+        _tmp1147 * (_tmp521 * _tmp521) + _tmp1185 * _tmp2837 + _tmp1185 * (_tmp500 * _tmp500) +
+        _tmp2783 * _tmp2860 + _tmp2783 * _tmp2861 + _tmp2783 * _tmp2862;
     hessian_value_ptr[189] = _tmp2451 * _tmp2467 + _tmp2721 * _tmp515 + _tmp2844 * _tmp521;
     hessian_value_ptr[190] = _tmp2362 * _tmp2467 + _tmp2459 * _tmp2464 + _tmp2845 * _tmp521;
     hessian_value_ptr[191] = _tmp2361 * _tmp2467 + _tmp2468 * _tmp2843 + _tmp2732 * _tmp515;
-    hessian_value_ptr[192] =
-        _tmp1066 * std::pow(_tmp2478, Scalar(2)) + _tmp1066 * std::pow(_tmp2486, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2488, Scalar(2)) + _tmp1066 * std::pow(_tmp2490, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2491, Scalar(2)) + _tmp1066 * std::pow(_tmp2492, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2493, Scalar(2)) + _tmp1066 * std::pow(_tmp2494, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2496, Scalar(2)) + _tmp1066 * std::pow(_tmp2498, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2500, Scalar(2)) + _tmp1066 * std::pow(_tmp2519, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2520, Scalar(2)) + _tmp1066 * std::pow(_tmp2522, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2523, Scalar(2)) + _tmp1066 * std::pow(_tmp2524, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2526, Scalar(2)) + _tmp1066 * std::pow(_tmp2528, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2530, Scalar(2)) + _tmp1066 * std::pow(_tmp2532, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2534, Scalar(2)) + _tmp1066 * std::pow(_tmp2536, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2538, Scalar(2)) + _tmp1066 * std::pow(_tmp2540, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2542, Scalar(2)) + _tmp1066 * std::pow(_tmp2544, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2546, Scalar(2)) + _tmp1066 * std::pow(_tmp2548, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2550, Scalar(2)) + _tmp1066 * std::pow(_tmp2552, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2554, Scalar(2)) + _tmp1066 * std::pow(_tmp2556, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2558, Scalar(2)) + _tmp1066 * std::pow(_tmp2560, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2562, Scalar(2)) + _tmp1066 * std::pow(_tmp2567, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2569, Scalar(2)) + _tmp1066 * std::pow(_tmp2571, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2573, Scalar(2)) + _tmp1066 * std::pow(_tmp2575, Scalar(2)) +
-        std::pow(_tmp2518, Scalar(2)) + std::pow(_tmp2566, Scalar(2)) +
-        std::pow(_tmp2579, Scalar(2));
+    hessian_value_ptr[192] = _tmp1066 * (_tmp2478 * _tmp2478) + _tmp1066 * (_tmp2486 * _tmp2486) +
+                             _tmp1066 * (_tmp2488 * _tmp2488) + _tmp1066 * (_tmp2490 * _tmp2490) +
+                             _tmp1066 * (_tmp2491 * _tmp2491) + _tmp1066 * (_tmp2492 * _tmp2492) +
+                             _tmp1066 * (_tmp2493 * _tmp2493) + _tmp1066 * (_tmp2494 * _tmp2494) +
+                             _tmp1066 * (_tmp2496 * _tmp2496) + _tmp1066 * (_tmp2498 * _tmp2498) +
+                             _tmp1066 * (_tmp2500 * _tmp2500) + _tmp1066 * (_tmp2519 * _tmp2519) +
+                             _tmp1066 * (_tmp2520 * _tmp2520) + _tmp1066 * (_tmp2522 * _tmp2522) +
+                             _tmp1066 * (_tmp2523 * _tmp2523) + _tmp1066 * (_tmp2524 * _tmp2524) +
+                             _tmp1066 * (_tmp2526 * _tmp2526) + _tmp1066 * (_tmp2528 * _tmp2528) +
+                             _tmp1066 * (_tmp2530 * _tmp2530) + _tmp1066 * (_tmp2532 * _tmp2532) +
+                             _tmp1066 * (_tmp2534 * _tmp2534) + _tmp1066 * (_tmp2536 * _tmp2536) +
+                             _tmp1066 * (_tmp2538 * _tmp2538) + _tmp1066 * (_tmp2540 * _tmp2540) +
+                             _tmp1066 * (_tmp2542 * _tmp2542) + _tmp1066 * (_tmp2544 * _tmp2544) +
+                             _tmp1066 * (_tmp2546 * _tmp2546) + _tmp1066 * (_tmp2548 * _tmp2548) +
+                             _tmp1066 * (_tmp2550 * _tmp2550) + _tmp1066 * (_tmp2552 * _tmp2552) +
+                             _tmp1066 * (_tmp2554 * _tmp2554) + _tmp1066 * (_tmp2556 * _tmp2556) +
+                             _tmp1066 * (_tmp2558 * _tmp2558) + _tmp1066 * (_tmp2560 * _tmp2560) +
+                             _tmp1066 * (_tmp2562 * _tmp2562) + _tmp1066 * (_tmp2567 * _tmp2567) +
+                             _tmp1066 * (_tmp2569 * _tmp2569) + _tmp1066 * (_tmp2571 * _tmp2571) +
+                             _tmp1066 * (_tmp2573 * _tmp2573) + _tmp1066 * (_tmp2575 * _tmp2575) +
+                             (_tmp2518 * _tmp2518) + (_tmp2566 * _tmp2566) + (_tmp2579 * _tmp2579);
     hessian_value_ptr[193] = _tmp1066 * _tmp2494 * _tmp2604 + _tmp1066 * _tmp2536 * _tmp2647 +
                              _tmp1066 * _tmp2538 * _tmp2648 + _tmp1066 * _tmp2540 * _tmp2649 +
                              _tmp1066 * _tmp2567 * _tmp2656 + _tmp1066 * _tmp2573 * _tmp2658 +
@@ -7983,29 +7959,27 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
         _tmp2550 * _tmp2733 + _tmp2552 * _tmp2733 + _tmp2554 * _tmp2733 + _tmp2556 * _tmp2733 +
         _tmp2558 * _tmp2733 + _tmp2560 * _tmp2733 + _tmp2562 * _tmp2733 + _tmp2567 * _tmp2736 +
         _tmp2569 * _tmp2733 + _tmp2571 * _tmp2733 + _tmp2573 * _tmp2736 + _tmp2575 * _tmp2736;
-    hessian_value_ptr[198] =
-        _tmp1066 * std::pow(_tmp2588, Scalar(2)) + _tmp1066 * std::pow(_tmp2591, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2592, Scalar(2)) + _tmp1066 * std::pow(_tmp2594, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2596, Scalar(2)) + _tmp1066 * std::pow(_tmp2597, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2599, Scalar(2)) + _tmp1066 * std::pow(_tmp2601, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2602, Scalar(2)) + _tmp1066 * std::pow(_tmp2603, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2604, Scalar(2)) + _tmp1066 * std::pow(_tmp2605, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2607, Scalar(2)) + _tmp1066 * std::pow(_tmp2616, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2618, Scalar(2)) + _tmp1066 * std::pow(_tmp2619, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2620, Scalar(2)) + _tmp1066 * std::pow(_tmp2621, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2623, Scalar(2)) + _tmp1066 * std::pow(_tmp2625, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2627, Scalar(2)) + _tmp1066 * std::pow(_tmp2629, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2631, Scalar(2)) + _tmp1066 * std::pow(_tmp2633, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2635, Scalar(2)) + _tmp1066 * std::pow(_tmp2637, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2639, Scalar(2)) + _tmp1066 * std::pow(_tmp2641, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2643, Scalar(2)) + _tmp1066 * std::pow(_tmp2644, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2645, Scalar(2)) + _tmp1066 * std::pow(_tmp2646, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2647, Scalar(2)) + _tmp1066 * std::pow(_tmp2648, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2649, Scalar(2)) + _tmp1066 * std::pow(_tmp2650, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2652, Scalar(2)) + _tmp1066 * std::pow(_tmp2656, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2657, Scalar(2)) + _tmp1066 * std::pow(_tmp2658, Scalar(2)) +
-        std::pow(_tmp2615, Scalar(2)) + std::pow(_tmp2655, Scalar(2)) +
-        std::pow(_tmp2659, Scalar(2));
+    hessian_value_ptr[198] = _tmp1066 * (_tmp2588 * _tmp2588) + _tmp1066 * (_tmp2591 * _tmp2591) +
+                             _tmp1066 * (_tmp2592 * _tmp2592) + _tmp1066 * (_tmp2594 * _tmp2594) +
+                             _tmp1066 * (_tmp2596 * _tmp2596) + _tmp1066 * (_tmp2597 * _tmp2597) +
+                             _tmp1066 * (_tmp2599 * _tmp2599) + _tmp1066 * (_tmp2601 * _tmp2601) +
+                             _tmp1066 * (_tmp2602 * _tmp2602) + _tmp1066 * (_tmp2603 * _tmp2603) +
+                             _tmp1066 * (_tmp2604 * _tmp2604) + _tmp1066 * (_tmp2605 * _tmp2605) +
+                             _tmp1066 * (_tmp2607 * _tmp2607) + _tmp1066 * (_tmp2616 * _tmp2616) +
+                             _tmp1066 * (_tmp2618 * _tmp2618) + _tmp1066 * (_tmp2619 * _tmp2619) +
+                             _tmp1066 * (_tmp2620 * _tmp2620) + _tmp1066 * (_tmp2621 * _tmp2621) +
+                             _tmp1066 * (_tmp2623 * _tmp2623) + _tmp1066 * (_tmp2625 * _tmp2625) +
+                             _tmp1066 * (_tmp2627 * _tmp2627) + _tmp1066 * (_tmp2629 * _tmp2629) +
+                             _tmp1066 * (_tmp2631 * _tmp2631) + _tmp1066 * (_tmp2633 * _tmp2633) +
+                             _tmp1066 * (_tmp2635 * _tmp2635) + _tmp1066 * (_tmp2637 * _tmp2637) +
+                             _tmp1066 * (_tmp2639 * _tmp2639) + _tmp1066 * (_tmp2641 * _tmp2641) +
+                             _tmp1066 * (_tmp2643 * _tmp2643) + _tmp1066 * (_tmp2644 * _tmp2644) +
+                             _tmp1066 * (_tmp2645 * _tmp2645) + _tmp1066 * (_tmp2646 * _tmp2646) +
+                             _tmp1066 * (_tmp2647 * _tmp2647) + _tmp1066 * (_tmp2648 * _tmp2648) +
+                             _tmp1066 * (_tmp2649 * _tmp2649) + _tmp1066 * (_tmp2650 * _tmp2650) +
+                             _tmp1066 * (_tmp2652 * _tmp2652) + _tmp1066 * (_tmp2656 * _tmp2656) +
+                             _tmp1066 * (_tmp2657 * _tmp2657) + _tmp1066 * (_tmp2658 * _tmp2658) +
+                             (_tmp2615 * _tmp2615) + (_tmp2655 * _tmp2655) + (_tmp2659 * _tmp2659);
     hessian_value_ptr[199] =
         _tmp1066 * _tmp2623 * _tmp2690 + _tmp1066 * _tmp2625 * _tmp2692 +
         _tmp1066 * _tmp2627 * _tmp2691 + _tmp1066 * _tmp2629 * _tmp2693 +
@@ -8048,29 +8022,27 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
         _tmp2643 * _tmp2736 + _tmp2644 * _tmp2734 + _tmp2645 * _tmp2736 + _tmp2646 * _tmp2734 +
         _tmp2647 * _tmp2736 + _tmp2648 * _tmp2736 + _tmp2649 * _tmp2736 + _tmp2650 * _tmp2734 +
         _tmp2652 * _tmp2734 + _tmp2656 * _tmp2736 + _tmp2657 * _tmp2736 + _tmp2658 * _tmp2736;
-    hessian_value_ptr[203] =
-        _tmp1066 * std::pow(_tmp2662, Scalar(2)) + _tmp1066 * std::pow(_tmp2668, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2669, Scalar(2)) + _tmp1066 * std::pow(_tmp2670, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2671, Scalar(2)) + _tmp1066 * std::pow(_tmp2672, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2673, Scalar(2)) + _tmp1066 * std::pow(_tmp2674, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2675, Scalar(2)) + _tmp1066 * std::pow(_tmp2680, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2681, Scalar(2)) + _tmp1066 * std::pow(_tmp2682, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2683, Scalar(2)) + _tmp1066 * std::pow(_tmp2684, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2685, Scalar(2)) + _tmp1066 * std::pow(_tmp2686, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2687, Scalar(2)) + _tmp1066 * std::pow(_tmp2688, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2689, Scalar(2)) + _tmp1066 * std::pow(_tmp2690, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2691, Scalar(2)) + _tmp1066 * std::pow(_tmp2692, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2693, Scalar(2)) + _tmp1066 * std::pow(_tmp2694, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2695, Scalar(2)) + _tmp1066 * std::pow(_tmp2696, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2697, Scalar(2)) + _tmp1066 * std::pow(_tmp2698, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2699, Scalar(2)) + _tmp1066 * std::pow(_tmp2700, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2702, Scalar(2)) + _tmp1066 * std::pow(_tmp2704, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2706, Scalar(2)) + _tmp1066 * std::pow(_tmp2707, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2709, Scalar(2)) + _tmp1066 * std::pow(_tmp2712, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2714, Scalar(2)) + _tmp1066 * std::pow(_tmp2716, Scalar(2)) +
-        _tmp1066 * std::pow(_tmp2717, Scalar(2)) + _tmp1066 * std::pow(_tmp2718, Scalar(2)) +
-        std::pow(_tmp2679, Scalar(2)) + std::pow(_tmp2708, Scalar(2)) +
-        std::pow(_tmp2711, Scalar(2));
+    hessian_value_ptr[203] = _tmp1066 * (_tmp2662 * _tmp2662) + _tmp1066 * (_tmp2668 * _tmp2668) +
+                             _tmp1066 * (_tmp2669 * _tmp2669) + _tmp1066 * (_tmp2670 * _tmp2670) +
+                             _tmp1066 * (_tmp2671 * _tmp2671) + _tmp1066 * (_tmp2672 * _tmp2672) +
+                             _tmp1066 * (_tmp2673 * _tmp2673) + _tmp1066 * (_tmp2674 * _tmp2674) +
+                             _tmp1066 * (_tmp2675 * _tmp2675) + _tmp1066 * (_tmp2680 * _tmp2680) +
+                             _tmp1066 * (_tmp2681 * _tmp2681) + _tmp1066 * (_tmp2682 * _tmp2682) +
+                             _tmp1066 * (_tmp2683 * _tmp2683) + _tmp1066 * (_tmp2684 * _tmp2684) +
+                             _tmp1066 * (_tmp2685 * _tmp2685) + _tmp1066 * (_tmp2686 * _tmp2686) +
+                             _tmp1066 * (_tmp2687 * _tmp2687) + _tmp1066 * (_tmp2688 * _tmp2688) +
+                             _tmp1066 * (_tmp2689 * _tmp2689) + _tmp1066 * (_tmp2690 * _tmp2690) +
+                             _tmp1066 * (_tmp2691 * _tmp2691) + _tmp1066 * (_tmp2692 * _tmp2692) +
+                             _tmp1066 * (_tmp2693 * _tmp2693) + _tmp1066 * (_tmp2694 * _tmp2694) +
+                             _tmp1066 * (_tmp2695 * _tmp2695) + _tmp1066 * (_tmp2696 * _tmp2696) +
+                             _tmp1066 * (_tmp2697 * _tmp2697) + _tmp1066 * (_tmp2698 * _tmp2698) +
+                             _tmp1066 * (_tmp2699 * _tmp2699) + _tmp1066 * (_tmp2700 * _tmp2700) +
+                             _tmp1066 * (_tmp2702 * _tmp2702) + _tmp1066 * (_tmp2704 * _tmp2704) +
+                             _tmp1066 * (_tmp2706 * _tmp2706) + _tmp1066 * (_tmp2707 * _tmp2707) +
+                             _tmp1066 * (_tmp2709 * _tmp2709) + _tmp1066 * (_tmp2712 * _tmp2712) +
+                             _tmp1066 * (_tmp2714 * _tmp2714) + _tmp1066 * (_tmp2716 * _tmp2716) +
+                             _tmp1066 * (_tmp2717 * _tmp2717) + _tmp1066 * (_tmp2718 * _tmp2718) +
+                             (_tmp2679 * _tmp2679) + (_tmp2708 * _tmp2708) + (_tmp2711 * _tmp2711);
     hessian_value_ptr[204] =
         _tmp2484 * _tmp2710 + _tmp2484 * _tmp2719 + _tmp2662 * _tmp2725 + _tmp2668 * _tmp2722 +
         _tmp2669 * _tmp2722 + _tmp2670 * _tmp2722 + _tmp2671 * _tmp2722 + _tmp2672 * _tmp2722 +
@@ -8105,25 +8077,22 @@ void Linearization(const sym::Pose3<Scalar>& world_T_body_0_,
         _tmp2706 * _tmp2734 + _tmp2707 * _tmp2734 + _tmp2709 * _tmp2733 + _tmp2712 * _tmp2734 +
         _tmp2714 * _tmp2734 + _tmp2716 * _tmp2734 + _tmp2717 * _tmp2734 + _tmp2718 * _tmp2733;
     hessian_value_ptr[207] = _tmp1105 * _tmp2851 + _tmp1147 * _tmp2850 + _tmp1185 * _tmp2852 +
-                             std::pow(_tmp2484, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2581, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2724, Scalar(2)) * _tmp2783;
+                             (_tmp2484 * _tmp2484) * _tmp2783 + (_tmp2581 * _tmp2581) * _tmp2783 +
+                             (_tmp2724 * _tmp2724) * _tmp2783;
     hessian_value_ptr[208] = _tmp2271 * _tmp2844 + _tmp2451 * _tmp2729 + _tmp2459 * _tmp2721 +
                              _tmp2484 * _tmp2867 + _tmp2581 * _tmp2869 + _tmp2665 * _tmp2868;
     hessian_value_ptr[209] = _tmp2117 * _tmp2732 + _tmp2361 * _tmp2856 + _tmp2468 * _tmp2844 +
                              _tmp2482 * _tmp2484 * _tmp2783 + _tmp2581 * _tmp2735 * _tmp2783 +
                              _tmp2664 * _tmp2868;
     hessian_value_ptr[210] = _tmp1105 * _tmp2859 + _tmp1147 * _tmp2857 + _tmp1185 * _tmp2858 +
-                             std::pow(_tmp2582, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2665, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2730, Scalar(2)) * _tmp2783;
+                             (_tmp2582 * _tmp2582) * _tmp2783 + (_tmp2665 * _tmp2665) * _tmp2783 +
+                             (_tmp2730 * _tmp2730) * _tmp2783;
     hessian_value_ptr[211] = _tmp2361 * _tmp2729 + _tmp2459 * _tmp2732 + _tmp2468 * _tmp2845 +
                              _tmp2482 * _tmp2867 + _tmp2664 * _tmp2665 * _tmp2783 +
                              _tmp2735 * _tmp2869;
     hessian_value_ptr[212] = _tmp1105 * _tmp2861 + _tmp1147 * _tmp2862 + _tmp1185 * _tmp2860 +
-                             std::pow(_tmp2482, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2664, Scalar(2)) * _tmp2783 +
-                             std::pow(_tmp2735, Scalar(2)) * _tmp2783;
+                             (_tmp2482 * _tmp2482) * _tmp2783 + (_tmp2664 * _tmp2664) * _tmp2783 +
+                             (_tmp2735 * _tmp2735) * _tmp2783;
   }
 }  // NOLINT(readability/fn_size)
 
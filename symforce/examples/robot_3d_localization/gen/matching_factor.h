@@ -39,10 +39,10 @@ void MatchingFactor(const sym::Pose3<Scalar>& world_T_body,
 
   // Intermediate terms (89)
   const Scalar _tmp0 = Scalar(1.0) / (sigma);
-  const Scalar _tmp1 = std::pow(_world_T_body[1], Scalar(2));
+  const Scalar _tmp1 = (_world_T_body[1] * _world_T_body[1]);
   const Scalar _tmp2 = 2 * _tmp1;
   const Scalar _tmp3 = -_tmp2;
-  const Scalar _tmp4 = std::pow(_world_T_body[2], Scalar(2));
+  const Scalar _tmp4 = (_world_T_body[2] * _world_T_body[2]);
   const Scalar _tmp5 = 2 * _tmp4;
   const Scalar _tmp6 = 1 - _tmp5;
   const Scalar _tmp7 = _tmp3 + _tmp6;
@@ -60,7 +60,7 @@ void MatchingFactor(const sym::Pose3<Scalar>& world_T_body,
   const Scalar _tmp19 = _tmp13 * world_t_landmark(2, 0) + _tmp17 * world_t_landmark(1, 0);
   const Scalar _tmp20 = -_tmp14 - _tmp18 + _tmp19 - _tmp7 * _world_T_body[4] +
                         _tmp7 * world_t_landmark(0, 0) - body_t_landmark(0, 0);
-  const Scalar _tmp21 = std::pow(_world_T_body[0], Scalar(2));
+  const Scalar _tmp21 = (_world_T_body[0] * _world_T_body[0]);
   const Scalar _tmp22 = 2 * _tmp21;
   const Scalar _tmp23 = -_tmp22;
   const Scalar _tmp24 = _tmp23 + _tmp6;
@@ -83,7 +83,7 @@ void MatchingFactor(const sym::Pose3<Scalar>& world_T_body,
   const Scalar _tmp40 = _tmp35 * world_t_landmark(0, 0) + _tmp38 * world_t_landmark(1, 0);
   const Scalar _tmp41 = -_tmp34 * _world_T_body[6] + _tmp34 * world_t_landmark(2, 0) - _tmp36 -
                         _tmp39 + _tmp40 - body_t_landmark(2, 0);
-  const Scalar _tmp42 = std::pow(_world_T_body[3], Scalar(2));
+  const Scalar _tmp42 = (_world_T_body[3] * _world_T_body[3]);
   const Scalar _tmp43 = -_tmp1;
   const Scalar _tmp44 = _tmp42 + _tmp43;
   const Scalar _tmp45 = -_tmp21;
@@ -126,7 +126,7 @@ void MatchingFactor(const sym::Pose3<Scalar>& world_T_body,
   const Scalar _tmp73 = _tmp5 + _tmp72;
   const Scalar _tmp74 = _tmp22 + _tmp5 - 1;
   const Scalar _tmp75 = _tmp22 + _tmp72;
-  const Scalar _tmp76 = std::pow(sigma, Scalar(-2));
+  const Scalar _tmp76 = Scalar(1.0) / (sigma * sigma);
   const Scalar _tmp77 = _tmp65 * _tmp76;
   const Scalar _tmp78 = _tmp71 * _tmp76;
   const Scalar _tmp79 = _tmp57 * _tmp76;
@@ -175,45 +175,45 @@ void MatchingFactor(const sym::Pose3<Scalar>& world_T_body,
   if (hessian != nullptr) {
     Eigen::Matrix<Scalar, 6, 6>& _hessian = (*hessian);
 
-    _hessian(0, 0) = std::pow(_tmp48, Scalar(2)) * _tmp76 + std::pow(_tmp55, Scalar(2)) * _tmp76;
+    _hessian(0, 0) = (_tmp48 * _tmp48) * _tmp76 + (_tmp55 * _tmp55) * _tmp76;
     _hessian(1, 0) = _tmp55 * _tmp77;
     _hessian(2, 0) = _tmp48 * _tmp78;
     _hessian(3, 0) = _tmp48 * _tmp52 * _tmp76 + _tmp55 * _tmp79;
     _hessian(4, 0) = _tmp48 * _tmp80 + _tmp55 * _tmp58 * _tmp76;
     _hessian(5, 0) = _tmp48 * _tmp82 + _tmp55 * _tmp81;
     _hessian(0, 1) = 0;
-    _hessian(1, 1) = std::pow(_tmp63, Scalar(2)) * _tmp76 + std::pow(_tmp65, Scalar(2)) * _tmp76;
+    _hessian(1, 1) = (_tmp63 * _tmp63) * _tmp76 + (_tmp65 * _tmp65) * _tmp76;
     _hessian(2, 1) = _tmp63 * _tmp83;
     _hessian(3, 1) = _tmp57 * _tmp77 + _tmp63 * _tmp84;
     _hessian(4, 1) = _tmp58 * _tmp77 + _tmp63 * _tmp69 * _tmp76;
     _hessian(5, 1) = _tmp63 * _tmp85 + _tmp65 * _tmp81;
     _hessian(0, 2) = 0;
     _hessian(1, 2) = 0;
-    _hessian(2, 2) = std::pow(_tmp67, Scalar(2)) * _tmp76 + std::pow(_tmp71, Scalar(2)) * _tmp76;
+    _hessian(2, 2) = (_tmp67 * _tmp67) * _tmp76 + (_tmp71 * _tmp71) * _tmp76;
     _hessian(3, 2) = _tmp52 * _tmp78 + _tmp73 * _tmp83;
     _hessian(4, 2) = _tmp69 * _tmp83 + _tmp74 * _tmp78;
     _hessian(5, 2) = _tmp68 * _tmp83 + _tmp71 * _tmp82;
     _hessian(0, 3) = 0;
     _hessian(1, 3) = 0;
     _hessian(2, 3) = 0;
-    _hessian(3, 3) = std::pow(_tmp52, Scalar(2)) * _tmp76 + std::pow(_tmp57, Scalar(2)) * _tmp76 +
-                     std::pow(_tmp73, Scalar(2)) * _tmp76;
+    _hessian(3, 3) =
+        (_tmp52 * _tmp52) * _tmp76 + (_tmp57 * _tmp57) * _tmp76 + (_tmp73 * _tmp73) * _tmp76;
     _hessian(4, 3) = _tmp52 * _tmp80 + _tmp58 * _tmp79 + _tmp69 * _tmp84;
     _hessian(5, 3) = _tmp52 * _tmp82 + _tmp57 * _tmp81 + _tmp73 * _tmp85;
     _hessian(0, 4) = 0;
     _hessian(1, 4) = 0;
     _hessian(2, 4) = 0;
     _hessian(3, 4) = 0;
-    _hessian(4, 4) = std::pow(_tmp58, Scalar(2)) * _tmp76 + std::pow(_tmp69, Scalar(2)) * _tmp76 +
-                     std::pow(_tmp74, Scalar(2)) * _tmp76;
+    _hessian(4, 4) =
+        (_tmp58 * _tmp58) * _tmp76 + (_tmp69 * _tmp69) * _tmp76 + (_tmp74 * _tmp74) * _tmp76;
     _hessian(5, 4) = _tmp58 * _tmp81 + _tmp69 * _tmp85 + _tmp74 * _tmp82;
     _hessian(0, 5) = 0;
     _hessian(1, 5) = 0;
     _hessian(2, 5) = 0;
     _hessian(3, 5) = 0;
     _hessian(4, 5) = 0;
-    _hessian(5, 5) = std::pow(_tmp50, Scalar(2)) * _tmp76 + std::pow(_tmp68, Scalar(2)) * _tmp76 +
-                     std::pow(_tmp75, Scalar(2)) * _tmp76;
+    _hessian(5, 5) =
+        (_tmp50 * _tmp50) * _tmp76 + (_tmp68 * _tmp68) * _tmp76 + (_tmp75 * _tmp75) * _tmp76;
   }
 
   if (rhs != nullptr) {
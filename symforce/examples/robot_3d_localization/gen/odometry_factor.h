@@ -70,7 +70,7 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp25 = _a_T_b[3] * _tmp19;
   const Scalar _tmp26 = 1 - epsilon;
   const Scalar _tmp27 = std::min<Scalar>(_tmp26, std::fabs(_tmp24 - _tmp25));
-  const Scalar _tmp28 = std::acos(_tmp27) / std::sqrt(Scalar(1 - std::pow(_tmp27, Scalar(2))));
+  const Scalar _tmp28 = std::acos(_tmp27) / std::sqrt(Scalar(1 - (_tmp27 * _tmp27)));
   const Scalar _tmp29 = Scalar(1.0) / (diagonal_sigmas(0, 0));
   const Scalar _tmp30 =
       2 * std::min<Scalar>(0, (((-_tmp24 + _tmp25) > 0) - ((-_tmp24 + _tmp25) < 0))) + 1;
@@ -99,10 +99,10 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp51 = 2 * _world_T_a[0] * _world_T_a[2];
   const Scalar _tmp52 = _tmp50 + _tmp51;
   const Scalar _tmp53 = _tmp52 * _world_T_b[6];
-  const Scalar _tmp54 = std::pow(_world_T_a[2], Scalar(2));
+  const Scalar _tmp54 = (_world_T_a[2] * _world_T_a[2]);
   const Scalar _tmp55 = 2 * _tmp54;
   const Scalar _tmp56 = -_tmp55;
-  const Scalar _tmp57 = std::pow(_world_T_a[1], Scalar(2));
+  const Scalar _tmp57 = (_world_T_a[1] * _world_T_a[1]);
   const Scalar _tmp58 = 2 * _tmp57;
   const Scalar _tmp59 = 1 - _tmp58;
   const Scalar _tmp60 = _tmp56 + _tmp59;
@@ -110,7 +110,7 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp62 =
       _a_T_b[4] - _tmp48 - _tmp53 + _tmp60 * _world_T_a[4] - _tmp60 * _world_T_b[4] + _tmp61;
   const Scalar _tmp63 = Scalar(1.0) / (diagonal_sigmas(4, 0));
-  const Scalar _tmp64 = std::pow(_world_T_a[0], Scalar(2));
+  const Scalar _tmp64 = (_world_T_a[0] * _world_T_a[0]);
   const Scalar _tmp65 = 2 * _tmp64;
   const Scalar _tmp66 = -_tmp65;
   const Scalar _tmp67 = _tmp56 + _tmp66 + 1;
@@ -164,7 +164,7 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp113 = std::fabs(_tmp112);
   const Scalar _tmp114 = std::min<Scalar>(_tmp113, _tmp26);
   const Scalar _tmp115 = std::acos(_tmp114);
-  const Scalar _tmp116 = 1 - std::pow(_tmp114, Scalar(2));
+  const Scalar _tmp116 = 1 - (_tmp114 * _tmp114);
   const Scalar _tmp117 = _tmp30 * ((((-_tmp113 + _tmp26) > 0) - ((-_tmp113 + _tmp26) < 0)) + 1) *
                          (((_tmp112) > 0) - ((_tmp112) < 0));
   const Scalar _tmp118 = _tmp114 * _tmp115 * _tmp117 / (_tmp116 * std::sqrt(_tmp116));
@@ -200,7 +200,7 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp146 = _tmp118 * _tmp145;
   const Scalar _tmp147 =
       _tmp110 * _tmp146 - _tmp121 * _tmp145 + _tmp144 * (_tmp139 - _tmp140 + _tmp143);
-  const Scalar _tmp148 = std::pow(_world_T_a[3], Scalar(2));
+  const Scalar _tmp148 = (_world_T_a[3] * _world_T_a[3]);
   const Scalar _tmp149 = -_tmp64;
   const Scalar _tmp150 = -_tmp57;
   const Scalar _tmp151 = _tmp148 + _tmp149 + _tmp150 + _tmp54;
@@ -312,8 +312,8 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp236 = _tmp235 + _tmp55;
   const Scalar _tmp237 = _tmp55 + _tmp65 - 1;
   const Scalar _tmp238 = _tmp235 + _tmp65;
-  const Scalar _tmp239 = std::pow(diagonal_sigmas(5, 0), Scalar(-2));
-  const Scalar _tmp240 = std::pow(diagonal_sigmas(4, 0), Scalar(-2));
+  const Scalar _tmp239 = Scalar(1.0) / (diagonal_sigmas(5, 0) * diagonal_sigmas(5, 0));
+  const Scalar _tmp240 = Scalar(1.0) / (diagonal_sigmas(4, 0) * diagonal_sigmas(4, 0));
   const Scalar _tmp241 = _tmp189 * _tmp239;
   const Scalar _tmp242 = _tmp211 * _tmp240;
   const Scalar _tmp243 = _tmp240 * _tmp69;
@@ -325,7 +325,7 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
   const Scalar _tmp249 = _tmp182 * _tmp239;
   const Scalar _tmp250 = _tmp183 * _tmp239;
   const Scalar _tmp251 = _tmp156 * _tmp240;
-  const Scalar _tmp252 = std::pow(diagonal_sigmas(3, 0), Scalar(-2));
+  const Scalar _tmp252 = Scalar(1.0) / (diagonal_sigmas(3, 0) * diagonal_sigmas(3, 0));
   const Scalar _tmp253 = _tmp207 * _tmp252;
   const Scalar _tmp254 = _tmp186 * _tmp252;
   const Scalar _tmp255 = _tmp252 * _tmp47;
@@ -431,9 +431,8 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
 
     _hessian.setZero();
 
-    _hessian(0, 0) = std::pow(_tmp129, Scalar(2)) + std::pow(_tmp138, Scalar(2)) +
-                     std::pow(_tmp147, Scalar(2)) + std::pow(_tmp152, Scalar(2)) * _tmp240 +
-                     std::pow(_tmp161, Scalar(2)) * _tmp239;
+    _hessian(0, 0) = (_tmp129 * _tmp129) + (_tmp138 * _tmp138) + (_tmp147 * _tmp147) +
+                     (_tmp152 * _tmp152) * _tmp240 + (_tmp161 * _tmp161) * _tmp239;
     _hessian(1, 0) = _tmp129 * _tmp172 + _tmp138 * _tmp176 + _tmp147 * _tmp180 + _tmp161 * _tmp241;
     _hessian(2, 0) = _tmp129 * _tmp196 + _tmp138 * _tmp200 + _tmp147 * _tmp204 + _tmp152 * _tmp242;
     _hessian(3, 0) = _tmp152 * _tmp243 + _tmp161 * _tmp244;
@@ -445,9 +444,8 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
     _hessian(9, 0) = _tmp152 * _tmp248 + _tmp161 * _tmp249;
     _hessian(10, 0) = _tmp161 * _tmp250 + _tmp237 * _tmp245;
     _hessian(11, 0) = _tmp152 * _tmp251 + _tmp238 * _tmp247;
-    _hessian(1, 1) = std::pow(_tmp172, Scalar(2)) + std::pow(_tmp176, Scalar(2)) +
-                     std::pow(_tmp180, Scalar(2)) + std::pow(_tmp186, Scalar(2)) * _tmp252 +
-                     std::pow(_tmp189, Scalar(2)) * _tmp239;
+    _hessian(1, 1) = (_tmp172 * _tmp172) + (_tmp176 * _tmp176) + (_tmp180 * _tmp180) +
+                     (_tmp186 * _tmp186) * _tmp252 + (_tmp189 * _tmp189) * _tmp239;
     _hessian(2, 1) = _tmp172 * _tmp196 + _tmp176 * _tmp200 + _tmp180 * _tmp204 + _tmp186 * _tmp253;
     _hessian(3, 1) = _tmp189 * _tmp244 + _tmp254 * _tmp60;
     _hessian(4, 1) = _tmp186 * _tmp255 + _tmp189 * _tmp246;
@@ -458,9 +456,8 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
     _hessian(9, 1) = _tmp189 * _tmp249 + _tmp236 * _tmp254;
     _hessian(10, 1) = _tmp186 * _tmp257 + _tmp189 * _tmp250;
     _hessian(11, 1) = _tmp209 * _tmp254 + _tmp238 * _tmp241;
-    _hessian(2, 2) = std::pow(_tmp196, Scalar(2)) + std::pow(_tmp200, Scalar(2)) +
-                     std::pow(_tmp204, Scalar(2)) + std::pow(_tmp207, Scalar(2)) * _tmp252 +
-                     std::pow(_tmp211, Scalar(2)) * _tmp240;
+    _hessian(2, 2) = (_tmp196 * _tmp196) + (_tmp200 * _tmp200) + (_tmp204 * _tmp204) +
+                     (_tmp207 * _tmp207) * _tmp252 + (_tmp211 * _tmp211) * _tmp240;
     _hessian(3, 2) = _tmp242 * _tmp69 + _tmp253 * _tmp60;
     _hessian(4, 2) = _tmp242 * _tmp67 + _tmp253 * _tmp47;
     _hessian(5, 2) = _tmp242 * _tmp72 + _tmp253 * _tmp52;
@@ -470,45 +467,39 @@ void OdometryFactor(const sym::Pose3<Scalar>& world_T_a, const sym::Pose3<Scalar
     _hessian(9, 2) = _tmp154 * _tmp242 + _tmp236 * _tmp253;
     _hessian(10, 2) = _tmp208 * _tmp253 + _tmp237 * _tmp242;
     _hessian(11, 2) = _tmp156 * _tmp242 + _tmp209 * _tmp253;
-    _hessian(3, 3) = _tmp239 * std::pow(_tmp79, Scalar(2)) + _tmp240 * std::pow(_tmp69, Scalar(2)) +
-                     _tmp252 * std::pow(_tmp60, Scalar(2));
+    _hessian(3, 3) =
+        _tmp239 * (_tmp79 * _tmp79) + _tmp240 * (_tmp69 * _tmp69) + _tmp252 * (_tmp60 * _tmp60);
     _hessian(4, 3) = _tmp243 * _tmp67 + _tmp244 * _tmp81 + _tmp255 * _tmp60;
     _hessian(5, 3) = _tmp243 * _tmp72 + _tmp244 * _tmp78 + _tmp256 * _tmp60;
     _hessian(9, 3) = _tmp248 * _tmp69 + _tmp249 * _tmp79 + _tmp258 * _tmp60;
     _hessian(10, 3) = _tmp183 * _tmp244 + _tmp237 * _tmp243 + _tmp257 * _tmp60;
     _hessian(11, 3) = _tmp156 * _tmp243 + _tmp209 * _tmp252 * _tmp60 + _tmp238 * _tmp244;
-    _hessian(4, 4) = _tmp239 * std::pow(_tmp81, Scalar(2)) + _tmp240 * std::pow(_tmp67, Scalar(2)) +
-                     _tmp252 * std::pow(_tmp47, Scalar(2));
+    _hessian(4, 4) =
+        _tmp239 * (_tmp81 * _tmp81) + _tmp240 * (_tmp67 * _tmp67) + _tmp252 * (_tmp47 * _tmp47);
     _hessian(5, 4) = _tmp240 * _tmp67 * _tmp72 + _tmp246 * _tmp78 + _tmp256 * _tmp47;
     _hessian(9, 4) = _tmp236 * _tmp255 + _tmp248 * _tmp67 + _tmp249 * _tmp81;
     _hessian(10, 4) = _tmp183 * _tmp246 + _tmp257 * _tmp47 + _tmp259 * _tmp67;
     _hessian(11, 4) = _tmp209 * _tmp255 + _tmp238 * _tmp246 + _tmp251 * _tmp67;
-    _hessian(5, 5) = _tmp239 * std::pow(_tmp78, Scalar(2)) + _tmp240 * std::pow(_tmp72, Scalar(2)) +
-                     _tmp252 * std::pow(_tmp52, Scalar(2));
+    _hessian(5, 5) =
+        _tmp239 * (_tmp78 * _tmp78) + _tmp240 * (_tmp72 * _tmp72) + _tmp252 * (_tmp52 * _tmp52);
     _hessian(9, 5) = _tmp236 * _tmp256 + _tmp248 * _tmp72 + _tmp249 * _tmp78;
     _hessian(10, 5) = _tmp250 * _tmp78 + _tmp257 * _tmp52 + _tmp259 * _tmp72;
     _hessian(11, 5) = _tmp209 * _tmp256 + _tmp238 * _tmp239 * _tmp78 + _tmp251 * _tmp72;
-    _hessian(6, 6) =
-        std::pow(_tmp219, Scalar(2)) + std::pow(_tmp223, Scalar(2)) + std::pow(_tmp225, Scalar(2));
+    _hessian(6, 6) = (_tmp219 * _tmp219) + (_tmp223 * _tmp223) + (_tmp225 * _tmp225);
     _hessian(7, 6) = _tmp219 * _tmp227 + _tmp223 * _tmp228 + _tmp225 * _tmp229;
     _hessian(8, 6) = _tmp219 * _tmp232 + _tmp223 * _tmp233 + _tmp225 * _tmp234;
-    _hessian(7, 7) =
-        std::pow(_tmp227, Scalar(2)) + std::pow(_tmp228, Scalar(2)) + std::pow(_tmp229, Scalar(2));
+    _hessian(7, 7) = (_tmp227 * _tmp227) + (_tmp228 * _tmp228) + (_tmp229 * _tmp229);
     _hessian(8, 7) = _tmp227 * _tmp232 + _tmp228 * _tmp233 + _tmp229 * _tmp234;
-    _hessian(8, 8) =
-        std::pow(_tmp232, Scalar(2)) + std::pow(_tmp233, Scalar(2)) + std::pow(_tmp234, Scalar(2));
-    _hessian(9, 9) = std::pow(_tmp154, Scalar(2)) * _tmp240 +
-                     std::pow(_tmp182, Scalar(2)) * _tmp239 +
-                     std::pow(_tmp236, Scalar(2)) * _tmp252;
+    _hessian(8, 8) = (_tmp232 * _tmp232) + (_tmp233 * _tmp233) + (_tmp234 * _tmp234);
+    _hessian(9, 9) = (_tmp154 * _tmp154) * _tmp240 + (_tmp182 * _tmp182) * _tmp239 +
+                     (_tmp236 * _tmp236) * _tmp252;
     _hessian(10, 9) = _tmp183 * _tmp249 + _tmp236 * _tmp257 + _tmp237 * _tmp248;
     _hessian(11, 9) = _tmp156 * _tmp248 + _tmp209 * _tmp258 + _tmp238 * _tmp249;
-    _hessian(10, 10) = std::pow(_tmp183, Scalar(2)) * _tmp239 +
-                       std::pow(_tmp208, Scalar(2)) * _tmp252 +
-                       std::pow(_tmp237, Scalar(2)) * _tmp240;
+    _hessian(10, 10) = (_tmp183 * _tmp183) * _tmp239 + (_tmp208 * _tmp208) * _tmp252 +
+                       (_tmp237 * _tmp237) * _tmp240;
     _hessian(11, 10) = _tmp209 * _tmp257 + _tmp237 * _tmp251 + _tmp238 * _tmp250;
-    _hessian(11, 11) = std::pow(_tmp156, Scalar(2)) * _tmp240 +
-                       std::pow(_tmp209, Scalar(2)) * _tmp252 +
-                       std::pow(_tmp238, Scalar(2)) * _tmp239;
+    _hessian(11, 11) = (_tmp156 * _tmp156) * _tmp240 + (_tmp209 * _tmp209) * _tmp252 +
+                       (_tmp238 * _tmp238) * _tmp239;
   }
 
   if (rhs != nullptr) {
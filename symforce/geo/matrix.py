@@ -474,8 +474,13 @@ class Matrix(Storage):
             return jacobian_helpers.tangent_jacobians(self, [X])[0]
         else:
             # Compute jacobian wrt X storage
+            X_storage = ops.StorageOps.to_storage(X)
+            if X_storage and all(isinstance(xi, sf.Symbol) for xi in X_storage):
+                # Differentiates wrt all of X at once, which with symengine shares the derivatives
+                # of common subexpressions between the entries
+                return Matrix(self.mat.jacobian(sf.sympy.Matrix(X_storage)))
             return Matrix(
-                [[vi.diff(xi) for xi in ops.StorageOps.to_storage(X)] for vi in iter(self.mat)]  # type: ignore[call-overload]  # fixed by python/typeshed#7817
+                [[vi.diff(xi) for xi in X_storage] for vi in iter(self.mat)]  # type: ignore[call-overload]  # fixed by python/typeshed#7817
             )
 
     def diff(self, *args: _T.Scalar) -> Matrix:
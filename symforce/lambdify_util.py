@@ -0,0 +1,124 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+"""
+Numerical evaluation of symbolic expressions at many points at once, without generating code
+"""
+
+import numpy as np
+
+import symforce
+import symforce.symbolic as sf
+from symforce import typing as T
+from symforce.ops import StorageOps
+
+
+def _storage_from_array(element: T.Any, array: np.ndarray, num_points: int) -> np.ndarray:
+    """
+    Convert the values of element at each of num_points points to an array of shape
+    (num_points, storage_dim)
+    """
+    array = np.asarray(array, dtype=np.float64)
+    if isinstance(element, sf.Matrix) and array.ndim == 3:
+        # Matrix storage is column major
+        array = array.transpose(0, 2, 1)
+    return array.reshape(num_points, -1)
+
+
+def _array_from_storage(element: T.Any, storage: np.ndarray) -> np.ndarray:
+    """
+    Inverse of _storage_from_array: scalars are of shape (N,), column vectors (N, rows), other
+    matrices (N, rows, cols), and all other types (N, storage_dim)
+    """
+    num_points = storage.shape[0]
+    if isinstance(element, sf.Matrix):
+        rows, cols = element.shape
+        if cols == 1:
+            return storage
+        return storage.reshape(num_points, cols, rows).transpose(0, 2, 1)
+    elif StorageOps.storage_dim(element) == 1:
+        return storage.reshape(num_points)
+    return storage
+
+
+def batch_lambdify(
+    inputs: T.Sequence[T.Any], outputs: T.Sequence[T.Any], cse: bool = True
+) -> T.Callable[..., T.List[np.ndarray]]:
+    """
+    Create a function that evaluates outputs at many values of the inputs in one call.
+
+    With the symengine symbolic API, the outputs are compiled into a list of instructions, each of
+    which is run as a loop over a block of points.  This is much faster than calling a lambdified
+    function per point, and unlike codegen requires no compilation.  With the sympy API this uses
+    sympy.lambdify with numpy.
+
+    Example:
+
+        >>> x = sf.Symbol("x")
+        >>> R = sf.Rot3.symbolic("R")
+        >>> f = batch_lambdify([R, x], [R * sf.V3(x, 0, 0)])
+        >>> f(np.tile([0, 0, 0, 1], (1000, 1)), np.linspace(0, 1, 1000))[0].shape
+        (1000, 3)
+
+    Args:
+        inputs: Storable objects whose storage contains only symbols, e.g. Symbols, Matrices or
+            geo types
+        outputs: Storable objects which are functions of the inputs
+        cse: Whether to eliminate common subexpressions first, which is usually faster
+
+    Returns:
+        A function taking one array per input, of shape (N,) for scalars, (N, rows) or
+        (N, rows, cols) for matrices, and (N, storage_dim) for other types, and returning a list of
+        one array per output in the same format
+    """
+    flat_inputs = [s for element in inputs for s in StorageOps.to_storage(element)]
+    for s in flat_inputs:
+        if not isinstance(s, sf.Symbol):
+            raise ValueError(f"Inputs must be made of symbols, got {s}")
+    flat_outputs = [sf.S(s) for element in outputs for s in StorageOps.to_storage(element)]
+    output_sizes = [StorageOps.storage_dim(element) for element in outputs]
+    output_offsets = np.cumsum([0] + output_sizes)
+
+    if symforce.get_symbolic_api() == "symengine":
+        lambdified = sf.sympy.Lambdify(flat_inputs, flat_outputs, backend="batch", cse=cse)
+
+        def evaluate_flat(storage: np.ndarray) -> np.ndarray:
+            return lambdified(storage).reshape(storage.shape[0], len(flat_outputs))
+
+    else:
+        lambdified = sf.sympy.lambdify(flat_inputs, flat_outputs, modules="numpy", cse=cse)
+
+        def evaluate_flat(storage: np.ndarray) -> np.ndarray:
+            # Constant outputs are returned as scalars
+            values = lambdified(*storage.T)
+            return np.stack(
+                [
+                    np.broadcast_to(np.asarray(v, dtype=np.float64), storage.shape[:1])
+                    for v in values
+                ],
+                axis=1,
+            )
+
+    def evaluate(*args: np.ndarray) -> T.List[np.ndarray]:
+        if len(args) != len(inputs):
+            raise ValueError(f"Expected {len(inputs)} inputs, got {len(args)}")
+        num_points = np.shape(args[0])[0] if args else 1
+        if flat_inputs:
+            storage = np.concatenate(
+                [
+                    _storage_from_array(element, array, num_points)
+                    for element, array in zip(inputs, args)
+                ],
+                axis=1,
+            )
+        else:
+            storage = np.zeros((num_points, 0))
+        values = np.ascontiguousarray(evaluate_flat(storage))
+        return [
+            _array_from_storage(element, values[:, output_offsets[i] : output_offsets[i + 1]])
+            for i, element in enumerate(outputs)
+        ]
+
+    return evaluate
@@ -173,6 +173,10 @@ class Factor {
    * returns the residual, then calling with_linearization with
    * linearization_mode=FULL_LINEARIZATION (the default)
    *
+   * Only the lower triangle of the hessian computed by `func` is used, so `func` does not need to
+   * fill in the upper triangle (e.g. if generated with lower_triangular_hessian=True).  The upper
+   * triangle of the hessian in the resulting linearized factors is unspecified.
+   *
    * See `symforce_factor_test.cc` for many examples.
    *
    * Args:
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <vector>
+
+#include <lcmtypes/sym/index_entry_t.hpp>
+
+#include "./factor.h"
+#include "./internal/factor_utils.h"
+#include "./templates.h"
+#include "./values.h"
+
+namespace sym {
+
+/**
+ * A statically-typed residual term for optimization, for functors with fixed-size outputs.
+ *
+ * Accepts the same functors as Factor::Hessian (typically generated with
+ * Codegen.with_linearization), but instead of erasing the functor into a std::function that
+ * operates on dynamically sized matrices, it stores the functor by value and keeps the fixed-size
+ * residual, jacobian, hessian, and rhs types from its signature.  Fixed-size Eigen inputs are
+ * referenced in place in the Values storage at the cached index entries where their alignment
+ * allows (see internal::StorageArg), and outputs are written in place.  This lets the compiler
+ * inline the whole evaluation, and avoids the indirect call through the std::function that Factor
+ * pays on every linearization.
+ *
+ * The Linearizer and Optimizer only operate on Factors, so a FixedFactor added to a problem with
+ * ToFactor() is evaluated through the std::function like any other Factor, and only direct callers
+ * of Linearize get the statically typed call.  Factor::Hessian shares the in-place inputs and
+ * outputs, except that it copies the lower triangle of the hessian out of a temporary.
+ */
+template <typename ScalarType, typename Functor>
+class FixedFactor {
+ public:
+  using Scalar = ScalarType;
+  using LinearizedDenseFactor = typename Factor<Scalar>::LinearizedDenseFactor;
+
+  using ResidualVec = typename internal::HessianFuncTypeHelper<Functor>::ResidualVec;
+  using JacobianMat = typename internal::HessianFuncTypeHelper<Functor>::JacobianMat;
+  using HessianMat = typename internal::HessianFuncTypeHelper<Functor>::HessianMat;
+  using RhsVec = typename internal::HessianFuncTypeHelper<Functor>::RhsVec;
+
+  static constexpr int kNumInputs = function_traits<Functor>::num_arguments - 4;
+
+  // Dimensions of the residual (M) and of the optimized tangent space (N)
+  static constexpr int M = ResidualVec::RowsAtCompileTime;
+  static constexpr int N = RhsVec::RowsAtCompileTime;
+
+  static_assert(kIsEigenType<ResidualVec> && kIsEigenType<JacobianMat> &&
+                    kIsEigenType<HessianMat> && kIsEigenType<RhsVec>,
+                "FixedFactor only supports dense Eigen outputs; use Factor for sparse functors");
+  static_assert(M != Eigen::Dynamic && N != Eigen::Dynamic,
+                "FixedFactor only supports fixed-size outputs; use Factor for dynamic functors");
+  static_assert(JacobianMat::RowsAtCompileTime == M && JacobianMat::ColsAtCompileTime == N,
+                "Inconsistent sizes.");
+  static_assert(HessianMat::RowsAtCompileTime == N && HessianMat::ColsAtCompileTime == N,
+                "Inconsistent sizes.");
+
+  /**
+   * Create from a functor that computes the full linearization.  The last four arguments to
+   * `func` should be outputs for the residual, jacobian, hessian, and rhs; arguments before that
+   * should be inputs to `func`.
+   *
+   * Args:
+   *   keys_to_func: The set of input arguments, in order, accepted by func.
+   *   keys_to_optimize: The set of input arguments that correspond to the derivative in func. Must
+   *                     be a subset of keys_to_func. If empty, then all keys_to_func are optimized.
+   */
+  FixedFactor(Functor func, const std::vector<Key>& keys_to_func,
+              const std::vector<Key>& keys_to_optimize = {});
+
+  /**
+   * Evaluate the factor at the given linearization point into fixed-size outputs.  Any of the
+   * outputs may be nullptr, in which case they are not requested from the functor.  Only the lower
+   * triangle of the hessian is guaranteed to be written.
+   *
+   * Args:
+   *     maybe_index_entry_cache: Optional.  If provided, should be the index entries for each of
+   *         the inputs to the factor in the given Values.  For repeated linearization, caching this
+   *         prevents repeated hash lookups.  Can be computed as
+   *         `values.CreateIndex(factor.AllKeys()).entries`.
+   */
+  void Linearize(const Values<Scalar>& values, ResidualVec* residual,
+                 JacobianMat* jacobian = nullptr, HessianMat* hessian = nullptr,
+                 RhsVec* rhs = nullptr,
+                 const std::vector<index_entry_t>* maybe_index_entry_cache = nullptr) const;
+
+  /**
+   * Evaluate the factor at the given linearization point and output a LinearizedDenseFactor that
+   * contains the numerical values of the residual, jacobian, hessian, and right-hand-side.  These
+   * are written in place, so only the lower triangle of the hessian is meaningful, unlike
+   * Factor::Linearize which leaves the upper triangle as it was.
+   *
+   * Args:
+   *     maybe_index_entry_cache: Optional.  If provided, should be the index entries for each of
+   *         the inputs to the factor in the given Values.
+   */
+  void Linearize(const Values<Scalar>& values, LinearizedDenseFactor& linearized_factor,
+                 const std::vector<index_entry_t>* maybe_index_entry_cache = nullptr) const;
+
+  /**
+   * Create a type-erased Factor evaluating the same functor, e.g. to pass to an Optimizer
+   */
+  Factor<Scalar> ToFactor() const;
+
+  /**
+   * Get the optimized keys for this factor
+   */
+  const std::vector<Key>& OptimizedKeys() const;
+
+  /**
+   * Get all keys required to evaluate this factor
+   */
+  const std::vector<Key>& AllKeys() const;
+
+ private:
+  template <int... S>
+  void InvokeAtRange(const Values<Scalar>& values, const std::vector<index_entry_t>& entries,
+                     ResidualVec* residual, JacobianMat* jacobian, HessianMat* hessian,
+                     RhsVec* rhs, Sequence<S...>) const;
+
+  Functor func_;
+
+  // Keys to be optimized in this factor, which must match the column order of the jacobian.
+  std::vector<Key> keys_to_optimize_;
+
+  // All keys required to evaluate the factor
+  std::vector<Key> keys_;
+};
+
+/**
+ * Helper to create a FixedFactor with the functor type deduced, for example:
+ *
+ *     const auto factor = sym::MakeFixedFactor<double>(sym::BetweenFactorPose3<double>,
+ *                                                      {'a', 'b', 'c', 's', 'e'}, {'a', 'b'});
+ */
+template <typename Scalar, typename Functor>
+FixedFactor<Scalar, std::decay_t<Functor>> MakeFixedFactor(
+    Functor&& func, const std::vector<Key>& keys_to_func,
+    const std::vector<Key>& keys_to_optimize = {}) {
+  return FixedFactor<Scalar, std::decay_t<Functor>>(std::forward<Functor>(func), keys_to_func,
+                                                    keys_to_optimize);
+}
+
+}  // namespace sym
+
+// Template method implementations
+#include "./fixed_factor.tcc"
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include "./assert.h"
+#include "./fixed_factor.h"
+
+namespace sym {
+
+template <typename Scalar, typename Functor>
+FixedFactor<Scalar, Functor>::FixedFactor(Functor func, const std::vector<Key>& keys_to_func,
+                                          const std::vector<Key>& keys_to_optimize)
+    : func_(std::move(func)),
+      keys_to_optimize_(keys_to_optimize.empty() ? keys_to_func : keys_to_optimize),
+      keys_(keys_to_func) {
+  SYM_ASSERT(keys_to_func.size() >= keys_to_optimize.size());
+  SYM_ASSERT(static_cast<int>(keys_to_func.size()) == kNumInputs);
+}
+
+template <typename Scalar, typename Functor>
+template <int... S>
+void FixedFactor<Scalar, Functor>::InvokeAtRange(const Values<Scalar>& values,
+                                                 const std::vector<index_entry_t>& entries,
+                                                 ResidualVec* residual, JacobianMat* jacobian,
+                                                 HessianMat* hessian, RhsVec* rhs,
+                                                 Sequence<S...>) const {
+  using TypeHelper = internal::HessianFuncTypeHelper<Functor>;
+  const Scalar* const data = values.Data().data();
+  func_(internal::StorageArg<typename TypeHelper::template ArgType<S>, Scalar>(data, entries[S])
+            .Get()...,
+        residual, jacobian, hessian, rhs);
+}
+
+template <typename Scalar, typename Functor>
+void FixedFactor<Scalar, Functor>::Linearize(
+    const Values<Scalar>& values, ResidualVec* const residual, JacobianMat* const jacobian,
+    HessianMat* const hessian, RhsVec* const rhs,
+    const std::vector<index_entry_t>* const maybe_index_entry_cache) const {
+  // Only create an index if none was given.  A conditional expression here would copy the given
+  // entries into a temporary on every call
+  std::vector<index_entry_t> created_index_entries;
+  const std::vector<index_entry_t>* index_entry_cache = maybe_index_entry_cache;
+  if (index_entry_cache == nullptr) {
+    created_index_entries = values.CreateIndex(AllKeys()).entries;
+    index_entry_cache = &created_index_entries;
+  }
+  SYM_ASSERT(static_cast<int>(index_entry_cache->size()) == kNumInputs);
+
+  InvokeAtRange(values, *index_entry_cache, residual, jacobian, hessian, rhs,
+                typename RangeGenerator<kNumInputs>::Range());
+}
+
+template <typename Scalar, typename Functor>
+void FixedFactor<Scalar, Functor>::Linearize(
+    const Values<Scalar>& values, LinearizedDenseFactor& linearized_factor,
+    const std::vector<index_entry_t>* const maybe_index_entry_cache) const {
+  // The outputs are written in place, and are not reallocated if linearized_factor already has the
+  // right sizes
+  Linearize(values, internal::FixedSizeOutput<ResidualVec>(&linearized_factor.residual),
+            internal::FixedSizeOutput<JacobianMat>(&linearized_factor.jacobian),
+            internal::FixedSizeOutput<HessianMat>(&linearized_factor.hessian),
+            internal::FixedSizeOutput<RhsVec>(&linearized_factor.rhs), maybe_index_entry_cache);
+}
+
+template <typename Scalar, typename Functor>
+Factor<Scalar> FixedFactor<Scalar, Functor>::ToFactor() const {
+  // Pass a copy, so that the Functor type is deduced without the const reference
+  return Factor<Scalar>::Hessian(Functor(func_), keys_, keys_to_optimize_);
+}
+
+template <typename Scalar, typename Functor>
+const std::vector<Key>& FixedFactor<Scalar, Functor>::OptimizedKeys() const {
+  return keys_to_optimize_;
+}
+
+template <typename Scalar, typename Functor>
+const std::vector<Key>& FixedFactor<Scalar, Functor>::AllKeys() const {
+  return keys_;
+}
+
+}  // namespace sym
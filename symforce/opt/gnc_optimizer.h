@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include <functional>
+
 #include <lcmtypes/sym/optimizer_gnc_params_t.hpp>
 
 #include "./optimizer.h"
+#include "./robust_loss.h"
 
 namespace sym {
 
@@ -17,6 +20,12 @@ namespace sym {
  * Assumes the convexity of the cost function is controlled by a hyperparameter mu. When mu == 0 the
  * cost function should be convex and as mu goes to 1 the cost function should smoothly transition
  * to a robust cost.
+ *
+ * Mu is either an input to the factors, in which case the factors are generated with the robust
+ * cost and mu is set in the Values at gnc_mu_key, or it sets the parameters of the RobustLoss of
+ * each factor applied by the Linearizer (see Linearizer::SetRobustLosses).  In the latter case the
+ * factors don't depend on mu, so at each step of mu the linearization of the best values is
+ * reweighted with Linearizer::Reweight instead of evaluating the factors again.
  */
 template <typename BaseOptimizerType>
 class GncOptimizer : public BaseOptimizerType {
@@ -24,8 +33,12 @@ class GncOptimizer : public BaseOptimizerType {
   using BaseOptimizer = BaseOptimizerType;
   using Scalar = typename BaseOptimizer::Scalar;
 
+  // Function that sets the parameters of the robust loss of a factor for the given value of mu
+  using RobustLossScheduleFunc = std::function<void(Scalar mu, RobustLoss<Scalar>& loss)>;
+
   /**
-   * Constructor that copies in factors and keys
+   * Constructor that copies in factors and keys, for factors that take mu as an input at
+   * gnc_mu_key
    */
   template <typename... OptimizerArgs>
   GncOptimizer(const optimizer_params_t& optimizer_params, const optimizer_gnc_params_t& gnc_params,
@@ -34,6 +47,18 @@ class GncOptimizer : public BaseOptimizerType {
         gnc_params_(gnc_params),
         gnc_mu_key_(gnc_mu_key) {}
 
+  /**
+   * Constructor that copies in factors and keys, for GNC with the robust losses of the Linearizer.
+   * The losses must be set with Linearizer().SetRobustLosses before optimizing, and
+   * robust_loss_schedule is called on each of them whenever mu changes.
+   */
+  template <typename... OptimizerArgs>
+  GncOptimizer(const optimizer_params_t& optimizer_params, const optimizer_gnc_params_t& gnc_params,
+               const RobustLossScheduleFunc& robust_loss_schedule, OptimizerArgs&&... args)
+      : BaseOptimizer(optimizer_params, std::forward<OptimizerArgs>(args)...),
+        gnc_params_(gnc_params),
+        robust_loss_schedule_(robust_loss_schedule) {}
+
   virtual ~GncOptimizer() = default;
 
   /**
@@ -58,10 +83,8 @@ class GncOptimizer : public BaseOptimizerType {
     bool updating_gnc = (gnc_params_.mu_initial < gnc_params_.mu_max);
 
     // Initialize the value of mu
-    values.template Set<Scalar>(gnc_mu_key_, gnc_params_.mu_initial);
-
-    // Cache the index entry for mu
-    const auto mu_index = values.Items().at(gnc_mu_key_);
+    Scalar mu = gnc_params_.mu_initial;
+    SetMu(values, mu);
 
     optimizer_params_t optimizer_params = this->nonlinear_solver_.Params();
     const double early_exit_min_reduction = optimizer_params.early_exit_min_reduction;
@@ -83,19 +106,21 @@ class GncOptimizer : public BaseOptimizerType {
       }
 
       // Update the GNC parameter.
-      values.Set(gnc_mu_key_, values.template At<Scalar>(mu_index) + gnc_params_.mu_step);
+      mu += gnc_params_.mu_step;
 
       // Check if we hit the non-convexity threshold.
-      if (values.template At<Scalar>(mu_index) >= gnc_params_.mu_max) {
-        values.template Set<Scalar>(mu_index, gnc_params_.mu_max);
+      if (mu >= gnc_params_.mu_max) {
+        mu = gnc_params_.mu_max;
         // Reset early exit threshold.
         optimizer_params.early_exit_min_reduction = early_exit_min_reduction;
         this->UpdateParams(optimizer_params);
         updating_gnc = false;
       }
 
+      SetMu(values, mu);
+
       if (optimizer_params.verbose) {
-        spdlog::info("Set GNC param to: {}", values.template At<Scalar>(mu_index));
+        spdlog::info("Set GNC param to: {}", mu);
       }
 
       // NOTE(aaron): This might populate the best linearization multiple times
@@ -115,14 +140,40 @@ class GncOptimizer : public BaseOptimizerType {
     SYM_ASSERT(num_iterations >= 0);
     SYM_ASSERT(this->IsInitialized());
 
-    // Reset values, but do not clear other state
-    this->nonlinear_solver_.ResetState(values);
+    // Reset values, but do not clear other state.  If mu only changes the robust losses and the
+    // Linearizer still holds the linearized factors at the best values, which are the values here,
+    // reweight their linearization instead of evaluating the factors again.
+    if (robust_loss_schedule_ && this->nonlinear_solver_.BestIsLastLinearization()) {
+      const auto& linearizer = this->Linearizer();
+      this->nonlinear_solver_.ResetStateToBest(
+          [&linearizer](Linearization<Scalar>& linearization) {
+            linearizer.Reweight(linearization);
+          });
+    } else {
+      this->nonlinear_solver_.ResetState(values);
+    }
 
     this->IterateToConvergence(values, num_iterations, populate_best_linearization, stats);
   }
 
+  void SetMu(Values<Scalar>& values, const Scalar mu) {
+    if (!robust_loss_schedule_) {
+      values.template Set<Scalar>(gnc_mu_key_, mu);
+      return;
+    }
+
+    auto& linearizer = this->Linearizer();
+    SYM_ASSERT(linearizer.RobustLosses().size() == this->Factors().size());
+    for (int i = 0; i < static_cast<int>(linearizer.RobustLosses().size()); i++) {
+      RobustLoss<Scalar> loss = linearizer.RobustLosses()[i];
+      robust_loss_schedule_(mu, loss);
+      linearizer.SetRobustLoss(i, loss);
+    }
+  }
+
   optimizer_gnc_params_t gnc_params_;
-  Key gnc_mu_key_;
+  Key gnc_mu_key_{};
+  RobustLossScheduleFunc robust_loss_schedule_{};
 };
 
 }  // namespace sym
@@ -12,11 +12,159 @@
  * Primarily intended to be included by factor.tcc and used internally there
  */
 
+#include <cstdint>
+#include <type_traits>
+
+#include <Eigen/Dense>
+
 #include "../factor.h"
 
 namespace sym {
 namespace internal {
 
+/**
+ * Read the value of type T for the given index entry directly out of a Values data buffer.
+ *
+ * Equivalent to Values::At(entry), but takes the raw data pointer so that callers evaluating many
+ * arguments can fetch it once.
+ */
+template <typename T, typename Scalar>
+inline T FromStorageAt(const Scalar* const data, const index_entry_t& entry) {
+  SYM_ASSERT(entry.type == StorageOps<T>::TypeEnum());
+  return StorageOps<T>::FromStorage(data + entry.offset);
+}
+
+/**
+ * Whether T is a fixed-size Eigen matrix of Scalar, i.e. one of the types handled by the StorageOps
+ * specialization for Eigen matrices whose storage is its memory layout (column-major, no padding).
+ */
+template <typename T, typename Scalar>
+struct IsFixedSizeMatrixOf : std::false_type {};
+
+template <typename Scalar, int Rows, int Cols>
+struct IsFixedSizeMatrixOf<Eigen::Matrix<Scalar, Rows, Cols>, Scalar>
+    : std::integral_constant<bool, Rows != Eigen::Dynamic && Cols != Eigen::Dynamic> {};
+
+/**
+ * A functor argument of type T read from a Values data buffer, for passing to functors that take
+ * the argument by const reference.
+ *
+ * The generic version constructs a copy with StorageOps<T>::FromStorage.  It is specialized below
+ * so that fixed-size Eigen matrices are instead referenced directly in the buffer, which avoids
+ * copying e.g. measurements and square root information matrices on every factor evaluation.
+ *
+ * Intended to be constructed as a temporary in the argument list of the call, so that the
+ * reference returned by Get() lives until the functor returns.
+ */
+template <typename T, typename Scalar, typename Enable = void>
+class StorageArg {
+ public:
+  StorageArg(const Scalar* const data, const index_entry_t& entry)
+      : value_(FromStorageAt<T>(data, entry)) {}
+
+  StorageArg(const StorageArg&) = delete;
+  StorageArg& operator=(const StorageArg&) = delete;
+
+  const T& Get() const {
+    return value_;
+  }
+
+ private:
+  T value_;
+};
+
+/**
+ * Eigen matrices whose alignment requirement is no stricter than Scalar (e.g. Vector3d, Matrix33d)
+ * are always aligned in the buffer, so they are referenced in place, and a functor taking a
+ * `const T&` reads them directly from Values::Data().  The layout and alignment are checked at
+ * compile time.
+ */
+template <typename T, typename Scalar>
+class StorageArg<T, Scalar,
+                 std::enable_if_t<IsFixedSizeMatrixOf<T, Scalar>::value &&
+                                  alignof(T) <= alignof(Scalar)>> {
+  static_assert(sizeof(T) == T::RowsAtCompileTime * T::ColsAtCompileTime * sizeof(Scalar),
+                "The memory layout of T must be exactly its storage to reference it in place");
+  static_assert(alignof(T) <= alignof(Scalar),
+                "The Values data buffer is only guaranteed to be aligned for Scalar");
+
+ public:
+  StorageArg(const Scalar* const data, const index_entry_t& entry)
+      : value_(reinterpret_cast<const T*>(data + entry.offset)) {
+    SYM_ASSERT(entry.type == StorageOps<T>::TypeEnum());
+  }
+
+  StorageArg(const StorageArg&) = delete;
+  StorageArg& operator=(const StorageArg&) = delete;
+
+  const T& Get() const {
+    return *value_;
+  }
+
+ private:
+  const T* value_;
+};
+
+/**
+ * Eigen matrices that Eigen may vectorize (e.g. Matrix22d, Matrix66d) require more alignment than
+ * Scalar, which the Values buffer does not guarantee.  These are referenced in place when the
+ * entry happens to be suitably aligned, and copied out otherwise.
+ */
+template <typename T, typename Scalar>
+class StorageArg<T, Scalar,
+                 std::enable_if_t<IsFixedSizeMatrixOf<T, Scalar>::value &&
+                                  (alignof(T) > alignof(Scalar))>> {
+  static_assert(sizeof(T) == T::RowsAtCompileTime * T::ColsAtCompileTime * sizeof(Scalar),
+                "The memory layout of T must be exactly its storage to reference it in place");
+
+ public:
+  StorageArg(const Scalar* const data, const index_entry_t& entry)
+      : value_(reinterpret_cast<const T*>(data + entry.offset)) {
+    SYM_ASSERT(entry.type == StorageOps<T>::TypeEnum());
+    if (reinterpret_cast<std::uintptr_t>(value_) % alignof(T) != 0) {
+      copy_ = Eigen::Map<const T, Eigen::Unaligned>(data + entry.offset);
+      value_ = &copy_;
+    }
+  }
+
+  StorageArg(const StorageArg&) = delete;
+  StorageArg& operator=(const StorageArg&) = delete;
+
+  const T& Get() const {
+    return *value_;
+  }
+
+ private:
+  const T* value_;
+  T copy_;
+};
+
+/**
+ * The storage of the dynamic matrix output, resized to the size of the fixed-size matrix type
+ * FixedMatrix, as a FixedMatrix that a functor can write to in place.  Resizing does not
+ * reallocate if output already has that size.  Returns nullptr if output is nullptr.
+ *
+ * Dynamic matrices are allocated with Eigen's default alignment, which is at least the alignment of
+ * any fixed-size matrix; this and the layout are checked at compile time.
+ */
+template <typename FixedMatrix, typename DynamicMatrix>
+FixedMatrix* FixedSizeOutput(DynamicMatrix* const output) {
+  using Scalar = typename DynamicMatrix::Scalar;
+  static_assert(std::is_same<Scalar, typename FixedMatrix::Scalar>::value, "Mismatched Scalar");
+  static_assert(sizeof(FixedMatrix) == FixedMatrix::RowsAtCompileTime *
+                                           FixedMatrix::ColsAtCompileTime * sizeof(Scalar),
+                "The memory layout of FixedMatrix must be exactly its storage to write in place");
+  static_assert(
+      alignof(FixedMatrix) <= alignof(Scalar) || alignof(FixedMatrix) <= EIGEN_DEFAULT_ALIGN_BYTES,
+      "Dynamic matrix storage is not aligned enough for FixedMatrix");
+
+  if (output == nullptr) {
+    return nullptr;
+  }
+  output->resize(FixedMatrix::RowsAtCompileTime, FixedMatrix::ColsAtCompileTime);
+  return reinterpret_cast<FixedMatrix*>(output->data());
+}
+
 // ------------------------------------------------------------------------------------------------
 // Factor::Jacobian constructor dispatcher
 //
@@ -52,19 +200,16 @@ struct JacobianFuncValuesExtractor {
   using ResidualVec = typename JacobianFuncTypeHelper<Functor>::ResidualVec;
   using JacobianMat = typename JacobianFuncTypeHelper<Functor>::JacobianMat;
 
-  /** Pull out the arg given by Index from the Values. */
-  template <int Index>
-  inline static ArgType<Index> GetValue(const sym::Values<Scalar>& values,
-                                        const std::vector<index_entry_t>& keys) {
-    return values.template At<ArgType<Index>>(keys[Index]);
-  }
-
-  /** Invokes the user function with the proper input args extracted from the Values. */
+  /**
+   * Invokes the user function with the proper input args extracted from the Values.  Fixed-size
+   * Eigen args are passed as references into the Values storage where possible, see StorageArg.
+   */
   template <int... S>
   inline static void InvokeAtRange(const Functor& func, const sym::Values<Scalar>& values,
                                    const std::vector<index_entry_t>& keys, ResidualVec* residual,
                                    JacobianMat* jacobian, Sequence<S...>) {
-    func(GetValue<S>(values, keys)..., residual, jacobian);
+    const Scalar* const data = values.Data().data();
+    func(StorageArg<ArgType<S>, Scalar>(data, keys[S]).Get()..., residual, jacobian);
   }
 
   inline static void Invoke(const Functor& func, const sym::Values<Scalar>& values,
@@ -162,43 +307,35 @@ struct JacobianDispatcher<true /* is_dynamic */, IsSparse, Scalar> {
 // size factors.
 template <typename Scalar, typename Functor>
 auto JacobianFixed(Functor&& func) {
-  using Traits = function_traits<Functor>;
+  using ResidualVec = typename JacobianFuncValuesExtractor<Scalar, Functor>::ResidualVec;
+  using JacobianMat = typename JacobianFuncValuesExtractor<Scalar, Functor>::JacobianMat;
   using FunctorType = std::decay_t<Functor>;
 
-  // Get matrix types from function signature
-  using JacobianMat = typename std::remove_pointer_t<
-      typename Traits::template arg<Traits::num_arguments - 1>::type>;
-
   return [func = std::forward<Functor>(func)](const Values<Scalar>& values,
                                               const std::vector<index_entry_t>& keys_to_func,
                                               VectorX<Scalar>* residual, MatrixX<Scalar>* jacobian,
                                               MatrixX<Scalar>* hessian, VectorX<Scalar>* rhs) {
-    // Get dimensions (these have already been sanity checked in Factor::Jacobian)
-    constexpr int M = JacobianMat::RowsAtCompileTime;
-    constexpr int N = JacobianMat::ColsAtCompileTime;
-
+    // The residual and jacobian are written in place (their sizes have already been sanity checked
+    // in Factor::Jacobian)
     SYM_ASSERT(residual != nullptr);
-    Eigen::Matrix<Scalar, M, 1> residual_fixed;
+    ResidualVec* const residual_fixed = FixedSizeOutput<ResidualVec>(residual);
 
     if (jacobian != nullptr) {
       // jacobian is requested
-      Eigen::Matrix<Scalar, M, N> jacobian_fixed;
+      JacobianMat* const jacobian_fixed = FixedSizeOutput<JacobianMat>(jacobian);
       JacobianFuncValuesExtractor<Scalar, FunctorType>::Invoke(func, values, keys_to_func,
-                                                               &residual_fixed, &jacobian_fixed);
-      (*jacobian) = jacobian_fixed;
-      CalculateHessianRhs(residual_fixed, jacobian_fixed, hessian, rhs);
+                                                               residual_fixed, jacobian_fixed);
+      CalculateHessianRhs(*residual_fixed, *jacobian_fixed, hessian, rhs);
     } else {
       // jacobian not requested
-      Eigen::Matrix<Scalar, M, N>* const jacobian_invoke_arg = nullptr;
-      JacobianFuncValuesExtractor<Scalar, FunctorType>::Invoke(
-          func, values, keys_to_func, &residual_fixed, jacobian_invoke_arg);
+      JacobianMat* const jacobian_invoke_arg = nullptr;
+      JacobianFuncValuesExtractor<Scalar, FunctorType>::Invoke(func, values, keys_to_func,
+                                                               residual_fixed, jacobian_invoke_arg);
 
       // Check that the hessian and rhs weren't requested without the jacobian
       SYM_ASSERT(hessian == nullptr);
       SYM_ASSERT(rhs == nullptr);
     }
-
-    (*residual) = residual_fixed;
   };
 }
 
@@ -250,20 +387,17 @@ struct HessianFuncValuesExtractor {
   using HessianMat = typename HessianFuncTypeHelper<Functor>::HessianMat;
   using RhsVec = typename HessianFuncTypeHelper<Functor>::RhsVec;
 
-  /** Pull out the arg given by Index from the Values. */
-  template <int Index>
-  inline static ArgType<Index> GetValue(const sym::Values<Scalar>& values,
-                                        const std::vector<index_entry_t>& keys) {
-    return values.template At<ArgType<Index>>(keys[Index]);
-  }
-
-  /** Invokes the user function with the proper input args extracted from the Values. */
+  /**
+   * Invokes the user function with the proper input args extracted from the Values.  Fixed-size
+   * Eigen args are passed as references into the Values storage where possible, see StorageArg.
+   */
   template <int... S>
   inline static void InvokeAtRange(const Functor& func, const sym::Values<Scalar>& values,
                                    const std::vector<index_entry_t>& keys, ResidualVec* residual,
                                    JacobianMat* jacobian, HessianMat* hessian, RhsVec* rhs,
                                    Sequence<S...>) {
-    func(GetValue<S>(values, keys)..., residual, jacobian, hessian, rhs);
+    const Scalar* const data = values.Data().data();
+    func(StorageArg<ArgType<S>, Scalar>(data, keys[S]).Get()..., residual, jacobian, hessian, rhs);
   }
 
   inline static void Invoke(const Functor& func, const sym::Values<Scalar>& values,
@@ -311,41 +445,35 @@ struct HessianDispatcher<true /* is_dynamic */, IsSparse, Scalar> {
 template <typename Scalar, typename Functor>
 auto HessianFixedDense(Functor&& func) {
   // Get matrix types from function signature
+  using ResidualVec = typename HessianFuncValuesExtractor<Scalar, Functor>::ResidualVec;
   using JacobianMat = typename HessianFuncValuesExtractor<Scalar, Functor>::JacobianMat;
+  using HessianMat = typename HessianFuncValuesExtractor<Scalar, Functor>::HessianMat;
+  using RhsVec = typename HessianFuncValuesExtractor<Scalar, Functor>::RhsVec;
   using FunctorType = std::decay_t<Functor>;
 
   // Get dimensions (these have already been sanity checked in Factor::Hessian)
-  constexpr int M = JacobianMat::RowsAtCompileTime;
   constexpr int N = JacobianMat::ColsAtCompileTime;
 
   return [func = std::forward<Functor>(func)](const Values<Scalar>& values,
                                               const std::vector<index_entry_t>& keys_to_func,
                                               VectorX<Scalar>* residual, MatrixX<Scalar>* jacobian,
                                               MatrixX<Scalar>* hessian, VectorX<Scalar>* rhs) {
-    Eigen::Matrix<Scalar, M, 1> residual_fixed;
-    Eigen::Matrix<Scalar, M, N> jacobian_fixed;
-    Eigen::Matrix<Scalar, N, N> hessian_fixed;
-    Eigen::Matrix<Scalar, N, 1> rhs_fixed;
+    // The residual, jacobian, and rhs are written in place.  The hessian goes through a fixed-size
+    // temporary, since only its lower triangle is copied out: the functor may write the upper
+    // triangle, or not at all (see lower_triangular_hessian in Codegen.with_linearization), and
+    // the upper triangle of the output is left as it was
+    HessianMat hessian_fixed;
 
     HessianFuncValuesExtractor<Scalar, FunctorType>::Invoke(
-        func, values, keys_to_func, residual == nullptr ? nullptr : &residual_fixed,
-        jacobian == nullptr ? nullptr : &jacobian_fixed,
-        hessian == nullptr ? nullptr : &hessian_fixed, rhs == nullptr ? nullptr : &rhs_fixed);
-
-    if (residual != nullptr) {
-      (*residual) = residual_fixed;
-    }
-
-    if (jacobian != nullptr) {
-      (*jacobian) = jacobian_fixed;
-    }
+        func, values, keys_to_func, FixedSizeOutput<ResidualVec>(residual),
+        FixedSizeOutput<JacobianMat>(jacobian), hessian == nullptr ? nullptr : &hessian_fixed,
+        FixedSizeOutput<RhsVec>(rhs));
 
     if (hessian != nullptr) {
-      (*hessian) = hessian_fixed;
-    }
-
-    if (rhs != nullptr) {
-      (*rhs) = rhs_fixed;
+      if (hessian->rows() != N || hessian->cols() != N) {
+        hessian->setZero(N, N);
+      }
+      hessian->template triangularView<Eigen::Lower>() = hessian_fixed;
     }
   };
 }
@@ -376,20 +504,9 @@ auto HessianFixedSparse(Functor&& func) {
                                               const std::vector<index_entry_t>& keys_to_func,
                                               VectorX<Scalar>* residual, JacobianMat* jacobian,
                                               HessianMat* hessian, VectorX<Scalar>* rhs) {
-    ResidualVec residual_fixed;
-    RhsVec rhs_fixed;
-
     HessianFuncValuesExtractor<Scalar, FunctorType>::Invoke(
-        func, values, keys_to_func, residual == nullptr ? nullptr : &residual_fixed, jacobian,
-        hessian, rhs == nullptr ? nullptr : &rhs_fixed);
-
-    if (residual != nullptr) {
-      (*residual) = residual_fixed;
-    }
-
-    if (rhs != nullptr) {
-      (*rhs) = rhs_fixed;
-    }
+        func, values, keys_to_func, FixedSizeOutput<ResidualVec>(residual), jacobian, hessian,
+        FixedSizeOutput<RhsVec>(rhs));
   };
 }
 
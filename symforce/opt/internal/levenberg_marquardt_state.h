@@ -56,6 +56,14 @@ class LevenbergMarquardtState {
       have_cached_error_ = false;
     }
 
+    // Update the linearization in place, for a cost function that changed in a way that doesn't
+    // need the factors to be evaluated again
+    template <typename UpdateFunc>
+    void UpdateLinearization(const UpdateFunc& func) {
+      func(linearization_);
+      have_cached_error_ = false;
+    }
+
     const Linearization<Scalar>& GetLinearization() const {
       return linearization_;
     }
@@ -80,6 +88,23 @@ class LevenbergMarquardtState {
     best_values_are_valid_ = false;
   }
 
+  // Reset the state to the best values and their linearization, updated by `func`.  The best
+  // block becomes the new block, so that it's the initial block for the next iteration
+  template <typename UpdateFunc>
+  void ResetToBest(const UpdateFunc& func) {
+    SYM_ASSERT(best_values_are_valid_);
+    new_idx_ = best_idx_;
+    init_idx_ = (best_idx_ + 1) % 3;
+    free_idx_ = (best_idx_ + 2) % 3;
+
+    Init().values = {};
+    Free().values = {};
+    Init().ResetLinearization();
+    Free().ResetLinearization();
+
+    New().UpdateLinearization(func);
+  }
+
   bool BestIsValid() const {
     return best_values_are_valid_;
   }
@@ -95,6 +95,21 @@ class LinearizedDenseFactorPool {
     }
   }
 
+  /**
+   * Like AppendFactorSize, but always adds a new linearization used only by this factor, so that
+   * it still holds the factor's linearization after the others have been evaluated.
+   */
+  void AppendUniqueFactorSize(const int res_dim, const int rhs_dim) {
+    index_per_factor_.push_back(unique_linearized_factors_.size());
+    unique_linearized_factors_.emplace_back();
+    LinearizedDenseFactor& new_linearization = unique_linearized_factors_.back();
+
+    new_linearization.residual.resize(res_dim, 1);
+    new_linearization.jacobian.resize(res_dim, rhs_dim);
+    new_linearization.hessian.resize(rhs_dim, rhs_dim);
+    new_linearization.rhs.resize(rhs_dim, 1);
+  }
+
   /**
    * Returns a linearized dense factor whose size is correct for the dense_index'th dense
    * factor.
@@ -102,6 +117,9 @@ class LinearizedDenseFactorPool {
   LinearizedDenseFactor& at(const int dense_index) {
     return unique_linearized_factors_.at(index_per_factor_.at(dense_index));
   }
+  const LinearizedDenseFactor& at(const int dense_index) const {
+    return unique_linearized_factors_.at(index_per_factor_.at(dense_index));
+  }
 
  private:
   // One LinearizedDenseFactor for each unique pair of res_dim and rhs_dim seen
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <chrono>
+
+namespace sym {
+namespace internal {
+
+/**
+ * Stopwatch for timing the phases of a single call, e.g. one optimizer iteration.
+ *
+ * Unlike SYM_TIME_SCOPE, this does not aggregate anything or touch any global state, so it works
+ * regardless of the SYMFORCE_TIC_TOC_HEADER in use.  When constructed disabled, it never reads the
+ * clock and Elapsed() returns 0.
+ */
+class PhaseTimer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit PhaseTimer(const bool enabled) : enabled_(enabled) {
+    Start();
+  }
+
+  // Mark the start of a phase
+  void Start() {
+    if (enabled_) {
+      start_ = Clock::now();
+    }
+  }
+
+  // Seconds since the last call to Start(), or since construction
+  float Elapsed() const {
+    if (!enabled_) {
+      return 0.0f;
+    }
+    return std::chrono::duration<float>(Clock::now() - start_).count();
+  }
+
+ private:
+  bool enabled_;
+  Clock::time_point start_{};
+};
+
+}  // namespace internal
+}  // namespace sym
@@ -5,6 +5,8 @@
 
 #include "./tic_toc.h"
 
+#include <fstream>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <spdlog/spdlog.h>
@@ -20,30 +22,189 @@ namespace {
 TicTocManager g_tic_toc{};
 thread_local ThreadContext g_thread_ctx{};
 
+// Number of events each thread buffers before writing them to the trace
+constexpr size_t kTraceBatchSize = 1024;
+
 double ToSeconds(const Duration& duration) {
   return static_cast<double>(duration.count()) * Duration::period::num / Duration::period::den;
 }
 
+double ToMicroseconds(const Duration& duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// Quote and escape a string for JSON
+std::string JsonString(const std::string& str) {
+  std::string result = "\"";
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += fmt::format("\\u{:04x}", static_cast<int>(c));
+    } else {
+      result += c;
+    }
+  }
+  result += '"';
+  return result;
+}
+
+// Format a row of a results table: the name, padded to name_width, then each column centered
+std::string FormatTableRow(const std::string& name, const int name_width,
+                           const std::vector<std::string>& columns) {
+  std::string row = fmt::format("{:<{}} :", name, name_width);
+  for (size_t i = 0; i < columns.size(); i++) {
+    row += fmt::format("{} {:^14}", i == 0 ? "" : " |", columns[i]);
+  }
+  return row + "\n";
+}
+
+std::string FormatTableSeparator(const int name_width, const size_t num_columns) {
+  std::string separator(name_width + 1, '-');
+  for (size_t i = 0; i < num_columns; i++) {
+    separator += std::string("+") + std::string(16, '-');
+  }
+  return separator + "\n";
+}
+
+std::string FormatSeconds(const double seconds) {
+  return fmt::format("{:.5}", float(seconds));
+}
+
+// Percentiles of stats without a histogram are shown as "-", rather than 0
+std::string FormatPercentile(const TicTocStats& stats, const double fraction) {
+  if (stats.Histogram().Count() == 0) {
+    return "-";
+  }
+  return FormatSeconds(stats.Percentile(fraction));
+}
+
 }  // namespace
 
 TimePoint GetMonotonicTime() {
   return Clock::now();
 }
 
-// Accumulate a duration specified by the start time and end time with the named block
+TicTocId InternTicTocName(const std::string& name) {
+  return g_tic_toc.Intern(name);
+}
+
+// Accumulate a duration specified by the start time and end time with the block for id
+void TicTocUpdate(const TicTocId id, const Duration& duration) {
+  g_thread_ctx.Exit(id, g_thread_ctx.Enter(id), GetMonotonicTime() - duration, duration);
+}
+
 void TicTocUpdate(const std::string& name, const Duration& duration) {
-  g_thread_ctx.Update(name, duration);
+  TicTocUpdate(InternTicTocName(name), duration);
+}
+
+int32_t TicTocEnter(const TicTocId id) {
+  return g_thread_ctx.Enter(id);
+}
+
+void TicTocExit(const TicTocId id, const int32_t node, const TimePoint& start,
+                const Duration& duration) {
+  g_thread_ctx.Exit(id, node, start, duration);
+}
+
+TicTocManager& GetGlobalTicTocManager() {
+  return g_tic_toc;
+}
+
+// --------------------------------------------------------------------------------------------
+//                                        TicTocHistogram
+// --------------------------------------------------------------------------------------------
+
+int TicTocHistogram::BucketIndex(const Duration::rep ticks) {
+  constexpr int kSubBuckets = 1 << kSubBucketBits;
+  if (ticks < kSubBuckets) {
+    return std::max<int>(ticks, 0);
+  }
+
+  // Durations [2^e, 2^(e + 1)) are split into kSubBuckets buckets, using the kSubBucketBits bits
+  // after the leading one.  Find e, the position of the leading one, by binary search
+  int exponent = 0;
+  for (int step = 32; step > 0; step /= 2) {
+    if ((ticks >> (exponent + step)) != 0) {
+      exponent += step;
+    }
+  }
+  const int shift = exponent - kSubBucketBits;
+  const int sub_bucket = static_cast<int>((ticks >> shift) & (kSubBuckets - 1));
+  return std::min(((shift + 1) << kSubBucketBits) + sub_bucket, kNumBuckets - 1);
+}
+
+Duration::rep TicTocHistogram::BucketLowerBound(const int index) {
+  constexpr int kSubBuckets = 1 << kSubBucketBits;
+  if (index < kSubBuckets) {
+    return index;
+  }
+
+  const int shift = (index >> kSubBucketBits) - 1;
+  return static_cast<Duration::rep>(kSubBuckets + (index & (kSubBuckets - 1))) << shift;
+}
+
+void TicTocHistogram::Add(const Duration& duration) {
+  AddToBucket(BucketIndex(duration.count()), 1);
+}
+
+void TicTocHistogram::AddToBucket(const int index, const int64_t count) {
+  if (bucket_counts_.empty()) {
+    bucket_counts_.resize(kNumBuckets, 0);
+  }
+  bucket_counts_[index] += count;
+  num_samples_ += count;
+}
+
+void TicTocHistogram::Merge(const TicTocHistogram& other) {
+  for (int i = 0; i < static_cast<int>(other.bucket_counts_.size()); i++) {
+    if (other.bucket_counts_[i] > 0) {
+      AddToBucket(i, other.bucket_counts_[i]);
+    }
+  }
+}
+
+double TicTocHistogram::Percentile(const double fraction) const {
+  if (num_samples_ == 0) {
+    return 0;
+  }
+
+  // Find the bucket containing the sample with the given rank, and interpolate within it
+  const double rank = std::min(std::max(fraction, 0.0), 1.0) * num_samples_;
+  int64_t num_below = 0;
+  for (int i = 0; i < kNumBuckets; i++) {
+    const int64_t count = bucket_counts_[i];
+    if (count > 0 && num_below + count >= rank) {
+      const double lower = BucketLowerBound(i);
+      const double upper = i + 1 < kNumBuckets ? BucketLowerBound(i + 1) : lower;
+      const double ticks = lower + (upper - lower) * (rank - num_below) / count;
+      return ToSeconds(Duration(static_cast<Duration::rep>(ticks)));
+    }
+    num_below += count;
+  }
+
+  return ToSeconds(Duration(BucketLowerBound(kNumBuckets - 1)));
+}
+
+int64_t TicTocHistogram::Count() const {
+  return num_samples_;
 }
 
 // --------------------------------------------------------------------------------------------
 //                                          TicTocStats
 // --------------------------------------------------------------------------------------------
 
+TicTocStats::TicTocStats(const int64_t num_tics, const Duration& total_time,
+                         const Duration& min_time, const Duration& max_time)
+    : num_tics_(num_tics), total_time_(total_time), min_time_(min_time), max_time_(max_time) {}
+
 void TicTocStats::Update(const Duration& duration) {
   num_tics_++;
   total_time_ += duration;
   min_time_ = std::min(min_time_, duration);
   max_time_ = std::max(max_time_, duration);
+  histogram_.Add(duration);
 }
 
 void TicTocStats::Merge(const TicTocStats& other) {
@@ -51,6 +212,7 @@ void TicTocStats::Merge(const TicTocStats& other) {
   total_time_ += other.total_time_;
   min_time_ = std::min(min_time_, other.min_time_);
   max_time_ = std::max(max_time_, other.max_time_);
+  histogram_.Merge(other.histogram_);
 }
 
 double TicTocStats::TotalTime() const {
@@ -76,47 +238,249 @@ int64_t TicTocStats::Count() const {
   return num_tics_;
 }
 
+double TicTocStats::Percentile(const double fraction) const {
+  if (histogram_.Count() == 0) {
+    return 0;
+  }
+
+  // Interpolating within the extreme buckets can overshoot the true extremes
+  return std::min(std::max(histogram_.Percentile(fraction), MinTime()), MaxTime());
+}
+
+// --------------------------------------------------------------------------------------------
+//                                    TicTocCounters
+// --------------------------------------------------------------------------------------------
+
+TicTocStats TicTocCounters::Load() const {
+  return TicTocStats(num_tics_.load(std::memory_order_relaxed),
+                     Duration(total_time_.load(std::memory_order_relaxed)),
+                     Duration(min_time_.load(std::memory_order_relaxed)),
+                     Duration(max_time_.load(std::memory_order_relaxed)));
+}
+
 // --------------------------------------------------------------------------------------------
 //                                    ThreadContext
 // --------------------------------------------------------------------------------------------
 
+TicTocNode::TicTocNode(const TicTocId node_id, const int32_t parent_node)
+    : id(node_id), parent(parent_node) {}
+
+ThreadContext::ThreadContext() : counters_(new TicTocCounters[kMaxTicTocIds]) {
+  nodes_.emplace_back(kInvalidTicTocId, -1);
+  index_ = g_tic_toc.Register(this);
+}
+
 ThreadContext::~ThreadContext() {
-  g_tic_toc.Consume(block_map_);
+  g_tic_toc.Consume(this);
+}
+
+int32_t ThreadContext::Enter(const TicTocId id) {
+  for (const auto& child : nodes_[current_node_].children) {
+    if (child.first == id) {
+      current_node_ = child.second;
+      return current_node_;
+    }
+  }
+
+  // First time this scope has been entered from the current path, so add a node for it, and add it
+  // to the children of the parent, which is looked up by index
+  const int32_t node = nodes_.size();
+  {
+    std::lock_guard<std::mutex> lock(nodes_mutex_);
+    nodes_.emplace_back(id, current_node_);
+  }
+  nodes_[current_node_].children.emplace_back(id, node);
+  current_node_ = node;
+  return node;
+}
+
+void ThreadContext::Exit(const TicTocId id, const int32_t node, const TimePoint& start,
+                         const Duration& duration) {
+  counters_[id].Update(duration);
+
+  TicTocNode& tree_node = nodes_[node];
+  tree_node.counters.Update(duration);
+  current_node_ = tree_node.parent;
+
+  if (g_tic_toc.IsRecordingPercentiles()) {
+    RecordHistogramSample(tree_node, duration);
+  }
+
+  if (g_tic_toc.IsTracing()) {
+    std::vector<TicTocEvent> batch;
+    {
+      std::lock_guard<std::mutex> lock(events_mutex_);
+      events_.push_back({id, start, duration});
+      if (events_.size() >= kTraceBatchSize) {
+        batch.swap(events_);
+      }
+    }
+    if (!batch.empty()) {
+      g_tic_toc.WriteTraceEvents(index_, batch);
+    }
+  }
 }
 
-void ThreadContext::Update(const std::string& name, const Duration& duration) {
-  // This intentionally default-constructs the block if it doesn't exist
-  block_map_[name].Update(duration);
+void ThreadContext::RecordHistogramSample(TicTocNode& node, const Duration& duration) {
+  if (node.histogram == nullptr) {
+    std::lock_guard<std::mutex> lock(nodes_mutex_);
+    node.histogram.reset(new std::atomic<int64_t>[TicTocHistogram::kNumBuckets]());
+  }
+
+  std::atomic<int64_t>& bucket = node.histogram[TicTocHistogram::BucketIndex(duration.count())];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void ThreadContext::Collect(std::vector<TicTocStats>& stats) const {
+  for (TicTocId id = 0; id < static_cast<TicTocId>(stats.size()); id++) {
+    const TicTocStats thread_stats = counters_[id].Load();
+    if (thread_stats.Count() > 0) {
+      stats[id].Merge(thread_stats);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(nodes_mutex_);
+  for (size_t i = 1; i < nodes_.size(); i++) {
+    const TicTocNode& node = nodes_[i];
+    if (node.histogram != nullptr && node.id < static_cast<TicTocId>(stats.size())) {
+      for (int bucket = 0; bucket < TicTocHistogram::kNumBuckets; bucket++) {
+        const int64_t count = node.histogram[bucket].load(std::memory_order_relaxed);
+        if (count > 0) {
+          stats[node.id].Histogram().AddToBucket(bucket, count);
+        }
+      }
+    }
+  }
+}
+
+void ThreadContext::CollectTree(std::map<std::vector<TicTocId>, TicTocStats>& tree) const {
+  std::lock_guard<std::mutex> lock(nodes_mutex_);
+
+  // Parents come before their children, so each path can be built from its parent's
+  std::vector<std::vector<TicTocId>> paths(nodes_.size());
+  for (size_t i = 1; i < nodes_.size(); i++) {
+    const TicTocNode& node = nodes_[i];
+    paths[i] = paths[node.parent];
+    paths[i].push_back(node.id);
+
+    TicTocStats node_stats = node.counters.Load();
+    if (node_stats.Count() == 0) {
+      continue;
+    }
+    if (node.histogram != nullptr) {
+      for (int bucket = 0; bucket < TicTocHistogram::kNumBuckets; bucket++) {
+        const int64_t count = node.histogram[bucket].load(std::memory_order_relaxed);
+        if (count > 0) {
+          node_stats.Histogram().AddToBucket(bucket, count);
+        }
+      }
+    }
+    tree[paths[i]].Merge(node_stats);
+  }
+}
+
+std::vector<TicTocEvent> ThreadContext::TakeEvents() {
+  std::vector<TicTocEvent> events;
+  std::lock_guard<std::mutex> lock(events_mutex_);
+  events.swap(events_);
+  return events;
 }
 
 // --------------------------------------------------------------------------------------------
 //                                    TicTocManager
 // --------------------------------------------------------------------------------------------
 
-TicTocManager::TicTocManager() {
+TicTocManager::TicTocManager() : start_time_(GetMonotonicTime()) {
   // Allow env variable to disable print on destruction
   if (std::getenv("SYMFORCE_TIC_TOC_QUIET") != nullptr) {
     print_on_destruction_ = false;
   }
+
+  // Allow env variables to request machine readable output
+  const char* const json_lines_path = std::getenv("SYMFORCE_TIC_TOC_JSON");
+  if (json_lines_path != nullptr) {
+    json_lines_path_ = json_lines_path;
+  }
+
+  // The JSON lines include percentiles, so they're recorded if those are requested
+  if (json_lines_path != nullptr || std::getenv("SYMFORCE_TIC_TOC_PERCENTILES") != nullptr) {
+    SetRecordPercentiles(true);
+  }
+
+  const char* const trace_path = std::getenv("SYMFORCE_TIC_TOC_TRACE");
+  if (trace_path != nullptr) {
+    trace_file_.reset(new std::ofstream(trace_path));
+    StartTrace(*trace_file_);
+  }
 }
 
 TicTocManager::~TicTocManager() {
+  if (IsTracing()) {
+    StopTrace();
+  }
+
+  if (!json_lines_path_.empty()) {
+    std::ofstream json_lines_file(json_lines_path_);
+    WriteJsonLines(json_lines_file);
+  }
+
   if (print_on_destruction_ && spdlog::should_log(spdlog::level::info)) {
     PrintTimingResults();
   }
 }
 
-void TicTocManager::PrintTimingResults(std::ostream& out) const {
+std::vector<std::pair<std::string, TicTocStats>> TicTocManager::GetTimingResults() const {
   std::vector<std::pair<std::string, TicTocStats>> blocks;
 
-  {
-    std::lock_guard<std::mutex> lock(tictoc_blocks_mutex_);
-    blocks.reserve(tictoc_blocks_.size());
-    for (const auto& block_pair : tictoc_blocks_) {
-      blocks.push_back(block_pair);
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Threads only ever write their own counters, so these can be read without stopping them
+  std::vector<TicTocStats> stats = consumed_stats_;
+  for (const ThreadContext* const thread_context : thread_contexts_) {
+    thread_context->Collect(stats);
+  }
+
+  for (TicTocId id = 0; id < static_cast<TicTocId>(stats.size()); id++) {
+    if (stats[id].Count() > 0) {
+      blocks.emplace_back(names_[id], stats[id]);
+    }
+  }
+
+  return blocks;
+}
+
+std::vector<TicTocTreeEntry> TicTocManager::GetTimingTree() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return GetTimingTreeWithoutLock();
+}
+
+std::vector<TicTocTreeEntry> TicTocManager::GetTimingTreeWithoutLock() const {
+  std::map<std::vector<TicTocId>, TicTocStats> tree = consumed_tree_;
+  for (const ThreadContext* const thread_context : thread_contexts_) {
+    thread_context->CollectTree(tree);
+  }
+
+  std::vector<TicTocTreeEntry> entries;
+  entries.reserve(tree.size());
+  for (const auto& path_and_stats : tree) {
+    TicTocTreeEntry entry;
+    for (const TicTocId id : path_and_stats.first) {
+      entry.path.push_back(names_[id]);
     }
+    entry.stats = path_and_stats.second;
+    entries.push_back(std::move(entry));
   }
 
+  // Sort by name rather than ID, since IDs depend on the order scopes are first hit
+  std::sort(entries.begin(), entries.end(),
+            [](const TicTocTreeEntry& a, const TicTocTreeEntry& b) { return a.path < b.path; });
+
+  return entries;
+}
+
+void TicTocManager::PrintTimingResults(std::ostream& out) const {
+  std::vector<std::pair<std::string, TicTocStats>> blocks = GetTimingResults();
+
   if (blocks.empty()) {
     return;
   }
@@ -131,43 +495,197 @@ void TicTocManager::PrintTimingResults(std::ostream& out) const {
     longest_name = std::max<int>(block.first.size(), longest_name);
   }
 
-  const std::string header_fmt =
-      fmt::format("{{:<{}}}", longest_name) + " : {:^14} | {:^14} | {:^14} | {:^14} | {:^14}\n";
-  const std::string output_fmt = fmt::format("{{:<{}}}", longest_name) +
-                                 " : {:^14} | {:^14.5} | {:^14.5} | {:^14.5} | {:^14.5}\n";
+  // Percentiles are only shown if they were recorded, see SetRecordPercentiles
+  const bool show_percentiles = std::any_of(blocks.begin(), blocks.end(), [](const auto& block) {
+    return block.second.Histogram().Count() > 0;
+  });
 
-  std::string separator(longest_name + 1, '-');
-  for (int i = 0; i < 5; i++) {
-    separator += std::string("+") + std::string(16, '-');
+  std::vector<std::string> legend = {"Count", "Total Time (s)", "Mean Time (s)"};
+  if (show_percentiles) {
+    legend.insert(legend.end(), {"P50 Time (s)", "P99 Time (s)"});
   }
-
-  const std::string legend = fmt::format(header_fmt, "   Name", "Count", "Total Time (s)",
-                                         "Mean Time (s)", "Max Time (s)", "Min Time (s)");
+  legend.insert(legend.end(), {"Max Time (s)", "Min Time (s)"});
 
   fmt::print(out, "\nSymForce TicToc Results:\n");
-  fmt::print(out, legend);
-  fmt::print(out, separator + "\n");
+  fmt::print(out, "{}", FormatTableRow("   Name", longest_name, legend));
+  fmt::print(out, "{}", FormatTableSeparator(longest_name, legend.size()));
 
   for (const auto& block_pair : blocks) {
     const auto& name = block_pair.first;
     const auto& block = block_pair.second;
 
-    fmt::print(out, output_fmt, name, block.Count(), float(block.TotalTime()),
-               float(block.AverageTime()), float(block.MaxTime()), float(block.MinTime()));
+    std::vector<std::string> columns = {fmt::format("{}", block.Count()),
+                                        FormatSeconds(block.TotalTime()),
+                                        FormatSeconds(block.AverageTime())};
+    if (show_percentiles) {
+      columns.insert(columns.end(), {FormatPercentile(block, 0.5), FormatPercentile(block, 0.99)});
+    }
+    columns.insert(columns.end(), {FormatSeconds(block.MaxTime()), FormatSeconds(block.MinTime())});
+    fmt::print(out, "{}", FormatTableRow(name, longest_name, columns));
   }
 }
 
-void TicTocManager::Consume(const std::unordered_map<std::string, TicTocStats>& thread_map) {
-  // Lock the consumer thread
-  std::lock_guard<std::mutex> lock(tictoc_blocks_mutex_);
-  for (const auto& pair : thread_map) {
-    GetStatsWithoutLock(pair.first).Merge(pair.second);
+void TicTocManager::PrintTimingTree(std::ostream& out) const {
+  const std::vector<TicTocTreeEntry> entries = GetTimingTree();
+
+  if (entries.empty()) {
+    return;
   }
+
+  int longest_name = 0;
+  for (const auto& entry : entries) {
+    longest_name =
+        std::max<int>(2 * (entry.path.size() - 1) + entry.path.back().size(), longest_name);
+  }
+
+  const bool show_percentiles = std::any_of(entries.begin(), entries.end(), [](const auto& entry) {
+    return entry.stats.Histogram().Count() > 0;
+  });
+
+  std::vector<std::string> legend = {"Count", "Total Time (s)"};
+  if (show_percentiles) {
+    legend.insert(legend.end(), {"P50 Time (s)", "P99 Time (s)"});
+  }
+
+  fmt::print(out, "\nSymForce TicToc Tree:\n");
+  fmt::print(out, "{}", FormatTableRow("   Name", longest_name, legend));
+  fmt::print(out, "{}", FormatTableSeparator(longest_name, legend.size()));
+
+  for (const auto& entry : entries) {
+    const std::string name = std::string(2 * (entry.path.size() - 1), ' ') + entry.path.back();
+    std::vector<std::string> columns = {fmt::format("{}", entry.stats.Count()),
+                                        FormatSeconds(entry.stats.TotalTime())};
+    if (show_percentiles) {
+      columns.insert(columns.end(),
+                     {FormatPercentile(entry.stats, 0.5), FormatPercentile(entry.stats, 0.99)});
+    }
+    fmt::print(out, "{}", FormatTableRow(name, longest_name, columns));
+  }
+}
+
+void TicTocManager::WriteJsonLines(std::ostream& out) const {
+  for (const auto& entry : GetTimingTree()) {
+    std::string path;
+    for (const auto& name : entry.path) {
+      path += (path.empty() ? "" : ", ") + JsonString(name);
+    }
+
+    const TicTocStats& stats = entry.stats;
+    std::string percentiles;
+    if (stats.Histogram().Count() > 0) {
+      percentiles =
+          fmt::format("\"p50\": {:.9g}, \"p90\": {:.9g}, \"p99\": {:.9g}, ", stats.Percentile(0.5),
+                      stats.Percentile(0.9), stats.Percentile(0.99));
+    }
+    fmt::print(out,
+               "{{\"path\": [{}], \"count\": {}, \"total\": {:.9g}, \"mean\": {:.9g}, "
+               "\"min\": {:.9g}, {}\"max\": {:.9g}}}\n",
+               path, stats.Count(), stats.TotalTime(), stats.AverageTime(), stats.MinTime(),
+               percentiles, stats.MaxTime());
+  }
+  out.flush();
+}
+
+void TicTocManager::StartTrace(std::ostream& out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Drop anything recorded as a previous trace was stopped
+  for (ThreadContext* const thread_context : thread_contexts_) {
+    thread_context->TakeEvents();
+  }
+
+  trace_out_ = &out;
+  trace_has_events_ = false;
+  (*trace_out_) << "[\n";
+  tracing_.store(true, std::memory_order_relaxed);
+}
+
+void TicTocManager::StopTrace() {
+  // Stop recording, then collect what the threads have buffered
+  tracing_.store(false, std::memory_order_relaxed);
+
+  std::vector<std::pair<int32_t, std::vector<TicTocEvent>>> thread_events;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (ThreadContext* const thread_context : thread_contexts_) {
+      thread_events.emplace_back(thread_context->Index(), thread_context->TakeEvents());
+    }
+  }
+  for (const auto& index_and_events : thread_events) {
+    WriteTraceEvents(index_and_events.first, index_and_events.second);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (trace_out_ != nullptr) {
+    (*trace_out_) << "\n]\n";
+    trace_out_->flush();
+    trace_out_ = nullptr;
+  }
+}
+
+void TicTocManager::WriteTraceEvents(const int32_t thread_index,
+                                     const std::vector<TicTocEvent>& events) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (trace_out_ == nullptr) {
+    return;
+  }
+
+  for (const TicTocEvent& event : events) {
+    fmt::print(*trace_out_,
+               "{}{{\"name\": {}, \"ph\": \"X\", \"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 0, "
+               "\"tid\": {}}}",
+               trace_has_events_ ? ",\n" : "", JsonString(names_[event.id]),
+               ToMicroseconds(event.start - start_time_), ToMicroseconds(event.duration),
+               thread_index);
+    trace_has_events_ = true;
+  }
+}
+
+TicTocId TicTocManager::Intern(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto maybe_id = ids_.find(name);
+  if (maybe_id != ids_.end()) {
+    return maybe_id->second;
+  }
+
+  if (static_cast<TicTocId>(names_.size()) == kOverflowTicTocId) {
+    spdlog::warn(
+        "SymForce TicToc: more than {} distinct scope names, timing any new scopes (starting with "
+        "\"{}\") under \"[other]\"",
+        kOverflowTicTocId, name);
+    names_.emplace_back("[other]");
+    consumed_stats_.emplace_back();
+  }
+
+  if (static_cast<TicTocId>(names_.size()) > kOverflowTicTocId) {
+    ids_.emplace(name, kOverflowTicTocId);
+    return kOverflowTicTocId;
+  }
+
+  const TicTocId id = names_.size();
+  names_.push_back(name);
+  ids_.emplace(name, id);
+  consumed_stats_.emplace_back();
+  return id;
+}
+
+int32_t TicTocManager::Register(ThreadContext* const thread_context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  thread_contexts_.push_back(thread_context);
+  return num_threads_++;
 }
 
-TicTocStats& TicTocManager::GetStatsWithoutLock(const std::string& name) {
-  // This intentionally default-constructs the block if it doesn't exist
-  return tictoc_blocks_[name];
+void TicTocManager::Consume(ThreadContext* const thread_context) {
+  WriteTraceEvents(thread_context->Index(), thread_context->TakeEvents());
+
+  // Lock the consumer thread
+  std::lock_guard<std::mutex> lock(mutex_);
+  thread_context->Collect(consumed_stats_);
+  thread_context->CollectTree(consumed_tree_);
+  thread_contexts_.erase(
+      std::remove(thread_contexts_.begin(), thread_contexts_.end(), thread_context),
+      thread_contexts_.end());
 }
 
 }  // namespace internal
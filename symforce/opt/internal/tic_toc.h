@@ -3,13 +3,24 @@
  * This source code is under the Apache 2.0 license found in the LICENSE file.
  * ---------------------------------------------------------------------------- */
 
+#pragma once
+
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace sym {
@@ -19,25 +30,163 @@ using Clock = std::chrono::steady_clock;
 using TimePoint = std::chrono::time_point<Clock>;
 using Duration = TimePoint::duration;
 
+// Dense integer ID for a scope name, assigned by InternTicTocName.  IDs index directly into the
+// fixed-size per-thread arrays of counters, so recording a sample involves no hashing or locking.
+using TicTocId = int32_t;
+
+// Maximum number of distinct scope names.  Names past this limit all share kOverflowTicTocId.
+static constexpr TicTocId kMaxTicTocIds = 1024;
+static constexpr TicTocId kOverflowTicTocId = kMaxTicTocIds - 1;
+static constexpr TicTocId kInvalidTicTocId = -1;
+
 TimePoint GetMonotonicTime();
+
+// Return the ID for the given scope name, assigning a new one if this is the first time the name
+// has been seen.  Takes a lock, so the result should be cached (see GetTicTocId)
+TicTocId InternTicTocName(const std::string& name);
+
+void TicTocUpdate(TicTocId id, const Duration& duration);
 void TicTocUpdate(const std::string& name, const Duration& duration);
 
+// Enter a scope nested inside the current scope of this thread.  Returns the index of the scope in
+// this thread's tree of scopes, to pass to TicTocExit.
+int32_t TicTocEnter(TicTocId id);
+
+// Exit the scope entered with TicTocEnter, recording a sample of length duration starting at start
+void TicTocExit(TicTocId id, int32_t node, const TimePoint& start, const Duration& duration);
+
+// Type used to remember the arguments to a formatted scope name.  C strings are stored by value,
+// since the pointer may be reused for different contents.
+template <typename T>
+struct TicTocArgCache {
+  using type = std::decay_t<T>;
+};
+
+template <>
+struct TicTocArgCache<const char*> {
+  using type = std::string;
+};
+
+template <>
+struct TicTocArgCache<char*> {
+  using type = std::string;
+};
+
+template <typename T>
+using TicTocArgCacheT = typename TicTocArgCache<std::decay_t<T>>::type;
+
+// Whether an argument of type T can be remembered in a TicTocArgCacheT<T> and compared to it
+template <typename T, typename = void>
+struct IsTicTocArgCacheable : std::false_type {};
+
+template <typename T>
+struct IsTicTocArgCacheable<
+    T, decltype(void(std::declval<TicTocArgCacheT<T>&>() = std::declval<const T&>()),
+                void(static_cast<bool>(std::declval<const TicTocArgCacheT<T>&>() ==
+                                       std::declval<const T&>())))>
+    : std::integral_constant<bool, std::is_default_constructible<TicTocArgCacheT<T>>::value> {};
+
+template <typename... Args>
+struct AreTicTocArgsCacheable
+    : std::is_same<std::integer_sequence<bool, true, IsTicTocArgCacheable<Args>::value...>,
+                   std::integer_sequence<bool, IsTicTocArgCacheable<Args>::value..., true>> {};
+
+template <typename MakeName, typename... Args, size_t... Indices>
+std::string MakeTicTocName(const MakeName& make_name, const std::tuple<Args...>& args,
+                           std::index_sequence<Indices...>) {
+  return make_name(std::get<Indices>(args)...);
+}
+
+/**
+ * Get the ID for a scope name formatted from `args`, for the call site identified by Site.
+ *
+ * Each thread remembers the arguments it last formatted the name with at this call site, and only
+ * formats and interns the name again if they change.  For the typical case where the arguments are
+ * the same on every call (e.g. the name of an Optimizer), this costs a comparison of the arguments
+ * instead of formatting the name and hashing it on every scope.  If any argument can't be copied
+ * or compared for equality, the name is formatted and interned on every call instead.
+ *
+ * Args:
+ *   make_name: Callable formatting the name from the elements of args
+ *   args: References to the arguments the name is formatted from, evaluated once by the caller
+ */
+template <typename Site, typename MakeName, typename... Args>
+std::enable_if_t<AreTicTocArgsCacheable<Args...>::value, TicTocId> GetTicTocId(
+    const MakeName& make_name, const std::tuple<Args...>& args) {
+  thread_local TicTocId id = kInvalidTicTocId;
+  thread_local std::tuple<TicTocArgCacheT<Args>...> cached_args{};
+
+  if (id == kInvalidTicTocId || !(cached_args == args)) {
+    id = InternTicTocName(MakeTicTocName(make_name, args, std::index_sequence_for<Args...>{}));
+    cached_args = args;
+  }
+
+  return id;
+}
+
+template <typename Site, typename MakeName, typename... Args>
+std::enable_if_t<!AreTicTocArgsCacheable<Args...>::value, TicTocId> GetTicTocId(
+    const MakeName& make_name, const std::tuple<Args...>& args) {
+  return InternTicTocName(MakeTicTocName(make_name, args, std::index_sequence_for<Args...>{}));
+}
+
 class ScopedTicToc {
  public:
-  explicit ScopedTicToc(const std::string& name) : name_(name), start_(GetMonotonicTime()) {}
+  explicit ScopedTicToc(const TicTocId id)
+      : id_(id), node_(TicTocEnter(id)), start_(GetMonotonicTime()) {}
+
+  explicit ScopedTicToc(const std::string& name) : ScopedTicToc(InternTicTocName(name)) {}
 
   ~ScopedTicToc() {
-    TicTocUpdate(name_, GetMonotonicTime() - start_);
+    TicTocExit(id_, node_, start_, GetMonotonicTime() - start_);
   }
 
  private:
-  std::string name_;
+  TicTocId id_;
+  int32_t node_;
   TimePoint start_;
 };
 
+/**
+ * Histogram of durations, with logarithmically sized buckets.
+ *
+ * Each power of two is split into 2^kSubBucketBits linearly spaced buckets, so any percentile is
+ * accurate to within 1 / 2^kSubBucketBits of its value, for durations of any magnitude.
+ */
+class TicTocHistogram {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kNumBuckets = (64 - kSubBucketBits) << kSubBucketBits;
+
+  // Index of the bucket containing the given number of clock ticks
+  static int BucketIndex(Duration::rep ticks);
+
+  // Smallest number of clock ticks in the bucket
+  static Duration::rep BucketLowerBound(int index);
+
+  void Add(const Duration& duration);
+  void AddToBucket(int index, int64_t count);
+  void Merge(const TicTocHistogram& other);
+
+  // Estimated time in seconds below which the given fraction of samples lie, e.g. 0.5 for the
+  // median.  Interpolates linearly within the bucket.  Returns 0 if there are no samples.
+  double Percentile(double fraction) const;
+
+  int64_t Count() const;
+
+ private:
+  // Sized to kNumBuckets on the first sample
+  std::vector<int64_t> bucket_counts_;
+  int64_t num_samples_{0};
+};
+
 // Stores accumulated statistics about time spent doing something.
 class TicTocStats {
  public:
+  TicTocStats() = default;
+  TicTocStats(int64_t num_tics, const Duration& total_time, const Duration& min_time,
+              const Duration& max_time);
+
   void Update(const Duration& duration);
   void Merge(const TicTocStats& other);
 
@@ -47,24 +196,138 @@ class TicTocStats {
   double MinTime() const;
   int64_t Count() const;
 
+  // See TicTocHistogram::Percentile.  Clamped to [MinTime(), MaxTime()], or 0 if no samples
+  // were added to the histogram
+  double Percentile(double fraction) const;
+
+  const TicTocHistogram& Histogram() const {
+    return histogram_;
+  }
+
+  TicTocHistogram& Histogram() {
+    return histogram_;
+  }
+
  private:
   int64_t num_tics_{0};
   Duration total_time_{0};
   Duration min_time_{std::numeric_limits<Duration::rep>::max()};
   Duration max_time_{std::numeric_limits<Duration::rep>::min()};
+  TicTocHistogram histogram_{};
+};
+
+// Statistics for one scope in one thread.  These are only written by the thread that owns them,
+// so updates are plain loads and stores, but they're atomic so that the TicTocManager can read
+// them without a lock while the thread is running.
+class TicTocCounters {
+ public:
+  void Update(const Duration& duration) {
+    const Duration::rep ticks = duration.count();
+    num_tics_.store(num_tics_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total_time_.store(total_time_.load(std::memory_order_relaxed) + ticks,
+                      std::memory_order_relaxed);
+    if (ticks < min_time_.load(std::memory_order_relaxed)) {
+      min_time_.store(ticks, std::memory_order_relaxed);
+    }
+    if (ticks > max_time_.load(std::memory_order_relaxed)) {
+      max_time_.store(ticks, std::memory_order_relaxed);
+    }
+  }
+
+  TicTocStats Load() const;
+
+ private:
+  std::atomic<int64_t> num_tics_{0};
+  std::atomic<Duration::rep> total_time_{0};
+  std::atomic<Duration::rep> min_time_{std::numeric_limits<Duration::rep>::max()};
+  std::atomic<Duration::rep> max_time_{std::numeric_limits<Duration::rep>::min()};
+};
+
+// A scope within one thread's tree of nested scopes, i.e. one call path.  Like TicTocCounters,
+// the statistics are only written by the owning thread.
+struct TicTocNode {
+  TicTocNode(TicTocId id, int32_t parent);
+
+  TicTocId id;
+  int32_t parent;
+
+  // Indices of the nodes for scopes entered directly inside this one, by ID.  Only accessed by the
+  // owning thread
+  std::vector<std::pair<TicTocId, int32_t>> children;
+
+  TicTocCounters counters;
+
+  // Counts for each TicTocHistogram bucket, or null until the first sample recorded while the
+  // TicTocManager is recording percentiles.  Allocated under the owning ThreadContext's
+  // nodes_mutex_, so other threads may only read it with that held
+  std::unique_ptr<std::atomic<int64_t>[]> histogram;
+};
+
+// A single timed scope, as recorded while tracing
+struct TicTocEvent {
+  TicTocId id;
+  TimePoint start;
+  Duration duration;
+};
+
+// A call path, and the statistics for that path merged across all threads
+struct TicTocTreeEntry {
+  std::vector<std::string> path;
+  TicTocStats stats;
 };
 
 // Each thread gets one of these
 class ThreadContext {
  public:
-  ThreadContext() = default;
+  // Registers with the TicTocManager
+  ThreadContext();
+
+  // Merges this thread's statistics into the TicTocManager
   ~ThreadContext();
 
-  // Add a sample of length Duration to the block for name
-  void Update(const std::string& name, const Duration& duration);
+  // Add a sample of length Duration to the block for id
+  void Update(const TicTocId id, const Duration& duration) {
+    counters_[id].Update(duration);
+  }
+
+  // See TicTocEnter and TicTocExit
+  int32_t Enter(TicTocId id);
+  void Exit(TicTocId id, int32_t node, const TimePoint& start, const Duration& duration);
+
+  // Merge the statistics for each scope in this thread into stats, indexed by TicTocId.  The
+  // histograms, if any, are merged from the tree, since the flat counters don't keep one
+  void Collect(std::vector<TicTocStats>& stats) const;
+
+  // Merge the statistics for each call path in this thread into tree, keyed by the IDs along the
+  // path
+  void CollectTree(std::map<std::vector<TicTocId>, TicTocStats>& tree) const;
+
+  // Remove and return the events recorded while tracing
+  std::vector<TicTocEvent> TakeEvents();
+
+  int32_t Index() const {
+    return index_;
+  }
 
  private:
-  std::unordered_map<std::string, TicTocStats> block_map_;
+  std::unique_ptr<TicTocCounters[]> counters_;
+
+  // Add a sample to the histogram of node, allocating it on the first sample
+  void RecordHistogramSample(TicTocNode& node, const Duration& duration);
+
+  // The tree of scopes, with the root at index 0.  A deque so that nodes don't move when the tree
+  // grows; nodes_mutex_ is only taken to add nodes or by other threads reading the tree, and
+  // parents always come before their children
+  std::deque<TicTocNode> nodes_;
+  mutable std::mutex nodes_mutex_;
+  int32_t current_node_{0};
+
+  // Events recorded while the TicTocManager is tracing
+  std::vector<TicTocEvent> events_;
+  std::mutex events_mutex_;
+
+  // Index of this thread, in the order threads started using tic toc
+  int32_t index_;
 };
 
 class TicTocManager {
@@ -75,25 +338,112 @@ class TicTocManager {
   // Create string with results of all tic tocs.
   void PrintTimingResults(std::ostream& out = std::cout) const;
 
+  // Print the statistics for each call path, indented by nesting depth
+  void PrintTimingTree(std::ostream& out = std::cout) const;
+
+  // Get the name and statistics of every scope which has been timed so far, by any thread
+  std::vector<std::pair<std::string, TicTocStats>> GetTimingResults() const;
+
+  // Get the statistics of every call path timed so far, merged across threads and sorted so that
+  // each path comes directly before the paths nested inside it
+  std::vector<TicTocTreeEntry> GetTimingTree() const;
+
+  /**
+   * Write the statistics for each call path, as one JSON object per line, e.g.:
+   *
+   *     {"path": ["Optimize", "Iterate"], "count": 10, "total": 0.1, "mean": 0.01, "min": 0.008,
+   *      "p50": 0.01, "p90": 0.012, "p99": 0.013, "max": 0.013}
+   *
+   * (on a single line), with times in seconds.  The percentiles are only written for paths with
+   * a histogram, see SetRecordPercentiles.  Lines are sorted by path, so outputs from different
+   * builds can be compared with line based tools.
+   */
+  void WriteJsonLines(std::ostream& out) const;
+
+  /**
+   * Start streaming every timed scope to out, in the Chrome trace event format (viewable in
+   * chrome://tracing or https://ui.perfetto.dev).  out must outlive the trace.  Threads buffer
+   * events and write them in batches, so this adds some overhead to every scope while enabled.
+   */
+  void StartTrace(std::ostream& out);
+
+  // Write any buffered events and finish the trace started with StartTrace
+  void StopTrace();
+
+  bool IsTracing() const {
+    return tracing_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Set whether to keep a histogram of durations for each call path, for the percentiles in the
+   * printed results and the JSON lines.  Off by default, since it adds a histogram update to every
+   * scope; only samples recorded while this is on are included in the percentiles.  Also turned on
+   * by setting the environment variable SYMFORCE_TIC_TOC_PERCENTILES, or SYMFORCE_TIC_TOC_JSON.
+   */
+  void SetRecordPercentiles(const bool record_percentiles) {
+    record_percentiles_.store(record_percentiles, std::memory_order_relaxed);
+  }
+
+  bool IsRecordingPercentiles() const {
+    return record_percentiles_.load(std::memory_order_relaxed);
+  }
+
+  // Write events recorded by the given thread to the trace, if tracing
+  void WriteTraceEvents(int32_t thread_index, const std::vector<TicTocEvent>& events);
+
   // Set whether or not the tic-toc manager prints on destruction. Default true.
   void SetPrintOnDestruction(const bool print_on_destruction) {
     print_on_destruction_ = print_on_destruction;
   }
 
-  // Lock the global blockmap, then merge blocks from the thread blockmap into blocks from the
-  // global blockmap. Called from the producer thread on termination and locks the consumer thread.
-  void Consume(const std::unordered_map<std::string, TicTocStats>& thread_map);
+  // Return the ID for name, assigning a new one if it does not yet exist
+  TicTocId Intern(const std::string& name);
+
+  // Track the statistics of a running thread, and return the index of the thread.  Called from
+  // the thread on creation of its context
+  int32_t Register(ThreadContext* thread_context);
+
+  // Lock the global stats, then merge the stats from the thread into them and stop tracking the
+  // thread. Called from the producer thread on termination and locks the consumer thread.
+  void Consume(ThreadContext* thread_context);
 
  private:
-  // Return the TicTocBlock for the given name, select out of tictoc_blocks_ and created if it does
-  // not yet exist. This function does not lock tictoc_blocks_ structure.
-  TicTocStats& GetStatsWithoutLock(const std::string& name);
+  // Get the timing tree, without locking mutex_
+  std::vector<TicTocTreeEntry> GetTimingTreeWithoutLock() const;
+
+  mutable std::mutex mutex_;
+
+  // Names of each interned scope, indexed by TicTocId, and the reverse mapping
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, TicTocId> ids_;
+
+  // Stats from threads that have exited, indexed by TicTocId, and by call path
+  std::vector<TicTocStats> consumed_stats_;
+  std::map<std::vector<TicTocId>, TicTocStats> consumed_tree_;
 
-  std::unordered_map<std::string, TicTocStats> tictoc_blocks_;
-  mutable std::mutex tictoc_blocks_mutex_;
+  // Threads that are still running
+  std::vector<ThreadContext*> thread_contexts_;
+  int32_t num_threads_{0};
+
+  // Trace output, if tracing.  Guarded by mutex_
+  std::ostream* trace_out_{nullptr};
+  bool trace_has_events_{false};
+  std::atomic<bool> tracing_{false};
+  std::unique_ptr<std::ostream> trace_file_;
+
+  std::atomic<bool> record_percentiles_{false};
+
+  // Time that trace timestamps are relative to
+  TimePoint start_time_;
+
+  // Optional file to write WriteJsonLines to on destruction
+  std::string json_lines_path_;
 
   bool print_on_destruction_{true};
 };
 
+// The TicTocManager that SYM_TIME_SCOPE records to
+TicTocManager& GetGlobalTicTocManager();
+
 }  // namespace internal
 }  // namespace sym
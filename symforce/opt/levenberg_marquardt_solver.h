@@ -161,6 +161,25 @@ class LevenbergMarquardtSolver {
     have_last_update_ = false;
 
     state_.Reset(values);
+    best_is_last_linearization_ = false;
+  }
+
+  // Reset the state like ResetState, but continue from the best values and their linearization
+  // updated in place by `func`, instead of linearizing them again.  This is for cost functions that
+  // change in a way that can be applied to an existing linearization, such as reweighting the
+  // factors.
+  void ResetStateToBest(const std::function<void(Linearization<Scalar>&)>& func) {
+    SYM_TIME_SCOPE("LM<{}>::ResetStateToBest", id_);
+    have_max_diagonal_ = false;
+    have_last_update_ = false;
+
+    state_.ResetToBest(func);
+  }
+
+  // Whether the most recent call to the LinearizeFunc linearized the best values, i.e. whether the
+  // Linearizer still holds the linearized factors of the best values
+  bool BestIsLastLinearization() const {
+    return state_.BestIsValid() && best_is_last_linearization_;
   }
 
   const optimizer_params_t& Params() const {
@@ -224,6 +243,9 @@ class LevenbergMarquardtSolver {
 
   int iteration_{-1};
 
+  // Whether the best state block was the last one linearized
+  bool best_is_last_linearization_{false};
+
   // Working storage to avoid reallocation
   VectorX<Scalar> update_;
   Eigen::SparseMatrix<Scalar> H_damped_;
@@ -6,6 +6,7 @@
 #include <fmt/ranges.h>
 #include <spdlog/spdlog.h>
 
+#include "./internal/phase_timer.h"
 #include "./levenberg_marquardt_solver.h"
 #include "./tic_toc.h"
 #include "./util.h"
@@ -142,6 +143,12 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
     const bool include_jacobians) {
   SYM_TIME_SCOPE("LM<{}>::Iterate()", id_);
 
+  // The phase timings are measured here instead of read back from SYM_TIME_SCOPE, so that they're
+  // per iteration and don't depend on global state
+  internal::PhaseTimer iteration_timer(p_.record_timing);
+  internal::PhaseTimer phase_timer(p_.record_timing);
+  optimization_iteration_timing_t timing{};
+
   // new -> init
   {
     SYM_TIME_SCOPE("LM<{}>: StateStep", id_);
@@ -151,8 +158,13 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
 
   if (!state_.Init().GetLinearization().IsInitialized()) {
     SYM_TIME_SCOPE("LM<{}>: EvaluateFirst", id_);
+    phase_timer.Start();
     state_.Init().Relinearize(func);
     state_.SetBestToInit();
+    timing.linearize = phase_timer.Elapsed();
+
+    // The initial linearization is recorded in the stats for iteration -1 below
+    iteration_timer.Start();
   }
 
   // save the initial error state_ before optimizing
@@ -163,6 +175,8 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
     iteration_stats.iteration = -1;
     iteration_stats.new_error = state_.Init().Error();
     iteration_stats.current_lambda = current_lambda_;
+    iteration_stats.timing.linearize = timing.linearize;
+    iteration_stats.timing.total = timing.linearize;
 
     if (debug_stats) {
       iteration_stats.values = state_.Init().values.template Cast<double>().GetLcmType();
@@ -185,14 +199,18 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
   }
 
   // TODO(aaron): Get rid of this copy
+  phase_timer.Start();
   H_damped_ = DampHessian(state_.Init().GetLinearization().hessian_lower, have_max_diagonal_,
                           max_diagonal_, current_lambda_);
 
   CheckHessianDiagonal(H_damped_);
+  timing.damp_hessian = phase_timer.Elapsed();
 
   {
     SYM_TIME_SCOPE("LM<{}>: SparseFactorize", id_);
+    phase_timer.Start();
     linear_solver_.Factorize(H_damped_);
+    timing.sparse_factorize = phase_timer.Elapsed();
 
     // NOTE(aaron): This has to happen after the first factorize, since L_inner is not filled out
     // by ComputeSymbolicSparsity
@@ -204,17 +222,24 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
 
   {
     SYM_TIME_SCOPE("LM<{}>: SparseSolve", id_);
+    phase_timer.Start();
     update_ = linear_solver_.Solve(state_.Init().GetLinearization().rhs);
+    timing.sparse_solve = phase_timer.Elapsed();
   }
 
   {
     SYM_TIME_SCOPE("LM<{}>: Update", id_);
+    phase_timer.Start();
     Update(state_.Init().values, index_, -update_, state_.New().values);
+    timing.update = phase_timer.Elapsed();
   }
 
   {
     SYM_TIME_SCOPE("LM<{}>: linearization_func", id_);
+    phase_timer.Start();
     state_.New().Relinearize(func);
+    best_is_last_linearization_ = false;
+    timing.linearize = phase_timer.Elapsed();
   }
 
   const Scalar new_error = state_.New().Error();
@@ -259,6 +284,7 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
       last_update_ = update_;
       if (state_.New().Error() <= state_.Best().Error()) {
         state_.SetBestToNew();
+        best_is_last_linearization_ = true;
         stats.best_index = stats.iterations.size() - 1;
       }
       // Ensure that we are not going to modify the Best state_ block in the next iteration
@@ -273,6 +299,9 @@ bool LevenbergMarquardtSolver<ScalarType, LinearSolverType>::Iterate(
     iteration_stats.update_accepted = accept_update;
   }
 
+  timing.total = iteration_timer.Elapsed();
+  iteration_stats.timing = timing;
+
   return should_early_exit;
 }
 
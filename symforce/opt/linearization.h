@@ -50,6 +50,10 @@ struct Linearization {
     return 0.5 * residual.squaredNorm();
   }
 
+  /**
+   * The error of the linear model of the residual after the update.  This is approximate for
+   * linearizations with robust losses applied by the Linearizer, see RobustLossWeights
+   */
   inline double LinearError(const VectorType& x_update) const {
     SYM_ASSERT(jacobian.cols() == x_update.size());
     const auto linear_residual_new = -jacobian * x_update + residual;
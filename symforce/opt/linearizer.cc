@@ -71,7 +71,8 @@ void Linearizer<ScalarType>::Relinearize(const Values<Scalar>& values,
         factor.Linearize(values, linearized_sparse_factor, &factor_indices_[i]);
 
         UpdateFromLinearizedSparseFactorIntoSparse(
-            linearized_sparse_factor, sparse_factor_update_helpers_.at(sparse_idx), linearization);
+            linearized_sparse_factor, sparse_factor_update_helpers_.at(sparse_idx),
+            ComputeRobustLossWeights(i, linearized_sparse_factor), linearization);
 
         ++sparse_idx;
       } else {
@@ -81,7 +82,8 @@ void Linearizer<ScalarType>::Relinearize(const Values<Scalar>& values,
         factor.Linearize(values, linearized_dense_factor, &factor_indices_[i]);
 
         UpdateFromLinearizedDenseFactorIntoSparse(
-            linearized_dense_factor, dense_factor_update_helpers_.at(dense_idx), linearization);
+            linearized_dense_factor, dense_factor_update_helpers_.at(dense_idx),
+            ComputeRobustLossWeights(i, linearized_dense_factor), linearization);
 
         ++dense_idx;
       }
@@ -95,6 +97,60 @@ void Linearizer<ScalarType>::Relinearize(const Values<Scalar>& values,
   }
 }
 
+template <typename ScalarType>
+void Linearizer<ScalarType>::SetRobustLosses(const std::vector<RobustLoss<Scalar>>& robust_losses) {
+  SYM_ASSERT(!IsInitialized());
+  SYM_ASSERT(robust_losses.size() == factors_->size());
+  robust_losses_ = robust_losses;
+}
+
+template <typename ScalarType>
+void Linearizer<ScalarType>::SetRobustLoss(const int factor_index,
+                                           const RobustLoss<Scalar>& robust_loss) {
+  SYM_ASSERT(!robust_losses_.empty());
+  robust_losses_.at(factor_index) = robust_loss;
+}
+
+template <typename ScalarType>
+const std::vector<RobustLoss<ScalarType>>& Linearizer<ScalarType>::RobustLosses() const {
+  return robust_losses_;
+}
+
+template <typename ScalarType>
+void Linearizer<ScalarType>::Reweight(Linearization<Scalar>& linearization) const {
+  SYM_ASSERT(IsInitialized());
+  // Without robust losses, the dense factors share temporaries and aren't kept
+  SYM_ASSERT(!robust_losses_.empty());
+  EnsureLinearizationHasCorrectSize(linearization);
+
+  // Zero out blocks that are built additively
+  linearization.rhs.setZero();
+  Eigen::Map<VectorX<Scalar>>(linearization.hessian_lower.valuePtr(),
+                              linearization.hessian_lower.nonZeros())
+      .setZero();
+
+  // Update from the kept linearized factors
+  size_t sparse_idx{0};
+  size_t dense_idx{0};
+  for (int i = 0; i < static_cast<int>(factors_->size()); i++) {
+    if ((*factors_)[i].IsSparse()) {
+      const auto& linearized_sparse_factor = linearized_sparse_factors_.at(sparse_idx);
+      UpdateFromLinearizedSparseFactorIntoSparse(
+          linearized_sparse_factor, sparse_factor_update_helpers_.at(sparse_idx),
+          ComputeRobustLossWeights(i, linearized_sparse_factor), linearization);
+      ++sparse_idx;
+    } else {
+      const auto& linearized_dense_factor = linearized_dense_factors_.at(dense_idx);
+      UpdateFromLinearizedDenseFactorIntoSparse(
+          linearized_dense_factor, dense_factor_update_helpers_.at(dense_idx),
+          ComputeRobustLossWeights(i, linearized_dense_factor), linearization);
+      ++dense_idx;
+    }
+  }
+
+  linearization.SetInitialized();
+}
+
 template <typename ScalarType>
 bool Linearizer<ScalarType>::IsInitialized() const {
   return initialized_;
@@ -158,8 +214,10 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
   // later
   LinearizedDenseFactor linearized_dense_factor{};
   size_t sparse_idx{0};
+  size_t dense_idx{0};
   factor_indices_.reserve(factors_->size());
-  for (const auto& factor : *factors_) {
+  for (int factor_idx = 0; factor_idx < static_cast<int>(factors_->size()); factor_idx++) {
+    const auto& factor = (*factors_)[factor_idx];
     factor_indices_.push_back(values.CreateIndex(factor.AllKeys()).entries);
 
     for (const auto& key : factor.OptimizedKeys()) {
@@ -179,13 +237,14 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
                                        include_jacobians_);
       sparse_factor_update_helpers_.push_back(std::move(helper_and_dimension.first));
       const auto& factor_helper = sparse_factor_update_helpers_.back();
+      const auto weights = ComputeRobustLossWeights(factor_idx, linearized_factor);
 
-      UpdateFromSparseFactorIntoTripletLists(linearized_factor, factor_helper, jacobian_triplets,
-                                             hessian_lower_triplets);
+      UpdateFromSparseFactorIntoTripletLists(linearized_factor, factor_helper, weights,
+                                             jacobian_triplets, hessian_lower_triplets);
 
       // Fill in the combined residual slice
       for (int res_i = 0; res_i < factor_helper.residual_dim; ++res_i) {
-        residual.push_back(linearized_factor.residual(res_i));
+        residual.push_back(weights.residual_scale * linearized_factor.residual(res_i));
       }
 
       // Add contribution from right-hand-side
@@ -193,15 +252,24 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
         const linearization_offsets_t& key_helper = factor_helper.key_helpers[key_i];
 
         init_linearization_.rhs.segment(key_helper.combined_offset, key_helper.tangent_dim) +=
+            weights.hessian_scale *
             linearized_factor.rhs.segment(key_helper.factor_offset, key_helper.tangent_dim);
       }
     } else {
       factor.Linearize(values, linearized_dense_factor, &factor_indices_.back());
 
-      // Make sure a temporary of the right dimension is kept for relinearizations
-      linearized_dense_factors_.AppendFactorSize(linearized_dense_factor.residual.rows(),
-                                                 linearized_dense_factor.rhs.rows(),
-                                                 dense_factor_size_tracker);
+      // Make sure a temporary of the right dimension is kept for relinearizations.  With robust
+      // losses every factor gets its own, which holds its linearization for Reweight.
+      if (robust_losses_.empty()) {
+        linearized_dense_factors_.AppendFactorSize(linearized_dense_factor.residual.rows(),
+                                                   linearized_dense_factor.rhs.rows(),
+                                                   dense_factor_size_tracker);
+      } else {
+        linearized_dense_factors_.AppendUniqueFactorSize(linearized_dense_factor.residual.rows(),
+                                                         linearized_dense_factor.rhs.rows());
+        linearized_dense_factors_.at(dense_idx) = linearized_dense_factor;
+      }
+      ++dense_idx;
 
       // Create dense factor helper
       auto helper_and_dimension =
@@ -213,14 +281,15 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
       dense_factor_update_helpers_.push_back(std::move(helper_and_dimension.first));
 
       const auto& factor_helper = dense_factor_update_helpers_.back();
+      const auto weights = ComputeRobustLossWeights(factor_idx, linearized_dense_factor);
 
       // Create dense factor triplets
-      UpdateFromDenseFactorIntoTripletLists(linearized_dense_factor, factor_helper,
+      UpdateFromDenseFactorIntoTripletLists(linearized_dense_factor, factor_helper, weights,
                                             jacobian_triplets, hessian_lower_triplets);
 
       // Fill in the combined residual slice
       for (int i = 0; i < factor_helper.residual_dim; i++) {
-        residual.push_back(linearized_dense_factor.residual(i));
+        residual.push_back(weights.residual_scale * linearized_dense_factor.residual(i));
       }
 
       // Add contributions from right-hand-side
@@ -228,6 +297,7 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
         const linearization_dense_key_helper_t& key_helper = factor_helper.key_helpers[key_i];
 
         init_linearization_.rhs.segment(key_helper.combined_offset, key_helper.tangent_dim) +=
+            weights.hessian_scale *
             linearized_dense_factor.rhs.segment(key_helper.factor_offset, key_helper.tangent_dim);
       }
     }
@@ -297,18 +367,29 @@ void Linearizer<ScalarType>::BuildInitialLinearization(const Values<Scalar>& val
   initialized_ = true;
 }
 
+template <typename ScalarType>
+template <typename LinearizedFactor>
+RobustLossWeights<ScalarType> Linearizer<ScalarType>::ComputeRobustLossWeights(
+    const int factor_index, const LinearizedFactor& linearized_factor) const {
+  if (robust_losses_.empty()) {
+    return {1, 1, 1};
+  }
+  return robust_losses_[factor_index].Weights(linearized_factor.residual.squaredNorm());
+}
+
 template <typename ScalarType>
 void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
     const LinearizedDenseFactor& linearized_factor,
     const linearization_dense_factor_helper_t& factor_helper,
-    Linearization<Scalar>& linearization) const {
+    const RobustLossWeights<Scalar>& weights, Linearization<Scalar>& linearization) const {
   // The residual dimension must be the same, even for factors that return VectorX.  If the residual
   // size changes, the optimizer must be re-created.
   SYM_ASSERT(factor_helper.residual_dim == linearized_factor.residual.size());
 
   // Fill in the combined residual slice
   linearization.residual.segment(factor_helper.combined_residual_offset,
-                                 factor_helper.residual_dim) = linearized_factor.residual;
+                                 factor_helper.residual_dim) =
+      weights.residual_scale * linearized_factor.residual;
 
   // For each key
   for (int key_i = 0; key_i < static_cast<int>(factor_helper.key_helpers.size()); ++key_i) {
@@ -320,6 +401,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
         Eigen::Map<VectorX<Scalar>>(
             linearization.jacobian.valuePtr() + key_helper.jacobian_storage_col_starts[col_block],
             factor_helper.residual_dim) =
+            weights.jacobian_scale *
             linearized_factor.jacobian.block(0, key_helper.factor_offset + col_block,
                                              factor_helper.residual_dim, 1);
       }
@@ -327,6 +409,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
 
     // Add contribution from right-hand-side
     linearization.rhs.segment(key_helper.combined_offset, key_helper.tangent_dim) +=
+        weights.hessian_scale *
         linearized_factor.rhs.segment(key_helper.factor_offset, key_helper.tangent_dim);
 
     // Add contribution from diagonal hessian block, column by column
@@ -335,6 +418,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
       Eigen::Map<VectorX<Scalar>>(
           linearization.hessian_lower.valuePtr() + diag_col_starts[col_block],
           key_helper.tangent_dim - col_block) +=
+          weights.hessian_scale *
           linearized_factor.hessian.block(key_helper.factor_offset + col_block,
                                           key_helper.factor_offset + col_block,
                                           key_helper.tangent_dim - col_block, 1);
@@ -352,6 +436,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
         for (int32_t col_j = 0; col_j < static_cast<int32_t>(col_starts.size()); ++col_j) {
           Eigen::Map<VectorX<Scalar>>(linearization.hessian_lower.valuePtr() + col_starts[col_j],
                                       key_helper.tangent_dim) +=
+              weights.hessian_scale *
               linearized_factor.hessian.block(key_helper.factor_offset,
                                               key_helper_j.factor_offset + col_j,
                                               key_helper.tangent_dim, 1);
@@ -360,6 +445,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedDenseFactorIntoSparse(
         for (int32_t col_i = 0; col_i < static_cast<int32_t>(col_starts.size()); ++col_i) {
           Eigen::Map<VectorX<Scalar>>(linearization.hessian_lower.valuePtr() + col_starts[col_i],
                                       key_helper_j.tangent_dim) +=
+              weights.hessian_scale *
               linearized_factor.hessian
                   .block(key_helper.factor_offset + col_i, key_helper_j.factor_offset, 1,
                          key_helper_j.tangent_dim)
@@ -374,20 +460,22 @@ template <typename ScalarType>
 void Linearizer<ScalarType>::UpdateFromLinearizedSparseFactorIntoSparse(
     const LinearizedSparseFactor& linearized_factor,
     const linearization_sparse_factor_helper_t& factor_helper,
-    Linearization<Scalar>& linearization) const {
+    const RobustLossWeights<Scalar>& weights, Linearization<Scalar>& linearization) const {
   // The residual dimension must be the same, even for factors that return VectorX.  If the residual
   // size changes, the optimizer must be re-created.
   SYM_ASSERT(factor_helper.residual_dim == linearized_factor.residual.size());
 
   // Fill in the combined residual slice
   linearization.residual.segment(factor_helper.combined_residual_offset,
-                                 factor_helper.residual_dim) = linearized_factor.residual;
+                                 factor_helper.residual_dim) =
+      weights.residual_scale * linearized_factor.residual;
 
   // Add contribution from right-hand-side
   for (int key_i = 0; key_i < static_cast<int>(factor_helper.key_helpers.size()); ++key_i) {
     const linearization_offsets_t& key_helper = factor_helper.key_helpers[key_i];
 
     linearization.rhs.segment(key_helper.combined_offset, key_helper.tangent_dim) +=
+        weights.hessian_scale *
         linearized_factor.rhs.segment(key_helper.factor_offset, key_helper.tangent_dim);
   }
 
@@ -397,7 +485,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedSparseFactorIntoSparse(
                static_cast<size_t>(linearized_factor.jacobian.nonZeros()));
     for (int i = 0; i < static_cast<int>(factor_helper.jacobian_index_map.size()); i++) {
       linearization.jacobian.valuePtr()[factor_helper.jacobian_index_map[i]] =
-          linearized_factor.jacobian.valuePtr()[i];
+          weights.jacobian_scale * linearized_factor.jacobian.valuePtr()[i];
     }
   }
 
@@ -406,7 +494,7 @@ void Linearizer<ScalarType>::UpdateFromLinearizedSparseFactorIntoSparse(
              static_cast<size_t>(linearized_factor.hessian.nonZeros()));
   for (int i = 0; i < static_cast<int>(factor_helper.hessian_index_map.size()); i++) {
     linearization.hessian_lower.valuePtr()[factor_helper.hessian_index_map[i]] +=
-        linearized_factor.hessian.valuePtr()[i];
+        weights.hessian_scale * linearized_factor.hessian.valuePtr()[i];
   }
 }
 
@@ -414,17 +502,18 @@ template <typename ScalarType>
 void Linearizer<ScalarType>::UpdateFromDenseFactorIntoTripletLists(
     const LinearizedDenseFactor& linearized_factor,
     const linearization_dense_factor_helper_t& factor_helper,
+    const RobustLossWeights<Scalar>& weights,
     std::vector<Eigen::Triplet<Scalar>>& jacobian_triplets,
     std::vector<Eigen::Triplet<Scalar>>& hessian_lower_triplets) const {
   const auto update_triplets_from_blocks =
       [](const int rows, const int cols, const int lhs_row_start, const int lhs_col_start,
          const bool lower_triangle_only, std::vector<Eigen::Triplet<Scalar>>& triplets,
-         Eigen::Ref<const MatrixX<ScalarType>> block) {
+         const Scalar scale, Eigen::Ref<const MatrixX<ScalarType>> block) {
         for (int block_row = 0; block_row < rows; block_row++) {
           for (int block_col = 0; block_col < (lower_triangle_only ? block_row + 1 : cols);
                block_col++) {
             triplets.emplace_back(lhs_row_start + block_row, lhs_col_start + block_col,
-                                  block(block_row, block_col));
+                                  scale * block(block_row, block_col));
           }
         }
       };
@@ -438,7 +527,7 @@ void Linearizer<ScalarType>::UpdateFromDenseFactorIntoTripletLists(
       update_triplets_from_blocks(
           factor_helper.residual_dim, key_helper.tangent_dim,
           factor_helper.combined_residual_offset, key_helper.combined_offset, false,
-          jacobian_triplets,
+          jacobian_triplets, weights.jacobian_scale,
           linearized_factor.jacobian.block(0, key_helper.factor_offset, factor_helper.residual_dim,
                                            key_helper.tangent_dim));
     }
@@ -446,7 +535,7 @@ void Linearizer<ScalarType>::UpdateFromDenseFactorIntoTripletLists(
     // Add contribution from diagonal hessian block
     update_triplets_from_blocks(
         key_helper.tangent_dim, key_helper.tangent_dim, key_helper.combined_offset,
-        key_helper.combined_offset, true, hessian_lower_triplets,
+        key_helper.combined_offset, true, hessian_lower_triplets, weights.hessian_scale,
         linearized_factor.hessian.block(key_helper.factor_offset, key_helper.factor_offset,
                                         key_helper.tangent_dim, key_helper.tangent_dim));
 
@@ -459,13 +548,13 @@ void Linearizer<ScalarType>::UpdateFromDenseFactorIntoTripletLists(
       if (key_helper.combined_offset > key_helper_j.combined_offset) {
         update_triplets_from_blocks(
             key_helper.tangent_dim, key_helper_j.tangent_dim, key_helper.combined_offset,
-            key_helper_j.combined_offset, false, hessian_lower_triplets,
+            key_helper_j.combined_offset, false, hessian_lower_triplets, weights.hessian_scale,
             linearized_factor.hessian.block(key_helper.factor_offset, key_helper_j.factor_offset,
                                             key_helper.tangent_dim, key_helper_j.tangent_dim));
       } else {
         update_triplets_from_blocks(key_helper_j.tangent_dim, key_helper.tangent_dim,
                                     key_helper_j.combined_offset, key_helper.combined_offset, false,
-                                    hessian_lower_triplets,
+                                    hessian_lower_triplets, weights.hessian_scale,
                                     linearized_factor.hessian
                                         .block(key_helper.factor_offset, key_helper_j.factor_offset,
                                                key_helper.tangent_dim, key_helper_j.tangent_dim)
@@ -479,6 +568,7 @@ template <typename ScalarType>
 void Linearizer<ScalarType>::UpdateFromSparseFactorIntoTripletLists(
     const LinearizedSparseFactor& linearized_factor,
     const linearization_sparse_factor_helper_t& factor_helper,
+    const RobustLossWeights<Scalar>& weights,
     std::vector<Eigen::Triplet<Scalar>>& jacobian_triplets,
     std::vector<Eigen::Triplet<Scalar>>& hessian_lower_triplets) const {
   std::vector<int> key_for_factor_offset;
@@ -501,7 +591,7 @@ void Linearizer<ScalarType>::UpdateFromSparseFactorIntoTripletLists(
         const auto& key_helper = factor_helper.key_helpers[key_for_factor_offset[col]];
         const auto problem_col = col - key_helper.factor_offset + key_helper.combined_offset;
         jacobian_triplets.emplace_back(row + factor_helper.combined_residual_offset, problem_col,
-                                       it.value());
+                                       weights.jacobian_scale * it.value());
       }
     }
   }
@@ -521,9 +611,11 @@ void Linearizer<ScalarType>::UpdateFromSparseFactorIntoTripletLists(
       // entry might naively go into the upper triangle if the key order is reversed in the full
       // problem
       if (problem_row >= problem_col) {
-        hessian_lower_triplets.emplace_back(problem_row, problem_col, it.value());
+        hessian_lower_triplets.emplace_back(problem_row, problem_col,
+                                            weights.hessian_scale * it.value());
       } else {
-        hessian_lower_triplets.emplace_back(problem_col, problem_row, it.value());
+        hessian_lower_triplets.emplace_back(problem_col, problem_row,
+                                            weights.hessian_scale * it.value());
       }
     }
   }
@@ -13,6 +13,7 @@
 #include "./factor.h"
 #include "./internal/linearized_dense_factor_pool.h"
 #include "./linearization.h"
+#include "./robust_loss.h"
 #include "./values.h"
 
 namespace sym {
@@ -54,6 +55,33 @@ class Linearizer {
    */
   void Relinearize(const Values<Scalar>& values, Linearization<Scalar>& linearization);
 
+  /**
+   * Set a robust loss for each factor, in the same order as the factors, which is applied to the
+   * whitened residual of the factor during assembly (see RobustLoss).  Must be called before the
+   * first linearization, since the linearizer then keeps the linearization of every factor so that
+   * it can be reweighted.  The residual is scaled to give the robust cost, and the jacobian to give
+   * the reweighted hessian, so the jacobian and residual are not consistent with the rhs (see
+   * RobustLossWeights).
+   */
+  void SetRobustLosses(const std::vector<RobustLoss<Scalar>>& robust_losses);
+
+  /**
+   * Replace the robust loss of a single factor, e.g. to step its parameters.  Requires that the
+   * losses were set with SetRobustLosses.  Takes effect on the next Relinearize or Reweight.
+   */
+  void SetRobustLoss(int factor_index, const RobustLoss<Scalar>& robust_loss);
+
+  /**
+   * The robust losses of the factors, or empty if they haven't been set
+   */
+  const std::vector<RobustLoss<Scalar>>& RobustLosses() const;
+
+  /**
+   * Update linearization with the current robust losses, at the evaluation point of the last call
+   * to Relinearize, without re-evaluating the factors.
+   */
+  void Reweight(Linearization<Scalar>& linearization) const;
+
   /**
    * Whether this contains values, versus having not been evaluated yet
    */
@@ -79,29 +107,38 @@ class Linearizer {
   void BuildInitialLinearization(const Values<Scalar>& values);
 
   /**
-   * Update the sparse combined problem linearization from a single factor.
+   * The scales applied to the factor_index'th factor by its robust loss, if any
+   */
+  template <typename LinearizedFactor>
+  RobustLossWeights<Scalar> ComputeRobustLossWeights(
+      int factor_index, const LinearizedFactor& linearized_factor) const;
+
+  /**
+   * Update the sparse combined problem linearization from a single factor, scaled by weights.
    */
   void UpdateFromLinearizedDenseFactorIntoSparse(
       const LinearizedDenseFactor& linearized_factor,
       const linearization_dense_factor_helper_t& factor_helper,
-      Linearization<Scalar>& linearization) const;
+      const RobustLossWeights<Scalar>& weights, Linearization<Scalar>& linearization) const;
   void UpdateFromLinearizedSparseFactorIntoSparse(
       const LinearizedSparseFactor& linearized_factor,
       const linearization_sparse_factor_helper_t& factor_helper,
-      Linearization<Scalar>& linearization) const;
+      const RobustLossWeights<Scalar>& weights, Linearization<Scalar>& linearization) const;
 
   /**
    * Update the combined residual and rhs, along with triplet lists for the sparse matrices, from a
-   * single factor
+   * single factor, scaled by weights
    */
   void UpdateFromDenseFactorIntoTripletLists(
       const LinearizedDenseFactor& linearized_factor,
       const linearization_dense_factor_helper_t& factor_helper,
+      const RobustLossWeights<Scalar>& weights,
       std::vector<Eigen::Triplet<Scalar>>& jacobian_triplets,
       std::vector<Eigen::Triplet<Scalar>>& hessian_lower_triplets) const;
   void UpdateFromSparseFactorIntoTripletLists(
       const LinearizedSparseFactor& linearized_factor,
       const linearization_sparse_factor_helper_t& factor_helper,
+      const RobustLossWeights<Scalar>& weights,
       std::vector<Eigen::Triplet<Scalar>>& jacobian_triplets,
       std::vector<Eigen::Triplet<Scalar>>& hessian_lower_triplets) const;
 
@@ -128,6 +165,10 @@ class Linearizer {
   internal::LinearizedDenseFactorPool<Scalar> linearized_dense_factors_;  // one per Jacobian shape
   std::vector<LinearizedSparseFactor> linearized_sparse_factors_;         // one per sparse factor
 
+  // Robust loss of each factor, or empty for none.  If set, the dense factor pool has a separate
+  // linearized factor for every dense factor, so that the linearization can be reweighted.
+  std::vector<RobustLoss<Scalar>> robust_losses_;
+
   // Keys that form the state vector
   std::vector<Key> keys_;
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <lcmtypes/sym/optimization_iteration_t.hpp>
+#include <lcmtypes/sym/optimization_iteration_timing_t.hpp>
 #include <lcmtypes/sym/optimization_stats_t.hpp>
 
 #include "./linearization.h"
@@ -36,6 +37,21 @@ struct OptimizationStats {
   Eigen::VectorXi linear_solver_ordering;
   sparse_matrix_structure_t cholesky_factor_sparsity;
 
+  // Sum of the phase timings of all iterations, including the initial linearization.  All zeros
+  // unless the optimizer params have record_timing = true.
+  optimization_iteration_timing_t TotalTiming() const {
+    optimization_iteration_timing_t total{};
+    for (const auto& iteration : iterations) {
+      total.damp_hessian += iteration.timing.damp_hessian;
+      total.sparse_factorize += iteration.timing.sparse_factorize;
+      total.sparse_solve += iteration.timing.sparse_solve;
+      total.update += iteration.timing.update;
+      total.linearize += iteration.timing.linearize;
+      total.total += iteration.timing.total;
+    }
+    return total;
+  }
+
   optimization_stats_t GetLcmType() const {
     return optimization_stats_t(iterations, best_index, early_exited, jacobian_sparsity,
                                 linear_solver_ordering, cholesky_factor_sparsity);
@@ -19,6 +19,7 @@ sym::optimizer_params_t sym::DefaultOptimizerParams() {
   const int iterations = 50;
   const double early_exit_min_reduction = 1e-6;
   const bool enable_bold_updates = false;
+  const bool record_timing = false;
 
   return sym::optimizer_params_t{
       verbose,
@@ -34,6 +35,7 @@ sym::optimizer_params_t sym::DefaultOptimizerParams() {
       iterations,
       early_exit_min_reduction,
       enable_bold_updates,
+      record_timing,
   };
 }
 
@@ -105,6 +105,7 @@ class Optimizer:
         iterations: int = 50
         early_exit_min_reduction: float = 1e-6
         enable_bold_updates: bool = False
+        record_timing: bool = False
 
     @dataclass
     class Result:
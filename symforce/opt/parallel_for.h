@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "./assert.h"
+
+namespace sym {
+
+/**
+ * Calls func(begin, end) for consecutive blocks [begin, end) of at most block_size indices which
+ * cover [0, count), spread across num_threads threads, and returns once every block is done.
+ *
+ * Blocks are handed out to threads one at a time as they finish the previous one, so uneven work
+ * per block is balanced.  The calling thread is one of the num_threads threads.  If num_threads is
+ * 0, uses std::thread::hardware_concurrency().  func must be safe to call concurrently on disjoint
+ * blocks, and must not throw.
+ *
+ * This is the driver for the kernels generated with CppConfig(generate_kernel=True), e.g. for
+ * arguments with storage dimensions in SoA arrays of stride count:
+ *
+ *     sym::ParallelForBlocks(count, [&](const size_t begin, const size_t end) {
+ *       ReprojectionErrorKernel<double>(end - begin, count, cam_T_world.data() + begin, cal.data(),
+ *                                       point.data() + begin, pixel.data() + begin, &epsilon,
+ *                                       error.data() + begin);
+ *     });
+ *
+ * Blocks should be large enough that the time to hand one out is negligible, but small enough that
+ * the blocks' data fits in cache.
+ */
+template <typename Func>
+void ParallelForBlocks(const size_t count, Func&& func, const size_t block_size = 4096,
+                       const int num_threads = 0) {
+  SYM_ASSERT(block_size > 0);
+  SYM_ASSERT(num_threads >= 0);
+
+  const size_t num_blocks = (count + block_size - 1) / block_size;
+  const size_t requested_threads =
+      num_threads > 0 ? num_threads : std::max(std::thread::hardware_concurrency(), 1u);
+  const size_t num_workers = std::min(requested_threads, num_blocks);
+
+  std::atomic<size_t> next_block{0};
+  const auto worker = [&]() {
+    for (size_t block = next_block++; block < num_blocks; block = next_block++) {
+      const size_t begin = block * block_size;
+      func(begin, std::min(begin + block_size, count));
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers > 0 ? num_workers - 1 : 0);
+  for (size_t i = 1; i < num_workers; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace sym
@@ -0,0 +1,342 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include "./problem_snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "./assert.h"
+
+namespace sym {
+
+namespace {
+
+constexpr std::array<char, 8> kSnapshotMagic = {'S', 'Y', 'M', 'S', 'N', 'A', 'P', '\1'};
+
+// Alignment of the sections of the file
+constexpr size_t kSectionAlignment = 64;
+
+struct SnapshotHeader {
+  std::array<char, 8> magic;
+  uint64_t scalar_size;
+  uint64_t num_entries;
+  uint64_t data_size;
+  uint64_t num_factors;
+  uint64_t index_offset;
+  uint64_t data_offset;
+  uint64_t factors_offset;
+  uint64_t file_size;
+};
+
+struct KeyRecord {
+  int64_t sub;
+  int64_t super;
+  char letter;
+  std::array<char, 7> padding;
+};
+
+struct FactorRecordHeader {
+  uint32_t function_id_size;
+  uint32_t num_keys_to_func;
+  uint32_t num_keys_to_optimize;
+  uint32_t padding;
+};
+
+KeyRecord ToRecord(const Key& key) {
+  KeyRecord record{};
+  record.sub = key.Sub();
+  record.super = key.Super();
+  record.letter = key.Letter();
+  return record;
+}
+
+Key FromRecord(const KeyRecord& record) {
+  return Key(record.letter, record.sub, record.super);
+}
+
+size_t Align(const size_t offset) {
+  return (offset + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+void WritePadding(std::ofstream& file, const size_t offset) {
+  const std::array<char, kSectionAlignment> zeros{};
+  file.write(zeros.data(), Align(offset) - offset);
+}
+
+}  // namespace
+
+namespace internal {
+
+struct SnapshotIndexRecord {
+  KeyRecord key;
+  int32_t type;
+  int32_t offset;
+  int32_t storage_dim;
+  int32_t tangent_dim;
+};
+
+}  // namespace internal
+
+namespace {
+
+using internal::SnapshotIndexRecord;
+
+index_entry_t ToIndexEntry(const SnapshotIndexRecord& record) {
+  index_entry_t entry;
+  entry.key = FromRecord(record.key).GetLcmType();
+  entry.type = type_t::from_int(record.type);
+  entry.offset = record.offset;
+  entry.storage_dim = record.storage_dim;
+  entry.tangent_dim = record.tangent_dim;
+  return entry;
+}
+
+}  // namespace
+
+template <typename Scalar>
+void WriteProblemSnapshot(const std::string& filename, const Values<Scalar>& values,
+                          const std::vector<FactorDescription>& factors) {
+  std::vector<SnapshotIndexRecord> index;
+  index.reserve(values.NumEntries());
+  for (const auto& it : values.Items()) {
+    index.push_back({ToRecord(it.first), it.second.type.int_value(),
+                     it.second.offset, it.second.storage_dim, it.second.tangent_dim});
+  }
+  // Sorted so ProblemSnapshot can look keys up with a binary search
+  std::sort(index.begin(), index.end(),
+            [](const SnapshotIndexRecord& a, const SnapshotIndexRecord& b) {
+              return Key::LexicalLessThan(FromRecord(a.key), FromRecord(b.key));
+            });
+
+  SnapshotHeader header{};
+  header.magic = kSnapshotMagic;
+  header.scalar_size = sizeof(Scalar);
+  header.num_entries = index.size();
+  header.data_size = values.Data().size();
+  header.num_factors = factors.size();
+  header.index_offset = Align(sizeof(SnapshotHeader));
+  header.data_offset = Align(header.index_offset + index.size() * sizeof(SnapshotIndexRecord));
+  header.factors_offset = Align(header.data_offset + header.data_size * sizeof(Scalar));
+
+  std::ofstream file(filename, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  WritePadding(file, sizeof(header));
+  file.write(reinterpret_cast<const char*>(index.data()),
+             index.size() * sizeof(SnapshotIndexRecord));
+  WritePadding(file, header.index_offset + index.size() * sizeof(SnapshotIndexRecord));
+  file.write(reinterpret_cast<const char*>(values.Data().data()),
+             header.data_size * sizeof(Scalar));
+  WritePadding(file, header.data_offset + header.data_size * sizeof(Scalar));
+
+  size_t offset = header.factors_offset;
+  const auto write_keys = [&](const std::vector<Key>& keys) {
+    for (const Key& key : keys) {
+      const KeyRecord record = ToRecord(key);
+      file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+    offset += keys.size() * sizeof(KeyRecord);
+  };
+  for (const FactorDescription& factor : factors) {
+    const FactorRecordHeader factor_header{static_cast<uint32_t>(factor.function_id.size()),
+                                           static_cast<uint32_t>(factor.keys_to_func.size()),
+                                           static_cast<uint32_t>(factor.keys_to_optimize.size()),
+                                           0};
+    file.write(reinterpret_cast<const char*>(&factor_header), sizeof(factor_header));
+    write_keys(factor.keys_to_func);
+    write_keys(factor.keys_to_optimize);
+    file.write(factor.function_id.data(), factor.function_id.size());
+    offset += sizeof(factor_header) + factor.function_id.size();
+    // Keep the next factor's records aligned
+    const std::array<char, 8> zeros{};
+    file.write(zeros.data(), (8 - offset % 8) % 8);
+    offset += (8 - offset % 8) % 8;
+  }
+
+  // Write the final size into the header, so truncated files can be detected
+  header.file_size = offset;
+  file.seekp(0);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (!file) {
+    throw std::runtime_error(fmt::format("Could not write {}", filename));
+  }
+}
+
+template <typename Scalar>
+ProblemSnapshot<Scalar>::ProblemSnapshot(const std::string& filename) {
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format("Could not open {}", filename));
+  }
+  struct stat file_stat;
+  const bool stat_failed = fstat(fd, &file_stat) != 0;
+  mapped_size_ = stat_failed ? 0 : static_cast<size_t>(file_stat.st_size);
+  if (mapped_size_ < sizeof(SnapshotHeader)) {
+    close(fd);
+    throw std::runtime_error(fmt::format("{} is not a problem snapshot", filename));
+  }
+  void* const mapped = mmap(nullptr, mapped_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error(fmt::format("Could not mmap {}", filename));
+  }
+  mapped_ = static_cast<const char*>(mapped);
+
+  SnapshotHeader header;
+  std::memcpy(&header, mapped_, sizeof(header));
+  // The counts are checked against the file size first, so the offsets computed from them can't
+  // overflow.  Each factor takes at least the size of its header.
+  const bool valid =
+      header.magic == kSnapshotMagic && header.scalar_size == sizeof(Scalar) &&
+      header.file_size == mapped_size_ &&
+      header.num_entries <= mapped_size_ / sizeof(SnapshotIndexRecord) &&
+      header.data_size <= mapped_size_ / sizeof(Scalar) && header.index_offset <= mapped_size_ &&
+      header.index_offset + header.num_entries * sizeof(SnapshotIndexRecord) <=
+          header.data_offset &&
+      header.data_offset + header.data_size * sizeof(Scalar) <= header.factors_offset &&
+      header.factors_offset <= header.file_size &&
+      header.num_factors <=
+          (header.file_size - header.factors_offset) / sizeof(FactorRecordHeader);
+  if (!valid) {
+    munmap(const_cast<char*>(mapped_), mapped_size_);
+    throw std::runtime_error(fmt::format(
+        "{} is not a problem snapshot with {} byte Scalars, or is truncated", filename,
+        sizeof(Scalar)));
+  }
+
+  index_ = reinterpret_cast<const SnapshotIndexRecord*>(mapped_ + header.index_offset);
+  num_entries_ = header.num_entries;
+  data_ = reinterpret_cast<const Scalar*>(mapped_ + header.data_offset);
+  data_size_ = header.data_size;
+
+  // Parse the factor descriptions, which are small compared to the data
+  size_t offset = header.factors_offset;
+  const auto fail = [&]() {
+    munmap(const_cast<char*>(mapped_), mapped_size_);
+    throw std::runtime_error(fmt::format("{} has corrupted factors", filename));
+  };
+  const auto read = [&](void* const dest, const size_t size) {
+    if (size > mapped_size_ - offset) {
+      fail();
+    }
+    std::memcpy(dest, mapped_ + offset, size);
+    offset += size;
+  };
+  const auto read_keys = [&](const size_t num_keys, std::vector<Key>* const keys) {
+    // Checked before reserving, so a corrupted count can't allocate more than the file holds
+    if (num_keys > (mapped_size_ - offset) / sizeof(KeyRecord)) {
+      fail();
+    }
+    keys->reserve(num_keys);
+    for (size_t i = 0; i < num_keys; i++) {
+      KeyRecord record;
+      read(&record, sizeof(record));
+      keys->push_back(FromRecord(record));
+    }
+  };
+  factors_.resize(header.num_factors);
+  for (FactorDescription& factor : factors_) {
+    FactorRecordHeader factor_header;
+    read(&factor_header, sizeof(factor_header));
+    read_keys(factor_header.num_keys_to_func, &factor.keys_to_func);
+    read_keys(factor_header.num_keys_to_optimize, &factor.keys_to_optimize);
+    if (factor_header.function_id_size > mapped_size_ - offset) {
+      fail();
+    }
+    factor.function_id.resize(factor_header.function_id_size);
+    read(&factor.function_id[0], factor_header.function_id_size);
+    offset = std::min(offset + (8 - offset % 8) % 8, mapped_size_);
+  }
+}
+
+template <typename Scalar>
+ProblemSnapshot<Scalar>::~ProblemSnapshot() {
+  munmap(const_cast<char*>(mapped_), mapped_size_);
+}
+
+template <typename Scalar>
+size_t ProblemSnapshot<Scalar>::NumEntries() const {
+  return num_entries_;
+}
+
+template <typename Scalar>
+const SnapshotIndexRecord* ProblemSnapshot<Scalar>::Find(const Key& key) const {
+  const SnapshotIndexRecord* const end = index_ + num_entries_;
+  const SnapshotIndexRecord* const it = std::lower_bound(
+      index_, end, key, [](const SnapshotIndexRecord& record, const Key& key) {
+        return Key::LexicalLessThan(FromRecord(record.key), key);
+      });
+  return it != end && FromRecord(it->key) == key ? it : nullptr;
+}
+
+template <typename Scalar>
+bool ProblemSnapshot<Scalar>::Has(const Key& key) const {
+  return Find(key) != nullptr;
+}
+
+template <typename Scalar>
+index_entry_t ProblemSnapshot<Scalar>::IndexEntryAt(const Key& key) const {
+  const SnapshotIndexRecord* const record = Find(key);
+  if (record == nullptr) {
+    throw std::runtime_error(fmt::format("Key not found: {}", key));
+  }
+  return ToIndexEntry(*record);
+}
+
+template <typename Scalar>
+const Scalar* ProblemSnapshot<Scalar>::Data() const {
+  return data_;
+}
+
+template <typename Scalar>
+size_t ProblemSnapshot<Scalar>::DataSize() const {
+  return data_size_;
+}
+
+template <typename Scalar>
+Values<Scalar> ProblemSnapshot<Scalar>::GetValues() const {
+  typename Values<Scalar>::MapType map;
+  map.reserve(num_entries_);
+  for (size_t i = 0; i < num_entries_; i++) {
+    map.emplace(FromRecord(index_[i].key), ToIndexEntry(index_[i]));
+  }
+  return Values<Scalar>(std::move(map),
+                        typename Values<Scalar>::ArrayType(data_, data_ + data_size_));
+}
+
+template <typename Scalar>
+const std::vector<FactorDescription>& ProblemSnapshot<Scalar>::FactorDescriptions() const {
+  return factors_;
+}
+
+template <typename Scalar>
+std::vector<Factor<Scalar>> ProblemSnapshot<Scalar>::CreateFactors(
+    const FactorRegistry<Scalar>& registry) const {
+  std::vector<Factor<Scalar>> factors;
+  factors.reserve(factors_.size());
+  for (const FactorDescription& description : factors_) {
+    factors.push_back(registry.Create(description));
+  }
+  return factors;
+}
+
+}  // namespace sym
+
+template void sym::WriteProblemSnapshot<double>(const std::string& filename,
+                                                const sym::Values<double>& values,
+                                                const std::vector<sym::FactorDescription>& factors);
+template void sym::WriteProblemSnapshot<float>(const std::string& filename,
+                                               const sym::Values<float>& values,
+                                               const std::vector<sym::FactorDescription>& factors);
+template class sym::ProblemSnapshot<double>;
+template class sym::ProblemSnapshot<float>;
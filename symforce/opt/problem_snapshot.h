@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <sym/util/type_ops.h>
+
+#include "./factor.h"
+#include "./key.h"
+#include "./values.h"
+
+namespace sym {
+
+namespace internal {
+
+// The format of an index entry in a problem snapshot file
+struct SnapshotIndexRecord;
+
+}  // namespace internal
+
+/**
+ * Description of a factor that can be saved in a problem snapshot: the ID that the function it was
+ * created from is registered with in a FactorRegistry, and the keys it was created with.
+ */
+struct FactorDescription {
+  std::string function_id;
+  std::vector<Key> keys_to_func;
+  std::vector<Key> keys_to_optimize;
+};
+
+/**
+ * Registry of the functions that factors are created from, by ID.
+ *
+ * A Factor holds std::functions, so can't be serialized.  Instead, problem snapshots store a
+ * FactorDescription of each factor, and the factors are recreated from the same registry when
+ * loading the snapshot, e.g.:
+ *
+ *     sym::FactorRegistryd registry;
+ *     registry.RegisterHessian("between_pose3", sym::BetweenFactorPose3<double>);
+ */
+template <typename Scalar>
+class FactorRegistry {
+ public:
+  using Builder = std::function<Factor<Scalar>(const std::vector<Key>& keys_to_func,
+                                               const std::vector<Key>& keys_to_optimize)>;
+
+  /**
+   * Register a function which creates factors from their keys.  Throws if function_id is already
+   * registered.
+   */
+  void Register(const std::string& function_id, Builder builder) {
+    if (!builders_.emplace(function_id, std::move(builder)).second) {
+      throw std::runtime_error(fmt::format("Factor function {} already registered", function_id));
+    }
+  }
+
+  /**
+   * Register a function to create factors from with Factor::Hessian
+   */
+  template <typename Functor>
+  void RegisterHessian(const std::string& function_id, Functor func) {
+    Register(function_id, [func](const std::vector<Key>& keys_to_func,
+                                 const std::vector<Key>& keys_to_optimize) {
+      return Factor<Scalar>::Hessian(Functor(func), keys_to_func, keys_to_optimize);
+    });
+  }
+
+  /**
+   * Register a function to create factors from with Factor::Jacobian
+   */
+  template <typename Functor>
+  void RegisterJacobian(const std::string& function_id, Functor func) {
+    Register(function_id, [func](const std::vector<Key>& keys_to_func,
+                                 const std::vector<Key>& keys_to_optimize) {
+      return Factor<Scalar>::Jacobian(Functor(func), keys_to_func, keys_to_optimize);
+    });
+  }
+
+  bool Has(const std::string& function_id) const {
+    return builders_.count(function_id) > 0;
+  }
+
+  /**
+   * Create the described factor.  Throws if its function isn't registered.
+   */
+  Factor<Scalar> Create(const FactorDescription& description) const {
+    const auto it = builders_.find(description.function_id);
+    if (it == builders_.end()) {
+      throw std::runtime_error(
+          fmt::format("Factor function {} is not registered", description.function_id));
+    }
+    return it->second(description.keys_to_func, description.keys_to_optimize);
+  }
+
+ private:
+  std::unordered_map<std::string, Builder> builders_;
+};
+
+/**
+ * Write a problem snapshot, which ProblemSnapshot can load, with the given values and factors.
+ *
+ * The file holds the index of the values, sorted by key, their data buffer as is, and the
+ * descriptions of the factors.  It is native-endian, and specific to the Scalar type.
+ *
+ * Throws std::runtime_error if the file can't be written.
+ */
+template <typename Scalar>
+void WriteProblemSnapshot(const std::string& filename, const Values<Scalar>& values,
+                          const std::vector<FactorDescription>& factors);
+
+/**
+ * A problem snapshot written by WriteProblemSnapshot, e.g. to replay a failing optimization
+ * offline.
+ *
+ * This is a copy-on-load format for replay.  The file is memory-mapped, so opening even a very
+ * large snapshot only reads the index and factor descriptions, and Has, At, and Data read the
+ * mapped data lazily without copying it.  Replaying the problem needs a Values, though, which
+ * always owns its data buffer, so GetValues copies the whole data buffer into a new Values.  It
+ * does so in one block, and reuses the saved index instead of adding the entries one at a time,
+ * but the time to start replaying still grows with the size of the data, at the speed of a
+ * memcpy from the file.
+ *
+ * Code that only inspects a few values of a large snapshot should use At or Data instead of
+ * GetValues.
+ */
+template <typename Scalar>
+class ProblemSnapshot {
+ public:
+  /**
+   * Map the snapshot in filename.  Throws std::runtime_error if it can't be read or isn't a
+   * snapshot for this Scalar type.
+   */
+  explicit ProblemSnapshot(const std::string& filename);
+  ~ProblemSnapshot();
+
+  ProblemSnapshot(const ProblemSnapshot&) = delete;
+  ProblemSnapshot& operator=(const ProblemSnapshot&) = delete;
+
+  /**
+   * Number of keys in the values.
+   */
+  size_t NumEntries() const;
+
+  /**
+   * Return whether the key exists in the values.
+   */
+  bool Has(const Key& key) const;
+
+  /**
+   * Retrieve the index entry for a key in the values, which is an offset into Data().  Throws if
+   * the key doesn't exist.
+   */
+  index_entry_t IndexEntryAt(const Key& key) const;
+
+  /**
+   * Retrieve a value by key, directly from the mapped data buffer.  Throws if the key doesn't
+   * exist, has a different type, or its entry is outside of the data buffer.
+   */
+  template <typename T>
+  T At(const Key& key) const;
+
+  /**
+   * The data buffer of the values, in the mapped file.
+   */
+  const Scalar* Data() const;
+  size_t DataSize() const;
+
+  /**
+   * The values, with their own copy of the data buffer, e.g. to replay the problem.  This reads
+   * and copies all of the data, see the class comment.
+   */
+  Values<Scalar> GetValues() const;
+
+  const std::vector<FactorDescription>& FactorDescriptions() const;
+
+  /**
+   * Create the factors from their descriptions.  Throws if any of their functions aren't
+   * registered.
+   */
+  std::vector<Factor<Scalar>> CreateFactors(const FactorRegistry<Scalar>& registry) const;
+
+ private:
+  // The entry for key in the index, or nullptr if there isn't one
+  const internal::SnapshotIndexRecord* Find(const Key& key) const;
+
+  const char* mapped_{nullptr};
+  size_t mapped_size_{0};
+
+  const internal::SnapshotIndexRecord* index_{nullptr};
+  size_t num_entries_{0};
+  const Scalar* data_{nullptr};
+  size_t data_size_{0};
+  std::vector<FactorDescription> factors_;
+};
+
+template <typename Scalar>
+template <typename T>
+T ProblemSnapshot<Scalar>::At(const Key& key) const {
+  const index_entry_t entry = IndexEntryAt(key);
+  const type_t type = StorageOps<T>::TypeEnum();
+  if (entry.type != type) {
+    throw std::runtime_error(
+        fmt::format("Mismatched types; index entry is type {}, T is {}", entry.type, type));
+  }
+  if (entry.offset < 0 ||
+      static_cast<size_t>(entry.offset) + StorageOps<T>::StorageDim() > data_size_) {
+    throw std::runtime_error(fmt::format("Index entry for {} at offset {} is outside of the data",
+                                         key, entry.offset));
+  }
+  return StorageOps<T>::FromStorage(data_ + entry.offset);
+}
+
+using FactorRegistryd = FactorRegistry<double>;
+using FactorRegistryf = FactorRegistry<float>;
+using ProblemSnapshotd = ProblemSnapshot<double>;
+using ProblemSnapshotf = ProblemSnapshot<float>;
+
+}  // namespace sym
+
+extern template void sym::WriteProblemSnapshot<double>(
+    const std::string& filename, const sym::Values<double>& values,
+    const std::vector<sym::FactorDescription>& factors);
+extern template void sym::WriteProblemSnapshot<float>(
+    const std::string& filename, const sym::Values<float>& values,
+    const std::vector<sym::FactorDescription>& factors);
+extern template class sym::ProblemSnapshot<double>;
+extern template class sym::ProblemSnapshot<float>;
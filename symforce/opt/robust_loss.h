@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "./assert.h"
+
+namespace sym {
+
+/**
+ * Scales applied to the linearization of a factor by a RobustLoss, for a given squared norm s of
+ * the factor's whitened residual.
+ *
+ * No single scale of the residual is consistent with both the robust cost and the reweighted rhs,
+ * so the scaled jacobian and residual don't satisfy J^T * r == rhs unless rho'(s) == rho(s) / s
+ * (e.g. for L2, or the quadratic region of Huber).  Linearization::LinearError, and so the
+ * new_error_linear in the optimizer stats, is then only an approximation of the linear model.
+ */
+template <typename Scalar>
+struct RobustLossWeights {
+  // sqrt(rho(s) / s), so that 0.5 * |residual|^2 is the robust cost 0.5 * rho(s)
+  Scalar residual_scale;
+  // sqrt(rho'(s)), so that the jacobian is consistent with the hessian
+  Scalar jacobian_scale;
+  // rho'(s), the iteratively reweighted least squares weight of the hessian and rhs
+  Scalar hessian_scale;
+};
+
+/**
+ * A robust loss rho(s) applied by the Linearizer to the squared norm s of the whitened residual of
+ * a factor, replacing the factor's cost 0.5 * s with 0.5 * rho(s).
+ *
+ * The Linearizer uses the iteratively reweighted least squares approximation: the hessian and rhs
+ * of the factor are scaled by rho'(s) during assembly.  This does not depend on the residual
+ * function, so the same generated factors can be used with any loss, and the parameters of the
+ * loss can be changed (e.g. by a graduated non-convexity schedule) without regenerating or
+ * re-evaluating the factors, see Linearizer::Reweight.
+ *
+ * All of the losses are normalized so that rho(s) ~= s for small s, and are parameterized by a
+ * scale delta on the norm of the residual at which they transition from quadratic to robust.
+ *
+ * The supported losses are:
+ *
+ *   L2:      rho(s) = s
+ *   Huber:   rho(s) = s                                  if s <= delta^2
+ *                     2 * delta * sqrt(s) - delta^2      otherwise
+ *   Cauchy:  rho(s) = delta^2 * log(1 + s / delta^2)
+ *   Barron:  rho(s) = 2 * delta^2 * b / alpha * ((s / (b * delta^2) + 1)^(alpha / 2) - 1),
+ *            b = |alpha - 2|, with the limits at alpha = 2 (L2), alpha = 0 (Cauchy, with scale
+ *            sqrt(2) * delta) and alpha = -inf (Welsch).  See BarronNoiseModel in
+ *            symforce/opt/noise_models.py.
+ *   GNC-TLS: The graduated non-convexity surrogate of the truncated least squares loss
+ *            min(s, delta^2) from "Graduated Non-Convexity for Robust Spatial Perception"
+ *            (Yang et al. 2020), which is convex as mu -> 0 and approaches truncated least
+ *            squares as mu -> inf:
+ *
+ *              rho(s) = s                                      if s <= mu / (mu + 1) * delta^2
+ *                       2 * delta * sqrt(mu * (mu + 1) * s) - mu * (delta^2 + s)
+ *                                                              if s <= (mu + 1) / mu * delta^2
+ *                       delta^2                                otherwise
+ */
+template <typename ScalarType>
+class RobustLoss {
+ public:
+  using Scalar = ScalarType;
+
+  enum class Type { L2, HUBER, CAUCHY, BARRON, GNC_TLS };
+
+  /**
+   * The L2 loss, which leaves the factor unchanged
+   */
+  RobustLoss() = default;
+
+  static RobustLoss Huber(const Scalar delta) {
+    return RobustLoss(Type::HUBER, delta, 0, 0);
+  }
+
+  static RobustLoss Cauchy(const Scalar delta) {
+    return RobustLoss(Type::CAUCHY, delta, 0, 0);
+  }
+
+  static RobustLoss Barron(const Scalar alpha, const Scalar delta) {
+    return RobustLoss(Type::BARRON, delta, alpha, 0);
+  }
+
+  static RobustLoss GncTls(const Scalar delta, const Scalar mu) {
+    SYM_ASSERT(mu > 0);
+    return RobustLoss(Type::GNC_TLS, delta, 0, mu);
+  }
+
+  Type GetType() const {
+    return type_;
+  }
+
+  Scalar Delta() const {
+    return delta_;
+  }
+
+  Scalar Alpha() const {
+    return alpha_;
+  }
+
+  Scalar Mu() const {
+    return mu_;
+  }
+
+  /**
+   * Set the shape parameter of a Barron loss
+   */
+  void SetAlpha(const Scalar alpha) {
+    SYM_ASSERT(type_ == Type::BARRON);
+    alpha_ = alpha;
+  }
+
+  /**
+   * Set the convexity parameter of a GNC-TLS loss
+   */
+  void SetMu(const Scalar mu) {
+    SYM_ASSERT(type_ == Type::GNC_TLS);
+    SYM_ASSERT(mu > 0);
+    mu_ = mu;
+  }
+
+  /**
+   * The loss rho(s) of the squared norm s of a whitened residual
+   */
+  Scalar Cost(const Scalar s) const {
+    const Scalar delta_squared = delta_ * delta_;
+    switch (type_) {
+      case Type::L2:
+        return s;
+      case Type::HUBER:
+        return s <= delta_squared ? s : 2 * delta_ * std::sqrt(s) - delta_squared;
+      case Type::CAUCHY:
+        return delta_squared * std::log1p(s / delta_squared);
+      case Type::BARRON: {
+        if (alpha_ == 2) {
+          return s;
+        }
+        if (alpha_ == 0) {
+          return 2 * delta_squared * std::log1p(s / (2 * delta_squared));
+        }
+        if (std::isinf(alpha_)) {
+          return -2 * delta_squared * std::expm1(-s / (2 * delta_squared));
+        }
+        const Scalar b = std::abs(alpha_ - 2);
+        return 2 * delta_squared * b / alpha_ *
+               std::expm1(alpha_ / 2 * std::log1p(s / (b * delta_squared)));
+      }
+      case Type::GNC_TLS:
+        if (s <= mu_ / (mu_ + 1) * delta_squared) {
+          return s;
+        }
+        if (s <= (mu_ + 1) / mu_ * delta_squared) {
+          return 2 * delta_ * std::sqrt(mu_ * (mu_ + 1) * s) - mu_ * (delta_squared + s);
+        }
+        return delta_squared;
+    }
+    return s;
+  }
+
+  /**
+   * The derivative rho'(s) of the loss, which is the weight of the factor
+   */
+  Scalar Weight(const Scalar s) const {
+    const Scalar delta_squared = delta_ * delta_;
+    switch (type_) {
+      case Type::L2:
+        return 1;
+      case Type::HUBER:
+        return s <= delta_squared ? 1 : delta_ / std::sqrt(s);
+      case Type::CAUCHY:
+        return 1 / (1 + s / delta_squared);
+      case Type::BARRON: {
+        if (alpha_ == 2) {
+          return 1;
+        }
+        if (alpha_ == 0) {
+          return 1 / (1 + s / (2 * delta_squared));
+        }
+        if (std::isinf(alpha_)) {
+          return std::exp(-s / (2 * delta_squared));
+        }
+        const Scalar b = std::abs(alpha_ - 2);
+        return std::pow(s / (b * delta_squared) + 1, alpha_ / 2 - 1);
+      }
+      case Type::GNC_TLS:
+        if (s <= mu_ / (mu_ + 1) * delta_squared) {
+          return 1;
+        }
+        if (s <= (mu_ + 1) / mu_ * delta_squared) {
+          return delta_ * std::sqrt(mu_ * (mu_ + 1) / s) - mu_;
+        }
+        return 0;
+    }
+    return 1;
+  }
+
+  /**
+   * The scales the Linearizer applies to a factor whose whitened residual has squared norm s
+   */
+  RobustLossWeights<Scalar> Weights(const Scalar s) const {
+    if (type_ == Type::L2) {
+      return {1, 1, 1};
+    }
+
+    // Clamped, since the GNC-TLS weight can round below zero where it reaches zero
+    const Scalar weight = std::max(Weight(s), Scalar{0});
+    // rho(s) / s -> rho'(0) = 1 as s -> 0
+    const Scalar residual_scale =
+        s > std::numeric_limits<Scalar>::min() ? std::sqrt(Cost(s) / s) : Scalar{1};
+    return {residual_scale, std::sqrt(weight), weight};
+  }
+
+ private:
+  RobustLoss(const Type type, const Scalar delta, const Scalar alpha, const Scalar mu)
+      : type_(type), delta_(delta), alpha_(alpha), mu_(mu) {
+    SYM_ASSERT(delta > 0);
+  }
+
+  Type type_{Type::L2};
+  Scalar delta_{1};
+  Scalar alpha_{2};
+  Scalar mu_{1};
+};
+
+}  // namespace sym
@@ -20,6 +20,21 @@
  *         }
  *     }
  *
+ * The default implementation is cheap enough to leave enabled in production: each SYM_TIME_SCOPE
+ * call site caches the ID of its name, only formatting the name again when the format arguments
+ * change, so a scope costs two clock reads, a few uncontended per-thread counter updates, and a
+ * lookup of the scope among the children of the enclosing scope.  The format arguments are
+ * evaluated once per scope.  Arguments which can't be copied or compared for equality are
+ * supported, but then the name is formatted on every call.
+ *
+ * Scopes are also recorded by call path, i.e. nested inside the scopes that were active when they
+ * were entered.  Set the environment variable SYMFORCE_TIC_TOC_PERCENTILES to also keep a histogram
+ * of durations for each path, which adds percentiles to the results at the cost of a few kilobytes
+ * per path.  Set SYMFORCE_TIC_TOC_JSON to a path to write the statistics for each call path there
+ * as JSON lines on exit (this also turns on percentiles), or SYMFORCE_TIC_TOC_TRACE to stream every
+ * scope to a Chrome trace file.  See internal::TicTocManager for the same functionality at
+ * runtime.
+ *
  * SymForce has a default implementation of this timing and aggregation mechanism; if you have some
  * other timing system that you'd like SymForce to hook into, you can define a header to include
  * with SYMFORCE_TIC_TOC_HEADER and provide your own definition of the SYM_TIME_SCOPE macro
@@ -41,9 +56,12 @@
 #ifndef SYM_TIME_SCOPE
 #define _SYMFORCE_OPT_INTERNAL_COMBINE1(X, Y) X##Y
 #define _SYMFORCE_OPT_INTERNAL_COMBINE(X, Y) _SYMFORCE_OPT_INTERNAL_COMBINE1(X, Y)
-#define SYM_TIME_SCOPE(fmt_str, ...)                          \
-  sym::internal::ScopedTicToc _SYMFORCE_OPT_INTERNAL_COMBINE( \
-      scope_timer_, __LINE__)((fmt::format(fmt_str, ##__VA_ARGS__)))
+#define SYM_TIME_SCOPE(fmt_str, ...)                                                           \
+  struct _SYMFORCE_OPT_INTERNAL_COMBINE(scope_timer_site_, __LINE__) {};                       \
+  sym::internal::ScopedTicToc _SYMFORCE_OPT_INTERNAL_COMBINE(scope_timer_, __LINE__)(          \
+      sym::internal::GetTicTocId<_SYMFORCE_OPT_INTERNAL_COMBINE(scope_timer_site_, __LINE__)>( \
+          [&](const auto&... args) { return fmt::format(fmt_str, args...); },                  \
+          std::forward_as_tuple(__VA_ARGS__)))
 #endif
 
 #endif  // defined(SYMFORCE_TIC_TOC_HEADER)
@@ -5,6 +5,8 @@
 
 #include "./values.h"
 
+#include <utility>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
@@ -39,6 +41,14 @@ Values<Scalar>::Values(const LcmType& msg) {
   data_ = msg.data;
 }
 
+template <typename Scalar>
+Values<Scalar>::Values(MapType map, ArrayType data) : map_(std::move(map)), data_(std::move(data)) {
+  for (const auto& it : map_) {
+    SYM_ASSERT(it.second.offset >= 0 &&
+               it.second.offset + it.second.storage_dim <= static_cast<int>(data_.size()));
+  }
+}
+
 template <typename Scalar>
 bool Values<Scalar>::Has(const Key& key) const {
   return map_.find(key) != map_.end();
@@ -69,6 +79,12 @@ size_t Values<Scalar>::NumEntries() const {
   return map_.size();
 }
 
+template <typename Scalar>
+void Values<Scalar>::Reserve(const size_t num_entries, const size_t num_scalars) {
+  map_.reserve(num_entries);
+  data_.reserve(num_scalars);
+}
+
 template <typename Scalar>
 std::vector<Key> Values<Scalar>::Keys(const bool sort_by_offset) const {
   std::vector<Key> keys;
@@ -54,6 +54,12 @@ class Values {
    */
   explicit Values(const LcmType& msg);
 
+  /**
+   * Construct from an index of the entries and the data buffer they point into, taking ownership
+   * of both.  Every entry must lie within data.
+   */
+  Values(MapType map, ArrayType data);
+
   /**
    * Return whether the key exists.
    */
@@ -109,6 +115,12 @@ class Values {
     return NumEntries() == 0;
   }
 
+  /**
+   * Preallocate space for num_entries keys with a total of num_scalars Scalars of storage, so
+   * that adding that many entries doesn't reallocate.
+   */
+  void Reserve(size_t num_entries, size_t num_scalars);
+
   /**
    * Get all keys.
    *
@@ -5,8 +5,12 @@
 
 #include "./cc_factor.h"
 
+#include <cstdint>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 
 #include <Eigen/Dense>
 #include <fmt/format.h>
@@ -60,6 +64,8 @@ auto WrapPyHessianFunc(PyHessianFunc&& hessian_func) {
   return [hessian_func = std::move(hessian_func)](
              const sym::Valuesd& values, const std::vector<index_entry_t>& keys,
              Vec* const residual, Matrix* const jacobian, Matrix* const hessian, Vec* const rhs) {
+    // The optimizer releases the GIL, and the python objects below need it
+    py::gil_scoped_acquire gil;
     const py::tuple out_tuple = hessian_func(values, keys);
     if (residual != nullptr) {
       *residual = py::cast<Vec>(out_tuple[0]);
@@ -98,6 +104,8 @@ sym::Factord::JacobianFunc<Matrix> WrapPyJacobianFunc(PyJacobianFunc&& jacobian_
       [jacobian_func = std::move(jacobian_func)](
           const sym::Valuesd& values, const std::vector<index_entry_t>& keys,
           Eigen::VectorXd* const residual, Matrix* const jacobian) {
+        // The optimizer releases the GIL, and the python objects below need it
+        py::gil_scoped_acquire gil;
         const py::tuple out_tuple = jacobian_func(values, keys);
         if (residual != nullptr) {
           *residual = py::cast<Eigen::VectorXd>(out_tuple[0]);
@@ -120,6 +128,112 @@ sym::Factord MakeJacobianFactor(PyJacobianFunc jacobian_func, const std::vector<
   }
 }
 
+/**
+ * Signature of the native functions returned by symengine's Lambdify.as_ctypes(), which read the
+ * flattened inputs and write the flattened outputs
+ */
+using NativeFunc = void (*)(double* output, const double* input, void* user_data);
+
+/**
+ * Wraps a native function computing the flattened linearization of a factor. The input of func is
+ * the storage of each key in keys_to_func, concatenated in order, which must have size input_dim.
+ * Its output is the residual, then
+ * the column-major jacobian, then the lower triangle of the hessian in column-major order, then
+ * the rhs.
+ *
+ * owner is the Python object which owns func and user_data, and is kept alive as long as any copy
+ * of the returned functor. If thread_safe is false, calls to func are serialized.
+ */
+sym::Factord::DenseHessianFunc WrapNativeHessianFunc(const std::uintptr_t func_address,
+                                                     const std::uintptr_t user_data,
+                                                     py::object owner, const int input_dim,
+                                                     const int residual_dim, const int tangent_dim,
+                                                     const bool thread_safe) {
+  struct State {
+    NativeFunc func;
+    void* user_data;
+    py::object owner;
+    std::mutex mutex;
+
+    ~State() {
+      py::gil_scoped_acquire gil;
+      owner = py::object();
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->func = reinterpret_cast<NativeFunc>(func_address);
+  state->user_data = reinterpret_cast<void*>(user_data);
+  state->owner = std::move(owner);
+
+  const int jacobian_size = residual_dim * tangent_dim;
+  const int hessian_size = tangent_dim * (tangent_dim + 1) / 2;
+  const int output_size = residual_dim + jacobian_size + hessian_size + tangent_dim;
+
+  return [state, input_dim, residual_dim, tangent_dim, jacobian_size, output_size, thread_safe](
+             const sym::Valuesd& values, const std::vector<index_entry_t>& keys,
+             Eigen::VectorXd* const residual, Eigen::MatrixXd* const jacobian,
+             Eigen::MatrixXd* const hessian, Eigen::VectorXd* const rhs) {
+    std::vector<double> input;
+    input.reserve(input_dim);
+    for (const index_entry_t& entry : keys) {
+      const auto begin = values.Data().begin() + entry.offset;
+      input.insert(input.end(), begin, begin + entry.storage_dim);
+    }
+    // func reads exactly input_dim inputs, so keys of the wrong types would make it read past the
+    // end of the buffer
+    if (static_cast<int>(input.size()) != input_dim) {
+      throw std::runtime_error(
+          fmt::format("The keys of the native factor have total storage dimension {}, but the "
+                      "function takes {} inputs",
+                      input.size(), input_dim));
+    }
+
+    std::vector<double> output(output_size);
+    if (thread_safe) {
+      state->func(output.data(), input.data(), state->user_data);
+    } else {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->func(output.data(), input.data(), state->user_data);
+    }
+
+    const double* out = output.data();
+    if (residual != nullptr) {
+      *residual = Eigen::Map<const Eigen::VectorXd>(out, residual_dim);
+    }
+    out += residual_dim;
+    if (jacobian != nullptr) {
+      *jacobian = Eigen::Map<const Eigen::MatrixXd>(out, residual_dim, tangent_dim);
+    }
+    out += jacobian_size;
+    if (hessian != nullptr) {
+      hessian->resize(tangent_dim, tangent_dim);
+      for (int col = 0; col < tangent_dim; col++) {
+        for (int row = col; row < tangent_dim; row++) {
+          (*hessian)(row, col) = *out;
+          (*hessian)(col, row) = *out;
+          out++;
+        }
+      }
+    } else {
+      out += tangent_dim * (tangent_dim + 1) / 2;
+    }
+    if (rhs != nullptr) {
+      *rhs = Eigen::Map<const Eigen::VectorXd>(out, tangent_dim);
+    }
+  };
+}
+
+sym::Factord MakeNativeHessianFactor(const std::uintptr_t func_address,
+                                     const std::uintptr_t user_data, py::object owner,
+                                     const std::vector<sym::Key>& keys_to_func,
+                                     const std::vector<sym::Key>& keys_to_optimize,
+                                     const int input_dim, const int residual_dim,
+                                     const int tangent_dim, const bool thread_safe) {
+  return sym::Factord(WrapNativeHessianFunc(func_address, user_data, std::move(owner), input_dim,
+                                            residual_dim, tangent_dim, thread_safe),
+                      keys_to_func, keys_to_optimize);
+}
+
 }  // namespace
 
 //================================================================================================//
@@ -158,6 +272,32 @@ void AddFactorWrapper(pybind11::module_ module) {
               Precondition:
                 The jacobian and hessian returned by hessian_func have type scipy.sparse.csc_matrix if and only if sparse = True.
            )")
+      .def_static("native", &MakeNativeHessianFactor, py::arg("func_address"), py::arg("user_data"),
+                  py::arg("owner"), py::arg("keys_to_func"), py::arg("keys_to_optimize"),
+                  py::arg("input_dim"), py::arg("residual_dim"), py::arg("tangent_dim"),
+                  py::arg("thread_safe") = false, R"(
+            Create from the address of a native function which computes the flattened linearization,
+            such as a function JIT compiled by symforce.codegen.jit. The function is called without
+            going through Python.
+
+            Args:
+              func_address: Address of a function with signature
+                            void func(double* output, const double* input, void* user_data)
+              user_data: Passed to func as the third argument
+              owner: Python object which owns func and user_data, kept alive by the Factor
+              keys_to_func: The set of input arguments, in order, accepted by func. The input of
+                            func is the storage of each of these, concatenated.
+              keys_to_optimize: The set of input arguments that correspond to the derivative in func. Must be a subset of keys_to_func.
+              input_dim: The number of inputs func reads, which must equal the total storage
+                         dimension of keys_to_func in the Values
+              residual_dim: The dimension of the residual
+              tangent_dim: The total tangent dimension of keys_to_optimize
+              thread_safe: Whether func can be called from multiple threads at once. If False,
+                           calls are serialized.
+
+            Precondition:
+              The output of func is the residual, the column-major jacobian, the lower triangle of the hessian in column-major order, and the rhs.
+          )")
       .def("is_sparse", &sym::Factord::IsSparse,
            "Does this factor use a sparse jacobian/hessian matrix?")
       .def_static("jacobian", &MakeJacobianFactor<sym::Key>, py::arg("jacobian_func"),
@@ -5,7 +5,12 @@
 
 #include "./cc_linearization.h"
 
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 
 #include <symforce/opt/linearization.h>
 
@@ -15,15 +20,152 @@ namespace py = pybind11;
 
 namespace sym {
 
+namespace {
+
+/**
+ * The number of live *_view() arrays of each Linearization.  While a Linearization has any, its
+ * members can't be reassigned, since that may reallocate the arrays the views point at.  Only
+ * accessed with the GIL held.
+ */
+std::unordered_map<const Linearizationd*, int>& LiveViews() {
+  static std::unordered_map<const Linearizationd*, int> live_views;
+  return live_views;
+}
+
+/**
+ * Throws if linearization has any live *_view() arrays, naming member in the message.
+ */
+void CheckNoLiveViews(const Linearizationd& linearization, const char* const member) {
+  const auto it = LiveViews().find(&linearization);
+  if (it != LiveViews().end()) {
+    throw std::runtime_error(
+        fmt::format("Cannot set Linearization.{} while {} views of it exist, since it may "
+                    "reallocate the arrays they view. Delete the views first.",
+                    member, it->second));
+  }
+}
+
+/**
+ * The base object of the arrays of a *_view().  It keeps the Linearization alive, and counts as a
+ * live view of it until the arrays are collected.
+ */
+class ViewOwner {
+ public:
+  explicit ViewOwner(const py::object& linearization)
+      : linearization_(linearization), key_(&linearization.cast<const Linearizationd&>()) {
+    LiveViews()[key_]++;
+  }
+
+  ~ViewOwner() {
+    const auto it = LiveViews().find(key_);
+    if (--it->second == 0) {
+      LiveViews().erase(it);
+    }
+  }
+
+  ViewOwner(const ViewOwner&) = delete;
+  ViewOwner& operator=(const ViewOwner&) = delete;
+
+ private:
+  py::object linearization_;
+  const Linearizationd* key_;
+};
+
+/**
+ * A new base object for the arrays of a view of self.
+ */
+py::capsule MakeViewOwner(const py::object& self) {
+  return py::capsule(new ViewOwner(self),
+                     [](void* const ptr) { delete static_cast<ViewOwner*>(ptr); });
+}
+
+/**
+ * Defines a property like def_readwrite, except that the setter throws while views of the
+ * Linearization exist.
+ */
+template <typename T>
+void DefGuardedReadWrite(py::class_<Linearizationd>& cls, const char* const name,
+                         T Linearizationd::*const member) {
+  cls.def_property(
+      name,
+      [member](const Linearizationd& linearization) -> const T& { return linearization.*member; },
+      [name, member](Linearizationd& linearization, const T& value) {
+        CheckNoLiveViews(linearization, name);
+        linearization.*member = value;
+      });
+}
+
+/**
+ * A read-only numpy array of the size elements at data, which does not copy them, and keeps owner
+ * alive for as long as it exists.
+ */
+template <typename T>
+py::array ReadOnlyView(const T* const data, const Eigen::Index size, const py::handle owner) {
+  py::array view(py::dtype::of<T>(), {static_cast<py::ssize_t>(size)}, data, owner);
+  view.attr("setflags")(py::arg("write") = false);
+  return view;
+}
+
+/**
+ * A scipy.sparse.csc_matrix whose data, indices, and indptr are read-only views of the arrays of
+ * matrix, which must be compressed, and which keeps owner alive for as long as it exists.
+ */
+py::object CscView(const Linearizationd::MatrixType& matrix, const py::handle owner) {
+  if (!matrix.isCompressed()) {
+    throw py::value_error("Cannot view a sparse matrix which is not compressed.");
+  }
+  const auto nnz = matrix.nonZeros();
+  return py::module_::import("scipy.sparse")
+      .attr("csc_matrix")(
+          py::make_tuple(ReadOnlyView(matrix.valuePtr(), nnz, owner),
+                         ReadOnlyView(matrix.innerIndexPtr(), nnz, owner),
+                         ReadOnlyView(matrix.outerIndexPtr(), matrix.outerSize() + 1, owner)),
+          py::make_tuple(matrix.rows(), matrix.cols()), py::arg("copy") = false);
+}
+
+}  // namespace
+
 void AddLinearizationWrapper(pybind11::module_ module) {
-  py::class_<sym::Linearizationd>(module, "Linearization",
-                                  "Class for storing a problem linearization evaluated at a Values "
-                                  "(i.e. a residual, jacobian, hessian, and rhs).")
-      .def(py::init<>())
-      .def_readwrite("residual", &sym::Linearizationd::residual)
-      .def_readwrite("hessian_lower", &sym::Linearizationd::hessian_lower)
-      .def_readwrite("jacobian", &sym::Linearizationd::jacobian)
-      .def_readwrite("rhs", &sym::Linearizationd::rhs)
+  py::class_<sym::Linearizationd> cls(module, "Linearization",
+                                      "Class for storing a problem linearization evaluated at a "
+                                      "Values (i.e. a residual, jacobian, hessian, and rhs).");
+  cls.def(py::init<>())
+      .def(
+          "residual_view",
+          [](const py::object& self) {
+            const auto& residual = self.cast<const Linearizationd&>().residual;
+            return ReadOnlyView(residual.data(), residual.size(), MakeViewOwner(self));
+          },
+          R"(
+            Read-only numpy view of the residual, which does not copy it.
+
+            The view keeps this Linearization alive. While any view of it exists, setting the
+            residual, hessian_lower, jacobian, or rhs throws instead. Delete the views to set them.
+          )")
+      .def(
+          "rhs_view",
+          [](const py::object& self) {
+            const auto& rhs = self.cast<const Linearizationd&>().rhs;
+            return ReadOnlyView(rhs.data(), rhs.size(), MakeViewOwner(self));
+          },
+          "Read-only numpy view of the rhs, which does not copy it. See residual_view.")
+      .def(
+          "hessian_lower_view",
+          [](const py::object& self) {
+            return CscView(self.cast<const Linearizationd&>().hessian_lower, MakeViewOwner(self));
+          },
+          R"(
+            scipy.sparse.csc_matrix of the lower triangle of the hessian, whose data, indices, and
+            indptr are read-only views of the arrays of hessian_lower, and not copies. Unlike the
+            hessian_lower property, this takes constant time. See residual_view.
+          )")
+      .def(
+          "jacobian_view",
+          [](const py::object& self) {
+            return CscView(self.cast<const Linearizationd&>().jacobian, MakeViewOwner(self));
+          },
+          "scipy.sparse.csc_matrix of the jacobian, whose arrays are read-only views. See "
+          "hessian_lower_view.")
       .def("reset", &sym::Linearizationd::Reset, "Set to invalid.")
       .def("is_initialized", &sym::Linearizationd::IsInitialized,
            "Returns whether the linearization is currently valid for the corresponding values. "
@@ -49,6 +191,10 @@ void AddLinearizationWrapper(pybind11::module_ module) {
             linearization.SetInitialized(state[4].cast<bool>());
             return linearization;
           }));
+  DefGuardedReadWrite(cls, "residual", &sym::Linearizationd::residual);
+  DefGuardedReadWrite(cls, "hessian_lower", &sym::Linearizationd::hessian_lower);
+  DefGuardedReadWrite(cls, "jacobian", &sym::Linearizationd::jacobian);
+  DefGuardedReadWrite(cls, "rhs", &sym::Linearizationd::rhs);
 }
 
 }  // namespace sym
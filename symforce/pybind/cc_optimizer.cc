@@ -5,6 +5,9 @@
 
 #include "./cc_optimizer.h"
 
+#include <exception>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <pybind11/eigen.h>
@@ -18,6 +21,7 @@
 #include <symforce/opt/linearization.h>
 #include <symforce/opt/optimization_stats.h>
 #include <symforce/opt/optimizer.h>
+#include <symforce/opt/parallel_for.h>
 #include <symforce/opt/values.h>
 
 #include "./lcm_type_casters.h"
@@ -38,8 +42,8 @@ void AddOptimizerWrapper(pybind11::module_ module) {
            py::arg("debug_stats") = false, py::arg("check_derivatives") = false,
            py::arg("include_jacobians") = false)
       .def("optimize", py::overload_cast<Valuesd&, int, bool>(&Optimizerd::Optimize),
-           py::arg("values"), py::arg("num_iterations") = -1,
-           py::arg("populate_best_linearization") = false, R"(
+           py::call_guard<py::gil_scoped_release>(), py::arg("values"),
+           py::arg("num_iterations") = -1, py::arg("populate_best_linearization") = false, R"(
               Optimize the given values in-place
 
               Args:
@@ -52,7 +56,8 @@ void AddOptimizerWrapper(pybind11::module_ module) {
            )")
       .def("optimize",
            py::overload_cast<Valuesd&, int, bool, OptimizationStatsd&>(&Optimizerd::Optimize),
-           py::arg("values"), py::arg("num_iterations"), py::arg("populate_best_linearization"),
+           py::call_guard<py::gil_scoped_release>(), py::arg("values"), py::arg("num_iterations"),
+           py::arg("populate_best_linearization"),
            py::arg("stats"), R"(
               Optimize the given values in-place
 
@@ -68,7 +73,8 @@ void AddOptimizerWrapper(pybind11::module_ module) {
                 stats: An OptimizationStats to fill out with the result - if filling out dynamically allocated fields here, will not reallocate if memory is already allocated in the required shape (e.g. for repeated calls to Optimize)
            )")
       .def("optimize", py::overload_cast<Valuesd&, int, OptimizationStatsd&>(&Optimizerd::Optimize),
-           py::arg("values"), py::arg("num_iterations"), py::arg("stats"), R"(
+           py::call_guard<py::gil_scoped_release>(), py::arg("values"), py::arg("num_iterations"),
+           py::arg("stats"), R"(
               Optimize the given values in-place
 
               This overload takes the stats as an argument, and stores into there.  This allows users to
@@ -81,7 +87,7 @@ void AddOptimizerWrapper(pybind11::module_ module) {
                 stats: An OptimizationStats to fill out with the result - if filling out dynamically allocated fields here, will not reallocate if memory is already allocated in the required shape (e.g. for repeated calls to Optimize)
            )")
       .def("optimize", py::overload_cast<Valuesd&, OptimizationStatsd&>(&Optimizerd::Optimize),
-           py::arg("values"), py::arg("stats"), R"(
+           py::call_guard<py::gil_scoped_release>(), py::arg("values"), py::arg("stats"), R"(
               Optimize the given values in-place
 
               This overload takes the stats as an argument, and stores into there.  This allows users to
@@ -91,7 +97,8 @@ void AddOptimizerWrapper(pybind11::module_ module) {
               Args:
                 stats: An OptimizationStats to fill out with the result - if filling out dynamically allocated fields here, will not reallocate if memory is already allocated in the required shape (e.g. for repeated calls to Optimize)
            )")
-      .def("linearize", &Optimizerd::Linearize, py::arg("values"),
+      .def("linearize", &Optimizerd::Linearize, py::call_guard<py::gil_scoped_release>(),
+           py::arg("values"),
            "Linearize the problem around the given values.")
       .def(
           "compute_all_covariances",
@@ -100,7 +107,7 @@ void AddOptimizerWrapper(pybind11::module_ module) {
             opt.ComputeAllCovariances(linearization, covariances_by_key);
             return covariances_by_key;
           },
-          py::arg("linearization"), R"(
+          py::call_guard<py::gil_scoped_release>(), py::arg("linearization"), R"(
             Get covariances for each optimized key at the given linearization
 
             May not be called before either optimize or Linearize has been called.
@@ -112,7 +119,8 @@ void AddOptimizerWrapper(pybind11::module_ module) {
             opt.ComputeCovariances(linearization, keys, covariances_by_key);
             return covariances_by_key;
           },
-          py::arg("linearization"), py::arg("keys"), R"(
+          py::call_guard<py::gil_scoped_release>(), py::arg("linearization"), py::arg("keys"),
+          R"(
             Get covariances for the given subset of keys at the given linearization.  This version is
             potentially much more efficient than computing the covariances for all keys in the problem.
 
@@ -144,15 +152,73 @@ void AddOptimizerWrapper(pybind11::module_ module) {
           py::arg("key"));
 
   // Wrapping free functions
-  // NOTE(brad): the overload cast is only necessary because we temporarily have two overloads,
-  // one for the new signature, and one for a deprecated signature. The overload cast could be
-  // removed once the deprecated overload is removed.
-  module.def("optimize",
-             py::overload_cast<const optimizer_params_t&, const std::vector<Factord>&, Valuesd&,
-                               const double>(&Optimize<double>),
-             py::arg("params"), py::arg("factors"), py::arg("values"),
-             py::arg("epsilon") = kDefaultEpsilond,
-             "Simple wrapper to make optimization one function call.");
+  // NOTE: This is sym::Optimize, except that the GIL is only released around the optimization.
+  // The Optimizer copies the factors, and copying or destroying a factor defined in Python changes
+  // the reference count of its function, which requires the GIL.
+  module.def(
+      "optimize",
+      [](const optimizer_params_t& params, const std::vector<Factord>& factors, Valuesd& values,
+         const double epsilon) {
+        Optimizerd optimizer(params, factors, epsilon);
+        py::gil_scoped_release release;
+        return optimizer.Optimize(values);
+      },
+      py::arg("params"), py::arg("factors"), py::arg("values"),
+      py::arg("epsilon") = kDefaultEpsilond,
+      "Simple wrapper to make optimization one function call.");
+  module.def(
+      "optimize_many",
+      [](const std::vector<std::pair<Optimizerd*, Valuesd*>>& problems, const int num_threads) {
+        // An Optimizer can't run two optimizations at once, and a Values can't be optimized twice
+        std::unordered_set<const void*> seen;
+        for (const auto& problem : problems) {
+          if (problem.first == nullptr || problem.second == nullptr) {
+            throw py::value_error("optimize_many expected (Optimizer, Values) pairs, found None.");
+          }
+          if (!seen.insert(problem.first).second || !seen.insert(problem.second).second) {
+            throw py::value_error(
+                "Each Optimizer and Values may appear in at most one problem of optimize_many.");
+          }
+        }
+
+        std::vector<OptimizationStatsd> stats(problems.size());
+        std::vector<std::exception_ptr> errors(problems.size());
+        {
+          py::gil_scoped_release release;
+          ParallelForBlocks(
+              problems.size(),
+              [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                  try {
+                    stats[i] = problems[i].first->Optimize(*problems[i].second);
+                  } catch (...) {
+                    errors[i] = std::current_exception();
+                  }
+                }
+              },
+              /* block_size */ 1, num_threads);
+        }
+
+        for (const auto& error : errors) {
+          if (error) {
+            std::rethrow_exception(error);
+          }
+        }
+        return stats;
+      },
+      py::arg("problems"), py::arg("num_threads") = 0, R"(
+        Optimize each of the given (optimizer, values) pairs in-place, in parallel on a pool of
+        num_threads threads, and return the stats of each.
+
+        The GIL is released while optimizing, so this only runs in parallel for factors implemented
+        in C++; factors implemented in Python hold the GIL while they are evaluated. The problems
+        must not share an Optimizer or a Values. If any optimization raises, the others still run,
+        and the exception of the first problem that raised is re-raised.
+
+        Args:
+          problems: List of (optimizer, values) pairs to optimize.
+          num_threads: Number of threads to use, or 0 (the default) for the number of cores.
+      )");
   module.def("default_optimizer_params", &DefaultOptimizerParams,
              "Sensible default parameters for Optimizer.");
 }
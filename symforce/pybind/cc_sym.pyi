@@ -156,6 +156,41 @@ class Factor:
 
         This can only be called if is_sparse is false; otherwise, it will throw.
         """
+    @staticmethod
+    def native(
+        func_address: int,
+        user_data: int,
+        owner: object,
+        keys_to_func: typing.List[Key],
+        keys_to_optimize: typing.List[Key],
+        input_dim: int,
+        residual_dim: int,
+        tangent_dim: int,
+        thread_safe: bool = False,
+    ) -> Factor:
+        """
+        Create from the address of a native function which computes the flattened linearization,
+        such as a function JIT compiled by symforce.codegen.jit. The function is called without
+        going through Python.
+
+        Args:
+          func_address: Address of a function with signature
+                        void func(double* output, const double* input, void* user_data)
+          user_data: Passed to func as the third argument
+          owner: Python object which owns func and user_data, kept alive by the Factor
+          keys_to_func: The set of input arguments, in order, accepted by func. The input of
+                        func is the storage of each of these, concatenated.
+          keys_to_optimize: The set of input arguments that correspond to the derivative in func. Must be a subset of keys_to_func.
+          input_dim: The number of inputs func reads, which must equal the total storage
+                     dimension of keys_to_func in the Values
+          residual_dim: The dimension of the residual
+          tangent_dim: The total tangent dimension of keys_to_optimize
+          thread_safe: Whether func can be called from multiple threads at once. If False,
+                       calls are serialized.
+
+        Precondition:
+          The output of func is the residual, the column-major jacobian, the lower triangle of the hessian in column-major order, and the rhs.
+        """
     def optimized_keys(self) -> typing.List[Key]:
         """
         Get the optimized keys for this factor.
@@ -223,15 +258,36 @@ class Linearization:
     def __init__(self) -> None: ...
     def __setstate__(self, arg0: tuple) -> None: ...
     def error(self) -> float: ...
+    def hessian_lower_view(self) -> object:
+        """
+        scipy.sparse.csc_matrix of the lower triangle of the hessian, whose data, indices, and
+        indptr are read-only views of the arrays of hessian_lower, and not copies. Unlike the
+        hessian_lower property, this takes constant time. See residual_view.
+        """
     def is_initialized(self) -> bool:
         """
         Returns whether the linearization is currently valid for the corresponding values. Accessing any of the members when this is false could result in unexpected behavior.
         """
+    def jacobian_view(self) -> object:
+        """
+        scipy.sparse.csc_matrix of the jacobian, whose arrays are read-only views. See hessian_lower_view.
+        """
     def linear_error(self, x_update: numpy.ndarray) -> float: ...
     def reset(self) -> None:
         """
         Set to invalid.
         """
+    def residual_view(self) -> numpy.ndarray:
+        """
+        Read-only numpy view of the residual, which does not copy it.
+
+        The view keeps this Linearization alive. While any view of it exists, setting the
+        residual, hessian_lower, jacobian, or rhs throws instead. Delete the views to set them.
+        """
+    def rhs_view(self) -> numpy.ndarray:
+        """
+        Read-only numpy view of the rhs, which does not copy it. See residual_view.
+        """
     def set_initialized(self, initialized: bool = True) -> None: ...
     @property
     def hessian_lower(self) -> scipy.sparse.csc_matrix[numpy.float64]:
@@ -516,7 +572,8 @@ class Values:
         """
         Repack the data array to get rid of empty space from removed keys. If regularly removing
         keys, it's up to the user to call this appropriately to avoid storage growth. Returns the
-        number of Scalar elements cleaned up from the data array.
+        number of Scalar elements cleaned up from the data array. Throws while data_view() arrays
+        of this Values exist.
 
         It will INVALIDATE all indices, offset increments, and pointers.
         Re-create an index with create_index().
@@ -536,6 +593,15 @@ class Values:
         """
         Raw data buffer.
         """
+    def data_view(self) -> numpy.ndarray[numpy.float64]:
+        """
+        Read-only numpy view of the raw data buffer, which does not copy it. It sees updates to
+        existing keys, e.g. from set() or an optimization.
+
+        The view keeps this Values alive. While any view exists, the methods which may reallocate
+        the data buffer, i.e. set() of a new key, update_or_set(), remove_all() and cleanup(),
+        throw instead. Delete the views to call them.
+        """
     def empty(self) -> bool:
         """
         Has zero keys.
@@ -581,7 +647,7 @@ class Values:
         """
     def remove_all(self) -> None:
         """
-        Remove all keys and empty out the storage.
+        Remove all keys and empty out the storage. Throws while data_view() arrays of this Values exist.
         """
     def retract(self, index: index_t, delta: typing.List[float], epsilon: float) -> None:
         """
@@ -595,375 +661,375 @@ class Values:
     @typing.overload
     def set(self, key: Key, value: ATANCameraCal) -> bool:
         """
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
 
-        Add or update a value by key. Returns true if added, false if updated.
+        Add or update a value by key. Returns true if added, false if updated. Adding a key throws while data_view() arrays of this Values exist.
 
         Update a value by index entry with no map lookup (compared to Set(key)). This does NOT add new values and assumes the key exists already.
         """
@@ -1029,7 +1095,7 @@ class Values:
     def update_or_set(self, index: index_t, other: Values) -> None:
         """
         Update or add keys to this Values base on other Values of different structure.
-        index MUST be valid for other.
+        index MUST be valid for other. Throws while data_view() arrays of this Values exist.
 
         NOTE(alvin): it is less efficient than the Update methods below if index objects are created and cached. This method performs map lookup for each key of the index
         """
@@ -1050,5 +1116,22 @@ def optimize(
     Simple wrapper to make optimization one function call.
     """
 
+def optimize_many(
+    problems: typing.List[typing.Tuple[Optimizer, Values]], num_threads: int = 0
+) -> typing.List[OptimizationStats]:
+    """
+    Optimize each of the given (optimizer, values) pairs in-place, in parallel on a pool of
+    num_threads threads, and return the stats of each.
+
+    The GIL is released while optimizing, so this only runs in parallel for factors implemented
+    in C++; factors implemented in Python hold the GIL while they are evaluated. The problems
+    must not share an Optimizer or a Values. If any optimization raises, the others still run,
+    and the exception of the first problem that raised is re-raised.
+
+    Args:
+      problems: List of (optimizer, values) pairs to optimize.
+      num_threads: Number of threads to use, or 0 (the default) for the number of cores.
+    """
+
 def set_log_level(arg0: str) -> None:
     pass
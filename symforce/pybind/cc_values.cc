@@ -9,12 +9,14 @@
 #include <array>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <Eigen/Dense>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -94,6 +96,68 @@ py::object ValuesAt(const sym::Valuesd& v, const sym::Key& key) {
   return ValuesAtIndexEntry(v, index_entry);
 }
 
+/**
+ * The number of live data_view() arrays of each Values.  While a Values has any, methods which may
+ * reallocate its data buffer refuse to run, since the arrays would be left pointing at freed memory.
+ * Only accessed with the GIL held.
+ */
+std::unordered_map<const sym::Valuesd*, int>& LiveDataViews() {
+  static std::unordered_map<const sym::Valuesd*, int> live_data_views;
+  return live_data_views;
+}
+
+/**
+ * Throws if v has any live data_view() arrays, naming method in the message.
+ */
+void CheckNoLiveDataViews(const sym::Valuesd& v, const char* const method) {
+  const auto it = LiveDataViews().find(&v);
+  if (it != LiveDataViews().end()) {
+    throw std::runtime_error(
+        fmt::format("Cannot call Values.{} while {} data_view() arrays of it exist, since it may "
+                    "reallocate the data buffer they view. Delete the arrays first.",
+                    method, it->second));
+  }
+}
+
+/**
+ * The base object of a data_view() array.  It keeps the Values alive, and counts as a live view of
+ * it until the array is collected.
+ */
+class DataViewOwner {
+ public:
+  explicit DataViewOwner(const py::object& values)
+      : values_(values), key_(&values.cast<const sym::Valuesd&>()) {
+    LiveDataViews()[key_]++;
+  }
+
+  ~DataViewOwner() {
+    const auto it = LiveDataViews().find(key_);
+    if (--it->second == 0) {
+      LiveDataViews().erase(it);
+    }
+  }
+
+  DataViewOwner(const DataViewOwner&) = delete;
+  DataViewOwner& operator=(const DataViewOwner&) = delete;
+
+ private:
+  py::object values_;
+  const sym::Valuesd* key_;
+};
+
+/**
+ * A read-only numpy array of the data buffer of self, which does not copy it.
+ */
+py::array ValuesDataView(const py::object& self) {
+  const auto& data = self.cast<const sym::Valuesd&>().Data();
+  const py::capsule owner(new DataViewOwner(self),
+                          [](void* const ptr) { delete static_cast<DataViewOwner*>(ptr); });
+  py::array view(py::dtype::of<double>(), {static_cast<py::ssize_t>(data.size())}, data.data(),
+                 owner);
+  view.attr("setflags")(py::arg("write") = false);
+  return view;
+}
+
 /**
  * Registers the set methods of Valuesd with a python wrapper of the class for the template
  * specializations of T.
@@ -103,9 +167,17 @@ py::object ValuesAt(const sym::Valuesd& v, const sym::Key& key) {
  */
 template <typename T>
 void RegisterTypeWithValues(py::class_<sym::Valuesd> cls) {
-  cls.def("set", py::overload_cast<const sym::Key&, const T&>(&sym::Valuesd::Set<T>),
-          py::arg("key"), py::arg("value"),
-          "Add or update a value by key. Returns true if added, false if updated.");
+  cls.def(
+      "set",
+      [](sym::Valuesd& v, const sym::Key& key, const T& value) {
+        if (!v.Has(key)) {
+          CheckNoLiveDataViews(v, "set");
+        }
+        return v.Set(key, value);
+      },
+      py::arg("key"), py::arg("value"),
+      "Add or update a value by key. Returns true if added, false if updated. Adding a key throws "
+      "while data_view() arrays of this Values exist.");
   cls.def("set", py::overload_cast<const sym::index_entry_t&, const T&>(&sym::Valuesd::Set<T>),
           py::arg("key"), py::arg("value"),
           "Update a value by index entry with no map lookup (compared to Set(key)). This does NOT "
@@ -164,9 +236,15 @@ void AddValuesWrapper(pybind11::module_ module) {
       .def(py::init<const sym::values_t&>(), py::arg("msg"), "Construct from serialized form.")
       .def("has", &sym::Valuesd::Has, py::arg("key"), "Return whether the key exists.")
       .def("at", &ValuesAt, py::arg("key"), "Retrieve a value by key.")
-      .def("update_or_set", &sym::Valuesd::UpdateOrSet, py::arg("index"), py::arg("other"), R"(
+      .def(
+          "update_or_set",
+          [](sym::Valuesd& v, const sym::index_t& index, const sym::Valuesd& other) {
+            CheckNoLiveDataViews(v, "update_or_set");
+            v.UpdateOrSet(index, other);
+          },
+          py::arg("index"), py::arg("other"), R"(
         Update or add keys to this Values base on other Values of different structure.
-        index MUST be valid for other.
+        index MUST be valid for other. Throws while data_view() arrays of this Values exist.
 
         NOTE(alvin): it is less efficient than the Update methods below if index objects are created and cached. This method performs map lookup for each key of the index
       )")
@@ -180,17 +258,39 @@ void AddValuesWrapper(pybind11::module_ module) {
       )")
       .def("items", &sym::Valuesd::Items, "Expose map type to allow iteration.")
       .def("data", py::overload_cast<>(&sym::Valuesd::Data, py::const_), "Raw data buffer.")
+      .def("data_view", &ValuesDataView, R"(
+        Read-only numpy view of the raw data buffer, which does not copy it. It sees updates to
+        existing keys, e.g. from set() or an optimization.
+
+        The view keeps this Values alive. While any view exists, the methods which may reallocate
+        the data buffer, i.e. set() of a new key, update_or_set(), remove_all() and cleanup(),
+        throw instead. Delete the views to call them.
+      )")
       .def("remove", &sym::Valuesd::Remove, py::arg("key"), R"(
         Remove the given key. Only removes the index entry, does not change the data array.
         Returns true if removed, false if already not present.
 
         Call cleanup() to re-pack the data array.
       )")
-      .def("remove_all", &sym::Valuesd::RemoveAll, "Remove all keys and empty out the storage.")
-      .def("cleanup", &sym::Valuesd::Cleanup, R"(
+      .def(
+          "remove_all",
+          [](sym::Valuesd& v) {
+            CheckNoLiveDataViews(v, "remove_all");
+            v.RemoveAll();
+          },
+          "Remove all keys and empty out the storage. Throws while data_view() arrays of this "
+          "Values exist.")
+      .def(
+          "cleanup",
+          [](sym::Valuesd& v) {
+            CheckNoLiveDataViews(v, "cleanup");
+            return v.Cleanup();
+          },
+          R"(
         Repack the data array to get rid of empty space from removed keys. If regularly removing
         keys, it's up to the user to call this appropriately to avoid storage growth. Returns the
-        number of Scalar elements cleaned up from the data array.
+        number of Scalar elements cleaned up from the data array. Throws while data_view() arrays
+        of this Values exist.
 
         It will INVALIDATE all indices, offset increments, and pointers.
         Re-create an index with create_index().
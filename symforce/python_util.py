@@ -8,6 +8,7 @@ General python utilities.
 """
 import functools
 import inspect
+import multiprocessing
 import os
 import random
 import re
@@ -18,6 +19,14 @@ import subprocess
 from symforce import logger
 from symforce import typing as T
 
+_T = T.TypeVar("_T")
+_R = T.TypeVar("_R")
+
+# The function and items of the parallel_map call in progress, inherited by the forked workers so
+# that neither has to be picklable
+_parallel_map_args: T.Optional[T.Tuple[T.Callable, T.Sequence]] = None
+_in_parallel_map_worker = False
+
 
 def remove_if_exists(path: T.Openable) -> None:
     """
@@ -290,3 +299,64 @@ class AttrDict(dict):
 
         def __setattr__(self, name: str, value: T.Any) -> None:
             pass
+
+
+def default_num_processes() -> int:
+    """
+    The number of processes parallel_map uses by default: SYMFORCE_NUM_PROCESSES if set, otherwise
+    1, so that nothing is forked unless asked for.  SYMFORCE_NUM_PROCESSES=0 uses the number of
+    CPUs.
+    """
+    num_processes = int(os.environ.get("SYMFORCE_NUM_PROCESSES", 1))
+    if num_processes == 0:
+        return os.cpu_count() or 1
+    return max(num_processes, 1)
+
+
+def _parallel_map_worker(index: int) -> T.Any:
+    global _in_parallel_map_worker  # pylint: disable=global-statement
+    _in_parallel_map_worker = True
+    assert _parallel_map_args is not None
+    func, items = _parallel_map_args
+    return func(items[index])
+
+
+def parallel_map(
+    func: T.Callable[[_T], _R], items: T.Sequence[_T], num_processes: int = None
+) -> T.List[_R]:
+    """
+    Returns [func(item) for item in items], computed in parallel across forked processes.
+
+    The processes are forked from this one, so func can be any callable, e.g. a closure, and items
+    can be anything; only the results have to be picklable.  func should not rely on side effects
+    in this process, since it runs in a different one.
+
+    Runs serially if num_processes is 1, which is the default unless the SYMFORCE_NUM_PROCESSES
+    environment variable is set, if fork is not available (e.g. on Windows), or when called from
+    inside another parallel_map.  Exceptions raised by func are reraised here.
+
+    Args:
+        func: Function to call on each item
+        items: Items to call func on
+        num_processes: Maximum number of processes to use, defaults to default_num_processes()
+    """
+    global _parallel_map_args  # pylint: disable=global-statement
+
+    if num_processes is None:
+        num_processes = default_num_processes()
+    num_processes = min(num_processes, len(items))
+
+    if (
+        num_processes <= 1
+        or _in_parallel_map_worker
+        or _parallel_map_args is not None
+        or "fork" not in multiprocessing.get_all_start_methods()
+    ):
+        return [func(item) for item in items]
+
+    _parallel_map_args = (func, items)
+    try:
+        with multiprocessing.get_context("fork").Pool(num_processes) as pool:
+            return pool.map(_parallel_map_worker, range(len(items)), chunksize=1)
+    finally:
+        _parallel_map_args = None
@@ -5,9 +5,13 @@
 
 #include "./imu_factor.h"
 
+#include <utility>
+
 #include <Eigen/Cholesky>
 
 #include <sym/factors/internal/internal_imu_factor.h>
+#include <symforce/opt/assert.h>
+#include <symforce/opt/parallel_for.h>
 
 #include "preintegrated_imu_measurements.h"
 
@@ -20,6 +24,83 @@ ImuFactor<Scalar>::ImuFactor(const ImuPreintegrator<Scalar>& preintegrator)
       sqrt_info_{preintegrator.Covariance().llt().matrixL().solve(
           Eigen::Matrix<Scalar, 9, 9>::Identity())} {}
 
+template <typename Scalar>
+ImuFactor<Scalar>::ImuFactor(std::shared_ptr<const RawImuMeasurements<Scalar>> raw_measurements,
+                             const Vector3& accel_bias, const Vector3& gyro_bias,
+                             const Scalar epsilon)
+    : ImuFactor(Preintegrate(*raw_measurements, accel_bias, gyro_bias, epsilon)) {
+  raw_measurements_ = std::move(raw_measurements);
+}
+
+template <typename Scalar>
+ImuPreintegrator<Scalar> ImuFactor<Scalar>::Preintegrate(
+    const RawImuMeasurements<Scalar>& raw_measurements, const Vector3& accel_bias,
+    const Vector3& gyro_bias, const Scalar epsilon) {
+  ImuPreintegrator<Scalar> preintegrator(accel_bias, gyro_bias);
+  preintegrator.IntegrateMeasurements(raw_measurements.accels, raw_measurements.gyros,
+                                      raw_measurements.dts, raw_measurements.accel_cov,
+                                      raw_measurements.gyro_cov, epsilon);
+  return preintegrator;
+}
+
+template <typename Scalar>
+bool ImuFactor<Scalar>::HasRawMeasurements() const {
+  return raw_measurements_ != nullptr;
+}
+
+template <typename Scalar>
+bool ImuFactor<Scalar>::NeedsRepreintegration(const Vector3& accel_bias,
+                                              const Vector3& gyro_bias,
+                                              const Scalar accel_bias_threshold,
+                                              const Scalar gyro_bias_threshold) const {
+  return HasRawMeasurements() &&
+         ((accel_bias - preintegrated_measurements_.accel_bias).norm() > accel_bias_threshold ||
+          (gyro_bias - preintegrated_measurements_.gyro_bias).norm() > gyro_bias_threshold);
+}
+
+template <typename Scalar>
+void ImuFactor<Scalar>::Repreintegrate(const Vector3& accel_bias, const Vector3& gyro_bias,
+                                       const Scalar epsilon) {
+  SYM_ASSERT(HasRawMeasurements());
+  *this = ImuFactor(raw_measurements_, accel_bias, gyro_bias, epsilon);
+}
+
+template <typename Scalar>
+std::vector<size_t> ImuFactor<Scalar>::RepreintegrateFactors(
+    std::vector<ImuFactor>* const factors, const std::vector<Vector3>& accel_biases,
+    const std::vector<Vector3>& gyro_biases, const Scalar accel_bias_threshold,
+    const Scalar gyro_bias_threshold, const Scalar epsilon, const int num_threads) {
+  SYM_ASSERT(factors != nullptr);
+  SYM_ASSERT(accel_biases.size() == factors->size());
+  SYM_ASSERT(gyro_biases.size() == factors->size());
+
+  // Checking is cheap, so find the factors to re-preintegrate first and only parallelize those
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < factors->size(); i++) {
+    if ((*factors)[i].NeedsRepreintegration(accel_biases[i], gyro_biases[i], accel_bias_threshold,
+                                            gyro_bias_threshold)) {
+      indices.push_back(i);
+    }
+  }
+
+  ParallelForBlocks(
+      indices.size(),
+      [&](const size_t begin, const size_t end) {
+        for (size_t k = begin; k < end; k++) {
+          const size_t i = indices[k];
+          (*factors)[i].Repreintegrate(accel_biases[i], gyro_biases[i], epsilon);
+        }
+      },
+      /* block_size */ 1, num_threads);
+
+  return indices;
+}
+
+template <typename Scalar>
+const PreintegratedImuMeasurements<Scalar>& ImuFactor<Scalar>::PreintegratedMeasurements() const {
+  return preintegrated_measurements_;
+}
+
 template <typename Scalar>
 sym::Factor<Scalar> ImuFactor<Scalar>::Factor(const std::vector<Key>& keys_to_func) const {
   const auto begin = keys_to_func.begin();
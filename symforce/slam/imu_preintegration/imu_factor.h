@@ -5,16 +5,19 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <Eigen/Core>
 
 #include <sym/pose3.h>
+#include <sym/util/epsilon.h>
 #include <symforce/opt/factor.h>
 #include <symforce/opt/key.h>
 
 #include "./imu_preintegrator.h"
 #include "./preintegrated_imu_measurements.h"
+#include "./raw_imu_measurements.h"
 
 namespace sym {
 
@@ -27,6 +30,13 @@ namespace sym {
  * preintegrated measurements when the IMU bias estimate changes during optimization, but rather
  * uses a first order approximation linearized at the IMU biases given during preintegration.
  *
+ * That approximation gets worse as the bias estimate moves away from the biases used for
+ * preintegration.  A factor constructed from RawImuMeasurements keeps them, so that between
+ * optimizations (e.g. when sliding the window of a VIO problem) RepreintegrateFactors can
+ * preintegrate the measurements again at the current bias estimates, only for the factors whose
+ * estimates have moved further than a threshold.  Factor() copies the ImuFactor, so it needs to be
+ * called again for the factors which were re-preintegrated.
+ *
  * The gravity argument should be [0, 0, -g] (where g is 9.8, assuming your world frame is
  * gravity aligned so that the -z direction points towards the Earth) unless your IMU reads 0
  * acceleration while stationary, in which case it should be [0, 0, 0].
@@ -130,10 +140,20 @@ namespace sym {
  */
 template <typename Scalar>
 class ImuFactor {
+ public:
+  using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+
  private:
   PreintegratedImuMeasurements<Scalar> preintegrated_measurements_;
   Eigen::Matrix<Scalar, 9, 9> sqrt_info_;
 
+  // Shared by the copies of this factor, null if constructed from an ImuPreintegrator
+  std::shared_ptr<const RawImuMeasurements<Scalar>> raw_measurements_;
+
+  static ImuPreintegrator<Scalar> Preintegrate(const RawImuMeasurements<Scalar>& raw_measurements,
+                                               const Vector3& accel_bias, const Vector3& gyro_bias,
+                                               const Scalar epsilon);
+
  public:
   /**
    * Construct an ImuFactor connecting two states from the (preintegrated) imu measurements
@@ -141,6 +161,55 @@ class ImuFactor {
    */
   ImuFactor(const ImuPreintegrator<Scalar>& preintegrator);
 
+  /**
+   * Construct an ImuFactor connecting two states by preintegrating the imu measurements between
+   * them with the given biases, keeping the measurements so they can be re-preintegrated.
+   */
+  ImuFactor(std::shared_ptr<const RawImuMeasurements<Scalar>> raw_measurements,
+            const Vector3& accel_bias, const Vector3& gyro_bias,
+            const Scalar epsilon = kDefaultEpsilon<Scalar>);
+
+  /**
+   * Whether the factor was constructed from RawImuMeasurements, and so can be re-preintegrated
+   */
+  bool HasRawMeasurements() const;
+
+  /**
+   * Whether accel_bias or gyro_bias are further than their threshold (in euclidean distance) from
+   * the biases the measurements were preintegrated with.  Always false without raw measurements.
+   */
+  bool NeedsRepreintegration(const Vector3& accel_bias, const Vector3& gyro_bias,
+                             const Scalar accel_bias_threshold,
+                             const Scalar gyro_bias_threshold) const;
+
+  /**
+   * Preintegrate the raw measurements again with the given biases.  Requires HasRawMeasurements.
+   */
+  void Repreintegrate(const Vector3& accel_bias, const Vector3& gyro_bias,
+                      const Scalar epsilon = kDefaultEpsilon<Scalar>);
+
+  /**
+   * Re-preintegrate the factors for which NeedsRepreintegration is true, in parallel on
+   * num_threads threads (or std::thread::hardware_concurrency() if 0).  The other factors keep
+   * using the first order correction for the change in biases.
+   *
+   * Args:
+   *   factors: The factors to check
+   *   accel_biases: The current accelerometer bias estimate for each factor
+   *   gyro_biases: The current gyroscope bias estimate for each factor
+   *   See NeedsRepreintegration and Repreintegrate for the other arguments
+   *
+   * Returns:
+   *   The indices of the factors which were re-preintegrated, in increasing order
+   */
+  static std::vector<size_t> RepreintegrateFactors(
+      std::vector<ImuFactor>* factors, const std::vector<Vector3>& accel_biases,
+      const std::vector<Vector3>& gyro_biases, const Scalar accel_bias_threshold,
+      const Scalar gyro_bias_threshold, const Scalar epsilon = kDefaultEpsilon<Scalar>,
+      const int num_threads = 0);
+
+  const PreintegratedImuMeasurements<Scalar>& PreintegratedMeasurements() const;
+
   /**
    * Construct a Factor object that can be passed to an Optimizer object given the keys to
    * be passed to the function.
@@ -5,7 +5,10 @@
 
 #include "./imu_preintegrator.h"
 
+#include <utility>
+
 #include <sym/factors/internal/imu_manifold_preintegration_update.h>
+#include <symforce/opt/assert.h>
 
 namespace sym {
 
@@ -13,45 +16,74 @@ template <typename Scalar>
 ImuPreintegrator<Scalar>::ImuPreintegrator(const Vector3& accel_bias, const Vector3& gyro_bias)
     : preintegrated_measurements_(accel_bias, gyro_bias), covariance_{Matrix99::Zero()} {}
 
+template <typename Scalar>
+void ImuPreintegrator<Scalar>::Update(const PreintegratedImuMeasurements<Scalar>& state,
+                                      const Matrix99& covariance, const Vector3& measured_accel,
+                                      const Vector3& measured_gyro, const Vector3& accel_cov,
+                                      const Vector3& gyro_cov, const Scalar dt,
+                                      const Scalar epsilon,
+                                      PreintegratedImuMeasurements<Scalar>* const new_state,
+                                      Matrix99* const new_covariance) {
+  ImuManifoldPreintegrationUpdate<Scalar>(
+      state.DR, state.Dv, state.Dp, covariance, state.DR_D_gyro_bias, state.Dv_D_accel_bias,
+      state.Dv_D_gyro_bias, state.Dp_D_accel_bias, state.Dp_D_gyro_bias, state.accel_bias,
+      state.gyro_bias, accel_cov, gyro_cov, measured_accel, measured_gyro, dt, epsilon,
+      // outputs
+      &new_state->DR, &new_state->Dv, &new_state->Dp, new_covariance, &new_state->DR_D_gyro_bias,
+      &new_state->Dv_D_accel_bias, &new_state->Dv_D_gyro_bias, &new_state->Dp_D_accel_bias,
+      &new_state->Dp_D_gyro_bias);
+}
+
 template <typename Scalar>
 void ImuPreintegrator<Scalar>::IntegrateMeasurement(const Vector3& measured_accel,
                                                     const Vector3& measured_gyro,
                                                     const Vector3& accel_cov,
                                                     const Vector3& gyro_cov, const Scalar dt,
                                                     const Scalar epsilon) {
-  Rot3<Scalar> new_DR;
-  Vector3 new_Dv;
-  Vector3 new_Dp;
+  PreintegratedImuMeasurements<Scalar> new_measurements = preintegrated_measurements_;
   Matrix99 new_covariance;
-  Matrix33 new_DR_D_gyro_bias;
-  Matrix33 new_Dv_D_accel_bias;
-  Matrix33 new_Dv_D_gyro_bias;
-  Matrix33 new_Dp_D_accel_bias;
-  Matrix33 new_Dp_D_gyro_bias;
-  ImuManifoldPreintegrationUpdate<Scalar>(
-      preintegrated_measurements_.DR, preintegrated_measurements_.Dv,
-      preintegrated_measurements_.Dp, covariance_, preintegrated_measurements_.DR_D_gyro_bias,
-      preintegrated_measurements_.Dv_D_accel_bias, preintegrated_measurements_.Dv_D_gyro_bias,
-      preintegrated_measurements_.Dp_D_accel_bias, preintegrated_measurements_.Dp_D_gyro_bias,
-      preintegrated_measurements_.accel_bias, preintegrated_measurements_.gyro_bias, accel_cov,
-      gyro_cov, measured_accel, measured_gyro, dt, epsilon,
-      // outputs
-      &new_DR, &new_Dv, &new_Dp, &new_covariance, &new_DR_D_gyro_bias, &new_Dv_D_accel_bias,
-      &new_Dv_D_gyro_bias, &new_Dp_D_accel_bias, &new_Dp_D_gyro_bias);
-
-  preintegrated_measurements_.DR = new_DR;
-  preintegrated_measurements_.Dv = new_Dv;
-  preintegrated_measurements_.Dp = new_Dp;
-  preintegrated_measurements_.DR_D_gyro_bias = new_DR_D_gyro_bias;
-  preintegrated_measurements_.Dv_D_accel_bias = new_Dv_D_accel_bias;
-  preintegrated_measurements_.Dv_D_gyro_bias = new_Dv_D_gyro_bias;
-  preintegrated_measurements_.Dp_D_accel_bias = new_Dp_D_accel_bias;
-  preintegrated_measurements_.Dp_D_gyro_bias = new_Dp_D_gyro_bias;
+  Update(preintegrated_measurements_, covariance_, measured_accel, measured_gyro, accel_cov,
+         gyro_cov, dt, epsilon, &new_measurements, &new_covariance);
+
+  preintegrated_measurements_ = new_measurements;
   covariance_ = new_covariance;
 
   preintegrated_measurements_.integrated_dt += dt;
 }
 
+template <typename Scalar>
+void ImuPreintegrator<Scalar>::IntegrateMeasurements(
+    const Eigen::Ref<const Matrix3X>& measured_accels,
+    const Eigen::Ref<const Matrix3X>& measured_gyros, const Eigen::Ref<const VectorX>& dts,
+    const Vector3& accel_cov, const Vector3& gyro_cov, const Scalar epsilon) {
+  SYM_ASSERT(measured_accels.cols() == dts.rows());
+  SYM_ASSERT(measured_gyros.cols() == dts.rows());
+
+  // Alternate between the members and a second copy, each update reading from one and writing to
+  // the other
+  PreintegratedImuMeasurements<Scalar> other_measurements = preintegrated_measurements_;
+  Matrix99 other_covariance;
+
+  PreintegratedImuMeasurements<Scalar>* measurements = &preintegrated_measurements_;
+  PreintegratedImuMeasurements<Scalar>* new_measurements = &other_measurements;
+  Matrix99* covariance = &covariance_;
+  Matrix99* new_covariance = &other_covariance;
+
+  for (int i = 0; i < dts.rows(); i++) {
+    Update(*measurements, *covariance, measured_accels.col(i), measured_gyros.col(i), accel_cov,
+           gyro_cov, dts(i), epsilon, new_measurements, new_covariance);
+    std::swap(measurements, new_measurements);
+    std::swap(covariance, new_covariance);
+  }
+
+  if (measurements != &preintegrated_measurements_) {
+    preintegrated_measurements_ = *measurements;
+    covariance_ = *covariance;
+  }
+
+  preintegrated_measurements_.integrated_dt += dts.sum();
+}
+
 template <typename Scalar>
 const PreintegratedImuMeasurements<Scalar>& ImuPreintegrator<Scalar>::PreintegratedMeasurements()
     const {
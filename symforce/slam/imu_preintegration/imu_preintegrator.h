@@ -25,11 +25,24 @@ class ImuPreintegrator {
   using Vector3 = typename PreintegratedImuMeasurements<Scalar>::Vector3;
   using Matrix33 = typename PreintegratedImuMeasurements<Scalar>::Matrix33;
   using Matrix99 = Eigen::Matrix<Scalar, 9, 9>;
+  using Matrix3X = Eigen::Matrix<Scalar, 3, Eigen::Dynamic>;
+  using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
 
  private:
   PreintegratedImuMeasurements<Scalar> preintegrated_measurements_;
   Matrix99 covariance_;  // covariance of [DR, Dv, Dp] in local coordinates of mean
 
+  /**
+   * Integrates one measurement into state and covariance, writing the result to new_state and
+   * new_covariance, which must not alias state or covariance.  Leaves integrated_dt, accel_bias,
+   * and gyro_bias of new_state unchanged.
+   */
+  static void Update(const PreintegratedImuMeasurements<Scalar>& state,
+                     const Matrix99& covariance, const Vector3& measured_accel,
+                     const Vector3& measured_gyro, const Vector3& accel_cov,
+                     const Vector3& gyro_cov, const Scalar dt, const Scalar epsilon,
+                     PreintegratedImuMeasurements<Scalar>* new_state, Matrix99* new_covariance);
+
  public:
   /**
    * Initialize with given accel_bias and gyro_bias
@@ -67,6 +80,27 @@ class ImuPreintegrator {
                             const Vector3& accel_cov, const Vector3& gyro_cov, const Scalar dt,
                             const Scalar epsilon = kDefaultEpsilon<Scalar>);
 
+  /**
+   * Integrate a sequence of measurements, equivalent to calling IntegrateMeasurement on each of
+   * them in order, with the same accel_cov and gyro_cov.
+   *
+   * The outputs of the update for each measurement are written directly into the inputs of the
+   * next one, instead of into temporaries that are copied into this object.  The update itself
+   * dominates the cost though, so this is about as fast as calling IntegrateMeasurement per
+   * measurement; it's a convenience for integrating measurements that are already in a batch.
+   *
+   * Args:
+   *   measured_accels are the accelerometer measurements, one per column
+   *   measured_gyros are the gyroscope measurements, one per column
+   *   dts are the time spans over which each pair of measurements was made
+   *   See IntegrateMeasurement for the other arguments
+   */
+  void IntegrateMeasurements(const Eigen::Ref<const Matrix3X>& measured_accels,
+                             const Eigen::Ref<const Matrix3X>& measured_gyros,
+                             const Eigen::Ref<const VectorX>& dts, const Vector3& accel_cov,
+                             const Vector3& gyro_cov,
+                             const Scalar epsilon = kDefaultEpsilon<Scalar>);
+
   const PreintegratedImuMeasurements<Scalar>& PreintegratedMeasurements() const;
 
   const Matrix99& Covariance() const;
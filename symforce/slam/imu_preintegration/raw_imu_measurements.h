@@ -0,0 +1,42 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <Eigen/Core>
+
+namespace sym {
+
+/**
+ * Struct of the raw IMU measurements over a preintegration window, kept so the window can be
+ * preintegrated again with a different bias estimate.
+ *
+ * The measurements are in the format taken by ImuPreintegrator::IntegrateMeasurements.
+ */
+template <typename Scalar>
+struct RawImuMeasurements {
+  using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+  using Matrix3X = Eigen::Matrix<Scalar, 3, Eigen::Dynamic>;
+  using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  // The accelerometer measurements, one per column
+  Matrix3X accels;
+
+  // The gyroscope measurements, one per column
+  Matrix3X gyros;
+
+  // The time spans over which each pair of measurements was made
+  VectorX dts;
+
+  // The covariances of the accelerometer and gyroscope measurements (represented by their diagonal
+  // entries), shared by every measurement
+  Vector3 accel_cov;
+  Vector3 gyro_cov;
+};
+
+using RawImuMeasurementsd = RawImuMeasurements<double>;
+using RawImuMeasurementsf = RawImuMeasurements<float>;
+
+}  // namespace sym
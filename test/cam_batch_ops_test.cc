@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/camera.h>
+#include <sym/ops/atan_camera_cal/batch_ops.h>
+#include <sym/ops/double_sphere_camera_cal/batch_ops.h>
+#include <sym/ops/equirectangular_camera_cal/batch_ops.h>
+#include <sym/ops/linear_camera_cal/batch_ops.h>
+#include <sym/ops/polynomial_camera_cal/batch_ops.h>
+#include <sym/ops/spherical_camera_cal/batch_ops.h>
+#include <sym/util/epsilon.h>
+#include <symforce/opt/parallel_for.h>
+
+// An odd count and a larger stride, to check the layout
+static constexpr size_t kCount = 1001;
+static constexpr size_t kStride = 1024;
+
+template <typename T>
+T CalFromData(std::initializer_list<typename T::Scalar> data) {
+  return sym::StorageOps<T>::FromStorage(data.begin());
+}
+
+template <typename T>
+struct CamCal;
+
+template <typename Scalar>
+struct CamCal<sym::LinearCameraCal<Scalar>> {
+  static sym::LinearCameraCal<Scalar> Get() {
+    return CalFromData<sym::LinearCameraCal<Scalar>>({380, 380, 320, 240});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::ATANCameraCal<Scalar>> {
+  static sym::ATANCameraCal<Scalar> Get() {
+    return CalFromData<sym::ATANCameraCal<Scalar>>({380, 380, 320, 240, 0.35});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::DoubleSphereCameraCal<Scalar>> {
+  static sym::DoubleSphereCameraCal<Scalar> Get() {
+    return CalFromData<sym::DoubleSphereCameraCal<Scalar>>({313, 313, 320, 240, -0.18, 0.59});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::EquirectangularCameraCal<Scalar>> {
+  static sym::EquirectangularCameraCal<Scalar> Get() {
+    return CalFromData<sym::EquirectangularCameraCal<Scalar>>({100, 100, 320, 240});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::PolynomialCameraCal<Scalar>> {
+  static sym::PolynomialCameraCal<Scalar> Get() {
+    return CalFromData<sym::PolynomialCameraCal<Scalar>>(
+        {234, 234, 320, 240, M_PI / 3, 0.035, -0.025, 0.0070});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::SphericalCameraCal<Scalar>> {
+  static sym::SphericalCameraCal<Scalar> Get() {
+    return CalFromData<sym::SphericalCameraCal<Scalar>>(
+        {234, 234, 320, 240, M_PI, 0.035, -0.025, 0.0070, -0.0015});
+  }
+};
+
+TEMPLATE_TEST_CASE("Batch projection matches per-point projection", "[cam_package]",
+                   sym::LinearCameraCal<double>, sym::LinearCameraCal<float>,
+                   sym::ATANCameraCal<double>, sym::ATANCameraCal<float>,
+                   sym::DoubleSphereCameraCal<double>, sym::DoubleSphereCameraCal<float>,
+                   sym::EquirectangularCameraCal<double>, sym::EquirectangularCameraCal<float>,
+                   sym::PolynomialCameraCal<double>, sym::PolynomialCameraCal<float>,
+                   sym::SphericalCameraCal<double>, sym::SphericalCameraCal<float>) {
+  using T = TestType;
+  using Scalar = typename T::Scalar;
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+  const Scalar tolerance = std::is_same<Scalar, float>::value ? 1e-4 : 1e-10;
+
+  // With and without checking the image bounds
+  for (const sym::Camera<T>& camera :
+       {sym::Camera<T>(CamCal<T>::Get()), sym::Camera<T>(CamCal<T>::Get(), {640, 480})}) {
+    // Includes points behind the camera and outside the image
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> dist(-1, 1);
+    std::vector<Scalar> points(3 * kStride);
+    for (size_t k = 0; k < kCount; k++) {
+      points[k] = dist(gen);
+      points[kStride + k] = dist(gen);
+      points[2 * kStride + k] = dist(gen) + 0.5;
+    }
+
+    // Split into uneven chunks across threads, as callers would
+    std::vector<Scalar> pixels(2 * kStride);
+    std::vector<Scalar> is_valid(kStride);
+    sym::ParallelForBlocks(
+        kCount,
+        [&](const size_t begin, const size_t end) {
+          camera.PixelsFromCameraPoints(end - begin, kStride, points.data() + begin, epsilon,
+                                        pixels.data() + begin, is_valid.data() + begin);
+        },
+        /* block_size */ 100, /* num_threads */ 4);
+
+    size_t num_valid = 0;
+    for (size_t k = 0; k < kCount; k++) {
+      const Eigen::Matrix<Scalar, 3, 1> point(points[k], points[kStride + k],
+                                              points[2 * kStride + k]);
+      Scalar expected_is_valid;
+      const Eigen::Matrix<Scalar, 2, 1> expected_pixel =
+          camera.PixelFromCameraPoint(point, epsilon, &expected_is_valid);
+
+      CHECK(is_valid[k] == expected_is_valid);
+      // Pixels of invalid points can be infinite
+      if (expected_is_valid) {
+        CHECK(Eigen::Matrix<Scalar, 2, 1>(pixels[k], pixels[kStride + k])
+                  .isApprox(expected_pixel, tolerance));
+        num_valid++;
+      }
+    }
+    CHECK(num_valid > 0);
+  }
+}
+
+TEMPLATE_TEST_CASE("Batch backprojection matches per-pixel backprojection", "[cam_package]",
+                   sym::LinearCameraCal<double>, sym::LinearCameraCal<float>,
+                   sym::ATANCameraCal<double>, sym::ATANCameraCal<float>,
+                   sym::DoubleSphereCameraCal<double>, sym::DoubleSphereCameraCal<float>,
+                   sym::EquirectangularCameraCal<double>, sym::EquirectangularCameraCal<float>) {
+  using T = TestType;
+  using Scalar = typename T::Scalar;
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+  const Scalar tolerance = std::is_same<Scalar, float>::value ? 1e-4 : 1e-10;
+
+  for (const sym::Camera<T>& camera :
+       {sym::Camera<T>(CamCal<T>::Get()), sym::Camera<T>(CamCal<T>::Get(), {640, 480})}) {
+    // Includes pixels outside the image
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> dist(-100, 740);
+    std::vector<Scalar> pixels(2 * kStride);
+    for (size_t k = 0; k < kCount; k++) {
+      pixels[k] = dist(gen);
+      pixels[kStride + k] = dist(gen);
+    }
+
+    std::vector<Scalar> camera_rays(3 * kStride);
+    std::vector<Scalar> is_valid(kStride);
+    camera.CameraRaysFromPixels(kCount, kStride, pixels.data(), epsilon, camera_rays.data(),
+                                is_valid.data());
+
+    for (size_t k = 0; k < kCount; k++) {
+      const Eigen::Matrix<Scalar, 2, 1> pixel(pixels[k], pixels[kStride + k]);
+      Scalar expected_is_valid;
+      const Eigen::Matrix<Scalar, 3, 1> expected_camera_ray =
+          camera.CameraRayFromPixel(pixel, epsilon, &expected_is_valid);
+
+      CHECK(is_valid[k] == expected_is_valid);
+      CHECK(Eigen::Matrix<Scalar, 3, 1>(camera_rays[k], camera_rays[kStride + k],
+                                        camera_rays[2 * kStride + k])
+                .isApprox(expected_camera_ray, tolerance));
+    }
+  }
+}
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/atan_camera_cal.h>
+#include <sym/camera_ray_lut.h>
+#include <sym/double_sphere_camera_cal.h>
+#include <sym/linear_camera_cal.h>
+#include <sym/polynomial_camera_cal.h>
+#include <sym/spherical_camera_cal.h>
+#include <sym/util/epsilon.h>
+
+template <typename T>
+T CalFromData(std::initializer_list<typename T::Scalar> data) {
+  return sym::StorageOps<T>::FromStorage(data.begin());
+}
+
+template <typename T>
+struct CamCal;
+
+template <typename Scalar>
+struct CamCal<sym::LinearCameraCal<Scalar>> {
+  static sym::LinearCameraCal<Scalar> Get() {
+    return CalFromData<sym::LinearCameraCal<Scalar>>({380, 380, 320, 240});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::ATANCameraCal<Scalar>> {
+  static sym::ATANCameraCal<Scalar> Get() {
+    return CalFromData<sym::ATANCameraCal<Scalar>>({380, 380, 320, 240, 0.35});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::DoubleSphereCameraCal<Scalar>> {
+  static sym::DoubleSphereCameraCal<Scalar> Get() {
+    return CalFromData<sym::DoubleSphereCameraCal<Scalar>>({313, 313, 320, 240, -0.18, 0.59});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::PolynomialCameraCal<Scalar>> {
+  static sym::PolynomialCameraCal<Scalar> Get() {
+    return CalFromData<sym::PolynomialCameraCal<Scalar>>(
+        {234, 234, 320, 240, M_PI / 3, 0.035, -0.025, 0.0070});
+  }
+};
+
+template <typename Scalar>
+struct CamCal<sym::SphericalCameraCal<Scalar>> {
+  static sym::SphericalCameraCal<Scalar> Get() {
+    // The distortion is invertible up to theta = 1.85, but interpolation is inaccurate near there
+    return CalFromData<sym::SphericalCameraCal<Scalar>>(
+        {234, 234, 320, 240, 1.6, 0.035, -0.025, 0.0070, -0.0015});
+  }
+};
+
+TEMPLATE_TEST_CASE("CameraRayLut rays reproject to their pixels", "[cam_package]",
+                   sym::LinearCameraCal<double>, sym::LinearCameraCal<float>,
+                   sym::ATANCameraCal<double>, sym::ATANCameraCal<float>,
+                   sym::DoubleSphereCameraCal<double>, sym::DoubleSphereCameraCal<float>,
+                   sym::PolynomialCameraCal<double>, sym::PolynomialCameraCal<float>,
+                   sym::SphericalCameraCal<double>, sym::SphericalCameraCal<float>) {
+  using T = TestType;
+  using Scalar = typename T::Scalar;
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+
+  const sym::Camera<T> camera(CamCal<T>::Get(), {640, 480});
+
+  for (const int step : {1, 4}) {
+    const sym::CameraRayLut<T> lut(camera, step, /* num_threads */ 4);
+    // Bilinear interpolation error is quadratic in the step
+    const Scalar tolerance = (std::is_same<Scalar, float>::value ? 5e-3 : 2e-3) * step * step;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> dist(-10, 650);
+    size_t num_valid = 0;
+    for (int i = 0; i < 1000; i++) {
+      const Eigen::Matrix<Scalar, 2, 1> pixel(dist(gen), dist(gen));
+      Scalar is_valid;
+      const Eigen::Matrix<Scalar, 3, 1> camera_ray = lut.CameraRayFromPixel(pixel, &is_valid);
+
+      if (!camera.InView(pixel, camera.ImageSize())) {
+        CHECK(is_valid == 0);
+      }
+      if (is_valid == 0) {
+        continue;
+      }
+      num_valid++;
+
+      CHECK(camera_ray.norm() == Catch::Approx(1));
+      Scalar reprojected_is_valid;
+      const Eigen::Matrix<Scalar, 2, 1> reprojected =
+          camera.PixelFromCameraPoint(camera_ray, epsilon, &reprojected_is_valid);
+      CHECK(reprojected_is_valid == 1);
+      CHECK((reprojected - pixel).norm() < tolerance);
+    }
+    CHECK(num_valid > 0);
+  }
+}
+
+TEST_CASE("CameraRayLut batch lookup matches single lookups", "[cam_package]") {
+  const sym::Camera<sym::SphericalCameraCal<double>> camera(
+      CamCal<sym::SphericalCameraCal<double>>::Get(), {640, 480});
+  const sym::CameraRayLut<sym::SphericalCameraCal<double>> lut(camera, 2);
+
+  constexpr size_t kCount = 101;
+  constexpr size_t kStride = 128;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-10, 650);
+  std::vector<double> pixels(2 * kStride);
+  for (size_t k = 0; k < kCount; k++) {
+    pixels[k] = dist(gen);
+    pixels[kStride + k] = dist(gen);
+  }
+
+  std::vector<double> camera_rays(3 * kStride);
+  std::vector<double> is_valid(kStride);
+  lut.CameraRaysFromPixels(kCount, kStride, pixels.data(), camera_rays.data(), is_valid.data());
+
+  for (size_t k = 0; k < kCount; k++) {
+    double expected_is_valid;
+    const Eigen::Vector3d expected_camera_ray =
+        lut.CameraRayFromPixel(Eigen::Vector2d(pixels[k], pixels[kStride + k]), &expected_is_valid);
+    CHECK(is_valid[k] == expected_is_valid);
+    CHECK(camera_rays[k] == expected_camera_ray[0]);
+    CHECK(camera_rays[kStride + k] == expected_camera_ray[1]);
+    CHECK(camera_rays[2 * kStride + k] == expected_camera_ray[2]);
+  }
+}
+
+TEST_CASE("CameraRayLut is rebuilt only when the calibration changes", "[cam_package]") {
+  const sym::LinearCameraCal<double> calibration(Eigen::Vector2d(380, 380),
+                                                 Eigen::Vector2d(320, 240));
+  sym::CameraRayLut<sym::LinearCameraCal<double>> lut({calibration, {640, 480}});
+
+  CHECK_FALSE(lut.Update({calibration, {640, 480}}));
+  CHECK(lut.Update({calibration, {320, 240}}));
+  CHECK(lut.ImageSize() == Eigen::Vector2i(320, 240));
+
+  const sym::LinearCameraCal<double> new_calibration(Eigen::Vector2d(400, 400),
+                                                     Eigen::Vector2d(160, 120));
+  CHECK(lut.Update({new_calibration, {320, 240}}));
+  CHECK(lut.Calibration() == new_calibration);
+
+  // The new table uses the new calibration
+  const Eigen::Vector3d camera_ray = lut.CameraRayFromPixel(Eigen::Vector2d(160, 120));
+  CHECK(camera_ray.isApprox(Eigen::Vector3d::UnitZ(), 1e-10));
+
+  const sym::Camera<sym::LinearCameraCal<double>> camera_without_image_size(calibration);
+  CHECK_THROWS_AS(sym::CameraRayLut<sym::LinearCameraCal<double>>(camera_without_image_size),
+                  std::invalid_argument);
+}
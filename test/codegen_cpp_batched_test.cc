@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/pose3.h>
+#include <sym/util/epsilon.h>
+
+#include "symforce_function_codegen_test_data/symengine/az_el_from_point.h"
+#include "symforce_function_codegen_test_data/symengine/az_el_from_point_batched.h"
+
+// Two full batches and a partial one
+static constexpr int kWidth = 4;
+static constexpr int kCount = 2 * kWidth + 3;
+
+TEMPLATE_TEST_CASE("Batched AzElFromPoint matches the scalar function on every lane",
+                   "[codegen_batched]", double, float) {
+  using Scalar = TestType;
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+  const Scalar tolerance = std::is_same<Scalar, float>::value ? 1e-5 : 1e-10;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<Scalar> dist(-10, 10);
+  std::vector<sym::Pose3<Scalar>> poses;
+  std::vector<Eigen::Matrix<Scalar, 3, 1>> points;
+  for (int i = 0; i < kCount; i++) {
+    poses.push_back(sym::Random<sym::Pose3<Scalar>>(gen));
+    points.emplace_back(dist(gen), dist(gen), dist(gen));
+  }
+
+  int num_checked = 0;
+  for (int begin = 0; begin < kCount; begin += kWidth) {
+    const int num_lanes = std::min(kWidth, kCount - begin);
+
+    // The unused lanes of the last batch are zero, and their results are ignored
+    Eigen::Array<Scalar, kWidth, 7> nav_T_cam = Eigen::Array<Scalar, kWidth, 7>::Zero();
+    Eigen::Array<Scalar, kWidth, 3> nav_t_point = Eigen::Array<Scalar, kWidth, 3>::Zero();
+    for (int lane = 0; lane < num_lanes; lane++) {
+      nav_T_cam.row(lane) = poses[begin + lane].Data().transpose();
+      nav_t_point.row(lane) = points[begin + lane].transpose();
+    }
+    const Eigen::Array<Scalar, kWidth, 1> epsilons =
+        Eigen::Array<Scalar, kWidth, 1>::Constant(epsilon);
+
+    Eigen::Array<Scalar, kWidth, 2> res;
+    sym::AzElFromPointBatched<Scalar, kWidth>(nav_T_cam, nav_t_point, epsilons, &res);
+
+    for (int lane = 0; lane < num_lanes; lane++) {
+      const Eigen::Matrix<Scalar, 2, 1> expected =
+          sym::AzElFromPoint<Scalar>(poses[begin + lane], points[begin + lane], epsilon);
+      const Eigen::Matrix<Scalar, 2, 1> actual = res.row(lane).transpose();
+      CHECK(actual.isApprox(expected, tolerance));
+      num_checked++;
+    }
+  }
+  CHECK(num_checked == kCount);
+}
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/ops/pose2/batch_ops.h>
+#include <sym/ops/pose3/batch_ops.h>
+#include <sym/ops/rot2/batch_ops.h>
+#include <sym/ops/rot3/batch_ops.h>
+#include <sym/util/epsilon.h>
+
+// An odd count and a larger stride, to check the layout
+static constexpr size_t kCount = 101;
+static constexpr size_t kStride = 128;
+
+// The type of the points each group acts on
+template <typename T>
+struct PointOf {
+  using type = Eigen::Matrix<typename T::Scalar, 2, 1>;
+};
+template <typename Scalar>
+struct PointOf<sym::Rot3<Scalar>> {
+  using type = Eigen::Matrix<Scalar, 3, 1>;
+};
+template <typename Scalar>
+struct PointOf<sym::Pose3<Scalar>> {
+  using type = Eigen::Matrix<Scalar, 3, 1>;
+};
+
+template <typename T>
+std::vector<typename sym::StorageOps<T>::Scalar> ToSoA(const std::vector<T>& values) {
+  std::vector<typename sym::StorageOps<T>::Scalar> soa(sym::StorageOps<T>::StorageDim() * kStride);
+  sym::ToStructureOfArrays(values.data(), values.size(), kStride, soa.data());
+  return soa;
+}
+
+template <typename T>
+std::vector<T> FromSoA(const std::vector<typename sym::StorageOps<T>::Scalar>& soa) {
+  std::vector<T> values(kCount);
+  sym::FromStructureOfArrays(soa.data(), kCount, kStride, values.data());
+  return values;
+}
+
+template <typename T>
+std::vector<typename sym::StorageOps<T>::Scalar> EmptySoA() {
+  return std::vector<typename sym::StorageOps<T>::Scalar>(sym::StorageOps<T>::StorageDim() *
+                                                          kStride);
+}
+
+TEMPLATE_TEST_CASE("BatchOps match the per-object ops", "[geo_package]", sym::Rot2d, sym::Rot2f,
+                   sym::Rot3d, sym::Rot3f, sym::Pose2d, sym::Pose2f, sym::Pose3d, sym::Pose3f) {
+  using T = TestType;
+  using Scalar = typename T::Scalar;
+  using Tangent = typename sym::LieGroupOps<T>::TangentVec;
+  using Point = typename PointOf<T>::type;
+  const Scalar epsilon = sym::kDefaultEpsilon<Scalar>;
+  const Scalar tolerance = std::is_same<Scalar, float>::value ? 1e-4 : 1e-10;
+
+  std::mt19937 gen(42);
+  std::vector<T> a;
+  std::vector<T> b;
+  std::vector<Tangent> vec;
+  std::vector<Point> points;
+  for (size_t k = 0; k < kCount; k++) {
+    a.push_back(sym::Random<T>(gen));
+    b.push_back(sym::Random<T>(gen));
+    vec.push_back(sym::Random<Tangent>(gen));
+    points.push_back(sym::Random<Point>(gen));
+  }
+
+  const auto a_soa = ToSoA(a);
+  const auto b_soa = ToSoA(b);
+  const auto vec_soa = ToSoA(vec);
+  const auto points_soa = ToSoA(points);
+
+  // Rot3 renormalizes on construction, so this isn't exact
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<T>(a_soa)[k].IsApprox(a[k], tolerance));
+  }
+
+  auto res = EmptySoA<T>();
+  auto tangent_res = EmptySoA<Tangent>();
+  auto point_res = EmptySoA<Point>();
+
+  sym::BatchOps<T>::Inverse(kCount, kStride, a_soa.data(), res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<T>(res)[k].IsApprox(a[k].Inverse(), tolerance));
+  }
+
+  sym::BatchOps<T>::Compose(kCount, kStride, a_soa.data(), b_soa.data(), res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<T>(res)[k].IsApprox(a[k].Compose(b[k]), tolerance));
+  }
+
+  sym::BatchOps<T>::Between(kCount, kStride, a_soa.data(), b_soa.data(), res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<T>(res)[k].IsApprox(a[k].Between(b[k]), tolerance));
+  }
+
+  sym::BatchOps<T>::Retract(kCount, kStride, a_soa.data(), vec_soa.data(), &epsilon, res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<T>(res)[k].IsApprox(a[k].Retract(vec[k], epsilon), tolerance));
+  }
+
+  sym::BatchOps<T>::LocalCoordinates(kCount, kStride, a_soa.data(), b_soa.data(), &epsilon,
+                                     tangent_res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<Tangent>(tangent_res)[k].isApprox(a[k].LocalCoordinates(b[k], epsilon),
+                                                    tolerance));
+  }
+
+  sym::BatchOps<T>::TransformPoints(kCount, kStride, a_soa.data(), points_soa.data(),
+                                    point_res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<Point>(point_res)[k].isApprox(a[k] * points[k], tolerance));
+  }
+
+  sym::BatchOps<T>::InverseTransformPoints(kCount, kStride, a_soa.data(), points_soa.data(),
+                                           point_res.data());
+  for (size_t k = 0; k < kCount; k++) {
+    CHECK(FromSoA<Point>(point_res)[k].isApprox(a[k].Inverse() * points[k], tolerance));
+  }
+}
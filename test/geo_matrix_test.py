@@ -246,6 +246,14 @@ class GeoMatrixTest(LieGroupOpsTestMixin, TestCase):
         x = sf.M21.symbolic("x")
         self.assertEqual(sf.M22.eye(), x.jacobian(x))
 
+        # Same as differentiating each entry
+        y = sf.V2(x[0] ** 2, x[1] * x[0])
+        f = sf.V3(sf.sin(y[0] * x[1]), y[0] + y[1], sf.sqrt(y[1]))
+        self.assertEqual(
+            f.jacobian(x), sf.Matrix([[fi.diff(xi) for xi in x] for fi in f.to_storage()])
+        )
+        self.assertEqual(sf.Matrix(0, 1).jacobian(x).shape, (0, 2))
+
         mat = sf.M22.symbolic("a")
         vec = mat[:, 0]
         self.assertRaises(AssertionError, lambda: mat.jacobian(vec))
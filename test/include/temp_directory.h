@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace symforce_test {
+
+/**
+ * A new, uniquely named directory for the files written by a test, in $TMPDIR (or /tmp).  The
+ * directory and the files in it are removed when this goes out of scope.
+ */
+class TempDirectory {
+ public:
+  explicit TempDirectory(const std::string& prefix = "symforce_test") {
+    const char* const tmpdir = std::getenv("TMPDIR");
+    std::string path_template =
+        std::string(tmpdir != nullptr && tmpdir[0] != '\0' ? tmpdir : "/tmp") + "/" + prefix +
+        "_XXXXXX";
+    std::vector<char> buffer(path_template.begin(), path_template.end());
+    buffer.push_back('\0');
+    if (mkdtemp(buffer.data()) == nullptr) {
+      throw std::runtime_error("Could not create a temporary directory at " + path_template);
+    }
+    path_ = buffer.data();
+  }
+
+  ~TempDirectory() {
+    DIR* const dir = opendir(path_.c_str());
+    if (dir != nullptr) {
+      for (const dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+          std::remove(File(name).c_str());
+        }
+      }
+      closedir(dir);
+    }
+    rmdir(path_.c_str());
+  }
+
+  TempDirectory(const TempDirectory&) = delete;
+  TempDirectory& operator=(const TempDirectory&) = delete;
+
+  const std::string& Path() const {
+    return path_;
+  }
+
+  /**
+   * The path of a file called name in the directory
+   */
+  std::string File(const std::string& name) const {
+    return path_ + "/" + name;
+  }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace symforce_test
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/pose3.h>
+#include <sym/util/epsilon.h>
+#include <symforce/slam/imu_preintegration/imu_factor.h>
+
+namespace {
+
+const Eigen::Vector3d kAccelBias = {0.1, -0.2, 0.05};
+const Eigen::Vector3d kGyroBias = {0.01, 0.02, -0.01};
+
+std::shared_ptr<const sym::RawImuMeasurementsd> RandomRawMeasurements(std::mt19937& gen,
+                                                                      const int num_measurements) {
+  std::normal_distribution<double> noise(0.0, 0.1);
+  auto measurements = std::make_shared<sym::RawImuMeasurementsd>();
+  measurements->accels.resize(3, num_measurements);
+  measurements->gyros.resize(3, num_measurements);
+  measurements->dts = Eigen::VectorXd::Constant(num_measurements, 5e-3);
+  measurements->accel_cov = Eigen::Vector3d::Constant(1e-3);
+  measurements->gyro_cov = Eigen::Vector3d::Constant(1e-4);
+  for (int i = 0; i < num_measurements; i++) {
+    measurements->accels.col(i) = kAccelBias + Eigen::Vector3d(0.3, 0.1, 9.81) +
+                                  Eigen::Vector3d(noise(gen), noise(gen), noise(gen));
+    measurements->gyros.col(i) = kGyroBias + Eigen::Vector3d(0.5, -0.2, 1.0) +
+                                 Eigen::Vector3d(noise(gen), noise(gen), noise(gen));
+  }
+  return measurements;
+}
+
+Eigen::Matrix<double, 9, 1> Residual(const sym::ImuFactord& factor,
+                                     const Eigen::Vector3d& accel_bias,
+                                     const Eigen::Vector3d& gyro_bias) {
+  std::mt19937 gen(7);
+  const sym::Pose3d pose_i = sym::Pose3d::Random(gen);
+  const sym::Pose3d pose_j = sym::Pose3d::Random(gen);
+  Eigen::Matrix<double, 9, 1> residual;
+  factor(pose_i, Eigen::Vector3d(1, 2, 3), pose_j, Eigen::Vector3d(-1, 0, 2), accel_bias,
+         gyro_bias, Eigen::Vector3d(0, 0, -9.81), sym::kDefaultEpsilond, &residual);
+  return residual;
+}
+
+}  // namespace
+
+TEST_CASE("Test ImuFactor from raw measurements matches ImuFactor from ImuPreintegrator",
+          "[slam]") {
+  std::mt19937 gen(1804);
+  const auto measurements = RandomRawMeasurements(gen, 50);
+
+  sym::ImuPreintegratord integrator(kAccelBias, kGyroBias);
+  for (int i = 0; i < measurements->dts.rows(); i++) {
+    integrator.IntegrateMeasurement(measurements->accels.col(i), measurements->gyros.col(i),
+                                    measurements->accel_cov, measurements->gyro_cov,
+                                    measurements->dts(i));
+  }
+
+  const sym::ImuFactord expected(integrator);
+  const sym::ImuFactord factor(measurements, kAccelBias, kGyroBias);
+  CHECK(!expected.HasRawMeasurements());
+  CHECK(factor.HasRawMeasurements());
+  CHECK(Residual(factor, kAccelBias, kGyroBias)
+            .isApprox(Residual(expected, kAccelBias, kGyroBias), 1e-12));
+
+  // Without raw measurements, factors are never re-preintegrated
+  CHECK(!expected.NeedsRepreintegration(kAccelBias + Eigen::Vector3d::Constant(1.0), kGyroBias,
+                                        0.1, 0.1));
+}
+
+TEST_CASE("Test ImuFactor.RepreintegrateFactors", "[slam]") {
+  std::mt19937 gen(1804);
+  const double accel_bias_threshold = 0.05;
+  const double gyro_bias_threshold = 0.005;
+
+  std::vector<sym::ImuFactord> factors;
+  std::vector<Eigen::Vector3d> accel_biases;
+  std::vector<Eigen::Vector3d> gyro_biases;
+  for (int i = 0; i < 12; i++) {
+    factors.emplace_back(RandomRawMeasurements(gen, 40), kAccelBias, kGyroBias);
+    // Every third factor has biases which moved a little, and every third one moved a lot
+    const double scale = i % 3 == 0 ? 0.0 : i % 3 == 1 ? 0.1 : 50.0;
+    accel_biases.push_back(kAccelBias + scale * Eigen::Vector3d(0.001, 0.002, -0.001));
+    gyro_biases.push_back(kGyroBias + scale * Eigen::Vector3d(0.0001, -0.0002, 0.0001));
+  }
+
+  // The first order correction is what the factors use before re-preintegrating
+  std::vector<Eigen::Matrix<double, 9, 1>> first_order_residuals;
+  for (size_t i = 0; i < factors.size(); i++) {
+    first_order_residuals.push_back(Residual(factors[i], accel_biases[i], gyro_biases[i]));
+  }
+
+  const std::vector<size_t> repreintegrated = sym::ImuFactord::RepreintegrateFactors(
+      &factors, accel_biases, gyro_biases, accel_bias_threshold, gyro_bias_threshold,
+      sym::kDefaultEpsilond, /* num_threads */ 3);
+  CHECK(repreintegrated == std::vector<size_t>{2, 5, 8, 11});
+
+  for (size_t i = 0; i < factors.size(); i++) {
+    const bool moved_a_lot = i % 3 == 2;
+    const Eigen::Vector3d& expected_accel_bias = moved_a_lot ? accel_biases[i] : kAccelBias;
+    const Eigen::Vector3d& expected_gyro_bias = moved_a_lot ? gyro_biases[i] : kGyroBias;
+    CHECK(factors[i].PreintegratedMeasurements().accel_bias == expected_accel_bias);
+    CHECK(factors[i].PreintegratedMeasurements().gyro_bias == expected_gyro_bias);
+    CHECK(factors[i].HasRawMeasurements());
+    CHECK(!factors[i].NeedsRepreintegration(accel_biases[i], gyro_biases[i], accel_bias_threshold,
+                                            gyro_bias_threshold));
+
+    // Re-preintegrating doesn't change the residual for small changes in biases, and the first
+    // order correction is only approximate for large changes
+    const Eigen::Matrix<double, 9, 1> residual =
+        Residual(factors[i], accel_biases[i], gyro_biases[i]);
+    if (moved_a_lot) {
+      CHECK(!residual.isApprox(first_order_residuals[i], 1e-9));
+      CHECK(residual.isApprox(first_order_residuals[i], 1e-2));
+    } else {
+      CHECK(residual == first_order_residuals[i]);
+    }
+  }
+}
@@ -9,6 +9,7 @@
 #include <thread>
 
 #include <Eigen/Dense>
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <sym/factors/internal/imu_manifold_preintegration_update.h>
@@ -381,3 +382,44 @@ TEST_CASE("Verify handwritten and auto-derivative impls are equivalent", "[slam]
     CHECK(sym::IsClose(new_Dp_D_gyro_bias, new_Dp_D_gyro_bias_auto, 1e-8));
   }
 }
+
+TEST_CASE("Test ImuPreintegrator.IntegrateMeasurements matches IntegrateMeasurement", "[slam]") {
+  std::mt19937 gen(1804);
+  std::normal_distribution<double> noise(0.0, 0.1);
+
+  for (const int num_measurements : {0, 1, 2, 7}) {
+    Eigen::Matrix<double, 3, Eigen::Dynamic> accels(3, num_measurements);
+    Eigen::Matrix<double, 3, Eigen::Dynamic> gyros(3, num_measurements);
+    Eigen::VectorXd dts(num_measurements);
+    for (int i = 0; i < num_measurements; i++) {
+      accels.col(i) = example::kAccelBias + example::kTrueAccel +
+                      Eigen::Vector3d(noise(gen), noise(gen), noise(gen));
+      gyros.col(i) = example::kGyroBias + example::kTrueGyro +
+                     Eigen::Vector3d(noise(gen), noise(gen), noise(gen));
+      dts(i) = 1e-3 * (1 + i);
+    }
+
+    sym::ImuPreintegrator<double> expected(example::kAccelBias, example::kGyroBias);
+    for (int i = 0; i < num_measurements; i++) {
+      expected.IntegrateMeasurement(accels.col(i), gyros.col(i), example::kAccelCov,
+                                    example::kGyroCov, dts(i), sym::kDefaultEpsilond);
+    }
+
+    sym::ImuPreintegrator<double> integrator(example::kAccelBias, example::kGyroBias);
+    integrator.IntegrateMeasurements(accels, gyros, dts, example::kAccelCov, example::kGyroCov,
+                                     sym::kDefaultEpsilond);
+
+    const auto& measurements = integrator.PreintegratedMeasurements();
+    const auto& expected_measurements = expected.PreintegratedMeasurements();
+    CHECK(measurements.DR.IsApprox(expected_measurements.DR, 1e-12));
+    CHECK(measurements.Dv.isApprox(expected_measurements.Dv, 1e-12));
+    CHECK(measurements.Dp.isApprox(expected_measurements.Dp, 1e-12));
+    CHECK(measurements.DR_D_gyro_bias == expected_measurements.DR_D_gyro_bias);
+    CHECK(measurements.Dv_D_accel_bias == expected_measurements.Dv_D_accel_bias);
+    CHECK(measurements.Dv_D_gyro_bias == expected_measurements.Dv_D_gyro_bias);
+    CHECK(measurements.Dp_D_accel_bias == expected_measurements.Dp_D_accel_bias);
+    CHECK(measurements.Dp_D_gyro_bias == expected_measurements.Dp_D_gyro_bias);
+    CHECK(measurements.integrated_dt == Catch::Approx(expected_measurements.integrated_dt));
+    CHECK(integrator.Covariance() == expected.Covariance());
+  }
+}
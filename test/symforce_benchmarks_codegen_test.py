@@ -8,6 +8,8 @@ import symforce
 symforce.set_epsilon_to_symbol()
 
 from symforce import path_util
+from symforce.benchmarks.batch_reprojection import generate_batch_reprojection
+from symforce.benchmarks.integer_power import generate_integer_power
 from symforce.benchmarks.inverse_compose_jacobian import generate_inverse_compose_jacobian
 from symforce.benchmarks.matrix_multiplication import generate_matrix_multiplication_benchmark
 from symforce.test_util import TestCase
@@ -21,6 +23,18 @@ class SymforceBenchmarksCodegenTest(TestCase):
     Generates code used by the benchmarks
     """
 
+    @sympy_only
+    def test_generate_batch_reprojection(self) -> None:
+        """
+        Tests:
+            Generates code for the batch_reprojection benchmark
+        """
+        output_dir = self.make_output_dir("sf_benchmarks_codegen_test")
+        generate_batch_reprojection.generate(output_dir)
+        self.compare_or_update_directory(
+            actual_dir=output_dir, expected_dir=BENCHMARKS_DIR / "batch_reprojection" / "gen"
+        )
+
     @sympy_only
     def test_generate_inverse_compose(self) -> None:
         """
@@ -33,6 +47,18 @@ class SymforceBenchmarksCodegenTest(TestCase):
             actual_dir=output_dir, expected_dir=BENCHMARKS_DIR / "inverse_compose_jacobian" / "gen"
         )
 
+    @sympy_only
+    def test_generate_integer_power(self) -> None:
+        """
+        Tests:
+            Generates code for the integer_power benchmark
+        """
+        output_dir = self.make_output_dir("sf_benchmarks_codegen_test")
+        generate_integer_power.generate(output_dir)
+        self.compare_or_update_directory(
+            actual_dir=output_dir, expected_dir=BENCHMARKS_DIR / "integer_power" / "gen"
+        )
+
     @sympy_only
     def test_generate_matrix_multiplication(self) -> None:
         """
@@ -6,6 +6,7 @@
 import dataclasses
 import math
 import pickle
+import sys
 
 import numpy as np
 from scipy import sparse
@@ -252,6 +253,54 @@ class SymforceCCSymTest(TestCase):
             values.set(cc_sym.Key("b"), 2)
             self.assertEqual(values.data(), [1, 2])
 
+        with self.subTest("Values.data_view is a read-only view of the data"):
+            values = cc_sym.Values()
+            values.set(cc_sym.Key("a"), 1)
+            values.set(cc_sym.Key("b"), 2)
+            data = values.data_view()
+            np.testing.assert_array_equal(data, [1, 2])
+            self.assertIsNotNone(data.base)
+            self.assertFalse(data.flags.writeable)
+            with self.assertRaises(ValueError):
+                data[1] = 3
+
+            # Updates to existing keys are seen by the view
+            values.set(cc_sym.Key("a"), 4)
+            self.assertEqual(data[0], 4)
+
+            # The view keeps values alive
+            del values
+            np.testing.assert_array_equal(data, [4, 2])
+
+        with self.subTest("Values.data_view refuses reallocation while views are alive"):
+            values = cc_sym.Values()
+            values.set(cc_sym.Key("a"), 1)
+            other = cc_sym.Values()
+            other.set(cc_sym.Key("b"), 2)
+            data = values.data_view()
+            data_copy = data[:]
+
+            with self.assertRaises(RuntimeError):
+                values.set(cc_sym.Key("b"), 2)
+            with self.assertRaises(RuntimeError):
+                values.update_or_set(other.create_index([cc_sym.Key("b")]), other)
+            with self.assertRaises(RuntimeError):
+                values.remove_all()
+            with self.assertRaises(RuntimeError):
+                values.cleanup()
+            self.assertEqual(values.keys(), [cc_sym.Key("a")])
+
+            # A slice of the view is also a view, which keeps the first one alive
+            del data
+            with self.assertRaises(RuntimeError):
+                values.set(cc_sym.Key("b"), 2)
+
+            # Once every view is gone, the data buffer can be reallocated again
+            del data_copy
+            values.set(cc_sym.Key("b"), 2)
+            np.testing.assert_array_equal(values.data_view(), [1, 2])
+            self.assertEqual(values.cleanup(), 0)
+
         with self.subTest(msg="Values.create_index returns an index_t"):
             values = cc_sym.Values()
             keys = [cc_sym.Key("a", i) for i in range(10)]
@@ -749,6 +798,62 @@ class SymforceCCSymTest(TestCase):
             opt.optimize(values=values, stats=stats)
             self.assertNotEqual(len(stats.iterations), 0)
 
+        with self.subTest(msg="optimize_many optimizes each problem"):
+            problems = []
+            for initial_value in [2.0, 3.0, 4.0]:
+                values = cc_sym.Values()
+                values.set(pi_key, initial_value)
+                problems.append((make_opt(), values))
+
+            stats = cc_sym.optimize_many(problems, num_threads=2)
+            self.assertEqual(len(stats), len(problems))
+            for problem_stats, (_, values) in zip(stats, problems):
+                self.assertIsInstance(problem_stats, cc_sym.OptimizationStats)
+                self.assertAlmostEqual(values.at(pi_key), math.pi)
+
+            self.assertEqual(cc_sym.optimize_many([]), [])
+            with self.assertRaises(ValueError):
+                cc_sym.optimize_many([problems[0], (problems[0][0], cc_sym.Values())])
+
+        with self.subTest(msg="optimize_many runs Python factors, and re-raises their errors"):
+            num_python_calls = [0]
+
+            def counting_pi_hessian(
+                values: cc_sym.Values, index_entries: T.Sequence[index_entry_t]
+            ) -> T.Tuple[T.List[T.Scalar], ...]:
+                num_python_calls[0] += 1
+                return SymforceCCSymTest.dense_pi_hessian(values, index_entries)
+
+            def failing_hessian(
+                values: cc_sym.Values, index_entries: T.Sequence[index_entry_t]
+            ) -> T.Tuple[T.List[T.Scalar], ...]:
+                raise ValueError("failing_hessian was called")
+
+            make_python_opt = lambda hessian_func: cc_sym.Optimizer(
+                params=cc_sym.default_optimizer_params(),
+                factors=[cc_sym.Factor(hessian_func=hessian_func, keys=[pi_key])],
+                debug_stats=False,
+            )
+
+            problems = []
+            for hessian_func in [counting_pi_hessian, failing_hessian, counting_pi_hessian]:
+                values = cc_sym.Values()
+                values.set(pi_key, 3.0)
+                problems.append((make_python_opt(hessian_func), values))
+
+            with self.assertRaisesRegex(ValueError, "failing_hessian was called"):
+                cc_sym.optimize_many(problems, num_threads=3)
+
+            # The problems which didn't raise were still optimized
+            self.assertGreater(num_python_calls[0], 0)
+            self.assertAlmostEqual(problems[0][1].at(pi_key), math.pi)
+            self.assertEqual(problems[1][1].at(pi_key), 3.0)
+            self.assertAlmostEqual(problems[2][1].at(pi_key), math.pi)
+
+            # The optimizers are still usable afterwards
+            stats = cc_sym.optimize_many([problems[0], problems[2]], num_threads=2)
+            self.assertEqual(len(stats), 2)
+
         with self.subTest(msg="Optimizer.linearize has been wrapped"):
             values = cc_sym.Values()
             values.set(pi_key, 2.0)
@@ -782,6 +887,61 @@ class SymforceCCSymTest(TestCase):
             self.assertIsInstance(lin.linear_error(x_update=np.array([0.01])), T.Scalar)
             lin.linear_error(np.array([0.01]))
 
+        with self.subTest(msg="The views of Linearization match its members without copying"):
+            linearization = cc_sym.Linearization()
+            linearization.residual = np.array([1.0, 2.0, 3.0])
+            linearization.jacobian = sparse.csc_matrix([[1.0, 2.0], [3.0, 0.0], [5.0, 6.0]])
+            linearization.hessian_lower = sparse.csc_matrix([[35.0, 0.0], [44.0, 56.0]])
+            linearization.rhs = np.array([22.0, 28.0])
+
+            residual = linearization.residual_view()
+            rhs = linearization.rhs_view()
+            jacobian = linearization.jacobian_view()
+            hessian_lower = linearization.hessian_lower_view()
+
+            np.testing.assert_array_equal(residual, linearization.residual)
+            np.testing.assert_array_equal(rhs, linearization.rhs)
+            self.assertIsInstance(jacobian, sparse.csc_matrix)
+            np.testing.assert_array_equal(jacobian.toarray(), linearization.jacobian.toarray())
+            np.testing.assert_array_equal(
+                hessian_lower.toarray(), linearization.hessian_lower.toarray()
+            )
+
+            for array in (residual, rhs, jacobian.data, jacobian.indices, jacobian.indptr):
+                self.assertIsNotNone(array.base)
+                self.assertFalse(array.flags.writeable)
+            self.assertTrue(np.shares_memory(jacobian.data, linearization.jacobian_view().data))
+
+            # The views keep the linearization alive
+            del linearization
+            np.testing.assert_array_equal(residual, [1, 2, 3])
+            np.testing.assert_array_equal(hessian_lower.toarray(), [[35, 0], [44, 56]])
+
+        with self.subTest(msg="Linearization refuses reassignment while views are alive"):
+            linearization = cc_sym.Linearization()
+            linearization.residual = np.array([1.0, 2.0, 3.0])
+            linearization.jacobian = sparse.csc_matrix([[1.0, 2.0], [3.0, 0.0], [5.0, 6.0]])
+            residual = linearization.residual_view()
+            jacobian_indices = linearization.jacobian_view().indices
+
+            for member in ("residual", "rhs"):
+                with self.assertRaises(RuntimeError):
+                    setattr(linearization, member, np.array([4.0, 5.0]))
+            for member in ("jacobian", "hessian_lower"):
+                with self.assertRaises(RuntimeError):
+                    setattr(linearization, member, sparse.csc_matrix([[1.0]]))
+            np.testing.assert_array_equal(residual, [1, 2, 3])
+
+            # An array of a sparse view keeps the view alive on its own
+            del residual
+            with self.assertRaises(RuntimeError):
+                linearization.residual = np.array([4.0, 5.0])
+
+            # Once every view is gone, the members can be set again
+            del jacobian_indices
+            linearization.residual = np.array([4.0, 5.0])
+            np.testing.assert_array_equal(linearization.residual_view(), [4, 5])
+
         with self.subTest(msg="cc_sym.Linearization is pickleable"):
 
             linearization = cc_sym.Linearization()
@@ -844,6 +1004,46 @@ class SymforceCCSymTest(TestCase):
                 params=cc_sym.default_optimizer_params(), factors=[pi_factor], values=values
             )
 
+        with self.subTest(msg="cc_sym.optimize runs Python factors, and re-raises their errors"):
+            num_python_calls = [0]
+
+            def counting_pi_hessian(
+                values: cc_sym.Values, index_entries: T.Sequence[index_entry_t]
+            ) -> T.Tuple[T.List[T.Scalar], ...]:
+                num_python_calls[0] += 1
+                return SymforceCCSymTest.dense_pi_hessian(values, index_entries)
+
+            # The factors are copied into and destroyed with the optimizer inside cc_sym.optimize,
+            # which must leave the reference count of the function unchanged
+            initial_refcount = sys.getrefcount(counting_pi_hessian)
+            for _ in range(3):
+                values = cc_sym.Values()
+                values.set(pi_key, 3.0)
+                stats = cc_sym.optimize(
+                    params=cc_sym.default_optimizer_params(),
+                    factors=[cc_sym.Factor(hessian_func=counting_pi_hessian, keys=[pi_key])],
+                    values=values,
+                )
+                self.assertIsInstance(stats, cc_sym.OptimizationStats)
+                self.assertAlmostEqual(values.at(pi_key), math.pi)
+            self.assertGreater(num_python_calls[0], 0)
+            self.assertEqual(sys.getrefcount(counting_pi_hessian), initial_refcount)
+
+            def failing_hessian(
+                values: cc_sym.Values, index_entries: T.Sequence[index_entry_t]
+            ) -> T.Tuple[T.List[T.Scalar], ...]:
+                raise ValueError("failing_hessian was called")
+
+            values = cc_sym.Values()
+            values.set(pi_key, 3.0)
+            with self.assertRaisesRegex(ValueError, "failing_hessian was called"):
+                cc_sym.optimize(
+                    params=cc_sym.default_optimizer_params(),
+                    factors=[cc_sym.Factor(hessian_func=failing_hessian, keys=[pi_key])],
+                    values=values,
+                )
+            self.assertEqual(values.at(pi_key), 3.0)
+
     def test_default_params_match(self) -> None:
         """
         Check that the default params in C++ and Python are the same
@@ -0,0 +1,125 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+import numpy as np
+
+import symforce
+
+symforce.set_epsilon_to_symbol()
+
+import sym
+import symforce.symbolic as sf
+from symforce import cc_sym
+from symforce.codegen import Codegen
+from symforce.codegen import PythonConfig
+from symforce.codegen import codegen_util
+from symforce.codegen.jit import JitLinearization
+from symforce.test_util import TestCase
+
+
+def residual(x: sf.Pose3, y: sf.Pose3, scale: sf.Scalar, epsilon: sf.Scalar) -> sf.V6:
+    return scale * sf.V6(x.local_coordinates(y, epsilon=epsilon))
+
+
+class SymforceCodegenJitTest(TestCase):
+    """
+    Tests contents of symforce.codegen.jit
+    """
+
+    def setUp(self) -> None:
+        super().setUp()
+        self.codegen = Codegen.function(residual, config=PythonConfig())
+        self.x = sym.Pose3.from_tangent(np.array([0.1, 0.2, 0.3, 1.0, 2.0, 3.0]))
+        self.y = sym.Pose3.from_tangent(np.array([-0.1, 0.4, 0.3, 1.0, -2.0, 3.0]))
+        self.scale = 1.5
+
+    def test_call(self) -> None:
+        """
+        Tests:
+            JitLinearization.__call__
+        """
+        which_args = ["x", "scale"]
+        jit_linearization = JitLinearization(self.codegen, which_args=which_args)
+        self.assertEqual(jit_linearization.residual_dim, 6)
+        self.assertEqual(jit_linearization.tangent_dim, 7)
+
+        codegen_with_linearization = self.codegen.with_linearization(which_args=which_args)
+        output_data = codegen_with_linearization.generate_function(namespace="jit_test")
+        generated = getattr(
+            codegen_util.load_generated_package(
+                f"jit_test.{codegen_with_linearization.name}", output_data.function_dir
+            ),
+            codegen_with_linearization.name,
+        )
+
+        args = (self.x, self.y, self.scale, sf.numeric_epsilon)
+        residual, jacobian, hessian, rhs = jit_linearization(*args)
+        expected_residual, expected_jacobian, expected_hessian, expected_rhs = generated(*args)
+
+        np.testing.assert_allclose(residual, expected_residual, atol=1e-12)
+        np.testing.assert_allclose(jacobian, expected_jacobian, atol=1e-12)
+        # The generated hessian only has the lower triangle filled in
+        np.testing.assert_allclose(np.tril(hessian), np.tril(expected_hessian), atol=1e-12)
+        np.testing.assert_allclose(hessian, hessian.T)
+        np.testing.assert_allclose(rhs, expected_rhs, atol=1e-12)
+
+        with self.assertRaises(ValueError):
+            jit_linearization(self.x, self.y)
+
+    def test_cc_factor(self) -> None:
+        """
+        Tests:
+            JitLinearization.cc_factor
+        """
+        jit_linearization = JitLinearization(self.codegen, which_args=["x"])
+        keys = [cc_sym.Key("x"), cc_sym.Key("y"), cc_sym.Key("s"), cc_sym.Key("e")]
+        factor = jit_linearization.cc_factor(keys)
+        self.assertEqual(factor.optimized_keys(), [keys[0]])
+        self.assertEqual(factor.all_keys(), keys)
+
+        values = cc_sym.Values()
+        values.set(keys[0], self.x)
+        values.set(keys[1], self.y)
+        values.set(keys[2], self.scale)
+        values.set(keys[3], sf.numeric_epsilon)
+
+        linearized_factor = factor.linearized_factor(values)
+        residual, jacobian, hessian, rhs = jit_linearization(
+            self.x, self.y, self.scale, sf.numeric_epsilon
+        )
+        np.testing.assert_allclose(linearized_factor.residual, residual)
+        np.testing.assert_allclose(linearized_factor.jacobian, jacobian)
+        np.testing.assert_allclose(linearized_factor.hessian, hessian)
+        np.testing.assert_allclose(linearized_factor.rhs, rhs)
+
+        # Optimizing with the factor converges to y
+        optimizer = cc_sym.Optimizer(
+            params=cc_sym.default_optimizer_params(), factors=[factor], debug_stats=False
+        )
+        optimizer.optimize(values=values)
+        self.assertLieGroupNear(values.at(keys[0]), self.y)
+
+        if jit_linearization.is_native():
+            # The native function can't be called with keys of the wrong size
+            values.set(keys[2], sym.Rot3())
+            with self.assertRaises(RuntimeError):
+                factor.linearized_factor(values)
+
+    def test_backend(self) -> None:
+        """
+        Tests:
+            JitLinearization.backend
+        """
+        jit_linearization = JitLinearization(self.codegen)
+        if symforce.get_symbolic_api() == "symengine":
+            self.assertEqual(jit_linearization.backend, "llvm" if sf.sympy.have_llvm else "lambda")
+            self.assertTrue(jit_linearization.is_native())
+        else:
+            self.assertIsNone(jit_linearization.backend)
+            self.assertFalse(jit_linearization.is_native())
+
+
+if __name__ == "__main__":
+    TestCase.main()
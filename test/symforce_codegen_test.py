@@ -7,12 +7,15 @@ import copy
 import functools
 import importlib.util
 import unittest
+import unittest.mock
 from dataclasses import dataclass
 from pathlib import Path
 
 import numpy as np
+import sympy
 from scipy import sparse
 
+import sym
 import symforce
 
 symforce.set_epsilon_to_symbol()
@@ -21,7 +24,9 @@ import symforce.symbolic as sf
 from symforce import codegen
 from symforce import ops
 from symforce import path_util
+from symforce import python_util
 from symforce import typing as T
+from symforce.codegen import cache_util
 from symforce.codegen import codegen_util
 from symforce.codegen import geo_package_codegen
 from symforce.test_util import TestCase
@@ -644,6 +649,79 @@ class SymforceCodegenTest(TestCase):
         output_function = az_el_codegen_data.function_dir / "az_el_from_point.h"
         self.compare_or_update_file(expected_code_file, output_function)
 
+    def test_function_codegen_cpp_batched(self) -> None:
+        """
+        Tests generating the batched variant of a C++ function
+        """
+        output_dir = self.make_output_dir("sf_codegen_function_codegen_cpp_batched_")
+
+        az_el_codegen = codegen.Codegen.function(
+            func=az_el_from_point, config=codegen.CppConfig(generate_batched=True)
+        )
+        az_el_codegen_data = az_el_codegen.generate_function(output_dir=output_dir)
+
+        # The scalar function is unchanged, and the batched variant is checked against it lane by
+        # lane in codegen_cpp_batched_test.cc
+        self.compare_or_update_file(
+            TEST_DATA_DIR / "az_el_from_point.h",
+            az_el_codegen_data.function_dir / "az_el_from_point.h",
+        )
+        self.compare_or_update_file(
+            TEST_DATA_DIR / "az_el_from_point_batched.h",
+            az_el_codegen_data.function_dir / "az_el_from_point_batched.h",
+        )
+
+        # Sparse outputs can't be batched
+        x = sf.Symbol("x")
+        sparse_codegen = codegen.Codegen(
+            inputs=Values(x=x),
+            outputs=Values(out=sf.M22.diag([x, 2 * x])),
+            config=codegen.CppConfig(generate_batched=True),
+            name="sparse_batched",
+            sparse_matrices=["out"],
+        )
+        with self.assertRaises(codegen.codegen.CodeGenerationException):
+            sparse_codegen.generate_function(output_dir=output_dir)
+
+    def test_function_codegen_cpp_kernel(self) -> None:
+        """
+        Tests generating the kernel variant of a C++ function
+        """
+        output_dir = self.make_output_dir("sf_codegen_function_codegen_cpp_kernel_")
+
+        az_el_codegen = codegen.Codegen.function(
+            func=az_el_from_point,
+            config=codegen.CppConfig(generate_kernel=True, kernel_uniform_args=["epsilon"]),
+        )
+        az_el_codegen_data = az_el_codegen.generate_function(output_dir=output_dir)
+
+        self.assertTrue((az_el_codegen_data.function_dir / "az_el_from_point.h").exists())
+
+        # Strip whitespace, so this doesn't depend on the formatter
+        kernel = "".join(
+            (az_el_codegen_data.function_dir / "az_el_from_point_kernel.h").read_text().split()
+        )
+        self.assertIn(
+            "voidAzElFromPointKernel(constsize_tcount,constsize_tstride,"
+            "constScalar*const__restrict__nav_T_cam,constScalar*const__restrict__nav_t_point,"
+            "constScalar*const__restrict__epsilon,Scalar*const__restrict__res)",
+            kernel,
+        )
+        self.assertIn("for(size_tk=0;k<count;k++)", kernel)
+        # Geo types are flattened to their storage, one array per entry
+        self.assertIn("nav_T_cam[k]", kernel)
+        self.assertIn("nav_T_cam[6*stride+k]", kernel)
+        self.assertIn("res[1*stride+k]=", kernel)
+        # Uniform arguments have a single copy
+        self.assertIn("epsilon[0]", kernel)
+        self.assertNotIn("epsilon[k]", kernel)
+
+        with self.assertRaises(codegen.codegen.CodeGenerationException):
+            codegen.Codegen.function(
+                func=az_el_from_point,
+                config=codegen.CppConfig(generate_kernel=True, kernel_uniform_args=["eps"]),
+            ).generate_function(output_dir=output_dir)
+
     def test_cpp_nan(self) -> None:
         inputs = Values()
         inputs["R1"] = sf.Rot3.symbolic("R1")
@@ -911,6 +989,163 @@ class SymforceCodegenTest(TestCase):
             expected_dir=TEST_DATA_DIR / "with_jacobians",
         )
 
+    def test_with_linearization_lower_triangular_hessian(self) -> None:
+        """
+        Tests:
+            Codegen.with_linearization with lower_triangular_hessian=True
+        """
+
+        def residual(a: sf.V2, b: sf.V2) -> sf.V3:
+            return sf.V3(a[0] * b[1], a[1] - b[0], a[0] + a[1] * b[1])
+
+        linearization = codegen.Codegen.function(
+            func=residual, config=codegen.CppConfig()
+        ).with_linearization(lower_triangular_hessian=True)
+
+        self.assertEqual(linearization.lower_triangular_matrices, {"hessian"})
+
+        output_dir = self.make_output_dir("sf_codegen_lower_triangular_hessian_")
+        codegen_data = linearization.generate_function(output_dir=output_dir)
+        generated = (codegen_data.function_dir / "residual_factor.h").read_text()
+
+        # Only the lower triangle of the hessian is written
+        for i in range(4):
+            for j in range(4):
+                self.assertEqual(f"_hessian({i}, {j}) =" in generated, i >= j)
+
+        # The jacobian is still written in full
+        self.assertIn("_jacobian(0, 3) =", generated)
+
+        # Outputs with nonzero upper triangles are rejected
+        with self.assertRaises(AssertionError):
+            codegen.Codegen(
+                inputs=Values(a=sf.Symbol("a")),
+                outputs=Values(out=sf.M22([[1, sf.Symbol("a")], [0, 1]])),
+                config=codegen.CppConfig(),
+                name="not_lower_triangular",
+                lower_triangular_matrices=["out"],
+            )
+
+    def test_cost_model(self) -> None:
+        """
+        Tests:
+            CostModel.cost
+            CostModel.optimize_terms
+            Codegen with config.cost_model set
+        """
+        x, y, z = sf.symbols("x y z")
+        cost_model = codegen.CostModel()
+
+        self.assertEqual(cost_model.cost(x + y), cost_model.add)
+        self.assertEqual(cost_model.cost(x - y), cost_model.add)
+        self.assertEqual(cost_model.cost(x / y), cost_model.div)
+        self.assertEqual(cost_model.cost(sf.sin(x)), cost_model.transcendental)
+        self.assertEqual(cost_model.cost(x ** 2), cost_model.mul)
+        self.assertEqual(cost_model.cost(x ** (-sf.S.One / 2)), cost_model.div + cost_model.sqrt)
+        self.assertEqual(cost_model.cost(x ** y), cost_model.pow)
+
+        # By default temporaries are only renumbered in order of first use
+        tmp0, tmp1, tmp2 = sf.symbols("_tmp0 _tmp1 _tmp2")
+        terms = (
+            [(tmp0, sf.sin(x)), (tmp1, sf.cos(y)), (tmp2, tmp0 + z)],
+            [[(sf.Symbol("out0"), tmp1 * tmp2), (sf.Symbol("out1"), tmp1 + x)]],
+        )
+        intermediate_terms, output_terms = cost_model.optimize_terms(*terms)
+        self.assertEqual(
+            intermediate_terms, [(tmp0, sf.cos(y)), (tmp1, sf.sin(x)), (tmp2, tmp1 + z)]
+        )
+        self.assertEqual(
+            output_terms, [[(sf.Symbol("out0"), tmp0 * tmp2), (sf.Symbol("out1"), tmp0 + x)]]
+        )
+
+        # Optionally, single use temporaries are inlined
+        inlining_cost_model = codegen.CostModel(inline_single_use=True)
+        intermediate_terms, output_terms = inlining_cost_model.optimize_terms(*terms)
+        self.assertEqual(intermediate_terms, [(tmp0, sf.cos(y))])
+        self.assertEqual(
+            output_terms,
+            [[(sf.Symbol("out0"), tmp0 * (sf.sin(x) + z)), (sf.Symbol("out1"), tmp0 + x)]],
+        )
+
+        # Generated code computes the same thing with and without the cost model
+        output_dir = self.make_output_dir("sf_codegen_cost_model_")
+        functions = []
+        for i, cost_model_or_none in enumerate((None, cost_model)):
+            codegen_data = codegen.Codegen.function(
+                func=az_el_from_point,
+                config=codegen.PythonConfig(cost_model=cost_model_or_none),
+            ).generate_function(output_dir=output_dir / str(i))
+            functions.append(
+                codegen_util.load_generated_function("az_el_from_point", codegen_data.function_dir)
+            )
+
+        rng = np.random.default_rng(42)
+        for _ in range(10):
+            nav_T_cam = sym.Pose3.from_tangent(rng.normal(size=6))
+            nav_t_point = rng.normal(size=3)
+            np.testing.assert_allclose(
+                functions[0](nav_T_cam, nav_t_point, 1e-9),
+                functions[1](nav_T_cam, nav_t_point, 1e-9),
+            )
+
+        # The C++ header reports the estimated cycles
+        cpp_codegen = codegen.Codegen.function(
+            func=az_el_from_point, config=codegen.CppConfig(cost_model=cost_model)
+        )
+        codegen_data = cpp_codegen.generate_function(output_dir=output_dir / "cpp")
+        generated = (codegen_data.function_dir / "az_el_from_point.h").read_text()
+        self.assertIn(f"// Estimated cycles: {cpp_codegen.estimated_cycles()}", generated)
+
+        # Without a cost model, nothing is estimated
+        cpp_codegen = codegen.Codegen.function(func=az_el_from_point, config=codegen.CppConfig())
+        with self.assertRaises(ValueError):
+            cpp_codegen.estimated_cycles()
+
+    def test_codegen_cache(self) -> None:
+        """
+        Tests:
+            cache_util.cached
+            Codegen.generate_function with the cache enabled
+        """
+        cache_dir = self.make_output_dir("sf_codegen_cache_")
+        output_dir = self.make_output_dir("sf_codegen_cache_output_")
+
+        def generate(config: codegen.CodegenConfig, name: str) -> str:
+            codegen_data = codegen.Codegen.function(
+                func=az_el_from_point, config=config
+            ).generate_function(output_dir=output_dir / name)
+            return (codegen_data.function_dir / "az_el_from_point.h").read_text()
+
+        def num_print_code_entries() -> int:
+            return sum(1 for path in (cache_dir / "print_code").rglob("*") if path.is_file())
+
+        cache_util.set_cache_dir(cache_dir)
+        try:
+            generated = generate(codegen.CppConfig(), "first")
+            self.assertEqual(num_print_code_entries(), 1)
+
+            # The second time, neither CSE nor formatting runs
+            with unittest.mock.patch.object(
+                codegen_util, "perform_cse", side_effect=AssertionError("CSE should be cached")
+            ), unittest.mock.patch.object(
+                python_util,
+                "execute_subprocess",
+                side_effect=AssertionError("Formatting should be cached"),
+            ):
+                self.assertEqual(generate(codegen.CppConfig(), "second"), generated)
+
+            # A different config is a different entry
+            generate(codegen.CppConfig(support_complex=True), "complex")
+            self.assertEqual(num_print_code_entries(), 2)
+        finally:
+            cache_util.set_cache_dir(None)
+
+        # Symbols with the same name are distinguished by their assumptions
+        self.assertNotEqual(
+            cache_util.stable_repr(sympy.Symbol("x") + 1),
+            cache_util.stable_repr(sympy.Symbol("x", positive=True) + 1),
+        )
+
     def test_with_jacobians_values(self) -> None:
         """
         Tests:
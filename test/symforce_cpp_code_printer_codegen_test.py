@@ -37,15 +37,46 @@ class SymforceCppCodePrinterTest(TestCase):
         expr: sf.Expr = sf.Max(a ** 2, b ** 2)
         self.assertEqual(
             printer.doprint(expr),
-            "std::max<Scalar>(std::pow(a, Scalar(2)), std::pow(b, Scalar(2)))",
+            "std::max<Scalar>((a * a), (b * b))",
         )
 
         expr = sf.Min(a ** 2, b ** 2)
         self.assertEqual(
             printer.doprint(expr),
-            "std::min<Scalar>(std::pow(a, Scalar(2)), std::pow(b, Scalar(2)))",
+            "std::min<Scalar>((a * a), (b * b))",
         )
 
+    def test_pow(self) -> None:
+        printer = codegen.CppConfig().printer()
+
+        x = sf.Symbol("x")
+        y = sf.Symbol("y")
+
+        # Small integer powers are multiplies and divides
+        self.assertEqual(printer.doprint(x ** 2), "(x * x)")
+        self.assertEqual(printer.doprint(x ** 4), "(x * x * x * x)")
+        self.assertEqual(printer.doprint(x ** -3), "Scalar(1.0) / (x * x * x)")
+        self.assertEqual(printer.doprint(x ** -1), "Scalar(1.0) / (x)")
+
+        # Non-symbol bases are only evaluated once
+        self.assertEqual(
+            printer.doprint((x + y) ** 2),
+            "[&]() { const Scalar base = x + y; return base * base; }()",
+        )
+
+        # Half-integer powers are square roots
+        self.assertEqual(printer.doprint(x ** sf.Rational(1, 2)), "std::sqrt(x)")
+        self.assertEqual(printer.doprint(x ** sf.Rational(-1, 2)), "Scalar(1.0) / std::sqrt(x)")
+        self.assertEqual(printer.doprint(x ** sf.Rational(3, 2)), "(x * std::sqrt(x))")
+        self.assertEqual(
+            printer.doprint((x + y) ** sf.Rational(-3, 2)),
+            "Scalar(1.0) / (Scalar(x + y) * std::sqrt(Scalar(x + y)))",
+        )
+
+        # Anything else is std::pow
+        self.assertEqual(printer.doprint(x ** 5), "std::pow(x, Scalar(5))")
+        self.assertEqual(printer.doprint(x ** y), "std::pow(x, y)")
+
     @sympy_only
     def test_heaviside(self) -> None:
         output_dir = self.make_output_dir("sf_heaviside_test_")
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include <symforce/examples/bundle_adjustment_in_the_large/bal_parser.h>
+
+#include "temp_directory.h"
+
+using bundle_adjustment_in_the_large::BalData;
+
+namespace {
+
+/**
+ * Write a random problem to filename in the BAL text format, with some extra whitespace
+ */
+BalData WriteRandomProblem(const std::string& filename, const int num_cameras, const int num_points,
+                           const int num_observations) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+
+  BalData data{num_cameras, num_points, num_observations, {}, {}, {}, {}, {}};
+  std::ofstream file(filename);
+  file << num_cameras << " " << num_points << "  " << num_observations << "\n";
+  for (int i = 0; i < num_observations; i++) {
+    data.observation_cameras.push_back(i % num_cameras);
+    data.observation_points.push_back(i % num_points);
+    data.pixels.push_back(dist(gen));
+    data.pixels.push_back(dist(gen));
+    file << fmt::format("{} {}     {:.17e} {:.17e}\n", data.observation_cameras.back(),
+                        data.observation_points.back(), data.pixels[2 * i], data.pixels[2 * i + 1]);
+  }
+  for (int i = 0; i < 9 * num_cameras; i++) {
+    data.cameras.push_back(dist(gen));
+    file << fmt::format("{:.17g}\n", data.cameras.back());
+  }
+  for (int i = 0; i < 3 * num_points; i++) {
+    data.points.push_back(dist(gen));
+    file << fmt::format("{:.17g}\t\n", data.points.back());
+  }
+
+  return data;
+}
+
+void CheckEqual(const BalData& a, const BalData& b) {
+  CHECK(a.num_cameras == b.num_cameras);
+  CHECK(a.num_points == b.num_points);
+  CHECK(a.num_observations == b.num_observations);
+  CHECK(a.observation_cameras == b.observation_cameras);
+  CHECK(a.observation_points == b.observation_points);
+  CHECK(a.pixels == b.pixels);
+  CHECK(a.cameras == b.cameras);
+  CHECK(a.points == b.points);
+}
+
+}  // namespace
+
+TEST_CASE("ParseBalFile parses BAL files on any number of threads", "[bal]") {
+  const symforce_test::TempDirectory directory("symforce_bal_test");
+  const std::string filename = directory.File("problem.txt");
+  // Big enough to be split into several chunks
+  const BalData expected = WriteRandomProblem(filename, 20, 3000, 30000);
+
+  for (const int num_threads : {1, 3}) {
+    CheckEqual(bundle_adjustment_in_the_large::ParseBalFile(filename, num_threads), expected);
+  }
+}
+
+TEST_CASE("ParseBalFile rejects invalid files", "[bal]") {
+  const symforce_test::TempDirectory directory("symforce_bal_test");
+  const std::string filename = directory.File("invalid.txt");
+
+  std::ofstream(filename) << "1 1 1\n0 0 1.0 2.0\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+
+  std::ofstream(filename) << "1 1 1\n0 0 1.0 abc 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+
+  // Observations of cameras or points that aren't in the file
+  std::ofstream(filename) << "1 1 1\n1 0 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+  std::ofstream(filename) << "1 1 1\n0 -1 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+
+  // Counts and indices that aren't integers
+  std::ofstream(filename) << "1 1 1\n0.5 0 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+  std::ofstream(filename) << "1 1 1\n0 0e0 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+  std::ofstream(filename) << "1 1.5 1\n0 0 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+  std::ofstream(filename) << "1 1 1e9\n0 0 1.0 2.0 1 2 3 4 5 6 7 8 9 1 2 3\n";
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(filename), std::runtime_error);
+
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ParseBalFile(directory.File("missing.txt")),
+                  std::runtime_error);
+}
+
+TEST_CASE("BAL cache round trips", "[bal]") {
+  const symforce_test::TempDirectory directory("symforce_bal_test");
+  const std::string filename = directory.File("problem.txt");
+  const std::string cache_filename = directory.File("problem.cache");
+  const BalData expected = WriteRandomProblem(filename, 3, 10, 50);
+
+  CHECK(!bundle_adjustment_in_the_large::BalCacheIsCurrent(cache_filename, filename));
+  bundle_adjustment_in_the_large::WriteBalCache(expected, filename, cache_filename);
+  CHECK(bundle_adjustment_in_the_large::BalCacheIsCurrent(cache_filename, filename));
+  CheckEqual(bundle_adjustment_in_the_large::ReadBalCache(cache_filename), expected);
+
+  // The text file isn't a cache
+  CHECK(!bundle_adjustment_in_the_large::BalCacheIsCurrent(filename, filename));
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ReadBalCache(filename), std::runtime_error);
+
+  // The cache is stale once the source changes
+  WriteRandomProblem(filename, 3, 10, 60);
+  CHECK(!bundle_adjustment_in_the_large::BalCacheIsCurrent(cache_filename, filename));
+
+  // Observations of cameras that aren't in the cache
+  BalData invalid = expected;
+  invalid.observation_cameras[7] = invalid.num_cameras;
+  bundle_adjustment_in_the_large::WriteBalCache(invalid, filename, cache_filename);
+  CHECK_THROWS_AS(bundle_adjustment_in_the_large::ReadBalCache(cache_filename), std::runtime_error);
+}
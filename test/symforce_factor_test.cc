@@ -3,6 +3,9 @@
  * This source code is under the Apache 2.0 license found in the LICENSE file.
  * ---------------------------------------------------------------------------- */
 
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -16,8 +19,11 @@
 #include <lcmtypes/sym/index_entry_t.hpp>
 #include <lcmtypes/sym/linearized_dense_factor_t.hpp>
 
+#include <sym/factors/between_factor_pose3.h>
 #include <symforce/opt/factor.h>
+#include <symforce/opt/fixed_factor.h>
 #include <symforce/opt/key.h>
+#include <symforce/opt/linearizer.h>
 
 TEST_CASE("Test jacobian constructors", "[factors]") {
   spdlog::debug("*** TestJacobianConstructors() ***");
@@ -853,3 +859,175 @@ TEMPLATE_TEST_CASE("Test factor maybe_index_entry_cache", "[factors]", double, f
     CHECK_THROWS(factor.Linearize(values, &cache));
   }
 }
+
+TEMPLATE_TEST_CASE("Test FixedFactor matches Factor::Hessian", "[factors]", double, float) {
+  using Scalar = TestType;
+
+  std::mt19937 gen(42);
+  sym::Values<Scalar> values;
+  values.Set('a', sym::Pose3<Scalar>::Random(gen));
+  values.Set('b', sym::Pose3<Scalar>::Random(gen));
+  values.Set('c', sym::Pose3<Scalar>::Random(gen));
+  values.Set('s', sym::Matrix66<Scalar>(2 * sym::Matrix66<Scalar>::Identity()));
+  values.Set('e', sym::kDefaultEpsilon<Scalar>);
+
+  const std::vector<sym::Key> keys = {'a', 'b', 'c', 's', 'e'};
+  const auto fixed_factor =
+      sym::MakeFixedFactor<Scalar>(sym::BetweenFactorPose3<Scalar>, keys, {'b', 'a'});
+  const sym::Factor<Scalar> factor =
+      sym::Factor<Scalar>::Hessian(sym::BetweenFactorPose3<Scalar>, keys, {'b', 'a'});
+
+  CHECK(fixed_factor.AllKeys() == factor.AllKeys());
+  CHECK(fixed_factor.OptimizedKeys() == factor.OptimizedKeys());
+
+  const auto expected = factor.Linearize(values);
+
+  // Fixed-size outputs, with and without an index entry cache
+  const std::vector<sym::index_entry_t> cache = values.CreateIndex(keys).entries;
+  sym::Vector6<Scalar> residual;
+  Eigen::Matrix<Scalar, 6, 12> jacobian;
+  Eigen::Matrix<Scalar, 12, 12> hessian;
+  Eigen::Matrix<Scalar, 12, 1> rhs;
+  fixed_factor.Linearize(values, &residual, &jacobian, &hessian, &rhs, &cache);
+  CHECK(residual == expected.residual);
+  CHECK(jacobian == expected.jacobian);
+  CHECK(hessian.template triangularView<Eigen::Lower>().toDenseMatrix() ==
+        expected.hessian.template triangularView<Eigen::Lower>().toDenseMatrix());
+  CHECK(rhs == expected.rhs);
+
+  sym::Vector6<Scalar> residual_only;
+  fixed_factor.Linearize(values, &residual_only);
+  CHECK(residual_only == expected.residual);
+
+  // Dense linearized factor, directly and through the type-erased Factor
+  typename sym::Factor<Scalar>::LinearizedDenseFactor linearized_factor{};
+  fixed_factor.Linearize(values, linearized_factor, &cache);
+  CHECK(linearized_factor.residual == expected.residual);
+  CHECK(linearized_factor.jacobian == expected.jacobian);
+  CHECK(linearized_factor.hessian.template triangularView<Eigen::Lower>().toDenseMatrix() ==
+        expected.hessian.template triangularView<Eigen::Lower>().toDenseMatrix());
+  CHECK(linearized_factor.rhs == expected.rhs);
+
+  const auto erased = fixed_factor.ToFactor().Linearize(values);
+  CHECK(erased.residual == expected.residual);
+  CHECK(erased.rhs == expected.rhs);
+
+  // Outputs of the right size are written in place, by both
+  const std::vector<const Scalar*> output_data = {
+      linearized_factor.residual.data(), linearized_factor.jacobian.data(),
+      linearized_factor.hessian.data(), linearized_factor.rhs.data()};
+  fixed_factor.Linearize(values, linearized_factor, &cache);
+  fixed_factor.ToFactor().Linearize(values, linearized_factor, &cache);
+  CHECK(output_data == std::vector<const Scalar*>{
+                           linearized_factor.residual.data(), linearized_factor.jacobian.data(),
+                           linearized_factor.hessian.data(), linearized_factor.rhs.data()});
+  CHECK(linearized_factor.residual == expected.residual);
+  CHECK(linearized_factor.jacobian == expected.jacobian);
+  CHECK(linearized_factor.rhs == expected.rhs);
+
+  // Using the wrong size cache throws
+  std::vector<sym::index_entry_t> bad_cache = cache;
+  bad_cache.pop_back();
+  CHECK_THROWS(fixed_factor.Linearize(values, &residual, &jacobian, &hessian, &rhs, &bad_cache));
+
+  // Using the wrong keys throws
+  const auto wrong_types = sym::MakeFixedFactor<Scalar>(sym::BetweenFactorPose3<Scalar>,
+                                                        {'a', 'b', 'c', 'e', 's'}, {'a', 'b'});
+  CHECK_THROWS(wrong_types.Linearize(values, &residual));
+}
+
+TEMPLATE_TEST_CASE("Test fixed size Eigen arguments are read in place from Values", "[factors]",
+                   double, float) {
+  using Scalar = TestType;
+
+  sym::Values<Scalar> values;
+  values.Set('x', sym::Vector3<Scalar>(1, 2, 3));
+  // Offset the next entry by one Scalar from 'x', so that exactly one of 'm' and 'n' is aligned
+  // for Eigen's vectorized operations
+  values.Set('m', sym::Matrix22<Scalar>(sym::Matrix22<Scalar>::Identity()));
+  values.Set('s', Scalar(2));
+  values.Set('n', sym::Matrix22<Scalar>(3 * sym::Matrix22<Scalar>::Identity()));
+
+  const Scalar* const data = values.Data().data();
+  const Scalar* x_address = nullptr;
+  std::vector<const Scalar*> matrix_addresses;
+
+  const auto factor = sym::Factor<Scalar>::Jacobian(
+      [&](const sym::Vector3<Scalar>& x, const sym::Matrix22<Scalar>& m, Scalar s,
+          const sym::Matrix22<Scalar>& n, sym::Vector3<Scalar>* const res,
+          sym::Matrix33<Scalar>* const jac) {
+        x_address = x.data();
+        matrix_addresses = {m.data(), n.data()};
+        (*res) = s * (m + n).trace() * x;
+        if (jac != nullptr) {
+          (*jac) = s * (m + n).trace() * sym::Matrix33<Scalar>::Identity();
+        }
+      },
+      {'x', 'm', 's', 'n'}, {'x'});
+
+  const auto linearized = factor.Linearize(values);
+  CHECK(linearized.residual == sym::Vector3<Scalar>(16, 32, 48));
+
+  // Vectors with no special alignment requirement are never copied
+  CHECK(x_address == data + values.IndexEntryAt('x').offset);
+
+  // Matrices with stricter alignment requirements are referenced in place when aligned, and
+  // copied out otherwise
+  for (const auto& key_and_address :
+       {std::make_pair(sym::Key('m'), matrix_addresses[0]),
+        std::make_pair(sym::Key('n'), matrix_addresses[1])}) {
+    const Scalar* const storage = data + values.IndexEntryAt(key_and_address.first).offset;
+    const bool aligned =
+        reinterpret_cast<std::uintptr_t>(storage) % alignof(sym::Matrix22<Scalar>) == 0;
+    CHECK((key_and_address.second == storage) == aligned);
+  }
+}
+
+TEMPLATE_TEST_CASE("Test factors generated with lower triangular hessians", "[factors]", double,
+                   float) {
+  using Scalar = TestType;
+
+  std::mt19937 gen(42);
+  sym::Values<Scalar> values;
+  values.Set('a', sym::Pose3<Scalar>::Random(gen));
+  values.Set('b', sym::Pose3<Scalar>::Random(gen));
+  values.Set('c', sym::Pose3<Scalar>::Random(gen));
+  values.Set('s', sym::Matrix66<Scalar>(2 * sym::Matrix66<Scalar>::Identity()));
+  values.Set('e', sym::kDefaultEpsilon<Scalar>);
+
+  // BetweenFactorPose3 only writes the lower triangle of its hessian
+  const std::vector<sym::Key> keys = {'a', 'b', 'c', 's', 'e'};
+  const sym::Factor<Scalar> factor =
+      sym::Factor<Scalar>::Hessian(sym::BetweenFactorPose3<Scalar>, keys, {'a', 'b'});
+
+  const auto linearized = factor.Linearize(values);
+  const sym::MatrixX<Scalar> jtj = linearized.jacobian.transpose() * linearized.jacobian;
+  const Scalar tolerance = std::is_same<Scalar, float>::value ? 1e-4 : 1e-10;
+  CHECK(linearized.hessian.template triangularView<Eigen::Lower>().toDenseMatrix().isApprox(
+      jtj.template triangularView<Eigen::Lower>().toDenseMatrix(), tolerance));
+
+  // Freshly allocated outputs have a zero upper triangle
+  CHECK(linearized.hessian.template triangularView<Eigen::StrictlyUpper>().toDenseMatrix() ==
+        sym::MatrixX<Scalar>::Zero(12, 12));
+
+  // Reused outputs only have their lower triangle overwritten
+  auto reused = linearized;
+  reused.hessian.setConstant(-1);
+  factor.Linearize(values, reused);
+  CHECK(reused.hessian.template triangularView<Eigen::Lower>().toDenseMatrix() ==
+        linearized.hessian.template triangularView<Eigen::Lower>().toDenseMatrix());
+  bool upper_unchanged = true;
+  for (int col = 0; col < 12; col++) {
+    for (int row = 0; row < col; row++) {
+      upper_unchanged &= reused.hessian(row, col) == -1;
+    }
+  }
+  CHECK(upper_unchanged);
+
+  // The Linearizer only consumes the lower triangle
+  const sym::Linearization<Scalar> linearization =
+      sym::Linearize<Scalar>({factor}, values, {'a', 'b'});
+  const sym::MatrixX<Scalar> hessian_lower = linearization.hessian_lower;
+  CHECK(hessian_lower.isApprox(jtj.template triangularView<Eigen::Lower>().toDenseMatrix(),
+                               tolerance));
+}
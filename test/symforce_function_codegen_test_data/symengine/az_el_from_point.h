@@ -39,8 +39,8 @@ Eigen::Matrix<Scalar, 2, 1> AzElFromPoint(const sym::Pose3<Scalar>& nav_T_cam,
   const Scalar _tmp2 = 2 * _nav_T_cam[1];
   const Scalar _tmp3 = _nav_T_cam[2] * _tmp2;
   const Scalar _tmp4 = _tmp1 + _tmp3;
-  const Scalar _tmp5 = -2 * std::pow(_nav_T_cam[0], Scalar(2));
-  const Scalar _tmp6 = 1 - 2 * std::pow(_nav_T_cam[2], Scalar(2));
+  const Scalar _tmp5 = -2 * (_nav_T_cam[0] * _nav_T_cam[0]);
+  const Scalar _tmp6 = 1 - 2 * (_nav_T_cam[2] * _nav_T_cam[2]);
   const Scalar _tmp7 = _tmp5 + _tmp6;
   const Scalar _tmp8 = _nav_T_cam[1] * _tmp0;
   const Scalar _tmp9 = 2 * _nav_T_cam[2] * _nav_T_cam[3];
@@ -48,7 +48,7 @@ Eigen::Matrix<Scalar, 2, 1> AzElFromPoint(const sym::Pose3<Scalar>& nav_T_cam,
   const Scalar _tmp11 = -_nav_T_cam[4] * _tmp10 - _nav_T_cam[5] * _tmp7 - _nav_T_cam[6] * _tmp4 +
                         _tmp10 * nav_t_point(0, 0) + _tmp4 * nav_t_point(2, 0) +
                         _tmp7 * nav_t_point(1, 0);
-  const Scalar _tmp12 = -2 * std::pow(_nav_T_cam[1], Scalar(2));
+  const Scalar _tmp12 = -2 * (_nav_T_cam[1] * _nav_T_cam[1]);
   const Scalar _tmp13 = _tmp12 + _tmp6;
   const Scalar _tmp14 = _tmp8 + _tmp9;
   const Scalar _tmp15 = _nav_T_cam[3] * _tmp2;
@@ -69,9 +69,8 @@ Eigen::Matrix<Scalar, 2, 1> AzElFromPoint(const sym::Pose3<Scalar>& nav_T_cam,
 
   _res(0, 0) =
       std::atan2(_tmp11, _tmp18 + epsilon * ((((_tmp18) > 0) - ((_tmp18) < 0)) + Scalar(0.5)));
-  _res(1, 0) = -std::acos(_tmp22 / std::sqrt(Scalar(std::pow(_tmp11, Scalar(2)) +
-                                                    std::pow(_tmp18, Scalar(2)) +
-                                                    std::pow(_tmp22, Scalar(2)) + epsilon))) +
+  _res(1, 0) = -std::acos(_tmp22 / std::sqrt(Scalar((_tmp11 * _tmp11) + (_tmp18 * _tmp18) +
+                                                    (_tmp22 * _tmp22) + epsilon))) +
                Scalar(M_PI_2);
 
   return _res;
@@ -0,0 +1,96 @@
+// -----------------------------------------------------------------------------
+// This file was autogenerated by symforce from template:
+//     function/FUNCTION_BATCHED.h.jinja
+// Do NOT modify by hand.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Dense>
+
+// Only GCC and Clang support the flatten attribute
+#ifndef SYM_BATCHED_FLATTEN
+#if defined(__GNUC__) || defined(__clang__)
+#define SYM_BATCHED_FLATTEN __attribute__((flatten))
+#else
+#define SYM_BATCHED_FLATTEN
+#endif
+#endif
+
+namespace sym {
+
+/**
+ * Batched variant of AzElFromPoint, which evaluates Width instances of it at once.
+ *
+ * Every argument is in structure-of-arrays layout: an argument with storage dimension D is an
+ * Eigen::Array<Scalar, Width, D>, where column i holds entry i of the storage of every instance
+ * (matrices are stored column-major).  Scalars are Eigen::Array<Scalar, Width, 1>.  All outputs,
+ * including the one returned by AzElFromPoint, are optional pointer arguments.
+ *
+ * Transform a nav point into azimuth / elevation angles in the
+ * camera frame.
+ *
+ * Args:
+ *     nav_T_cam (sf.Pose3): camera pose in the world
+ *     nav_t_point (sf.Matrix): nav point
+ *     epsilon (Scalar): small number to avoid singularities
+ *
+ * Returns:
+ *     sf.Matrix: (azimuth, elevation)
+ */
+template <typename Scalar, int Width>
+SYM_BATCHED_FLATTEN void AzElFromPointBatched(const Eigen::Array<Scalar, Width, 7>& nav_T_cam,
+                                              const Eigen::Array<Scalar, Width, 3>& nav_t_point,
+                                              const Eigen::Array<Scalar, Width, 1>& epsilon,
+                                              Eigen::Array<Scalar, Width, 2>* const res = nullptr) {
+  using Lanes = Eigen::Array<Scalar, Width, 1>;
+
+  // Total ops: 77
+
+  // Intermediate terms (23)
+  const Lanes _tmp0 = 2 * nav_T_cam.col(0);
+  const Lanes _tmp1 = _tmp0 * nav_T_cam.col(3);
+  const Lanes _tmp2 = 2 * nav_T_cam.col(1);
+  const Lanes _tmp3 = _tmp2 * nav_T_cam.col(2);
+  const Lanes _tmp4 = _tmp1 + _tmp3;
+  const Lanes _tmp5 = -2 * (nav_T_cam.col(0)).square();
+  const Lanes _tmp6 = 1 - 2 * (nav_T_cam.col(2)).square();
+  const Lanes _tmp7 = _tmp5 + _tmp6;
+  const Lanes _tmp8 = _tmp0 * nav_T_cam.col(1);
+  const Lanes _tmp9 = 2 * nav_T_cam.col(2) * nav_T_cam.col(3);
+  const Lanes _tmp10 = _tmp8 - _tmp9;
+  const Lanes _tmp11 = -_tmp10 * nav_T_cam.col(4) + _tmp10 * nav_t_point.col(0) -
+                       _tmp4 * nav_T_cam.col(6) + _tmp4 * nav_t_point.col(2) -
+                       _tmp7 * nav_T_cam.col(5) + _tmp7 * nav_t_point.col(1);
+  const Lanes _tmp12 = -2 * (nav_T_cam.col(1)).square();
+  const Lanes _tmp13 = _tmp12 + _tmp6;
+  const Lanes _tmp14 = _tmp8 + _tmp9;
+  const Lanes _tmp15 = _tmp2 * nav_T_cam.col(3);
+  const Lanes _tmp16 = _tmp0 * nav_T_cam.col(2);
+  const Lanes _tmp17 = -_tmp15 + _tmp16;
+  const Lanes _tmp18 = -_tmp13 * nav_T_cam.col(4) + _tmp13 * nav_t_point.col(0) -
+                       _tmp14 * nav_T_cam.col(5) + _tmp14 * nav_t_point.col(1) -
+                       _tmp17 * nav_T_cam.col(6) + _tmp17 * nav_t_point.col(2);
+  const Lanes _tmp19 = -_tmp1 + _tmp3;
+  const Lanes _tmp20 = _tmp12 + _tmp5 + 1;
+  const Lanes _tmp21 = _tmp15 + _tmp16;
+  const Lanes _tmp22 = -_tmp19 * nav_T_cam.col(5) + _tmp19 * nav_t_point.col(1) -
+                       _tmp20 * nav_T_cam.col(6) + _tmp20 * nav_t_point.col(2) -
+                       _tmp21 * nav_T_cam.col(4) + _tmp21 * nav_t_point.col(0);
+
+  // Output terms (1)
+  if (res != nullptr) {
+    Eigen::Array<Scalar, Width, 2>& _res = (*res);
+
+    _res.col(0) =
+        (_tmp11).binaryExpr((_tmp18 + epsilon * ((_tmp18).sign() + Scalar(0.5))),
+                            [](const Scalar a, const Scalar b) { return std::atan2(a, b); });
+    _res.col(1) =
+        -(_tmp22 / ((_tmp11).square() + (_tmp18).square() + (_tmp22).square() + epsilon).sqrt())
+             .acos() +
+        Scalar(M_PI_2);
+  }
+
+}  // NOLINT(readability/fn_size)
+
+}  // namespace sym
@@ -68,7 +68,7 @@ void CodegenExplicitTemplateInstantiationTest(
   const Eigen::Matrix<Scalar, 4, 1>& _rot = rot.Data();
 
   // Intermediate terms (66)
-  const Scalar _tmp0 = std::pow(x, Scalar(2));
+  const Scalar _tmp0 = (x * x);
   const Scalar _tmp1 = 2 * values_vec[0].rot.data()[3];
   const Scalar _tmp2 = 2 * values_vec[0].rot_vec[0].data()[3];
   const Scalar _tmp3 = 2 * values_vec[0].rot_vec[1].data()[3];
@@ -165,34 +165,35 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].rot.data()[0] = _tmp1 * values_vec[0].rot.data()[0];
     _values_vec_out[0].rot.data()[1] = _tmp1 * values_vec[0].rot.data()[1];
     _values_vec_out[0].rot.data()[2] = _tmp1 * values_vec[0].rot.data()[2];
-    _values_vec_out[0].rot.data()[3] = -std::pow(values_vec[0].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[0].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[0].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[0].rot.data()[3], Scalar(2));
+    _values_vec_out[0].rot.data()[3] =
+        -(values_vec[0].rot.data()[0] * values_vec[0].rot.data()[0]) -
+        (values_vec[0].rot.data()[1] * values_vec[0].rot.data()[1]) -
+        (values_vec[0].rot.data()[2] * values_vec[0].rot.data()[2]) +
+        (values_vec[0].rot.data()[3] * values_vec[0].rot.data()[3]);
     _values_vec_out[0].rot_vec[0].data()[0] = _tmp2 * values_vec[0].rot_vec[0].data()[0];
     _values_vec_out[0].rot_vec[0].data()[1] = _tmp2 * values_vec[0].rot_vec[0].data()[1];
     _values_vec_out[0].rot_vec[0].data()[2] = _tmp2 * values_vec[0].rot_vec[0].data()[2];
     _values_vec_out[0].rot_vec[0].data()[3] =
-        -std::pow(values_vec[0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[0].data()[0] * values_vec[0].rot_vec[0].data()[0]) -
+        (values_vec[0].rot_vec[0].data()[1] * values_vec[0].rot_vec[0].data()[1]) -
+        (values_vec[0].rot_vec[0].data()[2] * values_vec[0].rot_vec[0].data()[2]) +
+        (values_vec[0].rot_vec[0].data()[3] * values_vec[0].rot_vec[0].data()[3]);
     _values_vec_out[0].rot_vec[1].data()[0] = _tmp3 * values_vec[0].rot_vec[1].data()[0];
     _values_vec_out[0].rot_vec[1].data()[1] = _tmp3 * values_vec[0].rot_vec[1].data()[1];
     _values_vec_out[0].rot_vec[1].data()[2] = _tmp3 * values_vec[0].rot_vec[1].data()[2];
     _values_vec_out[0].rot_vec[1].data()[3] =
-        -std::pow(values_vec[0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[1].data()[0] * values_vec[0].rot_vec[1].data()[0]) -
+        (values_vec[0].rot_vec[1].data()[1] * values_vec[0].rot_vec[1].data()[1]) -
+        (values_vec[0].rot_vec[1].data()[2] * values_vec[0].rot_vec[1].data()[2]) +
+        (values_vec[0].rot_vec[1].data()[3] * values_vec[0].rot_vec[1].data()[3]);
     _values_vec_out[0].rot_vec[2].data()[0] = _tmp4 * values_vec[0].rot_vec[2].data()[0];
     _values_vec_out[0].rot_vec[2].data()[1] = _tmp4 * values_vec[0].rot_vec[2].data()[1];
     _values_vec_out[0].rot_vec[2].data()[2] = _tmp4 * values_vec[0].rot_vec[2].data()[2];
     _values_vec_out[0].rot_vec[2].data()[3] =
-        -std::pow(values_vec[0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[2].data()[0] * values_vec[0].rot_vec[2].data()[0]) -
+        (values_vec[0].rot_vec[2].data()[1] * values_vec[0].rot_vec[2].data()[1]) -
+        (values_vec[0].rot_vec[2].data()[2] * values_vec[0].rot_vec[2].data()[2]) +
+        (values_vec[0].rot_vec[2].data()[3] * values_vec[0].rot_vec[2].data()[3]);
     _values_vec_out[0].scalar_vec[0] = 2 * values_vec[0].scalar_vec[0];
     _values_vec_out[0].scalar_vec[1] = 2 * values_vec[0].scalar_vec[1];
     _values_vec_out[0].scalar_vec[2] = 2 * values_vec[0].scalar_vec[2];
@@ -203,10 +204,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[0][0].data()[2] =
         _tmp5 * values_vec[0].list_of_lists[0][0].data()[2];
     _values_vec_out[0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][0].data()[0] *
+          values_vec[0].list_of_lists[0][0].data()[0]) -
+        (values_vec[0].list_of_lists[0][0].data()[1] *
+         values_vec[0].list_of_lists[0][0].data()[1]) -
+        (values_vec[0].list_of_lists[0][0].data()[2] *
+         values_vec[0].list_of_lists[0][0].data()[2]) +
+        (values_vec[0].list_of_lists[0][0].data()[3] * values_vec[0].list_of_lists[0][0].data()[3]);
     _values_vec_out[0].list_of_lists[0][1].data()[0] =
         _tmp6 * values_vec[0].list_of_lists[0][1].data()[0];
     _values_vec_out[0].list_of_lists[0][1].data()[1] =
@@ -214,10 +218,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[0][1].data()[2] =
         _tmp6 * values_vec[0].list_of_lists[0][1].data()[2];
     _values_vec_out[0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][1].data()[0] *
+          values_vec[0].list_of_lists[0][1].data()[0]) -
+        (values_vec[0].list_of_lists[0][1].data()[1] *
+         values_vec[0].list_of_lists[0][1].data()[1]) -
+        (values_vec[0].list_of_lists[0][1].data()[2] *
+         values_vec[0].list_of_lists[0][1].data()[2]) +
+        (values_vec[0].list_of_lists[0][1].data()[3] * values_vec[0].list_of_lists[0][1].data()[3]);
     _values_vec_out[0].list_of_lists[0][2].data()[0] =
         _tmp7 * values_vec[0].list_of_lists[0][2].data()[0];
     _values_vec_out[0].list_of_lists[0][2].data()[1] =
@@ -225,10 +232,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[0][2].data()[2] =
         _tmp7 * values_vec[0].list_of_lists[0][2].data()[2];
     _values_vec_out[0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][2].data()[0] *
+          values_vec[0].list_of_lists[0][2].data()[0]) -
+        (values_vec[0].list_of_lists[0][2].data()[1] *
+         values_vec[0].list_of_lists[0][2].data()[1]) -
+        (values_vec[0].list_of_lists[0][2].data()[2] *
+         values_vec[0].list_of_lists[0][2].data()[2]) +
+        (values_vec[0].list_of_lists[0][2].data()[3] * values_vec[0].list_of_lists[0][2].data()[3]);
     _values_vec_out[0].list_of_lists[1][0].data()[0] =
         _tmp8 * values_vec[0].list_of_lists[1][0].data()[0];
     _values_vec_out[0].list_of_lists[1][0].data()[1] =
@@ -236,10 +246,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[1][0].data()[2] =
         _tmp8 * values_vec[0].list_of_lists[1][0].data()[2];
     _values_vec_out[0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][0].data()[0] *
+          values_vec[0].list_of_lists[1][0].data()[0]) -
+        (values_vec[0].list_of_lists[1][0].data()[1] *
+         values_vec[0].list_of_lists[1][0].data()[1]) -
+        (values_vec[0].list_of_lists[1][0].data()[2] *
+         values_vec[0].list_of_lists[1][0].data()[2]) +
+        (values_vec[0].list_of_lists[1][0].data()[3] * values_vec[0].list_of_lists[1][0].data()[3]);
     _values_vec_out[0].list_of_lists[1][1].data()[0] =
         _tmp9 * values_vec[0].list_of_lists[1][1].data()[0];
     _values_vec_out[0].list_of_lists[1][1].data()[1] =
@@ -247,10 +260,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[1][1].data()[2] =
         _tmp9 * values_vec[0].list_of_lists[1][1].data()[2];
     _values_vec_out[0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][1].data()[0] *
+          values_vec[0].list_of_lists[1][1].data()[0]) -
+        (values_vec[0].list_of_lists[1][1].data()[1] *
+         values_vec[0].list_of_lists[1][1].data()[1]) -
+        (values_vec[0].list_of_lists[1][1].data()[2] *
+         values_vec[0].list_of_lists[1][1].data()[2]) +
+        (values_vec[0].list_of_lists[1][1].data()[3] * values_vec[0].list_of_lists[1][1].data()[3]);
     _values_vec_out[0].list_of_lists[1][2].data()[0] =
         _tmp10 * values_vec[0].list_of_lists[1][2].data()[0];
     _values_vec_out[0].list_of_lists[1][2].data()[1] =
@@ -258,10 +274,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[1][2].data()[2] =
         _tmp10 * values_vec[0].list_of_lists[1][2].data()[2];
     _values_vec_out[0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][2].data()[0] *
+          values_vec[0].list_of_lists[1][2].data()[0]) -
+        (values_vec[0].list_of_lists[1][2].data()[1] *
+         values_vec[0].list_of_lists[1][2].data()[1]) -
+        (values_vec[0].list_of_lists[1][2].data()[2] *
+         values_vec[0].list_of_lists[1][2].data()[2]) +
+        (values_vec[0].list_of_lists[1][2].data()[3] * values_vec[0].list_of_lists[1][2].data()[3]);
     _values_vec_out[0].list_of_lists[2][0].data()[0] =
         _tmp11 * values_vec[0].list_of_lists[2][0].data()[0];
     _values_vec_out[0].list_of_lists[2][0].data()[1] =
@@ -269,10 +288,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[2][0].data()[2] =
         _tmp11 * values_vec[0].list_of_lists[2][0].data()[2];
     _values_vec_out[0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][0].data()[0] *
+          values_vec[0].list_of_lists[2][0].data()[0]) -
+        (values_vec[0].list_of_lists[2][0].data()[1] *
+         values_vec[0].list_of_lists[2][0].data()[1]) -
+        (values_vec[0].list_of_lists[2][0].data()[2] *
+         values_vec[0].list_of_lists[2][0].data()[2]) +
+        (values_vec[0].list_of_lists[2][0].data()[3] * values_vec[0].list_of_lists[2][0].data()[3]);
     _values_vec_out[0].list_of_lists[2][1].data()[0] =
         _tmp12 * values_vec[0].list_of_lists[2][1].data()[0];
     _values_vec_out[0].list_of_lists[2][1].data()[1] =
@@ -280,10 +302,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[2][1].data()[2] =
         _tmp12 * values_vec[0].list_of_lists[2][1].data()[2];
     _values_vec_out[0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][1].data()[0] *
+          values_vec[0].list_of_lists[2][1].data()[0]) -
+        (values_vec[0].list_of_lists[2][1].data()[1] *
+         values_vec[0].list_of_lists[2][1].data()[1]) -
+        (values_vec[0].list_of_lists[2][1].data()[2] *
+         values_vec[0].list_of_lists[2][1].data()[2]) +
+        (values_vec[0].list_of_lists[2][1].data()[3] * values_vec[0].list_of_lists[2][1].data()[3]);
     _values_vec_out[0].list_of_lists[2][2].data()[0] =
         _tmp13 * values_vec[0].list_of_lists[2][2].data()[0];
     _values_vec_out[0].list_of_lists[2][2].data()[1] =
@@ -291,43 +316,47 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[0].list_of_lists[2][2].data()[2] =
         _tmp13 * values_vec[0].list_of_lists[2][2].data()[2];
     _values_vec_out[0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][2].data()[0] *
+          values_vec[0].list_of_lists[2][2].data()[0]) -
+        (values_vec[0].list_of_lists[2][2].data()[1] *
+         values_vec[0].list_of_lists[2][2].data()[1]) -
+        (values_vec[0].list_of_lists[2][2].data()[2] *
+         values_vec[0].list_of_lists[2][2].data()[2]) +
+        (values_vec[0].list_of_lists[2][2].data()[3] * values_vec[0].list_of_lists[2][2].data()[3]);
     _values_vec_out[1].x = 2 * values_vec[1].x;
     _values_vec_out[1].y = 2 * values_vec[1].y;
     _values_vec_out[1].rot.data()[0] = _tmp14 * values_vec[1].rot.data()[0];
     _values_vec_out[1].rot.data()[1] = _tmp14 * values_vec[1].rot.data()[1];
     _values_vec_out[1].rot.data()[2] = _tmp14 * values_vec[1].rot.data()[2];
-    _values_vec_out[1].rot.data()[3] = -std::pow(values_vec[1].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[1].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[1].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[1].rot.data()[3], Scalar(2));
+    _values_vec_out[1].rot.data()[3] =
+        -(values_vec[1].rot.data()[0] * values_vec[1].rot.data()[0]) -
+        (values_vec[1].rot.data()[1] * values_vec[1].rot.data()[1]) -
+        (values_vec[1].rot.data()[2] * values_vec[1].rot.data()[2]) +
+        (values_vec[1].rot.data()[3] * values_vec[1].rot.data()[3]);
     _values_vec_out[1].rot_vec[0].data()[0] = _tmp15 * values_vec[1].rot_vec[0].data()[0];
     _values_vec_out[1].rot_vec[0].data()[1] = _tmp15 * values_vec[1].rot_vec[0].data()[1];
     _values_vec_out[1].rot_vec[0].data()[2] = _tmp15 * values_vec[1].rot_vec[0].data()[2];
     _values_vec_out[1].rot_vec[0].data()[3] =
-        -std::pow(values_vec[1].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[0].data()[0] * values_vec[1].rot_vec[0].data()[0]) -
+        (values_vec[1].rot_vec[0].data()[1] * values_vec[1].rot_vec[0].data()[1]) -
+        (values_vec[1].rot_vec[0].data()[2] * values_vec[1].rot_vec[0].data()[2]) +
+        (values_vec[1].rot_vec[0].data()[3] * values_vec[1].rot_vec[0].data()[3]);
     _values_vec_out[1].rot_vec[1].data()[0] = _tmp16 * values_vec[1].rot_vec[1].data()[0];
     _values_vec_out[1].rot_vec[1].data()[1] = _tmp16 * values_vec[1].rot_vec[1].data()[1];
     _values_vec_out[1].rot_vec[1].data()[2] = _tmp16 * values_vec[1].rot_vec[1].data()[2];
     _values_vec_out[1].rot_vec[1].data()[3] =
-        -std::pow(values_vec[1].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[1].data()[0] * values_vec[1].rot_vec[1].data()[0]) -
+        (values_vec[1].rot_vec[1].data()[1] * values_vec[1].rot_vec[1].data()[1]) -
+        (values_vec[1].rot_vec[1].data()[2] * values_vec[1].rot_vec[1].data()[2]) +
+        (values_vec[1].rot_vec[1].data()[3] * values_vec[1].rot_vec[1].data()[3]);
     _values_vec_out[1].rot_vec[2].data()[0] = _tmp17 * values_vec[1].rot_vec[2].data()[0];
     _values_vec_out[1].rot_vec[2].data()[1] = _tmp17 * values_vec[1].rot_vec[2].data()[1];
     _values_vec_out[1].rot_vec[2].data()[2] = _tmp17 * values_vec[1].rot_vec[2].data()[2];
     _values_vec_out[1].rot_vec[2].data()[3] =
-        -std::pow(values_vec[1].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[2].data()[0] * values_vec[1].rot_vec[2].data()[0]) -
+        (values_vec[1].rot_vec[2].data()[1] * values_vec[1].rot_vec[2].data()[1]) -
+        (values_vec[1].rot_vec[2].data()[2] * values_vec[1].rot_vec[2].data()[2]) +
+        (values_vec[1].rot_vec[2].data()[3] * values_vec[1].rot_vec[2].data()[3]);
     _values_vec_out[1].scalar_vec[0] = 2 * values_vec[1].scalar_vec[0];
     _values_vec_out[1].scalar_vec[1] = 2 * values_vec[1].scalar_vec[1];
     _values_vec_out[1].scalar_vec[2] = 2 * values_vec[1].scalar_vec[2];
@@ -338,10 +367,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[0][0].data()[2] =
         _tmp18 * values_vec[1].list_of_lists[0][0].data()[2];
     _values_vec_out[1].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][0].data()[0] *
+          values_vec[1].list_of_lists[0][0].data()[0]) -
+        (values_vec[1].list_of_lists[0][0].data()[1] *
+         values_vec[1].list_of_lists[0][0].data()[1]) -
+        (values_vec[1].list_of_lists[0][0].data()[2] *
+         values_vec[1].list_of_lists[0][0].data()[2]) +
+        (values_vec[1].list_of_lists[0][0].data()[3] * values_vec[1].list_of_lists[0][0].data()[3]);
     _values_vec_out[1].list_of_lists[0][1].data()[0] =
         _tmp19 * values_vec[1].list_of_lists[0][1].data()[0];
     _values_vec_out[1].list_of_lists[0][1].data()[1] =
@@ -349,10 +381,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[0][1].data()[2] =
         _tmp19 * values_vec[1].list_of_lists[0][1].data()[2];
     _values_vec_out[1].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][1].data()[0] *
+          values_vec[1].list_of_lists[0][1].data()[0]) -
+        (values_vec[1].list_of_lists[0][1].data()[1] *
+         values_vec[1].list_of_lists[0][1].data()[1]) -
+        (values_vec[1].list_of_lists[0][1].data()[2] *
+         values_vec[1].list_of_lists[0][1].data()[2]) +
+        (values_vec[1].list_of_lists[0][1].data()[3] * values_vec[1].list_of_lists[0][1].data()[3]);
     _values_vec_out[1].list_of_lists[0][2].data()[0] =
         _tmp20 * values_vec[1].list_of_lists[0][2].data()[0];
     _values_vec_out[1].list_of_lists[0][2].data()[1] =
@@ -360,10 +395,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[0][2].data()[2] =
         _tmp20 * values_vec[1].list_of_lists[0][2].data()[2];
     _values_vec_out[1].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][2].data()[0] *
+          values_vec[1].list_of_lists[0][2].data()[0]) -
+        (values_vec[1].list_of_lists[0][2].data()[1] *
+         values_vec[1].list_of_lists[0][2].data()[1]) -
+        (values_vec[1].list_of_lists[0][2].data()[2] *
+         values_vec[1].list_of_lists[0][2].data()[2]) +
+        (values_vec[1].list_of_lists[0][2].data()[3] * values_vec[1].list_of_lists[0][2].data()[3]);
     _values_vec_out[1].list_of_lists[1][0].data()[0] =
         _tmp21 * values_vec[1].list_of_lists[1][0].data()[0];
     _values_vec_out[1].list_of_lists[1][0].data()[1] =
@@ -371,10 +409,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[1][0].data()[2] =
         _tmp21 * values_vec[1].list_of_lists[1][0].data()[2];
     _values_vec_out[1].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][0].data()[0] *
+          values_vec[1].list_of_lists[1][0].data()[0]) -
+        (values_vec[1].list_of_lists[1][0].data()[1] *
+         values_vec[1].list_of_lists[1][0].data()[1]) -
+        (values_vec[1].list_of_lists[1][0].data()[2] *
+         values_vec[1].list_of_lists[1][0].data()[2]) +
+        (values_vec[1].list_of_lists[1][0].data()[3] * values_vec[1].list_of_lists[1][0].data()[3]);
     _values_vec_out[1].list_of_lists[1][1].data()[0] =
         _tmp22 * values_vec[1].list_of_lists[1][1].data()[0];
     _values_vec_out[1].list_of_lists[1][1].data()[1] =
@@ -382,10 +423,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[1][1].data()[2] =
         _tmp22 * values_vec[1].list_of_lists[1][1].data()[2];
     _values_vec_out[1].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][1].data()[0] *
+          values_vec[1].list_of_lists[1][1].data()[0]) -
+        (values_vec[1].list_of_lists[1][1].data()[1] *
+         values_vec[1].list_of_lists[1][1].data()[1]) -
+        (values_vec[1].list_of_lists[1][1].data()[2] *
+         values_vec[1].list_of_lists[1][1].data()[2]) +
+        (values_vec[1].list_of_lists[1][1].data()[3] * values_vec[1].list_of_lists[1][1].data()[3]);
     _values_vec_out[1].list_of_lists[1][2].data()[0] =
         _tmp23 * values_vec[1].list_of_lists[1][2].data()[0];
     _values_vec_out[1].list_of_lists[1][2].data()[1] =
@@ -393,10 +437,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[1][2].data()[2] =
         _tmp23 * values_vec[1].list_of_lists[1][2].data()[2];
     _values_vec_out[1].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][2].data()[0] *
+          values_vec[1].list_of_lists[1][2].data()[0]) -
+        (values_vec[1].list_of_lists[1][2].data()[1] *
+         values_vec[1].list_of_lists[1][2].data()[1]) -
+        (values_vec[1].list_of_lists[1][2].data()[2] *
+         values_vec[1].list_of_lists[1][2].data()[2]) +
+        (values_vec[1].list_of_lists[1][2].data()[3] * values_vec[1].list_of_lists[1][2].data()[3]);
     _values_vec_out[1].list_of_lists[2][0].data()[0] =
         _tmp24 * values_vec[1].list_of_lists[2][0].data()[0];
     _values_vec_out[1].list_of_lists[2][0].data()[1] =
@@ -404,10 +451,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[2][0].data()[2] =
         _tmp24 * values_vec[1].list_of_lists[2][0].data()[2];
     _values_vec_out[1].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][0].data()[0] *
+          values_vec[1].list_of_lists[2][0].data()[0]) -
+        (values_vec[1].list_of_lists[2][0].data()[1] *
+         values_vec[1].list_of_lists[2][0].data()[1]) -
+        (values_vec[1].list_of_lists[2][0].data()[2] *
+         values_vec[1].list_of_lists[2][0].data()[2]) +
+        (values_vec[1].list_of_lists[2][0].data()[3] * values_vec[1].list_of_lists[2][0].data()[3]);
     _values_vec_out[1].list_of_lists[2][1].data()[0] =
         _tmp25 * values_vec[1].list_of_lists[2][1].data()[0];
     _values_vec_out[1].list_of_lists[2][1].data()[1] =
@@ -415,10 +465,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[2][1].data()[2] =
         _tmp25 * values_vec[1].list_of_lists[2][1].data()[2];
     _values_vec_out[1].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][1].data()[0] *
+          values_vec[1].list_of_lists[2][1].data()[0]) -
+        (values_vec[1].list_of_lists[2][1].data()[1] *
+         values_vec[1].list_of_lists[2][1].data()[1]) -
+        (values_vec[1].list_of_lists[2][1].data()[2] *
+         values_vec[1].list_of_lists[2][1].data()[2]) +
+        (values_vec[1].list_of_lists[2][1].data()[3] * values_vec[1].list_of_lists[2][1].data()[3]);
     _values_vec_out[1].list_of_lists[2][2].data()[0] =
         _tmp26 * values_vec[1].list_of_lists[2][2].data()[0];
     _values_vec_out[1].list_of_lists[2][2].data()[1] =
@@ -426,43 +479,47 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[1].list_of_lists[2][2].data()[2] =
         _tmp26 * values_vec[1].list_of_lists[2][2].data()[2];
     _values_vec_out[1].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][2].data()[0] *
+          values_vec[1].list_of_lists[2][2].data()[0]) -
+        (values_vec[1].list_of_lists[2][2].data()[1] *
+         values_vec[1].list_of_lists[2][2].data()[1]) -
+        (values_vec[1].list_of_lists[2][2].data()[2] *
+         values_vec[1].list_of_lists[2][2].data()[2]) +
+        (values_vec[1].list_of_lists[2][2].data()[3] * values_vec[1].list_of_lists[2][2].data()[3]);
     _values_vec_out[2].x = 2 * values_vec[2].x;
     _values_vec_out[2].y = 2 * values_vec[2].y;
     _values_vec_out[2].rot.data()[0] = _tmp27 * values_vec[2].rot.data()[0];
     _values_vec_out[2].rot.data()[1] = _tmp27 * values_vec[2].rot.data()[1];
     _values_vec_out[2].rot.data()[2] = _tmp27 * values_vec[2].rot.data()[2];
-    _values_vec_out[2].rot.data()[3] = -std::pow(values_vec[2].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[2].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[2].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[2].rot.data()[3], Scalar(2));
+    _values_vec_out[2].rot.data()[3] =
+        -(values_vec[2].rot.data()[0] * values_vec[2].rot.data()[0]) -
+        (values_vec[2].rot.data()[1] * values_vec[2].rot.data()[1]) -
+        (values_vec[2].rot.data()[2] * values_vec[2].rot.data()[2]) +
+        (values_vec[2].rot.data()[3] * values_vec[2].rot.data()[3]);
     _values_vec_out[2].rot_vec[0].data()[0] = _tmp28 * values_vec[2].rot_vec[0].data()[0];
     _values_vec_out[2].rot_vec[0].data()[1] = _tmp28 * values_vec[2].rot_vec[0].data()[1];
     _values_vec_out[2].rot_vec[0].data()[2] = _tmp28 * values_vec[2].rot_vec[0].data()[2];
     _values_vec_out[2].rot_vec[0].data()[3] =
-        -std::pow(values_vec[2].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[0].data()[0] * values_vec[2].rot_vec[0].data()[0]) -
+        (values_vec[2].rot_vec[0].data()[1] * values_vec[2].rot_vec[0].data()[1]) -
+        (values_vec[2].rot_vec[0].data()[2] * values_vec[2].rot_vec[0].data()[2]) +
+        (values_vec[2].rot_vec[0].data()[3] * values_vec[2].rot_vec[0].data()[3]);
     _values_vec_out[2].rot_vec[1].data()[0] = _tmp29 * values_vec[2].rot_vec[1].data()[0];
     _values_vec_out[2].rot_vec[1].data()[1] = _tmp29 * values_vec[2].rot_vec[1].data()[1];
     _values_vec_out[2].rot_vec[1].data()[2] = _tmp29 * values_vec[2].rot_vec[1].data()[2];
     _values_vec_out[2].rot_vec[1].data()[3] =
-        -std::pow(values_vec[2].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[1].data()[0] * values_vec[2].rot_vec[1].data()[0]) -
+        (values_vec[2].rot_vec[1].data()[1] * values_vec[2].rot_vec[1].data()[1]) -
+        (values_vec[2].rot_vec[1].data()[2] * values_vec[2].rot_vec[1].data()[2]) +
+        (values_vec[2].rot_vec[1].data()[3] * values_vec[2].rot_vec[1].data()[3]);
     _values_vec_out[2].rot_vec[2].data()[0] = _tmp30 * values_vec[2].rot_vec[2].data()[0];
     _values_vec_out[2].rot_vec[2].data()[1] = _tmp30 * values_vec[2].rot_vec[2].data()[1];
     _values_vec_out[2].rot_vec[2].data()[2] = _tmp30 * values_vec[2].rot_vec[2].data()[2];
     _values_vec_out[2].rot_vec[2].data()[3] =
-        -std::pow(values_vec[2].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[2].data()[0] * values_vec[2].rot_vec[2].data()[0]) -
+        (values_vec[2].rot_vec[2].data()[1] * values_vec[2].rot_vec[2].data()[1]) -
+        (values_vec[2].rot_vec[2].data()[2] * values_vec[2].rot_vec[2].data()[2]) +
+        (values_vec[2].rot_vec[2].data()[3] * values_vec[2].rot_vec[2].data()[3]);
     _values_vec_out[2].scalar_vec[0] = 2 * values_vec[2].scalar_vec[0];
     _values_vec_out[2].scalar_vec[1] = 2 * values_vec[2].scalar_vec[1];
     _values_vec_out[2].scalar_vec[2] = 2 * values_vec[2].scalar_vec[2];
@@ -473,10 +530,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[0][0].data()[2] =
         _tmp31 * values_vec[2].list_of_lists[0][0].data()[2];
     _values_vec_out[2].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][0].data()[0] *
+          values_vec[2].list_of_lists[0][0].data()[0]) -
+        (values_vec[2].list_of_lists[0][0].data()[1] *
+         values_vec[2].list_of_lists[0][0].data()[1]) -
+        (values_vec[2].list_of_lists[0][0].data()[2] *
+         values_vec[2].list_of_lists[0][0].data()[2]) +
+        (values_vec[2].list_of_lists[0][0].data()[3] * values_vec[2].list_of_lists[0][0].data()[3]);
     _values_vec_out[2].list_of_lists[0][1].data()[0] =
         _tmp32 * values_vec[2].list_of_lists[0][1].data()[0];
     _values_vec_out[2].list_of_lists[0][1].data()[1] =
@@ -484,10 +544,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[0][1].data()[2] =
         _tmp32 * values_vec[2].list_of_lists[0][1].data()[2];
     _values_vec_out[2].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][1].data()[0] *
+          values_vec[2].list_of_lists[0][1].data()[0]) -
+        (values_vec[2].list_of_lists[0][1].data()[1] *
+         values_vec[2].list_of_lists[0][1].data()[1]) -
+        (values_vec[2].list_of_lists[0][1].data()[2] *
+         values_vec[2].list_of_lists[0][1].data()[2]) +
+        (values_vec[2].list_of_lists[0][1].data()[3] * values_vec[2].list_of_lists[0][1].data()[3]);
     _values_vec_out[2].list_of_lists[0][2].data()[0] =
         _tmp33 * values_vec[2].list_of_lists[0][2].data()[0];
     _values_vec_out[2].list_of_lists[0][2].data()[1] =
@@ -495,10 +558,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[0][2].data()[2] =
         _tmp33 * values_vec[2].list_of_lists[0][2].data()[2];
     _values_vec_out[2].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][2].data()[0] *
+          values_vec[2].list_of_lists[0][2].data()[0]) -
+        (values_vec[2].list_of_lists[0][2].data()[1] *
+         values_vec[2].list_of_lists[0][2].data()[1]) -
+        (values_vec[2].list_of_lists[0][2].data()[2] *
+         values_vec[2].list_of_lists[0][2].data()[2]) +
+        (values_vec[2].list_of_lists[0][2].data()[3] * values_vec[2].list_of_lists[0][2].data()[3]);
     _values_vec_out[2].list_of_lists[1][0].data()[0] =
         _tmp34 * values_vec[2].list_of_lists[1][0].data()[0];
     _values_vec_out[2].list_of_lists[1][0].data()[1] =
@@ -506,10 +572,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[1][0].data()[2] =
         _tmp34 * values_vec[2].list_of_lists[1][0].data()[2];
     _values_vec_out[2].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][0].data()[0] *
+          values_vec[2].list_of_lists[1][0].data()[0]) -
+        (values_vec[2].list_of_lists[1][0].data()[1] *
+         values_vec[2].list_of_lists[1][0].data()[1]) -
+        (values_vec[2].list_of_lists[1][0].data()[2] *
+         values_vec[2].list_of_lists[1][0].data()[2]) +
+        (values_vec[2].list_of_lists[1][0].data()[3] * values_vec[2].list_of_lists[1][0].data()[3]);
     _values_vec_out[2].list_of_lists[1][1].data()[0] =
         _tmp35 * values_vec[2].list_of_lists[1][1].data()[0];
     _values_vec_out[2].list_of_lists[1][1].data()[1] =
@@ -517,10 +586,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[1][1].data()[2] =
         _tmp35 * values_vec[2].list_of_lists[1][1].data()[2];
     _values_vec_out[2].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][1].data()[0] *
+          values_vec[2].list_of_lists[1][1].data()[0]) -
+        (values_vec[2].list_of_lists[1][1].data()[1] *
+         values_vec[2].list_of_lists[1][1].data()[1]) -
+        (values_vec[2].list_of_lists[1][1].data()[2] *
+         values_vec[2].list_of_lists[1][1].data()[2]) +
+        (values_vec[2].list_of_lists[1][1].data()[3] * values_vec[2].list_of_lists[1][1].data()[3]);
     _values_vec_out[2].list_of_lists[1][2].data()[0] =
         _tmp36 * values_vec[2].list_of_lists[1][2].data()[0];
     _values_vec_out[2].list_of_lists[1][2].data()[1] =
@@ -528,10 +600,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[1][2].data()[2] =
         _tmp36 * values_vec[2].list_of_lists[1][2].data()[2];
     _values_vec_out[2].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][2].data()[0] *
+          values_vec[2].list_of_lists[1][2].data()[0]) -
+        (values_vec[2].list_of_lists[1][2].data()[1] *
+         values_vec[2].list_of_lists[1][2].data()[1]) -
+        (values_vec[2].list_of_lists[1][2].data()[2] *
+         values_vec[2].list_of_lists[1][2].data()[2]) +
+        (values_vec[2].list_of_lists[1][2].data()[3] * values_vec[2].list_of_lists[1][2].data()[3]);
     _values_vec_out[2].list_of_lists[2][0].data()[0] =
         _tmp37 * values_vec[2].list_of_lists[2][0].data()[0];
     _values_vec_out[2].list_of_lists[2][0].data()[1] =
@@ -539,10 +614,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[2][0].data()[2] =
         _tmp37 * values_vec[2].list_of_lists[2][0].data()[2];
     _values_vec_out[2].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][0].data()[0] *
+          values_vec[2].list_of_lists[2][0].data()[0]) -
+        (values_vec[2].list_of_lists[2][0].data()[1] *
+         values_vec[2].list_of_lists[2][0].data()[1]) -
+        (values_vec[2].list_of_lists[2][0].data()[2] *
+         values_vec[2].list_of_lists[2][0].data()[2]) +
+        (values_vec[2].list_of_lists[2][0].data()[3] * values_vec[2].list_of_lists[2][0].data()[3]);
     _values_vec_out[2].list_of_lists[2][1].data()[0] =
         _tmp38 * values_vec[2].list_of_lists[2][1].data()[0];
     _values_vec_out[2].list_of_lists[2][1].data()[1] =
@@ -550,10 +628,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[2][1].data()[2] =
         _tmp38 * values_vec[2].list_of_lists[2][1].data()[2];
     _values_vec_out[2].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][1].data()[0] *
+          values_vec[2].list_of_lists[2][1].data()[0]) -
+        (values_vec[2].list_of_lists[2][1].data()[1] *
+         values_vec[2].list_of_lists[2][1].data()[1]) -
+        (values_vec[2].list_of_lists[2][1].data()[2] *
+         values_vec[2].list_of_lists[2][1].data()[2]) +
+        (values_vec[2].list_of_lists[2][1].data()[3] * values_vec[2].list_of_lists[2][1].data()[3]);
     _values_vec_out[2].list_of_lists[2][2].data()[0] =
         _tmp39 * values_vec[2].list_of_lists[2][2].data()[0];
     _values_vec_out[2].list_of_lists[2][2].data()[1] =
@@ -561,10 +642,13 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_out[2].list_of_lists[2][2].data()[2] =
         _tmp39 * values_vec[2].list_of_lists[2][2].data()[2];
     _values_vec_out[2].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][2].data()[0] *
+          values_vec[2].list_of_lists[2][2].data()[0]) -
+        (values_vec[2].list_of_lists[2][2].data()[1] *
+         values_vec[2].list_of_lists[2][2].data()[1]) -
+        (values_vec[2].list_of_lists[2][2].data()[2] *
+         values_vec[2].list_of_lists[2][2].data()[2]) +
+        (values_vec[2].list_of_lists[2][2].data()[3] * values_vec[2].list_of_lists[2][2].data()[3]);
   }
 
   if (values_vec_2D_out != nullptr) {
@@ -577,10 +661,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].rot.data()[1] = _tmp40 * values_vec_2D[0][0].rot.data()[1];
     _values_vec_2D_out[0][0].rot.data()[2] = _tmp40 * values_vec_2D[0][0].rot.data()[2];
     _values_vec_2D_out[0][0].rot.data()[3] =
-        -std::pow(values_vec_2D[0][0].rot.data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot.data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot.data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot.data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot.data()[0] * values_vec_2D[0][0].rot.data()[0]) -
+        (values_vec_2D[0][0].rot.data()[1] * values_vec_2D[0][0].rot.data()[1]) -
+        (values_vec_2D[0][0].rot.data()[2] * values_vec_2D[0][0].rot.data()[2]) +
+        (values_vec_2D[0][0].rot.data()[3] * values_vec_2D[0][0].rot.data()[3]);
     _values_vec_2D_out[0][0].rot_vec[0].data()[0] =
         _tmp41 * values_vec_2D[0][0].rot_vec[0].data()[0];
     _values_vec_2D_out[0][0].rot_vec[0].data()[1] =
@@ -588,10 +672,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].rot_vec[0].data()[2] =
         _tmp41 * values_vec_2D[0][0].rot_vec[0].data()[2];
     _values_vec_2D_out[0][0].rot_vec[0].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[0].data()[0] * values_vec_2D[0][0].rot_vec[0].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[0].data()[1] * values_vec_2D[0][0].rot_vec[0].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[0].data()[2] * values_vec_2D[0][0].rot_vec[0].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[0].data()[3] * values_vec_2D[0][0].rot_vec[0].data()[3]);
     _values_vec_2D_out[0][0].rot_vec[1].data()[0] =
         _tmp42 * values_vec_2D[0][0].rot_vec[1].data()[0];
     _values_vec_2D_out[0][0].rot_vec[1].data()[1] =
@@ -599,10 +683,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].rot_vec[1].data()[2] =
         _tmp42 * values_vec_2D[0][0].rot_vec[1].data()[2];
     _values_vec_2D_out[0][0].rot_vec[1].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[1].data()[0] * values_vec_2D[0][0].rot_vec[1].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[1].data()[1] * values_vec_2D[0][0].rot_vec[1].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[1].data()[2] * values_vec_2D[0][0].rot_vec[1].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[1].data()[3] * values_vec_2D[0][0].rot_vec[1].data()[3]);
     _values_vec_2D_out[0][0].rot_vec[2].data()[0] =
         _tmp43 * values_vec_2D[0][0].rot_vec[2].data()[0];
     _values_vec_2D_out[0][0].rot_vec[2].data()[1] =
@@ -610,10 +694,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].rot_vec[2].data()[2] =
         _tmp43 * values_vec_2D[0][0].rot_vec[2].data()[2];
     _values_vec_2D_out[0][0].rot_vec[2].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[2].data()[0] * values_vec_2D[0][0].rot_vec[2].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[2].data()[1] * values_vec_2D[0][0].rot_vec[2].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[2].data()[2] * values_vec_2D[0][0].rot_vec[2].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[2].data()[3] * values_vec_2D[0][0].rot_vec[2].data()[3]);
     _values_vec_2D_out[0][0].scalar_vec[0] = 2 * values_vec_2D[0][0].scalar_vec[0];
     _values_vec_2D_out[0][0].scalar_vec[1] = 2 * values_vec_2D[0][0].scalar_vec[1];
     _values_vec_2D_out[0][0].scalar_vec[2] = 2 * values_vec_2D[0][0].scalar_vec[2];
@@ -624,10 +708,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[0][0].data()[2] =
         _tmp44 * values_vec_2D[0][0].list_of_lists[0][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[0] =
         _tmp45 * values_vec_2D[0][0].list_of_lists[0][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[1] =
@@ -635,10 +723,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[2] =
         _tmp45 * values_vec_2D[0][0].list_of_lists[0][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[0] =
         _tmp46 * values_vec_2D[0][0].list_of_lists[0][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[1] =
@@ -646,10 +738,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[2] =
         _tmp46 * values_vec_2D[0][0].list_of_lists[0][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[0] =
         _tmp47 * values_vec_2D[0][0].list_of_lists[1][0].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[1] =
@@ -657,10 +753,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[2] =
         _tmp47 * values_vec_2D[0][0].list_of_lists[1][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[0] =
         _tmp48 * values_vec_2D[0][0].list_of_lists[1][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[1] =
@@ -668,10 +768,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[2] =
         _tmp48 * values_vec_2D[0][0].list_of_lists[1][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[0] =
         _tmp49 * values_vec_2D[0][0].list_of_lists[1][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[1] =
@@ -679,10 +783,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[2] =
         _tmp49 * values_vec_2D[0][0].list_of_lists[1][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[0] =
         _tmp50 * values_vec_2D[0][0].list_of_lists[2][0].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[1] =
@@ -690,10 +798,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[2] =
         _tmp50 * values_vec_2D[0][0].list_of_lists[2][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[0] =
         _tmp51 * values_vec_2D[0][0].list_of_lists[2][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[1] =
@@ -701,10 +813,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[2] =
         _tmp51 * values_vec_2D[0][0].list_of_lists[2][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[0] =
         _tmp52 * values_vec_2D[0][0].list_of_lists[2][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[1] =
@@ -712,20 +828,24 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[2] =
         _tmp52 * values_vec_2D[0][0].list_of_lists[2][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[3]);
     _values_vec_2D_out[1][0].x = 2 * values_vec_2D[1][0].x;
     _values_vec_2D_out[1][0].y = 2 * values_vec_2D[1][0].y;
     _values_vec_2D_out[1][0].rot.data()[0] = _tmp53 * values_vec_2D[1][0].rot.data()[0];
     _values_vec_2D_out[1][0].rot.data()[1] = _tmp53 * values_vec_2D[1][0].rot.data()[1];
     _values_vec_2D_out[1][0].rot.data()[2] = _tmp53 * values_vec_2D[1][0].rot.data()[2];
     _values_vec_2D_out[1][0].rot.data()[3] =
-        -std::pow(values_vec_2D[1][0].rot.data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot.data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot.data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot.data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot.data()[0] * values_vec_2D[1][0].rot.data()[0]) -
+        (values_vec_2D[1][0].rot.data()[1] * values_vec_2D[1][0].rot.data()[1]) -
+        (values_vec_2D[1][0].rot.data()[2] * values_vec_2D[1][0].rot.data()[2]) +
+        (values_vec_2D[1][0].rot.data()[3] * values_vec_2D[1][0].rot.data()[3]);
     _values_vec_2D_out[1][0].rot_vec[0].data()[0] =
         _tmp54 * values_vec_2D[1][0].rot_vec[0].data()[0];
     _values_vec_2D_out[1][0].rot_vec[0].data()[1] =
@@ -733,10 +853,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].rot_vec[0].data()[2] =
         _tmp54 * values_vec_2D[1][0].rot_vec[0].data()[2];
     _values_vec_2D_out[1][0].rot_vec[0].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[0].data()[0] * values_vec_2D[1][0].rot_vec[0].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[0].data()[1] * values_vec_2D[1][0].rot_vec[0].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[0].data()[2] * values_vec_2D[1][0].rot_vec[0].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[0].data()[3] * values_vec_2D[1][0].rot_vec[0].data()[3]);
     _values_vec_2D_out[1][0].rot_vec[1].data()[0] =
         _tmp55 * values_vec_2D[1][0].rot_vec[1].data()[0];
     _values_vec_2D_out[1][0].rot_vec[1].data()[1] =
@@ -744,10 +864,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].rot_vec[1].data()[2] =
         _tmp55 * values_vec_2D[1][0].rot_vec[1].data()[2];
     _values_vec_2D_out[1][0].rot_vec[1].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[1].data()[0] * values_vec_2D[1][0].rot_vec[1].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[1].data()[1] * values_vec_2D[1][0].rot_vec[1].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[1].data()[2] * values_vec_2D[1][0].rot_vec[1].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[1].data()[3] * values_vec_2D[1][0].rot_vec[1].data()[3]);
     _values_vec_2D_out[1][0].rot_vec[2].data()[0] =
         _tmp56 * values_vec_2D[1][0].rot_vec[2].data()[0];
     _values_vec_2D_out[1][0].rot_vec[2].data()[1] =
@@ -755,10 +875,10 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].rot_vec[2].data()[2] =
         _tmp56 * values_vec_2D[1][0].rot_vec[2].data()[2];
     _values_vec_2D_out[1][0].rot_vec[2].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[2].data()[0] * values_vec_2D[1][0].rot_vec[2].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[2].data()[1] * values_vec_2D[1][0].rot_vec[2].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[2].data()[2] * values_vec_2D[1][0].rot_vec[2].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[2].data()[3] * values_vec_2D[1][0].rot_vec[2].data()[3]);
     _values_vec_2D_out[1][0].scalar_vec[0] = 2 * values_vec_2D[1][0].scalar_vec[0];
     _values_vec_2D_out[1][0].scalar_vec[1] = 2 * values_vec_2D[1][0].scalar_vec[1];
     _values_vec_2D_out[1][0].scalar_vec[2] = 2 * values_vec_2D[1][0].scalar_vec[2];
@@ -769,10 +889,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[0][0].data()[2] =
         _tmp57 * values_vec_2D[1][0].list_of_lists[0][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[0] =
         _tmp58 * values_vec_2D[1][0].list_of_lists[0][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[1] =
@@ -780,10 +904,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[2] =
         _tmp58 * values_vec_2D[1][0].list_of_lists[0][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[0] =
         _tmp59 * values_vec_2D[1][0].list_of_lists[0][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[1] =
@@ -791,10 +919,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[2] =
         _tmp59 * values_vec_2D[1][0].list_of_lists[0][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[0] =
         _tmp60 * values_vec_2D[1][0].list_of_lists[1][0].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[1] =
@@ -802,10 +934,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[2] =
         _tmp60 * values_vec_2D[1][0].list_of_lists[1][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[0] =
         _tmp61 * values_vec_2D[1][0].list_of_lists[1][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[1] =
@@ -813,10 +949,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[2] =
         _tmp61 * values_vec_2D[1][0].list_of_lists[1][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[0] =
         _tmp62 * values_vec_2D[1][0].list_of_lists[1][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[1] =
@@ -824,10 +964,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[2] =
         _tmp62 * values_vec_2D[1][0].list_of_lists[1][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[0] =
         _tmp63 * values_vec_2D[1][0].list_of_lists[2][0].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[1] =
@@ -835,10 +979,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[2] =
         _tmp63 * values_vec_2D[1][0].list_of_lists[2][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[0] =
         _tmp64 * values_vec_2D[1][0].list_of_lists[2][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[1] =
@@ -846,10 +994,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[2] =
         _tmp64 * values_vec_2D[1][0].list_of_lists[2][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[0] =
         _tmp65 * values_vec_2D[1][0].list_of_lists[2][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[1] =
@@ -857,10 +1009,14 @@ void CodegenExplicitTemplateInstantiationTest(
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[2] =
         _tmp65 * values_vec_2D[1][0].list_of_lists[2][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[3]);
   }
 }  // NOLINT(readability/fn_size)
 
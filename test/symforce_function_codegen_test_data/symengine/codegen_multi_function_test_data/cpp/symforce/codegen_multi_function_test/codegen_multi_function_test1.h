@@ -31,7 +31,7 @@ void CodegenMultiFunctionTest1(
   // Input arrays
 
   // Intermediate terms (66)
-  const Scalar _tmp0 = std::pow(inputs.x, Scalar(2));
+  const Scalar _tmp0 = (inputs.x * inputs.x);
   const Scalar _tmp1 = 2 * inputs.values_vec[0].rot.data()[3];
   const Scalar _tmp2 = 2 * inputs.values_vec[0].rot_vec[0].data()[3];
   const Scalar _tmp3 = 2 * inputs.values_vec[0].rot_vec[1].data()[3];
@@ -113,10 +113,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].rot.data()[1] = _tmp1 * inputs.values_vec[0].rot.data()[1];
     _outputs_1.values_vec_out[0].rot.data()[2] = _tmp1 * inputs.values_vec[0].rot.data()[2];
     _outputs_1.values_vec_out[0].rot.data()[3] =
-        -std::pow(inputs.values_vec[0].rot.data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot.data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot.data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].rot.data()[3], Scalar(2));
+        -(inputs.values_vec[0].rot.data()[0] * inputs.values_vec[0].rot.data()[0]) -
+        (inputs.values_vec[0].rot.data()[1] * inputs.values_vec[0].rot.data()[1]) -
+        (inputs.values_vec[0].rot.data()[2] * inputs.values_vec[0].rot.data()[2]) +
+        (inputs.values_vec[0].rot.data()[3] * inputs.values_vec[0].rot.data()[3]);
     _outputs_1.values_vec_out[0].rot_vec[0].data()[0] =
         _tmp2 * inputs.values_vec[0].rot_vec[0].data()[0];
     _outputs_1.values_vec_out[0].rot_vec[0].data()[1] =
@@ -124,10 +124,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].rot_vec[0].data()[2] =
         _tmp2 * inputs.values_vec[0].rot_vec[0].data()[2];
     _outputs_1.values_vec_out[0].rot_vec[0].data()[3] =
-        -std::pow(inputs.values_vec[0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].rot_vec[0].data()[3], Scalar(2));
+        -(inputs.values_vec[0].rot_vec[0].data()[0] * inputs.values_vec[0].rot_vec[0].data()[0]) -
+        (inputs.values_vec[0].rot_vec[0].data()[1] * inputs.values_vec[0].rot_vec[0].data()[1]) -
+        (inputs.values_vec[0].rot_vec[0].data()[2] * inputs.values_vec[0].rot_vec[0].data()[2]) +
+        (inputs.values_vec[0].rot_vec[0].data()[3] * inputs.values_vec[0].rot_vec[0].data()[3]);
     _outputs_1.values_vec_out[0].rot_vec[1].data()[0] =
         _tmp3 * inputs.values_vec[0].rot_vec[1].data()[0];
     _outputs_1.values_vec_out[0].rot_vec[1].data()[1] =
@@ -135,10 +135,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].rot_vec[1].data()[2] =
         _tmp3 * inputs.values_vec[0].rot_vec[1].data()[2];
     _outputs_1.values_vec_out[0].rot_vec[1].data()[3] =
-        -std::pow(inputs.values_vec[0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].rot_vec[1].data()[3], Scalar(2));
+        -(inputs.values_vec[0].rot_vec[1].data()[0] * inputs.values_vec[0].rot_vec[1].data()[0]) -
+        (inputs.values_vec[0].rot_vec[1].data()[1] * inputs.values_vec[0].rot_vec[1].data()[1]) -
+        (inputs.values_vec[0].rot_vec[1].data()[2] * inputs.values_vec[0].rot_vec[1].data()[2]) +
+        (inputs.values_vec[0].rot_vec[1].data()[3] * inputs.values_vec[0].rot_vec[1].data()[3]);
     _outputs_1.values_vec_out[0].rot_vec[2].data()[0] =
         _tmp4 * inputs.values_vec[0].rot_vec[2].data()[0];
     _outputs_1.values_vec_out[0].rot_vec[2].data()[1] =
@@ -146,10 +146,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].rot_vec[2].data()[2] =
         _tmp4 * inputs.values_vec[0].rot_vec[2].data()[2];
     _outputs_1.values_vec_out[0].rot_vec[2].data()[3] =
-        -std::pow(inputs.values_vec[0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].rot_vec[2].data()[3], Scalar(2));
+        -(inputs.values_vec[0].rot_vec[2].data()[0] * inputs.values_vec[0].rot_vec[2].data()[0]) -
+        (inputs.values_vec[0].rot_vec[2].data()[1] * inputs.values_vec[0].rot_vec[2].data()[1]) -
+        (inputs.values_vec[0].rot_vec[2].data()[2] * inputs.values_vec[0].rot_vec[2].data()[2]) +
+        (inputs.values_vec[0].rot_vec[2].data()[3] * inputs.values_vec[0].rot_vec[2].data()[3]);
     _outputs_1.values_vec_out[0].scalar_vec[0] = 2 * inputs.values_vec[0].scalar_vec[0];
     _outputs_1.values_vec_out[0].scalar_vec[1] = 2 * inputs.values_vec[0].scalar_vec[1];
     _outputs_1.values_vec_out[0].scalar_vec[2] = 2 * inputs.values_vec[0].scalar_vec[2];
@@ -160,10 +160,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[0][0].data()[2] =
         _tmp5 * inputs.values_vec[0].list_of_lists[0][0].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[0][0].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[0][0].data()[0] *
+          inputs.values_vec[0].list_of_lists[0][0].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[0][0].data()[1] *
+         inputs.values_vec[0].list_of_lists[0][0].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[0][0].data()[2] *
+         inputs.values_vec[0].list_of_lists[0][0].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[0][0].data()[3] *
+         inputs.values_vec[0].list_of_lists[0][0].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[0][1].data()[0] =
         _tmp6 * inputs.values_vec[0].list_of_lists[0][1].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[0][1].data()[1] =
@@ -171,10 +175,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[0][1].data()[2] =
         _tmp6 * inputs.values_vec[0].list_of_lists[0][1].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[0][1].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[0][1].data()[0] *
+          inputs.values_vec[0].list_of_lists[0][1].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[0][1].data()[1] *
+         inputs.values_vec[0].list_of_lists[0][1].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[0][1].data()[2] *
+         inputs.values_vec[0].list_of_lists[0][1].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[0][1].data()[3] *
+         inputs.values_vec[0].list_of_lists[0][1].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[0][2].data()[0] =
         _tmp7 * inputs.values_vec[0].list_of_lists[0][2].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[0][2].data()[1] =
@@ -182,10 +190,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[0][2].data()[2] =
         _tmp7 * inputs.values_vec[0].list_of_lists[0][2].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[0][2].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[0][2].data()[0] *
+          inputs.values_vec[0].list_of_lists[0][2].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[0][2].data()[1] *
+         inputs.values_vec[0].list_of_lists[0][2].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[0][2].data()[2] *
+         inputs.values_vec[0].list_of_lists[0][2].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[0][2].data()[3] *
+         inputs.values_vec[0].list_of_lists[0][2].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[1][0].data()[0] =
         _tmp8 * inputs.values_vec[0].list_of_lists[1][0].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[1][0].data()[1] =
@@ -193,10 +205,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[1][0].data()[2] =
         _tmp8 * inputs.values_vec[0].list_of_lists[1][0].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[1][0].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[1][0].data()[0] *
+          inputs.values_vec[0].list_of_lists[1][0].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[1][0].data()[1] *
+         inputs.values_vec[0].list_of_lists[1][0].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[1][0].data()[2] *
+         inputs.values_vec[0].list_of_lists[1][0].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[1][0].data()[3] *
+         inputs.values_vec[0].list_of_lists[1][0].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[1][1].data()[0] =
         _tmp9 * inputs.values_vec[0].list_of_lists[1][1].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[1][1].data()[1] =
@@ -204,10 +220,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[1][1].data()[2] =
         _tmp9 * inputs.values_vec[0].list_of_lists[1][1].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[1][1].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[1][1].data()[0] *
+          inputs.values_vec[0].list_of_lists[1][1].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[1][1].data()[1] *
+         inputs.values_vec[0].list_of_lists[1][1].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[1][1].data()[2] *
+         inputs.values_vec[0].list_of_lists[1][1].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[1][1].data()[3] *
+         inputs.values_vec[0].list_of_lists[1][1].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[1][2].data()[0] =
         _tmp10 * inputs.values_vec[0].list_of_lists[1][2].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[1][2].data()[1] =
@@ -215,10 +235,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[1][2].data()[2] =
         _tmp10 * inputs.values_vec[0].list_of_lists[1][2].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[1][2].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[1][2].data()[0] *
+          inputs.values_vec[0].list_of_lists[1][2].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[1][2].data()[1] *
+         inputs.values_vec[0].list_of_lists[1][2].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[1][2].data()[2] *
+         inputs.values_vec[0].list_of_lists[1][2].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[1][2].data()[3] *
+         inputs.values_vec[0].list_of_lists[1][2].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[2][0].data()[0] =
         _tmp11 * inputs.values_vec[0].list_of_lists[2][0].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[2][0].data()[1] =
@@ -226,10 +250,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[2][0].data()[2] =
         _tmp11 * inputs.values_vec[0].list_of_lists[2][0].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[2][0].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[2][0].data()[0] *
+          inputs.values_vec[0].list_of_lists[2][0].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[2][0].data()[1] *
+         inputs.values_vec[0].list_of_lists[2][0].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[2][0].data()[2] *
+         inputs.values_vec[0].list_of_lists[2][0].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[2][0].data()[3] *
+         inputs.values_vec[0].list_of_lists[2][0].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[2][1].data()[0] =
         _tmp12 * inputs.values_vec[0].list_of_lists[2][1].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[2][1].data()[1] =
@@ -237,10 +265,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[2][1].data()[2] =
         _tmp12 * inputs.values_vec[0].list_of_lists[2][1].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[2][1].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[2][1].data()[0] *
+          inputs.values_vec[0].list_of_lists[2][1].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[2][1].data()[1] *
+         inputs.values_vec[0].list_of_lists[2][1].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[2][1].data()[2] *
+         inputs.values_vec[0].list_of_lists[2][1].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[2][1].data()[3] *
+         inputs.values_vec[0].list_of_lists[2][1].data()[3]);
     _outputs_1.values_vec_out[0].list_of_lists[2][2].data()[0] =
         _tmp13 * inputs.values_vec[0].list_of_lists[2][2].data()[0];
     _outputs_1.values_vec_out[0].list_of_lists[2][2].data()[1] =
@@ -248,20 +280,24 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[0].list_of_lists[2][2].data()[2] =
         _tmp13 * inputs.values_vec[0].list_of_lists[2][2].data()[2];
     _outputs_1.values_vec_out[0].list_of_lists[2][2].data()[3] =
-        -std::pow(inputs.values_vec[0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(inputs.values_vec[0].list_of_lists[2][2].data()[0] *
+          inputs.values_vec[0].list_of_lists[2][2].data()[0]) -
+        (inputs.values_vec[0].list_of_lists[2][2].data()[1] *
+         inputs.values_vec[0].list_of_lists[2][2].data()[1]) -
+        (inputs.values_vec[0].list_of_lists[2][2].data()[2] *
+         inputs.values_vec[0].list_of_lists[2][2].data()[2]) +
+        (inputs.values_vec[0].list_of_lists[2][2].data()[3] *
+         inputs.values_vec[0].list_of_lists[2][2].data()[3]);
     _outputs_1.values_vec_out[1].x = 2 * inputs.values_vec[1].x;
     _outputs_1.values_vec_out[1].y = 2 * inputs.values_vec[1].y;
     _outputs_1.values_vec_out[1].rot.data()[0] = _tmp14 * inputs.values_vec[1].rot.data()[0];
     _outputs_1.values_vec_out[1].rot.data()[1] = _tmp14 * inputs.values_vec[1].rot.data()[1];
     _outputs_1.values_vec_out[1].rot.data()[2] = _tmp14 * inputs.values_vec[1].rot.data()[2];
     _outputs_1.values_vec_out[1].rot.data()[3] =
-        -std::pow(inputs.values_vec[1].rot.data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot.data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot.data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].rot.data()[3], Scalar(2));
+        -(inputs.values_vec[1].rot.data()[0] * inputs.values_vec[1].rot.data()[0]) -
+        (inputs.values_vec[1].rot.data()[1] * inputs.values_vec[1].rot.data()[1]) -
+        (inputs.values_vec[1].rot.data()[2] * inputs.values_vec[1].rot.data()[2]) +
+        (inputs.values_vec[1].rot.data()[3] * inputs.values_vec[1].rot.data()[3]);
     _outputs_1.values_vec_out[1].rot_vec[0].data()[0] =
         _tmp15 * inputs.values_vec[1].rot_vec[0].data()[0];
     _outputs_1.values_vec_out[1].rot_vec[0].data()[1] =
@@ -269,10 +305,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].rot_vec[0].data()[2] =
         _tmp15 * inputs.values_vec[1].rot_vec[0].data()[2];
     _outputs_1.values_vec_out[1].rot_vec[0].data()[3] =
-        -std::pow(inputs.values_vec[1].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].rot_vec[0].data()[3], Scalar(2));
+        -(inputs.values_vec[1].rot_vec[0].data()[0] * inputs.values_vec[1].rot_vec[0].data()[0]) -
+        (inputs.values_vec[1].rot_vec[0].data()[1] * inputs.values_vec[1].rot_vec[0].data()[1]) -
+        (inputs.values_vec[1].rot_vec[0].data()[2] * inputs.values_vec[1].rot_vec[0].data()[2]) +
+        (inputs.values_vec[1].rot_vec[0].data()[3] * inputs.values_vec[1].rot_vec[0].data()[3]);
     _outputs_1.values_vec_out[1].rot_vec[1].data()[0] =
         _tmp16 * inputs.values_vec[1].rot_vec[1].data()[0];
     _outputs_1.values_vec_out[1].rot_vec[1].data()[1] =
@@ -280,10 +316,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].rot_vec[1].data()[2] =
         _tmp16 * inputs.values_vec[1].rot_vec[1].data()[2];
     _outputs_1.values_vec_out[1].rot_vec[1].data()[3] =
-        -std::pow(inputs.values_vec[1].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].rot_vec[1].data()[3], Scalar(2));
+        -(inputs.values_vec[1].rot_vec[1].data()[0] * inputs.values_vec[1].rot_vec[1].data()[0]) -
+        (inputs.values_vec[1].rot_vec[1].data()[1] * inputs.values_vec[1].rot_vec[1].data()[1]) -
+        (inputs.values_vec[1].rot_vec[1].data()[2] * inputs.values_vec[1].rot_vec[1].data()[2]) +
+        (inputs.values_vec[1].rot_vec[1].data()[3] * inputs.values_vec[1].rot_vec[1].data()[3]);
     _outputs_1.values_vec_out[1].rot_vec[2].data()[0] =
         _tmp17 * inputs.values_vec[1].rot_vec[2].data()[0];
     _outputs_1.values_vec_out[1].rot_vec[2].data()[1] =
@@ -291,10 +327,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].rot_vec[2].data()[2] =
         _tmp17 * inputs.values_vec[1].rot_vec[2].data()[2];
     _outputs_1.values_vec_out[1].rot_vec[2].data()[3] =
-        -std::pow(inputs.values_vec[1].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].rot_vec[2].data()[3], Scalar(2));
+        -(inputs.values_vec[1].rot_vec[2].data()[0] * inputs.values_vec[1].rot_vec[2].data()[0]) -
+        (inputs.values_vec[1].rot_vec[2].data()[1] * inputs.values_vec[1].rot_vec[2].data()[1]) -
+        (inputs.values_vec[1].rot_vec[2].data()[2] * inputs.values_vec[1].rot_vec[2].data()[2]) +
+        (inputs.values_vec[1].rot_vec[2].data()[3] * inputs.values_vec[1].rot_vec[2].data()[3]);
     _outputs_1.values_vec_out[1].scalar_vec[0] = 2 * inputs.values_vec[1].scalar_vec[0];
     _outputs_1.values_vec_out[1].scalar_vec[1] = 2 * inputs.values_vec[1].scalar_vec[1];
     _outputs_1.values_vec_out[1].scalar_vec[2] = 2 * inputs.values_vec[1].scalar_vec[2];
@@ -305,10 +341,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[0][0].data()[2] =
         _tmp18 * inputs.values_vec[1].list_of_lists[0][0].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[0][0].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[0][0].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[0][0].data()[0] *
+          inputs.values_vec[1].list_of_lists[0][0].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[0][0].data()[1] *
+         inputs.values_vec[1].list_of_lists[0][0].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[0][0].data()[2] *
+         inputs.values_vec[1].list_of_lists[0][0].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[0][0].data()[3] *
+         inputs.values_vec[1].list_of_lists[0][0].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[0][1].data()[0] =
         _tmp19 * inputs.values_vec[1].list_of_lists[0][1].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[0][1].data()[1] =
@@ -316,10 +356,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[0][1].data()[2] =
         _tmp19 * inputs.values_vec[1].list_of_lists[0][1].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[0][1].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[0][1].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[0][1].data()[0] *
+          inputs.values_vec[1].list_of_lists[0][1].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[0][1].data()[1] *
+         inputs.values_vec[1].list_of_lists[0][1].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[0][1].data()[2] *
+         inputs.values_vec[1].list_of_lists[0][1].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[0][1].data()[3] *
+         inputs.values_vec[1].list_of_lists[0][1].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[0][2].data()[0] =
         _tmp20 * inputs.values_vec[1].list_of_lists[0][2].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[0][2].data()[1] =
@@ -327,10 +371,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[0][2].data()[2] =
         _tmp20 * inputs.values_vec[1].list_of_lists[0][2].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[0][2].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[0][2].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[0][2].data()[0] *
+          inputs.values_vec[1].list_of_lists[0][2].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[0][2].data()[1] *
+         inputs.values_vec[1].list_of_lists[0][2].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[0][2].data()[2] *
+         inputs.values_vec[1].list_of_lists[0][2].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[0][2].data()[3] *
+         inputs.values_vec[1].list_of_lists[0][2].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[1][0].data()[0] =
         _tmp21 * inputs.values_vec[1].list_of_lists[1][0].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[1][0].data()[1] =
@@ -338,10 +386,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[1][0].data()[2] =
         _tmp21 * inputs.values_vec[1].list_of_lists[1][0].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[1][0].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[1][0].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[1][0].data()[0] *
+          inputs.values_vec[1].list_of_lists[1][0].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[1][0].data()[1] *
+         inputs.values_vec[1].list_of_lists[1][0].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[1][0].data()[2] *
+         inputs.values_vec[1].list_of_lists[1][0].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[1][0].data()[3] *
+         inputs.values_vec[1].list_of_lists[1][0].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[1][1].data()[0] =
         _tmp22 * inputs.values_vec[1].list_of_lists[1][1].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[1][1].data()[1] =
@@ -349,10 +401,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[1][1].data()[2] =
         _tmp22 * inputs.values_vec[1].list_of_lists[1][1].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[1][1].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[1][1].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[1][1].data()[0] *
+          inputs.values_vec[1].list_of_lists[1][1].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[1][1].data()[1] *
+         inputs.values_vec[1].list_of_lists[1][1].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[1][1].data()[2] *
+         inputs.values_vec[1].list_of_lists[1][1].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[1][1].data()[3] *
+         inputs.values_vec[1].list_of_lists[1][1].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[1][2].data()[0] =
         _tmp23 * inputs.values_vec[1].list_of_lists[1][2].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[1][2].data()[1] =
@@ -360,10 +416,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[1][2].data()[2] =
         _tmp23 * inputs.values_vec[1].list_of_lists[1][2].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[1][2].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[1][2].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[1][2].data()[0] *
+          inputs.values_vec[1].list_of_lists[1][2].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[1][2].data()[1] *
+         inputs.values_vec[1].list_of_lists[1][2].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[1][2].data()[2] *
+         inputs.values_vec[1].list_of_lists[1][2].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[1][2].data()[3] *
+         inputs.values_vec[1].list_of_lists[1][2].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[2][0].data()[0] =
         _tmp24 * inputs.values_vec[1].list_of_lists[2][0].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[2][0].data()[1] =
@@ -371,10 +431,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[2][0].data()[2] =
         _tmp24 * inputs.values_vec[1].list_of_lists[2][0].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[2][0].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[2][0].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[2][0].data()[0] *
+          inputs.values_vec[1].list_of_lists[2][0].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[2][0].data()[1] *
+         inputs.values_vec[1].list_of_lists[2][0].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[2][0].data()[2] *
+         inputs.values_vec[1].list_of_lists[2][0].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[2][0].data()[3] *
+         inputs.values_vec[1].list_of_lists[2][0].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[2][1].data()[0] =
         _tmp25 * inputs.values_vec[1].list_of_lists[2][1].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[2][1].data()[1] =
@@ -382,10 +446,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[2][1].data()[2] =
         _tmp25 * inputs.values_vec[1].list_of_lists[2][1].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[2][1].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[2][1].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[2][1].data()[0] *
+          inputs.values_vec[1].list_of_lists[2][1].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[2][1].data()[1] *
+         inputs.values_vec[1].list_of_lists[2][1].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[2][1].data()[2] *
+         inputs.values_vec[1].list_of_lists[2][1].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[2][1].data()[3] *
+         inputs.values_vec[1].list_of_lists[2][1].data()[3]);
     _outputs_1.values_vec_out[1].list_of_lists[2][2].data()[0] =
         _tmp26 * inputs.values_vec[1].list_of_lists[2][2].data()[0];
     _outputs_1.values_vec_out[1].list_of_lists[2][2].data()[1] =
@@ -393,20 +461,24 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[1].list_of_lists[2][2].data()[2] =
         _tmp26 * inputs.values_vec[1].list_of_lists[2][2].data()[2];
     _outputs_1.values_vec_out[1].list_of_lists[2][2].data()[3] =
-        -std::pow(inputs.values_vec[1].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[1].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[1].list_of_lists[2][2].data()[3], Scalar(2));
+        -(inputs.values_vec[1].list_of_lists[2][2].data()[0] *
+          inputs.values_vec[1].list_of_lists[2][2].data()[0]) -
+        (inputs.values_vec[1].list_of_lists[2][2].data()[1] *
+         inputs.values_vec[1].list_of_lists[2][2].data()[1]) -
+        (inputs.values_vec[1].list_of_lists[2][2].data()[2] *
+         inputs.values_vec[1].list_of_lists[2][2].data()[2]) +
+        (inputs.values_vec[1].list_of_lists[2][2].data()[3] *
+         inputs.values_vec[1].list_of_lists[2][2].data()[3]);
     _outputs_1.values_vec_out[2].x = 2 * inputs.values_vec[2].x;
     _outputs_1.values_vec_out[2].y = 2 * inputs.values_vec[2].y;
     _outputs_1.values_vec_out[2].rot.data()[0] = _tmp27 * inputs.values_vec[2].rot.data()[0];
     _outputs_1.values_vec_out[2].rot.data()[1] = _tmp27 * inputs.values_vec[2].rot.data()[1];
     _outputs_1.values_vec_out[2].rot.data()[2] = _tmp27 * inputs.values_vec[2].rot.data()[2];
     _outputs_1.values_vec_out[2].rot.data()[3] =
-        -std::pow(inputs.values_vec[2].rot.data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot.data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot.data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].rot.data()[3], Scalar(2));
+        -(inputs.values_vec[2].rot.data()[0] * inputs.values_vec[2].rot.data()[0]) -
+        (inputs.values_vec[2].rot.data()[1] * inputs.values_vec[2].rot.data()[1]) -
+        (inputs.values_vec[2].rot.data()[2] * inputs.values_vec[2].rot.data()[2]) +
+        (inputs.values_vec[2].rot.data()[3] * inputs.values_vec[2].rot.data()[3]);
     _outputs_1.values_vec_out[2].rot_vec[0].data()[0] =
         _tmp28 * inputs.values_vec[2].rot_vec[0].data()[0];
     _outputs_1.values_vec_out[2].rot_vec[0].data()[1] =
@@ -414,10 +486,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].rot_vec[0].data()[2] =
         _tmp28 * inputs.values_vec[2].rot_vec[0].data()[2];
     _outputs_1.values_vec_out[2].rot_vec[0].data()[3] =
-        -std::pow(inputs.values_vec[2].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].rot_vec[0].data()[3], Scalar(2));
+        -(inputs.values_vec[2].rot_vec[0].data()[0] * inputs.values_vec[2].rot_vec[0].data()[0]) -
+        (inputs.values_vec[2].rot_vec[0].data()[1] * inputs.values_vec[2].rot_vec[0].data()[1]) -
+        (inputs.values_vec[2].rot_vec[0].data()[2] * inputs.values_vec[2].rot_vec[0].data()[2]) +
+        (inputs.values_vec[2].rot_vec[0].data()[3] * inputs.values_vec[2].rot_vec[0].data()[3]);
     _outputs_1.values_vec_out[2].rot_vec[1].data()[0] =
         _tmp29 * inputs.values_vec[2].rot_vec[1].data()[0];
     _outputs_1.values_vec_out[2].rot_vec[1].data()[1] =
@@ -425,10 +497,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].rot_vec[1].data()[2] =
         _tmp29 * inputs.values_vec[2].rot_vec[1].data()[2];
     _outputs_1.values_vec_out[2].rot_vec[1].data()[3] =
-        -std::pow(inputs.values_vec[2].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].rot_vec[1].data()[3], Scalar(2));
+        -(inputs.values_vec[2].rot_vec[1].data()[0] * inputs.values_vec[2].rot_vec[1].data()[0]) -
+        (inputs.values_vec[2].rot_vec[1].data()[1] * inputs.values_vec[2].rot_vec[1].data()[1]) -
+        (inputs.values_vec[2].rot_vec[1].data()[2] * inputs.values_vec[2].rot_vec[1].data()[2]) +
+        (inputs.values_vec[2].rot_vec[1].data()[3] * inputs.values_vec[2].rot_vec[1].data()[3]);
     _outputs_1.values_vec_out[2].rot_vec[2].data()[0] =
         _tmp30 * inputs.values_vec[2].rot_vec[2].data()[0];
     _outputs_1.values_vec_out[2].rot_vec[2].data()[1] =
@@ -436,10 +508,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].rot_vec[2].data()[2] =
         _tmp30 * inputs.values_vec[2].rot_vec[2].data()[2];
     _outputs_1.values_vec_out[2].rot_vec[2].data()[3] =
-        -std::pow(inputs.values_vec[2].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].rot_vec[2].data()[3], Scalar(2));
+        -(inputs.values_vec[2].rot_vec[2].data()[0] * inputs.values_vec[2].rot_vec[2].data()[0]) -
+        (inputs.values_vec[2].rot_vec[2].data()[1] * inputs.values_vec[2].rot_vec[2].data()[1]) -
+        (inputs.values_vec[2].rot_vec[2].data()[2] * inputs.values_vec[2].rot_vec[2].data()[2]) +
+        (inputs.values_vec[2].rot_vec[2].data()[3] * inputs.values_vec[2].rot_vec[2].data()[3]);
     _outputs_1.values_vec_out[2].scalar_vec[0] = 2 * inputs.values_vec[2].scalar_vec[0];
     _outputs_1.values_vec_out[2].scalar_vec[1] = 2 * inputs.values_vec[2].scalar_vec[1];
     _outputs_1.values_vec_out[2].scalar_vec[2] = 2 * inputs.values_vec[2].scalar_vec[2];
@@ -450,10 +522,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[0][0].data()[2] =
         _tmp31 * inputs.values_vec[2].list_of_lists[0][0].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[0][0].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[0][0].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[0][0].data()[0] *
+          inputs.values_vec[2].list_of_lists[0][0].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[0][0].data()[1] *
+         inputs.values_vec[2].list_of_lists[0][0].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[0][0].data()[2] *
+         inputs.values_vec[2].list_of_lists[0][0].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[0][0].data()[3] *
+         inputs.values_vec[2].list_of_lists[0][0].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[0][1].data()[0] =
         _tmp32 * inputs.values_vec[2].list_of_lists[0][1].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[0][1].data()[1] =
@@ -461,10 +537,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[0][1].data()[2] =
         _tmp32 * inputs.values_vec[2].list_of_lists[0][1].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[0][1].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[0][1].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[0][1].data()[0] *
+          inputs.values_vec[2].list_of_lists[0][1].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[0][1].data()[1] *
+         inputs.values_vec[2].list_of_lists[0][1].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[0][1].data()[2] *
+         inputs.values_vec[2].list_of_lists[0][1].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[0][1].data()[3] *
+         inputs.values_vec[2].list_of_lists[0][1].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[0][2].data()[0] =
         _tmp33 * inputs.values_vec[2].list_of_lists[0][2].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[0][2].data()[1] =
@@ -472,10 +552,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[0][2].data()[2] =
         _tmp33 * inputs.values_vec[2].list_of_lists[0][2].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[0][2].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[0][2].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[0][2].data()[0] *
+          inputs.values_vec[2].list_of_lists[0][2].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[0][2].data()[1] *
+         inputs.values_vec[2].list_of_lists[0][2].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[0][2].data()[2] *
+         inputs.values_vec[2].list_of_lists[0][2].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[0][2].data()[3] *
+         inputs.values_vec[2].list_of_lists[0][2].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[1][0].data()[0] =
         _tmp34 * inputs.values_vec[2].list_of_lists[1][0].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[1][0].data()[1] =
@@ -483,10 +567,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[1][0].data()[2] =
         _tmp34 * inputs.values_vec[2].list_of_lists[1][0].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[1][0].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[1][0].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[1][0].data()[0] *
+          inputs.values_vec[2].list_of_lists[1][0].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[1][0].data()[1] *
+         inputs.values_vec[2].list_of_lists[1][0].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[1][0].data()[2] *
+         inputs.values_vec[2].list_of_lists[1][0].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[1][0].data()[3] *
+         inputs.values_vec[2].list_of_lists[1][0].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[1][1].data()[0] =
         _tmp35 * inputs.values_vec[2].list_of_lists[1][1].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[1][1].data()[1] =
@@ -494,10 +582,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[1][1].data()[2] =
         _tmp35 * inputs.values_vec[2].list_of_lists[1][1].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[1][1].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[1][1].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[1][1].data()[0] *
+          inputs.values_vec[2].list_of_lists[1][1].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[1][1].data()[1] *
+         inputs.values_vec[2].list_of_lists[1][1].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[1][1].data()[2] *
+         inputs.values_vec[2].list_of_lists[1][1].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[1][1].data()[3] *
+         inputs.values_vec[2].list_of_lists[1][1].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[1][2].data()[0] =
         _tmp36 * inputs.values_vec[2].list_of_lists[1][2].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[1][2].data()[1] =
@@ -505,10 +597,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[1][2].data()[2] =
         _tmp36 * inputs.values_vec[2].list_of_lists[1][2].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[1][2].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[1][2].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[1][2].data()[0] *
+          inputs.values_vec[2].list_of_lists[1][2].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[1][2].data()[1] *
+         inputs.values_vec[2].list_of_lists[1][2].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[1][2].data()[2] *
+         inputs.values_vec[2].list_of_lists[1][2].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[1][2].data()[3] *
+         inputs.values_vec[2].list_of_lists[1][2].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[2][0].data()[0] =
         _tmp37 * inputs.values_vec[2].list_of_lists[2][0].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[2][0].data()[1] =
@@ -516,10 +612,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[2][0].data()[2] =
         _tmp37 * inputs.values_vec[2].list_of_lists[2][0].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[2][0].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[2][0].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[2][0].data()[0] *
+          inputs.values_vec[2].list_of_lists[2][0].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[2][0].data()[1] *
+         inputs.values_vec[2].list_of_lists[2][0].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[2][0].data()[2] *
+         inputs.values_vec[2].list_of_lists[2][0].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[2][0].data()[3] *
+         inputs.values_vec[2].list_of_lists[2][0].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[2][1].data()[0] =
         _tmp38 * inputs.values_vec[2].list_of_lists[2][1].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[2][1].data()[1] =
@@ -527,10 +627,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[2][1].data()[2] =
         _tmp38 * inputs.values_vec[2].list_of_lists[2][1].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[2][1].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[2][1].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[2][1].data()[0] *
+          inputs.values_vec[2].list_of_lists[2][1].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[2][1].data()[1] *
+         inputs.values_vec[2].list_of_lists[2][1].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[2][1].data()[2] *
+         inputs.values_vec[2].list_of_lists[2][1].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[2][1].data()[3] *
+         inputs.values_vec[2].list_of_lists[2][1].data()[3]);
     _outputs_1.values_vec_out[2].list_of_lists[2][2].data()[0] =
         _tmp39 * inputs.values_vec[2].list_of_lists[2][2].data()[0];
     _outputs_1.values_vec_out[2].list_of_lists[2][2].data()[1] =
@@ -538,10 +642,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_out[2].list_of_lists[2][2].data()[2] =
         _tmp39 * inputs.values_vec[2].list_of_lists[2][2].data()[2];
     _outputs_1.values_vec_out[2].list_of_lists[2][2].data()[3] =
-        -std::pow(inputs.values_vec[2].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec[2].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec[2].list_of_lists[2][2].data()[3], Scalar(2));
+        -(inputs.values_vec[2].list_of_lists[2][2].data()[0] *
+          inputs.values_vec[2].list_of_lists[2][2].data()[0]) -
+        (inputs.values_vec[2].list_of_lists[2][2].data()[1] *
+         inputs.values_vec[2].list_of_lists[2][2].data()[1]) -
+        (inputs.values_vec[2].list_of_lists[2][2].data()[2] *
+         inputs.values_vec[2].list_of_lists[2][2].data()[2]) +
+        (inputs.values_vec[2].list_of_lists[2][2].data()[3] *
+         inputs.values_vec[2].list_of_lists[2][2].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].x = 2 * inputs.values_vec_2D[0][0].x;
     _outputs_1.values_vec_2D_out[0][0].y = 2 * inputs.values_vec_2D[0][0].y;
     _outputs_1.values_vec_2D_out[0][0].rot.data()[0] =
@@ -551,10 +659,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].rot.data()[2] =
         _tmp40 * inputs.values_vec_2D[0][0].rot.data()[2];
     _outputs_1.values_vec_2D_out[0][0].rot.data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].rot.data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot.data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot.data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].rot.data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].rot.data()[0] * inputs.values_vec_2D[0][0].rot.data()[0]) -
+        (inputs.values_vec_2D[0][0].rot.data()[1] * inputs.values_vec_2D[0][0].rot.data()[1]) -
+        (inputs.values_vec_2D[0][0].rot.data()[2] * inputs.values_vec_2D[0][0].rot.data()[2]) +
+        (inputs.values_vec_2D[0][0].rot.data()[3] * inputs.values_vec_2D[0][0].rot.data()[3]);
     _outputs_1.values_vec_2D_out[0][0].rot_vec[0].data()[0] =
         _tmp41 * inputs.values_vec_2D[0][0].rot_vec[0].data()[0];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[0].data()[1] =
@@ -562,10 +670,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].rot_vec[0].data()[2] =
         _tmp41 * inputs.values_vec_2D[0][0].rot_vec[0].data()[2];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[0].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].rot_vec[0].data()[0] *
+          inputs.values_vec_2D[0][0].rot_vec[0].data()[0]) -
+        (inputs.values_vec_2D[0][0].rot_vec[0].data()[1] *
+         inputs.values_vec_2D[0][0].rot_vec[0].data()[1]) -
+        (inputs.values_vec_2D[0][0].rot_vec[0].data()[2] *
+         inputs.values_vec_2D[0][0].rot_vec[0].data()[2]) +
+        (inputs.values_vec_2D[0][0].rot_vec[0].data()[3] *
+         inputs.values_vec_2D[0][0].rot_vec[0].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].rot_vec[1].data()[0] =
         _tmp42 * inputs.values_vec_2D[0][0].rot_vec[1].data()[0];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[1].data()[1] =
@@ -573,10 +685,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].rot_vec[1].data()[2] =
         _tmp42 * inputs.values_vec_2D[0][0].rot_vec[1].data()[2];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[1].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].rot_vec[1].data()[0] *
+          inputs.values_vec_2D[0][0].rot_vec[1].data()[0]) -
+        (inputs.values_vec_2D[0][0].rot_vec[1].data()[1] *
+         inputs.values_vec_2D[0][0].rot_vec[1].data()[1]) -
+        (inputs.values_vec_2D[0][0].rot_vec[1].data()[2] *
+         inputs.values_vec_2D[0][0].rot_vec[1].data()[2]) +
+        (inputs.values_vec_2D[0][0].rot_vec[1].data()[3] *
+         inputs.values_vec_2D[0][0].rot_vec[1].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].rot_vec[2].data()[0] =
         _tmp43 * inputs.values_vec_2D[0][0].rot_vec[2].data()[0];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[2].data()[1] =
@@ -584,10 +700,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].rot_vec[2].data()[2] =
         _tmp43 * inputs.values_vec_2D[0][0].rot_vec[2].data()[2];
     _outputs_1.values_vec_2D_out[0][0].rot_vec[2].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].rot_vec[2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].rot_vec[2].data()[0] *
+          inputs.values_vec_2D[0][0].rot_vec[2].data()[0]) -
+        (inputs.values_vec_2D[0][0].rot_vec[2].data()[1] *
+         inputs.values_vec_2D[0][0].rot_vec[2].data()[1]) -
+        (inputs.values_vec_2D[0][0].rot_vec[2].data()[2] *
+         inputs.values_vec_2D[0][0].rot_vec[2].data()[2]) +
+        (inputs.values_vec_2D[0][0].rot_vec[2].data()[3] *
+         inputs.values_vec_2D[0][0].rot_vec[2].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].scalar_vec[0] = 2 * inputs.values_vec_2D[0][0].scalar_vec[0];
     _outputs_1.values_vec_2D_out[0][0].scalar_vec[1] = 2 * inputs.values_vec_2D[0][0].scalar_vec[1];
     _outputs_1.values_vec_2D_out[0][0].scalar_vec[2] = 2 * inputs.values_vec_2D[0][0].scalar_vec[2];
@@ -598,10 +718,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][0].data()[2] =
         _tmp44 * inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][0].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][1].data()[0] =
         _tmp45 * inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][1].data()[1] =
@@ -609,10 +733,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][1].data()[2] =
         _tmp45 * inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][1].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][2].data()[0] =
         _tmp46 * inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][2].data()[1] =
@@ -620,10 +748,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][2].data()[2] =
         _tmp46 * inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[0][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[0][2].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][0].data()[0] =
         _tmp47 * inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][0].data()[1] =
@@ -631,10 +763,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][0].data()[2] =
         _tmp47 * inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][0].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][1].data()[0] =
         _tmp48 * inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][1].data()[1] =
@@ -642,10 +778,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][1].data()[2] =
         _tmp48 * inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][1].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][2].data()[0] =
         _tmp49 * inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][2].data()[1] =
@@ -653,10 +793,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][2].data()[2] =
         _tmp49 * inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[1][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[1][2].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][0].data()[0] =
         _tmp50 * inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][0].data()[1] =
@@ -664,10 +808,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][0].data()[2] =
         _tmp50 * inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][0].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][1].data()[0] =
         _tmp51 * inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][1].data()[1] =
@@ -675,10 +823,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][1].data()[2] =
         _tmp51 * inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][1].data()[3]);
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][2].data()[0] =
         _tmp52 * inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[0];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][2].data()[1] =
@@ -686,10 +838,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][2].data()[2] =
         _tmp52 * inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[2];
     _outputs_1.values_vec_2D_out[0][0].list_of_lists[2][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[0] *
+          inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[0]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[1] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[1]) -
+        (inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[2] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[2]) +
+        (inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[3] *
+         inputs.values_vec_2D[0][0].list_of_lists[2][2].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].x = 2 * inputs.values_vec_2D[1][0].x;
     _outputs_1.values_vec_2D_out[1][0].y = 2 * inputs.values_vec_2D[1][0].y;
     _outputs_1.values_vec_2D_out[1][0].rot.data()[0] =
@@ -699,10 +855,10 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].rot.data()[2] =
         _tmp53 * inputs.values_vec_2D[1][0].rot.data()[2];
     _outputs_1.values_vec_2D_out[1][0].rot.data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].rot.data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot.data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot.data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].rot.data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].rot.data()[0] * inputs.values_vec_2D[1][0].rot.data()[0]) -
+        (inputs.values_vec_2D[1][0].rot.data()[1] * inputs.values_vec_2D[1][0].rot.data()[1]) -
+        (inputs.values_vec_2D[1][0].rot.data()[2] * inputs.values_vec_2D[1][0].rot.data()[2]) +
+        (inputs.values_vec_2D[1][0].rot.data()[3] * inputs.values_vec_2D[1][0].rot.data()[3]);
     _outputs_1.values_vec_2D_out[1][0].rot_vec[0].data()[0] =
         _tmp54 * inputs.values_vec_2D[1][0].rot_vec[0].data()[0];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[0].data()[1] =
@@ -710,10 +866,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].rot_vec[0].data()[2] =
         _tmp54 * inputs.values_vec_2D[1][0].rot_vec[0].data()[2];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[0].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].rot_vec[0].data()[0] *
+          inputs.values_vec_2D[1][0].rot_vec[0].data()[0]) -
+        (inputs.values_vec_2D[1][0].rot_vec[0].data()[1] *
+         inputs.values_vec_2D[1][0].rot_vec[0].data()[1]) -
+        (inputs.values_vec_2D[1][0].rot_vec[0].data()[2] *
+         inputs.values_vec_2D[1][0].rot_vec[0].data()[2]) +
+        (inputs.values_vec_2D[1][0].rot_vec[0].data()[3] *
+         inputs.values_vec_2D[1][0].rot_vec[0].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].rot_vec[1].data()[0] =
         _tmp55 * inputs.values_vec_2D[1][0].rot_vec[1].data()[0];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[1].data()[1] =
@@ -721,10 +881,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].rot_vec[1].data()[2] =
         _tmp55 * inputs.values_vec_2D[1][0].rot_vec[1].data()[2];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[1].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].rot_vec[1].data()[0] *
+          inputs.values_vec_2D[1][0].rot_vec[1].data()[0]) -
+        (inputs.values_vec_2D[1][0].rot_vec[1].data()[1] *
+         inputs.values_vec_2D[1][0].rot_vec[1].data()[1]) -
+        (inputs.values_vec_2D[1][0].rot_vec[1].data()[2] *
+         inputs.values_vec_2D[1][0].rot_vec[1].data()[2]) +
+        (inputs.values_vec_2D[1][0].rot_vec[1].data()[3] *
+         inputs.values_vec_2D[1][0].rot_vec[1].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].rot_vec[2].data()[0] =
         _tmp56 * inputs.values_vec_2D[1][0].rot_vec[2].data()[0];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[2].data()[1] =
@@ -732,10 +896,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].rot_vec[2].data()[2] =
         _tmp56 * inputs.values_vec_2D[1][0].rot_vec[2].data()[2];
     _outputs_1.values_vec_2D_out[1][0].rot_vec[2].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].rot_vec[2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].rot_vec[2].data()[0] *
+          inputs.values_vec_2D[1][0].rot_vec[2].data()[0]) -
+        (inputs.values_vec_2D[1][0].rot_vec[2].data()[1] *
+         inputs.values_vec_2D[1][0].rot_vec[2].data()[1]) -
+        (inputs.values_vec_2D[1][0].rot_vec[2].data()[2] *
+         inputs.values_vec_2D[1][0].rot_vec[2].data()[2]) +
+        (inputs.values_vec_2D[1][0].rot_vec[2].data()[3] *
+         inputs.values_vec_2D[1][0].rot_vec[2].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].scalar_vec[0] = 2 * inputs.values_vec_2D[1][0].scalar_vec[0];
     _outputs_1.values_vec_2D_out[1][0].scalar_vec[1] = 2 * inputs.values_vec_2D[1][0].scalar_vec[1];
     _outputs_1.values_vec_2D_out[1][0].scalar_vec[2] = 2 * inputs.values_vec_2D[1][0].scalar_vec[2];
@@ -746,10 +914,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][0].data()[2] =
         _tmp57 * inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][0].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][1].data()[0] =
         _tmp58 * inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][1].data()[1] =
@@ -757,10 +929,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][1].data()[2] =
         _tmp58 * inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][1].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][2].data()[0] =
         _tmp59 * inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][2].data()[1] =
@@ -768,10 +944,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][2].data()[2] =
         _tmp59 * inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[0][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[0][2].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][0].data()[0] =
         _tmp60 * inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][0].data()[1] =
@@ -779,10 +959,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][0].data()[2] =
         _tmp60 * inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][0].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][1].data()[0] =
         _tmp61 * inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][1].data()[1] =
@@ -790,10 +974,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][1].data()[2] =
         _tmp61 * inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][1].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][2].data()[0] =
         _tmp62 * inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][2].data()[1] =
@@ -801,10 +989,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][2].data()[2] =
         _tmp62 * inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[1][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[1][2].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][0].data()[0] =
         _tmp63 * inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][0].data()[1] =
@@ -812,10 +1004,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][0].data()[2] =
         _tmp63 * inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][0].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][0].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][1].data()[0] =
         _tmp64 * inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][1].data()[1] =
@@ -823,10 +1019,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][1].data()[2] =
         _tmp64 * inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][1].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][1].data()[3]);
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][2].data()[0] =
         _tmp65 * inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[0];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][2].data()[1] =
@@ -834,10 +1034,14 @@ void CodegenMultiFunctionTest1(
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][2].data()[2] =
         _tmp65 * inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[2];
     _outputs_1.values_vec_2D_out[1][0].list_of_lists[2][2].data()[3] =
-        -std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[0] *
+          inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[0]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[1] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[1]) -
+        (inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[2] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[2]) +
+        (inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[3] *
+         inputs.values_vec_2D[1][0].list_of_lists[2][2].data()[3]);
   }
 }  // NOLINT(readability/fn_size)
 
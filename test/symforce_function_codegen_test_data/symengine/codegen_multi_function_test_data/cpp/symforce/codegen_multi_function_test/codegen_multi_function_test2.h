@@ -36,10 +36,7 @@ void CodegenMultiFunctionTest2(
   if (outputs_2 != nullptr) {
     codegen_multi_function_test::outputs_2_t& _outputs_2 = (*outputs_2);
 
-    _outputs_2.foo = inputs.x + [&]() {
-      const Scalar base = inputs.y;
-      return base * base * base;
-    }();
+    _outputs_2.foo = inputs.x + (inputs.y * inputs.y * inputs.y);
   }
 }  // NOLINT(readability/fn_size)
 
@@ -30,21 +30,23 @@ Scalar IdentityDistJacobian(const sym::Rot3<Scalar>& R1, const Scalar e) {
   const Eigen::Matrix<Scalar, 4, 1>& _R1 = R1.Data();
 
   // Intermediate terms (14)
-  const Scalar _tmp0 = std::pow(_R1[2], Scalar(2));
+  const Scalar _tmp0 = (_R1[2] * _R1[2]);
   const Scalar _tmp1 = (((_R1[3]) > 0) - ((_R1[3]) < 0));
   const Scalar _tmp2 = std::fabs(_R1[3]);
   const Scalar _tmp3 = 1 - e;
-  const Scalar _tmp4 = 4 * _tmp1 * ((((-_tmp2 + _tmp3) > 0) - ((-_tmp2 + _tmp3) < 0)) + 1) *
-                       std::pow(Scalar(2 * std::min<Scalar>(0, _tmp1) + 1), Scalar(2));
+  const Scalar _tmp4 = 4 * _tmp1 * ((((-_tmp2 + _tmp3) > 0) - ((-_tmp2 + _tmp3) < 0)) + 1) * [&]() {
+    const Scalar base = 2 * std::min<Scalar>(0, _tmp1) + 1;
+    return base * base;
+  }();
   const Scalar _tmp5 = std::min<Scalar>(_tmp2, _tmp3);
   const Scalar _tmp6 = std::acos(_tmp5);
-  const Scalar _tmp7 = 1 - std::pow(_tmp5, Scalar(2));
-  const Scalar _tmp8 = _tmp5 * std::pow(_tmp6, Scalar(2)) / std::pow(_tmp7, Scalar(2));
+  const Scalar _tmp7 = 1 - (_tmp5 * _tmp5);
+  const Scalar _tmp8 = _tmp5 * (_tmp6 * _tmp6) / (_tmp7 * _tmp7);
   const Scalar _tmp9 = _tmp4 * _tmp8;
-  const Scalar _tmp10 = std::pow(_R1[0], Scalar(2));
+  const Scalar _tmp10 = (_R1[0] * _R1[0]);
   const Scalar _tmp11 = _tmp6 / (_tmp7 * std::sqrt(_tmp7));
   const Scalar _tmp12 = _tmp11 * _tmp4;
-  const Scalar _tmp13 = std::pow(_R1[1], Scalar(2)) * _tmp4;
+  const Scalar _tmp13 = (_R1[1] * _R1[1]) * _tmp4;
 
   // Output terms (1)
   Scalar _dist_D_R1;
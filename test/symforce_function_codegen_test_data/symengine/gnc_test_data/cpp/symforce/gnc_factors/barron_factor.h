@@ -41,7 +41,7 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
   // Intermediate terms (45)
   const Scalar _tmp0 = -std::sqrt(eps);
   const Scalar _tmp1 = x(0, 0) - y(0, 0);
-  const Scalar _tmp2 = std::pow(_tmp1, Scalar(2));
+  const Scalar _tmp2 = (_tmp1 * _tmp1);
   const Scalar _tmp3 = Scalar(1.0) / (eps - mu + 1);
   const Scalar _tmp4 = eps + std::fabs(_tmp3);
   const Scalar _tmp5 = Scalar(1.0) / (_tmp4);
@@ -54,25 +54,25 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
   const Scalar _tmp12 = std::sqrt(_tmp11);
   const Scalar _tmp13 = _tmp0 + _tmp12;
   const Scalar _tmp14 = x(1, 0) - y(1, 0);
-  const Scalar _tmp15 = std::pow(_tmp14, Scalar(2));
+  const Scalar _tmp15 = (_tmp14 * _tmp14);
   const Scalar _tmp16 = _tmp15 * _tmp5 + 1;
   const Scalar _tmp17 = _tmp10 * (std::pow(_tmp16, _tmp9) - 1) + eps;
   const Scalar _tmp18 = std::sqrt(_tmp17);
   const Scalar _tmp19 = _tmp0 + _tmp18;
   const Scalar _tmp20 = x(2, 0) - y(2, 0);
-  const Scalar _tmp21 = std::pow(_tmp20, Scalar(2));
+  const Scalar _tmp21 = (_tmp20 * _tmp20);
   const Scalar _tmp22 = _tmp21 * _tmp5 + 1;
   const Scalar _tmp23 = _tmp10 * (std::pow(_tmp22, _tmp9) - 1) + eps;
   const Scalar _tmp24 = std::sqrt(_tmp23);
   const Scalar _tmp25 = _tmp0 + _tmp24;
   const Scalar _tmp26 = x(3, 0) - y(3, 0);
-  const Scalar _tmp27 = std::pow(_tmp26, Scalar(2));
+  const Scalar _tmp27 = (_tmp26 * _tmp26);
   const Scalar _tmp28 = _tmp27 * _tmp5 + 1;
   const Scalar _tmp29 = _tmp10 * (std::pow(_tmp28, _tmp9) - 1) + eps;
   const Scalar _tmp30 = std::sqrt(_tmp29);
   const Scalar _tmp31 = _tmp0 + _tmp30;
   const Scalar _tmp32 = x(4, 0) - y(4, 0);
-  const Scalar _tmp33 = std::pow(_tmp32, Scalar(2));
+  const Scalar _tmp33 = (_tmp32 * _tmp32);
   const Scalar _tmp34 = _tmp33 * _tmp5 + 1;
   const Scalar _tmp35 = _tmp10 * (std::pow(_tmp34, _tmp9) - 1) + eps;
   const Scalar _tmp36 = std::sqrt(_tmp35);
@@ -82,11 +82,11 @@ Eigen::Matrix<Scalar, 6, 6> ComposePose3Jacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp51 = _a[1] * _tmp47;
   const Scalar _tmp52 = -_tmp51;
   const Scalar _tmp53 = _a[2] * _tmp49;
-  const Scalar _tmp54 = std::pow(_a[2], Scalar(2));
-  const Scalar _tmp55 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp56 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp54 = (_a[2] * _a[2]);
+  const Scalar _tmp55 = (_a[0] * _a[0]);
+  const Scalar _tmp56 = (_a[1] * _a[1]);
   const Scalar _tmp57 = -_tmp56;
-  const Scalar _tmp58 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp58 = (_a[3] * _a[3]);
   const Scalar _tmp59 = -_tmp58;
   const Scalar _tmp60 = 2 * _a[1] * _a[2];
   const Scalar _tmp61 = _a[3] * _tmp47;
@@ -82,15 +82,15 @@ Eigen::Matrix<Scalar, 6, 6> ComposePose3Jacobian1(const sym::Pose3<Scalar>& a,
   const Scalar _tmp50 = _tmp20 * _tmp48;
   const Scalar _tmp51 = _tmp33 * _tmp38;
   const Scalar _tmp52 = _tmp12 + _tmp14 - _tmp16 + _tmp18;
-  const Scalar _tmp53 = -2 * std::pow(_a[2], Scalar(2));
-  const Scalar _tmp54 = -2 * std::pow(_a[1], Scalar(2));
+  const Scalar _tmp53 = -2 * (_a[2] * _a[2]);
+  const Scalar _tmp54 = -2 * (_a[1] * _a[1]);
   const Scalar _tmp55 = 2 * _a[0];
   const Scalar _tmp56 = _a[1] * _tmp55;
   const Scalar _tmp57 = 2 * _a[3];
   const Scalar _tmp58 = _a[2] * _tmp57;
   const Scalar _tmp59 = _a[2] * _tmp55;
   const Scalar _tmp60 = _a[1] * _tmp57;
-  const Scalar _tmp61 = 1 - 2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp61 = 1 - 2 * (_a[0] * _a[0]);
   const Scalar _tmp62 = 2 * _a[1] * _a[2];
   const Scalar _tmp63 = _a[3] * _tmp55;
 
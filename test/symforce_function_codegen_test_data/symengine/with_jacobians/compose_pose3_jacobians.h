@@ -93,12 +93,12 @@ void ComposePose3Jacobians(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>
   const Scalar _tmp60 = _a[1] * _tmp55;
   const Scalar _tmp61 = -_tmp60;
   const Scalar _tmp62 = _a[2] * _tmp57;
-  const Scalar _tmp63 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp64 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp63 = (_a[0] * _a[0]);
+  const Scalar _tmp64 = (_a[1] * _a[1]);
   const Scalar _tmp65 = -_tmp64;
   const Scalar _tmp66 = _tmp63 + _tmp65;
-  const Scalar _tmp67 = std::pow(_a[2], Scalar(2));
-  const Scalar _tmp68 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp67 = (_a[2] * _a[2]);
+  const Scalar _tmp68 = (_a[3] * _a[3]);
   const Scalar _tmp69 = -_tmp68;
   const Scalar _tmp70 = _tmp67 + _tmp69;
   const Scalar _tmp71 = 2 * _a[1] * _a[2];
@@ -50,9 +50,9 @@ sym::Pose3<Scalar> ComposePose3WithJacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp17 = _a[0] * _b[0];
   const Scalar _tmp18 = _a[3] * _b[3];
   const Scalar _tmp19 = -_tmp15 - _tmp16 - _tmp17 + _tmp18;
-  const Scalar _tmp20 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp20 = (_a[2] * _a[2]);
   const Scalar _tmp21 = -2 * _tmp20;
-  const Scalar _tmp22 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp22 = (_a[1] * _a[1]);
   const Scalar _tmp23 = -2 * _tmp22;
   const Scalar _tmp24 = 2 * _a[2];
   const Scalar _tmp25 = _a[0] * _tmp24;
@@ -63,7 +63,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp30 = _a[3] * _tmp24;
   const Scalar _tmp31 = -_tmp30;
   const Scalar _tmp32 = _tmp29 + _tmp31;
-  const Scalar _tmp33 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp33 = (_a[0] * _a[0]);
   const Scalar _tmp34 = 1 - 2 * _tmp33;
   const Scalar _tmp35 = _a[2] * _tmp26;
   const Scalar _tmp36 = 2 * _a[0] * _a[3];
@@ -105,7 +105,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp72 = _tmp67 - _tmp68 + _tmp71;
   const Scalar _tmp73 = 2 * _tmp19;
   const Scalar _tmp74 = -_tmp29;
-  const Scalar _tmp75 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp75 = (_a[3] * _a[3]);
   const Scalar _tmp76 = -_tmp75;
   const Scalar _tmp77 = _tmp20 + _tmp76;
   const Scalar _tmp78 = -_tmp22;
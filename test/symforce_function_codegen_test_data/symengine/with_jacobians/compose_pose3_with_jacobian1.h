@@ -50,8 +50,8 @@ sym::Pose3<Scalar> ComposePose3WithJacobian1(const sym::Pose3<Scalar>& a,
   const Scalar _tmp17 = _a[0] * _b[0];
   const Scalar _tmp18 = _a[3] * _b[3];
   const Scalar _tmp19 = -_tmp15 - _tmp16 - _tmp17 + _tmp18;
-  const Scalar _tmp20 = -2 * std::pow(_a[2], Scalar(2));
-  const Scalar _tmp21 = -2 * std::pow(_a[1], Scalar(2));
+  const Scalar _tmp20 = -2 * (_a[2] * _a[2]);
+  const Scalar _tmp21 = -2 * (_a[1] * _a[1]);
   const Scalar _tmp22 = _tmp20 + _tmp21 + 1;
   const Scalar _tmp23 = 2 * _a[0];
   const Scalar _tmp24 = _a[2] * _tmp23;
@@ -61,7 +61,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobian1(const sym::Pose3<Scalar>& a,
   const Scalar _tmp28 = _a[1] * _tmp23;
   const Scalar _tmp29 = _a[2] * _tmp25;
   const Scalar _tmp30 = _tmp28 - _tmp29;
-  const Scalar _tmp31 = 1 - 2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp31 = 1 - 2 * (_a[0] * _a[0]);
   const Scalar _tmp32 = _tmp20 + _tmp31;
   const Scalar _tmp33 = 2 * _a[1] * _a[2];
   const Scalar _tmp34 = _a[3] * _tmp23;
@@ -52,9 +52,9 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp17 = _a[0] * _b[0];
   const Scalar _tmp18 = _a[3] * _b[3];
   const Scalar _tmp19 = -_tmp15 - _tmp16 - _tmp17 + _tmp18;
-  const Scalar _tmp20 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp20 = (_a[2] * _a[2]);
   const Scalar _tmp21 = -2 * _tmp20;
-  const Scalar _tmp22 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp22 = (_a[1] * _a[1]);
   const Scalar _tmp23 = -2 * _tmp22;
   const Scalar _tmp24 = _tmp21 + _tmp23 + 1;
   const Scalar _tmp25 = 2 * _a[0];
@@ -66,7 +66,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp31 = _a[2] * _tmp27;
   const Scalar _tmp32 = -_tmp31;
   const Scalar _tmp33 = _tmp30 + _tmp32;
-  const Scalar _tmp34 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp34 = (_a[0] * _a[0]);
   const Scalar _tmp35 = 1 - 2 * _tmp34;
   const Scalar _tmp36 = _tmp21 + _tmp35;
   const Scalar _tmp37 = 2 * _a[1] * _a[2];
@@ -119,7 +119,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp84 = -_tmp30;
   const Scalar _tmp85 = -_tmp22;
   const Scalar _tmp86 = _tmp34 + _tmp85;
-  const Scalar _tmp87 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp87 = (_a[3] * _a[3]);
   const Scalar _tmp88 = -_tmp87;
   const Scalar _tmp89 = _tmp20 + _tmp88;
   const Scalar _tmp90 = -_tmp34;
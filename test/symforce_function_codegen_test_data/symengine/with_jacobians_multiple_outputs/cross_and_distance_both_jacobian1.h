@@ -37,9 +37,9 @@ void CrossAndDistanceBothJacobian1(const Eigen::Matrix<Scalar, 3, 1>& a,
   const Scalar _tmp0 = a(0, 0) - b(0, 0);
   const Scalar _tmp1 = a(1, 0) - b(1, 0);
   const Scalar _tmp2 = a(2, 0) - b(2, 0);
-  const Scalar _tmp3 = std::pow(Scalar(std::pow(_tmp0, Scalar(2)) + std::pow(_tmp1, Scalar(2)) +
-                                       std::pow(_tmp2, Scalar(2)) + epsilon),
-                                Scalar(Scalar(-1) / Scalar(2)));
+  const Scalar _tmp3 =
+      Scalar(1.0) /
+      std::sqrt(Scalar((_tmp0 * _tmp0) + (_tmp1 * _tmp1) + (_tmp2 * _tmp2) + epsilon));
 
   // Output terms (2)
   if (cross_D_b != nullptr) {
@@ -43,8 +43,8 @@ Eigen::Matrix<Scalar, 3, 1> CrossAndDistanceBothWithJacobian0(
   const Scalar _tmp3 = _tmp2 + a(1, 0);
   const Scalar _tmp4 = -b(2, 0);
   const Scalar _tmp5 = _tmp4 + a(2, 0);
-  const Scalar _tmp6 = std::sqrt(Scalar(std::pow(_tmp1, Scalar(2)) + std::pow(_tmp3, Scalar(2)) +
-                                        std::pow(_tmp5, Scalar(2)) + epsilon));
+  const Scalar _tmp6 =
+      std::sqrt(Scalar((_tmp1 * _tmp1) + (_tmp3 * _tmp3) + (_tmp5 * _tmp5) + epsilon));
   const Scalar _tmp7 = Scalar(1.0) / (_tmp6);
 
   // Output terms (4)
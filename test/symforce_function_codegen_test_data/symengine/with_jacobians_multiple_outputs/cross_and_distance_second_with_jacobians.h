@@ -42,8 +42,8 @@ Eigen::Matrix<Scalar, 3, 1> CrossAndDistanceSecondWithJacobians(
   const Scalar _tmp0 = a(0, 0) - b(0, 0);
   const Scalar _tmp1 = a(1, 0) - b(1, 0);
   const Scalar _tmp2 = a(2, 0) - b(2, 0);
-  const Scalar _tmp3 = std::sqrt(Scalar(std::pow(_tmp0, Scalar(2)) + std::pow(_tmp1, Scalar(2)) +
-                                        std::pow(_tmp2, Scalar(2)) + epsilon));
+  const Scalar _tmp3 =
+      std::sqrt(Scalar((_tmp0 * _tmp0) + (_tmp1 * _tmp1) + (_tmp2 * _tmp2) + epsilon));
   const Scalar _tmp4 = Scalar(1.0) / (_tmp3);
   const Scalar _tmp5 = _tmp0 * _tmp4;
   const Scalar _tmp6 = _tmp1 * _tmp4;
@@ -46,9 +46,20 @@ Eigen::Matrix<Scalar, 3, 1> CrossAndDistanceWithJacobian1(
   if (distance != nullptr) {
     Scalar& _distance = (*distance);
 
-    _distance = std::sqrt(Scalar(epsilon + std::pow(Scalar(a(0, 0) - b(0, 0)), Scalar(2)) +
-                                 std::pow(Scalar(a(1, 0) - b(1, 0)), Scalar(2)) +
-                                 std::pow(Scalar(a(2, 0) - b(2, 0)), Scalar(2))));
+    _distance = std::sqrt(Scalar(
+        epsilon +
+        [&]() {
+          const Scalar base = a(0, 0) - b(0, 0);
+          return base * base;
+        }() +
+        [&]() {
+          const Scalar base = a(1, 0) - b(1, 0);
+          return base * base;
+        }() +
+        [&]() {
+          const Scalar base = a(2, 0) - b(2, 0);
+          return base * base;
+        }()));
   }
 
   if (cross_D_b != nullptr) {
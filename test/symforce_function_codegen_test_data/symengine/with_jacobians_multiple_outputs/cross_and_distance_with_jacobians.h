@@ -53,9 +53,20 @@ Eigen::Matrix<Scalar, 3, 1> CrossAndDistanceWithJacobians(
   if (distance != nullptr) {
     Scalar& _distance = (*distance);
 
-    _distance = std::sqrt(Scalar(epsilon + std::pow(Scalar(_tmp0 + a(0, 0)), Scalar(2)) +
-                                 std::pow(Scalar(_tmp1 + a(1, 0)), Scalar(2)) +
-                                 std::pow(Scalar(_tmp2 + a(2, 0)), Scalar(2))));
+    _distance = std::sqrt(Scalar(
+        epsilon +
+        [&]() {
+          const Scalar base = _tmp0 + a(0, 0);
+          return base * base;
+        }() +
+        [&]() {
+          const Scalar base = _tmp1 + a(1, 0);
+          return base * base;
+        }() +
+        [&]() {
+          const Scalar base = _tmp2 + a(2, 0);
+          return base * base;
+        }()));
   }
 
   if (cross_D_a != nullptr) {
@@ -83,18 +83,18 @@ void MiscFunctionWithJacobians(const sym::Rot3<Scalar>& a, const Scalar b,
   const Scalar _tmp5 = -_a[0] * _tmp0;
   const Scalar _tmp6 = _a[1] * _tmp2;
   const Scalar _tmp7 = _tmp5 + _tmp6;
-  const Scalar _tmp8 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp9 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp8 = (_a[0] * _a[0]);
+  const Scalar _tmp9 = (_a[1] * _a[1]);
   const Scalar _tmp10 = -2 * _tmp8 - 2 * _tmp9 + 1;
-  const Scalar _tmp11 = std::sqrt(Scalar(
-      std::pow(c(0, 0), Scalar(2)) + std::pow(c(1, 0), Scalar(2)) + std::pow(c(2, 0), Scalar(2)) +
-      std::pow(c(3, 0), Scalar(2)) + std::pow(c(4, 0), Scalar(2))));
+  const Scalar _tmp11 =
+      std::sqrt(Scalar((c(0, 0) * c(0, 0)) + (c(1, 0) * c(1, 0)) + (c(2, 0) * c(2, 0)) +
+                       (c(3, 0) * c(3, 0)) + (c(4, 0) * c(4, 0))));
   const Scalar _tmp12 = d.x + d.y.data()[1];
   const Scalar _tmp13 = d.x + d.y.data()[0];
   const Scalar _tmp14 = _a[3] * _tmp2;
   const Scalar _tmp15 = 2 * _a[0] * _a[1];
-  const Scalar _tmp16 = std::pow(_a[2], Scalar(2));
-  const Scalar _tmp17 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp16 = (_a[2] * _a[2]);
+  const Scalar _tmp17 = (_a[3] * _a[3]);
   const Scalar _tmp18 = _tmp8 - _tmp9;
   const Scalar _tmp19 = Scalar(1.0) / (_tmp11);
 
@@ -110,7 +110,7 @@ void MiscFunctionWithJacobians(const sym::Rot3<Scalar>& a, const Scalar b,
   if (b_out != nullptr) {
     Scalar& _b_out = (*b_out);
 
-    _b_out = _tmp11 + std::pow(b, Scalar(2));
+    _b_out = _tmp11 + (b * b);
   }
 
   if (c_out != nullptr) {
@@ -64,7 +64,7 @@ void CodegenCppTest(
   const Eigen::Matrix<Scalar, 4, 1>& _rot = rot.Data();
 
   // Intermediate terms (66)
-  const Scalar _tmp0 = std::pow(x, Scalar(2));
+  const Scalar _tmp0 = (x * x);
   const Scalar _tmp1 = 2 * values_vec[0].rot.data()[3];
   const Scalar _tmp2 = 2 * values_vec[0].rot_vec[0].data()[3];
   const Scalar _tmp3 = 2 * values_vec[0].rot_vec[1].data()[3];
@@ -160,34 +160,35 @@ void CodegenCppTest(
     _values_vec_out[0].rot.data()[0] = _tmp1 * values_vec[0].rot.data()[0];
     _values_vec_out[0].rot.data()[1] = _tmp1 * values_vec[0].rot.data()[1];
     _values_vec_out[0].rot.data()[2] = _tmp1 * values_vec[0].rot.data()[2];
-    _values_vec_out[0].rot.data()[3] = -std::pow(values_vec[0].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[0].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[0].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[0].rot.data()[3], Scalar(2));
+    _values_vec_out[0].rot.data()[3] =
+        -(values_vec[0].rot.data()[0] * values_vec[0].rot.data()[0]) -
+        (values_vec[0].rot.data()[1] * values_vec[0].rot.data()[1]) -
+        (values_vec[0].rot.data()[2] * values_vec[0].rot.data()[2]) +
+        (values_vec[0].rot.data()[3] * values_vec[0].rot.data()[3]);
     _values_vec_out[0].rot_vec[0].data()[0] = _tmp2 * values_vec[0].rot_vec[0].data()[0];
     _values_vec_out[0].rot_vec[0].data()[1] = _tmp2 * values_vec[0].rot_vec[0].data()[1];
     _values_vec_out[0].rot_vec[0].data()[2] = _tmp2 * values_vec[0].rot_vec[0].data()[2];
     _values_vec_out[0].rot_vec[0].data()[3] =
-        -std::pow(values_vec[0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[0].data()[0] * values_vec[0].rot_vec[0].data()[0]) -
+        (values_vec[0].rot_vec[0].data()[1] * values_vec[0].rot_vec[0].data()[1]) -
+        (values_vec[0].rot_vec[0].data()[2] * values_vec[0].rot_vec[0].data()[2]) +
+        (values_vec[0].rot_vec[0].data()[3] * values_vec[0].rot_vec[0].data()[3]);
     _values_vec_out[0].rot_vec[1].data()[0] = _tmp3 * values_vec[0].rot_vec[1].data()[0];
     _values_vec_out[0].rot_vec[1].data()[1] = _tmp3 * values_vec[0].rot_vec[1].data()[1];
     _values_vec_out[0].rot_vec[1].data()[2] = _tmp3 * values_vec[0].rot_vec[1].data()[2];
     _values_vec_out[0].rot_vec[1].data()[3] =
-        -std::pow(values_vec[0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[1].data()[0] * values_vec[0].rot_vec[1].data()[0]) -
+        (values_vec[0].rot_vec[1].data()[1] * values_vec[0].rot_vec[1].data()[1]) -
+        (values_vec[0].rot_vec[1].data()[2] * values_vec[0].rot_vec[1].data()[2]) +
+        (values_vec[0].rot_vec[1].data()[3] * values_vec[0].rot_vec[1].data()[3]);
     _values_vec_out[0].rot_vec[2].data()[0] = _tmp4 * values_vec[0].rot_vec[2].data()[0];
     _values_vec_out[0].rot_vec[2].data()[1] = _tmp4 * values_vec[0].rot_vec[2].data()[1];
     _values_vec_out[0].rot_vec[2].data()[2] = _tmp4 * values_vec[0].rot_vec[2].data()[2];
     _values_vec_out[0].rot_vec[2].data()[3] =
-        -std::pow(values_vec[0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[0].rot_vec[2].data()[0] * values_vec[0].rot_vec[2].data()[0]) -
+        (values_vec[0].rot_vec[2].data()[1] * values_vec[0].rot_vec[2].data()[1]) -
+        (values_vec[0].rot_vec[2].data()[2] * values_vec[0].rot_vec[2].data()[2]) +
+        (values_vec[0].rot_vec[2].data()[3] * values_vec[0].rot_vec[2].data()[3]);
     _values_vec_out[0].scalar_vec[0] = 2 * values_vec[0].scalar_vec[0];
     _values_vec_out[0].scalar_vec[1] = 2 * values_vec[0].scalar_vec[1];
     _values_vec_out[0].scalar_vec[2] = 2 * values_vec[0].scalar_vec[2];
@@ -198,10 +199,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[0][0].data()[2] =
         _tmp5 * values_vec[0].list_of_lists[0][0].data()[2];
     _values_vec_out[0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][0].data()[0] *
+          values_vec[0].list_of_lists[0][0].data()[0]) -
+        (values_vec[0].list_of_lists[0][0].data()[1] *
+         values_vec[0].list_of_lists[0][0].data()[1]) -
+        (values_vec[0].list_of_lists[0][0].data()[2] *
+         values_vec[0].list_of_lists[0][0].data()[2]) +
+        (values_vec[0].list_of_lists[0][0].data()[3] * values_vec[0].list_of_lists[0][0].data()[3]);
     _values_vec_out[0].list_of_lists[0][1].data()[0] =
         _tmp6 * values_vec[0].list_of_lists[0][1].data()[0];
     _values_vec_out[0].list_of_lists[0][1].data()[1] =
@@ -209,10 +213,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[0][1].data()[2] =
         _tmp6 * values_vec[0].list_of_lists[0][1].data()[2];
     _values_vec_out[0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][1].data()[0] *
+          values_vec[0].list_of_lists[0][1].data()[0]) -
+        (values_vec[0].list_of_lists[0][1].data()[1] *
+         values_vec[0].list_of_lists[0][1].data()[1]) -
+        (values_vec[0].list_of_lists[0][1].data()[2] *
+         values_vec[0].list_of_lists[0][1].data()[2]) +
+        (values_vec[0].list_of_lists[0][1].data()[3] * values_vec[0].list_of_lists[0][1].data()[3]);
     _values_vec_out[0].list_of_lists[0][2].data()[0] =
         _tmp7 * values_vec[0].list_of_lists[0][2].data()[0];
     _values_vec_out[0].list_of_lists[0][2].data()[1] =
@@ -220,10 +227,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[0][2].data()[2] =
         _tmp7 * values_vec[0].list_of_lists[0][2].data()[2];
     _values_vec_out[0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[0][2].data()[0] *
+          values_vec[0].list_of_lists[0][2].data()[0]) -
+        (values_vec[0].list_of_lists[0][2].data()[1] *
+         values_vec[0].list_of_lists[0][2].data()[1]) -
+        (values_vec[0].list_of_lists[0][2].data()[2] *
+         values_vec[0].list_of_lists[0][2].data()[2]) +
+        (values_vec[0].list_of_lists[0][2].data()[3] * values_vec[0].list_of_lists[0][2].data()[3]);
     _values_vec_out[0].list_of_lists[1][0].data()[0] =
         _tmp8 * values_vec[0].list_of_lists[1][0].data()[0];
     _values_vec_out[0].list_of_lists[1][0].data()[1] =
@@ -231,10 +241,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[1][0].data()[2] =
         _tmp8 * values_vec[0].list_of_lists[1][0].data()[2];
     _values_vec_out[0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][0].data()[0] *
+          values_vec[0].list_of_lists[1][0].data()[0]) -
+        (values_vec[0].list_of_lists[1][0].data()[1] *
+         values_vec[0].list_of_lists[1][0].data()[1]) -
+        (values_vec[0].list_of_lists[1][0].data()[2] *
+         values_vec[0].list_of_lists[1][0].data()[2]) +
+        (values_vec[0].list_of_lists[1][0].data()[3] * values_vec[0].list_of_lists[1][0].data()[3]);
     _values_vec_out[0].list_of_lists[1][1].data()[0] =
         _tmp9 * values_vec[0].list_of_lists[1][1].data()[0];
     _values_vec_out[0].list_of_lists[1][1].data()[1] =
@@ -242,10 +255,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[1][1].data()[2] =
         _tmp9 * values_vec[0].list_of_lists[1][1].data()[2];
     _values_vec_out[0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][1].data()[0] *
+          values_vec[0].list_of_lists[1][1].data()[0]) -
+        (values_vec[0].list_of_lists[1][1].data()[1] *
+         values_vec[0].list_of_lists[1][1].data()[1]) -
+        (values_vec[0].list_of_lists[1][1].data()[2] *
+         values_vec[0].list_of_lists[1][1].data()[2]) +
+        (values_vec[0].list_of_lists[1][1].data()[3] * values_vec[0].list_of_lists[1][1].data()[3]);
     _values_vec_out[0].list_of_lists[1][2].data()[0] =
         _tmp10 * values_vec[0].list_of_lists[1][2].data()[0];
     _values_vec_out[0].list_of_lists[1][2].data()[1] =
@@ -253,10 +269,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[1][2].data()[2] =
         _tmp10 * values_vec[0].list_of_lists[1][2].data()[2];
     _values_vec_out[0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[1][2].data()[0] *
+          values_vec[0].list_of_lists[1][2].data()[0]) -
+        (values_vec[0].list_of_lists[1][2].data()[1] *
+         values_vec[0].list_of_lists[1][2].data()[1]) -
+        (values_vec[0].list_of_lists[1][2].data()[2] *
+         values_vec[0].list_of_lists[1][2].data()[2]) +
+        (values_vec[0].list_of_lists[1][2].data()[3] * values_vec[0].list_of_lists[1][2].data()[3]);
     _values_vec_out[0].list_of_lists[2][0].data()[0] =
         _tmp11 * values_vec[0].list_of_lists[2][0].data()[0];
     _values_vec_out[0].list_of_lists[2][0].data()[1] =
@@ -264,10 +283,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[2][0].data()[2] =
         _tmp11 * values_vec[0].list_of_lists[2][0].data()[2];
     _values_vec_out[0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][0].data()[0] *
+          values_vec[0].list_of_lists[2][0].data()[0]) -
+        (values_vec[0].list_of_lists[2][0].data()[1] *
+         values_vec[0].list_of_lists[2][0].data()[1]) -
+        (values_vec[0].list_of_lists[2][0].data()[2] *
+         values_vec[0].list_of_lists[2][0].data()[2]) +
+        (values_vec[0].list_of_lists[2][0].data()[3] * values_vec[0].list_of_lists[2][0].data()[3]);
     _values_vec_out[0].list_of_lists[2][1].data()[0] =
         _tmp12 * values_vec[0].list_of_lists[2][1].data()[0];
     _values_vec_out[0].list_of_lists[2][1].data()[1] =
@@ -275,10 +297,13 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[2][1].data()[2] =
         _tmp12 * values_vec[0].list_of_lists[2][1].data()[2];
     _values_vec_out[0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][1].data()[0] *
+          values_vec[0].list_of_lists[2][1].data()[0]) -
+        (values_vec[0].list_of_lists[2][1].data()[1] *
+         values_vec[0].list_of_lists[2][1].data()[1]) -
+        (values_vec[0].list_of_lists[2][1].data()[2] *
+         values_vec[0].list_of_lists[2][1].data()[2]) +
+        (values_vec[0].list_of_lists[2][1].data()[3] * values_vec[0].list_of_lists[2][1].data()[3]);
     _values_vec_out[0].list_of_lists[2][2].data()[0] =
         _tmp13 * values_vec[0].list_of_lists[2][2].data()[0];
     _values_vec_out[0].list_of_lists[2][2].data()[1] =
@@ -286,43 +311,47 @@ void CodegenCppTest(
     _values_vec_out[0].list_of_lists[2][2].data()[2] =
         _tmp13 * values_vec[0].list_of_lists[2][2].data()[2];
     _values_vec_out[0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[0].list_of_lists[2][2].data()[0] *
+          values_vec[0].list_of_lists[2][2].data()[0]) -
+        (values_vec[0].list_of_lists[2][2].data()[1] *
+         values_vec[0].list_of_lists[2][2].data()[1]) -
+        (values_vec[0].list_of_lists[2][2].data()[2] *
+         values_vec[0].list_of_lists[2][2].data()[2]) +
+        (values_vec[0].list_of_lists[2][2].data()[3] * values_vec[0].list_of_lists[2][2].data()[3]);
     _values_vec_out[1].x = 2 * values_vec[1].x;
     _values_vec_out[1].y = 2 * values_vec[1].y;
     _values_vec_out[1].rot.data()[0] = _tmp14 * values_vec[1].rot.data()[0];
     _values_vec_out[1].rot.data()[1] = _tmp14 * values_vec[1].rot.data()[1];
     _values_vec_out[1].rot.data()[2] = _tmp14 * values_vec[1].rot.data()[2];
-    _values_vec_out[1].rot.data()[3] = -std::pow(values_vec[1].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[1].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[1].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[1].rot.data()[3], Scalar(2));
+    _values_vec_out[1].rot.data()[3] =
+        -(values_vec[1].rot.data()[0] * values_vec[1].rot.data()[0]) -
+        (values_vec[1].rot.data()[1] * values_vec[1].rot.data()[1]) -
+        (values_vec[1].rot.data()[2] * values_vec[1].rot.data()[2]) +
+        (values_vec[1].rot.data()[3] * values_vec[1].rot.data()[3]);
     _values_vec_out[1].rot_vec[0].data()[0] = _tmp15 * values_vec[1].rot_vec[0].data()[0];
     _values_vec_out[1].rot_vec[0].data()[1] = _tmp15 * values_vec[1].rot_vec[0].data()[1];
     _values_vec_out[1].rot_vec[0].data()[2] = _tmp15 * values_vec[1].rot_vec[0].data()[2];
     _values_vec_out[1].rot_vec[0].data()[3] =
-        -std::pow(values_vec[1].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[0].data()[0] * values_vec[1].rot_vec[0].data()[0]) -
+        (values_vec[1].rot_vec[0].data()[1] * values_vec[1].rot_vec[0].data()[1]) -
+        (values_vec[1].rot_vec[0].data()[2] * values_vec[1].rot_vec[0].data()[2]) +
+        (values_vec[1].rot_vec[0].data()[3] * values_vec[1].rot_vec[0].data()[3]);
     _values_vec_out[1].rot_vec[1].data()[0] = _tmp16 * values_vec[1].rot_vec[1].data()[0];
     _values_vec_out[1].rot_vec[1].data()[1] = _tmp16 * values_vec[1].rot_vec[1].data()[1];
     _values_vec_out[1].rot_vec[1].data()[2] = _tmp16 * values_vec[1].rot_vec[1].data()[2];
     _values_vec_out[1].rot_vec[1].data()[3] =
-        -std::pow(values_vec[1].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[1].data()[0] * values_vec[1].rot_vec[1].data()[0]) -
+        (values_vec[1].rot_vec[1].data()[1] * values_vec[1].rot_vec[1].data()[1]) -
+        (values_vec[1].rot_vec[1].data()[2] * values_vec[1].rot_vec[1].data()[2]) +
+        (values_vec[1].rot_vec[1].data()[3] * values_vec[1].rot_vec[1].data()[3]);
     _values_vec_out[1].rot_vec[2].data()[0] = _tmp17 * values_vec[1].rot_vec[2].data()[0];
     _values_vec_out[1].rot_vec[2].data()[1] = _tmp17 * values_vec[1].rot_vec[2].data()[1];
     _values_vec_out[1].rot_vec[2].data()[2] = _tmp17 * values_vec[1].rot_vec[2].data()[2];
     _values_vec_out[1].rot_vec[2].data()[3] =
-        -std::pow(values_vec[1].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[1].rot_vec[2].data()[0] * values_vec[1].rot_vec[2].data()[0]) -
+        (values_vec[1].rot_vec[2].data()[1] * values_vec[1].rot_vec[2].data()[1]) -
+        (values_vec[1].rot_vec[2].data()[2] * values_vec[1].rot_vec[2].data()[2]) +
+        (values_vec[1].rot_vec[2].data()[3] * values_vec[1].rot_vec[2].data()[3]);
     _values_vec_out[1].scalar_vec[0] = 2 * values_vec[1].scalar_vec[0];
     _values_vec_out[1].scalar_vec[1] = 2 * values_vec[1].scalar_vec[1];
     _values_vec_out[1].scalar_vec[2] = 2 * values_vec[1].scalar_vec[2];
@@ -333,10 +362,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[0][0].data()[2] =
         _tmp18 * values_vec[1].list_of_lists[0][0].data()[2];
     _values_vec_out[1].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][0].data()[0] *
+          values_vec[1].list_of_lists[0][0].data()[0]) -
+        (values_vec[1].list_of_lists[0][0].data()[1] *
+         values_vec[1].list_of_lists[0][0].data()[1]) -
+        (values_vec[1].list_of_lists[0][0].data()[2] *
+         values_vec[1].list_of_lists[0][0].data()[2]) +
+        (values_vec[1].list_of_lists[0][0].data()[3] * values_vec[1].list_of_lists[0][0].data()[3]);
     _values_vec_out[1].list_of_lists[0][1].data()[0] =
         _tmp19 * values_vec[1].list_of_lists[0][1].data()[0];
     _values_vec_out[1].list_of_lists[0][1].data()[1] =
@@ -344,10 +376,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[0][1].data()[2] =
         _tmp19 * values_vec[1].list_of_lists[0][1].data()[2];
     _values_vec_out[1].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][1].data()[0] *
+          values_vec[1].list_of_lists[0][1].data()[0]) -
+        (values_vec[1].list_of_lists[0][1].data()[1] *
+         values_vec[1].list_of_lists[0][1].data()[1]) -
+        (values_vec[1].list_of_lists[0][1].data()[2] *
+         values_vec[1].list_of_lists[0][1].data()[2]) +
+        (values_vec[1].list_of_lists[0][1].data()[3] * values_vec[1].list_of_lists[0][1].data()[3]);
     _values_vec_out[1].list_of_lists[0][2].data()[0] =
         _tmp20 * values_vec[1].list_of_lists[0][2].data()[0];
     _values_vec_out[1].list_of_lists[0][2].data()[1] =
@@ -355,10 +390,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[0][2].data()[2] =
         _tmp20 * values_vec[1].list_of_lists[0][2].data()[2];
     _values_vec_out[1].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[0][2].data()[0] *
+          values_vec[1].list_of_lists[0][2].data()[0]) -
+        (values_vec[1].list_of_lists[0][2].data()[1] *
+         values_vec[1].list_of_lists[0][2].data()[1]) -
+        (values_vec[1].list_of_lists[0][2].data()[2] *
+         values_vec[1].list_of_lists[0][2].data()[2]) +
+        (values_vec[1].list_of_lists[0][2].data()[3] * values_vec[1].list_of_lists[0][2].data()[3]);
     _values_vec_out[1].list_of_lists[1][0].data()[0] =
         _tmp21 * values_vec[1].list_of_lists[1][0].data()[0];
     _values_vec_out[1].list_of_lists[1][0].data()[1] =
@@ -366,10 +404,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[1][0].data()[2] =
         _tmp21 * values_vec[1].list_of_lists[1][0].data()[2];
     _values_vec_out[1].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][0].data()[0] *
+          values_vec[1].list_of_lists[1][0].data()[0]) -
+        (values_vec[1].list_of_lists[1][0].data()[1] *
+         values_vec[1].list_of_lists[1][0].data()[1]) -
+        (values_vec[1].list_of_lists[1][0].data()[2] *
+         values_vec[1].list_of_lists[1][0].data()[2]) +
+        (values_vec[1].list_of_lists[1][0].data()[3] * values_vec[1].list_of_lists[1][0].data()[3]);
     _values_vec_out[1].list_of_lists[1][1].data()[0] =
         _tmp22 * values_vec[1].list_of_lists[1][1].data()[0];
     _values_vec_out[1].list_of_lists[1][1].data()[1] =
@@ -377,10 +418,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[1][1].data()[2] =
         _tmp22 * values_vec[1].list_of_lists[1][1].data()[2];
     _values_vec_out[1].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][1].data()[0] *
+          values_vec[1].list_of_lists[1][1].data()[0]) -
+        (values_vec[1].list_of_lists[1][1].data()[1] *
+         values_vec[1].list_of_lists[1][1].data()[1]) -
+        (values_vec[1].list_of_lists[1][1].data()[2] *
+         values_vec[1].list_of_lists[1][1].data()[2]) +
+        (values_vec[1].list_of_lists[1][1].data()[3] * values_vec[1].list_of_lists[1][1].data()[3]);
     _values_vec_out[1].list_of_lists[1][2].data()[0] =
         _tmp23 * values_vec[1].list_of_lists[1][2].data()[0];
     _values_vec_out[1].list_of_lists[1][2].data()[1] =
@@ -388,10 +432,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[1][2].data()[2] =
         _tmp23 * values_vec[1].list_of_lists[1][2].data()[2];
     _values_vec_out[1].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[1][2].data()[0] *
+          values_vec[1].list_of_lists[1][2].data()[0]) -
+        (values_vec[1].list_of_lists[1][2].data()[1] *
+         values_vec[1].list_of_lists[1][2].data()[1]) -
+        (values_vec[1].list_of_lists[1][2].data()[2] *
+         values_vec[1].list_of_lists[1][2].data()[2]) +
+        (values_vec[1].list_of_lists[1][2].data()[3] * values_vec[1].list_of_lists[1][2].data()[3]);
     _values_vec_out[1].list_of_lists[2][0].data()[0] =
         _tmp24 * values_vec[1].list_of_lists[2][0].data()[0];
     _values_vec_out[1].list_of_lists[2][0].data()[1] =
@@ -399,10 +446,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[2][0].data()[2] =
         _tmp24 * values_vec[1].list_of_lists[2][0].data()[2];
     _values_vec_out[1].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][0].data()[0] *
+          values_vec[1].list_of_lists[2][0].data()[0]) -
+        (values_vec[1].list_of_lists[2][0].data()[1] *
+         values_vec[1].list_of_lists[2][0].data()[1]) -
+        (values_vec[1].list_of_lists[2][0].data()[2] *
+         values_vec[1].list_of_lists[2][0].data()[2]) +
+        (values_vec[1].list_of_lists[2][0].data()[3] * values_vec[1].list_of_lists[2][0].data()[3]);
     _values_vec_out[1].list_of_lists[2][1].data()[0] =
         _tmp25 * values_vec[1].list_of_lists[2][1].data()[0];
     _values_vec_out[1].list_of_lists[2][1].data()[1] =
@@ -410,10 +460,13 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[2][1].data()[2] =
         _tmp25 * values_vec[1].list_of_lists[2][1].data()[2];
     _values_vec_out[1].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][1].data()[0] *
+          values_vec[1].list_of_lists[2][1].data()[0]) -
+        (values_vec[1].list_of_lists[2][1].data()[1] *
+         values_vec[1].list_of_lists[2][1].data()[1]) -
+        (values_vec[1].list_of_lists[2][1].data()[2] *
+         values_vec[1].list_of_lists[2][1].data()[2]) +
+        (values_vec[1].list_of_lists[2][1].data()[3] * values_vec[1].list_of_lists[2][1].data()[3]);
     _values_vec_out[1].list_of_lists[2][2].data()[0] =
         _tmp26 * values_vec[1].list_of_lists[2][2].data()[0];
     _values_vec_out[1].list_of_lists[2][2].data()[1] =
@@ -421,43 +474,47 @@ void CodegenCppTest(
     _values_vec_out[1].list_of_lists[2][2].data()[2] =
         _tmp26 * values_vec[1].list_of_lists[2][2].data()[2];
     _values_vec_out[1].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[1].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[1].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[1].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[1].list_of_lists[2][2].data()[0] *
+          values_vec[1].list_of_lists[2][2].data()[0]) -
+        (values_vec[1].list_of_lists[2][2].data()[1] *
+         values_vec[1].list_of_lists[2][2].data()[1]) -
+        (values_vec[1].list_of_lists[2][2].data()[2] *
+         values_vec[1].list_of_lists[2][2].data()[2]) +
+        (values_vec[1].list_of_lists[2][2].data()[3] * values_vec[1].list_of_lists[2][2].data()[3]);
     _values_vec_out[2].x = 2 * values_vec[2].x;
     _values_vec_out[2].y = 2 * values_vec[2].y;
     _values_vec_out[2].rot.data()[0] = _tmp27 * values_vec[2].rot.data()[0];
     _values_vec_out[2].rot.data()[1] = _tmp27 * values_vec[2].rot.data()[1];
     _values_vec_out[2].rot.data()[2] = _tmp27 * values_vec[2].rot.data()[2];
-    _values_vec_out[2].rot.data()[3] = -std::pow(values_vec[2].rot.data()[0], Scalar(2)) -
-                                       std::pow(values_vec[2].rot.data()[1], Scalar(2)) -
-                                       std::pow(values_vec[2].rot.data()[2], Scalar(2)) +
-                                       std::pow(values_vec[2].rot.data()[3], Scalar(2));
+    _values_vec_out[2].rot.data()[3] =
+        -(values_vec[2].rot.data()[0] * values_vec[2].rot.data()[0]) -
+        (values_vec[2].rot.data()[1] * values_vec[2].rot.data()[1]) -
+        (values_vec[2].rot.data()[2] * values_vec[2].rot.data()[2]) +
+        (values_vec[2].rot.data()[3] * values_vec[2].rot.data()[3]);
     _values_vec_out[2].rot_vec[0].data()[0] = _tmp28 * values_vec[2].rot_vec[0].data()[0];
     _values_vec_out[2].rot_vec[0].data()[1] = _tmp28 * values_vec[2].rot_vec[0].data()[1];
     _values_vec_out[2].rot_vec[0].data()[2] = _tmp28 * values_vec[2].rot_vec[0].data()[2];
     _values_vec_out[2].rot_vec[0].data()[3] =
-        -std::pow(values_vec[2].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[0].data()[0] * values_vec[2].rot_vec[0].data()[0]) -
+        (values_vec[2].rot_vec[0].data()[1] * values_vec[2].rot_vec[0].data()[1]) -
+        (values_vec[2].rot_vec[0].data()[2] * values_vec[2].rot_vec[0].data()[2]) +
+        (values_vec[2].rot_vec[0].data()[3] * values_vec[2].rot_vec[0].data()[3]);
     _values_vec_out[2].rot_vec[1].data()[0] = _tmp29 * values_vec[2].rot_vec[1].data()[0];
     _values_vec_out[2].rot_vec[1].data()[1] = _tmp29 * values_vec[2].rot_vec[1].data()[1];
     _values_vec_out[2].rot_vec[1].data()[2] = _tmp29 * values_vec[2].rot_vec[1].data()[2];
     _values_vec_out[2].rot_vec[1].data()[3] =
-        -std::pow(values_vec[2].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[1].data()[0] * values_vec[2].rot_vec[1].data()[0]) -
+        (values_vec[2].rot_vec[1].data()[1] * values_vec[2].rot_vec[1].data()[1]) -
+        (values_vec[2].rot_vec[1].data()[2] * values_vec[2].rot_vec[1].data()[2]) +
+        (values_vec[2].rot_vec[1].data()[3] * values_vec[2].rot_vec[1].data()[3]);
     _values_vec_out[2].rot_vec[2].data()[0] = _tmp30 * values_vec[2].rot_vec[2].data()[0];
     _values_vec_out[2].rot_vec[2].data()[1] = _tmp30 * values_vec[2].rot_vec[2].data()[1];
     _values_vec_out[2].rot_vec[2].data()[2] = _tmp30 * values_vec[2].rot_vec[2].data()[2];
     _values_vec_out[2].rot_vec[2].data()[3] =
-        -std::pow(values_vec[2].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec[2].rot_vec[2].data()[0] * values_vec[2].rot_vec[2].data()[0]) -
+        (values_vec[2].rot_vec[2].data()[1] * values_vec[2].rot_vec[2].data()[1]) -
+        (values_vec[2].rot_vec[2].data()[2] * values_vec[2].rot_vec[2].data()[2]) +
+        (values_vec[2].rot_vec[2].data()[3] * values_vec[2].rot_vec[2].data()[3]);
     _values_vec_out[2].scalar_vec[0] = 2 * values_vec[2].scalar_vec[0];
     _values_vec_out[2].scalar_vec[1] = 2 * values_vec[2].scalar_vec[1];
     _values_vec_out[2].scalar_vec[2] = 2 * values_vec[2].scalar_vec[2];
@@ -468,10 +525,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[0][0].data()[2] =
         _tmp31 * values_vec[2].list_of_lists[0][0].data()[2];
     _values_vec_out[2].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][0].data()[0] *
+          values_vec[2].list_of_lists[0][0].data()[0]) -
+        (values_vec[2].list_of_lists[0][0].data()[1] *
+         values_vec[2].list_of_lists[0][0].data()[1]) -
+        (values_vec[2].list_of_lists[0][0].data()[2] *
+         values_vec[2].list_of_lists[0][0].data()[2]) +
+        (values_vec[2].list_of_lists[0][0].data()[3] * values_vec[2].list_of_lists[0][0].data()[3]);
     _values_vec_out[2].list_of_lists[0][1].data()[0] =
         _tmp32 * values_vec[2].list_of_lists[0][1].data()[0];
     _values_vec_out[2].list_of_lists[0][1].data()[1] =
@@ -479,10 +539,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[0][1].data()[2] =
         _tmp32 * values_vec[2].list_of_lists[0][1].data()[2];
     _values_vec_out[2].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][1].data()[0] *
+          values_vec[2].list_of_lists[0][1].data()[0]) -
+        (values_vec[2].list_of_lists[0][1].data()[1] *
+         values_vec[2].list_of_lists[0][1].data()[1]) -
+        (values_vec[2].list_of_lists[0][1].data()[2] *
+         values_vec[2].list_of_lists[0][1].data()[2]) +
+        (values_vec[2].list_of_lists[0][1].data()[3] * values_vec[2].list_of_lists[0][1].data()[3]);
     _values_vec_out[2].list_of_lists[0][2].data()[0] =
         _tmp33 * values_vec[2].list_of_lists[0][2].data()[0];
     _values_vec_out[2].list_of_lists[0][2].data()[1] =
@@ -490,10 +553,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[0][2].data()[2] =
         _tmp33 * values_vec[2].list_of_lists[0][2].data()[2];
     _values_vec_out[2].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[0][2].data()[0] *
+          values_vec[2].list_of_lists[0][2].data()[0]) -
+        (values_vec[2].list_of_lists[0][2].data()[1] *
+         values_vec[2].list_of_lists[0][2].data()[1]) -
+        (values_vec[2].list_of_lists[0][2].data()[2] *
+         values_vec[2].list_of_lists[0][2].data()[2]) +
+        (values_vec[2].list_of_lists[0][2].data()[3] * values_vec[2].list_of_lists[0][2].data()[3]);
     _values_vec_out[2].list_of_lists[1][0].data()[0] =
         _tmp34 * values_vec[2].list_of_lists[1][0].data()[0];
     _values_vec_out[2].list_of_lists[1][0].data()[1] =
@@ -501,10 +567,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[1][0].data()[2] =
         _tmp34 * values_vec[2].list_of_lists[1][0].data()[2];
     _values_vec_out[2].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][0].data()[0] *
+          values_vec[2].list_of_lists[1][0].data()[0]) -
+        (values_vec[2].list_of_lists[1][0].data()[1] *
+         values_vec[2].list_of_lists[1][0].data()[1]) -
+        (values_vec[2].list_of_lists[1][0].data()[2] *
+         values_vec[2].list_of_lists[1][0].data()[2]) +
+        (values_vec[2].list_of_lists[1][0].data()[3] * values_vec[2].list_of_lists[1][0].data()[3]);
     _values_vec_out[2].list_of_lists[1][1].data()[0] =
         _tmp35 * values_vec[2].list_of_lists[1][1].data()[0];
     _values_vec_out[2].list_of_lists[1][1].data()[1] =
@@ -512,10 +581,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[1][1].data()[2] =
         _tmp35 * values_vec[2].list_of_lists[1][1].data()[2];
     _values_vec_out[2].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][1].data()[0] *
+          values_vec[2].list_of_lists[1][1].data()[0]) -
+        (values_vec[2].list_of_lists[1][1].data()[1] *
+         values_vec[2].list_of_lists[1][1].data()[1]) -
+        (values_vec[2].list_of_lists[1][1].data()[2] *
+         values_vec[2].list_of_lists[1][1].data()[2]) +
+        (values_vec[2].list_of_lists[1][1].data()[3] * values_vec[2].list_of_lists[1][1].data()[3]);
     _values_vec_out[2].list_of_lists[1][2].data()[0] =
         _tmp36 * values_vec[2].list_of_lists[1][2].data()[0];
     _values_vec_out[2].list_of_lists[1][2].data()[1] =
@@ -523,10 +595,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[1][2].data()[2] =
         _tmp36 * values_vec[2].list_of_lists[1][2].data()[2];
     _values_vec_out[2].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[1][2].data()[0] *
+          values_vec[2].list_of_lists[1][2].data()[0]) -
+        (values_vec[2].list_of_lists[1][2].data()[1] *
+         values_vec[2].list_of_lists[1][2].data()[1]) -
+        (values_vec[2].list_of_lists[1][2].data()[2] *
+         values_vec[2].list_of_lists[1][2].data()[2]) +
+        (values_vec[2].list_of_lists[1][2].data()[3] * values_vec[2].list_of_lists[1][2].data()[3]);
     _values_vec_out[2].list_of_lists[2][0].data()[0] =
         _tmp37 * values_vec[2].list_of_lists[2][0].data()[0];
     _values_vec_out[2].list_of_lists[2][0].data()[1] =
@@ -534,10 +609,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[2][0].data()[2] =
         _tmp37 * values_vec[2].list_of_lists[2][0].data()[2];
     _values_vec_out[2].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][0].data()[0] *
+          values_vec[2].list_of_lists[2][0].data()[0]) -
+        (values_vec[2].list_of_lists[2][0].data()[1] *
+         values_vec[2].list_of_lists[2][0].data()[1]) -
+        (values_vec[2].list_of_lists[2][0].data()[2] *
+         values_vec[2].list_of_lists[2][0].data()[2]) +
+        (values_vec[2].list_of_lists[2][0].data()[3] * values_vec[2].list_of_lists[2][0].data()[3]);
     _values_vec_out[2].list_of_lists[2][1].data()[0] =
         _tmp38 * values_vec[2].list_of_lists[2][1].data()[0];
     _values_vec_out[2].list_of_lists[2][1].data()[1] =
@@ -545,10 +623,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[2][1].data()[2] =
         _tmp38 * values_vec[2].list_of_lists[2][1].data()[2];
     _values_vec_out[2].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][1].data()[0] *
+          values_vec[2].list_of_lists[2][1].data()[0]) -
+        (values_vec[2].list_of_lists[2][1].data()[1] *
+         values_vec[2].list_of_lists[2][1].data()[1]) -
+        (values_vec[2].list_of_lists[2][1].data()[2] *
+         values_vec[2].list_of_lists[2][1].data()[2]) +
+        (values_vec[2].list_of_lists[2][1].data()[3] * values_vec[2].list_of_lists[2][1].data()[3]);
     _values_vec_out[2].list_of_lists[2][2].data()[0] =
         _tmp39 * values_vec[2].list_of_lists[2][2].data()[0];
     _values_vec_out[2].list_of_lists[2][2].data()[1] =
@@ -556,10 +637,13 @@ void CodegenCppTest(
     _values_vec_out[2].list_of_lists[2][2].data()[2] =
         _tmp39 * values_vec[2].list_of_lists[2][2].data()[2];
     _values_vec_out[2].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec[2].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec[2].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec[2].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec[2].list_of_lists[2][2].data()[0] *
+          values_vec[2].list_of_lists[2][2].data()[0]) -
+        (values_vec[2].list_of_lists[2][2].data()[1] *
+         values_vec[2].list_of_lists[2][2].data()[1]) -
+        (values_vec[2].list_of_lists[2][2].data()[2] *
+         values_vec[2].list_of_lists[2][2].data()[2]) +
+        (values_vec[2].list_of_lists[2][2].data()[3] * values_vec[2].list_of_lists[2][2].data()[3]);
   }
 
   if (values_vec_2D_out != nullptr) {
@@ -572,10 +656,10 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].rot.data()[1] = _tmp40 * values_vec_2D[0][0].rot.data()[1];
     _values_vec_2D_out[0][0].rot.data()[2] = _tmp40 * values_vec_2D[0][0].rot.data()[2];
     _values_vec_2D_out[0][0].rot.data()[3] =
-        -std::pow(values_vec_2D[0][0].rot.data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot.data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot.data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot.data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot.data()[0] * values_vec_2D[0][0].rot.data()[0]) -
+        (values_vec_2D[0][0].rot.data()[1] * values_vec_2D[0][0].rot.data()[1]) -
+        (values_vec_2D[0][0].rot.data()[2] * values_vec_2D[0][0].rot.data()[2]) +
+        (values_vec_2D[0][0].rot.data()[3] * values_vec_2D[0][0].rot.data()[3]);
     _values_vec_2D_out[0][0].rot_vec[0].data()[0] =
         _tmp41 * values_vec_2D[0][0].rot_vec[0].data()[0];
     _values_vec_2D_out[0][0].rot_vec[0].data()[1] =
@@ -583,10 +667,10 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].rot_vec[0].data()[2] =
         _tmp41 * values_vec_2D[0][0].rot_vec[0].data()[2];
     _values_vec_2D_out[0][0].rot_vec[0].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[0].data()[0] * values_vec_2D[0][0].rot_vec[0].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[0].data()[1] * values_vec_2D[0][0].rot_vec[0].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[0].data()[2] * values_vec_2D[0][0].rot_vec[0].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[0].data()[3] * values_vec_2D[0][0].rot_vec[0].data()[3]);
     _values_vec_2D_out[0][0].rot_vec[1].data()[0] =
         _tmp42 * values_vec_2D[0][0].rot_vec[1].data()[0];
     _values_vec_2D_out[0][0].rot_vec[1].data()[1] =
@@ -594,10 +678,10 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].rot_vec[1].data()[2] =
         _tmp42 * values_vec_2D[0][0].rot_vec[1].data()[2];
     _values_vec_2D_out[0][0].rot_vec[1].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[1].data()[0] * values_vec_2D[0][0].rot_vec[1].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[1].data()[1] * values_vec_2D[0][0].rot_vec[1].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[1].data()[2] * values_vec_2D[0][0].rot_vec[1].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[1].data()[3] * values_vec_2D[0][0].rot_vec[1].data()[3]);
     _values_vec_2D_out[0][0].rot_vec[2].data()[0] =
         _tmp43 * values_vec_2D[0][0].rot_vec[2].data()[0];
     _values_vec_2D_out[0][0].rot_vec[2].data()[1] =
@@ -605,10 +689,10 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].rot_vec[2].data()[2] =
         _tmp43 * values_vec_2D[0][0].rot_vec[2].data()[2];
     _values_vec_2D_out[0][0].rot_vec[2].data()[3] =
-        -std::pow(values_vec_2D[0][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].rot_vec[2].data()[0] * values_vec_2D[0][0].rot_vec[2].data()[0]) -
+        (values_vec_2D[0][0].rot_vec[2].data()[1] * values_vec_2D[0][0].rot_vec[2].data()[1]) -
+        (values_vec_2D[0][0].rot_vec[2].data()[2] * values_vec_2D[0][0].rot_vec[2].data()[2]) +
+        (values_vec_2D[0][0].rot_vec[2].data()[3] * values_vec_2D[0][0].rot_vec[2].data()[3]);
     _values_vec_2D_out[0][0].scalar_vec[0] = 2 * values_vec_2D[0][0].scalar_vec[0];
     _values_vec_2D_out[0][0].scalar_vec[1] = 2 * values_vec_2D[0][0].scalar_vec[1];
     _values_vec_2D_out[0][0].scalar_vec[2] = 2 * values_vec_2D[0][0].scalar_vec[2];
@@ -619,10 +703,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[0][0].data()[2] =
         _tmp44 * values_vec_2D[0][0].list_of_lists[0][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[0] =
         _tmp45 * values_vec_2D[0][0].list_of_lists[0][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[1] =
@@ -630,10 +718,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[2] =
         _tmp45 * values_vec_2D[0][0].list_of_lists[0][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[0] =
         _tmp46 * values_vec_2D[0][0].list_of_lists[0][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[1] =
@@ -641,10 +733,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[2] =
         _tmp46 * values_vec_2D[0][0].list_of_lists[0][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[0][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[0][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[0][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[0][2].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[0] =
         _tmp47 * values_vec_2D[0][0].list_of_lists[1][0].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[1] =
@@ -652,10 +748,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[2] =
         _tmp47 * values_vec_2D[0][0].list_of_lists[1][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[0] =
         _tmp48 * values_vec_2D[0][0].list_of_lists[1][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[1] =
@@ -663,10 +763,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[2] =
         _tmp48 * values_vec_2D[0][0].list_of_lists[1][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[0] =
         _tmp49 * values_vec_2D[0][0].list_of_lists[1][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[1] =
@@ -674,10 +778,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[2] =
         _tmp49 * values_vec_2D[0][0].list_of_lists[1][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[1][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[1][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[1][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[1][2].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[0] =
         _tmp50 * values_vec_2D[0][0].list_of_lists[2][0].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[1] =
@@ -685,10 +793,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[2] =
         _tmp50 * values_vec_2D[0][0].list_of_lists[2][0].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][0].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][0].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][0].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][0].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[0] =
         _tmp51 * values_vec_2D[0][0].list_of_lists[2][1].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[1] =
@@ -696,10 +808,14 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[2] =
         _tmp51 * values_vec_2D[0][0].list_of_lists[2][1].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][1].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][1].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][1].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][1].data()[3]);
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[0] =
         _tmp52 * values_vec_2D[0][0].list_of_lists[2][2].data()[0];
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[1] =
@@ -707,20 +823,24 @@ void CodegenCppTest(
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[2] =
         _tmp52 * values_vec_2D[0][0].list_of_lists[2][2].data()[2];
     _values_vec_2D_out[0][0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[0][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec_2D[0][0].list_of_lists[2][2].data()[0] *
+          values_vec_2D[0][0].list_of_lists[2][2].data()[0]) -
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[1] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[1]) -
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[2] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[2]) +
+        (values_vec_2D[0][0].list_of_lists[2][2].data()[3] *
+         values_vec_2D[0][0].list_of_lists[2][2].data()[3]);
     _values_vec_2D_out[1][0].x = 2 * values_vec_2D[1][0].x;
     _values_vec_2D_out[1][0].y = 2 * values_vec_2D[1][0].y;
     _values_vec_2D_out[1][0].rot.data()[0] = _tmp53 * values_vec_2D[1][0].rot.data()[0];
     _values_vec_2D_out[1][0].rot.data()[1] = _tmp53 * values_vec_2D[1][0].rot.data()[1];
     _values_vec_2D_out[1][0].rot.data()[2] = _tmp53 * values_vec_2D[1][0].rot.data()[2];
     _values_vec_2D_out[1][0].rot.data()[3] =
-        -std::pow(values_vec_2D[1][0].rot.data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot.data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot.data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot.data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot.data()[0] * values_vec_2D[1][0].rot.data()[0]) -
+        (values_vec_2D[1][0].rot.data()[1] * values_vec_2D[1][0].rot.data()[1]) -
+        (values_vec_2D[1][0].rot.data()[2] * values_vec_2D[1][0].rot.data()[2]) +
+        (values_vec_2D[1][0].rot.data()[3] * values_vec_2D[1][0].rot.data()[3]);
     _values_vec_2D_out[1][0].rot_vec[0].data()[0] =
         _tmp54 * values_vec_2D[1][0].rot_vec[0].data()[0];
     _values_vec_2D_out[1][0].rot_vec[0].data()[1] =
@@ -728,10 +848,10 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].rot_vec[0].data()[2] =
         _tmp54 * values_vec_2D[1][0].rot_vec[0].data()[2];
     _values_vec_2D_out[1][0].rot_vec[0].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[0].data()[0] * values_vec_2D[1][0].rot_vec[0].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[0].data()[1] * values_vec_2D[1][0].rot_vec[0].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[0].data()[2] * values_vec_2D[1][0].rot_vec[0].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[0].data()[3] * values_vec_2D[1][0].rot_vec[0].data()[3]);
     _values_vec_2D_out[1][0].rot_vec[1].data()[0] =
         _tmp55 * values_vec_2D[1][0].rot_vec[1].data()[0];
     _values_vec_2D_out[1][0].rot_vec[1].data()[1] =
@@ -739,10 +859,10 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].rot_vec[1].data()[2] =
         _tmp55 * values_vec_2D[1][0].rot_vec[1].data()[2];
     _values_vec_2D_out[1][0].rot_vec[1].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[1].data()[0] * values_vec_2D[1][0].rot_vec[1].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[1].data()[1] * values_vec_2D[1][0].rot_vec[1].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[1].data()[2] * values_vec_2D[1][0].rot_vec[1].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[1].data()[3] * values_vec_2D[1][0].rot_vec[1].data()[3]);
     _values_vec_2D_out[1][0].rot_vec[2].data()[0] =
         _tmp56 * values_vec_2D[1][0].rot_vec[2].data()[0];
     _values_vec_2D_out[1][0].rot_vec[2].data()[1] =
@@ -750,10 +870,10 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].rot_vec[2].data()[2] =
         _tmp56 * values_vec_2D[1][0].rot_vec[2].data()[2];
     _values_vec_2D_out[1][0].rot_vec[2].data()[3] =
-        -std::pow(values_vec_2D[1][0].rot_vec[2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].rot_vec[2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].rot_vec[2].data()[0] * values_vec_2D[1][0].rot_vec[2].data()[0]) -
+        (values_vec_2D[1][0].rot_vec[2].data()[1] * values_vec_2D[1][0].rot_vec[2].data()[1]) -
+        (values_vec_2D[1][0].rot_vec[2].data()[2] * values_vec_2D[1][0].rot_vec[2].data()[2]) +
+        (values_vec_2D[1][0].rot_vec[2].data()[3] * values_vec_2D[1][0].rot_vec[2].data()[3]);
     _values_vec_2D_out[1][0].scalar_vec[0] = 2 * values_vec_2D[1][0].scalar_vec[0];
     _values_vec_2D_out[1][0].scalar_vec[1] = 2 * values_vec_2D[1][0].scalar_vec[1];
     _values_vec_2D_out[1][0].scalar_vec[2] = 2 * values_vec_2D[1][0].scalar_vec[2];
@@ -764,10 +884,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[0][0].data()[2] =
         _tmp57 * values_vec_2D[1][0].list_of_lists[0][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[0] =
         _tmp58 * values_vec_2D[1][0].list_of_lists[0][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[1] =
@@ -775,10 +899,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[2] =
         _tmp58 * values_vec_2D[1][0].list_of_lists[0][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[0] =
         _tmp59 * values_vec_2D[1][0].list_of_lists[0][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[1] =
@@ -786,10 +914,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[2] =
         _tmp59 * values_vec_2D[1][0].list_of_lists[0][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[0][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[0][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[0][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[0][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[0][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[0][2].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[0] =
         _tmp60 * values_vec_2D[1][0].list_of_lists[1][0].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[1] =
@@ -797,10 +929,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[2] =
         _tmp60 * values_vec_2D[1][0].list_of_lists[1][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[0] =
         _tmp61 * values_vec_2D[1][0].list_of_lists[1][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[1] =
@@ -808,10 +944,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[2] =
         _tmp61 * values_vec_2D[1][0].list_of_lists[1][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[0] =
         _tmp62 * values_vec_2D[1][0].list_of_lists[1][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[1] =
@@ -819,10 +959,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[2] =
         _tmp62 * values_vec_2D[1][0].list_of_lists[1][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[1][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[1][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[1][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[1][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[1][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[1][2].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[0] =
         _tmp63 * values_vec_2D[1][0].list_of_lists[2][0].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[1] =
@@ -830,10 +974,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[2] =
         _tmp63 * values_vec_2D[1][0].list_of_lists[2][0].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][0].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][0].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][0].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][0].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][0].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][0].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[0] =
         _tmp64 * values_vec_2D[1][0].list_of_lists[2][1].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[1] =
@@ -841,10 +989,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[2] =
         _tmp64 * values_vec_2D[1][0].list_of_lists[2][1].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][1].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][1].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][1].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][1].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][1].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][1].data()[3]);
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[0] =
         _tmp65 * values_vec_2D[1][0].list_of_lists[2][2].data()[0];
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[1] =
@@ -852,10 +1004,14 @@ void CodegenCppTest(
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[2] =
         _tmp65 * values_vec_2D[1][0].list_of_lists[2][2].data()[2];
     _values_vec_2D_out[1][0].list_of_lists[2][2].data()[3] =
-        -std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[0], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[1], Scalar(2)) -
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[2], Scalar(2)) +
-        std::pow(values_vec_2D[1][0].list_of_lists[2][2].data()[3], Scalar(2));
+        -(values_vec_2D[1][0].list_of_lists[2][2].data()[0] *
+          values_vec_2D[1][0].list_of_lists[2][2].data()[0]) -
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[1] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[1]) -
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[2] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[2]) +
+        (values_vec_2D[1][0].list_of_lists[2][2].data()[3] *
+         values_vec_2D[1][0].list_of_lists[2][2].data()[3]);
   }
 }  // NOLINT(readability/fn_size)
 
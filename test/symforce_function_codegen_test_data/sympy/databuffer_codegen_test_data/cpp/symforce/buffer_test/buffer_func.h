@@ -33,7 +33,7 @@ Scalar BufferFunc(const Scalar* const buffer, const Scalar a, const Scalar b) {
   Scalar _result;
 
   _result = a + b + buffer[static_cast<size_t>((-a + b) * (a + b))] +
-            buffer[static_cast<size_t>(-std::pow(a, Scalar(2)) + std::pow(b, Scalar(2)))];
+            buffer[static_cast<size_t>(-(a * a) + (b * b))];
 
   return _result;
 }  // NOLINT(readability/fn_size)
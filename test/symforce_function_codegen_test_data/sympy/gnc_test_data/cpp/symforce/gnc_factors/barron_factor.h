@@ -43,7 +43,10 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
   const Scalar _tmp1 = eps - mu + 1;
   const Scalar _tmp2 = eps + Scalar(1.0) / (std::fabs(_tmp1));
   const Scalar _tmp3 = Scalar(1.0) / (_tmp2);
-  const Scalar _tmp4 = _tmp3 * std::pow(Scalar(x(0, 0) - y(0, 0)), Scalar(2)) + 1;
+  const Scalar _tmp4 = _tmp3 * [&]() {
+    const Scalar base = x(0, 0) - y(0, 0);
+    return base * base;
+  }() + 1;
   const Scalar _tmp5 = Scalar(1.0) / (_tmp1);
   const Scalar _tmp6 = 2 - _tmp5;
   const Scalar _tmp7 = eps * (2 * std::min<Scalar>(0, (((_tmp6) > 0) - ((_tmp6) < 0))) + 1);
@@ -55,22 +58,34 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
   const Scalar _tmp13 = _tmp12 * (_tmp9 - 1) + eps;
   const Scalar _tmp14 = std::sqrt(_tmp13);
   const Scalar _tmp15 = -_tmp0 + _tmp14;
-  const Scalar _tmp16 = _tmp3 * std::pow(Scalar(x(1, 0) - y(1, 0)), Scalar(2)) + 1;
+  const Scalar _tmp16 = _tmp3 * [&]() {
+    const Scalar base = x(1, 0) - y(1, 0);
+    return base * base;
+  }() + 1;
   const Scalar _tmp17 = std::pow(_tmp16, _tmp8);
   const Scalar _tmp18 = _tmp12 * (_tmp17 - 1) + eps;
   const Scalar _tmp19 = std::sqrt(_tmp18);
   const Scalar _tmp20 = -_tmp0 + _tmp19;
-  const Scalar _tmp21 = _tmp3 * std::pow(Scalar(x(2, 0) - y(2, 0)), Scalar(2)) + 1;
+  const Scalar _tmp21 = _tmp3 * [&]() {
+    const Scalar base = x(2, 0) - y(2, 0);
+    return base * base;
+  }() + 1;
   const Scalar _tmp22 = std::pow(_tmp21, _tmp8);
   const Scalar _tmp23 = _tmp12 * (_tmp22 - 1) + eps;
   const Scalar _tmp24 = std::sqrt(_tmp23);
   const Scalar _tmp25 = -_tmp0 + _tmp24;
-  const Scalar _tmp26 = _tmp3 * std::pow(Scalar(x(3, 0) - y(3, 0)), Scalar(2)) + 1;
+  const Scalar _tmp26 = _tmp3 * [&]() {
+    const Scalar base = x(3, 0) - y(3, 0);
+    return base * base;
+  }() + 1;
   const Scalar _tmp27 = std::pow(_tmp26, _tmp8);
   const Scalar _tmp28 = _tmp12 * (_tmp27 - 1) + eps;
   const Scalar _tmp29 = std::sqrt(_tmp28);
   const Scalar _tmp30 = -_tmp0 + _tmp29;
-  const Scalar _tmp31 = _tmp3 * std::pow(Scalar(x(4, 0) - y(4, 0)), Scalar(2)) + 1;
+  const Scalar _tmp31 = _tmp3 * [&]() {
+    const Scalar base = x(4, 0) - y(4, 0);
+    return base * base;
+  }() + 1;
   const Scalar _tmp32 = std::pow(_tmp31, _tmp8);
   const Scalar _tmp33 = _tmp12 * (_tmp32 - 1) + eps;
   const Scalar _tmp34 = std::sqrt(_tmp33);
@@ -86,7 +101,7 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
   const Scalar _tmp44 = _tmp27 * _tmp37 * _tmp43 / (_tmp26 * _tmp29);
   const Scalar _tmp45 = 2 * x(4, 0) - 2 * y(4, 0);
   const Scalar _tmp46 = _tmp32 * _tmp37 * _tmp45 / (_tmp31 * _tmp34);
-  const Scalar _tmp47 = std::pow(_tmp8, Scalar(2)) / std::pow(_tmp10, Scalar(2));
+  const Scalar _tmp47 = (_tmp8 * _tmp8) / (_tmp10 * _tmp10);
 
   // Output terms (4)
   if (res != nullptr) {
@@ -116,16 +131,16 @@ void BarronFactor(const Eigen::Matrix<Scalar, 5, 1>& x, const Eigen::Matrix<Scal
 
     _hessian.setZero();
 
-    _hessian(0, 0) = std::pow(_tmp36, Scalar(2)) * std::pow(_tmp4, _tmp10) * _tmp47 /
-                     (_tmp13 * std::pow(_tmp4, Scalar(2)));
-    _hessian(1, 1) = std::pow(_tmp16, _tmp10) * std::pow(_tmp39, Scalar(2)) * _tmp47 /
-                     (std::pow(_tmp16, Scalar(2)) * _tmp18);
-    _hessian(2, 2) = std::pow(_tmp21, _tmp10) * std::pow(_tmp41, Scalar(2)) * _tmp47 /
-                     (std::pow(_tmp21, Scalar(2)) * _tmp23);
-    _hessian(3, 3) = std::pow(_tmp26, _tmp10) * std::pow(_tmp43, Scalar(2)) * _tmp47 /
-                     (std::pow(_tmp26, Scalar(2)) * _tmp28);
-    _hessian(4, 4) = std::pow(_tmp31, _tmp10) * std::pow(_tmp45, Scalar(2)) * _tmp47 /
-                     (std::pow(_tmp31, Scalar(2)) * _tmp33);
+    _hessian(0, 0) =
+        (_tmp36 * _tmp36) * std::pow(_tmp4, _tmp10) * _tmp47 / (_tmp13 * (_tmp4 * _tmp4));
+    _hessian(1, 1) =
+        std::pow(_tmp16, _tmp10) * (_tmp39 * _tmp39) * _tmp47 / ((_tmp16 * _tmp16) * _tmp18);
+    _hessian(2, 2) =
+        std::pow(_tmp21, _tmp10) * (_tmp41 * _tmp41) * _tmp47 / ((_tmp21 * _tmp21) * _tmp23);
+    _hessian(3, 3) =
+        std::pow(_tmp26, _tmp10) * (_tmp43 * _tmp43) * _tmp47 / ((_tmp26 * _tmp26) * _tmp28);
+    _hessian(4, 4) =
+        std::pow(_tmp31, _tmp10) * (_tmp45 * _tmp45) * _tmp47 / ((_tmp31 * _tmp31) * _tmp33);
   }
 
   if (rhs != nullptr) {
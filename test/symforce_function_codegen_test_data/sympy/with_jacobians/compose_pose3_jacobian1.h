@@ -63,13 +63,13 @@ Eigen::Matrix<Scalar, 6, 6> ComposePose3Jacobian1(const sym::Pose3<Scalar>& a,
   const Scalar _tmp28 = -_tmp5;
   const Scalar _tmp29 = -_tmp4;
   const Scalar _tmp30 = _tmp28 * _tmp29;
-  const Scalar _tmp31 = 2 * std::pow(_a[1], Scalar(2));
-  const Scalar _tmp32 = 2 * std::pow(_a[2], Scalar(2)) - 1;
+  const Scalar _tmp31 = 2 * (_a[1] * _a[1]);
+  const Scalar _tmp32 = 2 * (_a[2] * _a[2]) - 1;
   const Scalar _tmp33 = 2 * _a[3];
   const Scalar _tmp34 = _a[2] * _tmp33;
   const Scalar _tmp35 = 2 * _a[0];
   const Scalar _tmp36 = _a[1] * _tmp33;
-  const Scalar _tmp37 = 2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp37 = 2 * (_a[0] * _a[0]);
   const Scalar _tmp38 = _a[0] * _tmp33;
 
   // Output terms (1)
@@ -86,11 +86,11 @@ void ComposePose3Jacobians(const sym::Pose3<Scalar>& a, const sym::Pose3<Scalar>
   const Scalar _tmp53 = _a[2] * _tmp44;
   const Scalar _tmp54 = _tmp52 - _tmp53;
   const Scalar _tmp55 = -_tmp54;
-  const Scalar _tmp56 = std::pow(_a[1], Scalar(2));
-  const Scalar _tmp57 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp56 = (_a[1] * _a[1]);
+  const Scalar _tmp57 = (_a[2] * _a[2]);
   const Scalar _tmp58 = -_tmp57;
-  const Scalar _tmp59 = std::pow(_a[3], Scalar(2));
-  const Scalar _tmp60 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp59 = (_a[3] * _a[3]);
+  const Scalar _tmp60 = (_a[0] * _a[0]);
   const Scalar _tmp61 = _tmp59 - _tmp60;
   const Scalar _tmp62 = _tmp56 + _tmp58 + _tmp61;
   const Scalar _tmp63 = _tmp52 + _tmp53;
@@ -54,16 +54,16 @@ sym::Pose3<Scalar> ComposePose3WithJacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp21 = _a[1] * _tmp15;
   const Scalar _tmp22 = _a[2] * _tmp17;
   const Scalar _tmp23 = _tmp21 + _tmp22;
-  const Scalar _tmp24 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp24 = (_a[1] * _a[1]);
   const Scalar _tmp25 = 2 * _tmp24;
-  const Scalar _tmp26 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp26 = (_a[2] * _a[2]);
   const Scalar _tmp27 = 2 * _tmp26 - 1;
   const Scalar _tmp28 = _tmp16 + _tmp18;
   const Scalar _tmp29 = _a[0] * _tmp15;
   const Scalar _tmp30 = 2 * _a[1] * _a[2];
   const Scalar _tmp31 = _tmp29 - _tmp30;
   const Scalar _tmp32 = -_tmp31;
-  const Scalar _tmp33 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp33 = (_a[0] * _a[0]);
   const Scalar _tmp34 = 2 * _tmp33;
   const Scalar _tmp35 = _tmp21 - _tmp22;
   const Scalar _tmp36 = -_tmp35;
@@ -100,7 +100,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobian0(const sym::Pose3<Scalar>& a,
   const Scalar _tmp67 = 2 * _tmp10 - 2 * _tmp11 + 2 * _tmp8 + 2 * _tmp9;
   const Scalar _tmp68 = -_tmp67;
   const Scalar _tmp69 = -_tmp26;
-  const Scalar _tmp70 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp70 = (_a[3] * _a[3]);
   const Scalar _tmp71 = -_tmp33 + _tmp70;
   const Scalar _tmp72 = _tmp24 + _tmp69 + _tmp71;
   const Scalar _tmp73 = -_tmp24;
@@ -49,13 +49,13 @@ sym::Pose3<Scalar> ComposePose3WithJacobian1(const sym::Pose3<Scalar>& a,
   const Scalar _tmp16 = _a[1] * _tmp13;
   const Scalar _tmp17 = 2 * _a[0];
   const Scalar _tmp18 = _a[2] * _tmp17 + _tmp16;
-  const Scalar _tmp19 = 2 * std::pow(_a[1], Scalar(2));
-  const Scalar _tmp20 = 2 * std::pow(_a[2], Scalar(2)) - 1;
+  const Scalar _tmp19 = 2 * (_a[1] * _a[1]);
+  const Scalar _tmp20 = 2 * (_a[2] * _a[2]) - 1;
   const Scalar _tmp21 = -_tmp19 - _tmp20;
   const Scalar _tmp22 = _a[1] * _tmp17 + _tmp14;
   const Scalar _tmp23 = _a[0] * _tmp13;
   const Scalar _tmp24 = 2 * _a[1] * _a[2] - _tmp23;
-  const Scalar _tmp25 = 2 * std::pow(_a[0], Scalar(2));
+  const Scalar _tmp25 = 2 * (_a[0] * _a[0]);
   const Scalar _tmp26 = -_tmp20 - _tmp25;
   const Scalar _tmp27 = 2 * _a[0] * _a[2] - _tmp16;
   const Scalar _tmp28 = 2 * _a[1] * _a[2] + _tmp23;
@@ -56,9 +56,9 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp21 = _a[1] * _tmp15;
   const Scalar _tmp22 = _a[2] * _tmp17;
   const Scalar _tmp23 = _tmp21 + _tmp22;
-  const Scalar _tmp24 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp24 = (_a[1] * _a[1]);
   const Scalar _tmp25 = 2 * _tmp24;
-  const Scalar _tmp26 = std::pow(_a[2], Scalar(2));
+  const Scalar _tmp26 = (_a[2] * _a[2]);
   const Scalar _tmp27 = 2 * _tmp26 - 1;
   const Scalar _tmp28 = -_tmp25 - _tmp27;
   const Scalar _tmp29 = _tmp16 + _tmp18;
@@ -66,7 +66,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp31 = 2 * _a[1] * _a[2];
   const Scalar _tmp32 = _tmp30 - _tmp31;
   const Scalar _tmp33 = -_tmp32;
-  const Scalar _tmp34 = std::pow(_a[0], Scalar(2));
+  const Scalar _tmp34 = (_a[0] * _a[0]);
   const Scalar _tmp35 = 2 * _tmp34;
   const Scalar _tmp36 = -_tmp27 - _tmp35;
   const Scalar _tmp37 = _tmp21 - _tmp22;
@@ -105,7 +105,7 @@ sym::Pose3<Scalar> ComposePose3WithJacobians(const sym::Pose3<Scalar>& a,
   const Scalar _tmp70 = 2 * _tmp10 - 2 * _tmp11 + 2 * _tmp8 + 2 * _tmp9;
   const Scalar _tmp71 = -_tmp70;
   const Scalar _tmp72 = -_tmp26;
-  const Scalar _tmp73 = std::pow(_a[3], Scalar(2));
+  const Scalar _tmp73 = (_a[3] * _a[3]);
   const Scalar _tmp74 = -_tmp34 + _tmp73;
   const Scalar _tmp75 = _tmp24 + _tmp72 + _tmp74;
   const Scalar _tmp76 = -_tmp24;
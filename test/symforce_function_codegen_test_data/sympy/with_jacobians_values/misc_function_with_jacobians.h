@@ -82,15 +82,15 @@ void MiscFunctionWithJacobians(const sym::Rot3<Scalar>& a, const Scalar b,
   const Scalar _tmp4 = _a[0] * _tmp0;
   const Scalar _tmp5 = _a[1] * _tmp2;
   const Scalar _tmp6 = -_tmp4 + _tmp5;
-  const Scalar _tmp7 = std::pow(_a[0], Scalar(2));
-  const Scalar _tmp8 = std::pow(_a[1], Scalar(2));
+  const Scalar _tmp7 = (_a[0] * _a[0]);
+  const Scalar _tmp8 = (_a[1] * _a[1]);
   const Scalar _tmp9 = -2 * _tmp7 - 2 * _tmp8 + 1;
-  const Scalar _tmp10 = std::sqrt(Scalar(
-      std::pow(c(0, 0), Scalar(2)) + std::pow(c(1, 0), Scalar(2)) + std::pow(c(2, 0), Scalar(2)) +
-      std::pow(c(3, 0), Scalar(2)) + std::pow(c(4, 0), Scalar(2))));
+  const Scalar _tmp10 =
+      std::sqrt(Scalar((c(0, 0) * c(0, 0)) + (c(1, 0) * c(1, 0)) + (c(2, 0) * c(2, 0)) +
+                       (c(3, 0) * c(3, 0)) + (c(4, 0) * c(4, 0))));
   const Scalar _tmp11 = _a[2] * _tmp0;
   const Scalar _tmp12 = 2 * _a[0] * _a[1];
-  const Scalar _tmp13 = -std::pow(_a[2], Scalar(2)) + std::pow(_a[3], Scalar(2));
+  const Scalar _tmp13 = -(_a[2] * _a[2]) + (_a[3] * _a[3]);
   const Scalar _tmp14 = Scalar(1.0) / (_tmp10);
 
   // Output terms (20)
@@ -105,7 +105,7 @@ void MiscFunctionWithJacobians(const sym::Rot3<Scalar>& a, const Scalar b,
   if (b_out != nullptr) {
     Scalar& _b_out = (*b_out);
 
-    _b_out = _tmp10 + std::pow(b, Scalar(2));
+    _b_out = _tmp10 + (b * b);
   }
 
   if (c_out != nullptr) {
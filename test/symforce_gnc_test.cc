@@ -3,10 +3,13 @@
  * This source code is under the Apache 2.0 license found in the LICENSE file.
  * ---------------------------------------------------------------------------- */
 
+#include <cmath>
+
 #include <catch2/catch_test_macros.hpp>
 #include <spdlog/spdlog.h>
 
 #include <symforce/opt/gnc_optimizer.h>
+#include <symforce/opt/robust_loss.h>
 
 #include "symforce_function_codegen_test_data/symengine/gnc_test_data/cpp/symforce/gnc_factors/barron_factor.h"
 
@@ -37,6 +40,31 @@ sym::optimizer_gnc_params_t DefaultGncParams() {
   return params;
 }
 
+/**
+ * Factors on 'x' with residual x - sample, for random normal samples, the first n_outliers of which
+ * are outliers.  Each evaluation of a factor increments num_evaluations.
+ */
+std::vector<sym::Factord> SampleFactors(const int n_residuals, const int n_outliers,
+                                        int* const num_evaluations) {
+  std::mt19937 gen(42);
+  std::vector<sym::Factord> factors;
+  for (int i = 0; i < n_residuals; i++) {
+    sym::Vector5d sample = 0.1 * sym::Random<sym::Vector5d>(gen);
+    if (i < n_outliers) {
+      sample += sym::Vector5d::Constant(10);
+    }
+    factors.push_back(sym::Factord::Jacobian(
+        [sample, num_evaluations](const sym::Vector5d& x, sym::Vector5d* const res,
+                                  sym::Matrix55d* const jac) {
+          (*num_evaluations)++;
+          *res = x - sample;
+          *jac = sym::Matrix55d::Identity();
+        },
+        {'x'}));
+  }
+  return factors;
+}
+
 TEST_CASE("Test GNC", "[gnc]") {
   static constexpr const double kEpsilon = 1e-12;
   const int n_residuals = 20;
@@ -88,3 +116,78 @@ TEST_CASE("Test GNC", "[gnc]") {
   CHECK(gnc_optimized_x.norm() < 0.1);
   CHECK(gnc_optimized_x.norm() * 5 < regular_optimized_x.norm());
 }
+
+TEST_CASE("Test GNC with robust losses", "[gnc]") {
+  static constexpr const double kEpsilon = 1e-12;
+  const int n_residuals = 20;
+  const int n_outliers = 3;
+
+  int num_evaluations = 0;
+  const std::vector<sym::Factord> factors =
+      SampleFactors(n_residuals, n_outliers, &num_evaluations);
+
+  sym::Valuesd initial_values;
+  initial_values.Set<sym::Vector5d>('x', sym::Vector5d::Ones());
+
+  // The factors don't depend on mu, which sets the shape of a Barron loss applied by the
+  // Linearizer in the same way as BarronNoiseModel
+  sym::GncOptimizer<sym::Optimizerd> gnc_optimizer(
+      DefaultLmParams(), DefaultGncParams(),
+      [](const double mu, sym::RobustLoss<double>& loss) {
+        loss.SetAlpha(2 - 1 / (1 - mu + kEpsilon));
+      },
+      factors);
+  gnc_optimizer.Linearizer().SetRobustLosses(
+      std::vector<sym::RobustLoss<double>>(factors.size(), sym::RobustLoss<double>::Barron(2, 1)));
+
+  sym::Valuesd gnc_optimized_values = initial_values;
+  const auto gnc_stats = gnc_optimizer.Optimize(gnc_optimized_values);
+
+  // Each step of mu reweights the last linearization instead of evaluating the factors again, so
+  // they're evaluated once per entry in the stats (the first of which is the initial linearization)
+  CHECK(num_evaluations == n_residuals * static_cast<int>(gnc_stats.iterations.size()));
+
+  sym::Valuesd regular_optimized_values = initial_values;
+  sym::Optimize(DefaultLmParams(), factors, regular_optimized_values, kEpsilon);
+
+  const sym::Vector5d gnc_optimized_x = gnc_optimized_values.At<sym::Vector5d>('x');
+  const sym::Vector5d regular_optimized_x = regular_optimized_values.At<sym::Vector5d>('x');
+  CHECK(gnc_optimized_x.norm() < 0.1);
+  CHECK(gnc_optimized_x.norm() * 5 < regular_optimized_x.norm());
+}
+
+TEST_CASE("Test GNC with truncated least squares losses", "[gnc]") {
+  static constexpr const double kEpsilon = 1e-12;
+  const int n_residuals = 20;
+  const int n_outliers = 3;
+
+  int num_evaluations = 0;
+  const std::vector<sym::Factord> factors =
+      SampleFactors(n_residuals, n_outliers, &num_evaluations);
+
+  sym::Valuesd initial_values;
+  initial_values.Set<sym::Vector5d>('x', sym::Vector5d::Ones());
+
+  // The GncTls loss is convex as its mu goes to 0, and approaches truncated least squares as it goes
+  // to infinity, so map the GNC mu in [0, 1) onto [1e-3, 1e3)
+  sym::GncOptimizer<sym::Optimizerd> gnc_optimizer(
+      DefaultLmParams(), DefaultGncParams(),
+      [](const double mu, sym::RobustLoss<double>& loss) { loss.SetMu(1e-3 * std::pow(1e6, mu)); },
+      factors);
+  gnc_optimizer.Linearizer().SetRobustLosses(std::vector<sym::RobustLoss<double>>(
+      factors.size(), sym::RobustLoss<double>::GncTls(1, 1e-3)));
+
+  sym::Valuesd gnc_optimized_values = initial_values;
+  const auto gnc_stats = gnc_optimizer.Optimize(gnc_optimized_values);
+
+  // As above, the factors are only evaluated for the iterations of the optimizer
+  CHECK(num_evaluations == n_residuals * static_cast<int>(gnc_stats.iterations.size()));
+
+  sym::Valuesd regular_optimized_values = initial_values;
+  sym::Optimize(DefaultLmParams(), factors, regular_optimized_values, kEpsilon);
+
+  const sym::Vector5d gnc_optimized_x = gnc_optimized_values.At<sym::Vector5d>('x');
+  const sym::Vector5d regular_optimized_x = regular_optimized_values.At<sym::Vector5d>('x');
+  CHECK(gnc_optimized_x.norm() < 0.1);
+  CHECK(gnc_optimized_x.norm() * 5 < regular_optimized_x.norm());
+}
@@ -0,0 +1,69 @@
+# ----------------------------------------------------------------------------
+# SymForce - Copyright 2022, Skydio, Inc.
+# This source code is under the Apache 2.0 license found in the LICENSE file.
+# ----------------------------------------------------------------------------
+
+import numpy as np
+
+import symforce.symbolic as sf
+from symforce.lambdify_util import batch_lambdify
+from symforce.test_util import TestCase
+
+
+class SymforceLambdifyUtilTest(TestCase):
+    """
+    Tests contents of symforce.lambdify_util
+    """
+
+    def test_batch_lambdify(self) -> None:
+        """
+        Tests:
+            batch_lambdify
+        """
+        x = sf.Symbol("x")
+        R = sf.Rot3.symbolic("R")
+        v = sf.V3.symbolic("v")
+        M = sf.M23.symbolic("M")
+
+        outputs = [R * (x * v), M * v, sf.sin(x) + sf.sqrt(v.squared_norm()), sf.S(2), R.inverse()]
+        f = batch_lambdify([R, x, v, M], outputs)
+
+        num_points = 150
+        rng = np.random.default_rng(42)
+        rots = [sf.Rot3.random() for _ in range(num_points)]
+        R_values = np.array([rot.to_storage() for rot in rots], dtype=np.float64)
+        x_values = rng.uniform(-1, 1, num_points)
+        v_values = rng.uniform(-1, 1, (num_points, 3))
+        M_values = rng.uniform(-1, 1, (num_points, 2, 3))
+
+        results = f(R_values, x_values, v_values, M_values)
+
+        self.assertEqual(results[0].shape, (num_points, 3))
+        self.assertEqual(results[1].shape, (num_points, 2))
+        self.assertEqual(results[2].shape, (num_points,))
+        self.assertEqual(results[3].shape, (num_points,))
+        self.assertEqual(results[4].shape, (num_points, 4))
+
+        for i in range(0, num_points, 7):
+            rot = sf.Rot3.from_storage(R_values[i])
+            self.assertStorageNear(results[0][i], rot * (float(x_values[i]) * sf.V3(v_values[i])))
+            self.assertStorageNear(results[1][i], sf.M23(M_values[i]) * sf.V3(v_values[i]))
+            self.assertAlmostEqual(
+                results[2][i], np.sin(x_values[i]) + np.linalg.norm(v_values[i]), places=9
+            )
+            self.assertEqual(results[3][i], 2.0)
+            self.assertStorageNear(results[4][i], rot.inverse())
+
+        # Matrix outputs are (N, rows, cols)
+        g = batch_lambdify([M], [M.T])
+        self.assertEqual(g(M_values)[0].shape, (num_points, 3, 2))
+        np.testing.assert_allclose(g(M_values)[0], M_values.transpose(0, 2, 1))
+
+        with self.assertRaises(ValueError):
+            batch_lambdify([x * 2], [x])
+        with self.assertRaises(ValueError):
+            f(R_values, x_values)
+
+
+if __name__ == "__main__":
+    TestCase.main()
@@ -352,6 +352,80 @@ TEST_CASE("Test nontrivial (frozen, out-of-order) keys", "[optimizer]") {
       jtj.triangularView<Eigen::Lower>(), 1e-6));
 }
 
+/**
+ * Test that the per-iteration phase timings are only filled out when record_timing is set, and
+ * that the phases of each iteration fit inside its total
+ */
+TEST_CASE("Test per-iteration timing", "[optimizer]") {
+  std::vector<sym::Factord> factors;
+  factors.push_back(sym::Factord::Jacobian(
+      [](double x, double y, sym::Vector1d* residual, Eigen::Matrix<double, 1, 2>* jacobian) {
+        (*residual)[0] = 3.0 - 0.5 * std::sin((x - 2.) / 5.) + 1.0 * std::sin((y + 2.) / 10.);
+
+        if (jacobian) {
+          (*jacobian)(0, 0) = -0.1 * std::cos(0.2 * (-2.0 + x));
+          (*jacobian)(0, 1) = 0.1 * std::cos(0.1 * (2.0 + y));
+        }
+      },
+      {'x', 'y'}));
+
+  sym::Valuesd initial_values;
+  initial_values.Set<double>('x', 0.0);
+  initial_values.Set<double>('y', 0.0);
+
+  sym::optimizer_params_t params = DefaultLmParams();
+  params.verbose = false;
+  params.iterations = 10;
+
+  SECTION("Disabled") {
+    params.record_timing = false;
+    sym::Optimizerd optimizer(params, factors);
+    sym::Valuesd values = initial_values;
+    const auto stats = optimizer.Optimize(values);
+
+    const auto total = stats.TotalTiming();
+    CHECK(total.total == 0.0f);
+    CHECK(total.linearize == 0.0f);
+    CHECK(total.sparse_factorize == 0.0f);
+  }
+
+  SECTION("Enabled") {
+    params.record_timing = true;
+    sym::Optimizerd optimizer(params, factors);
+
+    // Optimize twice, to check that the timings are reset between runs
+    for (int run = 0; run < 2; run++) {
+      sym::Valuesd values = initial_values;
+      const auto stats = optimizer.Optimize(values);
+      REQUIRE(stats.iterations.size() > 1);
+
+      // The initial linearization is recorded for iteration -1
+      CHECK(stats.iterations.front().iteration == -1);
+      CHECK(stats.iterations.front().timing.linearize > 0.0f);
+
+      for (const auto& iteration : stats.iterations) {
+        const auto& timing = iteration.timing;
+        CHECK(timing.damp_hessian >= 0.0f);
+        CHECK(timing.sparse_factorize >= 0.0f);
+        CHECK(timing.sparse_solve >= 0.0f);
+        CHECK(timing.update >= 0.0f);
+        CHECK(timing.linearize >= 0.0f);
+
+        const float phases = timing.damp_hessian + timing.sparse_factorize + timing.sparse_solve +
+                             timing.update + timing.linearize;
+        CHECK(phases <= timing.total);
+        if (iteration.iteration >= 0) {
+          CHECK(timing.total > 0.0f);
+        }
+      }
+
+      const auto total = stats.TotalTiming();
+      CHECK(total.total >= total.linearize);
+      CHECK(stats.GetLcmType().iterations.back().timing == stats.iterations.back().timing);
+    }
+  }
+}
+
 /**
  * Test that sym::Optimizer can be constructed with different linear solver orderings
  *
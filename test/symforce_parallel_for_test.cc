@@ -0,0 +1,41 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <symforce/opt/parallel_for.h>
+
+TEST_CASE("ParallelForBlocks covers every index once", "[parallel_for]") {
+  for (const int num_threads : {0, 1, 4}) {
+    for (const size_t count : {0, 1, 99, 100, 101, 1000}) {
+      std::vector<int> visits(count, 0);
+      std::vector<std::pair<size_t, size_t>> blocks;
+      std::mutex blocks_mutex;
+
+      sym::ParallelForBlocks(
+          count,
+          [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+              visits[i]++;
+            }
+            const std::lock_guard<std::mutex> lock(blocks_mutex);
+            blocks.emplace_back(begin, end);
+          },
+          /* block_size */ 100, num_threads);
+
+      CHECK(std::all_of(visits.begin(), visits.end(), [](const int v) { return v == 1; }));
+      CHECK(blocks.size() == (count + 99) / 100);
+      for (const auto& block : blocks) {
+        CHECK(block.first % 100 == 0);
+        CHECK(block.second == std::min(block.first + 100, count));
+      }
+    }
+  }
+}
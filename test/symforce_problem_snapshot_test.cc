@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sym/factors/between_factor_pose3.h>
+#include <sym/factors/prior_factor_pose3.h>
+#include <sym/pose3.h>
+#include <symforce/opt/optimizer.h>
+#include <symforce/opt/problem_snapshot.h>
+
+#include "temp_directory.h"
+
+namespace {
+
+/**
+ * A pose graph with a prior on the first pose and noisy between factors, with a key removed from
+ * the values so their data buffer has a hole
+ */
+void BuildPoseGraph(const int num_poses, sym::Valuesd* const values,
+                    std::vector<sym::FactorDescription>* const factors) {
+  std::mt19937 gen(42);
+  for (int i = 0; i < num_poses; i++) {
+    values->Set({'P', i}, sym::Pose3d::Random(gen));
+  }
+  values->Set('r', sym::Rot3d::Random(gen));
+  values->Remove('r');
+  values->Set({'T', 0}, sym::Pose3d::Random(gen));
+  values->Set('s', Eigen::Matrix<double, 6, 6>::Identity().eval());
+  values->Set('e', sym::kDefaultEpsilond);
+
+  factors->push_back({"prior_pose3", {{'P', 0}, {'T', 0}, 's', 'e'}, {{'P', 0}}});
+  for (int i = 0; i < num_poses - 1; i++) {
+    values->Set({'D', i}, sym::Pose3d::FromTangent(0.1 * sym::Vector6d::Random()));
+    factors->push_back(
+        {"between_pose3", {{'P', i}, {'P', i + 1}, {'D', i}, 's', 'e'}, {{'P', i}, {'P', i + 1}}});
+  }
+}
+
+sym::FactorRegistryd MakeRegistry() {
+  sym::FactorRegistryd registry;
+  registry.RegisterJacobian(
+      "prior_pose3", [](const sym::Pose3d& value, const sym::Pose3d& prior,
+                        const Eigen::Matrix<double, 6, 6>& sqrt_info, const double epsilon,
+                        Eigen::Matrix<double, 6, 1>* const res,
+                        Eigen::Matrix<double, 6, 6>* const jacobian) {
+        sym::PriorFactorPose3(value, prior, sqrt_info, epsilon, res, jacobian);
+      });
+  registry.RegisterHessian("between_pose3", sym::BetweenFactorPose3<double>);
+  return registry;
+}
+
+}  // namespace
+
+TEST_CASE("Problem snapshots round trip", "[problem_snapshot]") {
+  const symforce_test::TempDirectory directory("symforce_problem_snapshot_test");
+  const std::string filename = directory.File("pose_graph.snapshot");
+  sym::Valuesd values;
+  std::vector<sym::FactorDescription> descriptions;
+  BuildPoseGraph(10, &values, &descriptions);
+  sym::WriteProblemSnapshot(filename, values, descriptions);
+
+  const sym::ProblemSnapshotd snapshot(filename);
+  CHECK(snapshot.NumEntries() == values.NumEntries());
+  CHECK(snapshot.DataSize() == values.Data().size());
+  for (const sym::Key& key : values.Keys()) {
+    CHECK(snapshot.Has(key));
+  }
+  CHECK(!snapshot.Has('r'));
+  CHECK_THROWS_AS(snapshot.At<sym::Rot3d>('r'), std::runtime_error);
+  CHECK_THROWS_AS(snapshot.At<sym::Rot3d>({'P', 3}), std::runtime_error);
+  CHECK(snapshot.At<sym::Pose3d>({'P', 3}) == values.At<sym::Pose3d>({'P', 3}));
+  CHECK(snapshot.At<double>('e') == sym::kDefaultEpsilond);
+
+  const sym::Valuesd snapshot_values = snapshot.GetValues();
+  CHECK(snapshot_values.Data() == values.Data());
+  for (const sym::Key& key : values.Keys()) {
+    const auto entry = values.IndexEntryAt(key);
+    const auto snapshot_entry = snapshot_values.IndexEntryAt(key);
+    CHECK(snapshot_entry.type == entry.type);
+    CHECK(snapshot_entry.offset == entry.offset);
+    CHECK(snapshot_entry.storage_dim == entry.storage_dim);
+    CHECK(snapshot_entry.tangent_dim == entry.tangent_dim);
+  }
+
+  REQUIRE(snapshot.FactorDescriptions().size() == descriptions.size());
+  for (size_t i = 0; i < descriptions.size(); i++) {
+    CHECK(snapshot.FactorDescriptions()[i].function_id == descriptions[i].function_id);
+    CHECK(snapshot.FactorDescriptions()[i].keys_to_func == descriptions[i].keys_to_func);
+    CHECK(snapshot.FactorDescriptions()[i].keys_to_optimize == descriptions[i].keys_to_optimize);
+  }
+
+  // Replaying the snapshot gives the same result as the original problem
+  const sym::FactorRegistryd registry = MakeRegistry();
+  std::vector<sym::Factord> factors;
+  for (const auto& description : descriptions) {
+    factors.push_back(registry.Create(description));
+  }
+  sym::Optimizerd optimizer(sym::DefaultOptimizerParams(), factors);
+  sym::Optimizerd snapshot_optimizer(sym::DefaultOptimizerParams(),
+                                     snapshot.CreateFactors(registry));
+  sym::Valuesd optimized_values = values;
+  sym::Valuesd snapshot_optimized_values = snapshot_values;
+  const auto stats = optimizer.Optimize(optimized_values);
+  const auto snapshot_stats = snapshot_optimizer.Optimize(snapshot_optimized_values);
+  CHECK(stats.iterations.size() == snapshot_stats.iterations.size());
+  CHECK(optimized_values.Data() == snapshot_optimized_values.Data());
+}
+
+TEST_CASE("Snapshot values own a copy of the data", "[problem_snapshot]") {
+  const symforce_test::TempDirectory directory("symforce_problem_snapshot_test");
+  const std::string filename = directory.File("pose_graph.snapshot");
+  sym::Valuesd values;
+  std::vector<sym::FactorDescription> descriptions;
+  BuildPoseGraph(10, &values, &descriptions);
+  sym::WriteProblemSnapshot(filename, values, descriptions);
+
+  sym::Valuesd snapshot_values;
+  {
+    const sym::ProblemSnapshotd snapshot(filename);
+    snapshot_values = snapshot.GetValues();
+    CHECK(snapshot_values.Data() == values.Data());
+
+    // Modifying the values changes neither the snapshot nor other values from it
+    snapshot_values.Set('e', 1.0);
+    CHECK(snapshot.At<double>('e') == sym::kDefaultEpsilond);
+    CHECK(snapshot.GetValues().At<double>('e') == sym::kDefaultEpsilond);
+  }
+
+  // The values outlive the snapshot, and can grow past the snapshot's data
+  CHECK(snapshot_values.At<double>('e') == 1.0);
+  snapshot_values.Set('z', 2.0);
+  CHECK(snapshot_values.At<double>('z') == 2.0);
+  CHECK(snapshot_values.At<sym::Pose3d>({'P', 3}) == values.At<sym::Pose3d>({'P', 3}));
+
+  const sym::Valuesd copy = snapshot_values;
+  CHECK(copy.Data() == snapshot_values.Data());
+  CHECK(copy.Data().data() != snapshot_values.Data().data());
+}
+
+TEST_CASE("Problem snapshots reject invalid files", "[problem_snapshot]") {
+  const symforce_test::TempDirectory directory("symforce_problem_snapshot_test");
+  const std::string filename = directory.File("invalid.snapshot");
+  sym::Valuesd values;
+  std::vector<sym::FactorDescription> descriptions;
+  BuildPoseGraph(3, &values, &descriptions);
+  sym::WriteProblemSnapshot(filename, values, descriptions);
+
+  // Wrong Scalar type
+  CHECK_THROWS_AS(sym::ProblemSnapshotf(filename), std::runtime_error);
+
+  std::string contents;
+  {
+    std::ifstream file(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  // Corrupted header fields, at their offsets in the header
+  const auto write_with_header_field = [&](const size_t field_offset, const uint64_t value) {
+    std::string corrupted = contents;
+    std::memcpy(&corrupted[field_offset], &value, sizeof(value));
+    std::ofstream(filename, std::ios::binary) << corrupted;
+  };
+  // More factors than fit in the file
+  write_with_header_field(32, uint64_t{1} << 40);
+  CHECK_THROWS_AS(sym::ProblemSnapshotd(filename), std::runtime_error);
+  // Index entries outside of the data
+  write_with_header_field(24, 0);
+  CHECK_THROWS_AS(sym::ProblemSnapshotd(filename).At<sym::Pose3d>({'P', 0}), std::runtime_error);
+
+  // Truncated
+  std::ofstream(filename, std::ios::binary) << contents.substr(0, contents.size() - 8);
+  CHECK_THROWS_AS(sym::ProblemSnapshotd(filename), std::runtime_error);
+
+  CHECK_THROWS_AS(sym::ProblemSnapshotd(directory.File("missing.snapshot")), std::runtime_error);
+
+  // Unregistered functions
+  sym::WriteProblemSnapshot(filename, values, descriptions);
+  CHECK_THROWS_AS(sym::ProblemSnapshotd(filename).CreateFactors(sym::FactorRegistryd()),
+                  std::runtime_error);
+}
@@ -3,6 +3,9 @@
 # This source code is under the Apache 2.0 license found in the LICENSE file.
 # ----------------------------------------------------------------------------
 
+import os
+import unittest.mock
+
 from symforce import python_util
 from symforce.test_util import TestCase
 
@@ -81,6 +84,49 @@ class SymforceUtilTest(TestCase):
                 with self.assertRaises(python_util.InvalidKeyError):
                     python_util.base_and_indices(malformed_index)
 
+    def test_parallel_map(self) -> None:
+        """
+        Tests:
+            python_util.parallel_map
+        """
+        offset = 10
+
+        # Closures work, since the workers are forked
+        def add_offset(x: int) -> int:
+            return x + offset
+
+        for num_processes in (1, 4, None):
+            with self.subTest(num_processes=num_processes):
+                self.assertEqual(
+                    python_util.parallel_map(add_offset, range(20), num_processes=num_processes),
+                    list(range(10, 30)),
+                )
+
+        # Nested calls run serially in the worker
+        self.assertEqual(
+            python_util.parallel_map(
+                lambda n: sum(python_util.parallel_map(add_offset, range(n), num_processes=2)),
+                [1, 2, 3],
+                num_processes=3,
+            ),
+            [10, 21, 33],
+        )
+
+        # Nothing is forked by default
+        with unittest.mock.patch.dict(os.environ):
+            os.environ.pop("SYMFORCE_NUM_PROCESSES", None)
+            self.assertEqual(python_util.default_num_processes(), 1)
+            os.environ["SYMFORCE_NUM_PROCESSES"] = "0"
+            self.assertEqual(python_util.default_num_processes(), os.cpu_count())
+
+        def raise_on_three(x: int) -> int:
+            if x == 3:
+                raise ValueError("three")
+            return x
+
+        with self.assertRaises(ValueError):
+            python_util.parallel_map(raise_on_three, range(5), num_processes=2)
+
 
 if __name__ == "__main__":
     TestCase.main()
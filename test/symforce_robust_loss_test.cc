@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <symforce/opt/factor.h>
+#include <symforce/opt/linearizer.h>
+#include <symforce/opt/robust_loss.h>
+#include <symforce/opt/util.h>
+
+using RobustLossd = sym::RobustLoss<double>;
+
+std::vector<RobustLossd> AllLosses() {
+  return {RobustLossd(),
+          RobustLossd::Huber(0.7),
+          RobustLossd::Cauchy(0.7),
+          RobustLossd::Barron(2, 0.7),
+          RobustLossd::Barron(1, 0.7),
+          RobustLossd::Barron(0, 0.7),
+          RobustLossd::Barron(-2, 0.7),
+          RobustLossd::Barron(-std::numeric_limits<double>::infinity(), 0.7),
+          RobustLossd::GncTls(0.7, 0.1),
+          RobustLossd::GncTls(0.7, 10)};
+}
+
+/**
+ * Factor with residual A * [x; z] - y, for a 2d x and a scalar z, so that every factor touches
+ * every key
+ */
+sym::Factord GetFactor(const Eigen::Matrix3d& A, const Eigen::Vector3d& y, const bool sparse,
+                       int* const num_evaluations) {
+  if (sparse) {
+    return sym::Factord::Jacobian(
+        [A, y, num_evaluations](const Eigen::Vector2d& x, const double z,
+                                Eigen::VectorXd* const res,
+                                Eigen::SparseMatrix<double>* const jac) {
+          (*num_evaluations)++;
+          *res = A * Eigen::Vector3d(x[0], x[1], z) - y;
+          *jac = A.sparseView();
+        },
+        {'x', 'z'});
+  } else {
+    return sym::Factord::Jacobian(
+        [A, y, num_evaluations](const Eigen::Vector2d& x, const double z,
+                                Eigen::Vector3d* const res, Eigen::Matrix3d* const jac) {
+          (*num_evaluations)++;
+          *res = A * Eigen::Vector3d(x[0], x[1], z) - y;
+          *jac = A;
+        },
+        {'x', 'z'});
+  }
+}
+
+TEST_CASE("Robust loss weights are the derivatives of the costs", "[robust_loss]") {
+  for (const RobustLossd& loss : AllLosses()) {
+    // Quadratic near zero
+    CHECK(loss.Cost(1e-8) == Catch::Approx(1e-8).epsilon(1e-6));
+    CHECK(loss.Weight(0) == Catch::Approx(1));
+    CHECK(loss.Weights(0).residual_scale == 1);
+
+    for (double s = 0.013; s < 20; s *= 1.3) {
+      const double h = 1e-6 * s;
+      CHECK(loss.Weight(s) ==
+            Catch::Approx((loss.Cost(s + h) - loss.Cost(s - h)) / (2 * h)).margin(1e-6));
+
+      // Robust losses are no larger than L2, and non-decreasing
+      CHECK(loss.Cost(s) <= s * (1 + 1e-12));
+      CHECK(loss.Weight(s) >= 0);
+
+      const sym::RobustLossWeights<double> weights = loss.Weights(s);
+      CHECK(sym::Square(weights.residual_scale) * s == Catch::Approx(loss.Cost(s)));
+      CHECK(sym::Square(weights.jacobian_scale) == Catch::Approx(weights.hessian_scale));
+    }
+  }
+
+  // Barron matches its named special cases
+  for (double s = 0.013; s < 20; s *= 1.3) {
+    CHECK(RobustLossd::Barron(0, 0.7).Cost(s) ==
+          Catch::Approx(RobustLossd::Cauchy(0.7 * std::sqrt(2)).Cost(s)));
+    CHECK(RobustLossd::Barron(1.9999999, 0.7).Cost(s) == Catch::Approx(s).epsilon(1e-5));
+    CHECK(RobustLossd::Barron(1e-7, 0.7).Cost(s) ==
+          Catch::Approx(RobustLossd::Barron(0, 0.7).Cost(s)).epsilon(1e-5));
+  }
+
+  // GNC-TLS approaches truncated least squares
+  CHECK(RobustLossd::GncTls(0.7, 1e6).Cost(0.4) == Catch::Approx(0.4));
+  CHECK(RobustLossd::GncTls(0.7, 1e6).Cost(0.5) == Catch::Approx(0.49));
+  CHECK(RobustLossd::GncTls(0.7, 1e6).Weight(0.5) == 0);
+}
+
+TEST_CASE("Linearizer applies robust losses to the factors", "[robust_loss]") {
+  std::mt19937 gen(42);
+  int num_evaluations = 0;
+
+  std::vector<sym::Factord> factors;
+  std::vector<RobustLossd> losses;
+  const std::vector<RobustLossd> all_losses = AllLosses();
+  for (int i = 0; i < 20; i++) {
+    factors.push_back(GetFactor(sym::Random<Eigen::Matrix3d>(gen),
+                                sym::Random<Eigen::Vector3d>(gen), i % 2 == 0, &num_evaluations));
+    losses.push_back(all_losses[i % all_losses.size()]);
+  }
+
+  sym::Valuesd values;
+  values.Set<Eigen::Vector2d>('x', sym::Random<Eigen::Vector2d>(gen));
+  values.Set('z', 0.3);
+  const std::vector<sym::Key> keys = {'x', 'z'};
+
+  sym::Linearizer<double> linearizer("robust", factors, keys, /* include_jacobians */ true);
+  linearizer.SetRobustLosses(losses);
+
+  // Check the first linearization and a relinearization, which are assembled separately
+  for (int i = 0; i < 2; i++) {
+    sym::Linearizationd linearization;
+    linearizer.Relinearize(values, linearization);
+
+    Eigen::MatrixXd expected_hessian = Eigen::MatrixXd::Zero(3, 3);
+    Eigen::VectorXd expected_rhs = Eigen::VectorXd::Zero(3);
+    double expected_error = 0;
+    for (size_t f = 0; f < factors.size(); f++) {
+      const sym::Linearizationd factor_linearization =
+          sym::Linearize<double>({factors[f]}, values, keys);
+      const double s = factor_linearization.residual.squaredNorm();
+      const double weight = losses[f].Weight(s);
+
+      expected_hessian += weight * Eigen::MatrixXd(factor_linearization.hessian_lower);
+      expected_rhs += weight * factor_linearization.rhs;
+      expected_error += 0.5 * losses[f].Cost(s);
+
+      const auto residual = linearization.residual.segment(3 * f, 3);
+      const auto jacobian = Eigen::MatrixXd(linearization.jacobian).middleRows(3 * f, 3);
+      CHECK(residual.squaredNorm() == Catch::Approx(losses[f].Cost(s)));
+      CHECK(residual.isApprox(std::sqrt(losses[f].Cost(s) / s) * factor_linearization.residual));
+      CHECK(jacobian.isApprox(std::sqrt(weight) * Eigen::MatrixXd(factor_linearization.jacobian)));
+    }
+
+    CHECK(Eigen::MatrixXd(linearization.hessian_lower).isApprox(expected_hessian));
+    CHECK(linearization.rhs.isApprox(expected_rhs));
+    CHECK(linearization.Error() == Catch::Approx(expected_error));
+
+    values.Set<Eigen::Vector2d>('x', sym::Random<Eigen::Vector2d>(gen));
+  }
+}
+
+TEST_CASE("Reweighting matches relinearizing with the new losses", "[robust_loss]") {
+  std::mt19937 gen(42);
+  int num_evaluations = 0;
+
+  std::vector<sym::Factord> factors;
+  for (int i = 0; i < 20; i++) {
+    factors.push_back(GetFactor(sym::Random<Eigen::Matrix3d>(gen),
+                                sym::Random<Eigen::Vector3d>(gen), i % 2 == 0, &num_evaluations));
+  }
+
+  sym::Valuesd values;
+  values.Set<Eigen::Vector2d>('x', sym::Random<Eigen::Vector2d>(gen));
+  values.Set('z', 0.3);
+
+  sym::Linearizer<double> linearizer("reweight", factors, {}, /* include_jacobians */ true);
+  linearizer.SetRobustLosses(
+      std::vector<RobustLossd>(factors.size(), RobustLossd::GncTls(1, 0.1)));
+
+  sym::Linearizationd linearization;
+  linearizer.Relinearize(values, linearization);
+  // Make sure the kept linearizations are from the last evaluation, rather than the first
+  values.Set<Eigen::Vector2d>('x', sym::Random<Eigen::Vector2d>(gen));
+  linearizer.Relinearize(values, linearization);
+
+  for (const double mu : {0.3, 1.0, 10.0}) {
+    std::vector<RobustLossd> losses;
+    for (int i = 0; i < static_cast<int>(factors.size()); i++) {
+      // Change some losses and some loss parameters
+      RobustLossd loss = linearizer.RobustLosses()[i];
+      if (i % 3 == 0) {
+        loss = RobustLossd::Cauchy(mu);
+      } else if (loss.GetType() == RobustLossd::Type::GNC_TLS) {
+        loss.SetMu(mu);
+      }
+      linearizer.SetRobustLoss(i, loss);
+      losses.push_back(loss);
+    }
+
+    const int num_evaluations_before = num_evaluations;
+    linearizer.Reweight(linearization);
+    CHECK(num_evaluations == num_evaluations_before);
+
+    sym::Linearizer<double> expected_linearizer("expected", factors, {}, true);
+    expected_linearizer.SetRobustLosses(losses);
+    sym::Linearizationd expected_linearization;
+    expected_linearizer.Relinearize(values, expected_linearization);
+
+    CHECK(linearization.residual.isApprox(expected_linearization.residual));
+    CHECK(Eigen::MatrixXd(linearization.jacobian)
+              .isApprox(Eigen::MatrixXd(expected_linearization.jacobian)));
+    CHECK(Eigen::MatrixXd(linearization.hessian_lower)
+              .isApprox(Eigen::MatrixXd(expected_linearization.hessian_lower)));
+    CHECK(linearization.rhs.isApprox(expected_linearization.rhs));
+  }
+}
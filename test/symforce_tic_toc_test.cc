@@ -0,0 +1,262 @@
+/* ----------------------------------------------------------------------------
+ * SymForce - Copyright 2022, Skydio, Inc.
+ * This source code is under the Apache 2.0 license found in the LICENSE file.
+ * ---------------------------------------------------------------------------- */
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <symforce/opt/tic_toc.h>
+
+namespace {
+
+int64_t CountFor(const std::string& name) {
+  for (const auto& block : sym::internal::GetGlobalTicTocManager().GetTimingResults()) {
+    if (block.first == name) {
+      return block.second.Count();
+    }
+  }
+  return 0;
+}
+
+const sym::internal::TicTocStats* FindPath(const std::vector<sym::internal::TicTocTreeEntry>& tree,
+                                           const std::vector<std::string>& path) {
+  for (const auto& entry : tree) {
+    if (entry.path == path) {
+      return &entry.stats;
+    }
+  }
+  return nullptr;
+}
+
+void TimedFunction(const std::string& suffix) {
+  SYM_TIME_SCOPE("tic_toc_test: TimedFunction<{}>", suffix);
+}
+
+// A format argument which can't be compared for equality
+struct Uncomparable {
+  int value;
+};
+
+}  // namespace
+
+template <>
+struct fmt::formatter<Uncomparable> : fmt::formatter<int> {
+  template <typename FormatContext>
+  auto format(const Uncomparable& uncomparable, FormatContext& ctx) const -> decltype(ctx.out()) {
+    return fmt::formatter<int>::format(uncomparable.value, ctx);
+  }
+};
+
+TEST_CASE("Scope names are interned to stable ids", "[tic_toc]") {
+  const sym::internal::TicTocId id = sym::internal::InternTicTocName("tic_toc_test: interned");
+  CHECK(id >= 0);
+  CHECK(id < sym::internal::kMaxTicTocIds);
+  CHECK(sym::internal::InternTicTocName("tic_toc_test: interned") == id);
+  CHECK(sym::internal::InternTicTocName("tic_toc_test: other") != id);
+}
+
+TEST_CASE("Scopes are counted under their formatted names", "[tic_toc]") {
+  for (int i = 0; i < 10; i++) {
+    SYM_TIME_SCOPE("tic_toc_test: loop");
+  }
+  CHECK(CountFor("tic_toc_test: loop") == 10);
+
+  // Changing the format arguments at a call site changes the name
+  for (int i = 0; i < 3; i++) {
+    TimedFunction("a");
+  }
+  TimedFunction("b");
+  TimedFunction(std::string("a"));
+  CHECK(CountFor("tic_toc_test: TimedFunction<a>") == 4);
+  CHECK(CountFor("tic_toc_test: TimedFunction<b>") == 1);
+
+  // C strings are compared by value, not by address
+  char buffer[] = "x";
+  for (const char c : {'x', 'y', 'y'}) {
+    buffer[0] = c;
+    SYM_TIME_SCOPE("tic_toc_test: buffer {}", static_cast<const char*>(buffer));
+  }
+  CHECK(CountFor("tic_toc_test: buffer x") == 1);
+  CHECK(CountFor("tic_toc_test: buffer y") == 2);
+}
+
+TEST_CASE("Format arguments are evaluated once, and needn't be comparable", "[tic_toc]") {
+  int num_evaluations = 0;
+  for (int i = 0; i < 3; i++) {
+    SYM_TIME_SCOPE("tic_toc_test: evaluated {}", ++num_evaluations);
+  }
+  CHECK(num_evaluations == 3);
+  CHECK(CountFor("tic_toc_test: evaluated 1") == 1);
+  CHECK(CountFor("tic_toc_test: evaluated 3") == 1);
+
+  for (const int value : {1, 2, 2}) {
+    SYM_TIME_SCOPE("tic_toc_test: uncomparable {}", Uncomparable{value});
+  }
+  CHECK(CountFor("tic_toc_test: uncomparable 1") == 1);
+  CHECK(CountFor("tic_toc_test: uncomparable 2") == 2);
+}
+
+TEST_CASE("Scopes are aggregated across running and finished threads", "[tic_toc]") {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 100; j++) {
+        SYM_TIME_SCOPE("tic_toc_test: thread");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  {
+    SYM_TIME_SCOPE("tic_toc_test: thread");
+  }
+
+  CHECK(CountFor("tic_toc_test: thread") == 401);
+}
+
+TEST_CASE("Nested scopes form a tree of call paths", "[tic_toc]") {
+  for (int i = 0; i < 2; i++) {
+    SYM_TIME_SCOPE("tic_toc_test: outer");
+    for (int j = 0; j < 3; j++) {
+      SYM_TIME_SCOPE("tic_toc_test: inner");
+    }
+  }
+  {
+    SYM_TIME_SCOPE("tic_toc_test: inner");
+  }
+
+  const auto tree = sym::internal::GetGlobalTicTocManager().GetTimingTree();
+
+  const auto* const outer = FindPath(tree, {"tic_toc_test: outer"});
+  const auto* const nested = FindPath(tree, {"tic_toc_test: outer", "tic_toc_test: inner"});
+  const auto* const top_level = FindPath(tree, {"tic_toc_test: inner"});
+  REQUIRE(outer != nullptr);
+  REQUIRE(nested != nullptr);
+  REQUIRE(top_level != nullptr);
+  CHECK(outer->Count() == 2);
+  CHECK(nested->Count() == 6);
+  CHECK(top_level->Count() == 1);
+  CHECK(nested->TotalTime() <= outer->TotalTime());
+
+  // Each path comes directly before the paths nested inside it
+  for (size_t i = 0; i < tree.size(); i++) {
+    if (tree[i].path == std::vector<std::string>{"tic_toc_test: outer"}) {
+      REQUIRE(i + 1 < tree.size());
+      CHECK(tree[i + 1].path ==
+            std::vector<std::string>{"tic_toc_test: outer", "tic_toc_test: inner"});
+    }
+  }
+
+  // The flat stats count every sample once, whatever its parent
+  CHECK(CountFor("tic_toc_test: inner") == 7);
+}
+
+TEST_CASE("Percentiles are only recorded when requested", "[tic_toc]") {
+  auto& manager = sym::internal::GetGlobalTicTocManager();
+  // Off by default, unless turned on by the environment
+  manager.SetRecordPercentiles(false);
+
+  {
+    SYM_TIME_SCOPE("tic_toc_test: without percentiles");
+  }
+  const auto tree_without_percentiles = manager.GetTimingTree();
+  const auto* stats = FindPath(tree_without_percentiles, {"tic_toc_test: without percentiles"});
+  REQUIRE(stats != nullptr);
+  CHECK(stats->Count() == 1);
+  CHECK(stats->Histogram().Count() == 0);
+
+  manager.SetRecordPercentiles(true);
+  {
+    SYM_TIME_SCOPE("tic_toc_test: with percentiles");
+  }
+  manager.SetRecordPercentiles(false);
+  const auto tree = manager.GetTimingTree();
+  stats = FindPath(tree, {"tic_toc_test: with percentiles"});
+  REQUIRE(stats != nullptr);
+  CHECK(stats->Histogram().Count() == 1);
+  CHECK(stats->Percentile(0.5) > 0);
+
+  std::ostringstream json_lines;
+  manager.WriteJsonLines(json_lines);
+  const std::string json_str = json_lines.str();
+  const auto line_with = [&json_str](const std::string& name) {
+    const size_t start = json_str.find(name);
+    return json_str.substr(start, json_str.find('\n', start) - start);
+  };
+  CHECK(line_with("tic_toc_test: without percentiles").find("p50") == std::string::npos);
+  CHECK(line_with("tic_toc_test: with percentiles").find("\"p50\": ") != std::string::npos);
+}
+
+TEST_CASE("Histogram percentiles are accurate to the bucket resolution", "[tic_toc]") {
+  using sym::internal::Duration;
+  using sym::internal::TicTocHistogram;
+
+  // Buckets are contiguous, and each bucket's lower bound maps back to it
+  for (int i = 0; i + 1 < TicTocHistogram::kNumBuckets; i++) {
+    CHECK(TicTocHistogram::BucketIndex(TicTocHistogram::BucketLowerBound(i)) == i);
+    CHECK(TicTocHistogram::BucketIndex(TicTocHistogram::BucketLowerBound(i + 1) - 1) == i);
+  }
+
+  sym::internal::TicTocStats stats;
+  for (int i = 1; i <= 1000; i++) {
+    stats.Update(std::chrono::microseconds(i));
+  }
+
+  const double resolution = 1.0 / (1 << TicTocHistogram::kSubBucketBits);
+  CHECK(stats.Percentile(0.5) == Catch::Approx(500e-6).epsilon(resolution));
+  CHECK(stats.Percentile(0.9) == Catch::Approx(900e-6).epsilon(resolution));
+  CHECK(stats.Percentile(0.99) == Catch::Approx(990e-6).epsilon(resolution));
+  CHECK(stats.Percentile(1.0) <= stats.MaxTime() * (1 + resolution));
+  CHECK(sym::internal::TicTocStats().Percentile(0.5) == 0);
+
+  // Merging histograms is the same as adding all samples to one
+  sym::internal::TicTocStats first_half;
+  sym::internal::TicTocStats second_half;
+  for (int i = 1; i <= 1000; i++) {
+    (i <= 500 ? first_half : second_half).Update(std::chrono::microseconds(i));
+  }
+  first_half.Merge(second_half);
+  CHECK(first_half.Count() == 1000);
+  CHECK(first_half.Percentile(0.9) == stats.Percentile(0.9));
+}
+
+TEST_CASE("Timing tree and trace can be exported", "[tic_toc]") {
+  auto& manager = sym::internal::GetGlobalTicTocManager();
+
+  std::ostringstream trace;
+  manager.StartTrace(trace);
+  CHECK(manager.IsTracing());
+  {
+    SYM_TIME_SCOPE("tic_toc_test: \"traced\"");
+    std::thread thread([]() { SYM_TIME_SCOPE("tic_toc_test: traced thread"); });
+    thread.join();
+  }
+  manager.StopTrace();
+  CHECK(!manager.IsTracing());
+
+  {
+    SYM_TIME_SCOPE("tic_toc_test: untraced");
+  }
+
+  const std::string trace_str = trace.str();
+  CHECK(trace_str.find("[\n") == 0);
+  CHECK(trace_str.find("\n]\n") == trace_str.size() - 3);
+  CHECK(trace_str.find("{\"name\": \"tic_toc_test: \\\"traced\\\"\", \"ph\": \"X\"") !=
+        std::string::npos);
+  CHECK(trace_str.find("\"tic_toc_test: traced thread\"") != std::string::npos);
+  CHECK(trace_str.find("untraced") == std::string::npos);
+
+  std::ostringstream json_lines;
+  manager.WriteJsonLines(json_lines);
+  CHECK(json_lines.str().find("{\"path\": [\"tic_toc_test: untraced\"], \"count\": 1, ") !=
+        std::string::npos);
+}
@@ -0,0 +1,216 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <symengine/basic.h>
+#include <symengine/add.h>
+#include <symengine/mul.h>
+#include <symengine/pow.h>
+#include <symengine/symbol.h>
+#include <symengine/integer.h>
+#include <symengine/functions.h>
+#include <symengine/parser.h>
+
+using SymEngine::Basic;
+using SymEngine::RCP;
+using SymEngine::Symbol;
+using SymEngine::vec_basic;
+using SymEngine::vec_pair;
+using SymEngine::add;
+using SymEngine::sub;
+using SymEngine::mul;
+using SymEngine::symbol;
+using SymEngine::integer;
+using SymEngine::sin;
+using SymEngine::cos;
+using SymEngine::sqrt;
+using SymEngine::zero;
+using SymEngine::rcp_static_cast;
+
+/*
+   Residuals of a bundle adjustment style problem, with the jacobians with
+   respect to the poses and the gauss-newton hessian and rhs blocks of every
+   factor.  This has the structure of the linearization functions symforce
+   generates: thousands of Adds and Muls sharing many pairs of args.
+*/
+vec_basic Linearization(int num_poses, int num_landmarks)
+{
+    vec_basic outputs;
+    for (int i = 0; i < num_poses; i++) {
+        const std::string pose = "pose" + std::to_string(i);
+        vec_basic q, t;
+        for (int k = 0; k < 4; k++) {
+            q.push_back(symbol(pose + "_q" + std::to_string(k)));
+        }
+        for (int k = 0; k < 3; k++) {
+            t.push_back(symbol(pose + "_t" + std::to_string(k)));
+        }
+        // Rotation matrix of the quaternion (q0, q1, q2) + q3
+        auto two = integer(2);
+        auto one = integer(1);
+        RCP<const Basic> R[3][3] = {
+            {sub(one, mul(two, add(mul(q[1], q[1]), mul(q[2], q[2])))),
+             mul(two, sub(mul(q[0], q[1]), mul(q[2], q[3]))),
+             mul(two, add(mul(q[0], q[2]), mul(q[1], q[3])))},
+            {mul(two, add(mul(q[0], q[1]), mul(q[2], q[3]))),
+             sub(one, mul(two, add(mul(q[0], q[0]), mul(q[2], q[2])))),
+             mul(two, sub(mul(q[1], q[2]), mul(q[0], q[3])))},
+            {mul(two, sub(mul(q[0], q[2]), mul(q[1], q[3]))),
+             mul(two, add(mul(q[1], q[2]), mul(q[0], q[3]))),
+             sub(one, mul(two, add(mul(q[0], q[0]), mul(q[1], q[1]))))}};
+
+        vec_basic pose_vars(q);
+        pose_vars.insert(pose_vars.end(), t.begin(), t.end());
+
+        for (int j = 0; j < num_landmarks; j++) {
+            const std::string landmark = "landmark" + std::to_string(j);
+            vec_basic residual;
+            for (int r = 0; r < 3; r++) {
+                RCP<const Basic> p = t[r];
+                for (int c = 0; c < 3; c++) {
+                    p = add(p, mul(R[r][c], symbol(landmark + "_"
+                                                   + std::to_string(c))));
+                }
+                residual.push_back(
+                    sub(p, symbol(pose + "_" + landmark + "_obs"
+                                  + std::to_string(r))));
+            }
+            // Range residual, for some non-polynomial terms
+            residual.push_back(sqrt(add(
+                {mul(residual[0], residual[0]), mul(residual[1], residual[1]),
+                 mul(residual[2], residual[2])})));
+
+            std::vector<vec_basic> jacobian(residual.size());
+            for (unsigned r = 0; r < residual.size(); r++) {
+                outputs.push_back(residual[r]);
+                for (auto &var : pose_vars) {
+                    jacobian[r].push_back(residual[r]->diff(
+                        rcp_static_cast<const Symbol>(var)));
+                    outputs.push_back(jacobian[r].back());
+                }
+            }
+            for (unsigned a = 0; a < pose_vars.size(); a++) {
+                RCP<const Basic> rhs = zero;
+                for (unsigned r = 0; r < residual.size(); r++) {
+                    rhs = add(rhs, mul(jacobian[r][a], residual[r]));
+                }
+                outputs.push_back(rhs);
+                for (unsigned b = 0; b <= a; b++) {
+                    RCP<const Basic> hessian = zero;
+                    for (unsigned r = 0; r < residual.size(); r++) {
+                        hessian = add(hessian,
+                                      mul(jacobian[r][a], jacobian[r][b]));
+                    }
+                    outputs.push_back(hessian);
+                }
+            }
+        }
+    }
+    return outputs;
+}
+
+/*
+   A^T * b for a random sparse A, whose nonzeros are small expressions in a
+   few symbols, like the compute_at_b matrix multiplication benchmarks in
+   symforce
+*/
+vec_basic SparseAtB(int size, int nonzeros_per_row)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> col_dist(0, size - 1);
+    std::uniform_int_distribution<int> symbol_dist(0, 4);
+    std::uniform_int_distribution<int> op_dist(0, 3);
+
+    vec_basic x;
+    for (int k = 0; k < 5; k++) {
+        x.push_back(symbol("x" + std::to_string(k)));
+    }
+    auto random_entry = [&]() -> RCP<const Basic> {
+        auto a = x[symbol_dist(rng)];
+        auto b = x[symbol_dist(rng)];
+        switch (op_dist(rng)) {
+            case 0:
+                return add(a, b);
+            case 1:
+                return mul(a, b);
+            case 2:
+                return sin(mul(a, b));
+            default:
+                return sub(cos(a), b);
+        }
+    };
+
+    vec_basic b;
+    for (int row = 0; row < size; row++) {
+        b.push_back(random_entry());
+    }
+
+    vec_basic at_b(size, zero);
+    for (int row = 0; row < size; row++) {
+        for (int k = 0; k < nonzeros_per_row; k++) {
+            const int col = col_dist(rng);
+            at_b[col] = add(at_b[col], mul(random_entry(), b[row]));
+        }
+    }
+    return at_b;
+}
+
+/*
+   Expressions parsed from a file, one per line, e.g. the outputs of a
+   symforce function printed from python
+*/
+vec_basic FromFile(const std::string &filename)
+{
+    vec_basic outputs;
+    std::ifstream file(filename);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (not line.empty()) {
+            outputs.push_back(SymEngine::parse(line));
+        }
+    }
+    return outputs;
+}
+
+void TimeCse(const std::string &name, const vec_basic &exprs)
+{
+    vec_pair replacements;
+    vec_basic reduced;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    SymEngine::cse(replacements, reduced, exprs);
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::setw(8) << exprs.size() << " outputs " << std::setw(8)
+              << replacements.size() << " temporaries " << std::setw(12)
+              << std::setprecision(6) << std::fixed
+              << std::chrono::duration<double>(t2 - t1).count() << " s"
+              << std::endl;
+}
+
+/*
+   Usage: cse [file with one expression per line]...
+*/
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            TimeCse(argv[i], FromFile(argv[i]));
+        }
+        return 0;
+    }
+
+    TimeCse("linearization 2x4", Linearization(2, 4));
+    TimeCse("linearization 5x10", Linearization(5, 10));
+    TimeCse("linearization 10x30", Linearization(10, 30));
+    TimeCse("sparse A^T b 200x200", SparseAtB(200, 5));
+    TimeCse("sparse A^T b 2000x2000", SparseAtB(2000, 5));
+
+    return 0;
+}
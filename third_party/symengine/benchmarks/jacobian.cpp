@@ -0,0 +1,93 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <symengine/basic.h>
+#include <symengine/add.h>
+#include <symengine/mul.h>
+#include <symengine/symbol.h>
+#include <symengine/integer.h>
+#include <symengine/pow.h>
+#include <symengine/functions.h>
+#include <symengine/derivative.h>
+
+using SymEngine::Basic;
+using SymEngine::RCP;
+using SymEngine::vec_basic;
+using SymEngine::vec_sym;
+using SymEngine::add;
+using SymEngine::integer;
+using SymEngine::mul;
+using SymEngine::symbol;
+using SymEngine::sin;
+using SymEngine::exp;
+
+/*
+   A sum of pairwise terms over a chain of variables, like the cost of a
+   smoothness prior, scaled by a function of all of them.  Every output
+   depends on every variable, and on the same shared subexpressions.
+*/
+void Chain(unsigned num_vars, unsigned num_exprs, vec_basic &exprs,
+           vec_sym &xs)
+{
+    for (unsigned i = 0; i < num_vars; i++) {
+        xs.push_back(symbol("x" + std::to_string(i)));
+    }
+    vec_basic pairs, squares;
+    for (unsigned i = 0; i + 1 < num_vars; i++) {
+        pairs.push_back(sin(mul(xs[i], xs[i + 1])));
+        squares.push_back(mul(xs[i], xs[i]));
+    }
+    RCP<const Basic> scale = exp(mul(SymEngine::minus_one, add(squares)));
+    for (unsigned k = 0; k < num_exprs; k++) {
+        vec_basic terms;
+        for (unsigned i = 0; i < pairs.size(); i++) {
+            terms.push_back(mul(integer((i + k) % 7 + 1), pairs[i]));
+        }
+        exprs.push_back(mul(scale, add(terms)));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned num_vars = 120;
+    if (argc > 1) {
+        num_vars = std::stoi(argv[1]);
+    }
+
+    vec_basic exprs;
+    vec_sym xs;
+    Chain(num_vars, 10, exprs, xs);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    vec_basic jacobian;
+    for (auto &expr : exprs) {
+        for (auto &x : xs) {
+            jacobian.push_back(expr->diff(x));
+        }
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    vec_basic jacobian2 = SymEngine::diff(exprs, xs);
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    for (unsigned i = 0; i < jacobian.size(); i++) {
+        if (neq(*jacobian[i], *jacobian2[i])) {
+            std::cout << "Mismatch at " << i << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << exprs.size() << " x " << xs.size() << " jacobian"
+              << std::endl;
+    std::cout << "diff for each entry : \t " << std::setw(15)
+              << std::setprecision(9) << std::fixed
+              << std::chrono::duration<double>(t2 - t1).count() << std::endl;
+    std::cout << "diff for all entries : \t " << std::setw(15)
+              << std::setprecision(9) << std::fixed
+              << std::chrono::duration<double>(t3 - t2).count() << std::endl;
+
+    return 0;
+}
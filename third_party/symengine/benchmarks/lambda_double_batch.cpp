@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <symengine/basic.h>
+#include <symengine/add.h>
+#include <symengine/mul.h>
+#include <symengine/symbol.h>
+#include <symengine/integer.h>
+#include <symengine/pow.h>
+#include <symengine/functions.h>
+#include <symengine/lambda_double.h>
+#include <symengine/lambda_double_batch.h>
+
+using SymEngine::Basic;
+using SymEngine::RCP;
+using SymEngine::vec_basic;
+using SymEngine::add;
+using SymEngine::sub;
+using SymEngine::integer;
+using SymEngine::mul;
+using SymEngine::pow;
+using SymEngine::symbol;
+using SymEngine::sin;
+using SymEngine::cos;
+using SymEngine::sqrt;
+
+/*
+   A point rotated by a rotation vector and projected by a pinhole camera,
+   evaluated at many rotations and points, like a residual of a bundle
+   adjustment problem evaluated for every observation
+*/
+void Projection(vec_basic &inputs, vec_basic &outputs)
+{
+    vec_basic w, p;
+    for (int k = 0; k < 3; k++) {
+        w.push_back(symbol("w" + std::to_string(k)));
+        p.push_back(symbol("p" + std::to_string(k)));
+    }
+    inputs = w;
+    inputs.insert(inputs.end(), p.begin(), p.end());
+
+    auto theta = sqrt(add({mul(w[0], w[0]), mul(w[1], w[1]), mul(w[2], w[2]),
+                           integer(1)}));
+    auto a = div(sin(theta), theta);
+    auto b = div(sub(integer(1), cos(theta)), mul(theta, theta));
+    // Rodrigues' formula, p + a (w x p) + b w x (w x p)
+    vec_basic cross = {sub(mul(w[1], p[2]), mul(w[2], p[1])),
+                       sub(mul(w[2], p[0]), mul(w[0], p[2])),
+                       sub(mul(w[0], p[1]), mul(w[1], p[0]))};
+    vec_basic cross2 = {sub(mul(w[1], cross[2]), mul(w[2], cross[1])),
+                        sub(mul(w[2], cross[0]), mul(w[0], cross[2])),
+                        sub(mul(w[0], cross[1]), mul(w[1], cross[0]))};
+    vec_basic q;
+    for (int k = 0; k < 3; k++) {
+        q.push_back(add({p[k], mul(a, cross[k]), mul(b, cross2[k])}));
+    }
+    outputs = {div(q[0], q[2]), div(q[1], q[2])};
+}
+
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    size_t n = 1000000;
+    if (argc > 1) {
+        n = std::stoul(argv[1]);
+    }
+
+    vec_basic inputs, outputs;
+    Projection(inputs, outputs);
+
+    std::vector<double> inps(n * inputs.size());
+    for (size_t i = 0; i < inps.size(); i++) {
+        inps[i] = std::sin(0.1 * i) + (i % inputs.size() == 5 ? 5.0 : 0.0);
+    }
+    std::vector<double> outs(n * outputs.size()), outs2(outs.size());
+
+    SymEngine::LambdaRealDoubleVisitor v;
+    v.init(inputs, outputs, true);
+    SymEngine::LambdaRealDoubleBatchVisitor v_batch;
+    v_batch.init(inputs, outputs, true);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        v.call(&outs[i * outputs.size()], &inps[i * inputs.size()]);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    v_batch.call(outs2.data(), inps.data(), n);
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < outs.size(); i++) {
+        if (std::abs(outs[i] - outs2[i]) > 1e-12 * (1 + std::abs(outs[i]))) {
+            std::cout << "Mismatch at " << i << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << n << " points, " << v_batch.get_instructions().size()
+              << " instructions, " << v_batch.get_num_registers()
+              << " registers" << std::endl;
+    std::cout << "LambdaRealDoubleVisitor : \t " << std::setw(15)
+              << std::setprecision(9) << std::fixed
+              << std::chrono::duration<double>(t2 - t1).count() << std::endl;
+    std::cout << "LambdaRealDoubleBatchVisitor : \t " << std::setw(15)
+              << std::setprecision(9) << std::fixed
+              << std::chrono::duration<double>(t3 - t2).count() << std::endl;
+
+    return 0;
+}
@@ -4,7 +4,7 @@
 #include <symengine/functions.h>
 #include <symengine/visitor.h>
 
-#include <queue>
+#include <algorithm>
 
 namespace SymEngine
 {
@@ -12,6 +12,17 @@ umap_basic_basic opt_cse(const vec_basic &exprs);
 void tree_cse(vec_pair &replacements, vec_basic &reduced_exprs,
               const vec_basic &exprs, umap_basic_basic &opt_subs);
 
+/*
+   Tracks which args each func (Add or Mul) has, and which funcs each arg
+   appears in, by value number.
+
+   The sets are sorted std::vectors rather than std::sets.  They're built
+   once and mostly iterated and intersected, which is much faster on
+   contiguous memory, and the occasional insert or erase is a short memmove.
+   Funcs are processed in order, and funcs before the current one are never
+   looked up again, so instead of erasing them from every funcset lookups
+   skip past them with a binary search.
+*/
 class FuncArgTracker
 {
 
@@ -19,22 +30,35 @@ public:
     std::unordered_map<RCP<const Basic>, unsigned, RCPBasicHash, RCPBasicKeyEq>
         value_numbers;
     vec_basic value_number_to_value;
-    std::vector<std::set<unsigned>> arg_to_funcset;
-    std::vector<std::set<unsigned>> func_to_argset;
+    std::vector<std::vector<unsigned>> arg_to_funcset;
+    std::vector<std::vector<unsigned>> func_to_argset;
+
+private:
+    // Scratch space for get_common_arg_candidates, indexed by func number.
+    // All zero between calls.
+    std::vector<unsigned> common_arg_counts;
+    std::vector<unsigned> counted_funcs;
 
 public:
     FuncArgTracker(
         const std::vector<std::pair<RCP<const Basic>, vec_basic>> &funcs)
+        : common_arg_counts(funcs.size(), 0)
     {
-        arg_to_funcset.resize(funcs.size());
+        func_to_argset.reserve(funcs.size());
         for (unsigned func_i = 0; func_i < funcs.size(); func_i++) {
-            std::set<unsigned> func_argset;
+            std::vector<unsigned> func_argset;
             for (auto &func_arg : funcs[func_i].second) {
-                unsigned arg_number = get_or_add_value_number(func_arg);
-                func_argset.insert(arg_number);
-                arg_to_funcset[arg_number].insert(func_i);
+                func_argset.push_back(get_or_add_value_number(func_arg));
             }
-            func_to_argset.push_back(func_argset);
+            std::sort(func_argset.begin(), func_argset.end());
+            func_argset.erase(
+                std::unique(func_argset.begin(), func_argset.end()),
+                func_argset.end());
+            // func_i only increases, so every funcset stays sorted
+            for (unsigned arg_number : func_argset) {
+                arg_to_funcset[arg_number].push_back(func_i);
+            }
+            func_to_argset.push_back(std::move(func_argset));
         }
     }
 
@@ -55,100 +79,75 @@ public:
         bool inserted = ret.second;
         if (inserted) {
             value_number_to_value.push_back(value);
-            arg_to_funcset.push_back(std::set<unsigned>());
+            arg_to_funcset.push_back(std::vector<unsigned>());
             return nvalues;
         } else {
             return ret.first->second;
         }
     }
 
-    void stop_arg_tracking(unsigned func_i)
-    {
-        for (unsigned arg : func_to_argset[func_i]) {
-            arg_to_funcset[arg].erase(func_i);
-        }
-    }
-
     /*
-       Return a dict whose keys are function numbers. The entries of the dict
-       are the number of arguments said function has in common with `argset`.
-       Entries have at least 2 items in common.
+       Return the funcs numbered at least `min_func_i` which have at least 2
+       args in common with `argset`, sorted by the number of args in common
+       and then by func number.
+
+       The counts are accumulated in a flat array indexed by func number, in
+       one pass over the funcset of each arg, so this is linear in the total
+       size of those funcsets.
     */
-    std::map<unsigned, unsigned>
-    get_common_arg_candidates(std::set<unsigned> &argset, unsigned min_func_i)
+    std::vector<unsigned>
+    get_common_arg_candidates(const std::vector<unsigned> &argset,
+                              unsigned min_func_i)
     {
-        std::map<unsigned, unsigned> count_map;
-        std::vector<std::set<unsigned>> funcsets;
         for (unsigned arg : argset) {
-            funcsets.push_back(arg_to_funcset[arg]);
-        }
-        // Sorted by size to make best use of the performance hack below.
-        std::sort(funcsets.begin(), funcsets.end(),
-                  [](const std::set<unsigned> &a, const std::set<unsigned> &b) {
-                      return a.size() < b.size();
-                  });
-
-        for (unsigned i = 0; i < funcsets.size(); i++) {
-            auto &funcset = funcsets[i];
-            for (unsigned func_i : funcset) {
-                if (func_i >= min_func_i) {
-                    count_map[func_i] += 1;
+            const auto &funcset = arg_to_funcset[arg];
+            for (auto it = std::lower_bound(funcset.begin(), funcset.end(),
+                                            min_func_i);
+                 it != funcset.end(); ++it) {
+                if (common_arg_counts[*it]++ == 0) {
+                    counted_funcs.push_back(*it);
                 }
             }
         }
 
-        /*auto &largest_funcset = funcsets[funcsets.size() - 1];
+        std::vector<std::pair<unsigned, unsigned>> counts_and_funcs;
+        for (unsigned func_i : counted_funcs) {
+            if (common_arg_counts[func_i] >= 2) {
+                counts_and_funcs.push_back(
+                    std::make_pair(common_arg_counts[func_i], func_i));
+            }
+            common_arg_counts[func_i] = 0;
+        }
+        counted_funcs.clear();
 
-        // We pick the smaller of the two containers to iterate over to
-        // reduce the number of items we have to look at.
+        std::sort(counts_and_funcs.begin(), counts_and_funcs.end());
 
-        if (largest_funcset.size() < count_map.size()) {
-            for (unsigned func_i : largest_funcset) {
-                if (count_map[func_i] < 1) {
-                    continue;
-                }
-                if (count_map.find(func_i) != count_map.end()) {
-                    count_map[func_i] += 1;
-                }
-            }
-        } else {
-            for (auto &count_map_pair : count_map) {
-                unsigned func_i = count_map_pair.first;
-                if (count_map[func_i] < 1) {
-                    continue;
-                }
-                if (largest_funcset.find(func_i) != largest_funcset.end()) {
-                    count_map[func_i] += 1;
-                }
-            }
-        }*/
-        auto iter = count_map.begin();
-        for (; iter != count_map.end();) {
-            if (iter->second >= 2) {
-                ++iter;
-            } else {
-                count_map.erase(iter++);
-            }
+        std::vector<unsigned> candidates;
+        candidates.reserve(counts_and_funcs.size());
+        for (auto &count_and_func : counts_and_funcs) {
+            candidates.push_back(count_and_func.second);
         }
-        return count_map;
+        return candidates;
     }
 
-    template <typename Container1, typename Container2>
-    std::vector<unsigned>
-    get_subset_candidates(const Container1 &argset,
-                          const Container2 &restrict_to_funcset)
+    template <typename Container1, typename Iterator>
+    std::vector<unsigned> get_subset_candidates(const Container1 &argset,
+                                                Iterator restrict_begin,
+                                                Iterator restrict_end)
     {
-        std::vector<unsigned> indices;
-        for (auto f : restrict_to_funcset) {
-            indices.push_back(f);
-        }
+        std::vector<unsigned> indices(restrict_begin, restrict_end);
         std::sort(std::begin(indices), std::end(indices));
         std::vector<unsigned> intersect_result;
         for (const auto &arg : argset) {
-            std::set_intersection(indices.begin(), indices.end(),
-                                  arg_to_funcset[arg].begin(),
-                                  arg_to_funcset[arg].end(),
-                                  std::back_inserter(intersect_result));
+            if (indices.empty()) {
+                break;
+            }
+            const auto &funcset = arg_to_funcset[arg];
+            std::set_intersection(
+                indices.begin(), indices.end(),
+                std::lower_bound(funcset.begin(), funcset.end(),
+                                 indices.front()),
+                funcset.end(), std::back_inserter(intersect_result));
             intersect_result.swap(indices);
             intersect_result.clear();
         }
@@ -161,41 +160,49 @@ public:
         // Update a function with a new set of arguments.
         auto &old_args = func_to_argset[func_i];
 
-        std::set<unsigned> diff;
+        std::vector<unsigned> diff;
         std::set_difference(old_args.begin(), old_args.end(), new_args.begin(),
-                            new_args.end(), std::inserter(diff, diff.begin()));
+                            new_args.end(), std::back_inserter(diff));
 
         for (auto &deleted_arg : diff) {
-            arg_to_funcset[deleted_arg].erase(func_i);
+            auto &funcset = arg_to_funcset[deleted_arg];
+            auto it = std::lower_bound(funcset.begin(), funcset.end(), func_i);
+            if (it != funcset.end() and *it == func_i) {
+                funcset.erase(it);
+            }
         }
 
         diff.clear();
         std::set_difference(new_args.begin(), new_args.end(), old_args.begin(),
-                            old_args.end(), std::inserter(diff, diff.begin()));
+                            old_args.end(), std::back_inserter(diff));
 
         for (auto &added_arg : diff) {
-            arg_to_funcset[added_arg].insert(func_i);
+            auto &funcset = arg_to_funcset[added_arg];
+            auto it = std::lower_bound(funcset.begin(), funcset.end(), func_i);
+            if (it == funcset.end() or *it != func_i) {
+                funcset.insert(it, func_i);
+            }
         }
 
-        func_to_argset[func_i].clear();
-        func_to_argset[func_i].insert(new_args.begin(), new_args.end());
+        old_args = new_args;
     }
 };
 
-std::vector<unsigned> set_diff(const std::set<unsigned> &a,
+std::vector<unsigned> set_diff(const std::vector<unsigned> &a,
                                const std::vector<unsigned> &b)
 {
     std::vector<unsigned> diff;
     std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
-                        std::inserter(diff, diff.begin()));
+                        std::back_inserter(diff));
     return diff;
 }
 
 void add_to_sorted_vec(std::vector<unsigned> &vec, unsigned number)
 {
-    if (std::find(vec.begin(), vec.end(), number) == vec.end()) {
+    auto it = std::lower_bound(vec.begin(), vec.end(), number);
+    if (it == vec.end() or *it != number) {
         // Add number if not found
-        vec.insert(std::upper_bound(vec.begin(), vec.end(), number), number);
+        vec.insert(it, number);
     }
 }
 
@@ -214,34 +221,19 @@ void match_common_args(const std::string &func_class, const vec_basic &funcs_,
 
     auto arg_tracker = FuncArgTracker(funcs);
 
-    std::set<unsigned> changed;
-    std::map<unsigned, unsigned> common_arg_candidates_counts;
+    std::vector<bool> changed(funcs.size(), false);
 
     for (unsigned i = 0; i < funcs.size(); i++) {
-        common_arg_candidates_counts = arg_tracker.get_common_arg_candidates(
-            arg_tracker.func_to_argset[i], i + 1);
-
-        std::deque<unsigned> common_arg_candidates;
-        for (auto it = common_arg_candidates_counts.begin();
-             it != common_arg_candidates_counts.end(); ++it) {
-            common_arg_candidates.push_back(it->first);
-        }
-
-        // Sort the candidates in order of match size.
-        // This makes us try combining smaller matches first.
-        std::sort(common_arg_candidates.begin(), common_arg_candidates.end(),
-                  [&](unsigned a, unsigned b) {
-                      if (common_arg_candidates_counts[a]
-                          == common_arg_candidates_counts[b]) {
-                          return a < b;
-                      }
-                      return common_arg_candidates_counts[a]
-                             < common_arg_candidates_counts[b];
-                  });
-
-        while (common_arg_candidates.size() > 0) {
-            unsigned j = common_arg_candidates.front();
-            common_arg_candidates.pop_front();
+        // Sorted in order of match size.  This makes us try combining
+        // smaller matches first.
+        const std::vector<unsigned> common_arg_candidates
+            = arg_tracker.get_common_arg_candidates(
+                arg_tracker.func_to_argset[i], i + 1);
+
+        for (auto candidate = common_arg_candidates.begin();
+             candidate != common_arg_candidates.end();) {
+            unsigned j = *candidate;
+            ++candidate;
             std::vector<unsigned> com_args;
 
             std::set_intersection(arg_tracker.func_to_argset[i].begin(),
@@ -269,7 +261,7 @@ void match_common_args(const std::string &func_class, const vec_basic &funcs_,
                 com_func_number = arg_tracker.get_or_add_value_number(com_func);
                 add_to_sorted_vec(diff_i, com_func_number);
                 arg_tracker.update_func_argset(i, diff_i);
-                changed.insert(i);
+                changed[i] = true;
 
             } else {
                 // Treat the whole expression as a CSE.
@@ -288,23 +280,22 @@ void match_common_args(const std::string &func_class, const vec_basic &funcs_,
                 = set_diff(arg_tracker.func_to_argset[j], com_args);
             add_to_sorted_vec(diff_j, com_func_number);
             arg_tracker.update_func_argset(j, diff_j);
-            changed.insert(j);
+            changed[j] = true;
 
             for (unsigned k : arg_tracker.get_subset_candidates(
-                     com_args, common_arg_candidates)) {
+                     com_args, candidate, common_arg_candidates.end())) {
                 std::vector<unsigned> diff_k
                     = set_diff(arg_tracker.func_to_argset[k], com_args);
                 add_to_sorted_vec(diff_k, com_func_number);
                 arg_tracker.update_func_argset(k, diff_k);
-                changed.insert(k);
+                changed[k] = true;
             }
         }
-        if (changed.find(i) != changed.end()) {
+        if (changed[i]) {
             opt_subs[funcs[i].first] = function_symbol(
                 func_class, arg_tracker.get_args_in_value_order(
                                 arg_tracker.func_to_argset[i]));
         }
-        arg_tracker.stop_arg_tracking(i);
     }
 }
 
@@ -314,7 +305,8 @@ public:
     umap_basic_basic &opt_subs;
     set_basic adds;
     set_basic muls;
-    set_basic seen_subexp;
+    // Only used for lookups, so hashed rather than ordered
+    uset_basic seen_subexp;
     OptsCSEVisitor(umap_basic_basic &opt_subs_) : opt_subs(opt_subs_)
     {
     }
@@ -424,8 +416,8 @@ class RebuildVisitor : public BaseVisitor<RebuildVisitor, TransformVisitor>
 private:
     umap_basic_basic &subs;
     umap_basic_basic &opt_subs;
-    set_basic &to_eliminate;
-    set_basic &excluded_symbols;
+    uset_basic &to_eliminate;
+    uset_basic &excluded_symbols;
     vec_pair &replacements;
     std::function<RCP<const Symbol>()> symbols;
 
@@ -433,7 +425,7 @@ public:
     using TransformVisitor::result_;
     using TransformVisitor::bvisit;
     RebuildVisitor(umap_basic_basic &subs_, umap_basic_basic &opt_subs_,
-                   set_basic &to_eliminate_, set_basic &excluded_symbols_,
+                   uset_basic &to_eliminate_, uset_basic &excluded_symbols_,
                    vec_pair &replacements_,
                    const std::function<RCP<const Symbol>()> &symbols_)
         : subs(subs_), opt_subs(opt_subs_), to_eliminate(to_eliminate_),
@@ -499,9 +491,10 @@ void tree_cse(vec_pair &replacements, vec_basic &reduced_exprs,
               const vec_basic &exprs, umap_basic_basic &opt_subs,
               const std::function<RCP<const Symbol>()> &symbols)
 {
-    set_basic to_eliminate;
-    set_basic seen_subexp;
-    set_basic excluded_symbols;
+    // Only used for lookups, so hashed rather than ordered
+    uset_basic to_eliminate;
+    uset_basic seen_subexp;
+    uset_basic excluded_symbols;
 
     std::function<void(RCP<const Basic> & expr)> find_repeated;
     find_repeated = [&](RCP<const Basic> expr) -> void {
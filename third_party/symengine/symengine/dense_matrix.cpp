@@ -1,6 +1,7 @@
 #include <symengine/matrix.h>
 #include <symengine/number.h>
 #include <symengine/add.h>
+#include <symengine/derivative.h>
 #include <symengine/functions.h>
 #include <symengine/pow.h>
 #include <symengine/subs.h>
@@ -515,12 +516,43 @@ void DenseMatrix::cholesky(MatrixBase &L) const
 
 // ---------------------------- Jacobian -------------------------------------//
 
+// Differentiates w.r.t. all of x at once, which shares the derivatives of
+// subexpressions between the rows.  Returns false if x is not all Symbols.
+static bool jacobian_wrt_symbols(const DenseMatrix &A, const DenseMatrix &x,
+                                 DenseMatrix &result)
+{
+    vec_sym syms;
+    syms.reserve(x.nrows());
+    for (unsigned j = 0; j < x.nrows(); j++) {
+        RCP<const Basic> dx = x.get(j, 0);
+        if (not is_a<Symbol>(*dx)) {
+            return false;
+        }
+        syms.push_back(rcp_static_cast<const Symbol>(dx));
+    }
+    vec_basic exprs;
+    exprs.reserve(A.nrows());
+    for (unsigned i = 0; i < A.nrows(); i++) {
+        exprs.push_back(A.get(i, 0));
+    }
+    vec_basic derivatives = diff(exprs, syms);
+    for (unsigned i = 0; i < A.nrows(); i++) {
+        for (unsigned j = 0; j < x.nrows(); j++) {
+            result.set(i, j, derivatives[i * x.nrows() + j]);
+        }
+    }
+    return true;
+}
+
 void jacobian(const DenseMatrix &A, const DenseMatrix &x, DenseMatrix &result,
               bool diff_cache)
 {
     SYMENGINE_ASSERT(A.col_ == 1);
     SYMENGINE_ASSERT(x.col_ == 1);
     SYMENGINE_ASSERT(A.row_ == result.nrows() and x.row_ == result.ncols());
+    if (diff_cache and jacobian_wrt_symbols(A, x, result)) {
+        return;
+    }
     bool error = false;
 #pragma omp parallel for
     for (unsigned i = 0; i < result.row_; i++) {
@@ -548,6 +580,9 @@ void sjacobian(const DenseMatrix &A, const DenseMatrix &x, DenseMatrix &result,
     SYMENGINE_ASSERT(A.col_ == 1);
     SYMENGINE_ASSERT(x.col_ == 1);
     SYMENGINE_ASSERT(A.row_ == result.nrows() and x.row_ == result.ncols());
+    if (diff_cache and jacobian_wrt_symbols(A, x, result)) {
+        return;
+    }
 #pragma omp parallel for
     for (unsigned i = 0; i < result.row_; i++) {
         for (unsigned j = 0; j < result.col_; j++) {
@@ -813,6 +813,10 @@ const RCP<const Basic> &DiffVisitor::apply(const Basic &b)
 
 const RCP<const Basic> &DiffVisitor::apply(const RCP<const Basic> &b)
 {
+    if (is_independent(b)) {
+        result_ = zero;
+        return result_;
+    }
     if (not cache) {
         b->accept(*this);
         return result_;
@@ -827,6 +831,175 @@ const RCP<const Basic> &DiffVisitor::apply(const RCP<const Basic> &b)
     return result_;
 }
 
+// Whether DiffVisitor gives a zero derivative for `b` if none of its
+// subexpressions depend on the variable.  Not true of e.g. UnevaluatedExpr,
+// whose derivative is always unevaluated, or of Boolean, which throws.
+static bool is_zero_if_independent(const Basic &b)
+{
+    return is_a_Number(b) or is_a<Constant>(b) or is_a_sub<Symbol>(b)
+           or is_a<Add>(b) or is_a<Mul>(b) or is_a<Pow>(b)
+           or (is_a_sub<Function>(b) and not is_a<UnevaluatedExpr>(b)
+               and not is_a_sub<FunctionWrapper>(b));
+}
+
+// The subexpressions of `b` that DiffVisitor differentiates, or a superset of
+// them.  For Add and Mul these are the terms and factors in the dict, rather
+// than the get_args() which are new expressions built from them.
+static void get_diff_args(const Basic &b, vec_basic &args)
+{
+    args.clear();
+    if (is_a<Add>(b)) {
+        for (auto &p : down_cast<const Add &>(b).get_dict()) {
+            args.push_back(p.first);
+        }
+    } else if (is_a<Mul>(b)) {
+        for (auto &p : down_cast<const Mul &>(b).get_dict()) {
+            args.push_back(p.first);
+            args.push_back(p.second);
+        }
+    } else {
+        args = b.get_args();
+    }
+}
+
+namespace
+{
+
+// The variables each subexpression depends on, as sorted indices into the
+// list of variables, and the order the subexpressions were first seen in,
+// with each one after its args.
+class DiffDependencies
+{
+private:
+    // DiffVisitor compares symbols by name
+    std::unordered_map<std::string, std::vector<unsigned>> indices_;
+    std::unordered_map<RCP<const Basic>, std::vector<unsigned>, RCPBasicHash,
+                       RCPBasicKeyEq>
+        deps_;
+    vec_basic order_;
+
+public:
+    DiffDependencies(const vec_sym &xs)
+    {
+        for (unsigned i = 0; i < xs.size(); i++) {
+            indices_[xs[i]->get_name()].push_back(i);
+        }
+    }
+
+    const std::vector<unsigned> &get(const RCP<const Basic> &b)
+    {
+        auto it = deps_.find(b);
+        if (it != deps_.end()) {
+            return it->second;
+        }
+
+        // Post-order traversal with an explicit stack, since expressions can
+        // be too deep to recurse into
+        std::vector<std::pair<RCP<const Basic>, bool>> stack = {{b, false}};
+        vec_basic args;
+        std::vector<unsigned> merged;
+        while (not stack.empty()) {
+            RCP<const Basic> node = stack.back().first;
+            bool args_done = stack.back().second;
+            stack.pop_back();
+            if (deps_.find(node) != deps_.end()) {
+                continue;
+            }
+            get_diff_args(*node, args);
+            if (not args_done) {
+                stack.push_back({node, true});
+                for (auto &arg : args) {
+                    if (deps_.find(arg) == deps_.end()) {
+                        stack.push_back({arg, false});
+                    }
+                }
+                continue;
+            }
+
+            std::vector<unsigned> node_deps;
+            if (is_a_sub<Symbol>(*node)) {
+                auto index = indices_.find(
+                    down_cast<const Symbol &>(*node).get_name());
+                if (index != indices_.end()) {
+                    node_deps = index->second;
+                }
+            }
+            for (auto &arg : args) {
+                const std::vector<unsigned> &arg_deps = deps_.at(arg);
+                merged.clear();
+                std::set_union(node_deps.begin(), node_deps.end(),
+                               arg_deps.begin(), arg_deps.end(),
+                               std::back_inserter(merged));
+                node_deps.swap(merged);
+            }
+            order_.push_back(node);
+            deps_.insert({node, std::move(node_deps)});
+        }
+        return deps_.at(b);
+    }
+
+    bool depends_on(const RCP<const Basic> &b, unsigned index)
+    {
+        const std::vector<unsigned> &b_deps = get(b);
+        return std::binary_search(b_deps.begin(), b_deps.end(), index);
+    }
+
+    const vec_basic &get_order() const
+    {
+        return order_;
+    }
+};
+
+// Differentiates w.r.t. one of the variables of a DiffDependencies, skipping
+// the subexpressions that do not depend on it
+class JacobianDiffVisitor : public DiffVisitor
+{
+private:
+    DiffDependencies &deps_;
+    unsigned index_;
+
+protected:
+    bool is_independent(const RCP<const Basic> &b) override
+    {
+        return is_zero_if_independent(*b) and not deps_.depends_on(b, index_);
+    }
+
+public:
+    JacobianDiffVisitor(const RCP<const Symbol> &x, unsigned index,
+                        DiffDependencies &deps)
+        : DiffVisitor(x), deps_(deps), index_(index)
+    {
+    }
+};
+
+} // namespace
+
+vec_basic diff(const vec_basic &exprs, const vec_sym &xs)
+{
+    DiffDependencies deps(xs);
+    for (auto &expr : exprs) {
+        deps.get(expr);
+    }
+    // Copied, since the visitors add the subexpressions they build
+    const vec_basic order = deps.get_order();
+
+    vec_basic result(exprs.size() * xs.size());
+    for (unsigned j = 0; j < xs.size(); j++) {
+        JacobianDiffVisitor visitor(xs[j], j, deps);
+        // Differentiate the subexpressions bottom up, so that each one only
+        // recurses until it reaches the already cached derivatives of its args
+        for (auto &node : order) {
+            if (is_zero_if_independent(*node) and deps.depends_on(node, j)) {
+                visitor.apply(node);
+            }
+        }
+        for (unsigned i = 0; i < exprs.size(); i++) {
+            result[i * xs.size() + j] = visitor.apply(exprs[i]);
+        }
+    }
+    return result;
+}
+
 RCP<const Basic> diff(const RCP<const Basic> &arg, const RCP<const Symbol> &x,
                       bool cache)
 {
@@ -21,6 +21,14 @@ RCP<const Basic> diff(const RCP<const Basic> &arg, const RCP<const Symbol> &x,
 RCP<const Basic> sdiff(const RCP<const Basic> &arg, const RCP<const Basic> &x,
                        bool cache = true);
 
+//! Derivatives of each of `exprs` w.r.t. each of `xs`, in row major order,
+//! i.e. d(exprs[i])/d(xs[j]) is at index `i * xs.size() + j`.
+//! Gives the same result as calling diff for each pair, but the derivatives
+//! of shared subexpressions are computed once per variable, subexpressions
+//! which do not depend on a variable are skipped, and deep expressions are
+//! walked with an explicit stack.
+vec_basic diff(const vec_basic &exprs, const vec_sym &xs);
+
 class DiffVisitor : public BaseVisitor<DiffVisitor>
 {
 protected:
@@ -29,6 +37,13 @@ protected:
     umap_basic_basic visited;
     bool cache;
 
+    //! Returns true if `b` is known to have a zero derivative w.r.t. `x`, so
+    //! that it does not need to be visited
+    virtual bool is_independent(const RCP<const Basic> &b)
+    {
+        return false;
+    }
+
 public:
     DiffVisitor(const RCP<const Symbol> &x, bool cache = true)
         : x(x), cache(cache)
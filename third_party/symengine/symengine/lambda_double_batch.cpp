@@ -0,0 +1,712 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <symengine/eval_double.h>
+#include <symengine/lambda_double_batch.h>
+#include <symengine/symengine_exception.h>
+
+namespace SymEngine
+{
+
+typedef LambdaRealDoubleBatchVisitor::Opcode Opcode;
+
+static unsigned num_args(Opcode op)
+{
+    if (op == Opcode::Input or op == Opcode::Constant) {
+        return 0;
+    } else if (op == Opcode::Select) {
+        return 3;
+    } else if (op < Opcode::Sqrt) {
+        return 2;
+    } else {
+        return 1;
+    }
+}
+
+void LambdaRealDoubleBatchVisitor::init(const vec_basic &x, const Basic &b,
+                                        bool cse)
+{
+    vec_basic outputs = {b.rcp_from_this()};
+    init(x, outputs, cse);
+}
+
+void LambdaRealDoubleBatchVisitor::init(const vec_basic &inputs,
+                                        const vec_basic &outputs, bool cse)
+{
+    instructions_.clear();
+    output_registers_.clear();
+    values_.clear();
+    constants_.clear();
+    symbols_ = inputs;
+    num_inputs_ = inputs.size();
+
+    if (not cse) {
+        for (auto &p : outputs) {
+            output_registers_.push_back(apply(*p));
+        }
+    } else {
+        vec_basic reduced_exprs;
+        vec_pair replacements;
+        SymEngine::cse(replacements, reduced_exprs, outputs);
+        for (auto &rep : replacements) {
+            unsigned value = apply(*rep.second);
+            values_[rep.first] = value;
+        }
+        for (auto &p : reduced_exprs) {
+            output_registers_.push_back(apply(*p));
+        }
+    }
+
+    values_.clear();
+    constants_.clear();
+    symbols_.clear();
+
+    allocate_registers();
+}
+
+void LambdaRealDoubleBatchVisitor::allocate_registers()
+{
+    // The last instruction to read each value, or past the end for outputs
+    const unsigned end = static_cast<unsigned>(instructions_.size());
+    std::vector<unsigned> last_use(instructions_.size(), 0);
+    for (unsigned i = 0; i < instructions_.size(); i++) {
+        const Instruction &instruction = instructions_[i];
+        for (unsigned j = 0; j < num_args(instruction.op); j++) {
+            last_use[instruction.args[j]] = i;
+        }
+    }
+    for (unsigned value : output_registers_) {
+        last_use[value] = end;
+    }
+
+    // Linear scan: an instruction's args are freed before its result is
+    // assigned, so it may overwrite one of them.  This is safe because each
+    // point only reads its own element of each register before writing it.
+    std::vector<unsigned> registers(instructions_.size());
+    std::vector<unsigned> free_registers;
+    num_registers_ = 0;
+    for (unsigned i = 0; i < instructions_.size(); i++) {
+        Instruction &instruction = instructions_[i];
+        for (unsigned j = 0; j < num_args(instruction.op); j++) {
+            const unsigned arg = instruction.args[j];
+            instruction.args[j] = registers[arg];
+            bool repeated = false;
+            for (unsigned k = 0; k < j; k++) {
+                repeated = repeated or instructions_[i].args[k] == registers[arg];
+            }
+            if (last_use[arg] == i and not repeated) {
+                free_registers.push_back(registers[arg]);
+            }
+        }
+        if (free_registers.empty()) {
+            registers[i] = num_registers_++;
+        } else {
+            registers[i] = free_registers.back();
+            free_registers.pop_back();
+        }
+        instruction.dst = registers[i];
+    }
+    for (unsigned &value : output_registers_) {
+        value = registers[value];
+    }
+}
+
+// Runs `f` for each point in the block, with arrays of the values of the
+// instruction's args, and the array to write to
+#define BATCH_UNARY(OP, EXPR)                                                  \
+    case Opcode::OP: {                                                         \
+        const double *a = reg(instruction.args[0]);                            \
+        for (size_t k = 0; k < m; k++) {                                       \
+            dst[k] = EXPR;                                                     \
+        }                                                                      \
+        break;                                                                 \
+    }
+
+#define BATCH_BINARY(OP, EXPR)                                                 \
+    case Opcode::OP: {                                                         \
+        const double *a = reg(instruction.args[0]);                            \
+        const double *b = reg(instruction.args[1]);                            \
+        for (size_t k = 0; k < m; k++) {                                       \
+            dst[k] = EXPR;                                                     \
+        }                                                                      \
+        break;                                                                 \
+    }
+
+void LambdaRealDoubleBatchVisitor::call(double *outs, const double *inps,
+                                        size_t n) const
+{
+    // The registers are scratch memory for the duration of the call, and are
+    // kept per thread so that the same visitor can be called from multiple
+    // threads at once
+    thread_local std::vector<double> thread_registers;
+    if (thread_registers.size() < num_registers_ * block_size) {
+        thread_registers.resize(num_registers_ * block_size);
+    }
+    double *const registers = thread_registers.data();
+    auto reg = [registers](unsigned i) { return registers + i * block_size; };
+    const size_t num_outputs = output_registers_.size();
+
+    for (size_t start = 0; start < n; start += block_size) {
+        const size_t m = std::min(block_size, n - start);
+        const double *block_inps = inps + start * num_inputs_;
+
+        for (const Instruction &instruction : instructions_) {
+            double *dst = reg(instruction.dst);
+            switch (instruction.op) {
+                case Opcode::Input: {
+                    const double *a = block_inps + instruction.args[0];
+                    for (size_t k = 0; k < m; k++) {
+                        dst[k] = a[k * num_inputs_];
+                    }
+                    break;
+                }
+                case Opcode::Constant: {
+                    for (size_t k = 0; k < m; k++) {
+                        dst[k] = instruction.value;
+                    }
+                    break;
+                }
+                BATCH_BINARY(Add, a[k] + b[k])
+                BATCH_BINARY(Sub, a[k] - b[k])
+                BATCH_BINARY(Mul, a[k] * b[k])
+                BATCH_BINARY(Div, a[k] / b[k])
+                BATCH_BINARY(Pow, std::pow(a[k], b[k]))
+                BATCH_BINARY(ATan2, std::atan2(a[k], b[k]))
+                BATCH_BINARY(Max, std::max(a[k], b[k]))
+                BATCH_BINARY(Min, std::min(a[k], b[k]))
+                BATCH_BINARY(Equal, a[k] == b[k] ? 1.0 : 0.0)
+                BATCH_BINARY(Unequal, a[k] != b[k] ? 1.0 : 0.0)
+                BATCH_BINARY(LessThan, a[k] <= b[k] ? 1.0 : 0.0)
+                BATCH_BINARY(StrictLessThan, a[k] < b[k] ? 1.0 : 0.0)
+                BATCH_BINARY(And, (a[k] != 0.0 and b[k] != 0.0) ? 1.0 : 0.0)
+                BATCH_BINARY(Or, (a[k] != 0.0 or b[k] != 0.0) ? 1.0 : 0.0)
+                BATCH_BINARY(Xor, ((a[k] != 0.0) != (b[k] != 0.0)) ? 1.0 : 0.0)
+                BATCH_UNARY(Sqrt, std::sqrt(a[k]))
+                BATCH_UNARY(Exp, std::exp(a[k]))
+                BATCH_UNARY(Log, std::log(a[k]))
+                BATCH_UNARY(Sin, std::sin(a[k]))
+                BATCH_UNARY(Cos, std::cos(a[k]))
+                BATCH_UNARY(Tan, std::tan(a[k]))
+                BATCH_UNARY(ASin, std::asin(a[k]))
+                BATCH_UNARY(ACos, std::acos(a[k]))
+                BATCH_UNARY(ATan, std::atan(a[k]))
+                BATCH_UNARY(Sinh, std::sinh(a[k]))
+                BATCH_UNARY(Cosh, std::cosh(a[k]))
+                BATCH_UNARY(Tanh, std::tanh(a[k]))
+                BATCH_UNARY(ASinh, std::asinh(a[k]))
+                BATCH_UNARY(ACosh, std::acosh(a[k]))
+                BATCH_UNARY(ATanh, std::atanh(a[k]))
+                BATCH_UNARY(Abs, std::abs(a[k]))
+                BATCH_UNARY(Sign,
+                            a[k] == 0.0 ? 0.0 : (a[k] < 0.0 ? -1.0 : 1.0))
+                BATCH_UNARY(Floor, std::floor(a[k]))
+                BATCH_UNARY(Ceiling, std::ceil(a[k]))
+                BATCH_UNARY(Truncate, std::trunc(a[k]))
+                BATCH_UNARY(Erf, std::erf(a[k]))
+                BATCH_UNARY(Erfc, std::erfc(a[k]))
+                BATCH_UNARY(Gamma, std::tgamma(a[k]))
+                BATCH_UNARY(LogGamma, std::lgamma(a[k]))
+                BATCH_UNARY(Not, a[k] != 0.0 ? 0.0 : 1.0)
+                case Opcode::Select: {
+                    const double *c = reg(instruction.args[0]);
+                    const double *a = reg(instruction.args[1]);
+                    const double *b = reg(instruction.args[2]);
+                    for (size_t k = 0; k < m; k++) {
+                        dst[k] = c[k] == 1.0 ? a[k] : b[k];
+                    }
+                    break;
+                }
+            }
+        }
+
+        double *block_outs = outs + start * num_outputs;
+        for (size_t i = 0; i < num_outputs; i++) {
+            const double *value = reg(output_registers_[i]);
+            for (size_t k = 0; k < m; k++) {
+                block_outs[k * num_outputs + i] = value[k];
+            }
+        }
+    }
+}
+
+#undef BATCH_UNARY
+#undef BATCH_BINARY
+
+double LambdaRealDoubleBatchVisitor::call(const std::vector<double> &vec) const
+{
+    double res;
+    call(&res, vec.data());
+    return res;
+}
+
+unsigned LambdaRealDoubleBatchVisitor::apply(const Basic &b)
+{
+    RCP<const Basic> key = b.rcp_from_this();
+    auto it = values_.find(key);
+    if (it != values_.end()) {
+        return it->second;
+    }
+    b.accept(*this);
+    values_[key] = result_;
+    return result_;
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit(Opcode op, unsigned arg0,
+                                            unsigned arg1, unsigned arg2)
+{
+    Instruction instruction;
+    instruction.op = op;
+    instruction.dst = static_cast<unsigned>(instructions_.size());
+    instruction.args[0] = arg0;
+    instruction.args[1] = arg1;
+    instruction.args[2] = arg2;
+    instruction.value = 0.0;
+    instructions_.push_back(instruction);
+    return instruction.dst;
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit_constant(double value)
+{
+    // Keyed on the bits, so that e.g. NaN and -0.0 are handled
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    auto it = constants_.find(bits);
+    if (it != constants_.end()) {
+        return it->second;
+    }
+    unsigned result = emit(Opcode::Constant);
+    instructions_.back().value = value;
+    constants_[bits] = result;
+    return result;
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit_unary(Opcode op, const Basic &arg)
+{
+    return emit(op, apply(arg));
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit_reciprocal(const Basic &arg)
+{
+    unsigned one = emit_constant(1.0);
+    return emit(Opcode::Div, one, apply(arg));
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit_binary(Opcode op,
+                                                   const Basic &arg0,
+                                                   const Basic &arg1)
+{
+    unsigned a = apply(arg0);
+    unsigned b = apply(arg1);
+    return emit(op, a, b);
+}
+
+unsigned LambdaRealDoubleBatchVisitor::emit_fold(Opcode op,
+                                                 const vec_basic &args)
+{
+    unsigned result = apply(*args[0]);
+    for (size_t i = 1; i < args.size(); i++) {
+        result = emit(op, result, apply(*args[i]));
+    }
+    return result;
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Basic &)
+{
+    throw NotImplementedError("Not Implemented");
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Symbol &x)
+{
+    for (unsigned i = 0; i < symbols_.size(); ++i) {
+        if (eq(x, *symbols_[i])) {
+            result_ = emit(Opcode::Input, i);
+            return;
+        }
+    }
+    throw SymEngineException("Symbol not in the symbols vector.");
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Integer &x)
+{
+    result_ = emit_constant(mp_get_d(x.as_integer_class()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Rational &x)
+{
+    result_ = emit_constant(mp_get_d(x.as_rational_class()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const RealDouble &x)
+{
+    result_ = emit_constant(x.i);
+}
+
+#ifdef HAVE_SYMENGINE_MPFR
+void LambdaRealDoubleBatchVisitor::bvisit(const RealMPFR &x)
+{
+    result_ = emit_constant(mpfr_get_d(x.i.get_mpfr_t(), MPFR_RNDN));
+}
+#endif
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Constant &x)
+{
+    result_ = emit_constant(eval_double(x));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Infty &x)
+{
+    if (x.is_negative_infinity()) {
+        result_ = emit_constant(-std::numeric_limits<double>::infinity());
+    } else if (x.is_positive_infinity()) {
+        result_ = emit_constant(std::numeric_limits<double>::infinity());
+    } else {
+        throw SymEngineException(
+            "LambdaDouble can only represent real valued infinity");
+    }
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const BooleanAtom &x)
+{
+    result_ = emit_constant(x.get_val() ? 1.0 : 0.0);
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Add &x)
+{
+    // Same order of operations as LambdaRealDoubleVisitor, leaving out adds
+    // of zero and multiplications by one
+    bool has_coef = not x.get_coef()->is_zero();
+    unsigned result = has_coef ? apply(*x.get_coef()) : 0;
+    for (const auto &p : x.get_dict()) {
+        unsigned term = apply(*p.first);
+        if (not p.second->is_one()) {
+            term = emit(Opcode::Mul, term, apply(*p.second));
+        }
+        result = has_coef ? emit(Opcode::Add, result, term) : term;
+        has_coef = true;
+    }
+    result_ = result;
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Mul &x)
+{
+    bool has_coef = not x.get_coef()->is_one();
+    unsigned result = has_coef ? apply(*x.get_coef()) : 0;
+    for (const auto &p : x.get_dict()) {
+        unsigned factor = apply(*p.first);
+        if (eq(*p.second, *minus_one) and not has_coef) {
+            result = emit(Opcode::Div, emit_constant(1.0), factor);
+            has_coef = true;
+            continue;
+        } else if (eq(*p.second, *minus_one)) {
+            result = emit(Opcode::Div, result, factor);
+            continue;
+        } else if (eq(*p.second, *integer(2))) {
+            factor = emit(Opcode::Mul, factor, factor);
+        } else if (not eq(*p.second, *one)) {
+            factor = emit(Opcode::Pow, factor, apply(*p.second));
+        }
+        result = has_coef ? emit(Opcode::Mul, result, factor) : factor;
+        has_coef = true;
+    }
+    result_ = result;
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Pow &x)
+{
+    if (eq(*x.get_base(), *E)) {
+        result_ = emit_unary(Opcode::Exp, *x.get_exp());
+    } else if (eq(*x.get_exp(), *integer(2))) {
+        unsigned base = apply(*x.get_base());
+        result_ = emit(Opcode::Mul, base, base);
+    } else if (eq(*x.get_exp(), *minus_one)) {
+        result_ = emit_reciprocal(*x.get_base());
+    } else {
+        result_ = emit_binary(Opcode::Pow, *x.get_base(), *x.get_exp());
+    }
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Sin &x)
+{
+    result_ = emit_unary(Opcode::Sin, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Cos &x)
+{
+    result_ = emit_unary(Opcode::Cos, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Tan &x)
+{
+    result_ = emit_unary(Opcode::Tan, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Cot &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Tan, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Csc &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Sin, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Sec &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Cos, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ASin &x)
+{
+    result_ = emit_unary(Opcode::ASin, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACos &x)
+{
+    result_ = emit_unary(Opcode::ACos, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ASec &x)
+{
+    result_ = emit(Opcode::ACos, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACsc &x)
+{
+    result_ = emit(Opcode::ASin, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ATan &x)
+{
+    result_ = emit_unary(Opcode::ATan, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACot &x)
+{
+    result_ = emit(Opcode::ATan, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ATan2 &x)
+{
+    result_ = emit_binary(Opcode::ATan2, *x.get_num(), *x.get_den());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Log &x)
+{
+    result_ = emit_unary(Opcode::Log, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Sinh &x)
+{
+    result_ = emit_unary(Opcode::Sinh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Csch &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Sinh, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Cosh &x)
+{
+    result_ = emit_unary(Opcode::Cosh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Sech &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Cosh, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Tanh &x)
+{
+    result_ = emit_unary(Opcode::Tanh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Coth &x)
+{
+    result_ = emit(Opcode::Div, emit_constant(1.0),
+                   emit_unary(Opcode::Tanh, *x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ASinh &x)
+{
+    result_ = emit_unary(Opcode::ASinh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACsch &x)
+{
+    result_ = emit(Opcode::ASinh, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACosh &x)
+{
+    result_ = emit_unary(Opcode::ACosh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ATanh &x)
+{
+    result_ = emit_unary(Opcode::ATanh, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ACoth &x)
+{
+    result_ = emit(Opcode::ATanh, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const ASech &x)
+{
+    result_ = emit(Opcode::ACosh, emit_reciprocal(*x.get_arg()));
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Abs &x)
+{
+    result_ = emit_unary(Opcode::Abs, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Sign &x)
+{
+    result_ = emit_unary(Opcode::Sign, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Floor &x)
+{
+    result_ = emit_unary(Opcode::Floor, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Ceiling &x)
+{
+    result_ = emit_unary(Opcode::Ceiling, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Truncate &x)
+{
+    result_ = emit_unary(Opcode::Truncate, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Erf &x)
+{
+    result_ = emit_unary(Opcode::Erf, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Erfc &x)
+{
+    result_ = emit_unary(Opcode::Erfc, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Gamma &x)
+{
+    result_ = emit_unary(Opcode::Gamma, *x.get_args()[0]);
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const LogGamma &x)
+{
+    result_ = emit_unary(Opcode::LogGamma, *x.get_args()[0]);
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Max &x)
+{
+    result_ = emit_fold(Opcode::Max, x.get_args());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Min &x)
+{
+    result_ = emit_fold(Opcode::Min, x.get_args());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Equality &x)
+{
+    result_ = emit_binary(Opcode::Equal, *x.get_arg1(), *x.get_arg2());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Unequality &x)
+{
+    result_ = emit_binary(Opcode::Unequal, *x.get_arg1(), *x.get_arg2());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const LessThan &x)
+{
+    result_ = emit_binary(Opcode::LessThan, *x.get_arg1(), *x.get_arg2());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const StrictLessThan &x)
+{
+    result_
+        = emit_binary(Opcode::StrictLessThan, *x.get_arg1(), *x.get_arg2());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const And &x)
+{
+    result_ = emit_fold(Opcode::And, x.get_args());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Or &x)
+{
+    result_ = emit_fold(Opcode::Or, x.get_args());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Xor &x)
+{
+    result_ = emit_fold(Opcode::Xor, x.get_args());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Not &x)
+{
+    result_ = emit_unary(Opcode::Not, *x.get_arg());
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Contains &cts)
+{
+    const auto set = cts.get_set();
+    if (not is_a<Interval>(*set)) {
+        throw SymEngineException("LambdaDoubleVisitor: only ``Interval`` "
+                                 "implemented for ``Contains``.");
+    }
+    const auto &interv = down_cast<const Interval &>(*set);
+    const unsigned expr = apply(*cts.get_expr());
+
+    // An infinite end only excludes NaN
+    unsigned left_ok, right_ok;
+    if (eq(*interv.get_start(), *NegInf)) {
+        left_ok = emit(Opcode::Equal, expr, expr);
+    } else {
+        left_ok = emit(interv.get_left_open() ? Opcode::StrictLessThan
+                                              : Opcode::LessThan,
+                       apply(*interv.get_start()), expr);
+    }
+    if (eq(*interv.get_end(), *Inf)) {
+        right_ok = emit(Opcode::Equal, expr, expr);
+    } else {
+        right_ok = emit(interv.get_right_open() ? Opcode::StrictLessThan
+                                                : Opcode::LessThan,
+                        expr, apply(*interv.get_end()));
+    }
+    result_ = emit(Opcode::And, left_ok, right_ok);
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const Piecewise &pw)
+{
+    SYMENGINE_ASSERT_MSG(
+        eq(*pw.get_vec().back().second, *boolTrue),
+        "LambdaDouble requires a (Expr, True) at the end of Piecewise");
+
+    // Every piece is evaluated, and the first one whose condition holds is
+    // selected
+    const auto &vec = pw.get_vec();
+    unsigned result = apply(*vec.back().first);
+    for (size_t i = vec.size() - 1; i-- > 0;) {
+        unsigned pred = apply(*vec[i].second);
+        unsigned value = apply(*vec[i].first);
+        result = emit(Opcode::Select, pred, value, result);
+    }
+    result_ = result;
+}
+
+void LambdaRealDoubleBatchVisitor::bvisit(const UnevaluatedExpr &x)
+{
+    result_ = apply(*x.get_arg());
+}
+
+} // namespace SymEngine
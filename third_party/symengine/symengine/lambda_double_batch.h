@@ -0,0 +1,211 @@
+#ifndef SYMENGINE_LAMBDA_DOUBLE_BATCH_H
+#define SYMENGINE_LAMBDA_DOUBLE_BATCH_H
+
+#include <cstdint>
+#include <map>
+#include <symengine/visitor.h>
+
+namespace SymEngine
+{
+
+/*
+   Evaluates real valued expressions at many input points at once.
+
+   init() compiles the expressions into a flat list of instructions, one per
+   distinct subexpression, each of which reads and writes registers that hold
+   a value for each point in a block of points.  call() then runs each
+   instruction as a tight loop over the points in the block, which the
+   compiler can vectorize, instead of calling a tree of std::function for
+   each point like LambdaRealDoubleVisitor.
+
+   Registers are reused once the values in them are no longer needed, so the
+   scratch memory scales with the width of the expression rather than its
+   size.  The registers are thread local scratch memory rather than members,
+   so call() is const and may run on multiple threads at once.
+*/
+class LambdaRealDoubleBatchVisitor
+    : public BaseVisitor<LambdaRealDoubleBatchVisitor>
+{
+public:
+    enum class Opcode : std::uint8_t {
+        // Leaves
+        Input,
+        Constant,
+        // Binary
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Pow,
+        ATan2,
+        Max,
+        Min,
+        Equal,
+        Unequal,
+        LessThan,
+        StrictLessThan,
+        And,
+        Or,
+        Xor,
+        // Unary
+        Sqrt,
+        Exp,
+        Log,
+        Sin,
+        Cos,
+        Tan,
+        ASin,
+        ACos,
+        ATan,
+        Sinh,
+        Cosh,
+        Tanh,
+        ASinh,
+        ACosh,
+        ATanh,
+        Abs,
+        Sign,
+        Floor,
+        Ceiling,
+        Truncate,
+        Erf,
+        Erfc,
+        Gamma,
+        LogGamma,
+        Not,
+        // args[0] == 1.0 ? args[1] : args[2]
+        Select,
+    };
+
+    struct Instruction {
+        Opcode op;
+        // Register written by the instruction
+        unsigned dst;
+        // Registers read by the instruction, or for Input the index of the
+        // input
+        unsigned args[3];
+        // Value of a Constant
+        double value;
+    };
+
+    //! Number of points each instruction is run on at a time
+    static const size_t block_size = 64;
+
+    LambdaRealDoubleBatchVisitor() = default;
+    LambdaRealDoubleBatchVisitor(LambdaRealDoubleBatchVisitor &&) = default;
+    LambdaRealDoubleBatchVisitor &operator=(LambdaRealDoubleBatchVisitor &&)
+        = default;
+
+    void init(const vec_basic &x, const Basic &b, bool cse = false);
+    void init(const vec_basic &inputs, const vec_basic &outputs,
+              bool cse = false);
+
+    //! Evaluates the outputs at `n` points.  `inps` is `n` rows of
+    //! `inputs.size()` values, and `outs` is `n` rows of `outputs.size()`
+    //! values.  Safe to call concurrently from multiple threads.
+    void call(double *outs, const double *inps, size_t n = 1) const;
+
+    double call(const std::vector<double> &vec) const;
+
+    const std::vector<Instruction> &get_instructions() const
+    {
+        return instructions_;
+    }
+
+    unsigned get_num_registers() const
+    {
+        return num_registers_;
+    }
+
+    void bvisit(const Basic &);
+    void bvisit(const Symbol &x);
+    void bvisit(const Integer &x);
+    void bvisit(const Rational &x);
+    void bvisit(const RealDouble &x);
+#ifdef HAVE_SYMENGINE_MPFR
+    void bvisit(const RealMPFR &x);
+#endif
+    void bvisit(const Constant &x);
+    void bvisit(const Infty &x);
+    void bvisit(const BooleanAtom &x);
+    void bvisit(const Add &x);
+    void bvisit(const Mul &x);
+    void bvisit(const Pow &x);
+    void bvisit(const Sin &x);
+    void bvisit(const Cos &x);
+    void bvisit(const Tan &x);
+    void bvisit(const Cot &x);
+    void bvisit(const Csc &x);
+    void bvisit(const Sec &x);
+    void bvisit(const ASin &x);
+    void bvisit(const ACos &x);
+    void bvisit(const ASec &x);
+    void bvisit(const ACsc &x);
+    void bvisit(const ATan &x);
+    void bvisit(const ACot &x);
+    void bvisit(const ATan2 &x);
+    void bvisit(const Log &x);
+    void bvisit(const Sinh &x);
+    void bvisit(const Csch &x);
+    void bvisit(const Cosh &x);
+    void bvisit(const Sech &x);
+    void bvisit(const Tanh &x);
+    void bvisit(const Coth &x);
+    void bvisit(const ASinh &x);
+    void bvisit(const ACsch &x);
+    void bvisit(const ACosh &x);
+    void bvisit(const ATanh &x);
+    void bvisit(const ACoth &x);
+    void bvisit(const ASech &x);
+    void bvisit(const Abs &x);
+    void bvisit(const Sign &x);
+    void bvisit(const Floor &x);
+    void bvisit(const Ceiling &x);
+    void bvisit(const Truncate &x);
+    void bvisit(const Erf &x);
+    void bvisit(const Erfc &x);
+    void bvisit(const Gamma &x);
+    void bvisit(const LogGamma &x);
+    void bvisit(const Max &x);
+    void bvisit(const Min &x);
+    void bvisit(const Equality &x);
+    void bvisit(const Unequality &x);
+    void bvisit(const LessThan &x);
+    void bvisit(const StrictLessThan &x);
+    void bvisit(const And &x);
+    void bvisit(const Or &x);
+    void bvisit(const Xor &x);
+    void bvisit(const Not &x);
+    void bvisit(const Contains &x);
+    void bvisit(const Piecewise &x);
+    void bvisit(const UnevaluatedExpr &x);
+
+private:
+    // While compiling, registers are numbered by instruction, i.e. each
+    // instruction writes a new register.  allocate_registers() then renumbers
+    // them to reuse registers whose values are dead.
+    unsigned apply(const Basic &b);
+    unsigned emit(Opcode op, unsigned arg0 = 0, unsigned arg1 = 0,
+                  unsigned arg2 = 0);
+    unsigned emit_constant(double value);
+    unsigned emit_unary(Opcode op, const Basic &arg);
+    unsigned emit_reciprocal(const Basic &arg);
+    unsigned emit_binary(Opcode op, const Basic &arg0, const Basic &arg1);
+    unsigned emit_fold(Opcode op, const vec_basic &args);
+    void allocate_registers();
+
+    std::vector<Instruction> instructions_;
+    std::vector<unsigned> output_registers_;
+    unsigned num_registers_ = 0;
+    size_t num_inputs_ = 0;
+
+    // Only used while compiling
+    vec_basic symbols_;
+    umap_basic_uint values_;
+    std::map<std::uint64_t, unsigned> constants_;
+    unsigned result_;
+};
+
+} // namespace SymEngine
+
+#endif // SYMENGINE_LAMBDA_DOUBLE_BATCH_H
@@ -4,6 +4,7 @@
 #include <symengine/functions.h>
 #include <symengine/mul.h>
 #include <symengine/constants.h>
+#include <symengine/derivative.h>
 #include <symengine/symengine_exception.h>
 #include <symengine/visitor.h>
 #include <symengine/test_visitors.h>
@@ -487,10 +488,14 @@ CSRMatrix CSRMatrix::jacobian(const vec_basic &exprs, const vec_sym &x,
     p.reserve(nrows + 1);
     j.reserve(nrows);
     elems.reserve(nrows);
+    // With the cache, differentiate w.r.t. all of x at once, sharing the
+    // derivatives of subexpressions between the rows
+    const vec_basic dense = diff_cache ? diff(exprs, x) : vec_basic();
     for (unsigned ri = 0; ri < nrows; ++ri) {
         p.push_back(p.back());
         for (unsigned ci = 0; ci < ncols; ++ci) {
-            auto elem = exprs[ri]->diff(x[ci], diff_cache);
+            auto elem = diff_cache ? dense[ri * ncols + ci]
+                                   : exprs[ri]->diff(x[ci], false);
             if (!is_true(is_zero(*elem))) {
                 p.back()++;
                 j.push_back(ci);
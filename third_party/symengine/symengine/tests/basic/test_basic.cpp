@@ -569,6 +569,56 @@ TEST_CASE("Diff: Basic", "[basic]")
     r1 = diff(r1, x);
 }
 
+TEST_CASE("Diff: multiple variables", "[basic]")
+{
+    RCP<const Symbol> x = symbol("x");
+    RCP<const Symbol> y = symbol("y");
+    RCP<const Symbol> z = symbol("z");
+    RCP<const Symbol> w = symbol("w");
+    RCP<const Basic> i2 = integer(2);
+    RCP<const Basic> i3 = integer(3);
+    RCP<const Basic> f = function_symbol("f", {x, y});
+    RCP<const Basic> s = sin(add(mul(x, y), z));
+
+    vec_basic exprs = {
+        integer(5),
+        add(mul(i3, pow(x, i2)), mul(i2, mul(x, y))),
+        mul(s, cos(s)),
+        pow(add(x, y), add(s, z)),
+        f,
+        add(f, mul(abs(x), SymEngine::max({x, y, z}))),
+        SymEngine::piecewise({{x, Lt(y, z)}, {mul(x, z), SymEngine::boolTrue}}),
+        SymEngine::unevaluated_expr(y),
+        mul(log(z), atan2(s, y)),
+        add(mul(s, w), w),
+    };
+    SymEngine::vec_sym xs = {x, y, z, x};
+
+    vec_basic jacobian = diff(exprs, xs);
+    REQUIRE(jacobian.size() == exprs.size() * xs.size());
+    for (unsigned i = 0; i < exprs.size(); i++) {
+        for (unsigned j = 0; j < xs.size(); j++) {
+            REQUIRE(eq(*jacobian[i * xs.size() + j], *diff(exprs[i], xs[j])));
+        }
+    }
+
+    REQUIRE(diff(exprs, {}).empty());
+    REQUIRE(diff({}, xs).empty());
+
+    // Deeply nested expressions are walked without recursing into each level
+    RCP<const Basic> e = x;
+    RCP<const Basic> e_x = one;
+    for (unsigned i = 0; i < 1000; i++) {
+        e_x = mul(cos(e), e_x);
+        e = sin(e);
+    }
+    jacobian = diff({e, add(e, y)}, {x, y});
+    REQUIRE(eq(*jacobian[0], *e_x));
+    REQUIRE(eq(*jacobian[1], *zero));
+    REQUIRE(eq(*jacobian[2], *e_x));
+    REQUIRE(eq(*jacobian[3], *one));
+}
+
 TEST_CASE("compare: Basic", "[basic]")
 {
     RCP<const Basic> r1, r2;
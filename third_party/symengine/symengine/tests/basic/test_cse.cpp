@@ -23,6 +23,8 @@ using SymEngine::cse;
 using SymEngine::one;
 using SymEngine::unified_eq;
 using SymEngine::integer;
+using SymEngine::eq;
+using SymEngine::expand;
 
 TEST_CASE("CSE: simple", "[cse]")
 {
@@ -335,3 +337,40 @@ TEST_CASE("CSE: regression test gh-1463", "[cse]")
         cse(substs, reduced, {e1, e1, e3, e4, e4, e6, e7, e7, e9});
     }
 }
+
+TEST_CASE("CSE: many overlapping adds and muls", "[cse]")
+{
+    vec_basic s;
+    for (int i = 0; i < 8; i++) {
+        s.push_back(symbol("s" + std::to_string(i)));
+    }
+
+    // Sums and products of overlapping subsets of s, which share many pairs
+    // of args with each other
+    vec_basic exprs;
+    for (int i = 0; i < 40; i++) {
+        exprs.push_back(add(
+            {mul({s[i % 8], s[(3 * i + 1) % 8], s[(5 * i + 2) % 8]}),
+             mul({s[(i + 1) % 8], s[(i + 4) % 8]}), s[(7 * i + 3) % 8],
+             s[(i + 5) % 8], integer(i)}));
+        exprs.push_back(mul(
+            {s[i % 8], s[(i + 1) % 8], add({s[(i + 2) % 8], s[(i + 3) % 8]})}));
+    }
+
+    vec_pair substs;
+    vec_basic reduced;
+    cse(substs, reduced, exprs);
+    REQUIRE(substs.size() > 0);
+    REQUIRE(reduced.size() == exprs.size());
+
+    // Substituting the replacements back in gives the original expressions
+    for (auto it = substs.rbegin(); it != substs.rend(); ++it) {
+        SymEngine::map_basic_basic replacement{{it->first, it->second}};
+        for (auto &e : reduced) {
+            e = e->subs(replacement);
+        }
+    }
+    for (unsigned i = 0; i < exprs.size(); i++) {
+        REQUIRE(eq(*expand(reduced[i]), *expand(exprs[i])));
+    }
+}
@@ -2,6 +2,7 @@
 #include <chrono>
 
 #include <symengine/lambda_double.h>
+#include <symengine/lambda_double_batch.h>
 #include <symengine/symengine_exception.h>
 #include <symengine/eval.h>
 #include <symengine/rational.h>
@@ -35,6 +36,7 @@ using SymEngine::NegInf;
 using SymEngine::boolTrue;
 using SymEngine::LambdaRealDoubleVisitor;
 using SymEngine::LambdaComplexDoubleVisitor;
+using SymEngine::LambdaRealDoubleBatchVisitor;
 using SymEngine::max;
 using SymEngine::pi;
 using SymEngine::sin;
@@ -219,6 +221,7 @@ TEST_CASE("Evaluate functions", "[lambda_gamma]")
     x = symbol("x");
 
     LambdaRealDoubleVisitor v;
+    LambdaRealDoubleBatchVisitor v_batch;
 
     std::vector<std::tuple<RCP<const Basic>, double, double>> testvec = {
         std::make_tuple(pow(E, cos(x)), 1.3, 1.30669209920819),
@@ -263,7 +266,87 @@ TEST_CASE("Evaluate functions", "[lambda_gamma]")
         v.init({x}, *std::get<0>(testvec[i]));
         d = v.call({std::get<1>(testvec[i])});
         REQUIRE(::fabs(d - std::get<2>(testvec[i])) < 1e-12);
+
+        v_batch.init({x}, *std::get<0>(testvec[i]));
+        d = v_batch.call({std::get<1>(testvec[i])});
+        REQUIRE(::fabs(d - std::get<2>(testvec[i])) < 1e-12);
+    }
+}
+
+TEST_CASE("Batch evaluate to double", "[lambda_double_batch]")
+{
+    RCP<const Basic> x, y, z, r, s;
+    x = symbol("x");
+    y = symbol("y");
+    z = symbol("z");
+
+    r = add(x, add(mul(y, z), pow(mul(y, z), integer(2))));
+    s = add(mul(integer(2), x), add(mul(y, z), pow(mul(y, z), integer(2))));
+
+    LambdaRealDoubleBatchVisitor v;
+    LambdaRealDoubleVisitor v_single;
+    for (bool cse : {false, true}) {
+        v.init({x, y, z}, {r, s}, cse);
+        v_single.init({x, y, z}, {r, s}, cse);
+
+        // More points than fit in a block
+        const size_t n = LambdaRealDoubleBatchVisitor::block_size * 3 + 5;
+        std::vector<double> inps(n * 3), outs(n * 2);
+        for (size_t i = 0; i < inps.size(); i++) {
+            inps[i] = 0.01 * i - 2.0;
+        }
+        v.call(outs.data(), inps.data(), n);
+
+        for (size_t i = 0; i < n; i++) {
+            double expected[2];
+            v_single.call(expected, &inps[i * 3]);
+            REQUIRE(::fabs(outs[i * 2] - expected[0]) < 1e-12);
+            REQUIRE(::fabs(outs[i * 2 + 1] - expected[1]) < 1e-12);
+        }
     }
+
+    double d[2];
+    double inps[] = {1.5, 2.0, 3.0};
+    v.call(d, inps);
+    REQUIRE(::fabs(d[0] - 43.5) < 1e-12);
+    REQUIRE(::fabs(d[1] - 45.0) < 1e-12);
+
+    // Registers are reused, so a long sum only needs a few
+    vec_basic terms;
+    for (int i = 0; i < 100; i++) {
+        terms.push_back(sin(mul(integer(i), x)));
+    }
+    v.init({x}, *add(terms));
+    REQUIRE(v.get_instructions().size() > 200);
+    REQUIRE(v.get_num_registers() < 5);
+
+    // Functions without inputs don't read the inputs, and calls are const
+    v.init({}, *integer(3));
+    const LambdaRealDoubleBatchVisitor &v_const = v;
+    double const_outs[2];
+    v_const.call(const_outs, nullptr, 2);
+    REQUIRE(const_outs[0] == 3.0);
+    REQUIRE(const_outs[1] == 3.0);
+
+    // Undefined symbols raise an exception
+    CHECK_THROWS_AS(v.init({x}, *r), SymEngineException &);
+    CHECK_THROWS_AS(
+        v.init({x}, *add(complex_double(std::complex<double>(1, 2)), x)),
+        NotImplementedError &);
+
+    // Piecewise
+    auto int1 = interval(NegInf, integer(2), true, false);
+    auto int2 = interval(integer(2), integer(5), true, false);
+    r = piecewise({{x, contains(x, int1)},
+                   {y, contains(x, int2)},
+                   {add(x, y), boolTrue}});
+    v.init({x, y}, *r);
+    double pw_inps[] = {1.1, 3.3, 2.2, 3.3, 5.5, 3.3};
+    double pw_outs[3];
+    v.call(pw_outs, pw_inps, 3);
+    REQUIRE(::fabs(pw_outs[0] - 1.1) < 1e-12);
+    REQUIRE(::fabs(pw_outs[1] - 3.3) < 1e-12);
+    REQUIRE(::fabs(pw_outs[2] - 8.8) < 1e-12);
 }
 
 #ifdef HAVE_SYMENGINE_LLVM
@@ -1026,6 +1026,12 @@ cdef extern from "<symengine/lambda_double.h>" namespace "SymEngine":
         void init(const vec_basic &x, const vec_basic &b, bool cse) nogil except +
         void call(double complex *r, const double complex *x) nogil
 
+cdef extern from "<symengine/lambda_double_batch.h>" namespace "SymEngine":
+    cdef cppclass LambdaRealDoubleBatchVisitor:
+        LambdaRealDoubleBatchVisitor() nogil
+        void init(const vec_basic &x, const vec_basic &b, bool cse) nogil except +
+        void call(double *r, const double *x, size_t n) nogil const
+
 cdef extern from "<symengine/llvm_double.h>" namespace "SymEngine":
     cdef cppclass LLVMVisitor:
         LLVMVisitor() nogil
@@ -55,6 +55,10 @@ cdef class LambdaDouble(_Lambdify):
                       double[::1] inp, double[::1] out,
                       int inp_offset=*, int out_offset=*)
 
+cdef class LambdaDoubleBatch(_Lambdify):
+    cdef vector[symengine.LambdaRealDoubleBatchVisitor] lambda_double
+    cdef _init(self, symengine.vec_basic& args_, symengine.vec_basic& outs_, cppbool cse)
+
 cdef class LambdaComplexDouble(_Lambdify):
     cdef vector[symengine.LambdaComplexDoubleVisitor] lambda_double
     cdef _init(self, symengine.vec_basic& args_, symengine.vec_basic& outs_, cppbool cse)
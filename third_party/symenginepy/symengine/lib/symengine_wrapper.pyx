@@ -4988,6 +4988,36 @@ cdef class LambdaDouble(_Lambdify):
         return addr1, addr2
 
 
+cdef class LambdaDoubleBatch(_Lambdify):
+    """
+    Like LambdaDouble, but evaluates all broadcast points in one call, each
+    operation as a loop over a block of points
+    """
+    def __cinit__(self, args, *exprs, cppbool real=True, order='C', cppbool cse=False, cppbool _load=False, dtype=None):
+        # reject additional arguments
+        pass
+
+    cdef _init(self, symengine.vec_basic& args_, symengine.vec_basic& outs_, cppbool cse):
+        self.lambda_double.resize(1)
+        self.lambda_double[0].init(args_, outs_, cse)
+
+    cpdef unsafe_eval(self, inp, out, unsigned nbroadcast=1):
+        cdef double[::1] c_inp, c_out
+        cdef double *inp_ptr = NULL
+        cdef double *out_ptr = NULL
+        c_inp = np.ascontiguousarray(inp.ravel(order=self.order), dtype=self.numpy_dtype)
+        c_out = out
+        # Functions without inputs (or outputs) have empty buffers, which can't be indexed
+        if c_inp.shape[0] > 0:
+            inp_ptr = &c_inp[0]
+        if c_out.shape[0] > 0:
+            out_ptr = &c_out[0]
+        # call() is const and keeps its scratch registers per thread, so it's safe to release the
+        # GIL while other threads call this function
+        with nogil:
+            self.lambda_double[0].call(out_ptr, inp_ptr, nbroadcast)
+
+
 cdef class LambdaComplexDouble(_Lambdify):
     def __cinit__(self, args, *exprs, cppbool real=True, order='C', cppbool cse=False, cppbool _load=False, dtype=None):
         # reject additional arguments
@@ -5158,7 +5188,9 @@ def Lambdify(args, *exprs, cppbool real=True, backend=None, order='C',
     real : bool
         Whether datatype is ``double`` (``double complex`` otherwise).
     backend : str
-        'llvm' or 'lambda'. When ``None`` the environment variable
+        'llvm', 'lambda' or 'batch'. 'batch' evaluates all broadcast points
+        in one loop over each operation, which is fastest for many points.
+        When ``None`` the environment variable
         'SYMENGINE_LAMBDIFY_BACKEND' is used (taken as 'lambda' if unset).
     order : 'C' or 'F'
         C- or Fortran-contiguous memory layout. Note that this affects
@@ -5214,6 +5246,13 @@ def Lambdify(args, *exprs, cppbool real=True, backend=None, order='C',
         ELSE:
             raise ValueError("""llvm backend is chosen, but symengine is not compiled
                                 with llvm support.""")
+    elif backend == "batch":
+        if real:
+            ret = LambdaDoubleBatch(args, *exprs, real=real, order=order, cse=cse, **kwargs)
+            if as_scipy:
+                raise ValueError("backend='batch' does not support as_scipy")
+            return ret
+        warnings.warn("backend='batch' only supports real values\nUsing backend='lambda'")
     elif backend == "lambda":
         pass
     else: